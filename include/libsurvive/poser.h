@@ -158,9 +158,35 @@ typedef int (*PoserCB)(SurviveObject *so, void **user, PoserData *pd);
 #define SURVIVE_POSER_INVOKE(so, poserData) survive_poser_invoke(so, (PoserData *)poserData, sizeof(*poserData));
 void survive_poser_invoke(SurviveObject *so, PoserData *poserData, size_t poserDataSize);
 
+/**
+ * Posers wrap long running solves with these so the solve doesn't stall ingest. Release drops the object lock, and
+ * also the ctx lock when called from an ingest thread; its return value must be passed back to survive_poser_get_locks.
+ */
+SURVIVE_EXPORT uint32_t survive_poser_release_locks(SurviveObject *so);
+SURVIVE_EXPORT void survive_poser_get_locks(SurviveObject *so, uint32_t so_lock_depth);
+
+/**
+ * Threaded posers run the inner poser on a pool of workers shared by every object (see "poser-threads"). Only the
+ * newest sync per object is kept; syncs that are replaced before a worker picks them up are counted as dropped.
+ */
+typedef struct survive_threaded_poser_stats {
+	uint32_t run_cnt;	   // Times the inner poser ran on a sync
+	uint32_t new_data_cnt; // Syncs handed to the threaded poser
+	uint32_t drop_cnt;	   // Syncs replaced by a newer one before they ran
+	uint32_t steal_cnt;	   // Runs picked up by a worker other than the one the object was queued on
+} survive_threaded_poser_stats;
+
 struct survive_threaded_poser;
+struct survive_threaded_poser_pool;
 struct survive_threaded_poser *survive_create_threaded_poser(SurviveObject *so, PoserCB innerPoser);
 int survive_threaded_poser_fn(SurviveObject *so, void **user, PoserData *pd);
+struct survive_threaded_poser_pool *survive_threaded_poser_pool_create(SurviveContext *ctx);
+void survive_threaded_poser_pool_free(struct survive_threaded_poser_pool *pool);
+
+/**
+ * Fills in stats for an object running on a threaded poser. Returns false if the object isn't using one.
+ */
+SURVIVE_EXPORT bool survive_threaded_poser_get_stats(const SurviveObject *so, survive_threaded_poser_stats *stats);
 
 #ifdef __cplusplus
 };
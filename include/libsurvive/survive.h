@@ -9,6 +9,10 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#ifdef SURVIVE_COMPACT_SENSOR_ACTIVATIONS
+#include <math.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -21,25 +25,52 @@ extern "C" {
 #endif
 
 
+#ifdef SURVIVE_COMPACT_SENSOR_ACTIVATIONS
+/**
+ * One sensor's last reading from one lighthouse axis. The angle and when it was seen sit next to each other so taking
+ * a reading touches one cache line.
+ */
+typedef struct SurviveSensorReading {
+	FLT angle;
+	uint32_t timecode; // Ticks after SurviveSensorActivations::timecode_base; 0 if there never was a reading
+	uint32_t hits;
+} SurviveSensorReading;
+#endif
+
 /**
  * This struct encodes what the last effective angles seen on a sensor were, and when they occured.
+ *
+ * Use SurviveSensorActivations_angle / _timecode / _hits rather than the arrays directly; building with
+ * SURVIVE_COMPACT_SENSOR_ACTIVATIONS swaps them for a heap allocated table of SurviveSensorReading, laid out
+ * [lh][sensor][axis] and only as deep as the lighthouses actually seen. That table isn't copied with the struct; use
+ * SurviveSensorActivations_copy for that.
  */
 typedef struct SurviveSensorActivations_s {
 	SurviveObject *so;
 	int lh_gen;
 
+#ifdef SURVIVE_COMPACT_SENSOR_ACTIVATIONS
+	SurviveSensorReading *readings;
+	int readings_lh_cnt;
+	survive_long_timecode timecode_base;
+#else
 	// Valid for gen2; somewhat different meaning though -- refers to angle of the rotor when the sweep happened.
 	FLT angles[SENSORS_PER_OBJECT][NUM_GEN2_LIGHTHOUSES][2];				// 2 Axes (Angles in LH space)
+	survive_long_timecode timecode[SENSORS_PER_OBJECT][NUM_GEN2_LIGHTHOUSES][2]; // Timecode per axis in ticks
+	survive_long_timecode hits[SENSORS_PER_OBJECT][NUM_GEN2_LIGHTHOUSES][2];
+#endif
+
 	FLT angles_center_x[NUM_GEN2_LIGHTHOUSES][2];
 	FLT angles_center_dev[NUM_GEN2_LIGHTHOUSES][2];
 	int angles_center_cnt[NUM_GEN2_LIGHTHOUSES][2];
 
-	survive_long_timecode timecode[SENSORS_PER_OBJECT][NUM_GEN2_LIGHTHOUSES][2]; // Timecode per axis in ticks
-
 	// Valid only for Gen1
 	survive_timecode lengths[SENSORS_PER_OBJECT][NUM_GEN1_LIGHTHOUSES][2]; // Timecode per axis in ticks
 
-	survive_long_timecode hits[SENSORS_PER_OBJECT][NUM_GEN2_LIGHTHOUSES][2];
+	// One bit per sensor that has ever had a reading from the given lighthouse and axis, and the newest reading per
+	// lighthouse. These let SurviveSensorActivations_valid_sensors skip straight to the readings that can be valid.
+	uint32_t seen_sensors[NUM_GEN2_LIGHTHOUSES][2];
+	survive_long_timecode lh_last_reading[NUM_GEN2_LIGHTHOUSES];
 
 	size_t imu_init_cnt;
 	survive_long_timecode last_imu;
@@ -54,11 +85,71 @@ typedef struct SurviveSensorActivations_s {
 	FLT mag[3];
 } SurviveSensorActivations;
 
+#ifdef SURVIVE_COMPACT_SENSOR_ACTIVATIONS
+static inline const SurviveSensorReading *SurviveSensorActivations_reading(const SurviveSensorActivations *self,
+																		   uint32_t sensor_idx, int lh, int axis) {
+	if (lh >= self->readings_lh_cnt)
+		return 0;
+	return &self->readings[((size_t)lh * SENSORS_PER_OBJECT + sensor_idx) * 2 + axis];
+}
+
+/**
+ * Last angle seen by the given sensor from the given lighthouse and axis; NAN if there was none
+ */
+static inline FLT SurviveSensorActivations_angle(const SurviveSensorActivations *self, uint32_t sensor_idx, int lh,
+												 int axis) {
+	const SurviveSensorReading *reading = SurviveSensorActivations_reading(self, sensor_idx, lh, axis);
+	return reading ? reading->angle : (FLT)NAN;
+}
+
+/**
+ * When that angle was seen; 0 if it never was
+ */
+static inline survive_long_timecode SurviveSensorActivations_timecode(const SurviveSensorActivations *self,
+																	  uint32_t sensor_idx, int lh, int axis) {
+	const SurviveSensorReading *reading = SurviveSensorActivations_reading(self, sensor_idx, lh, axis);
+	return reading && reading->timecode ? self->timecode_base + reading->timecode : 0;
+}
+
+static inline survive_long_timecode SurviveSensorActivations_hits(const SurviveSensorActivations *self,
+																  uint32_t sensor_idx, int lh, int axis) {
+	const SurviveSensorReading *reading = SurviveSensorActivations_reading(self, sensor_idx, lh, axis);
+	return reading ? reading->hits : 0;
+}
+#else
+/**
+ * Last angle seen by the given sensor from the given lighthouse and axis; NAN if there was none
+ */
+static inline FLT SurviveSensorActivations_angle(const SurviveSensorActivations *self, uint32_t sensor_idx, int lh,
+												 int axis) {
+	return self->angles[sensor_idx][lh][axis];
+}
+
+/**
+ * When that angle was seen; 0 if it never was
+ */
+static inline survive_long_timecode SurviveSensorActivations_timecode(const SurviveSensorActivations *self,
+																	  uint32_t sensor_idx, int lh, int axis) {
+	return self->timecode[sensor_idx][lh][axis];
+}
+
+static inline survive_long_timecode SurviveSensorActivations_hits(const SurviveSensorActivations *self,
+																  uint32_t sensor_idx, int lh, int axis) {
+	return self->hits[sensor_idx][lh][axis];
+}
+#endif
+
 struct PoserDataLight;
 struct PoserDataIMU;
 
 SURVIVE_EXPORT void SurviveSensorActivations_reset(SurviveSensorActivations *self);
 SURVIVE_EXPORT void SurviveSensorActivations_ctor(SurviveObject *so, SurviveSensorActivations *self);
+SURVIVE_EXPORT void SurviveSensorActivations_dtor(SurviveSensorActivations *self);
+/**
+ * Copies src over dst, which must be zeroed or constructed already. Unlike assignment this also copies the reading
+ * table of the compact layout.
+ */
+SURVIVE_EXPORT void SurviveSensorActivations_copy(SurviveSensorActivations *dst, const SurviveSensorActivations *src);
 SURVIVE_EXPORT survive_long_timecode SurviveSensorActivations_long_timecode_imu(const SurviveSensorActivations *self, survive_timecode timecode);
 SURVIVE_EXPORT survive_long_timecode SurviveSensorActivations_long_timecode_light(const SurviveSensorActivations *self, survive_timecode timecode);
 
@@ -84,6 +175,13 @@ SURVIVE_EXPORT bool SurviveSensorActivations_is_reading_valid(const SurviveSenso
 															  survive_long_timecode tolerance, uint32_t sensor_idx,
 															  int lh, int axis);
 
+/**
+ * Returns a mask with bit n set iff SurviveSensorActivations_is_reading_valid holds for sensor n with the given
+ * lighthouse and axis. Much cheaper than asking sensor by sensor when most lighthouses haven't been seen lately.
+ */
+SURVIVE_EXPORT uint32_t SurviveSensorActivations_valid_sensors(const SurviveSensorActivations *self,
+															   survive_long_timecode tolerance, int lh, int axis);
+
 SURVIVE_EXPORT survive_timecode SurviveSensorActivations_time_since_last_reading(const SurviveSensorActivations *self,
 																				 uint32_t sensor_idx, int lh, int axis);
 
@@ -193,6 +291,11 @@ struct SurviveObject {
 
 	struct SurviveKalmanTracker *tracker;
 
+	// Guards activations, tracker and poser state of this object; see survive_get_so_lock
+	og_mutex_t object_lock;
+	uint32_t object_lock_depth;
+	const void *object_lock_owner;
+
 	struct {
 		uint32_t syncs[NUM_GEN2_LIGHTHOUSES];
 		uint32_t skipped_syncs[NUM_GEN2_LIGHTHOUSES];
@@ -204,6 +307,8 @@ struct SurviveObject {
 
 		uint32_t extent_hits, extent_misses, naive_hits;
 		FLT min_extent, max_extent;
+
+		uint32_t lock_contentions;
 	} stats;
 };
 
@@ -392,6 +497,24 @@ SURVIVE_EXPORT void survive_close(SurviveContext *ctx);
 SURVIVE_EXPORT void survive_get_ctx_lock(SurviveContext *ctx);
 SURVIVE_EXPORT void survive_release_ctx_lock(SurviveContext *ctx);
 
+/**
+ * The object lock guards the state of a single object -- its activations, kalman tracker and poser data -- so that
+ * work on one object doesn't stall every other object. The bsd lock guards the shared lighthouse state in ctx->bsd.
+ *
+ * Locks must be taken in the order ctx lock, object lock, bsd lock. More than one object lock may only be held at a
+ * time by a thread which also holds the ctx lock.
+ */
+SURVIVE_EXPORT void survive_get_so_lock(SurviveObject *so);
+SURVIVE_EXPORT void survive_release_so_lock(SurviveObject *so);
+// How many times the calling thread currently holds the object lock
+SURVIVE_EXPORT uint32_t survive_held_so_lock_depth(const SurviveObject *so);
+SURVIVE_EXPORT void survive_get_bsd_lock(SurviveContext *ctx);
+SURVIVE_EXPORT void survive_release_bsd_lock(SurviveContext *ctx);
+// Copies cnt entries of ctx->bsd, starting at lh, under the bsd lock. Code that can run without the ctx lock -- threaded
+// posers and the hooks they call -- reads lighthouse state through this, since the lighthouse pose hooks write it
+// holding only the bsd lock.
+SURVIVE_EXPORT void survive_get_bsd_snapshot(SurviveContext *ctx, uint8_t lh, uint8_t cnt, BaseStationData *bsd);
+
 SURVIVE_EXPORT const char *survive_build_tag();
 
 SURVIVE_EXPORT SurviveObject *survive_get_so_by_name(SurviveContext *ctx, const char *name);
@@ -552,6 +675,7 @@ SURVIVE_EXPORT void survive_add_driver(SurviveContext *ctx, void *driver_data, D
 SURVIVE_EXPORT bool *survive_add_threaded_driver(SurviveContext *ctx, void *driver_data, const char *name,
 												 void *(routine)(void *), DeviceDriverCb close);
 SURVIVE_EXPORT char *survive_export_config(SurviveObject *so);
+// Forgets every lighthouse pose so they get solved again; takes the ctx lock unless the calling thread holds it
 SURVIVE_EXPORT void survive_reset_lighthouse_positions(SurviveContext *ctx);
 
 // This is the disambiguator function, for taking light timing and figuring out place-in-sweep for a given photodiode.
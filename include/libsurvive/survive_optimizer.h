@@ -25,6 +25,20 @@ typedef struct {
 struct mp_par_struct;
 struct mp_result_struct;
 
+typedef enum {
+	// Dense MINPACK style solve through mpfit; handles every parameter configuration
+	SURVIVE_OPTIMIZER_BACKEND_MPFIT = 0,
+	// Block sparse Levenberg-Marquardt that eliminates the object poses and solves the reduced lighthouse system. Only
+	// applies when every free parameter is an object or lighthouse pose with analytic jacobians; anything else falls
+	// back to mpfit.
+	SURVIVE_OPTIMIZER_BACKEND_SPARSE_LM,
+} survive_optimizer_backend;
+
+// Returned from survive_optimizer_run when the run was stopped through survive_optimizer::cancelled
+#define SURVIVE_OPTIMIZER_CANCELLED (-100)
+
+struct prepared_reprojection;
+
 typedef struct survive_optimizer {
 	const survive_reproject_model_t *reprojectModel;
 
@@ -43,9 +57,17 @@ typedef struct survive_optimizer {
 	bool nofilter;
 
 	mp_config *cfg;
+	survive_optimizer_backend backend;
 
 	bool needsFiltering;
 
+	// Set from optimizer-float-residuals when the optimizer runs. All residuals then come from the single precision
+	// reprojection, including those of jacobian evaluations; parameters and jacobians stay in double.
+	bool floatResiduals;
+
+	// Scratch space for the evaluations of the calling thread; only valid while survive_optimizer_run runs
+	struct prepared_reprojection *prepared;
+
 	struct {
 		uint32_t total_meas_cnt;
 		uint32_t total_lh_cnt;
@@ -55,6 +77,10 @@ typedef struct survive_optimizer {
 
 	void *user;
 	void (*iteration_cb)(struct survive_optimizer *opt_ctx, int m, int n, FLT *p, FLT *deviates, FLT **derivs);
+
+	// Checked around every evaluation. Setting it from iteration_cb or from another thread stops the run early with
+	// SURVIVE_OPTIMIZER_CANCELLED, in which case the parameters should be ignored.
+	volatile bool cancelled;
 } survive_optimizer;
 
 #define SURVIVE_OPTIMIZER_SETUP_BUFFERS(ctx, alloc_fn, ...)                                                            \
@@ -127,6 +153,12 @@ SURVIVE_EXPORT const char *survive_optimizer_error(int status);
 
 SURVIVE_EXPORT int survive_optimizer_run(survive_optimizer *optimizer, struct mp_result_struct *result);
 
+/**
+ * Whether or not the given optimizer can be run through SURVIVE_OPTIMIZER_BACKEND_SPARSE_LM. Parameters must already
+ * be setup.
+ */
+SURVIVE_EXPORT bool survive_optimizer_sparse_supported(const survive_optimizer *optimizer);
+
 SURVIVE_EXPORT void survive_optimizer_set_reproject_model(survive_optimizer *optimizer,
 														  const survive_reproject_model_t *reprojectModel);
 
@@ -48,6 +48,38 @@ typedef void (*survive_reproject_axisangle_full_jac_obj_pose_fn_t)(FLT *out, con
 typedef survive_reproject_axisangle_axis_jacob_fn_t survive_reproject_axisangle_full_jac_lh_pose_fn_t;
 typedef survive_reproject_axisangle_full_jac_obj_pose_fn_t survive_reproject_axisangle_axis_jacob_lh_pose_fn_t;
 
+/**
+ * Batched versions of the full reprojection functions: n sensor points on one object seen by one lighthouse. Points
+ * are passed as a structure of arrays -- the n x values, then the n y values, then the n z values -- and results come
+ * back the same way, so value k of point i lands in out[k * n + i].
+ */
+typedef void (*survive_reproject_full_batch_fn_t)(FLT *out, size_t n, const SurvivePose *obj2world,
+												  const FLT *ptsInObj, const SurvivePose *world2lh,
+												  const BaseStationCal *bcal);
+typedef void (*survive_reproject_axisangle_full_batch_fn_t)(FLT *out, size_t n, const LinmathAxisAnglePose *obj2world,
+															const FLT *ptsInObj, const LinmathAxisAnglePose *world2lh,
+															const BaseStationCal *bcal);
+
+/**
+ * Reprojection split in two for callers that evaluate many points against the same poses: prepare does all the work
+ * that only depends on the poses and calibration into prepared_size FLTs, and eval finishes it off for one point. eval
+ * writes the value, then the jacobian wrt the object pose and, for the variants that have it, the jacobian wrt the
+ * lighthouse pose, each row by row.
+ */
+typedef void (*survive_reproject_axisangle_prepare_fn_t)(FLT *prepared, const LinmathAxisAnglePose *obj2world,
+														 const LinmathAxisAnglePose *world2lh,
+														 const BaseStationCal *bcal);
+typedef void (*survive_reproject_prepared_eval_fn_t)(FLT *out, const FLT *prepared, const LinmathVec3d ptInObj);
+
+// Enough room for the prepared state of any of the model's prepared functions
+#define SURVIVE_REPROJECT_PREPARED_MAX 128
+
+typedef struct survive_reproject_prepared_fn_t {
+	survive_reproject_axisangle_prepare_fn_t prepare;
+	survive_reproject_prepared_eval_fn_t eval;
+	size_t prepared_size;
+} survive_reproject_prepared_fn_t;
+
 typedef struct survive_reproject_model_t {
 	survive_reproject_xy_fn_t reprojectXY;
 	survive_reproject_axis_fn_t reprojectAxisFn[2];
@@ -64,6 +96,26 @@ typedef struct survive_reproject_model_t {
 
 	survive_reproject_axisangle_full_jac_lh_pose_fn_t reprojectAxisAngleFullJacLhPose;
 	survive_reproject_axisangle_axis_jacob_lh_pose_fn_t reprojectAxisAngleAxisJacobLhPoseFn[2];
+
+	survive_reproject_full_batch_fn_t reprojectFullBatch;
+	survive_reproject_full_batch_fn_t reprojectAxisFullBatchFn[2];
+	survive_reproject_full_batch_fn_t reprojectFullJacObjPoseBatch;
+	survive_reproject_full_batch_fn_t reprojectAxisJacobBatchFn[2];
+	survive_reproject_axisangle_full_batch_fn_t reprojectAxisAngleFullJacObjPoseBatch;
+	survive_reproject_axisangle_full_batch_fn_t reprojectAxisAngleAxisJacobBatchFn[2];
+
+	survive_reproject_prepared_fn_t reprojectAxisAngleFullPrepared;
+	survive_reproject_prepared_fn_t reprojectAxisAnglePrepared[2];
+	survive_reproject_prepared_fn_t reprojectAxisAngleFullValJacObjPose;
+	survive_reproject_prepared_fn_t reprojectAxisAngleAxisValJacObjPose[2];
+	survive_reproject_prepared_fn_t reprojectAxisAngleFullValJacPoses;
+	survive_reproject_prepared_fn_t reprojectAxisAngleAxisValJacPoses[2];
+
+	// Single precision evals over the prepared state of reprojectAxisAngleFullPrepared / reprojectAxisAnglePrepared,
+	// with polynomial approximations standing in for the libm calls. Inputs and outputs are still FLT. Meant for
+	// residuals; check_generated bounds their error against eval.
+	survive_reproject_prepared_eval_fn_t reprojectAxisAngleFullEvalFloat;
+	survive_reproject_prepared_eval_fn_t reprojectAxisAngleAxisEvalFloat[2];
 } survive_reproject_model_t;
 
 SURVIVE_IMPORT extern const survive_reproject_model_t survive_reproject_model;
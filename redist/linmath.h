@@ -69,6 +69,7 @@ extern "C" {
 #define FLT_STRTO strtod
 #define SURVIVE_SV_F SV_64F
 #define SV_FLT SV_64F
+#define FLT_POW pow
 #endif
 
 #define SV_RAW_PTR(X) ((X)->data)
@@ -19,16 +19,25 @@
 		 (recursive on platforms where available.)
 		og_mutex_t OGCreateMutex();
 		void OGLockMutex( og_mutex_t om );
+		bool OGTryLockMutex( og_mutex_t om ); //Returns true if the lock was acquired without blocking.
 		void OGUnlockMutex( og_mutex_t om );
 		void OGDeleteMutex( og_mutex_t om );
 
 //Always a semaphore (not recursive)
 // og_sema_t OGCreateSema(); //Create a semaphore, comes locked initially.  NOTE: Max count is 32767
 //  void OGLockSema( og_sema_t os );
+//  bool OGTryLockSema( og_sema_t os ); //Returns true if the semaphore was taken without blocking.
+//  bool OGLockSemaTimeout( og_sema_t os, int ms ); //Returns true if the semaphore was taken within ms milliseconds.
 //  int OGGetSema( og_sema_t os );  //if <0 there was a failure.
 //  void OGUnlockSema( og_sema_t os );
 //  void OGDeleteSema( og_sema_t os );
 
+	Atomic 32-bit loads and stores, for single producer / single consumer handoffs.
+		uint32_t OGAtomicLoadAcquire32( volatile uint32_t * p );
+		void OGAtomicStoreRelease32( volatile uint32_t * p, uint32_t v );
+		void * OGAtomicLoadAcquirePtr( void * volatile * p );
+		void OGAtomicStoreReleasePtr( void * volatile * p, void * v );
+
 
 
    Copyright (c) 2011-2012,2013,2016,2018 <>< Charles Lohr
@@ -57,6 +66,12 @@
 
 #define OSG_INLINE static inline
 
+#ifdef _MSC_VER
+#define OG_THREAD_LOCAL __declspec(thread)
+#else
+#define OG_THREAD_LOCAL __thread
+#endif
+
 // Threads and Mutices
 typedef void *og_thread_t;
 typedef void *og_mutex_t;
@@ -97,6 +112,8 @@ OSG_INLINE og_mutex_t OGCreateMutex();
 
 OSG_INLINE void OGLockMutex(og_mutex_t om);
 
+OSG_INLINE bool OGTryLockMutex(og_mutex_t om);
+
 OSG_INLINE void OGUnlockMutex(og_mutex_t om);
 
 OSG_INLINE void OGDeleteMutex(og_mutex_t om);
@@ -105,10 +122,19 @@ OSG_INLINE og_sema_t OGCreateSema();
 
 OSG_INLINE void OGLockSema(og_sema_t os);
 
+OSG_INLINE bool OGTryLockSema(og_sema_t os);
+
+OSG_INLINE bool OGLockSemaTimeout(og_sema_t os, int ms);
+
 OSG_INLINE void OGUnlockSema(og_sema_t os);
 
 OSG_INLINE void OGDeleteSema(og_sema_t os);
 
+OSG_INLINE uint32_t OGAtomicLoadAcquire32(volatile uint32_t *p);
+OSG_INLINE void OGAtomicStoreRelease32(volatile uint32_t *p, uint32_t v);
+OSG_INLINE void *OGAtomicLoadAcquirePtr(void *volatile *p);
+OSG_INLINE void OGAtomicStoreReleasePtr(void *volatile *p, void *v);
+
 OSG_INLINE void OGSignalCond(og_cv_t cv);
 OSG_INLINE void OGBroadcastCond(og_cv_t cv);
 OSG_INLINE void OGWaitCond(og_cv_t cv, og_mutex_t m);
@@ -121,6 +121,18 @@ OSG_INLINE void OGLockMutex(og_mutex_t om) {
 	_OGHandlePosixError("OGLockMutex", pthread_mutex_lock((pthread_mutex_t *)om));
 }
 
+OSG_INLINE bool OGTryLockMutex(og_mutex_t om) {
+	if (!om) {
+		return true;
+	}
+	int err = pthread_mutex_trylock((pthread_mutex_t *)om);
+	if (err == EBUSY) {
+		return false;
+	}
+	_OGHandlePosixError("OGTryLockMutex", err);
+	return true;
+}
+
 OSG_INLINE void OGUnlockMutex(og_mutex_t om) {
 	if (!om) {
 		return;
@@ -151,8 +163,39 @@ OSG_INLINE int OGGetSema(og_sema_t os) {
 
 OSG_INLINE void OGLockSema(og_sema_t os) { sem_wait((sem_t *)os); }
 
+OSG_INLINE bool OGTryLockSema(og_sema_t os) { return sem_trywait((sem_t *)os) == 0; }
+
+OSG_INLINE bool OGLockSemaTimeout(og_sema_t os, int ms) {
+#ifdef __APPLE__
+	// No sem_timedwait here
+	for (int i = 0; i < ms; i++) {
+		if (sem_trywait((sem_t *)os) == 0)
+			return true;
+		usleep(1000);
+	}
+	return sem_trywait((sem_t *)os) == 0;
+#else
+	struct timespec ts = {};
+	clock_gettime(CLOCK_REALTIME, &ts);
+	uint64_t waittil = (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec + (uint64_t)ms * 1000000;
+
+	ts.tv_sec = waittil / 1000000000;
+	ts.tv_nsec = waittil % 1000000000;
+
+	int r;
+	while ((r = sem_timedwait((sem_t *)os, &ts)) != 0 && errno == EINTR)
+		;
+	return r == 0;
+#endif
+}
+
 OSG_INLINE void OGUnlockSema(og_sema_t os) { sem_post((sem_t *)os); }
 
+OSG_INLINE uint32_t OGAtomicLoadAcquire32(volatile uint32_t *p) { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+OSG_INLINE void OGAtomicStoreRelease32(volatile uint32_t *p, uint32_t v) { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+OSG_INLINE void *OGAtomicLoadAcquirePtr(void *volatile *p) { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+OSG_INLINE void OGAtomicStoreReleasePtr(void *volatile *p, void *v) { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+
 OSG_INLINE void OGDeleteSema(og_sema_t os) {
 	sem_destroy((sem_t *)os);
 	free(os);
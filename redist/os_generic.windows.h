@@ -71,6 +71,8 @@ OSG_INLINE og_mutex_t OGCreateMutex() {
 
 OSG_INLINE void OGLockMutex(og_mutex_t om) { EnterCriticalSection((CRITICAL_SECTION*)om); }
 
+OSG_INLINE bool OGTryLockMutex(og_mutex_t om) { return TryEnterCriticalSection((CRITICAL_SECTION *)om) != 0; }
+
 OSG_INLINE void OGUnlockMutex(og_mutex_t om) { LeaveCriticalSection((CRITICAL_SECTION*)om); }
 
 OSG_INLINE void OGDeleteMutex(og_mutex_t om) { free(om); }
@@ -116,10 +118,23 @@ OSG_INLINE int OGGetSema(og_sema_t os) {
 
 OSG_INLINE void OGLockSema(og_sema_t os) { WaitForSingleObject((HANDLE)os, INFINITE); }
 
+OSG_INLINE bool OGTryLockSema(og_sema_t os) { return WaitForSingleObject((HANDLE)os, 0) == WAIT_OBJECT_0; }
+
+OSG_INLINE bool OGLockSemaTimeout(og_sema_t os, int ms) { return WaitForSingleObject((HANDLE)os, ms) == WAIT_OBJECT_0; }
+
 OSG_INLINE void OGUnlockSema(og_sema_t os) { ReleaseSemaphore((HANDLE)os, 1, 0); }
 
 OSG_INLINE void OGDeleteSema(og_sema_t os) { CloseHandle(os); }
 
+OSG_INLINE uint32_t OGAtomicLoadAcquire32(volatile uint32_t *p) {
+	return (uint32_t)InterlockedCompareExchange((volatile LONG *)p, 0, 0);
+}
+OSG_INLINE void OGAtomicStoreRelease32(volatile uint32_t *p, uint32_t v) {
+	InterlockedExchange((volatile LONG *)p, (LONG)v);
+}
+OSG_INLINE void *OGAtomicLoadAcquirePtr(void *volatile *p) { return InterlockedCompareExchangePointer(p, 0, 0); }
+OSG_INLINE void OGAtomicStoreReleasePtr(void *volatile *p, void *v) { InterlockedExchangePointer(p, v); }
+
 OSG_INLINE void OGSignalCond(og_cv_t cv) { WakeConditionVariable((PCONDITION_VARIABLE)cv); }
 OSG_INLINE void OGBroadcastCond(og_cv_t cv) { WakeAllConditionVariable((PCONDITION_VARIABLE)cv); }
 OSG_INLINE void OGWaitCond(og_cv_t cv, og_mutex_t m) {
@@ -155,7 +155,7 @@ static void redraw(SurviveContext *ctx) {
 			int v_cnt[2] = {0};
 			for (int sensor = 0; sensor < so->sensor_ct; sensor++) {
 				for (int axis = 0; axis < 2; axis++) {
-					FLT f = so->activations.angles[sensor][lh][axis];
+					FLT f = SurviveSensorActivations_angle(&so->activations, sensor, lh, axis);
 					if (!isnan(f)) {
 						v_cnt[axis]++;
 						v[axis] += f;
@@ -199,7 +199,7 @@ static void redraw(SurviveContext *ctx) {
 
 				bool allNans = true;
 				for (int axis = 0; axis < 2 && allNans; axis++) {
-					FLT f = so->activations.angles[sensor][lh][axis];
+					FLT f = SurviveSensorActivations_angle(&so->activations, sensor, lh, axis);
 					allNans &= isnan(f);
 				}
 
@@ -218,7 +218,7 @@ static void redraw(SurviveContext *ctx) {
 				print_int(time_stats[i][lh][sensor].hit_count);
 				print(time_stats[i][lh][sensor].hz);
 				for (int axis = 0; axis < 2; axis++) {
-					FLT f = so->activations.angles[sensor][lh][axis];
+					FLT f = SurviveSensorActivations_angle(&so->activations, sensor, lh, axis);
 					process_reading(i, lh, sensor, axis, f);
 					print(f);
 				}
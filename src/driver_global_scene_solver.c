@@ -50,18 +50,17 @@ static size_t add_scenes(struct global_scene_solver *gss, SurviveObject *so) {
 
 	size_t lh_meas[NUM_GEN2_LIGHTHOUSES] = {0};
 	for (uint8_t lh = 0; lh < ctx->activeLighthouses; lh++) {
-		for (uint8_t sensor = 0; sensor < so->sensor_ct; sensor++) {
-			for (uint8_t axis = 0; axis < 2; axis++) {
-				bool isReadingValid =
-					SurviveSensorActivations_is_reading_valid(activations, sensor_time_window, sensor, lh, axis);
-
-				if (isReadingValid) {
-					const FLT *a = activations->angles[sensor][lh];
+		uint32_t valid[2] = {SurviveSensorActivations_valid_sensors(activations, sensor_time_window, lh, 0),
+							 SurviveSensorActivations_valid_sensors(activations, sensor_time_window, lh, 1)};
+		uint32_t any_valid = valid[0] | valid[1];
 
+		for (uint8_t sensor = 0; sensor < so->sensor_ct && (any_valid >> sensor); sensor++) {
+			for (uint8_t axis = 0; axis < 2; axis++) {
+				if ((valid[axis] >> sensor) & 1) {
 					PoserDataGlobalSceneMeasurement *meas = scene->meas + scene->meas_cnt;
 
 					meas->axis = axis;
-					meas->value = a[axis];
+					meas->value = SurviveSensorActivations_angle(activations, sensor, lh, axis);
 					meas->sensor_idx = sensor;
 					meas->lh = lh;
 					lh_meas[lh]++;
@@ -4,19 +4,36 @@
 #include "os_generic.h"
 #include "survive.h"
 
-#include "survive_recording.h"
 #include "survive_internal.h"
+#include "survive_recording.h"
+#include "survive_recording_binary.h"
+#include "survive_recording_index.h"
 
 #include "survive_default_devices.h"
 
 #include "survive_gz.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 STATIC_CONFIG_ITEM(PLAYBACK_REPLAY_POSE, "playback-replay-pose", 'i', "Whether or not to output pose", 0)
 STATIC_CONFIG_ITEM(PLAYBACK, "playback", 's', "File to be used for playback if playing a recording.", 0)
 STATIC_CONFIG_ITEM(PLAYBACK_FACTOR, "playback-factor", 'f',
 				   "Time factor of playback -- 1 is run at the same timing as original, 0 is run as fast as possible.",
 				   1.0f)
 STATIC_CONFIG_ITEM(PLAYBACK_TIME, "playback-time", 'f', "End time of playback", -1.0f)
+STATIC_CONFIG_ITEM(PLAYBACK_START_TIME, "playback-start-time", 'f',
+				   "Start time of playback. Uses the recording's .idx file to skip ahead if there is one.", -1.0f)
+STATIC_CONFIG_ITEM(PLAYBACK_DETERMINISTIC, "playback-deterministic", 'i',
+				   "Replay as fast as possible on the recording's clock, running the whole pipeline synchronously so that "
+				   "output is identical between runs",
+				   0)
+STATIC_CONFIG_ITEM(PLAYBACK_MMAP, "playback-mmap", 'i', "Memory map uncompressed playback files instead of streaming them",
+				   1)
 
 STATIC_CONFIG_ITEM(PLAYBACK_RUN_TIME, "run-time", 'f', "How long to run for", -1.)
 
@@ -37,6 +54,13 @@ ssize_t gzgetdelim(char **RESTRICT_KEYWORD lineptr, size_t *RESTRICT_KEYWORD n,
 				   gzFile RESTRICT_KEYWORD stream);
 ssize_t gzgetline(char **RESTRICT_KEYWORD lineptr, size_t *RESTRICT_KEYWORD n, gzFile RESTRICT_KEYWORD stream);
 
+#define PLAYBACK_SO_CACHE_SIZE 32
+
+typedef struct playback_so_cache_entry {
+	char codename[16];
+	SurviveObject *so;
+} playback_so_cache_entry;
+
 typedef struct SurvivePlaybackData {
     SurviveContext *ctx;
     const char *playback_dir;
@@ -54,6 +78,36 @@ typedef struct SurvivePlaybackData {
 
     uint32_t total_sleep_time;
 	bool *keepRunning;
+
+	// Events are pumped from survive_poll instead of a playback thread, and never wait on the wall clock
+	bool deterministic;
+
+	// Events before this only run if they are CONFIG or LH_POSE. The seek to the nearest checkpoint happens on the
+	// first pump, so that the driver thread does it rather than driver registration.
+	FLT playback_start_time;
+	bool seek_pending;
+	// Uncompressed offset playback_file starts at; non zero once playback_file is opened at a later gzip member
+	uint64_t input_base;
+
+	// Set when playing back a binary recording; the next record is read ahead to know when to run it
+	bool binary;
+	survive_binary_reader binary_reader;
+	survive_binary_record next_record;
+	bool has_next_record;
+
+	// Set when the playback file is uncompressed and memory mapped; playback_file isn't opened then
+	const char *mapped;
+	size_t mapped_size, mapped_offset;
+
+	// Devices by codename, so that events don't search the object list. Only found devices go in, and the cache is
+	// emptied whenever the number of objects changes.
+	playback_so_cache_entry so_cache[PLAYBACK_SO_CACHE_SIZE];
+	int so_cache_cnt, so_cache_objs_ct;
+
+	// Reused for every line so that text playback doesn't allocate per event
+	char *line;
+	size_t line_size;
+	size_t line_rest;
 } SurvivePlaybackData;
 
 static double survive_playback_run_time(const SurviveContext *ctx, void *_sp) {
@@ -62,9 +116,50 @@ static double survive_playback_run_time(const SurviveContext *ctx, void *_sp) {
 }
 
 
-static SurviveObject *find_or_warn(SurvivePlaybackData *driver, const char *dev) {
-	SurviveContext *ctx = driver->ctx;
+static uint32_t codename_hash(const char *name) {
+	uint32_t hash = 2166136261u;
+	while (*name) {
+		hash = (hash ^ (uint8_t)*name++) * 16777619u;
+	}
+	return hash;
+}
+
+static SurviveObject *find_cached(SurvivePlaybackData *driver, const char *dev) {
+	if (driver->so_cache_objs_ct != driver->ctx->objs_ct) {
+		memset(driver->so_cache, 0, sizeof(driver->so_cache));
+		driver->so_cache_cnt = 0;
+		driver->so_cache_objs_ct = driver->ctx->objs_ct;
+	}
+
+	size_t len = strlen(dev);
+	if (len >= sizeof(driver->so_cache[0].codename)) {
+		return survive_get_so_by_name(driver->ctx, dev);
+	}
+
+	uint32_t idx = codename_hash(dev) & (PLAYBACK_SO_CACHE_SIZE - 1);
+	for (;; idx = (idx + 1) & (PLAYBACK_SO_CACHE_SIZE - 1)) {
+		playback_so_cache_entry *entry = &driver->so_cache[idx];
+		if (entry->so == 0) {
+			break;
+		}
+		if (strcmp(entry->codename, dev) == 0) {
+			return entry->so;
+		}
+	}
+
 	SurviveObject *so = survive_get_so_by_name(driver->ctx, dev);
+	// Kept at most half full so probes stay short and always end at an empty slot
+	if (so && driver->so_cache_cnt < PLAYBACK_SO_CACHE_SIZE / 2) {
+		playback_so_cache_entry *entry = &driver->so_cache[idx];
+		memcpy(entry->codename, dev, len + 1);
+		entry->so = so;
+		driver->so_cache_cnt++;
+	}
+	return so;
+}
+
+static SurviveObject *find_or_warn(SurvivePlaybackData *driver, const char *dev) {
+	SurviveObject *so = find_cached(driver, dev);
 	if (!so) {
 		static bool display_once = false;
 		SurviveContext *ctx = driver->ctx;
@@ -78,350 +173,518 @@ static SurviveObject *find_or_warn(SurvivePlaybackData *driver, const char *dev)
 	return so;
 }
 
-static int parse_and_run_sweep(char *line, SurvivePlaybackData *driver) {
-	char dev[10];
+static int run_config(SurvivePlaybackData *driver, const char *dev, const char *configStart, size_t len) {
+	SurviveContext *ctx = driver->ctx;
+	SurviveObject *so = survive_create_device(ctx, "replay", driver, dev, 0);
+	survive_add_object(ctx, so);
 
-	survive_channel channel;
-	int sensor_id;
-	survive_timecode timecode;
-	uint8_t flag;
+	char *config = SV_CALLOC(len + 1);
+	memcpy(config, configStart, len);
 
-	int rr = sscanf(line, SWEEP_SCANF, SWEEP_SCANF_ARGS);
-	if (rr != 5) {
-		SurviveContext *ctx = driver->ctx;
-		SV_WARN("Only got %d values for a sweep", rr);
-		return -1;
+	if (ctx->configproc(so, config, len) == 0) {
+		SV_INFO("Found %s in playback file...", dev);
+	} else {
+		SV_WARN("Found %s in playback file, but could not read config description", dev);
 	}
+	return 0;
+}
 
-	SurviveObject *so = find_or_warn(driver, dev);
-	if (!so) {
-		return 0;
+// Runs one event; text recordings are parsed into the same records as binary ones
+static void run_binary_record(SurvivePlaybackData *driver, const survive_binary_record *record) {
+	SurviveContext *ctx = driver->ctx;
+	SurviveObject *so = 0;
+
+	if (driver->time_now < driver->playback_start_time && record->type != SURVIVE_BINARY_RECORD_CONFIG &&
+		record->type != SURVIVE_BINARY_RECORD_LH_POSE) {
+		if (record->type == SURVIVE_BINARY_RECORD_LIGHTCAP) {
+			driver->hasRawLight = true;
+		} else if (record->type == SURVIVE_BINARY_RECORD_SWEEP) {
+			driver->hasSweepAngle = true;
+		}
+		return;
 	}
 
-	driver->hasSweepAngle = true;
-	SURVIVE_INVOKE_HOOK_SO(sweep, so, channel, sensor_id, timecode, flag);
-	return 0;
+	switch (record->type) {
+	case SURVIVE_BINARY_RECORD_CONFIG:
+		run_config(driver, record->name, record->text, record->text_len);
+		return;
+	case SURVIVE_BINARY_RECORD_LH_POSE:
+		// Nothing before the start time reaches the posers, so the pose the lighthouse had when recorded stands in for
+		// solving it again
+		if (driver->time_now < driver->playback_start_time && record->lh_pose.lh < NUM_GEN2_LIGHTHOUSES) {
+			SURVIVE_INVOKE_HOOK(lighthouse_pose, ctx, record->lh_pose.lh, &record->lh_pose.pose);
+		}
+		if (driver->outputExternalPose) {
+			char buffer[32] = {0};
+			snprintf(buffer, 31, "previous_LH%d", record->lh_pose.lh);
+			SURVIVE_INVOKE_HOOK(external_pose, ctx, buffer, &record->lh_pose.pose);
+		}
+		return;
+	case SURVIVE_BINARY_RECORD_POSE:
+		if (driver->outputExternalPose) {
+			char name[128] = {0};
+			snprintf(name, sizeof(name) - 1, "replay_%s", record->name);
+			SURVIVE_INVOKE_HOOK(external_pose, ctx, name, &record->pose);
+		}
+		return;
+	case SURVIVE_BINARY_RECORD_EXTERNAL_POSE:
+		SURVIVE_INVOKE_HOOK(external_pose, ctx, record->name, &record->pose);
+		return;
+	case SURVIVE_BINARY_RECORD_SYNC:
+	case SURVIVE_BINARY_RECORD_SWEEP:
+	case SURVIVE_BINARY_RECORD_SWEEP_ANGLE:
+	case SURVIVE_BINARY_RECORD_LIGHTCAP:
+	case SURVIVE_BINARY_RECORD_LIGHT:
+	case SURVIVE_BINARY_RECORD_IMU:
+	case SURVIVE_BINARY_RECORD_RAW_IMU:
+		so = record->name ? find_or_warn(driver, record->name) : 0;
+		break;
+	default:
+		return;
+	}
+
+	switch (record->type) {
+	case SURVIVE_BINARY_RECORD_SYNC:
+		if (so)
+			SURVIVE_INVOKE_HOOK_SO(sync, so, record->sync.channel, record->sync.timecode, record->sync.ootx,
+								   record->sync.gen);
+		break;
+	case SURVIVE_BINARY_RECORD_SWEEP:
+		driver->hasSweepAngle = true;
+		if (so)
+			SURVIVE_INVOKE_HOOK_SO(sweep, so, record->sweep.channel, record->sweep.sensor_id, record->sweep.timecode,
+								   record->sweep.flag);
+		break;
+	case SURVIVE_BINARY_RECORD_SWEEP_ANGLE:
+		if (so && driver->hasSweepAngle == false)
+			SURVIVE_INVOKE_HOOK_SO(sweep_angle, so, record->sweep_angle.channel, record->sweep_angle.sensor_id,
+								   record->sweep_angle.timecode, record->sweep_angle.plane, record->sweep_angle.angle);
+		break;
+	case SURVIVE_BINARY_RECORD_LIGHTCAP: {
+		driver->hasRawLight = 1;
+		LightcapElement le = record->lightcap;
+		if (so)
+			handle_lightcap(so, &le);
+		break;
+	}
+	case SURVIVE_BINARY_RECORD_LIGHT:
+		// Text playback never ran the 'S' (acode -1) lines either
+		if (so && driver->hasRawLight == false && record->light.acode != -1)
+			SURVIVE_INVOKE_HOOK_SO(light, so, record->light.sensor_id, record->light.acode, record->light.timeinsweep,
+								   record->light.timecode, record->light.length, record->light.lh);
+		break;
+	case SURVIVE_BINARY_RECORD_IMU:
+	case SURVIVE_BINARY_RECORD_RAW_IMU: {
+		FLT accelgyro[9];
+		memcpy(accelgyro, record->imu.accelgyro, sizeof(accelgyro));
+		if (so && record->type == SURVIVE_BINARY_RECORD_RAW_IMU) {
+			SURVIVE_INVOKE_HOOK_SO(raw_imu, so, record->imu.mask, accelgyro, record->imu.timecode, record->imu.id);
+		} else if (so) {
+			SURVIVE_INVOKE_HOOK_SO(imu, so, record->imu.mask, accelgyro, record->imu.timecode, record->imu.id);
+		}
+		break;
+	}
+	default:
+		break;
+	}
 }
 
-static int parse_and_run_sync(char *line, SurvivePlaybackData *driver) {
-	char dev[10];
+// Runs one event line of a text recording, with the time already stripped off
+static void run_line(SurvivePlaybackData *driver, char *line) {
+	SurviveContext *ctx = driver->ctx;
+	survive_binary_record record;
+	if (!survive_binary_record_parse_event(&record, line)) {
+		if (record.type != 0) {
+			SV_WARN("On line %d, could not read all the values of an event for '%s'", driver->lineno,
+					record.name ? record.name : "");
+		}
+		return;
+	}
+	record.time = driver->time_now;
 
-	survive_channel channel;
-	survive_timecode timecode;
-	uint8_t ootx, gen;
+	if (record.type == SURVIVE_BINARY_RECORD_TEXT) {
+		if (driver->time_now >= driver->playback_start_time) {
+			SV_WARN("Playback doesn't understand '%.*s'", (int)record.text_len, record.text);
+		}
+		return;
+	}
 
-	int rr = sscanf(line, SYNC_SCANF, SYNC_SCANF_ARGS);
-	if (rr != 5) {
-		SurviveContext *ctx = driver->ctx;
-		SV_WARN("Only got %d values for a sync", rr);
-		return -1;
+	survive_get_ctx_lock(ctx);
+	run_binary_record(driver, &record);
+	survive_release_ctx_lock(ctx);
+}
+
+// Whether the next event is still in the future at the current playback factor
+static bool playback_event_pending(const SurvivePlaybackData *driver) {
+	if (driver->deterministic) {
+		return false;
 	}
+	return driver->next_time_s * driver->playback_factor > (OGRelativeTime() + driver->time_start);
+}
 
-	SurviveObject *so = find_or_warn(driver, dev);
-	if (!so) {
-		return 0;
+static void playback_close_input(SurvivePlaybackData *driver) {
+	if (driver->playback_file) {
+		gzclose(driver->playback_file);
 	}
+	driver->playback_file = 0;
 
-	SURVIVE_INVOKE_HOOK_SO(sync, so, channel, timecode, ootx, gen);
-	return 0;
+#ifndef _WIN32
+	if (driver->mapped) {
+		munmap((void *)driver->mapped, driver->mapped_size);
+	}
+#endif
+	driver->mapped = 0;
 }
 
-static int parse_and_run_sweep_angle(char *line, SurvivePlaybackData *driver) {
-	char dev[10];
-
-	survive_channel channel;
-	int sensor_id;
-	survive_timecode timecode;
-	int8_t plane;
-	FLT angle;
+// Maps the playback file if it isn't gz compressed. The file is left alone if it can't be mapped and the caller falls
+// back to reading it through gzopen.
+static bool playback_map_file(SurvivePlaybackData *driver, const char *fn) {
+#ifdef _WIN32
+	return false;
+#else
+	int fd = open(fn, O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
 
-	int rr = sscanf(line, SWEEP_ANGLE_SCANF, SWEEP_ANGLE_SCANF_ARGS);
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size < 2) {
+		close(fd);
+		return false;
+	}
 
-	if (rr != 6) {
-		SurviveContext *ctx = driver->ctx;
-		SV_WARN("Only got %d values for sweep angle", rr);
-		return -1;
+	const uint8_t *map = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED) {
+		return false;
 	}
 
-	SurviveObject *so = find_or_warn(driver, dev);
-	if (!so) {
-		return 0;
+	if (map[0] == 0x1f && map[1] == 0x8b) {
+		munmap((void *)map, st.st_size);
+		return false;
 	}
 
-	SURVIVE_INVOKE_HOOK_SO(sweep_angle, so, channel, sensor_id, timecode, plane, angle);
-	return 0;
+	madvise((void *)map, st.st_size, MADV_SEQUENTIAL);
+	driver->mapped = (const char *)map;
+	driver->mapped_size = st.st_size;
+	return true;
+#endif
 }
 
-static int parse_and_run_pose(const char *line, SurvivePlaybackData *driver) {
-	char name[128] = "replay_";
-	SurvivePose pose;
-
-	int rr = sscanf(line, "%s POSE " SurvivePose_sformat "\r\n", name + strlen(name), &pose.Pos[0], &pose.Pos[1],
-					&pose.Pos[2], &pose.Rot[0], &pose.Rot[1], &pose.Rot[2], &pose.Rot[3]);
+static int playback_pump_binary_msg(struct SurviveContext *ctx, SurvivePlaybackData *driver) {
+	if (!driver->has_next_record) {
+		bool has_input = driver->playback_file || driver->mapped;
+		int r = has_input ? survive_binary_reader_next(&driver->binary_reader, &driver->next_record) : 0;
+		if (r <= 0) {
+			if (r < 0) {
+				SV_WARN("Malformed binary playback file after record %d", driver->lineno);
+			}
+			SV_VERBOSE(100, "EOF for playback received.");
+			playback_close_input(driver);
+			return -1;
+		}
+		driver->has_next_record = true;
+		driver->next_time_s = driver->next_record.time;
+	}
 
-	SurviveContext *ctx = driver->ctx;
-	if (rr != 8) {
-		SV_WARN("Only got %d values for a pose", rr);
+	if (playback_event_pending(driver))
 		return 0;
-	}
 
-	SURVIVE_INVOKE_HOOK(external_pose, ctx, name, &pose);
+	driver->lineno++;
+	driver->time_now = driver->next_record.time;
+	driver->next_time_s = 0;
+	driver->has_next_record = false;
+
+	survive_get_ctx_lock(ctx);
+	run_binary_record(driver, &driver->next_record);
+	survive_release_ctx_lock(ctx);
 	return 0;
 }
-static int parse_and_run_imu(const char *line, SurvivePlaybackData *driver, bool raw) {
-	char dev[10];
-	int timecode = 0;
-	FLT accelgyro[9] = { 0 };
-	int mask;
-	int id;
-	SurviveContext *ctx = driver->ctx;
-
-	char i_char = 0;
-
-	int rr = sscanf(line,
-					"%s %c %d %d " FLT_sformat " " FLT_sformat " " FLT_sformat " " FLT_sformat " " FLT_sformat
-					" " FLT_sformat " " FLT_sformat " " FLT_sformat " " FLT_sformat "%d",
-					dev, &i_char, &mask, &timecode, &accelgyro[0], &accelgyro[1], &accelgyro[2], &accelgyro[3],
-					&accelgyro[4], &accelgyro[5], &accelgyro[6], &accelgyro[7], &accelgyro[8], &id);
 
-	if (rr == 11) {
-		// Older formats might not have mag data
-		id = accelgyro[6];
-		accelgyro[6] = 0;
-	} else if (rr != 14) {
-		SV_WARN("On line %d, only %d values read: '%s'", driver->lineno, rr, line);
-		return -1;
+// Copies the next line of the mapped file into the line buffer, without its line ending. The handlers all expect NUL
+// terminated strings, so this is the one copy text playback makes of each event.
+static bool read_mapped_line(SurvivePlaybackData *driver) {
+	if (driver->mapped_offset >= driver->mapped_size) {
+		return false;
 	}
 
-	assert(raw ^ i_char == 'I');
+	const char *start = driver->mapped + driver->mapped_offset;
+	size_t remaining = driver->mapped_size - driver->mapped_offset;
+	const char *eol = memchr(start, '\n', remaining);
+	size_t len = eol ? eol - start : remaining;
+	driver->mapped_offset += eol ? len + 1 : len;
 
-	SurviveObject *so = find_or_warn(driver, dev);
-	if (so) {
-		if (raw) {
-			SURVIVE_INVOKE_HOOK_SO(raw_imu, so, mask, accelgyro, timecode, id);
-		} else {
-			SURVIVE_INVOKE_HOOK_SO(imu, so, mask, accelgyro, timecode, id);
-		}
+	while (len && start[len - 1] == '\r') {
+		len--;
 	}
 
-	return 0;
+	if (len + 1 > driver->line_size) {
+		driver->line_size = len + 1 > 2 * driver->line_size ? len + 1 : 2 * driver->line_size;
+		driver->line = SV_REALLOC(driver->line, driver->line_size);
+	}
+	memcpy(driver->line, start, len);
+	driver->line[len] = 0;
+	return true;
 }
 
-static int parse_and_run_lhpose(const char *line, struct SurvivePlaybackData *driver) {
-	SurvivePose pose;
-	int lh = -1;
-	int rr = sscanf(line, "%d LH_POSE " SurvivePose_sformat "\n", &lh, &pose.Pos[0], &pose.Pos[1], &pose.Pos[2],
-					&pose.Rot[0], &pose.Rot[1], &pose.Rot[2], &pose.Rot[3]);
+static int playback_pump_mapped_msg(struct SurviveContext *ctx, SurvivePlaybackData *driver) {
+	if (driver->next_time_s == 0) {
+		if (!read_mapped_line(driver)) {
+			SV_VERBOSE(100, "EOF for playback received.");
+			playback_close_input(driver);
+			return -1;
+		}
+		driver->lineno++;
 
-	SurviveContext *ctx = driver->ctx;
-	if (driver->outputExternalPose) {
-		char buffer[32] = {0};
-		snprintf(buffer, 31, "previous_LH%d", lh);
-		SURVIVE_INVOKE_HOOK(external_pose, ctx, buffer, &pose);
+		char *rest = 0;
+		driver->next_time_s = strtod(driver->line, &rest);
+		if (rest == driver->line || !isfinite(driver->next_time_s)) {
+			driver->next_time_s = 0;
+			return 0;
+		}
+		while (*rest == ' ') {
+			rest++;
+		}
+		driver->line_rest = rest - driver->line;
 	}
-	return 0;
-}
 
-static int parse_and_run_externalpose(const char *line, SurvivePlaybackData *driver) {
-	char name[128] = { 0 };
-	SurvivePose pose;
+	if (playback_event_pending(driver))
+		return 0;
 
-	int rr = sscanf(line, "%s EXTERNAL_POSE " SurvivePose_sformat "\n", name, &pose.Pos[0], &pose.Pos[1], &pose.Pos[2],
-					&pose.Rot[0], &pose.Rot[1], &pose.Rot[2], &pose.Rot[3]);
+	driver->time_now = driver->next_time_s;
+	driver->next_time_s = 0;
 
-	SurviveContext *ctx = driver->ctx;
-	SURVIVE_INVOKE_HOOK(external_pose, ctx, name, &pose);
+	run_line(driver, driver->line + driver->line_rest);
 	return 0;
 }
 
-static int parse_and_run_config(const char *line, SurvivePlaybackData *driver) {
-	const char *configStart = line;
-	SurviveContext *ctx = driver->ctx;
-
-	char dev[10] = {0};
-	for (int i = 0; i < sizeof(dev) && *configStart != ' '; i++) {
-		dev[i] = *configStart++;
+// Uncompressed offset of the next event
+static uint64_t playback_offset(SurvivePlaybackData *driver) {
+	if (driver->mapped) {
+		return driver->binary ? driver->binary_reader.data_offset : driver->mapped_offset;
 	}
+	return driver->input_base + gztell(driver->playback_file);
+}
 
-	configStart += strlen("CONFIG") + 1;
-
-	size_t len = strlen(configStart);
+// Moves the input to the given checkpoint, or to the start of the recording when it is 0
+static bool playback_seek_checkpoint(SurvivePlaybackData *driver, const survive_recording_index_entry *checkpoint) {
+	uint64_t offset = checkpoint ? checkpoint->offset : driver->binary ? SURVIVE_BINARY_RECORDING_HEADER_SIZE : 0;
+	driver->next_time_s = 0;
+	driver->has_next_record = false;
 
-	SurviveObject *so = survive_create_device(ctx, "replay", driver, dev, 0);
-	survive_add_object(ctx, so);
+	if (driver->mapped) {
+		if (offset > driver->mapped_size) {
+			return false;
+		}
+		if (driver->binary) {
+			survive_binary_reader_restart(&driver->binary_reader, 0, offset);
+		} else {
+			driver->mapped_offset = offset;
+		}
+		return true;
+	}
 
-	char *config = SV_CALLOC(len + 1);
-	memcpy(config, configStart, len);
+#ifndef _WIN32
+	if (checkpoint && checkpoint->compressed_offset >= 0) {
+		// The checkpoint starts a gzip member, which zlib reads as a gzip file of its own
+		int fd = open(driver->playback_dir, O_RDONLY);
+		gzFile f = 0;
+		if (fd >= 0 && lseek(fd, checkpoint->compressed_offset, SEEK_SET) == checkpoint->compressed_offset) {
+			f = gzdopen(fd, "r");
+		}
+		if (f) {
+			gzclose(driver->playback_file);
+			driver->playback_file = f;
+			driver->input_base = offset;
+			if (driver->binary) {
+				survive_binary_reader_restart(&driver->binary_reader, f, 0);
+			}
+			return true;
+		}
+		if (fd >= 0) {
+			close(fd);
+		}
+	}
+#endif
 
-	if (ctx->configproc(so, config, len) == 0) {
-		SV_INFO("Found %s in playback file...", dev);
-	} else {
-		SV_WARN("Found %s in playback file, but could not read config description", dev);
+	// Otherwise zlib decompresses its way to the offset, which is still far cheaper than running the events
+	if (driver->input_base > offset) {
+		gzclose(driver->playback_file);
+		driver->playback_file = gzopen(driver->playback_dir, "r");
+		driver->input_base = 0;
+		if (driver->playback_file == 0) {
+			return false;
+		}
 	}
-	return 0;
+	if (gzseek(driver->playback_file, offset - driver->input_base, SEEK_SET) < 0) {
+		return false;
+	}
+	if (driver->binary) {
+		survive_binary_reader_restart(&driver->binary_reader, driver->playback_file, 0);
+	}
+	return true;
 }
 
-static int parse_and_run_rawlight(const char *line, SurvivePlaybackData *driver) {
-	driver->hasRawLight = 1;
+// Runs the CONFIG or LH_POSE event an index entry points to. Entries are run in file order, and the input only moves
+// forward: it jumps to the entry's checkpoint when that is past where reading got to, and otherwise reads on from there.
+static void playback_run_index_entry(SurvivePlaybackData *driver, const survive_recording_index *index,
+									 const survive_recording_index_entry *entry) {
+	SurviveContext *ctx = driver->ctx;
+	const survive_recording_index_entry *checkpoint = survive_recording_index_checkpoint_of(index, entry);
+	uint64_t position = playback_offset(driver);
+	if (position > entry->offset || (checkpoint && checkpoint->offset > position)) {
+		if (!playback_seek_checkpoint(driver, checkpoint)) {
+			return;
+		}
+	}
+	driver->time_now = entry->time;
+
+	if (driver->binary) {
+		// Binary records refer back to names sent since the checkpoint, so read through them rather than jump
+		survive_binary_record record;
+		while (playback_offset(driver) < entry->offset) {
+			if (survive_binary_reader_next(&driver->binary_reader, &record) <= 0) {
+				return;
+			}
+		}
+		if (survive_binary_reader_next(&driver->binary_reader, &record) > 0 &&
+			(record.type == SURVIVE_BINARY_RECORD_CONFIG || record.type == SURVIVE_BINARY_RECORD_LH_POSE)) {
+			survive_get_ctx_lock(ctx);
+			run_binary_record(driver, &record);
+			survive_release_ctx_lock(ctx);
+		}
+		return;
+	}
 
-	char dev[10];
-	char op[10];
-	LightcapElement le;
-	int rr = sscanf(line, "%s %s %hhu %u %hu\n", dev, op, &le.sensor_id, &le.timestamp, &le.length);
+	if (driver->mapped) {
+		driver->mapped_offset = entry->offset;
+		if (!read_mapped_line(driver)) {
+			return;
+		}
+	} else {
+		ssize_t r = -1;
+		if (gzseek(driver->playback_file, entry->offset - driver->input_base, SEEK_SET) >= 0) {
+			r = gzgetline(&driver->line, &driver->line_size, driver->playback_file);
+		}
+		if (r <= 0) {
+			return;
+		}
+		while (r && (driver->line[r - 1] == '\n' || driver->line[r - 1] == '\r')) {
+			driver->line[--r] = 0;
+		}
+	}
 
-	SurviveObject *so = find_or_warn(driver, dev);
-	if (so) {
-		handle_lightcap(so, &le);
+	char *rest = 0;
+	strtod(driver->line, &rest);
+	while (*rest == ' ') {
+		rest++;
 	}
-	return 0;
+	run_line(driver, rest);
 }
 
-static int parse_and_run_lightcode(const char *line, SurvivePlaybackData *driver) {
-	char lhn[10];
-	char axn[10];
-	char dev[10];
-	uint32_t timecode = 0;
-	int sensor_id = 0;
-	int acode = 0;
-	int timeinsweep = 0;
-	uint32_t length = 0;
-	uint32_t lh = 0;
+// Skips to the last checkpoint before playback-start-time, after rerunning every CONFIG and the latest pose of each
+// lighthouse from before it in a single forward pass. Events between the checkpoint and the start time are read but
+// not run.
+static void playback_seek(SurvivePlaybackData *driver) {
 	SurviveContext *ctx = driver->ctx;
+	driver->seek_pending = false;
 
-	int rr = sscanf(line, "%8s %8s %8s %d %d %d %u %u %u\n", dev, lhn, axn, &sensor_id, &acode, &timeinsweep, &timecode,
-					&length, &lh);
+	// Pace playback from the start time rather than from the start of the recording
+	driver->time_start = driver->playback_start_time * driver->playback_factor - OGRelativeTime();
 
-	if (rr != 9) {
-		SV_WARN("Warning:  On line %d, only %d values read: '%s'\n", driver->lineno, rr, line);
-		return -1;
+	survive_recording_index index;
+	if (survive_recording_index_load(&index, driver->playback_dir) != 0) {
+		SV_INFO("No index for %s; reading through it up to %f", driver->playback_dir, driver->playback_start_time);
+		return;
 	}
 
-	SurviveObject *so = find_or_warn(driver, dev);
-	if (so)
-		SURVIVE_INVOKE_HOOK_SO(light, so, sensor_id, acode, timeinsweep, timecode, length, lh);
-	return 0;
-}
+	const survive_recording_index_entry *checkpoint =
+		survive_recording_index_checkpoint_before(&index, driver->playback_start_time);
+	if (checkpoint == 0) {
+		survive_recording_index_free(&index);
+		return;
+	}
 
+	const survive_recording_index_entry *lh_poses[NUM_GEN2_LIGHTHOUSES] = {0};
+	for (size_t i = 0; i < index.entry_cnt && index.entries[i].offset < checkpoint->offset; i++) {
+		const survive_recording_index_entry *entry = &index.entries[i];
+		if (entry->type == SURVIVE_RECORDING_INDEX_LH_POSE && entry->lh >= 0 && entry->lh < NUM_GEN2_LIGHTHOUSES) {
+			lh_poses[entry->lh] = entry;
+		}
+	}
+
+	for (size_t i = 0; i < index.entry_cnt && index.entries[i].offset < checkpoint->offset; i++) {
+		const survive_recording_index_entry *entry = &index.entries[i];
+		if (entry->type == SURVIVE_RECORDING_INDEX_CONFIG ||
+			(entry->type == SURVIVE_RECORDING_INDEX_LH_POSE && lh_poses[entry->lh] == entry)) {
+			playback_run_index_entry(driver, &index, entry);
+		}
+	}
 
+	if (playback_seek_checkpoint(driver, checkpoint)) {
+		SV_INFO("Starting playback of %s from the checkpoint at %f", driver->playback_dir, checkpoint->time);
+	} else {
+		SV_WARN("Could not seek to the checkpoint at %f in %s; reading through from the start", checkpoint->time,
+				driver->playback_dir);
+		playback_seek_checkpoint(driver, 0);
+	}
+	survive_recording_index_free(&index);
+}
 
 static int playback_pump_msg(struct SurviveContext *ctx, void *_driver) {
 	SurvivePlaybackData *driver = _driver;
+	if (driver->seek_pending) {
+		playback_seek(driver);
+	}
+	if (driver->binary) {
+		return playback_pump_binary_msg(ctx, driver);
+	}
+	if (driver->mapped) {
+		return playback_pump_mapped_msg(ctx, driver);
+	}
+
 	gzFile f = driver->playback_file;
 
 	if (f && !gzeof(f) && !gzerror_dropin(f)) {
 		driver->lineno++;
-		char *line = 0;
 
 		if (driver->next_time_s == 0) {
-			size_t n = 0;
-			ssize_t r = gzgetdelim(&line, &n, ' ', f);
+			ssize_t r = gzgetdelim(&driver->line, &driver->line_size, ' ', f);
 			if (r <= 0) {
-				free(line);
 				return 0;
 			}
 
-			if (sscanf(line, "%lf", &driver->next_time_s) != 1) {
-				free(line);
+			char *end = 0;
+			driver->next_time_s = strtod(driver->line, &end);
+			if (end == driver->line) {
+				driver->next_time_s = 0;
 				return 0;
 			}
 
 			if(!isfinite(driver->next_time_s)) {
 				driver->next_time_s = 0;
 			}
-			free(line);
-			line = 0;
 		}
 
-		if (driver->next_time_s * driver->playback_factor > (OGRelativeTime() + driver->time_start))
+		if (playback_event_pending(driver))
 			return 0;
 
 		driver->time_now = driver->next_time_s;
 		driver->next_time_s = 0;
 
-		size_t n = 0;
-		ssize_t r = gzgetline(&line, &n, f);
+		ssize_t r = gzgetline(&driver->line, &driver->line_size, f);
 
 		if (r <= 0) {
-			free(line);
 			return 0;
 		}
+		char *line = driver->line;
 		while (r && (line[r - 1] == '\n' || line[r - 1] == '\r')) {
 			line[--r] = 0;
 		}
-		char dev[32];
-		char op[32];
-		if (sscanf(line, "%31s %31s", dev, op) < 2) {
-			free(line);
-			return 0;
-		}
-
-		if (strcmp(dev, "OPTION") == 0) {
-			free(line);
-			return 0;
-		}
-
-		survive_get_ctx_lock(ctx);
-		switch (op[0]) {
-		case 'W':
-			if (op[1] == 0)
-				parse_and_run_sweep(line, driver);
-			break;
-		case 'B':
-			if (op[1] == 0 && driver->hasSweepAngle == false)
-				parse_and_run_sweep_angle(line, driver);
-			break;
-		case 'Y':
-			if (op[1] == 0)
-				parse_and_run_sync(line, driver);
-			break;
-		case 'E':
-			if (strcmp(op, "EXTERNAL_POSE") == 0) {
-				parse_and_run_externalpose(line, driver);
-				break;
-			}
-		case 'C':
-			if (op[1] == 0) {
-				parse_and_run_rawlight(line, driver);
-			} else if (strcmp(op, "CONFIG") == 0) {
-				parse_and_run_config(line, driver);
-			}
-			break;
-		case 'L':
-			if (strcmp(op, "LH_POSE") == 0) {
-				parse_and_run_lhpose(line, driver);
-				break;
-			}
-		case 'R':
-			if (op[1] == 0 && driver->hasRawLight == false)
-				parse_and_run_lightcode(line, driver);
-			break;
-		case 'i':
-			if (op[1] == 0)
-				parse_and_run_imu(line, driver, true);
-			break;
-		case 'I':
-			if (op[1] == 0)
-				parse_and_run_imu(line, driver, false);
-			break;
-		case 'P':
-			if (strcmp(op, "POSE") == 0 && driver->outputExternalPose)
-				parse_and_run_pose(line, driver);
-			break;
-		case 'A':
-		case 'V':
-			break;
-		default:
-			SV_WARN("Playback doesn't understand '%s' op in '%s'", op, line);
-		}
-		survive_release_ctx_lock(ctx);
-
-		free(line);
+		run_line(driver, line);
 	} else {
 		SV_VERBOSE(100, "EOF for playback received.");
-		if (f) {
-			gzclose(driver->playback_file);
-		}
-		driver->playback_file = 0;
+		playback_close_input(driver);
 		return -1;
 	}
 
@@ -451,6 +714,27 @@ static void *playback_thread(void *_driver) {
 	return 0;
 }
 
+// Events run per survive_poll in deterministic mode; enough to make the poll overhead negligible
+#define PLAYBACK_EVENTS_PER_POLL 1024
+
+static int playback_poll(struct SurviveContext *ctx, void *_driver) {
+	SurvivePlaybackData *driver = _driver;
+	int rtnVal = 0;
+
+	// survive_poll holds the context lock around driver polls; each event takes it itself
+	survive_release_ctx_lock(ctx);
+	for (int i = 0; i < PLAYBACK_EVENTS_PER_POLL && rtnVal == 0; i++) {
+		if (driver->playback_time >= 0 && driver->time_now > driver->playback_time) {
+			rtnVal = -1;
+		} else {
+			rtnVal = playback_pump_msg(ctx, driver);
+		}
+	}
+	survive_get_ctx_lock(ctx);
+
+	return rtnVal < 0 ? rtnVal : 0;
+}
+
 static int playback_close(struct SurviveContext *ctx, void *_driver) {
 	SurvivePlaybackData *driver = _driver;
 
@@ -459,9 +743,9 @@ static int playback_close(struct SurviveContext *ctx, void *_driver) {
 	survive_get_ctx_lock(ctx);
 	SV_VERBOSE(50, "Playback thread slept for %" PRIu32 "ms", driver->total_sleep_time);
 	SV_VERBOSE(10, "Playback thread played back %6.2fs in %6.2fs real-time", driver->time_now, OGRelativeTime());
-	if (driver->playback_file)
-		gzclose(driver->playback_file);
-	driver->playback_file = 0;
+	survive_binary_reader_free(&driver->binary_reader);
+	playback_close_input(driver);
+	free(driver->line);
 
 	survive_detach_config(ctx, "playback-factor", &driver->playback_factor);
 	survive_detach_config(ctx, "playback-time", &driver->playback_time);
@@ -470,6 +754,14 @@ static int playback_close(struct SurviveContext *ctx, void *_driver) {
 	return 0;
 }
 
+static void playback_start(SurviveContext *ctx, SurvivePlaybackData *sp) {
+	if (sp->deterministic) {
+		survive_add_driver(ctx, sp, playback_poll, playback_close);
+	} else {
+		sp->keepRunning = survive_add_threaded_driver(ctx, sp, "playback", playback_thread, playback_close);
+	}
+}
+
 int DriverRegPlayback(SurviveContext *ctx) {
 	const char *playback_file = survive_configs(ctx, "playback", SC_GET, 0);
 
@@ -494,10 +786,14 @@ int DriverRegPlayback(SurviveContext *ctx) {
 
 	sp->outputExternalPose = survive_configi(ctx, "playback-replay-pose", SC_GET, 0);
 
-	sp->playback_file = gzopen(playback_file, "r");
-	if (sp->playback_file == 0) {
-		SV_ERROR(SURVIVE_ERROR_INVALID_CONFIG, "Could not open playback events file %s", playback_file);
-		return -1;
+	if (survive_configi(ctx, "playback-mmap", SC_GET, 1) && playback_map_file(sp, playback_file)) {
+		SV_VERBOSE(10, "Memory mapped playback file %s (%zu bytes)", playback_file, sp->mapped_size);
+	} else {
+		sp->playback_file = gzopen(playback_file, "r");
+		if (sp->playback_file == 0) {
+			SV_ERROR(SURVIVE_ERROR_INVALID_CONFIG, "Could not open playback events file %s", playback_file);
+			return -1;
+		}
 	}
 	survive_install_run_time_fn(ctx, survive_playback_run_time, sp);
 	survive_attach_configf(ctx, "playback-factor", &sp->playback_factor);
@@ -506,6 +802,40 @@ int DriverRegPlayback(SurviveContext *ctx) {
 	SV_INFO("Using playback file '%s' with timefactor of %f until %f", playback_file, sp->playback_factor,
 			sp->playback_time);
 
+	sp->playback_start_time = survive_configf(ctx, "playback-start-time", SC_GET, -1);
+	sp->seek_pending = sp->playback_start_time > 0;
+
+	sp->deterministic = survive_configi(ctx, "playback-deterministic", SC_GET, 0);
+	if (sp->deterministic) {
+		// Threaded and async posers solve whatever data is there when they get scheduled; run them inline instead.
+		// This happens before survive_startup sets up posers and before any device is created.
+		survive_configi(ctx, "threaded-posers", SC_SET | SC_OVERRIDE, 0);
+		survive_configi(ctx, "poser-async", SC_SET | SC_OVERRIDE, 0);
+		ctx->poll_min_time_ms = 0;
+		SV_INFO("Deterministic playback; running as fast as possible with threaded posers disabled");
+	}
+
+	sp->binary = sp->mapped ? survive_binary_reader_init_buffer(&sp->binary_reader, sp->mapped, sp->mapped_size) == 0
+							: survive_binary_reader_init(&sp->binary_reader, sp->playback_file) == 0;
+	if (sp->binary) {
+		if (survive_binary_reader_next(&sp->binary_reader, &sp->next_record) > 0) {
+			sp->has_next_record = true;
+			sp->next_time_s = sp->time_start = sp->next_record.time;
+		}
+		playback_start(ctx, sp);
+		return 0;
+	}
+
+	if (sp->mapped) {
+		if (read_mapped_line(sp)) {
+			sp->time_start = strtod(sp->line, 0);
+		}
+		sp->mapped_offset = 0;
+		playback_start(ctx, sp);
+		return 0;
+	}
+	gzseek(sp->playback_file, 0, SEEK_SET);
+
 	FLT time = 0;
 	char *line = 0;
 	size_t n;
@@ -529,7 +859,7 @@ int DriverRegPlayback(SurviveContext *ctx) {
 	free(line);
 	gzseek(sp->playback_file, 0, SEEK_SET); // same as rewind(f);
 
-	sp->keepRunning = survive_add_threaded_driver(ctx, sp, "playback", playback_thread, playback_close);
+	playback_start(ctx, sp);
 	return 0;
 }
 
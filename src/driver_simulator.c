@@ -21,6 +21,9 @@
 
 STATIC_CONFIG_ITEM(Simulator_DRIVER_ENABLE, "simulator", 'i', "Load a Simulator driver for testing.", 0)
 STATIC_CONFIG_ITEM(Simulator_TIME, "simulator-time", 'f', "Seconds to run simulator for.", 0.0)
+STATIC_CONFIG_ITEM(Simulator_TIME_FACTOR, "time-factor", 'f', "Real seconds that pass per simulated second.", 1.0)
+STATIC_CONFIG_ITEM(Simulator_REALTIME, "simulator-realtime", 'i',
+				   "Pace the simulation to the wall clock, scaled by time-factor. 0 runs it as fast as possible", 1)
 STATIC_CONFIG_ITEM(Simulator_OBJ_RADIUS, "simulator-obj-radius", 'f', "Radius of the simulated object", 0.05)
 STATIC_CONFIG_ITEM(Simulator_SHOW_GT_DEVICE, "simulator-show-gt", 'i',
 				   "0: No GT device, 1: Show GT device, 2: Only GT device", 1)
@@ -37,20 +40,52 @@ STATIC_CONFIG_ITEM(Simulator_SENSOR_DROPRATE, "simulator-sensor-droprate", 'f',
 STATIC_CONFIG_ITEM(Simulator_INIT_TIME, "simulator-init-time", 'f', "Init time -- object wont move for this long", 2.)
 STATIC_CONFIG_ITEM(Simulator_FCAL_NOISE, "simulator-fcal-noise", 'f', "Noise to apply to BSD fcal parameters", 0.)
 STATIC_CONFIG_ITEM(Simulator_LH_VERSION, "simulator-lh-gen", 'i', "Lighthouse generation", 2)
+STATIC_CONFIG_ITEM(Simulator_SEED, "simulator-seed", 'i', "Seed for the simulated object, lighthouses and noise", 42)
 
 typedef struct SurviveDriverSimulatorLHState {
-	FLT last_eval_time;
-
 	FLT period_s;
 	FLT start_time;
 } SurviveDriverSimulatorLHState;
 
+/*
+ * The simulator works through a queue of upcoming events instead of stepping time. Each gen2 lighthouse has a sweep
+ * event at the start of every rotation; it reports the sync and schedules a hit for every sensor it is going to see.
+ * The motion of the object is integrated up to each event in steps of at most SIMULATOR_PHYSICS_STEP.
+ */
+typedef enum {
+	SIMULATOR_EVENT_IMU,
+	SIMULATOR_EVENT_GT,
+	SIMULATOR_EVENT_LH_V1,
+	SIMULATOR_EVENT_LH_SWEEP,
+	SIMULATOR_EVENT_LH_HIT,
+} SimulatorEventType;
+
+typedef struct SimulatorEvent {
+	FLT time;
+	// Orders events at the same time by when they were scheduled
+	uint32_t seq;
+	uint8_t type;
+	uint8_t lh;
+	uint8_t axis;
+	uint8_t sensor_idx;
+} SimulatorEvent;
+
+// Hits are all before the next sweep of their lighthouse, so there is at most one rotation of them queued per
+// lighthouse, next to its sweep event and the IMU, ground truth and gen1 events
+#define SIMULATOR_MAX_EVENTS (NUM_GEN2_LIGHTHOUSES * (2 * SENSORS_PER_OBJECT + 1) + 3)
+#define SIMULATOR_PHYSICS_STEP .0001
+// Simulated seconds worth of events run per poll
+#define SIMULATOR_POLL_SLICE .01
+
 typedef SurviveVelocity SurviveAcceleration;
 struct SurviveDriverSimulator {
 	int lh_version;
 	SurviveContext *ctx;
 	SurviveObject *so;
 
+	// Every random draw comes from here rather than rand(), so simulators in one process don't disturb each other
+	uint64_t rng;
+
 	SurviveDriverSimulatorLHState lhstates[NUM_GEN2_LIGHTHOUSES];
 	BaseStationData bsd[NUM_GEN2_LIGHTHOUSES];
 
@@ -58,13 +93,27 @@ struct SurviveDriverSimulator {
 	SurviveVelocity velocity;
 	SurviveAcceleration accel;
 
-	FLT time_last_imu;
-	FLT time_last_light;
-	FLT time_last_iterate;
+	// Binary heap, earliest event first
+	SimulatorEvent events[SIMULATOR_MAX_EVENTS];
+	size_t event_cnt;
+	uint32_t event_seq;
+	bool started;
+
+	int realtime;
+	// The wall clock time sim_time_ref gets paced to, and the time-factor that was in effect since then
+	double wall_time_ref;
+	FLT sim_time_ref;
+	FLT paced_time_factor;
+	double wall_start;
 
 	FLT sensor_var;
 	FLT sensor_droprate;
 	FLT init_time;
+	FLT time_factor;
+	FLT simulator_time;
+	size_t attractor_cnt;
+	bool attractors_reported;
+	int report_in_imu;
 
 	FLT timestart;
 	FLT current_timestamp;
@@ -84,11 +133,58 @@ struct SurviveDriverSimulator {
 };
 typedef struct SurviveDriverSimulator SurviveDriverSimulator;
 
-static double timestamp_in_s() {
-	static double start_time_s = 0;
-	if (start_time_s == 0.)
-		start_time_s = OGGetAbsoluteTime();
-	return OGGetAbsoluteTime() - start_time_s;
+// splitmix64
+static uint64_t simulator_rand_next(uint64_t *rng) {
+	uint64_t z = (*rng += 0x9E3779B97F4A7C15ull);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+static FLT simulator_rand(uint64_t *rng, FLT min, FLT max) {
+	return min + (max - min) * ((simulator_rand_next(rng) >> 11) * (1. / 9007199254740992.));
+}
+static FLT simulator_normrand(uint64_t *rng, FLT mu, FLT sigma) {
+	FLT u1 = simulator_rand(rng, 1e-7, 1.), u2 = simulator_rand(rng, 0., 1.);
+	return mu + sigma * sqrt(-2. * log(u1)) * cos(2. * LINMATHPI * u2);
+}
+
+static bool simulator_event_before(const SimulatorEvent *a, const SimulatorEvent *b) {
+	return a->time < b->time || (a->time == b->time && a->seq < b->seq);
+}
+
+static void simulator_push_event(SurviveDriverSimulator *driver, SimulatorEvent evt) {
+	assert(driver->event_cnt < SIMULATOR_MAX_EVENTS);
+	evt.seq = driver->event_seq++;
+
+	size_t i = driver->event_cnt++;
+	while (i > 0) {
+		size_t parent = (i - 1) / 2;
+		if (!simulator_event_before(&evt, &driver->events[parent]))
+			break;
+		driver->events[i] = driver->events[parent];
+		i = parent;
+	}
+	driver->events[i] = evt;
+}
+
+static SimulatorEvent simulator_pop_event(SurviveDriverSimulator *driver) {
+	SimulatorEvent rtn = driver->events[0];
+	SimulatorEvent last = driver->events[--driver->event_cnt];
+
+	size_t i = 0;
+	for (;;) {
+		size_t child = 2 * i + 1;
+		if (child >= driver->event_cnt)
+			break;
+		if (child + 1 < driver->event_cnt && simulator_event_before(&driver->events[child + 1], &driver->events[child]))
+			child++;
+		if (!simulator_event_before(&driver->events[child], &last))
+			break;
+		driver->events[i] = driver->events[child];
+		i = child;
+	}
+	driver->events[i] = last;
+	return rtn;
 }
 
 static FLT lighthouse_lasttime_of_angle(SurviveDriverSimulator *driver, int lh, FLT timestamp, FLT angle) {
@@ -104,39 +200,62 @@ FLT lighthouse_angle(SurviveDriverSimulator *driver, int lh, FLT timestamp) {
 	FLT angle = fmod(timestamp - lhs->start_time, lhs->period_s) / lhs->period_s * 2. * LINMATHPI;
 	return angle;
 }
-static bool lighthouse_sensor_angle(SurviveDriverSimulator *driver, int lh, size_t idx, SurviveAngleReading ang) {
-	SurviveContext *ctx = driver->ctx;
+// Reprojects every sensor on the object into lh in one go; sensor idx's angle on axis k lands in
+// angles[k * sensor_ct + idx]
+static void lighthouse_sensor_angles(SurviveDriverSimulator *driver, int lh, const SurvivePose *world2lh,
+									 FLT *angles) {
+	const SurviveObject *so = driver->so;
+	FLT pts[SENSORS_PER_OBJECT * 3];
+	for (size_t idx = 0; idx < so->sensor_ct; idx++) {
+		for (int k = 0; k < 3; k++) {
+			pts[k * so->sensor_ct + idx] = so->sensor_locations[idx * 3 + k];
+		}
+	}
+
+	const survive_reproject_model_t *model =
+		driver->lh_version == 0 ? &survive_reproject_model : &survive_reproject_gen2_model;
+	model->reprojectFullBatch(angles, so->sensor_ct, &driver->position, pts, world2lh, driver->bsd[lh].fcal);
+}
+
+static bool lighthouse_sensor_visible(SurviveDriverSimulator *driver, size_t idx, const SurvivePose *world2lh) {
 	FLT *pt = driver->so->sensor_locations + idx * 3;
 
 	LinmathVec3d ptInWorld;
 	LinmathVec3d normalInWorld;
 	ApplyPoseToPoint(ptInWorld, &driver->position, pt);
-	SurvivePose world2lh = InvertPoseRtn(&driver->bsd[lh].Pose);
 	LinmathPoint3d ptInLh;
-	ApplyPoseToPoint(ptInLh, &world2lh, ptInWorld);
+	ApplyPoseToPoint(ptInLh, world2lh, ptInWorld);
 
-	if (ptInLh[2] < 0) {
-		LinmathVec3d dirLh;
-		normalize3d(dirLh, ptInLh);
-		scale3d(dirLh, dirLh, -1);
+	if (ptInLh[2] >= 0)
+		return false;
 
-		quatrotatevector(normalInWorld, driver->position.Rot, driver->so->sensor_normals + idx * 3);
+	LinmathVec3d dirLh;
+	normalize3d(dirLh, ptInLh);
+	scale3d(dirLh, dirLh, -1);
 
-		LinmathVec3d normalInLh;
-		quatrotatevector(normalInLh, world2lh.Rot, normalInWorld);
+	quatrotatevector(normalInWorld, driver->position.Rot, driver->so->sensor_normals + idx * 3);
+
+	LinmathVec3d normalInLh;
+	quatrotatevector(normalInLh, world2lh->Rot, normalInWorld);
+
+	return dot3d(normalInLh, dirLh) > 0;
+}
 
-		FLT facingness = dot3d(normalInLh, dirLh);
-		if (facingness > 0 && linmath_rand(0, 1.) > driver->sensor_droprate) {
-			if (driver->lh_version == 0) {
-				survive_reproject_xy(driver->bsd[lh].fcal, ptInLh, ang);
-			} else {
-				survive_reproject_xy_gen2(driver->bsd[lh].fcal, ptInLh, ang);
+static bool lighthouse_sensor_angle(SurviveDriverSimulator *driver, int lh, size_t idx, const SurvivePose *world2lh,
+									const FLT *angles, SurviveAngleReading ang) {
+	SurviveContext *ctx = driver->ctx;
+
+	if (lighthouse_sensor_visible(driver, idx, world2lh)) {
+		if (simulator_rand(&driver->rng, 0, 1.) > driver->sensor_droprate) {
+			ang[0] = angles[idx];
+			ang[1] = angles[driver->so->sensor_ct + idx];
+			if (driver->lh_version != 0) {
 				ang[1] += 4 * LINMATHPI / 3.;
 				ang[0] += 2 * LINMATHPI / 3.;
 			}
 
 			for (int i = 0; i < 2; i++) {
-				ang[i] += linmath_normrand(0, driver->sensor_var);
+				ang[i] += simulator_normrand(&driver->rng, 0, driver->sensor_var);
 			}
 			return true;
 		}
@@ -144,51 +263,63 @@ static bool lighthouse_sensor_angle(SurviveDriverSimulator *driver, int lh, size
 	return false;
 }
 
-struct lh_event {
-	FLT time;
-	uint8_t lh;
-	int idx;
-};
-
-static int event_compare(const void *p, const void *q) {
-	const struct lh_event *x = (const struct lh_event *)p;
-	const struct lh_event *y = (const struct lh_event *)q;
-
-	return x->time > y->time;
+// Where the object will be dt from now if it keeps its current velocity
+static void simulator_predict_pose(const SurviveDriverSimulator *driver, FLT dt, SurvivePose *pose) {
+	*pose = driver->position;
+	for (int i = 0; i < 3; i++)
+		pose->Pos[i] += driver->velocity.Pos[i] * dt;
+	survive_apply_ang_velocity(pose->Rot, driver->velocity.AxisAngleRot, dt, pose->Rot);
 }
-static size_t run_lighthouse_v2(SurviveDriverSimulator *driver, int lh, FLT timestamp, struct lh_event *events) {
-	SurviveContext *ctx = driver->ctx;
-	SurviveDriverSimulatorLHState *lhs = &driver->lhstates[lh];
 
-	size_t evt_idx = 0;
+// Reports the sync at the start of this rotation and schedules a hit for each sensor axis the sweep will cross. The
+// hit time is found from where the object is now, then refined once against where it is predicted to be by then; the
+// hit is reported at exactly the time it was queued for, so timecodes stay in order.
+static void run_lighthouse_v2_sweep(SurviveDriverSimulator *driver, int lh, FLT sync_time) {
+	SurviveContext *ctx = driver->ctx;
+	SurviveObject *so = driver->so;
 
-	FLT sync_time = lighthouse_sync_time(driver, lh, timestamp);
+	survive_timecode timecode = (survive_timecode)round(sync_time * 48000000.);
+	SURVIVE_INVOKE_HOOK_SO(sync, so, driver->bsd[lh].mode, timecode, 0, 0);
 
-	if (sync_time >= lhs->last_eval_time && sync_time <= timestamp) {
-		// fprintf(stderr, "Sync %d %f %f\n", lh, sync_time, timestamp);
-		events[evt_idx].time = sync_time;
-		events[evt_idx].lh = lh;
-		events[evt_idx++].idx = -1;
-	}
+	SurvivePose world2lh = InvertPoseRtn(&driver->bsd[lh].Pose);
+	FLT angles[SENSORS_PER_OBJECT * 2];
+	lighthouse_sensor_angles(driver, lh, &world2lh, angles);
 
-	for (size_t idx = 0; idx < driver->so->sensor_ct; idx++) {
-		SurviveAngleReading ang;
+	FLT period = driver->lhstates[lh].period_s;
+	for (size_t idx = 0; idx < so->sensor_ct; idx++) {
+		if (!lighthouse_sensor_visible(driver, idx, &world2lh))
+			continue;
 
-		if (lighthouse_sensor_angle(driver, lh, idx, ang)) {
-			for (int axis = 0; axis < 2; axis++) {
-				FLT angle_time = lighthouse_lasttime_of_angle(driver, lh, timestamp, ang[axis]);
-				if (angle_time >= lhs->last_eval_time && angle_time <= timestamp) {
-					events[evt_idx].time = angle_time;
-					events[evt_idx].lh = lh;
-					events[evt_idx++].idx = idx;
-				}
-			}
+		for (int axis = 0; axis < 2; axis++) {
+			if (simulator_rand(&driver->rng, 0, 1.) <= driver->sensor_droprate)
+				continue;
+
+			FLT angle_offset =
+				(axis + 1) * 2 * LINMATHPI / 3. + simulator_normrand(&driver->rng, 0, driver->sensor_var);
+			FLT angle = angles[axis * so->sensor_ct + idx] + angle_offset;
+
+			SurvivePose predicted;
+			simulator_predict_pose(driver, angle / (2 * LINMATHPI) * period, &predicted);
+			angle = survive_reproject_gen2_model.reprojectAxisFullFn[axis](
+						&predicted, so->sensor_locations + idx * 3, &world2lh, &driver->bsd[lh].fcal[axis]) +
+					angle_offset;
+
+			simulator_push_event(driver, (SimulatorEvent){.time = sync_time + angle / (2 * LINMATHPI) * period,
+														  .type = SIMULATOR_EVENT_LH_HIT,
+														  .lh = lh,
+														  .axis = axis,
+														  .sensor_idx = idx});
 		}
 	}
 
-	lhs->last_eval_time = timestamp;
+	simulator_push_event(driver,
+						 (SimulatorEvent){.time = sync_time + period, .type = SIMULATOR_EVENT_LH_SWEEP, .lh = lh});
+}
 
-	return evt_idx;
+static void run_lighthouse_v2_hit(SurviveDriverSimulator *driver, const SimulatorEvent *evt) {
+	SurviveContext *ctx = driver->ctx;
+	survive_timecode timecode = (survive_timecode)round(evt->time * 48000000.);
+	SURVIVE_INVOKE_HOOK_SO(sweep, driver->so, driver->bsd[evt->lh].mode, evt->sensor_idx, timecode, 0);
 }
 static void run_lighthouse_v1(SurviveDriverSimulator *driver, int lh, FLT timestamp) {
 	SurviveContext *ctx = driver->ctx;
@@ -197,9 +328,13 @@ static void run_lighthouse_v1(SurviveDriverSimulator *driver, int lh, FLT timest
 	if (lh >= ctx->activeLighthouses || driver->bsd[lh].PositionSet == false) {
 		driver->acode = (driver->acode + 1) % 4;
 	} else {
+		SurvivePose world2lh = InvertPoseRtn(&driver->bsd[lh].Pose);
+		FLT angles[SENSORS_PER_OBJECT * 2];
+		lighthouse_sensor_angles(driver, lh, &world2lh, angles);
+
 		for (int idx = 0; idx < driver->so->sensor_ct; idx++) {
 			SurviveAngleReading ang = {0};
-			if (lighthouse_sensor_angle(driver, lh, idx, ang)) {
+			if (lighthouse_sensor_angle(driver, lh, idx, &world2lh, angles, ang)) {
 				if (driver->lh_version == 0) {
 					int acode = (lh << 2) + (driver->acode & 1);
 					SURVIVE_INVOKE_HOOK_SO(angle, driver->so, idx, acode, timecode, .006, ang[driver->acode & 1], lh);
@@ -221,83 +356,39 @@ static void run_lighthouse_v1(SurviveDriverSimulator *driver, int lh, FLT timest
 	}
 }
 
-static bool run_imu(struct SurviveContext *ctx, SurviveDriverSimulator *driver, double timestamp,
-					double time_between_imu, survive_long_timecode timecode) {
-	bool update_gt = false;
-	if (timestamp > time_between_imu + driver->time_last_imu) {
-		update_gt = true;
-		// ( SurviveObject * so, int mask, FLT * accelgyro, survive_timecode timecode, int id );
-		FLT accelgyro[9] = {0, 0, 0,  // Acc
-							0, 0, 0,  // Gyro
-							0, 0, 0}; // Mag
-
-		add3d(accelgyro, accelgyro, driver->accel.Pos);
-		scale3d(accelgyro, accelgyro, 1. / 9.80665);
-
-		SV_VERBOSE(200, "(Gt)Acc\t\t" Point3_format "\t%f", LINMATH_VEC3_EXPAND(accelgyro), norm3d(accelgyro));
-		accelgyro[2] += 1;
-
-		SurvivePose ip = InvertPoseRtn(&driver->position);
-		LinmathQuat q;
-		quatgetconjugate(q, driver->position.Rot);
-		quatrotatevector(accelgyro, q, accelgyro);
-		quatrotatevector(accelgyro + 3, q, driver->velocity.AxisAngleRot);
-		add3d(accelgyro + 3, accelgyro + 3, driver->gyro_bias);
-
-		for (int i = 0; i < 3; i++) {
-			accelgyro[i] += linmath_normrand(0, driver->acc_var);
-			accelgyro[i + 3] += linmath_normrand(0, driver->gyro_var);
-		}
+static void run_imu(struct SurviveContext *ctx, SurviveDriverSimulator *driver, survive_long_timecode timecode) {
+	// ( SurviveObject * so, int mask, FLT * accelgyro, survive_timecode timecode, int id );
+	FLT accelgyro[9] = {0, 0, 0,  // Acc
+						0, 0, 0,  // Gyro
+						0, 0, 0}; // Mag
 
-		SV_VERBOSE(200, "Ang: " Point3_format, LINMATH_VEC3_EXPAND(driver->velocity.AxisAngleRot));
-		SV_VERBOSE(200, "GT: " SurvivePose_format " %f", SURVIVE_POSE_EXPAND(driver->position),
-				   quatmagnitude(driver->position.Rot));
-		if (driver->show_gt_device_cfg != 2) {
-			SURVIVE_INVOKE_HOOK_SO(imu, driver->so, 3, accelgyro, timecode, 0);
-		}
+	add3d(accelgyro, accelgyro, driver->accel.Pos);
+	scale3d(accelgyro, accelgyro, 1. / 9.80665);
 
-		for (int i = 0; i < 3; i++) {
-			driver->gyro_bias[i] += linmath_normrand(0, driver->gyro_bias_scale) * .001;
-		}
-		driver->time_last_imu = timestamp - 1e-10;
-	}
-	return update_gt;
-}
-bool run_light(const struct SurviveContext *ctx, SurviveDriverSimulator *driver, double timestamp,
-			   double time_between_pulses) {
-	bool update_gt = false;
-	if (driver->show_gt_device_cfg == 2) {
-		return false;
-	}
+	SV_VERBOSE(200, "(Gt)Acc\t\t" Point3_format "\t%f", LINMATH_VEC3_EXPAND(accelgyro), norm3d(accelgyro));
+	accelgyro[2] += 1;
 
-	if (driver->lh_version == 0) {
-		if (timestamp > time_between_pulses + driver->time_last_light) {
-			update_gt = true;
-			int lh = driver->acode >> 1;
+	LinmathQuat q;
+	quatgetconjugate(q, driver->position.Rot);
+	quatrotatevector(accelgyro, q, accelgyro);
+	quatrotatevector(accelgyro + 3, q, driver->velocity.AxisAngleRot);
+	add3d(accelgyro + 3, accelgyro + 3, driver->gyro_bias);
 
-			run_lighthouse_v1(driver, lh, timestamp);
-			driver->time_last_light = timestamp;
-		}
-	} else {
-		struct lh_event events[NUM_GEN2_LIGHTHOUSES * (SENSORS_PER_OBJECT + 1)];
-		size_t evt_idx = 0;
-		for (int i = 0; i < ctx->activeLighthouses; i++) {
-			evt_idx += run_lighthouse_v2(driver, i, timestamp, events + evt_idx);
-		}
+	for (int i = 0; i < 3; i++) {
+		accelgyro[i] += simulator_normrand(&driver->rng, 0, driver->acc_var);
+		accelgyro[i + 3] += simulator_normrand(&driver->rng, 0, driver->gyro_var);
+	}
 
-		qsort(events, evt_idx, sizeof *events, event_compare);
+	SV_VERBOSE(200, "Ang: " Point3_format, LINMATH_VEC3_EXPAND(driver->velocity.AxisAngleRot));
+	SV_VERBOSE(200, "GT: " SurvivePose_format " %f", SURVIVE_POSE_EXPAND(driver->position),
+			   quatmagnitude(driver->position.Rot));
+	if (driver->show_gt_device_cfg != 2) {
+		SURVIVE_INVOKE_HOOK_SO(imu, driver->so, 3, accelgyro, timecode, 0);
+	}
 
-		for (size_t i = 0; i < evt_idx; i++) {
-			survive_timecode timecode = (survive_timecode)round(events[i].time * 48000000.);
-			uint8_t lh = events[i].lh;
-			if (events[i].idx == -1) {
-				SURVIVE_INVOKE_HOOK_SO(sync, driver->so, driver->bsd[lh].mode, timecode, 0, 0);
-			} else {
-				SURVIVE_INVOKE_HOOK_SO(sweep, driver->so, driver->bsd[lh].mode, events[i].idx, timecode, 0);
-			}
-		}
+	for (int i = 0; i < 3; i++) {
+		driver->gyro_bias[i] += simulator_normrand(&driver->rng, 0, driver->gyro_bias_scale) * .001;
 	}
-	return update_gt;
 }
 static void propagate_state(SurviveDriverSimulator *driver, double time_diff) {
 	SurviveVelocity velGain;
@@ -317,13 +408,8 @@ static void update_gt_device(struct SurviveContext *ctx, const SurviveDriverSimu
 	if (driver->show_gt_device_cfg == 0)
 		return;
 
-	static int report_in_imu = -1;
-	if (report_in_imu == -1) {
-		survive_attach_configi(driver->so->ctx, "report-in-imu", &report_in_imu);
-	}
-
 	SurvivePose head2world = driver->position;
-	if (!report_in_imu) {
+	if (!driver->report_in_imu) {
 		ApplyPoseToPose(&head2world, &driver->position, &driver->so->head2imu);
 	}
 
@@ -337,25 +423,23 @@ void apply_attractors(struct SurviveContext *ctx, SurviveDriverSimulator *driver
 	FLT s = 1.;
 
 	LinmathVec3d attractors[] = {{1, 1, 1}, {-1, 0, 1}, {0, -1, .5}};
-	size_t attractor_cnt = survive_configi(ctx, "attractors", SC_GET, sizeof(attractors) / sizeof(LinmathVec3d));
+	size_t attractor_cnt = driver->attractor_cnt;
 	if (attractor_cnt > sizeof(attractors) / sizeof(LinmathVec3d)) {
 		attractor_cnt = sizeof(attractors) / sizeof(LinmathVec3d);
 	}
 
-	static bool reported = false;
-
 	for (int i = 0; i < attractor_cnt; i++) {
 		LinmathVec3d acc;
 		sub3d(acc, attractors[i], driver->position.Pos);
 		FLT r = norm3d(acc);
 		scale3d(acc, acc, s / r / r);
 		add3d(accel.Pos, accel.Pos, acc);
-		if (reported == false && ctx->recptr) {
+		if (driver->attractors_reported == false && ctx->recptr) {
 			survive_recording_write_to_output(ctx->recptr, "SPHERE attractor_%d %f %d " Point3_format "\n", i, .05,
 											  0x00FF00, LINMATH_VEC3_EXPAND(attractors[i]));
 		}
 	}
-	reported = true;
+	driver->attractors_reported = true;
 
 	if (attractor_cnt == 0) {
 		// accel.Pos[0] = 1 * cos(timestamp);
@@ -384,70 +468,129 @@ static void apply_initial_velocity(SurviveDriverSimulator *sp) {
 	size_t attractor_cnt = survive_configi(ctx, "attractors", SC_GET, 1);
 	if (attractor_cnt) {
 		for (int i = 0; i < 3; i++)
-			sp->velocity.Pos[i] = 2. * rand() / RAND_MAX - 1.;
+			sp->velocity.Pos[i] = simulator_rand(&sp->rng, -1., 1.);
 	}
 }
 
-static int Simulator_poll(struct SurviveContext *ctx, void *_driver) {
-	SurviveDriverSimulator *driver = _driver;
-	static FLT last_time = 0;
-	FLT realtime = timestamp_in_s();
-	
-	FLT timefactor = linmath_max(survive_configf(ctx, "time-factor", SC_GET, 1.), .00001);
-	// FLT timestamp = timestamp_in_s() / timefactor;
-	FLT timestep = .0001;
-
-	while (last_time != 0 && last_time + timefactor * timestep > realtime) {
-		survive_release_ctx_lock(ctx);
-		OGUSleep((timefactor * timestep + realtime - last_time) * 1e6);
-		survive_get_ctx_lock(ctx);
-		realtime = timestamp_in_s();
+// Integrates the motion of the object up to timestamp
+static void simulator_advance(SurviveDriverSimulator *driver, FLT timestamp) {
+	SurviveContext *ctx = driver->ctx;
+	while (driver->current_timestamp < timestamp) {
+		bool wasIniting = driver->current_timestamp < driver->init_time;
+		FLT next = linmath_min(driver->current_timestamp + SIMULATOR_PHYSICS_STEP, timestamp);
+		FLT time_diff = next - driver->current_timestamp;
+		driver->current_timestamp = next;
+
+		bool isIniting = next < driver->init_time || driver->init_time < 0;
+		if (wasIniting == true && isIniting == false) {
+			apply_initial_velocity(driver);
+		}
+
+		if (isIniting == false) {
+			apply_attractors(ctx, driver);
+		}
+
+		propagate_state(driver, time_diff);
 	}
-	last_time = realtime;
+}
 
-	bool wasIniting = driver->current_timestamp < driver->init_time;
-	FLT timestamp = (driver->current_timestamp += timestep);
+static void simulator_start(SurviveDriverSimulator *driver) {
+	SurviveContext *ctx = driver->ctx;
+	FLT now = driver->current_timestamp;
 	FLT time_between_imu = 1. / driver->so->imu_freq;
-	FLT time_between_pulses = 0.00833333333;
-	FLT time_between_gt = time_between_imu;
-	bool isIniting = timestamp < driver->init_time || driver->init_time < 0;
 
-	bool update_gt = false;
+	driver->timestart = now;
+	driver->started = true;
 
-	FLT t = (timestamp - driver->timestart);
+	simulator_push_event(driver, (SimulatorEvent){.time = now + time_between_imu, .type = SIMULATOR_EVENT_IMU});
+	simulator_push_event(driver, (SimulatorEvent){.time = now + time_between_imu, .type = SIMULATOR_EVENT_GT});
 
-	if (wasIniting == true && isIniting == false) {
-		apply_initial_velocity(driver);
+	if (driver->show_gt_device_cfg == 2) {
+		return;
 	}
 
-	if (isIniting == false) {
-		apply_attractors(ctx, driver);
+	if (driver->lh_version == 0) {
+		simulator_push_event(driver, (SimulatorEvent){.time = now, .type = SIMULATOR_EVENT_LH_V1});
+	} else {
+		for (int lh = 0; lh < ctx->activeLighthouses; lh++) {
+			FLT sync_time = lighthouse_sync_time(driver, lh, now);
+			if (sync_time < now)
+				sync_time += driver->lhstates[lh].period_s;
+			simulator_push_event(driver, (SimulatorEvent){.time = sync_time, .type = SIMULATOR_EVENT_LH_SWEEP, .lh = lh});
+		}
 	}
+}
 
-	survive_long_timecode timecode = (survive_long_timecode)round(timestamp * 48000000.);
-
-	update_gt |= run_imu(ctx, driver, timestamp, time_between_imu, timecode);
-	update_gt |= run_light(ctx, driver, timestamp, time_between_pulses);
+static void simulator_run_event(SurviveDriverSimulator *driver, const SimulatorEvent *evt) {
+	SurviveContext *ctx = driver->ctx;
+	FLT time_between_imu = 1. / driver->so->imu_freq;
+	FLT time_between_pulses = 0.00833333333;
 
-	if (update_gt) {
+	switch (evt->type) {
+	case SIMULATOR_EVENT_IMU:
+		run_imu(ctx, driver, (survive_long_timecode)round(evt->time * 48000000.));
+		simulator_push_event(driver, (SimulatorEvent){.time = evt->time + time_between_imu, .type = evt->type});
+		break;
+	case SIMULATOR_EVENT_GT:
 		update_gt_device(ctx, driver);
+		simulator_push_event(driver, (SimulatorEvent){.time = evt->time + time_between_imu, .type = evt->type});
+		break;
+	case SIMULATOR_EVENT_LH_V1:
+		run_lighthouse_v1(driver, driver->acode >> 1, evt->time);
+		simulator_push_event(driver, (SimulatorEvent){.time = evt->time + time_between_pulses, .type = evt->type});
+		break;
+	case SIMULATOR_EVENT_LH_SWEEP:
+		run_lighthouse_v2_sweep(driver, evt->lh, evt->time);
+		break;
+	case SIMULATOR_EVENT_LH_HIT:
+		run_lighthouse_v2_hit(driver, evt);
+		break;
 	}
+}
 
-	if (driver->time_last_iterate == 0) {
-		driver->time_last_iterate = timestamp;
-		driver->timestart = timestamp;
-		return 0;
+// Waits until timestamp is due on the wall clock, scaled by time-factor
+static void simulator_pace(SurviveDriverSimulator *driver, FLT timestamp) {
+	SurviveContext *ctx = driver->ctx;
+	FLT timefactor = linmath_max(driver->time_factor, .00001);
+	double now = OGGetAbsoluteTime();
+
+	// Start over whenever the time factor changes, or if we fell far enough behind that catching up would just burst
+	if (timefactor != driver->paced_time_factor ||
+		now - (driver->wall_time_ref + (timestamp - driver->sim_time_ref) * timefactor) > .1) {
+		driver->paced_time_factor = timefactor;
+		driver->wall_time_ref = now;
+		driver->sim_time_ref = timestamp;
 	}
-	FLT time_diff = timestamp - driver->time_last_iterate;
-	// SV_INFO("%.013f", time_diff);
-	driver->time_last_iterate = timestamp;
 
-	propagate_state(driver, time_diff);
+	double due = driver->wall_time_ref + (timestamp - driver->sim_time_ref) * timefactor;
+	if (due > now) {
+		survive_release_ctx_lock(ctx);
+		OGUSleep((due - now) * 1e6);
+		survive_get_ctx_lock(ctx);
+	}
+}
+
+static int Simulator_poll(struct SurviveContext *ctx, void *_driver) {
+	SurviveDriverSimulator *driver = _driver;
 
-	FLT time = survive_configf(ctx, "simulator-time", SC_GET, 0);
-	if (timestamp - driver->timestart > time && time > 0) {
-		SV_INFO("Simulation finished after %f seconds", realtime);
-		return 1;
+	if (!driver->started) {
+		simulator_start(driver);
+	}
+
+	FLT slice_end = driver->events[0].time + SIMULATOR_POLL_SLICE;
+	while (driver->event_cnt > 0 && driver->events[0].time <= slice_end) {
+		SimulatorEvent evt = simulator_pop_event(driver);
+		if (driver->realtime) {
+			simulator_pace(driver, evt.time);
+		}
+
+		simulator_advance(driver, evt.time);
+		simulator_run_event(driver, &evt);
+
+		if (driver->simulator_time > 0 && driver->current_timestamp - driver->timestart > driver->simulator_time) {
+			SV_INFO("Simulation finished after %f seconds", OGGetAbsoluteTime() - driver->wall_start);
+			return 1;
+		}
 	}
 
 	return 0;
@@ -540,18 +683,30 @@ static int simulator_close(struct SurviveContext *ctx, void *_driver) {
 	SV_VERBOSE(5, "\tError         " Point7_format, LINMATH_VEC7_EXPAND(var));
 	SV_VERBOSE(5, "\tTracker bias  " Point3_format, LINMATH_VEC3_EXPAND(driver->gyro_bias));
 
+	survive_detach_config(ctx, Simulator_SHOW_GT_DEVICE_TAG, &driver->show_gt_device_cfg);
+	survive_detach_config(ctx, Simulator_SENSOR_NOISE_TAG, &driver->sensor_var);
+	survive_detach_config(ctx, Simulator_SENSOR_TIME_JITTER_TAG, &driver->sensor_jitter);
+	survive_detach_config(ctx, Simulator_GYRO_NOISE_TAG, &driver->gyro_var);
+	survive_detach_config(ctx, Simulator_ACC_NOISE_TAG, &driver->acc_var);
+	survive_detach_config(ctx, Simulator_INIT_TIME_TAG, &driver->init_time);
+	survive_detach_config(ctx, Simulator_SENSOR_DROPRATE_TAG, &driver->sensor_droprate);
+	survive_detach_config(ctx, Simulator_TIME_FACTOR_TAG, &driver->time_factor);
+	survive_detach_config(ctx, Simulator_TIME_TAG, &driver->simulator_time);
+	survive_detach_config(ctx, Simulator_REALTIME_TAG, &driver->realtime);
+	survive_detach_config(ctx, "report-in-imu", &driver->report_in_imu);
+
 	return 0;
 }
 
-cstring generate_simulated_object(FLT r, size_t sensor_ct) {
+cstring generate_simulated_object(uint64_t *rng, FLT r, size_t sensor_ct) {
 	cstring cfg = {0};
 	cstring loc = {0}, nor_buf = {0};
 
 	char buffer[1024] = {0};
 
 	for (int i = 0; i < sensor_ct; i++) {
-		FLT azi = rand();
-		FLT pol = rand();
+		FLT azi = simulator_rand(rng, 0, 2 * LINMATHPI);
+		FLT pol = simulator_rand(rng, 0, 2 * LINMATHPI);
 		LinmathVec3d normals, locations;
 		normals[0] = locations[0] = r * cos(azi) * sin(pol);
 		normals[1] = locations[1] = r * sin(azi) * sin(pol);
@@ -567,11 +722,10 @@ cstring generate_simulated_object(FLT r, size_t sensor_ct) {
 	nor_buf.d[nor_buf.length - 2] = 0;
 	loc.d[loc.length - 2] = 0;
 
-	FLT trackref_from_head[] = {rand(), rand(), rand(), rand(), rand(), rand(), rand()};
-	FLT trackref_from_imu[] = {rand(), rand(), rand(), rand(), rand(), rand(), rand()};
+	FLT trackref_from_head[7], trackref_from_imu[7];
 	for (int i = 0; i < 7; i++) {
-		trackref_from_head[i] = .1 * (trackref_from_head[i] / RAND_MAX - .5);
-		trackref_from_imu[i] = .1 * (trackref_from_imu[i] / RAND_MAX - .5);
+		trackref_from_head[i] = simulator_rand(rng, -.05, .05);
+		trackref_from_imu[i] = simulator_rand(rng, -.05, .05);
 	}
 
 	quatnormalize(trackref_from_head, trackref_from_head);
@@ -615,7 +769,9 @@ SURVIVE_EXPORT SurviveObject *survive_create_simulation_device(SurviveContext *c
 
 	FLT r = survive_configf(ctx, "simulator-obj-radius", SC_GET, 0.1);
 
-	cstring cfg = generate_simulated_object(r, device->sensor_ct);
+	// Not the driver's generator; driver may not be a simulator, and the shape only depends on the seed this way
+	uint64_t rng = survive_configi(ctx, Simulator_SEED_TAG, SC_GET, 42);
+	cstring cfg = generate_simulated_object(&rng, r, device->sensor_ct);
 	device->object_type = SURVIVE_OBJECT_TYPE_HMD;
 	device->object_subtype = SURVIVE_OBJECT_SUBTYPE_VIVE_HMD;
 	device->timebase_hz = 48000000;
@@ -629,6 +785,7 @@ SURVIVE_EXPORT SurviveObject *survive_create_simulation_device(SurviveContext *c
 int DriverRegSimulator(SurviveContext *ctx) {
 	SurviveDriverSimulator *sp = SV_CALLOC(sizeof(SurviveDriverSimulator));
 	sp->ctx = ctx;
+	sp->rng = survive_configi(ctx, Simulator_SEED_TAG, SC_GET, 42);
 	ctx->poll_min_time_ms = 0;
 
 	apply_initial_position(sp);
@@ -642,20 +799,25 @@ int DriverRegSimulator(SurviveContext *ctx) {
 	survive_attach_configf(ctx, Simulator_ACC_NOISE_TAG, &sp->acc_var);
 	survive_attach_configf(ctx, Simulator_INIT_TIME_TAG, &sp->init_time);
 	survive_attach_configf(ctx, Simulator_SENSOR_DROPRATE_TAG, &sp->sensor_droprate);
+	survive_attach_configf(ctx, Simulator_TIME_FACTOR_TAG, &sp->time_factor);
+	survive_attach_configf(ctx, Simulator_TIME_TAG, &sp->simulator_time);
+	survive_attach_configi(ctx, Simulator_REALTIME_TAG, &sp->realtime);
+	survive_attach_configi(ctx, "report-in-imu", &sp->report_in_imu);
+
+	sp->attractor_cnt = survive_configi(ctx, "attractors", SC_GET, 3);
+	sp->wall_start = OGGetAbsoluteTime();
 
 	sp->pose_variance.size = 7;
 
 	sp->gyro_bias_scale = survive_configf(ctx, Simulator_GYRO_BIAS_TAG, SC_GET, 0);
 	for (int i = 0; i < 3; i++)
-		sp->gyro_bias[i] = linmath_normrand(0, sp->gyro_bias_scale);
+		sp->gyro_bias[i] = simulator_normrand(&sp->rng, 0, sp->gyro_bias_scale);
 
 	int use_lh2 = survive_configi(ctx, Simulator_LH_VERSION_TAG, SC_GET, 2) == 2;
 	int max_lighthouses = use_lh2 ? 16 : 2;
 	// Create a new SurviveObject...
 	SurviveObject *device = survive_create_simulation_device(ctx, sp, "SM0");
 
-	srand(42);
-
 	FLT freq_per_channel[NUM_GEN2_LIGHTHOUSES] = {
 		50.0521, 50.1567, 50.3673, 50.5796, 50.6864, 50.9014, 51.0096, 51.1182,
 		51.2273, 51.6685, 52.2307, 52.6894, 52.9217, 53.2741, 53.7514, 54.1150,
@@ -672,7 +834,7 @@ int DriverRegSimulator(SurviveContext *ctx) {
 
 		ctx->bsd_map[ctx->bsd[i].mode] = i;
 
-		sp->lhstates[i].start_time = (rand() / (FLT)RAND_MAX);
+		sp->lhstates[i].start_time = simulator_rand(&sp->rng, 0, 1.);
 
 		assert(ctx->bsd[i].mode < NUM_GEN2_LIGHTHOUSES);
 
@@ -694,13 +856,13 @@ int DriverRegSimulator(SurviveContext *ctx) {
 			for (int axis = 0; axis < 2; axis++) {
 				for (int cal_idx = 0; cal_idx < sizeof(fcalNoise) / sizeof(FLT); cal_idx++) {
 					((FLT *)(&ctx->bsd[i].fcal[axis]))[cal_idx] =
-						linmath_rand(-((FLT *)&fcalNoise)[cal_idx], ((FLT *)&fcalNoise)[cal_idx]);
+						simulator_rand(&sp->rng, -((FLT *)&fcalNoise)[cal_idx], ((FLT *)&fcalNoise)[cal_idx]);
 				}
 			}
 			ctx->activeLighthouses++;
 
 			ctx->bsd_map[ctx->bsd[i].mode] = i;
-			sp->lhstates[i].start_time = (rand() / (FLT)RAND_MAX);
+			sp->lhstates[i].start_time = simulator_rand(&sp->rng, 0, 1.);
 			sp->lhstates[i].period_s = 1. / freq_per_channel[ctx->bsd[i].mode];
 
 			sp->bsd[i] = ctx->bsd[i];
@@ -712,7 +874,7 @@ int DriverRegSimulator(SurviveContext *ctx) {
 		for (int axis = 0; axis < 2; axis++) {
 			for (int cal_idx = 0; cal_idx < sizeof(fcalNoise) / sizeof(FLT); cal_idx++) {
 				((FLT *)(&ctx->bsd[i].fcal[axis]))[cal_idx] +=
-					fcal_noise * linmath_rand(-((FLT *)&fcalNoise)[cal_idx], ((FLT *)&fcalNoise)[cal_idx]);
+					fcal_noise * simulator_rand(&sp->rng, -((FLT *)&fcalNoise)[cal_idx], ((FLT *)&fcalNoise)[cal_idx]);
 			}
 		}
 	}
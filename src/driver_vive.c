@@ -414,12 +414,21 @@ struct SurviveViveData {
 	bool requestPairing;
 #ifndef HIDAPI
 	libusb_hotplug_callback_handle callback_handle;
+
+	int ingest_thread_cnt;
+	struct SurviveUSBIngestWorker *ingest_workers;
+	size_t ingest_next_worker;
+
+	// Guards ingest_ifaces; always taken after the ctx lock
+	og_mutex_t ingest_lock;
+	SurviveUSBInterface *ingest_ifaces[MAX_USB_DEVS * MAX_INTERFACES_PER_DEVICE];
+	size_t ingest_iface_cnt;
 #endif
 };
 
 static void parse_tracker_version_info(SurviveObject *so, uint8_t *data, size_t size);
 static int AttachInterface(SurviveViveData *sv, struct SurviveUSBInfo *usbObject, const struct Endpoint_t *endpoint,
-						   USBHANDLE devh, usb_callback cb);
+						   USBHANDLE devh, usb_callback cb, usb_callback cb_locked);
 static int survive_vive_send_haptic(SurviveObject *so, FLT frequency, FLT amplitude, FLT duration_seconds);
 #ifdef HIDAPI
 #include "driver_vive.hidapi.h"
@@ -592,7 +601,7 @@ static int survive_usb_init(SurviveViveData *sv);
 int survive_usb_poll(SurviveContext *ctx);
 
 static int AttachInterface(SurviveViveData *sv, struct SurviveUSBInfo *usbObject, const struct Endpoint_t *endpoint,
-						   USBHANDLE devh, usb_callback cb) {
+						   USBHANDLE devh, usb_callback cb, usb_callback cb_locked) {
 	SurviveContext *ctx = sv->ctx;
 	size_t iface_cnt = usbObject->interface_cnt++;
 	int which_interface_am_i = endpoint->type;
@@ -608,6 +617,7 @@ static int AttachInterface(SurviveViveData *sv, struct SurviveUSBInfo *usbObject
 	iface->usbInfo = usbObject;
 	iface->hname = hname;
 	iface->cb = cb;
+	iface->cb_locked = cb_locked;
 
 #ifdef HIDAPI
 	// What do here?
@@ -639,12 +649,24 @@ static int AttachInterface(SurviveViveData *sv, struct SurviveUSBInfo *usbObject
 	memset(iface->swap_buffer, 0xCA, sizeof(iface->swap_buffer));
 	libusb_fill_interrupt_transfer(tx, devh, endpoint_num, iface->swap_buffer[0], INTBUFFSIZE, handle_transfer, iface,
 								   0);
+	if (!survive_usb_ingest_register(sv, iface)) {
+		SV_ERROR(SURVIVE_ERROR_GENERAL, "Error: No ingest slot left for %s 0x%02x; at most %d interfaces are supported",
+				 hname, endpoint_num, (int)(sizeof(sv->ingest_ifaces) / sizeof(sv->ingest_ifaces[0])));
+		libusb_free_transfer(tx);
+		iface->transfer = 0;
+		usbObject->active_transfers--;
+		return 7;
+	}
 
 	iface->last_submit_time = OGGetAbsoluteTimeUS();
 	int rc = libusb_submit_transfer(tx);
 	if (rc) {
 		SV_ERROR(SURVIVE_ERROR_HARWARE_FAULT, "Error: Could not submit transfer for %s 0x%02x (Code %d, %s)", hname,
 				 endpoint_num, rc, libusb_error_name(rc));
+		survive_usb_ingest_unregister(sv, iface);
+		libusb_free_transfer(tx);
+		iface->transfer = 0;
+		usbObject->active_transfers--;
 		return 6;
 	}
 #endif
@@ -740,7 +762,8 @@ int survive_vive_add_usb_device(SurviveViveData *sv, survive_usb_device_t d) {
 
 #ifdef HIDAPI
 	for (const struct Endpoint_t *endpoint = usbInfo->device_info->endpoints; endpoint->name; endpoint++) {
-		int errorCode = AttachInterface(sv, usbInfo, endpoint, usbInfo->handle, survive_data_cb);
+		int errorCode =
+			AttachInterface(sv, usbInfo, endpoint, usbInfo->handle, survive_data_cb, survive_data_cb_locked);
 		if (errorCode < 0) {
 			SV_WARN("Could not attach interface %s: %d", endpoint->name, errorCode);
 		}
@@ -769,6 +792,10 @@ int survive_usb_init(SurviveViveData *sv) {
 
 STATIC_CONFIG_ITEM(PAIR_DEVICE, "pair-device", 'i', "Turn on pairing mode", 0)
 STATIC_CONFIG_ITEM(SECONDS_PER_HZ_OUTPUT, "usb-hz-output", 'i', "Seconds between outputing usb stats", -1)
+STATIC_CONFIG_ITEM(USB_INGEST_THREADS, "usb-ingest-threads", 'i',
+				   "Threads processing usb packets. 0 processes them in the usb callback itself. Each thread holds the "
+				   "context lock while it processes, so more than 1 mostly adds threads waiting on that lock.",
+				   1)
 void survive_vive_usb_close(SurviveViveData *sv) {
 	survive_release_ctx_lock(sv->ctx);
 	survive_usb_close(sv);
@@ -804,6 +831,9 @@ static inline bool survive_handle_close_request_flag(struct SurviveUSBInfo *usbI
 #endif
 		bool reopen = usbInfo->request_reopen;
 		survive_usb_handle_close(usbInfo->handle);
+		for (size_t j = 0; j < usbInfo->interface_cnt; j++) {
+			free(usbInfo->interfaces[j].ingest_ring);
+		}
 		free(usbInfo);
 
 		if (reopen && dev) {
@@ -849,14 +879,17 @@ int survive_vive_usb_poll(SurviveContext *ctx, void *v) {
 							survive_colorize(iface->hname), avg_cb_submit_latency);
 				}
 				SV_INFO("Iface %3s %-32s has %5zu packets (%8.2f hz) Avg CB Time: %5.2fms Avg CB Latency: %5.2fms Max "
-						"CB Time: %5.2fms Max CB Latency: %5.2fms Time Violations %4d (%7.5f%%)",
+						"CB Time: %5.2fms Max CB Latency: %5.2fms Time Violations %4d (%7.5f%%) Queue depth %3u (max "
+						"%3u) Drops %4u",
 						survive_colorize(codename), survive_colorize(iface->hname), iface->packet_count,
 						iface->packet_count / time_diff, avg_cb_time, avg_cb_submit_latency, iface->max_cb_time / 1000.,
 						iface->max_submit_time / 1000., iface->cb_time_violation,
-						100. * iface->cb_time_violation / (FLT)(iface->packet_count + .0001));
+						100. * iface->cb_time_violation / (FLT)(iface->packet_count + .0001),
+						iface->ingest_head - iface->ingest_tail, iface->ingest_max_depth, iface->ingest_drops);
 				iface->max_cb_time = iface->max_submit_time = iface->sum_cb_time = iface->sum_submit_cb_time = 0;
 				iface->cb_time_violation = 0;
 				iface->packet_count = 0;
+				iface->ingest_max_depth = iface->ingest_drops = 0;
 			}
 		}
 
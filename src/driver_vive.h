@@ -77,6 +77,15 @@ void survive_usb_handle_close(libsurvive_usb_handle *handle);
 
 struct SurviveUSBInfo;
 
+// Must be a power of two
+#define SURVIVE_USB_INGEST_RING_SIZE 128
+
+typedef struct SurviveUSBPacket {
+	uint64_t time_received_us;
+	int actual_len;
+	uint8_t data[INTBUFFSIZE];
+} SurviveUSBPacket;
+
 typedef struct SurviveUSBInterface {
 	struct SurviveViveData *sv;
 	SurviveContext *ctx;
@@ -97,6 +106,9 @@ typedef struct SurviveUSBInterface {
 	uint8_t swap_buffer_idx;
 
 	usb_callback cb;
+	// cb for callers that already hold the ctx lock, like the ingest workers which take it once per batch. Interfaces
+	// without one are processed in the usb callback.
+	usb_callback cb_locked;
 	int which_interface_am_i; // for indexing into uiface
 	const char *hname;		  // human-readable names
 	size_t packet_count;
@@ -105,6 +117,13 @@ typedef struct SurviveUSBInterface {
 	uint64_t last_submit_time, sum_submit_cb_time, sum_cb_time;
 	uint32_t max_submit_time, max_cb_time, cb_time_violation;
 	bool shutdown;
+
+	// Raw packets handed from the usb event thread to an ingest worker. The usb callback is the only writer of
+	// ingest_head and the worker is the only writer of ingest_tail.
+	SurviveUSBPacket *ingest_ring;
+	volatile uint32_t ingest_head, ingest_tail;
+	struct SurviveUSBIngestWorker *ingest_worker;
+	uint32_t ingest_max_depth, ingest_drops;
 } SurviveUSBInterface;
 
 SURVIVE_EXPORT void survive_dump_buffer(SurviveContext *ctx, const uint8_t *data, size_t length);
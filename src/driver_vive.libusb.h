@@ -63,6 +63,212 @@ static inline int getupdate_feature_report(libusb_device_handle *dev, uint16_t i
 typedef libusb_device *survive_usb_device_t;
 typedef libusb_device **survive_usb_devices_t;
 
+/*
+ * Packets are copied out of the transfer into a per-interface ring and the transfer is resubmitted right away; the
+ * parsing, disambiguation and filtering happen on a small pool of ingest workers. Each interface is bound to exactly
+ * one worker so every ring has a single producer and a single consumer, and packets from one interface are always
+ * processed in order.
+ */
+struct SurviveUSBIngestWorker {
+	SurviveViveData *sv;
+	og_thread_t thread;
+	og_sema_t wake;
+	volatile bool keep_running;
+};
+
+void survive_data_cb_locked(uint64_t time_received_us, SurviveUSBInterface *si);
+
+static inline void survive_usb_iface_record_cb_time(SurviveUSBInterface *iface, uint64_t cb_time) {
+	if (iface->max_cb_time < cb_time)
+		iface->max_cb_time = cb_time;
+	if (iface->time_constraint && cb_time > iface->time_constraint)
+		iface->cb_time_violation++;
+
+	iface->sum_cb_time += cb_time;
+}
+
+static inline bool survive_usb_ingest_push(SurviveUSBInterface *iface, uint64_t time_received_us, const uint8_t *data,
+										   int length) {
+	uint32_t head = iface->ingest_head;
+	uint32_t depth = head - OGAtomicLoadAcquire32(&iface->ingest_tail);
+	if (depth >= SURVIVE_USB_INGEST_RING_SIZE) {
+		iface->ingest_drops++;
+		return false;
+	}
+
+	SurviveUSBPacket *packet = &iface->ingest_ring[head & (SURVIVE_USB_INGEST_RING_SIZE - 1)];
+	packet->time_received_us = time_received_us;
+	packet->actual_len = length;
+	memcpy(packet->data, data, length);
+	OGAtomicStoreRelease32(&iface->ingest_head, head + 1);
+
+	if (iface->ingest_max_depth < depth + 1)
+		iface->ingest_max_depth = depth + 1;
+	return true;
+}
+
+// Packets handed to the callbacks per hold of the ctx lock, so a busy interface doesn't keep it from other threads
+#define SURVIVE_USB_INGEST_BATCH 16
+
+static inline bool survive_usb_ingest_pending(SurviveUSBInterface *iface) {
+	return OGAtomicLoadAcquire32(&iface->ingest_head) != iface->ingest_tail;
+}
+
+// Processes up to SURVIVE_USB_INGEST_BATCH packets; returns whether any are left
+static bool survive_usb_ingest_drain(SurviveUSBInterface *iface) {
+	uint32_t head = OGAtomicLoadAcquire32(&iface->ingest_head);
+	uint32_t end = iface->ingest_tail + SURVIVE_USB_INGEST_BATCH;
+	if ((int32_t)(head - end) > 0)
+		head = end;
+
+	for (uint32_t tail = iface->ingest_tail; tail != head; tail++) {
+		SurviveUSBPacket *packet = &iface->ingest_ring[tail & (SURVIVE_USB_INGEST_RING_SIZE - 1)];
+		iface->buffer = packet->data;
+		iface->actual_len = packet->actual_len;
+
+		uint64_t cb_start = OGGetAbsoluteTimeUS();
+		iface->cb_locked(packet->time_received_us, iface);
+		survive_usb_iface_record_cb_time(iface, OGGetAbsoluteTimeUS() - cb_start);
+
+		OGAtomicStoreRelease32(&iface->ingest_tail, tail + 1);
+	}
+	return survive_usb_ingest_pending(iface);
+}
+
+// Finds the first interface of worker at or after *idx with queued packets. Only takes the ingest lock, so the caller
+// has to check the interface is still at *idx once it holds the ctx lock.
+static SurviveUSBInterface *survive_usb_ingest_next(SurviveViveData *sv, struct SurviveUSBIngestWorker *worker,
+													size_t *idx) {
+	SurviveUSBInterface *rtn = 0;
+	OGLockMutex(sv->ingest_lock);
+	for (; *idx < sv->ingest_iface_cnt && rtn == 0; (*idx)++) {
+		SurviveUSBInterface *iface = sv->ingest_ifaces[*idx];
+		if (iface->ingest_worker == worker && survive_usb_ingest_pending(iface)) {
+			rtn = iface;
+		}
+	}
+	OGUnlockMutex(sv->ingest_lock);
+	if (rtn)
+		(*idx)--;
+	return rtn;
+}
+
+static void *survive_usb_ingest_thread(void *user) {
+	struct SurviveUSBIngestWorker *worker = user;
+	SurviveViveData *sv = worker->sv;
+	SurviveContext *ctx = sv->ctx;
+
+	while (worker->keep_running) {
+		OGLockSema(worker->wake);
+		// Every queued packet posted once; one pass picks all of them up.
+		while (OGTryLockSema(worker->wake))
+			;
+
+		// The ctx lock is only held for one batch of one interface at a time. Passes repeat until one finds nothing,
+		// since unregistering an interface can move a later one into a slot this pass already went by.
+		bool pending = true;
+		while (pending) {
+			pending = false;
+
+			size_t idx = 0;
+			SurviveUSBInterface *iface;
+			while ((iface = survive_usb_ingest_next(sv, worker, &idx))) {
+				bool more = false;
+				survive_get_ctx_lock(ctx);
+				OGLockMutex(sv->ingest_lock);
+				if (idx < sv->ingest_iface_cnt && sv->ingest_ifaces[idx] == iface && iface->ingest_worker == worker) {
+					more = survive_usb_ingest_drain(iface);
+					pending = true;
+				}
+				OGUnlockMutex(sv->ingest_lock);
+				survive_release_ctx_lock(ctx);
+
+				if (!more)
+					idx++;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static void survive_usb_ingest_start(SurviveViveData *sv) {
+	SurviveContext *ctx = sv->ctx;
+	sv->ingest_thread_cnt = survive_configi(ctx, "usb-ingest-threads", SC_GET, 1);
+	if (sv->ingest_thread_cnt <= 0) {
+		sv->ingest_thread_cnt = 0;
+		return;
+	}
+
+	sv->ingest_lock = OGCreateMutex();
+	sv->ingest_workers = SV_CALLOC(sv->ingest_thread_cnt * sizeof(struct SurviveUSBIngestWorker));
+	for (int i = 0; i < sv->ingest_thread_cnt; i++) {
+		struct SurviveUSBIngestWorker *worker = &sv->ingest_workers[i];
+		worker->sv = sv;
+		worker->wake = OGCreateSema();
+		worker->keep_running = true;
+		worker->thread = OGCreateThread(survive_usb_ingest_thread, "usb ingest", worker);
+	}
+	SV_VERBOSE(10, "Processing usb packets on %d ingest threads", sv->ingest_thread_cnt);
+}
+
+static void survive_usb_ingest_stop(SurviveViveData *sv) {
+	for (int i = 0; i < sv->ingest_thread_cnt; i++) {
+		sv->ingest_workers[i].keep_running = false;
+		OGUnlockSema(sv->ingest_workers[i].wake);
+	}
+	for (int i = 0; i < sv->ingest_thread_cnt; i++) {
+		OGJoinThread(sv->ingest_workers[i].thread);
+		OGDeleteSema(sv->ingest_workers[i].wake);
+	}
+
+	free(sv->ingest_workers);
+	sv->ingest_workers = 0;
+	sv->ingest_thread_cnt = 0;
+	if (sv->ingest_lock) {
+		OGDeleteMutex(sv->ingest_lock);
+		sv->ingest_lock = 0;
+	}
+}
+
+// Returns false if every ingest slot is taken
+static bool survive_usb_ingest_register(SurviveViveData *sv, SurviveUSBInterface *iface) {
+	iface->ingest_head = iface->ingest_tail = 0;
+	iface->ingest_worker = 0;
+	if (sv->ingest_thread_cnt == 0 || iface->cb_locked == 0)
+		return true;
+
+	if (iface->ingest_ring == 0) {
+		iface->ingest_ring = SV_CALLOC(SURVIVE_USB_INGEST_RING_SIZE * sizeof(SurviveUSBPacket));
+	}
+
+	bool registered = false;
+	OGLockMutex(sv->ingest_lock);
+	if (sv->ingest_iface_cnt < sizeof(sv->ingest_ifaces) / sizeof(sv->ingest_ifaces[0])) {
+		iface->ingest_worker = &sv->ingest_workers[sv->ingest_next_worker++ % sv->ingest_thread_cnt];
+		sv->ingest_ifaces[sv->ingest_iface_cnt++] = iface;
+		registered = true;
+	}
+	OGUnlockMutex(sv->ingest_lock);
+	return registered;
+}
+
+// Waits out any drain pass in progress, so the interface can be torn down once this returns.
+static void survive_usb_ingest_unregister(SurviveViveData *sv, SurviveUSBInterface *iface) {
+	if (iface->ingest_worker == 0)
+		return;
+
+	OGLockMutex(sv->ingest_lock);
+	for (size_t i = 0; i < sv->ingest_iface_cnt; i++) {
+		if (sv->ingest_ifaces[i] == iface) {
+			sv->ingest_ifaces[i] = sv->ingest_ifaces[--sv->ingest_iface_cnt];
+			break;
+		}
+	}
+	iface->ingest_worker = 0;
+	OGUnlockMutex(sv->ingest_lock);
+}
+
 static int survive_usb_subsystem_init(SurviveViveData *sv) {
 	int rtn = libusb_init(&sv->usbctx);
 #if LIBUSB_API_VERSION < 0x01000106
@@ -70,6 +276,9 @@ static int survive_usb_subsystem_init(SurviveViveData *sv) {
 #else
 	libusb_set_option(NULL, LIBUSB_OPTION_LOG_LEVEL, LIBUSB_LOG_LEVEL_WARNING);
 #endif
+	if (rtn == 0) {
+		survive_usb_ingest_start(sv);
+	}
 	return rtn;
 }
 
@@ -165,6 +374,7 @@ cleanup_and_rtn:
 static inline void survive_close_usb_device(struct SurviveUSBInfo *usbInfo);
 
 static void survive_disconnect_device(SurviveUSBInterface *iface) {
+	survive_usb_ingest_unregister(iface->sv, iface);
 	iface->ctx = 0;
 	survive_close_usb_device(iface->usbInfo);
 }
@@ -190,10 +400,14 @@ static void handle_transfer(struct libusb_transfer *transfer) {
 		goto shutdown;
 	}
 
-	iface->actual_len = transfer->actual_length;
-	iface->buffer = iface->swap_buffer[iface->swap_buffer_idx++ % 2];
+	if (iface->ingest_worker) {
+		survive_usb_ingest_push(iface, time, transfer->buffer, transfer->actual_length);
+	} else {
+		iface->actual_len = transfer->actual_length;
+		iface->buffer = iface->swap_buffer[iface->swap_buffer_idx++ % 2];
 
-	transfer->buffer = iface->swap_buffer[iface->swap_buffer_idx % 2];
+		transfer->buffer = iface->swap_buffer[iface->swap_buffer_idx % 2];
+	}
 
 	uint64_t submit_cb_time = OGGetAbsoluteTimeUS() - iface->last_submit_time;
 
@@ -207,17 +421,15 @@ static void handle_transfer(struct libusb_transfer *transfer) {
 
 	if (iface->max_submit_time < submit_cb_time)
 		iface->max_submit_time = submit_cb_time;
-	uint64_t cb_start = OGGetAbsoluteTimeUS();
 	iface->sum_submit_cb_time += submit_cb_time;
-	iface->cb(time, iface);
-	uint64_t cb_end = OGGetAbsoluteTimeUS();
-	uint64_t cb_time = cb_end - cb_start;
-	if (iface->max_cb_time < cb_time)
-		iface->max_cb_time = cb_time;
-	if (iface->time_constraint && cb_time > iface->time_constraint)
-		iface->cb_time_violation++;
 
-	iface->sum_cb_time += cb_time;
+	if (iface->ingest_worker) {
+		OGUnlockSema(iface->ingest_worker->wake);
+	} else {
+		uint64_t cb_start = OGGetAbsoluteTimeUS();
+		iface->cb(time, iface);
+		survive_usb_iface_record_cb_time(iface, OGGetAbsoluteTimeUS() - cb_start);
+	}
 	iface->packet_count++;
 
 	return;
@@ -227,6 +439,7 @@ disconnect:
 	survive_disconnect_device(iface);
 shutdown:
 	SV_VERBOSE(200, "Cleaning up transfer on %d %s", iface->which_interface_am_i, survive_colorize(iface->hname));
+	survive_usb_ingest_unregister(iface->sv, iface);
 	iface->ctx = 0;
 
 	libusb_release_interface(iface->usbInfo->handle, iface->which_interface_am_i);
@@ -305,7 +518,10 @@ static inline void survive_close_usb_device(struct SurviveUSBInfo *usbInfo) {
 
 }
 
-void survive_usb_close(SurviveViveData *sv) { libusb_exit(sv->usbctx); }
+void survive_usb_close(SurviveViveData *sv) {
+	survive_usb_ingest_stop(sv);
+	libusb_exit(sv->usbctx);
+}
 
 static inline void setup_config_req(struct survive_config_packet *config_packet) {
 	config_packet->state = SURVIVE_CONFIG_STATE_CONFIG;
@@ -486,8 +702,8 @@ setup_next : {
 				   survive_colorize(packet->usbInfo->device_info->name), survive_run_time(ctx));
 
 		for (const struct Endpoint_t *endpoint = packet->usbInfo->device_info->endpoints; endpoint->name; endpoint++) {
-			int errorCode =
-				AttachInterface(packet->sv, packet->usbInfo, endpoint, packet->usbInfo->handle, survive_data_cb);
+			int errorCode = AttachInterface(packet->sv, packet->usbInfo, endpoint, packet->usbInfo->handle,
+											survive_data_cb, survive_data_cb_locked);
 			if (errorCode < 0) {
 				SV_WARN("Could not attach interface %s: %d", endpoint->name, errorCode);
 			}
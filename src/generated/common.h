@@ -14,3 +14,5 @@ static inline double __safe_pow(double x, double y) { return x >= 0 ? pow(x, y)
 #endif
 #endif
 #define GEN_FLT FLT
+// Batched functions promise the compiler their output doesn't overlap their inputs so their loops vectorize
+#define GEN_RESTRICT __restrict
@@ -0,0 +1,87 @@
+#pragma once
+#include "common.h"
+
+// Single precision stand ins for the libm calls generated code makes. Each is a short minimax polynomial after a
+// range reduction, written without branches so that loops over them vectorize. Errors are a few ulp over the ranges
+// reprojection sees; check_generated bounds them against the double versions.
+#define GEN_FLTF float
+
+static const float __fast_pi = 3.14159265358979f;
+static const float __fast_pi_2 = 1.57079632679490f;
+static const float __fast_pi_4 = 0.78539816339745f;
+
+// r is x reduced into [-pi/4, pi/4], with x = r + q * pi/2
+static inline float __fast_reduce_pi_2(float x, int *q) {
+	const float fq = floorf(x * 0.63661977236758f + 0.5f);
+	*q = (int)fq;
+	// pi/2 split into three parts so the products with q are exact for the first two
+	return ((x - fq * 1.5703125f) - fq * 4.8375129699707031e-4f) - fq * 7.5497899548918821e-8f;
+}
+
+static inline float __fast_sin_poly(float r) {
+	const float z = r * r;
+	return ((-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f) * z * r + r;
+}
+
+static inline float __fast_cos_poly(float r) {
+	const float z = r * r;
+	return ((2.443315711809948e-5f * z - 1.388731625493765e-3f) * z + 4.166664568298827e-2f) * z * z - 0.5f * z + 1.f;
+}
+
+static inline float __fast_sinf(float x) {
+	int q;
+	const float r = __fast_reduce_pi_2(x, &q);
+	const float s = __fast_sin_poly(r), c = __fast_cos_poly(r);
+	const float v = (q & 1) ? c : s;
+	return (q & 2) ? -v : v;
+}
+
+static inline float __fast_cosf(float x) {
+	int q;
+	const float r = __fast_reduce_pi_2(x, &q);
+	const float s = __fast_sin_poly(r), c = __fast_cos_poly(r);
+	const float v = (q & 1) ? -s : c;
+	return (q & 2) ? -v : v;
+}
+
+static inline float __fast_tanf(float x) {
+	int q;
+	const float r = __fast_reduce_pi_2(x, &q);
+	const float s = __fast_sin_poly(r), c = __fast_cos_poly(r);
+	return (q & 1) ? -c / s : s / c;
+}
+
+static inline float __fast_atanf(float x) {
+	const float a = fabsf(x);
+	// Fold onto [0, tan(pi/8)] using atan(a) = pi/2 - atan(1/a) and atan(a) = pi/4 + atan((a-1)/(a+1))
+	const bool big = a > 2.414213562373095f, mid = a > 0.4142135623730950f;
+	const float t = big ? -1.f / a : mid ? (a - 1.f) / (a + 1.f) : a;
+	const float offset = big ? __fast_pi_2 : mid ? __fast_pi_4 : 0.f;
+	const float z = t * t;
+	const float v =
+		offset + (((8.05374449538e-2f * z - 1.38776856032e-1f) * z + 1.99777106478e-1f) * z - 3.33329491539e-1f) * z * t +
+		t;
+	return x < 0 ? -v : v;
+}
+
+static inline float __fast_atan2f(float y, float x) {
+	const float v = __fast_atanf(x == 0 ? (y == 0 ? 0 : y * INFINITY) : y / x);
+	return x < 0 ? (y < 0 ? v - __fast_pi : v + __fast_pi) : v;
+}
+
+static inline float __fast_asinf(float x) {
+	const float a = fminf(fabsf(x), 1.f);
+	// Past 1/2, asin(a) = pi/2 - 2 asin(sqrt((1 - a) / 2)) keeps the polynomial argument small
+	const bool big = a > 0.5f;
+	const float z = big ? 0.5f * (1.f - a) : a * a;
+	const float t = big ? sqrtf(z) : a;
+	const float p =
+		((((4.2163199048e-2f * z + 2.4181311049e-2f) * z + 4.5470025998e-2f) * z + 7.4953002686e-2f) * z +
+		 1.6666752422e-1f) *
+			z * t +
+		t;
+	const float v = big ? __fast_pi_2 - 2.f * p : p;
+	return x < 0 ? -v : v;
+}
+
+static inline float __fast_sqrtf(float x) { return x > 0 ? sqrtf(x) : 0; }
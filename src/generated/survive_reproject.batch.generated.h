@@ -0,0 +1,4335 @@
+#pragma once
+#include "common.h"
+static inline void gen_reproject_gen2_axis_angle_batch(FLT *GEN_RESTRICT out, size_t n,
+													   const LinmathAxisAnglePose *obj_p,
+													   const FLT *GEN_RESTRICT sensor_pt,
+													   const LinmathAxisAnglePose *lh_p, const BaseStationCal *bsd) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_0 = bsd[0].phase;
+	const GEN_FLT tilt_0 = bsd[0].tilt;
+	const GEN_FLT curve_0 = bsd[0].curve;
+	const GEN_FLT gibPhase_0 = bsd[0].gibpha;
+	const GEN_FLT gibMag_0 = bsd[0].gibmag;
+	const GEN_FLT ogeeMag_0 = bsd[0].ogeephase;
+	const GEN_FLT ogeePhase_0 = bsd[0].ogeemag;
+	const GEN_FLT phase_1 = bsd[1].phase;
+	const GEN_FLT tilt_1 = bsd[1].tilt;
+	const GEN_FLT curve_1 = bsd[1].curve;
+	const GEN_FLT gibPhase_1 = bsd[1].gibpha;
+	const GEN_FLT gibMag_1 = bsd[1].gibmag;
+	const GEN_FLT ogeeMag_1 = bsd[1].ogeephase;
+	const GEN_FLT ogeePhase_1 = bsd[1].ogeemag;
+	const GEN_FLT x0 = 0.523598775598299 + tilt_0;
+	const GEN_FLT x1 = cos(x0);
+	const GEN_FLT x2 = lh_qk * lh_qk;
+	const GEN_FLT x3 = lh_qj * lh_qj;
+	const GEN_FLT x4 = lh_qi * lh_qi;
+	const GEN_FLT x5 = 1e-10 + x4 + x3 + x2;
+	const GEN_FLT x6 = sqrt(x5);
+	const GEN_FLT x7 = (1. / x6) * sin(x6);
+	const GEN_FLT x8 = x7 * lh_qi;
+	const GEN_FLT x9 = cos(x6);
+	const GEN_FLT x10 = (1. / x5) * (1 + (-1 * x9));
+	const GEN_FLT x11 = x10 * lh_qj;
+	const GEN_FLT x12 = x11 * lh_qk;
+	const GEN_FLT x13 = obj_qk * obj_qk;
+	const GEN_FLT x14 = obj_qj * obj_qj;
+	const GEN_FLT x15 = obj_qi * obj_qi;
+	const GEN_FLT x16 = 1e-10 + x15 + x14 + x13;
+	const GEN_FLT x17 = sqrt(x16);
+	const GEN_FLT x18 = cos(x17);
+	const GEN_FLT x19 = (1. / x16) * (1 + (-1 * x18));
+	const GEN_FLT x20 = (1. / x17) * sin(x17);
+	const GEN_FLT x21 = x20 * obj_qi;
+	const GEN_FLT x22 = x19 * obj_qk * obj_qj;
+	const GEN_FLT x23 = x20 * obj_qj;
+	const GEN_FLT x24 = x19 * obj_qi;
+	const GEN_FLT x25 = x24 * obj_qk;
+	const GEN_FLT x27 = x20 * obj_qk;
+	const GEN_FLT x28 = x24 * obj_qj;
+	const GEN_FLT x31 = x7 * lh_qk;
+	const GEN_FLT x32 = x11 * lh_qi;
+	const GEN_FLT x34 = x7 * lh_qj;
+	const GEN_FLT x35 = x10 * lh_qk * lh_qi;
+	const GEN_FLT x51 = 0.523598775598299 + (-1 * tilt_1);
+	const GEN_FLT x54 = cos(x51);
+	const GEN_FLT c0 = x25 + (-1 * x23);
+	const GEN_FLT c1 = x22 + x21;
+	const GEN_FLT c2 = x18 + (x13 * x19);
+	const GEN_FLT c3 = x28 + x27;
+	const GEN_FLT c4 = x18 + (x14 * x19);
+	const GEN_FLT c5 = x22 + (-1 * x21);
+	const GEN_FLT c6 = x18 + (x15 * x19);
+	const GEN_FLT c7 = x28 + (-1 * x27);
+	const GEN_FLT c8 = x25 + x23;
+	const GEN_FLT c9 = x32 + x31;
+	const GEN_FLT c10 = x9 + (x3 * x10);
+	const GEN_FLT c11 = x12 + (-1 * x8);
+	const GEN_FLT c12 = x35 + (-1 * x34);
+	const GEN_FLT c13 = x12 + x8;
+	const GEN_FLT c14 = x9 + (x2 * x10);
+	const GEN_FLT c15 = x9 + (x4 * x10);
+	const GEN_FLT c16 = x32 + (-1 * x31);
+	const GEN_FLT c17 = x35 + x34;
+	const GEN_FLT c18 = 1. / x1;
+	const GEN_FLT c19 = tan(x0);
+	const GEN_FLT c20 = sin(x0);
+	const GEN_FLT c21 = tan(x51);
+	const GEN_FLT c22 = 1. / x54;
+	const GEN_FLT c23 = sin(x51);
+	const GEN_FLT c24 = -1 * gibPhase_0;
+	const GEN_FLT c25 = -1 * phase_0;
+	const GEN_FLT c26 = -1 * gibPhase_1;
+	const GEN_FLT c27 = -1 * phase_1;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x26 = (c0 * sensor_x) + (c1 * sensor_y) + (c2 * sensor_z) + obj_pz;
+		const GEN_FLT x29 = (c3 * sensor_x) + (c4 * sensor_y) + (c5 * sensor_z) + obj_py;
+		const GEN_FLT x30 = (c6 * sensor_x) + (c7 * sensor_y) + (c8 * sensor_z) + obj_px;
+		const GEN_FLT x33 = (c9 * x30) + (x29 * c10) + lh_py + (x26 * c11);
+		const GEN_FLT x36 = (c12 * x30) + (x29 * c13) + (x26 * c14) + lh_pz;
+		const GEN_FLT x37 = (x30 * c15) + (c16 * x29) + (c17 * x26) + lh_px;
+		const GEN_FLT x38 = (x37 * x37) + (x36 * x36);
+		const GEN_FLT x39 = x33 * (1. / sqrt(x38 + (x33 * x33)));
+		const GEN_FLT x40 = asin(c18 * x39);
+		const GEN_FLT x41 = 0.0028679863 + (x40 * (-8.0108022e-06 + (-8.0108022e-06 * x40)));
+		const GEN_FLT x42 = 5.3685255e-06 + (x40 * x41);
+		const GEN_FLT x43 = 0.0076069798 + (x40 * x42);
+		const GEN_FLT x44 = x33 * (1. / sqrt(x38));
+		const GEN_FLT x45 = c19 * x44;
+		const GEN_FLT x46 = atan2(-1 * x36, x37);
+		const GEN_FLT x47 = (sin(x46 + (-1 * asin(x45)) + ogeeMag_0) * ogeePhase_0) + curve_0;
+		const GEN_FLT x48 = asin(x45 + ((x40 * x40) * x43 * x47 * (1. / (x1 + (-1 * c20 * x47 * ((x40 * (x43 + (x40 *
+			(x42 + (x40 * (x41 + (x40 * (-8.0108022e-06 + (-1.60216044e-05 * x40))))))))) + (x40 * x43)))))));
+		const GEN_FLT x49 = -1 * x46;
+		const GEN_FLT x50 = -1.5707963267949 + x46;
+		const GEN_FLT x52 = -1 * x44 * c21;
+		const GEN_FLT x53 = (sin(x46 + ogeeMag_1 + (-1 * asin(x52))) * ogeePhase_1) + curve_1;
+		const GEN_FLT x55 = asin(c22 * x39);
+		const GEN_FLT x56 = 0.0028679863 + (x55 * (-8.0108022e-06 + (-8.0108022e-06 * x55)));
+		const GEN_FLT x57 = 5.3685255e-06 + (x56 * x55);
+		const GEN_FLT x58 = 0.0076069798 + (x57 * x55);
+		const GEN_FLT x59 = asin(x52 + (x53 * x58 * (x55 * x55) * (1. / (x54 + (x53 * c23 * ((x55 * (x58 + (x55 * (x57
+			+ (x55 * (x56 + (x55 * (-8.0108022e-06 + (-1.60216044e-05 * x55))))))))) + (x58 * x55)))))));
+		out[i] = x50 + (-1 * x48) + (-1 * sin(x49 + x48 + c24) * gibMag_0) + c25;
+		out[n + i] = x50 + (-1 * sin(x49 + x59 + c26) * gibMag_1) + (-1 * x59) + c27;
+	}
+}
+
+// Jacobian of reproject_gen2 wrt [obj_px, obj_py, obj_pz, obj_qi, obj_qj, obj_qk]
+static inline void gen_reproject_gen2_jac_obj_p_axis_angle_batch(FLT *GEN_RESTRICT out, size_t n,
+																 const LinmathAxisAnglePose *obj_p,
+																 const FLT *GEN_RESTRICT sensor_pt,
+																 const LinmathAxisAnglePose *lh_p,
+																 const BaseStationCal *bsd) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_0 = bsd[0].phase;
+	const GEN_FLT tilt_0 = bsd[0].tilt;
+	const GEN_FLT curve_0 = bsd[0].curve;
+	const GEN_FLT gibPhase_0 = bsd[0].gibpha;
+	const GEN_FLT gibMag_0 = bsd[0].gibmag;
+	const GEN_FLT ogeeMag_0 = bsd[0].ogeephase;
+	const GEN_FLT ogeePhase_0 = bsd[0].ogeemag;
+	const GEN_FLT phase_1 = bsd[1].phase;
+	const GEN_FLT tilt_1 = bsd[1].tilt;
+	const GEN_FLT curve_1 = bsd[1].curve;
+	const GEN_FLT gibPhase_1 = bsd[1].gibpha;
+	const GEN_FLT gibMag_1 = bsd[1].gibmag;
+	const GEN_FLT ogeeMag_1 = bsd[1].ogeephase;
+	const GEN_FLT ogeePhase_1 = bsd[1].ogeemag;
+	const GEN_FLT x0 = lh_qk * lh_qk;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qi * lh_qi;
+	const GEN_FLT x3 = 1e-10 + x2 + x1 + x0;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = (1. / x4) * sin(x4);
+	const GEN_FLT x6 = x5 * lh_qj;
+	const GEN_FLT x7 = cos(x4);
+	const GEN_FLT x8 = (1. / x3) * (1 + (-1 * x7));
+	const GEN_FLT x9 = x8 * lh_qk * lh_qi;
+	const GEN_FLT x10 = x9 + (-1 * x6);
+	const GEN_FLT x11 = x9 + x6;
+	const GEN_FLT x12 = obj_qk * obj_qk;
+	const GEN_FLT x13 = obj_qj * obj_qj;
+	const GEN_FLT x14 = obj_qi * obj_qi;
+	const GEN_FLT x15 = 1e-10 + x14 + x13 + x12;
+	const GEN_FLT x16 = 1. / x15;
+	const GEN_FLT x17 = sqrt(x15);
+	const GEN_FLT x18 = cos(x17);
+	const GEN_FLT x19 = 1 + (-1 * x18);
+	const GEN_FLT x20 = x19 * x16;
+	const GEN_FLT x21 = sin(x17);
+	const GEN_FLT x22 = x21 * (1. / x17);
+	const GEN_FLT x23 = x22 * obj_qi;
+	const GEN_FLT x24 = x20 * obj_qj;
+	const GEN_FLT x25 = x24 * obj_qk;
+	const GEN_FLT x26 = x22 * obj_qj;
+	const GEN_FLT x27 = -1 * x26;
+	const GEN_FLT x28 = x20 * obj_qi;
+	const GEN_FLT x29 = x28 * obj_qk;
+	const GEN_FLT x31 = -1 * x23;
+	const GEN_FLT x32 = x22 * obj_qk;
+	const GEN_FLT x33 = x24 * obj_qi;
+	const GEN_FLT x35 = x5 * lh_qk;
+	const GEN_FLT x36 = x8 * lh_qj;
+	const GEN_FLT x37 = x36 * lh_qi;
+	const GEN_FLT x38 = x37 + (-1 * x35);
+	const GEN_FLT x39 = -1 * x32;
+	const GEN_FLT x41 = x7 + (x2 * x8);
+	const GEN_FLT x44 = x7 + (x0 * x8);
+	const GEN_FLT x45 = x5 * lh_qi;
+	const GEN_FLT x46 = x36 * lh_qk;
+	const GEN_FLT x47 = x46 + x45;
+	const GEN_FLT x55 = x46 + (-1 * x45);
+	const GEN_FLT x56 = x7 + (x1 * x8);
+	const GEN_FLT x57 = x37 + x35;
+	const GEN_FLT x62 = 0.523598775598299 + tilt_0;
+	const GEN_FLT x63 = cos(x62);
+	const GEN_FLT x64 = 1. / x63;
+	const GEN_FLT x79 = tan(x62);
+	const GEN_FLT x85 = sin(x62);
+	const GEN_FLT x154 = obj_qi * obj_qi * obj_qi;
+	const GEN_FLT x155 = x21 * (1. / (x15 * sqrt(x15)));
+	const GEN_FLT x156 = 2 * (1. / (x15 * x15)) * x19;
+	const GEN_FLT x157 = x18 * x16;
+	const GEN_FLT x158 = x157 * obj_qi;
+	const GEN_FLT x159 = x158 * obj_qk;
+	const GEN_FLT x160 = x155 * obj_qk * obj_qi;
+	const GEN_FLT x161 = x160 + (-1 * x159);
+	const GEN_FLT x162 = x14 * x155;
+	const GEN_FLT x163 = x156 * obj_qj;
+	const GEN_FLT x164 = (-1 * x14 * x163) + (x162 * obj_qj);
+	const GEN_FLT x165 = x164 + x24;
+	const GEN_FLT x166 = x20 * obj_qk;
+	const GEN_FLT x167 = x156 * obj_qk;
+	const GEN_FLT x168 = (-1 * x14 * x167) + (x162 * obj_qk);
+	const GEN_FLT x169 = x168 + x166;
+	const GEN_FLT x170 = x158 * obj_qj;
+	const GEN_FLT x171 = x155 * obj_qj;
+	const GEN_FLT x172 = x171 * obj_qi;
+	const GEN_FLT x173 = (-1 * x172) + x170;
+	const GEN_FLT x175 = (-1 * x160) + x159;
+	const GEN_FLT x176 = x13 * x155;
+	const GEN_FLT x177 = x156 * obj_qi;
+	const GEN_FLT x178 = (-1 * x13 * x177) + (x176 * obj_qi);
+	const GEN_FLT x179 = x14 * x157;
+	const GEN_FLT x180 = x171 * obj_qk;
+	const GEN_FLT x181 = obj_qk * obj_qj;
+	const GEN_FLT x182 = (-1 * x177 * x181) + (x180 * obj_qi);
+	const GEN_FLT x183 = x182 + (-1 * x22);
+	const GEN_FLT x185 = x172 + (-1 * x170);
+	const GEN_FLT x186 = x182 + x22;
+	const GEN_FLT x187 = x12 * x155;
+	const GEN_FLT x188 = (-1 * x12 * x177) + (x187 * obj_qi);
+	const GEN_FLT x204 = x181 * x157;
+	const GEN_FLT x205 = (-1 * x180) + x204;
+	const GEN_FLT x206 = x178 + x28;
+	const GEN_FLT x207 = obj_qj * obj_qj * obj_qj;
+	const GEN_FLT x208 = (-1 * x13 * x167) + (x176 * obj_qk);
+	const GEN_FLT x209 = x208 + x166;
+	const GEN_FLT x211 = x180 + (-1 * x204);
+	const GEN_FLT x212 = x13 * x157;
+	const GEN_FLT x214 = (-1 * x12 * x163) + (x187 * obj_qj);
+	const GEN_FLT x230 = x12 * x157;
+	const GEN_FLT x231 = x188 + x28;
+	const GEN_FLT x233 = x214 + x24;
+	const GEN_FLT x235 = obj_qk * obj_qk * obj_qk;
+	const GEN_FLT x251 = 0.523598775598299 + (-1 * tilt_1);
+	const GEN_FLT x252 = cos(x251);
+	const GEN_FLT x253 = 1. / x252;
+	const GEN_FLT x267 = tan(x251);
+	const GEN_FLT x272 = sin(x251);
+	const GEN_FLT c0 = x29 + x27;
+	const GEN_FLT c1 = x25 + x23;
+	const GEN_FLT c2 = x18 + (x20 * x12);
+	const GEN_FLT c3 = x33 + x32;
+	const GEN_FLT c4 = x25 + x31;
+	const GEN_FLT c5 = x18 + (x20 * x13);
+	const GEN_FLT c6 = x18 + (x20 * x14);
+	const GEN_FLT c7 = x33 + x39;
+	const GEN_FLT c8 = x29 + x26;
+	const GEN_FLT c9 = 1. / (x63 * x63);
+	const GEN_FLT c10 = x79 * x79;
+	const GEN_FLT c11 = -1 * gibPhase_0;
+	const GEN_FLT c12 = x173 + x169;
+	const GEN_FLT c13 = x165 + x161;
+	const GEN_FLT c14 = (-1 * x154 * x156) + (x154 * x155) + (2 * x28) + x31;
+	const GEN_FLT c15 = x183 + x162 + (-1 * x179);
+	const GEN_FLT c16 = x178 + x31;
+	const GEN_FLT c17 = x165 + x175;
+	const GEN_FLT c18 = x188 + x31;
+	const GEN_FLT c19 = x186 + (-1 * x162) + x179;
+	const GEN_FLT c20 = x185 + x169;
+	const GEN_FLT c21 = x209 + x185;
+	const GEN_FLT c22 = (x207 * x155) + (-1 * x207 * x156) + (2 * x24) + x27;
+	const GEN_FLT c23 = x206 + x205;
+	const GEN_FLT c24 = x186 + (-1 * x176) + x212;
+	const GEN_FLT c25 = x211 + x206;
+	const GEN_FLT c26 = x164 + x27;
+	const GEN_FLT c27 = x214 + x27;
+	const GEN_FLT c28 = x209 + x173;
+	const GEN_FLT c29 = x183 + x176 + (-1 * x212);
+	const GEN_FLT c30 = x183 + x187 + (-1 * x230);
+	const GEN_FLT c31 = x205 + x231;
+	const GEN_FLT c32 = x168 + x39;
+	const GEN_FLT c33 = x161 + x233;
+	const GEN_FLT c34 = x208 + x39;
+	const GEN_FLT c35 = x186 + (-1 * x187) + x230;
+	const GEN_FLT c36 = (-1 * x235 * x156) + (x235 * x155) + x39 + (2 * x166);
+	const GEN_FLT c37 = x175 + x233;
+	const GEN_FLT c38 = x211 + x231;
+	const GEN_FLT c39 = x267 * x267;
+	const GEN_FLT c40 = 1. / (x252 * x252);
+	const GEN_FLT c41 = -1 * gibPhase_1;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x30 = (c0 * sensor_x) + (c1 * sensor_y) + (c2 * sensor_z) + obj_pz;
+		const GEN_FLT x34 = (c3 * sensor_x) + (c4 * sensor_z) + (c5 * sensor_y) + obj_py;
+		const GEN_FLT x40 = (c6 * sensor_x) + (c7 * sensor_y) + (c8 * sensor_z) + obj_px;
+		const GEN_FLT x42 = (x40 * x41) + (x30 * x11) + (x34 * x38) + lh_px;
+		const GEN_FLT x43 = 1. / x42;
+		const GEN_FLT x48 = (x40 * x10) + (x47 * x34) + (x44 * x30) + lh_pz;
+		const GEN_FLT x49 = x42 * x42;
+		const GEN_FLT x50 = x48 * (1. / x49);
+		const GEN_FLT x51 = x49 + (x48 * x48);
+		const GEN_FLT x52 = 1. / x51;
+		const GEN_FLT x53 = x52 * x49;
+		const GEN_FLT x54 = ((x50 * x41) + (-1 * x43 * x10)) * x53;
+		const GEN_FLT x58 = (x57 * x40) + lh_py + (x56 * x34) + (x55 * x30);
+		const GEN_FLT x59 = x58 * x58;
+		const GEN_FLT x60 = x51 + x59;
+		const GEN_FLT x61 = 1. / sqrt(x60);
+		const GEN_FLT x65 = x64 * x61;
+		const GEN_FLT x66 = asin(x65 * x58);
+		const GEN_FLT x67 = 8.0108022e-06 * x66;
+		const GEN_FLT x68 = -8.0108022e-06 + (-1 * x67);
+		const GEN_FLT x69 = 0.0028679863 + (x68 * x66);
+		const GEN_FLT x70 = 5.3685255e-06 + (x66 * x69);
+		const GEN_FLT x71 = 0.0076069798 + (x70 * x66);
+		const GEN_FLT x72 = x71 * x66;
+		const GEN_FLT x73 = -8.0108022e-06 + (-1.60216044e-05 * x66);
+		const GEN_FLT x74 = x69 + (x73 * x66);
+		const GEN_FLT x75 = x70 + (x74 * x66);
+		const GEN_FLT x76 = x71 + (x75 * x66);
+		const GEN_FLT x77 = (x76 * x66) + x72;
+		const GEN_FLT x78 = 1. / sqrt(x51);
+		const GEN_FLT x80 = x79 * x78;
+		const GEN_FLT x81 = x80 * x58;
+		const GEN_FLT x82 = atan2(-1 * x48, x42);
+		const GEN_FLT x83 = x82 + (-1 * asin(x81)) + ogeeMag_0;
+		const GEN_FLT x84 = (sin(x83) * ogeePhase_0) + curve_0;
+		const GEN_FLT x86 = x84 * x85;
+		const GEN_FLT x87 = x63 + (-1 * x86 * x77);
+		const GEN_FLT x88 = 1. / x87;
+		const GEN_FLT x89 = x66 * x66;
+		const GEN_FLT x90 = x89 * x84;
+		const GEN_FLT x91 = x88 * x90;
+		const GEN_FLT x92 = x81 + (x71 * x91);
+		const GEN_FLT x93 = 1. / sqrt(1 + (-1 * (x92 * x92)));
+		const GEN_FLT x94 = (1. / x60) * x59;
+		const GEN_FLT x95 = 1. / sqrt(1 + (-1 * c9 * x94));
+		const GEN_FLT x96 = 2 * x58;
+		const GEN_FLT x97 = 2 * x42;
+		const GEN_FLT x98 = 2 * x48;
+		const GEN_FLT x99 = (x98 * x10) + (x97 * x41);
+		const GEN_FLT x100 = x99 + (x57 * x96);
+		const GEN_FLT x101 = 1.0 / 2.0 * x58;
+		const GEN_FLT x102 = (1. / (x60 * sqrt(x60))) * x101;
+		const GEN_FLT x103 = x64 * x102;
+		const GEN_FLT x104 = (x65 * x57) + (-1 * x100 * x103);
+		const GEN_FLT x105 = x95 * x104;
+		const GEN_FLT x106 = 2 * x88 * x84 * x72;
+		const GEN_FLT x107 = x68 * x95;
+		const GEN_FLT x108 = x104 * x107;
+		const GEN_FLT x109 = 2.40324066e-05 * x66;
+		const GEN_FLT x110 = (x66 * (x108 + (-1 * x67 * x105))) + (x69 * x105);
+		const GEN_FLT x111 = (x66 * x110) + (x70 * x105);
+		const GEN_FLT x112 = x52 * x59;
+		const GEN_FLT x113 = 1. / sqrt(1 + (-1 * c10 * x112));
+		const GEN_FLT x114 = (1. / (x51 * sqrt(x51))) * x101;
+		const GEN_FLT x115 = x99 * x114;
+		const GEN_FLT x116 = x78 * x57;
+		const GEN_FLT x117 = (x79 * x116) + (-1 * x79 * x115);
+		const GEN_FLT x118 = cos(x83) * ogeePhase_0;
+		const GEN_FLT x119 = x118 * ((-1 * x113 * x117) + x54);
+		const GEN_FLT x120 = x85 * x77;
+		const GEN_FLT x121 = (1. / (x87 * x87)) * x71 * x90;
+		const GEN_FLT x122 = x88 * x89 * x71;
+		const GEN_FLT x123 = x93 * (x117 + (x91 * x111) + (x119 * x122) + (-1 * x121 * ((-1 * x119 * x120) + (-1 * x86
+			* ((x66 * x111) + (x71 * x105) + (x66 * (x111 + (x66 * ((x74 * x105) + x110 + (x66 * ((x73 * x105) + (-1 *
+			x109 * x105) + x108)))) + (x75 * x105))) + (x76 * x105))))) + (x105 * x106));
+		const GEN_FLT x124 = -1 * x54;
+		const GEN_FLT x125 = -1 * x82;
+		const GEN_FLT x126 = cos(x125 + asin(x92) + c11) * gibMag_0;
+		const GEN_FLT x127 = ((x50 * x38) + (-1 * x43 * x47)) * x53;
+		const GEN_FLT x128 = (x98 * x47) + (x97 * x38);
+		const GEN_FLT x129 = x128 + (x56 * x96);
+		const GEN_FLT x130 = (x65 * x56) + (-1 * x103 * x129);
+		const GEN_FLT x131 = x95 * x130;
+		const GEN_FLT x132 = x107 * x130;
+		const GEN_FLT x133 = (x66 * (x132 + (-1 * x67 * x131))) + (x69 * x131);
+		const GEN_FLT x134 = (x66 * x133) + (x70 * x131);
+		const GEN_FLT x135 = x79 * x114;
+		const GEN_FLT x136 = (x80 * x56) + (-1 * x128 * x135);
+		const GEN_FLT x137 = (-1 * x113 * x136) + x127;
+		const GEN_FLT x138 = x118 * x120;
+		const GEN_FLT x139 = x118 * x122;
+		const GEN_FLT x140 = x93 * (x136 + (x137 * x139) + (-1 * x121 * ((-1 * x137 * x138) + (-1 * x86 * ((x66 * x134)
+			+ (x71 * x131) + (x66 * (x134 + (x66 * (x133 + (x74 * x131) + (x66 * ((x73 * x131) + (-1 * x109 * x131) +
+			x132)))) + (x75 * x131))) + (x76 * x131))))) + (x91 * x134) + (x106 * x131));
+		const GEN_FLT x141 = -1 * x127;
+		const GEN_FLT x142 = ((x50 * x11) + (-1 * x43 * x44)) * x53;
+		const GEN_FLT x143 = (x98 * x44) + (x97 * x11);
+		const GEN_FLT x144 = x143 + (x55 * x96);
+		const GEN_FLT x145 = (x65 * x55) + (-1 * x103 * x144);
+		const GEN_FLT x146 = x95 * x145;
+		const GEN_FLT x147 = (x80 * x55) + (-1 * x135 * x143);
+		const GEN_FLT x148 = (-1 * x113 * x147) + x142;
+		const GEN_FLT x149 = x107 * x145;
+		const GEN_FLT x150 = (x66 * (x149 + (-1 * x67 * x146))) + (x69 * x146);
+		const GEN_FLT x151 = (x66 * x150) + (x70 * x146);
+		const GEN_FLT x152 = x93 * (x147 + (-1 * x121 * ((-1 * x138 * x148) + (-1 * x86 * ((x66 * x151) + (x71 * x146)
+			+ (x66 * (x151 + (x66 * (x150 + (x74 * x146) + (x66 * ((x73 * x146) + (-1 * x109 * x146) + x149)))) + (x75
+			* x146))) + (x76 * x146))))) + (x91 * x151) + (x139 * x148) + (x106 * x146));
+		const GEN_FLT x153 = -1 * x142;
+		const GEN_FLT x174 = (c12 * sensor_z) + (c13 * sensor_y) + (c14 * sensor_x);
+		const GEN_FLT x184 = (c15 * sensor_z) + (c16 * sensor_y) + (c17 * sensor_x);
+		const GEN_FLT x189 = (c18 * sensor_z) + (c19 * sensor_y) + (c20 * sensor_x);
+		const GEN_FLT x190 = (x47 * x184) + (x44 * x189) + (x10 * x174);
+		const GEN_FLT x191 = (x11 * x189) + (x38 * x184) + (x41 * x174);
+		const GEN_FLT x192 = ((x50 * x191) + (-1 * x43 * x190)) * x53;
+		const GEN_FLT x193 = (x55 * x189) + (x56 * x184) + (x57 * x174);
+		const GEN_FLT x194 = (x98 * x190) + (x97 * x191);
+		const GEN_FLT x195 = x194 + (x96 * x193);
+		const GEN_FLT x196 = x95 * ((x65 * x193) + (-1 * x103 * x195));
+		const GEN_FLT x197 = x68 * x196;
+		const GEN_FLT x198 = (x66 * (x197 + (-1 * x67 * x196))) + (x69 * x196);
+		const GEN_FLT x199 = (x66 * x198) + (x70 * x196);
+		const GEN_FLT x200 = (x80 * x193) + (-1 * x194 * x135);
+		const GEN_FLT x201 = (-1 * x200 * x113) + x192;
+		const GEN_FLT x202 = x93 * (x200 + (x91 * x199) + (x201 * x139) + (-1 * x121 * ((-1 * x201 * x138) + (-1 * x86
+			* ((x71 * x196) + (x66 * (x199 + (x66 * (x198 + (x74 * x196) + (x66 * ((x73 * x196) + (-1 * x109 * x196) +
+			x197)))) + (x75 * x196))) + (x66 * x199) + (x76 * x196))))) + (x106 * x196));
+		const GEN_FLT x203 = -1 * x192;
+		const GEN_FLT x210 = (c21 * sensor_z) + (c22 * sensor_y) + (c23 * sensor_x);
+		const GEN_FLT x213 = (c24 * sensor_z) + (c25 * sensor_y) + (c26 * sensor_x);
+		const GEN_FLT x215 = (c27 * sensor_z) + (c28 * sensor_y) + (c29 * sensor_x);
+		const GEN_FLT x216 = (x44 * x215) + (x10 * x213) + (x47 * x210);
+		const GEN_FLT x217 = (x11 * x215) + (x38 * x210) + (x41 * x213);
+		const GEN_FLT x218 = ((x50 * x217) + (-1 * x43 * x216)) * x53;
+		const GEN_FLT x219 = (x55 * x215) + (x56 * x210) + (x57 * x213);
+		const GEN_FLT x220 = (x98 * x216) + (x97 * x217);
+		const GEN_FLT x221 = x220 + (x96 * x219);
+		const GEN_FLT x222 = x95 * ((x65 * x219) + (-1 * x221 * x103));
+		const GEN_FLT x223 = x68 * x222;
+		const GEN_FLT x224 = (x66 * (x223 + (-1 * x67 * x222))) + (x69 * x222);
+		const GEN_FLT x225 = (x66 * x224) + (x70 * x222);
+		const GEN_FLT x226 = (x80 * x219) + (-1 * x220 * x135);
+		const GEN_FLT x227 = (-1 * x226 * x113) + x218;
+		const GEN_FLT x228 = x93 * (x226 + (x91 * x225) + (-1 * x121 * ((-1 * x227 * x138) + (-1 * x86 * ((x66 * x225)
+			+ (x71 * x222) + (x66 * (x225 + (x66 * (x224 + (x74 * x222) + (x66 * ((x73 * x222) + (-1 * x222 * x109) +
+			x223)))) + (x75 * x222))) + (x76 * x222))))) + (x227 * x139) + (x222 * x106));
+		const GEN_FLT x229 = -1 * x218;
+		const GEN_FLT x232 = (c30 * sensor_y) + (c31 * sensor_z) + (c32 * sensor_x);
+		const GEN_FLT x234 = (c33 * sensor_z) + (c34 * sensor_y) + (c35 * sensor_x);
+		const GEN_FLT x236 = (c36 * sensor_z) + (c37 * sensor_y) + (c38 * sensor_x);
+		const GEN_FLT x237 = (x44 * x236) + (x47 * x234) + (x10 * x232);
+		const GEN_FLT x238 = (x11 * x236) + (x38 * x234) + (x41 * x232);
+		const GEN_FLT x239 = ((x50 * x238) + (-1 * x43 * x237)) * x53;
+		const GEN_FLT x240 = (x55 * x236) + (x56 * x234) + (x57 * x232);
+		const GEN_FLT x241 = (x98 * x237) + (x97 * x238);
+		const GEN_FLT x242 = x241 + (x96 * x240);
+		const GEN_FLT x243 = x95 * ((x65 * x240) + (-1 * x242 * x103));
+		const GEN_FLT x244 = x68 * x243;
+		const GEN_FLT x245 = (x66 * (x244 + (-1 * x67 * x243))) + (x69 * x243);
+		const GEN_FLT x246 = (x66 * x245) + (x70 * x243);
+		const GEN_FLT x247 = (x80 * x240) + (-1 * x241 * x135);
+		const GEN_FLT x248 = (-1 * x247 * x113) + x239;
+		const GEN_FLT x249 = x93 * ((x91 * x246) + x247 + (x248 * x139) + (-1 * x121 * ((-1 * x248 * x138) + (-1 * x86
+			* ((x71 * x243) + (x66 * (x246 + (x66 * (x245 + (x74 * x243) + (x66 * ((x73 * x243) + (-1 * x243 * x109) +
+			x244)))) + (x75 * x243))) + (x66 * x246) + (x76 * x243))))) + (x243 * x106));
+		const GEN_FLT x250 = -1 * x239;
+		const GEN_FLT x254 = x61 * x253;
+		const GEN_FLT x255 = asin(x58 * x254);
+		const GEN_FLT x256 = 8.0108022e-06 * x255;
+		const GEN_FLT x257 = -8.0108022e-06 + (-1 * x256);
+		const GEN_FLT x258 = 0.0028679863 + (x255 * x257);
+		const GEN_FLT x259 = 5.3685255e-06 + (x255 * x258);
+		const GEN_FLT x260 = 0.0076069798 + (x255 * x259);
+		const GEN_FLT x261 = x260 * x255;
+		const GEN_FLT x262 = -8.0108022e-06 + (-1.60216044e-05 * x255);
+		const GEN_FLT x263 = x258 + (x262 * x255);
+		const GEN_FLT x264 = x259 + (x263 * x255);
+		const GEN_FLT x265 = x260 + (x264 * x255);
+		const GEN_FLT x266 = (x265 * x255) + x261;
+		const GEN_FLT x268 = x78 * x267;
+		const GEN_FLT x269 = -1 * x58 * x268;
+		const GEN_FLT x270 = x82 + ogeeMag_1 + (-1 * asin(x269));
+		const GEN_FLT x271 = (sin(x270) * ogeePhase_1) + curve_1;
+		const GEN_FLT x273 = x272 * x271;
+		const GEN_FLT x274 = x252 + (x273 * x266);
+		const GEN_FLT x275 = 1. / x274;
+		const GEN_FLT x276 = x255 * x255;
+		const GEN_FLT x277 = x276 * x271;
+		const GEN_FLT x278 = x277 * x275;
+		const GEN_FLT x279 = x269 + (x278 * x260);
+		const GEN_FLT x280 = 1. / sqrt(1 + (-1 * (x279 * x279)));
+		const GEN_FLT x281 = 1. / sqrt(1 + (-1 * c39 * x112));
+		const GEN_FLT x282 = (-1 * x267 * x116) + (x267 * x115);
+		const GEN_FLT x283 = cos(x270) * ogeePhase_1;
+		const GEN_FLT x284 = x283 * ((-1 * x282 * x281) + x54);
+		const GEN_FLT x285 = x276 * x275 * x260;
+		const GEN_FLT x286 = 1. / sqrt(1 + (-1 * x94 * c40));
+		const GEN_FLT x287 = x253 * x102;
+		const GEN_FLT x288 = x286 * ((x57 * x254) + (-1 * x287 * x100));
+		const GEN_FLT x289 = 2 * x275 * x271 * x261;
+		const GEN_FLT x290 = x288 * x257;
+		const GEN_FLT x291 = (x288 * x258) + (x255 * (x290 + (-1 * x288 * x256)));
+		const GEN_FLT x292 = (x288 * x259) + (x291 * x255);
+		const GEN_FLT x293 = x272 * x266;
+		const GEN_FLT x294 = 2.40324066e-05 * x255;
+		const GEN_FLT x295 = x277 * (1. / (x274 * x274)) * x260;
+		const GEN_FLT x296 = x280 * (x282 + (-1 * x295 * ((x273 * ((x292 * x255) + (x260 * x288) + (x255 * (x292 +
+			(x255 * (x291 + (x263 * x288) + (x255 * ((x262 * x288) + (-1 * x294 * x288) + x290)))) + (x264 * x288))) +
+			(x265 * x288))) + (x293 * x284))) + (x278 * x292) + (x288 * x289) + (x284 * x285));
+		const GEN_FLT x297 = cos(x125 + asin(x279) + c41) * gibMag_1;
+		const GEN_FLT x298 = x267 * x114;
+		const GEN_FLT x299 = (-1 * x56 * x268) + (x298 * x128);
+		const GEN_FLT x300 = (-1 * x299 * x281) + x127;
+		const GEN_FLT x301 = x283 * x285;
+		const GEN_FLT x302 = x286 * ((x56 * x254) + (-1 * x287 * x129));
+		const GEN_FLT x303 = x257 * x302;
+		const GEN_FLT x304 = (x258 * x302) + (x255 * (x303 + (-1 * x256 * x302)));
+		const GEN_FLT x305 = (x259 * x302) + (x255 * x304);
+		const GEN_FLT x306 = x293 * x283;
+		const GEN_FLT x307 = x280 * (x299 + (-1 * x295 * ((x273 * ((x255 * x305) + (x260 * x302) + (x255 * (x305 +
+			(x255 * (x304 + (x263 * x302) + (x255 * ((x262 * x302) + (-1 * x294 * x302) + x303)))) + (x264 * x302))) +
+			(x265 * x302))) + (x300 * x306))) + (x289 * x302) + (x278 * x305) + (x301 * x300));
+		const GEN_FLT x308 = (-1 * x55 * x268) + (x298 * x143);
+		const GEN_FLT x309 = (-1 * x281 * x308) + x142;
+		const GEN_FLT x310 = (x55 * x254) + (-1 * x287 * x144);
+		const GEN_FLT x311 = x265 * x286;
+		const GEN_FLT x312 = x286 * x310;
+		const GEN_FLT x313 = x257 * x312;
+		const GEN_FLT x314 = (x258 * x312) + (x255 * (x313 + (-1 * x256 * x312)));
+		const GEN_FLT x315 = (x259 * x312) + (x255 * x314);
+		const GEN_FLT x316 = x280 * ((x278 * x315) + x308 + (x289 * x312) + (-1 * x295 * ((x273 * ((x255 * x315) +
+			(x260 * x312) + (x255 * (x315 + (x255 * (x314 + (x263 * x312) + (x255 * ((x262 * x312) + (-1 * x294 * x312)
+			+ x313)))) + (x264 * x312))) + (x311 * x310))) + (x309 * x306))) + (x309 * x301));
+		const GEN_FLT x317 = (-1 * x268 * x193) + (x298 * x194);
+		const GEN_FLT x318 = (-1 * x281 * x317) + x192;
+		const GEN_FLT x319 = (x254 * x193) + (-1 * x287 * x195);
+		const GEN_FLT x320 = x286 * x319;
+		const GEN_FLT x321 = x257 * x320;
+		const GEN_FLT x322 = (x258 * x320) + (x255 * (x321 + (-1 * x256 * x320)));
+		const GEN_FLT x323 = (x259 * x320) + (x255 * x322);
+		const GEN_FLT x324 = x280 * (x317 + (-1 * x295 * ((x273 * ((x255 * x323) + (x255 * (x323 + (x255 * (x322 +
+			(x263 * x320) + (x255 * ((x262 * x320) + (-1 * x294 * x320) + x321)))) + (x264 * x320))) + (x260 * x320) +
+			(x311 * x319))) + (x306 * x318))) + (x278 * x323) + (x289 * x320) + (x301 * x318));
+		const GEN_FLT x325 = (-1 * x219 * x268) + (x298 * x220);
+		const GEN_FLT x326 = (-1 * x281 * x325) + x218;
+		const GEN_FLT x327 = (x219 * x254) + (-1 * x287 * x221);
+		const GEN_FLT x328 = x286 * x327;
+		const GEN_FLT x329 = x257 * x328;
+		const GEN_FLT x330 = (x258 * x328) + (x255 * (x329 + (-1 * x256 * x328)));
+		const GEN_FLT x331 = (x259 * x328) + (x255 * x330);
+		const GEN_FLT x332 = x280 * ((-1 * x295 * ((x273 * ((x255 * x331) + (x260 * x328) + (x255 * (x331 + (x255 *
+			(x330 + (x263 * x328) + (x255 * ((x262 * x328) + (-1 * x294 * x328) + x329)))) + (x264 * x328))) + (x327 *
+			x311))) + (x306 * x326))) + x325 + (x278 * x331) + (x289 * x328) + (x301 * x326));
+		const GEN_FLT x333 = (-1 * x268 * x240) + (x298 * x241);
+		const GEN_FLT x334 = (-1 * x281 * x333) + x239;
+		const GEN_FLT x335 = ((x254 * x240) + (-1 * x287 * x242)) * x286;
+		const GEN_FLT x336 = x257 * x335;
+		const GEN_FLT x337 = (x258 * x335) + (x255 * (x336 + (-1 * x256 * x335)));
+		const GEN_FLT x338 = (x259 * x335) + (x255 * x337);
+		const GEN_FLT x339 = x280 * ((x278 * x338) + x333 + (-1 * x295 * ((x273 * ((x255 * x338) + (x260 * x335) +
+			(x255 * (x338 + (x255 * (x337 + (x263 * x335) + (x255 * ((x262 * x335) + (-1 * x294 * x335) + x336)))) +
+			(x264 * x335))) + (x265 * x335))) + (x306 * x334))) + (x289 * x335) + (x301 * x334));
+		out[i] = (-1 * (x123 + x124) * x126) + (-1 * x123) + x54;
+		out[n + i] = (-1 * (x140 + x141) * x126) + (-1 * x140) + x127;
+		out[2 * n + i] = (-1 * (x152 + x153) * x126) + (-1 * x152) + x142;
+		out[3 * n + i] = (-1 * (x202 + x203) * x126) + (-1 * x202) + x192;
+		out[4 * n + i] = (-1 * x228) + (-1 * (x228 + x229) * x126) + x218;
+		out[5 * n + i] = (-1 * (x249 + x250) * x126) + (-1 * x249) + x239;
+		out[6 * n + i] = (-1 * x296) + (-1 * (x296 + x124) * x297) + x54;
+		out[7 * n + i] = (-1 * x307) + (-1 * (x307 + x141) * x297) + x127;
+		out[8 * n + i] = (-1 * x316) + (-1 * (x316 + x153) * x297) + x142;
+		out[9 * n + i] = (-1 * x324) + (-1 * (x324 + x203) * x297) + x192;
+		out[10 * n + i] = (-1 * x332) + (-1 * (x332 + x229) * x297) + x218;
+		out[11 * n + i] = (-1 * x339) + (-1 * (x339 + x250) * x297) + x239;
+	}
+}
+
+static inline void gen_reproject_axis_x_gen2_axis_angle_batch(FLT *GEN_RESTRICT out, size_t n,
+															  const LinmathAxisAnglePose *obj_p,
+															  const FLT *GEN_RESTRICT sensor_pt,
+															  const LinmathAxisAnglePose *lh_p,
+															  const BaseStationCal *bsc0) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_0 = (*bsc0).phase;
+	const GEN_FLT tilt_0 = (*bsc0).tilt;
+	const GEN_FLT curve_0 = (*bsc0).curve;
+	const GEN_FLT gibPhase_0 = (*bsc0).gibpha;
+	const GEN_FLT gibMag_0 = (*bsc0).gibmag;
+	const GEN_FLT ogeeMag_0 = (*bsc0).ogeephase;
+	const GEN_FLT ogeePhase_0 = (*bsc0).ogeemag;
+	const GEN_FLT x0 = lh_qk * lh_qk;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qi * lh_qi;
+	const GEN_FLT x3 = 1e-10 + x2 + x1 + x0;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = (1. / x4) * sin(x4);
+	const GEN_FLT x6 = x5 * lh_qi;
+	const GEN_FLT x7 = cos(x4);
+	const GEN_FLT x8 = (1. / x3) * (1 + (-1 * x7));
+	const GEN_FLT x9 = x8 * lh_qj;
+	const GEN_FLT x10 = x9 * lh_qk;
+	const GEN_FLT x11 = obj_qk * obj_qk;
+	const GEN_FLT x12 = obj_qj * obj_qj;
+	const GEN_FLT x13 = obj_qi * obj_qi;
+	const GEN_FLT x14 = 1e-10 + x13 + x12 + x11;
+	const GEN_FLT x15 = sqrt(x14);
+	const GEN_FLT x16 = cos(x15);
+	const GEN_FLT x17 = (1. / x14) * (1 + (-1 * x16));
+	const GEN_FLT x18 = (1. / x15) * sin(x15);
+	const GEN_FLT x19 = x18 * obj_qi;
+	const GEN_FLT x20 = x17 * obj_qk;
+	const GEN_FLT x21 = x20 * obj_qj;
+	const GEN_FLT x22 = x18 * obj_qj;
+	const GEN_FLT x23 = x20 * obj_qi;
+	const GEN_FLT x25 = x18 * obj_qk;
+	const GEN_FLT x26 = x17 * obj_qj * obj_qi;
+	const GEN_FLT x29 = x5 * lh_qk;
+	const GEN_FLT x30 = x9 * lh_qi;
+	const GEN_FLT x32 = 0.523598775598299 + tilt_0;
+	const GEN_FLT x33 = cos(x32);
+	const GEN_FLT x34 = x5 * lh_qj;
+	const GEN_FLT x35 = x8 * lh_qk * lh_qi;
+	const GEN_FLT c0 = x21 + x19;
+	const GEN_FLT c1 = x23 + (-1 * x22);
+	const GEN_FLT c2 = x16 + (x11 * x17);
+	const GEN_FLT c3 = x26 + x25;
+	const GEN_FLT c4 = x16 + (x12 * x17);
+	const GEN_FLT c5 = x21 + (-1 * x19);
+	const GEN_FLT c6 = x26 + (-1 * x25);
+	const GEN_FLT c7 = x23 + x22;
+	const GEN_FLT c8 = x16 + (x13 * x17);
+	const GEN_FLT c9 = x30 + x29;
+	const GEN_FLT c10 = x7 + (x1 * x8);
+	const GEN_FLT c11 = x10 + (-1 * x6);
+	const GEN_FLT c12 = x35 + (-1 * x34);
+	const GEN_FLT c13 = x10 + x6;
+	const GEN_FLT c14 = x7 + (x0 * x8);
+	const GEN_FLT c15 = x30 + (-1 * x29);
+	const GEN_FLT c16 = x35 + x34;
+	const GEN_FLT c17 = x7 + (x2 * x8);
+	const GEN_FLT c18 = 1. / x33;
+	const GEN_FLT c19 = tan(x32);
+	const GEN_FLT c20 = sin(x32);
+	const GEN_FLT c21 = -1 * phase_0;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x24 = (c0 * sensor_y) + (c1 * sensor_x) + (c2 * sensor_z) + obj_pz;
+		const GEN_FLT x27 = (c3 * sensor_x) + (c4 * sensor_y) + (c5 * sensor_z) + obj_py;
+		const GEN_FLT x28 = (c6 * sensor_y) + (c7 * sensor_z) + (c8 * sensor_x) + obj_px;
+		const GEN_FLT x31 = lh_py + (c9 * x28) + (x27 * c10) + (x24 * c11);
+		const GEN_FLT x36 = (c12 * x28) + (x27 * c13) + (x24 * c14) + lh_pz;
+		const GEN_FLT x37 = (c15 * x27) + (c16 * x24) + (x28 * c17) + lh_px;
+		const GEN_FLT x38 = (x37 * x37) + (x36 * x36);
+		const GEN_FLT x39 = asin(x31 * c18 * (1. / sqrt(x38 + (x31 * x31))));
+		const GEN_FLT x40 = 0.0028679863 + (x39 * (-8.0108022e-06 + (-8.0108022e-06 * x39)));
+		const GEN_FLT x41 = 5.3685255e-06 + (x40 * x39);
+		const GEN_FLT x42 = 0.0076069798 + (x41 * x39);
+		const GEN_FLT x43 = x31 * (1. / sqrt(x38)) * c19;
+		const GEN_FLT x44 = atan2(-1 * x36, x37);
+		const GEN_FLT x45 = (sin(x44 + (-1 * asin(x43)) + ogeeMag_0) * ogeePhase_0) + curve_0;
+		const GEN_FLT x46 = asin(x43 + (x42 * x45 * (x39 * x39) * (1. / (x33 + (-1 * x45 * c20 * ((x39 * (x42 + (x39 *
+			(x41 + (x39 * (x40 + (x39 * (-8.0108022e-06 + (-1.60216044e-05 * x39))))))))) + (x42 * x39)))))));
+		out[i] = -1.5707963267949 + x44 + (-1 * x46) + (sin(x44 + (-1 * x46) + gibPhase_0) * gibMag_0) + c21;
+	}
+}
+
+// Jacobian of reproject_axis_x_gen2 wrt [obj_px, obj_py, obj_pz, obj_qi, obj_qj, obj_qk]
+static inline void gen_reproject_axis_x_gen2_jac_obj_p_axis_angle_batch(FLT *GEN_RESTRICT out, size_t n,
+																		const LinmathAxisAnglePose *obj_p,
+																		const FLT *GEN_RESTRICT sensor_pt,
+																		const LinmathAxisAnglePose *lh_p,
+																		const BaseStationCal *bsc0) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_0 = (*bsc0).phase;
+	const GEN_FLT tilt_0 = (*bsc0).tilt;
+	const GEN_FLT curve_0 = (*bsc0).curve;
+	const GEN_FLT gibPhase_0 = (*bsc0).gibpha;
+	const GEN_FLT gibMag_0 = (*bsc0).gibmag;
+	const GEN_FLT ogeeMag_0 = (*bsc0).ogeephase;
+	const GEN_FLT ogeePhase_0 = (*bsc0).ogeemag;
+	const GEN_FLT x0 = lh_qk * lh_qk;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qi * lh_qi;
+	const GEN_FLT x3 = 1e-10 + x2 + x1 + x0;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = (1. / x4) * sin(x4);
+	const GEN_FLT x6 = x5 * lh_qj;
+	const GEN_FLT x7 = cos(x4);
+	const GEN_FLT x8 = (1. / x3) * (1 + (-1 * x7));
+	const GEN_FLT x9 = x8 * lh_qk * lh_qi;
+	const GEN_FLT x10 = x9 + (-1 * x6);
+	const GEN_FLT x11 = x9 + x6;
+	const GEN_FLT x12 = obj_qk * obj_qk;
+	const GEN_FLT x13 = obj_qj * obj_qj;
+	const GEN_FLT x14 = obj_qi * obj_qi;
+	const GEN_FLT x15 = 1e-10 + x14 + x13 + x12;
+	const GEN_FLT x16 = 1. / x15;
+	const GEN_FLT x17 = sqrt(x15);
+	const GEN_FLT x18 = cos(x17);
+	const GEN_FLT x19 = 1 + (-1 * x18);
+	const GEN_FLT x20 = x19 * x16;
+	const GEN_FLT x21 = sin(x17);
+	const GEN_FLT x22 = x21 * (1. / x17);
+	const GEN_FLT x23 = x22 * obj_qi;
+	const GEN_FLT x24 = x20 * obj_qk;
+	const GEN_FLT x25 = x24 * obj_qj;
+	const GEN_FLT x26 = x22 * obj_qj;
+	const GEN_FLT x27 = -1 * x26;
+	const GEN_FLT x28 = x24 * obj_qi;
+	const GEN_FLT x30 = -1 * x23;
+	const GEN_FLT x31 = x22 * obj_qk;
+	const GEN_FLT x32 = x20 * obj_qi;
+	const GEN_FLT x33 = x32 * obj_qj;
+	const GEN_FLT x35 = x5 * lh_qk;
+	const GEN_FLT x36 = x8 * lh_qj;
+	const GEN_FLT x37 = x36 * lh_qi;
+	const GEN_FLT x38 = x37 + (-1 * x35);
+	const GEN_FLT x39 = -1 * x31;
+	const GEN_FLT x41 = x7 + (x2 * x8);
+	const GEN_FLT x44 = x7 + (x0 * x8);
+	const GEN_FLT x45 = x5 * lh_qi;
+	const GEN_FLT x46 = x36 * lh_qk;
+	const GEN_FLT x47 = x46 + x45;
+	const GEN_FLT x55 = x46 + (-1 * x45);
+	const GEN_FLT x56 = x7 + (x1 * x8);
+	const GEN_FLT x57 = x37 + x35;
+	const GEN_FLT x59 = 0.523598775598299 + tilt_0;
+	const GEN_FLT x60 = cos(x59);
+	const GEN_FLT x61 = 1. / x60;
+	const GEN_FLT x77 = tan(x59);
+	const GEN_FLT x83 = sin(x59);
+	const GEN_FLT x135 = obj_qi * obj_qi * obj_qi;
+	const GEN_FLT x136 = x21 * (1. / (x15 * sqrt(x15)));
+	const GEN_FLT x137 = 2 * (1. / (x15 * x15)) * x19;
+	const GEN_FLT x138 = x18 * x16;
+	const GEN_FLT x139 = x138 * obj_qk;
+	const GEN_FLT x140 = x139 * obj_qi;
+	const GEN_FLT x141 = x136 * obj_qk;
+	const GEN_FLT x142 = x141 * obj_qi;
+	const GEN_FLT x143 = x142 + (-1 * x140);
+	const GEN_FLT x144 = x20 * obj_qj;
+	const GEN_FLT x145 = x14 * x136;
+	const GEN_FLT x146 = x14 * x137;
+	const GEN_FLT x147 = (-1 * x146 * obj_qj) + (x145 * obj_qj);
+	const GEN_FLT x148 = x147 + x144;
+	const GEN_FLT x149 = (-1 * x146 * obj_qk) + (x145 * obj_qk);
+	const GEN_FLT x150 = x149 + x24;
+	const GEN_FLT x151 = obj_qj * obj_qi;
+	const GEN_FLT x152 = x138 * x151;
+	const GEN_FLT x153 = x136 * x151;
+	const GEN_FLT x154 = (-1 * x153) + x152;
+	const GEN_FLT x156 = (-1 * x142) + x140;
+	const GEN_FLT x157 = x13 * x136;
+	const GEN_FLT x158 = x137 * obj_qi;
+	const GEN_FLT x159 = (-1 * x13 * x158) + (x157 * obj_qi);
+	const GEN_FLT x160 = x14 * x138;
+	const GEN_FLT x161 = x137 * obj_qk;
+	const GEN_FLT x162 = (-1 * x161 * x151) + (x153 * obj_qk);
+	const GEN_FLT x163 = x162 + (-1 * x22);
+	const GEN_FLT x165 = x153 + (-1 * x152);
+	const GEN_FLT x166 = x162 + x22;
+	const GEN_FLT x167 = x12 * x136;
+	const GEN_FLT x168 = (-1 * x12 * x158) + (x167 * obj_qi);
+	const GEN_FLT x182 = x159 + x32;
+	const GEN_FLT x183 = x139 * obj_qj;
+	const GEN_FLT x184 = x141 * obj_qj;
+	const GEN_FLT x185 = (-1 * x184) + x183;
+	const GEN_FLT x186 = obj_qj * obj_qj * obj_qj;
+	const GEN_FLT x187 = (-1 * x13 * x161) + (x157 * obj_qk);
+	const GEN_FLT x188 = x187 + x24;
+	const GEN_FLT x190 = x184 + (-1 * x183);
+	const GEN_FLT x191 = x13 * x138;
+	const GEN_FLT x193 = (-1 * x12 * x137 * obj_qj) + (x167 * obj_qj);
+	const GEN_FLT x207 = x12 * x138;
+	const GEN_FLT x208 = x168 + x32;
+	const GEN_FLT x210 = x193 + x144;
+	const GEN_FLT x212 = obj_qk * obj_qk * obj_qk;
+	const GEN_FLT c0 = x28 + x27;
+	const GEN_FLT c1 = x25 + x23;
+	const GEN_FLT c2 = x18 + (x20 * x12);
+	const GEN_FLT c3 = x33 + x31;
+	const GEN_FLT c4 = x25 + x30;
+	const GEN_FLT c5 = x18 + (x20 * x13);
+	const GEN_FLT c6 = x18 + (x20 * x14);
+	const GEN_FLT c7 = x33 + x39;
+	const GEN_FLT c8 = x28 + x26;
+	const GEN_FLT c9 = 1. / (x60 * x60);
+	const GEN_FLT c10 = x77 * x77;
+	const GEN_FLT c11 = x154 + x150;
+	const GEN_FLT c12 = x148 + x143;
+	const GEN_FLT c13 = (-1 * x137 * x135) + (x135 * x136) + (2 * x32) + x30;
+	const GEN_FLT c14 = x163 + x145 + (-1 * x160);
+	const GEN_FLT c15 = x159 + x30;
+	const GEN_FLT c16 = x148 + x156;
+	const GEN_FLT c17 = x168 + x30;
+	const GEN_FLT c18 = x166 + (-1 * x145) + x160;
+	const GEN_FLT c19 = x150 + x165;
+	const GEN_FLT c20 = x165 + x188;
+	const GEN_FLT c21 = (-1 * x186 * x137) + (x186 * x136) + (2 * x144) + x27;
+	const GEN_FLT c22 = x185 + x182;
+	const GEN_FLT c23 = x166 + (-1 * x157) + x191;
+	const GEN_FLT c24 = x190 + x182;
+	const GEN_FLT c25 = x147 + x27;
+	const GEN_FLT c26 = x154 + x188;
+	const GEN_FLT c27 = x193 + x27;
+	const GEN_FLT c28 = x163 + x157 + (-1 * x191);
+	const GEN_FLT c29 = x208 + x185;
+	const GEN_FLT c30 = x163 + x167 + (-1 * x207);
+	const GEN_FLT c31 = x149 + x39;
+	const GEN_FLT c32 = x143 + x210;
+	const GEN_FLT c33 = x187 + x39;
+	const GEN_FLT c34 = x166 + (-1 * x167) + x207;
+	const GEN_FLT c35 = (-1 * x212 * x137) + x39 + (x212 * x136) + (2 * x24);
+	const GEN_FLT c36 = x156 + x210;
+	const GEN_FLT c37 = x208 + x190;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x29 = (c0 * sensor_x) + (c1 * sensor_y) + (c2 * sensor_z) + obj_pz;
+		const GEN_FLT x34 = (c3 * sensor_x) + (c4 * sensor_z) + (c5 * sensor_y) + obj_py;
+		const GEN_FLT x40 = (c6 * sensor_x) + (c7 * sensor_y) + (c8 * sensor_z) + obj_px;
+		const GEN_FLT x42 = (x40 * x41) + (x29 * x11) + (x34 * x38) + lh_px;
+		const GEN_FLT x43 = 1. / x42;
+		const GEN_FLT x48 = (x40 * x10) + (x44 * x29) + (x47 * x34) + lh_pz;
+		const GEN_FLT x49 = x42 * x42;
+		const GEN_FLT x50 = x48 * (1. / x49);
+		const GEN_FLT x51 = x49 + (x48 * x48);
+		const GEN_FLT x52 = 1. / x51;
+		const GEN_FLT x53 = x52 * x49;
+		const GEN_FLT x54 = ((x50 * x41) + (-1 * x43 * x10)) * x53;
+		const GEN_FLT x58 = (x57 * x40) + lh_py + (x56 * x34) + (x55 * x29);
+		const GEN_FLT x62 = x58 * x58;
+		const GEN_FLT x63 = x51 + x62;
+		const GEN_FLT x64 = (1. / sqrt(x63)) * x61;
+		const GEN_FLT x65 = asin(x64 * x58);
+		const GEN_FLT x66 = 8.0108022e-06 * x65;
+		const GEN_FLT x67 = -8.0108022e-06 + (-1 * x66);
+		const GEN_FLT x68 = 0.0028679863 + (x67 * x65);
+		const GEN_FLT x69 = 5.3685255e-06 + (x68 * x65);
+		const GEN_FLT x70 = 0.0076069798 + (x65 * x69);
+		const GEN_FLT x71 = x70 * x65;
+		const GEN_FLT x72 = -8.0108022e-06 + (-1.60216044e-05 * x65);
+		const GEN_FLT x73 = x68 + (x72 * x65);
+		const GEN_FLT x74 = x69 + (x73 * x65);
+		const GEN_FLT x75 = x70 + (x74 * x65);
+		const GEN_FLT x76 = (x75 * x65) + x71;
+		const GEN_FLT x78 = x77 * (1. / sqrt(x51));
+		const GEN_FLT x79 = x78 * x58;
+		const GEN_FLT x80 = atan2(-1 * x48, x42);
+		const GEN_FLT x81 = x80 + (-1 * asin(x79)) + ogeeMag_0;
+		const GEN_FLT x82 = (sin(x81) * ogeePhase_0) + curve_0;
+		const GEN_FLT x84 = x82 * x83;
+		const GEN_FLT x85 = x60 + (-1 * x84 * x76);
+		const GEN_FLT x86 = 1. / x85;
+		const GEN_FLT x87 = x65 * x65;
+		const GEN_FLT x88 = x82 * x87;
+		const GEN_FLT x89 = x88 * x86;
+		const GEN_FLT x90 = x79 + (x89 * x70);
+		const GEN_FLT x91 = 1. / sqrt(1 + (-1 * (x90 * x90)));
+		const GEN_FLT x92 = 1. / sqrt(1 + (-1 * c9 * (1. / x63) * x62));
+		const GEN_FLT x93 = 2 * x58;
+		const GEN_FLT x94 = 2 * x42;
+		const GEN_FLT x95 = 2 * x48;
+		const GEN_FLT x96 = (x95 * x10) + (x94 * x41);
+		const GEN_FLT x97 = 1.0 / 2.0 * x58;
+		const GEN_FLT x98 = (1. / (x63 * sqrt(x63))) * x61 * x97;
+		const GEN_FLT x99 = x92 * ((x64 * x57) + (-1 * x98 * (x96 + (x57 * x93))));
+		const GEN_FLT x100 = 2 * x82 * x86 * x71;
+		const GEN_FLT x101 = x67 * x99;
+		const GEN_FLT x102 = 2.40324066e-05 * x65;
+		const GEN_FLT x103 = (x65 * (x101 + (-1 * x66 * x99))) + (x68 * x99);
+		const GEN_FLT x104 = (x65 * x103) + (x69 * x99);
+		const GEN_FLT x105 = 1. / sqrt(1 + (-1 * c10 * x62 * x52));
+		const GEN_FLT x106 = x77 * (1. / (x51 * sqrt(x51))) * x97;
+		const GEN_FLT x107 = (x78 * x57) + (-1 * x96 * x106);
+		const GEN_FLT x108 = cos(x81) * ogeePhase_0;
+		const GEN_FLT x109 = x108 * ((-1 * x105 * x107) + x54);
+		const GEN_FLT x110 = x83 * x76;
+		const GEN_FLT x111 = x88 * (1. / (x85 * x85)) * x70;
+		const GEN_FLT x112 = x86 * x87 * x70;
+		const GEN_FLT x113 = x91 * (x107 + (x89 * x104) + (x109 * x112) + (-1 * x111 * ((-1 * x109 * x110) + (-1 * x84
+			* ((x65 * x104) + (x70 * x99) + (x65 * (x104 + (x65 * (x103 + (x73 * x99) + (x65 * ((x72 * x99) + (-1 * x99
+			* x102) + x101)))) + (x74 * x99))) + (x75 * x99))))) + (x99 * x100));
+		const GEN_FLT x114 = cos(x80 + (-1 * asin(x90)) + gibPhase_0) * gibMag_0;
+		const GEN_FLT x115 = ((x50 * x38) + (-1 * x43 * x47)) * x53;
+		const GEN_FLT x116 = (x95 * x47) + (x94 * x38);
+		const GEN_FLT x117 = x92 * ((x64 * x56) + (-1 * x98 * (x116 + (x56 * x93))));
+		const GEN_FLT x118 = x67 * x117;
+		const GEN_FLT x119 = (x65 * (x118 + (-1 * x66 * x117))) + (x68 * x117);
+		const GEN_FLT x120 = (x65 * x119) + (x69 * x117);
+		const GEN_FLT x121 = (x78 * x56) + (-1 * x106 * x116);
+		const GEN_FLT x122 = (-1 * x105 * x121) + x115;
+		const GEN_FLT x123 = x108 * x110;
+		const GEN_FLT x124 = x108 * x112;
+		const GEN_FLT x125 = x91 * ((x124 * x122) + (-1 * x111 * ((-1 * x123 * x122) + (-1 * x84 * ((x70 * x117) + (x65
+			* (x120 + (x65 * (x119 + (x73 * x117) + (x65 * ((x72 * x117) + (-1 * x102 * x117) + x118)))) + (x74 *
+			x117))) + (x65 * x120) + (x75 * x117))))) + (x89 * x120) + x121 + (x100 * x117));
+		const GEN_FLT x126 = ((x50 * x11) + (-1 * x43 * x44)) * x53;
+		const GEN_FLT x127 = (x95 * x44) + (x94 * x11);
+		const GEN_FLT x128 = x92 * ((x64 * x55) + (-1 * x98 * (x127 + (x55 * x93))));
+		const GEN_FLT x129 = (x78 * x55) + (-1 * x106 * x127);
+		const GEN_FLT x130 = (-1 * x105 * x129) + x126;
+		const GEN_FLT x131 = x67 * x128;
+		const GEN_FLT x132 = (x65 * (x131 + (-1 * x66 * x128))) + (x68 * x128);
+		const GEN_FLT x133 = (x65 * x132) + (x69 * x128);
+		const GEN_FLT x134 = x91 * ((x89 * x133) + x129 + (-1 * x111 * ((-1 * x123 * x130) + (-1 * x84 * ((x70 * x128)
+			+ (x65 * x133) + (x65 * (x133 + (x65 * (x132 + (x73 * x128) + (x65 * ((x72 * x128) + (-1 * x102 * x128) +
+			x131)))) + (x74 * x128))) + (x75 * x128))))) + (x124 * x130) + (x100 * x128));
+		const GEN_FLT x155 = (c11 * sensor_z) + (c12 * sensor_y) + (c13 * sensor_x);
+		const GEN_FLT x164 = (c14 * sensor_z) + (c15 * sensor_y) + (c16 * sensor_x);
+		const GEN_FLT x169 = (c17 * sensor_z) + (c18 * sensor_y) + (c19 * sensor_x);
+		const GEN_FLT x170 = (x44 * x169) + (x47 * x164) + (x10 * x155);
+		const GEN_FLT x171 = (x11 * x169) + (x38 * x164) + (x41 * x155);
+		const GEN_FLT x172 = ((x50 * x171) + (-1 * x43 * x170)) * x53;
+		const GEN_FLT x173 = (x56 * x164) + (x55 * x169) + (x57 * x155);
+		const GEN_FLT x174 = (x95 * x170) + (x94 * x171);
+		const GEN_FLT x175 = x92 * ((x64 * x173) + (-1 * x98 * (x174 + (x93 * x173))));
+		const GEN_FLT x176 = x67 * x175;
+		const GEN_FLT x177 = (x65 * (x176 + (-1 * x66 * x175))) + (x68 * x175);
+		const GEN_FLT x178 = (x65 * x177) + (x69 * x175);
+		const GEN_FLT x179 = (x78 * x173) + (-1 * x106 * x174);
+		const GEN_FLT x180 = (-1 * x105 * x179) + x172;
+		const GEN_FLT x181 = x91 * (x179 + (x89 * x178) + (x124 * x180) + (-1 * x111 * ((-1 * x123 * x180) + (-1 * x84
+			* ((x65 * x178) + (x70 * x175) + (x65 * ((x65 * (x177 + (x73 * x175) + (x65 * ((x72 * x175) + (-1 * x102 *
+			x175) + x176)))) + x178 + (x74 * x175))) + (x75 * x175))))) + (x100 * x175));
+		const GEN_FLT x189 = (c20 * sensor_z) + (c21 * sensor_y) + (c22 * sensor_x);
+		const GEN_FLT x192 = (c23 * sensor_z) + (c24 * sensor_y) + (c25 * sensor_x);
+		const GEN_FLT x194 = (c26 * sensor_y) + (c27 * sensor_z) + (c28 * sensor_x);
+		const GEN_FLT x195 = (x44 * x194) + (x10 * x192) + (x47 * x189);
+		const GEN_FLT x196 = (x11 * x194) + (x38 * x189) + (x41 * x192);
+		const GEN_FLT x197 = ((x50 * x196) + (-1 * x43 * x195)) * x53;
+		const GEN_FLT x198 = (x55 * x194) + (x56 * x189) + (x57 * x192);
+		const GEN_FLT x199 = (x95 * x195) + (x94 * x196);
+		const GEN_FLT x200 = x92 * ((x64 * x198) + (-1 * x98 * (x199 + (x93 * x198))));
+		const GEN_FLT x201 = x67 * x200;
+		const GEN_FLT x202 = (x65 * (x201 + (-1 * x66 * x200))) + (x68 * x200);
+		const GEN_FLT x203 = (x65 * x202) + (x69 * x200);
+		const GEN_FLT x204 = (x78 * x198) + (-1 * x106 * x199);
+		const GEN_FLT x205 = (-1 * x204 * x105) + x197;
+		const GEN_FLT x206 = x91 * (x204 + (x205 * x124) + (x89 * x203) + (-1 * x111 * ((-1 * x205 * x123) + (-1 * x84
+			* ((x70 * x200) + (x65 * (x203 + (x65 * ((x73 * x200) + x202 + (x65 * ((x72 * x200) + (-1 * x200 * x102) +
+			x201)))) + (x74 * x200))) + (x65 * x203) + (x75 * x200))))) + (x200 * x100));
+		const GEN_FLT x209 = (c29 * sensor_z) + (c30 * sensor_y) + (c31 * sensor_x);
+		const GEN_FLT x211 = (c32 * sensor_z) + (c33 * sensor_y) + (c34 * sensor_x);
+		const GEN_FLT x213 = (c35 * sensor_z) + (c36 * sensor_y) + (c37 * sensor_x);
+		const GEN_FLT x214 = (x44 * x213) + (x47 * x211) + (x10 * x209);
+		const GEN_FLT x215 = (x11 * x213) + (x38 * x211) + (x41 * x209);
+		const GEN_FLT x216 = ((x50 * x215) + (-1 * x43 * x214)) * x53;
+		const GEN_FLT x217 = (x55 * x213) + (x56 * x211) + (x57 * x209);
+		const GEN_FLT x218 = (x95 * x214) + (x94 * x215);
+		const GEN_FLT x219 = x92 * ((x64 * x217) + (-1 * x98 * (x218 + (x93 * x217))));
+		const GEN_FLT x220 = x67 * x219;
+		const GEN_FLT x221 = (x65 * (x220 + (-1 * x66 * x219))) + (x68 * x219);
+		const GEN_FLT x222 = (x65 * x221) + (x69 * x219);
+		const GEN_FLT x223 = (x78 * x217) + (-1 * x218 * x106);
+		const GEN_FLT x224 = (-1 * x223 * x105) + x216;
+		const GEN_FLT x225 = x91 * (x223 + (x89 * x222) + (x224 * x124) + (-1 * x111 * ((-1 * x224 * x123) + (-1 * x84
+			* ((x70 * x219) + (x65 * (x222 + (x65 * (x221 + (x73 * x219) + (x65 * ((x72 * x219) + (-1 * x219 * x102) +
+			x220)))) + (x74 * x219))) + (x65 * x222) + (x75 * x219))))) + (x219 * x100));
+		out[i] = (-1 * x113) + (-1 * x114 * (x113 + (-1 * x54))) + x54;
+		out[n + i] = (-1 * (x125 + (-1 * x115)) * x114) + (-1 * x125) + x115;
+		out[2 * n + i] = (-1 * (x134 + (-1 * x126)) * x114) + (-1 * x134) + x126;
+		out[3 * n + i] = (-1 * (x181 + (-1 * x172)) * x114) + (-1 * x181) + x172;
+		out[4 * n + i] = (-1 * (x206 + (-1 * x197)) * x114) + (-1 * x206) + x197;
+		out[5 * n + i] = (-1 * (x225 + (-1 * x216)) * x114) + (-1 * x225) + x216;
+	}
+}
+
+static inline void gen_reproject_axis_y_gen2_axis_angle_batch(FLT *GEN_RESTRICT out, size_t n,
+															  const LinmathAxisAnglePose *obj_p,
+															  const FLT *GEN_RESTRICT sensor_pt,
+															  const LinmathAxisAnglePose *lh_p,
+															  const BaseStationCal *bsc1) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_1 = (*bsc1).phase;
+	const GEN_FLT tilt_1 = (*bsc1).tilt;
+	const GEN_FLT curve_1 = (*bsc1).curve;
+	const GEN_FLT gibPhase_1 = (*bsc1).gibpha;
+	const GEN_FLT gibMag_1 = (*bsc1).gibmag;
+	const GEN_FLT ogeeMag_1 = (*bsc1).ogeephase;
+	const GEN_FLT ogeePhase_1 = (*bsc1).ogeemag;
+	const GEN_FLT x0 = lh_qk * lh_qk;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qi * lh_qi;
+	const GEN_FLT x3 = 1e-10 + x2 + x1 + x0;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = (1. / x4) * sin(x4);
+	const GEN_FLT x6 = x5 * lh_qi;
+	const GEN_FLT x7 = cos(x4);
+	const GEN_FLT x8 = (1. / x3) * (1 + (-1 * x7));
+	const GEN_FLT x9 = x8 * lh_qj;
+	const GEN_FLT x10 = x9 * lh_qk;
+	const GEN_FLT x11 = obj_qk * obj_qk;
+	const GEN_FLT x12 = obj_qj * obj_qj;
+	const GEN_FLT x13 = obj_qi * obj_qi;
+	const GEN_FLT x14 = 1e-10 + x13 + x12 + x11;
+	const GEN_FLT x15 = sqrt(x14);
+	const GEN_FLT x16 = cos(x15);
+	const GEN_FLT x17 = (1. / x14) * (1 + (-1 * x16));
+	const GEN_FLT x18 = (1. / x15) * sin(x15);
+	const GEN_FLT x19 = x18 * obj_qi;
+	const GEN_FLT x20 = x17 * obj_qk;
+	const GEN_FLT x21 = x20 * obj_qj;
+	const GEN_FLT x22 = x18 * obj_qj;
+	const GEN_FLT x23 = x20 * obj_qi;
+	const GEN_FLT x25 = x18 * obj_qk;
+	const GEN_FLT x26 = x17 * obj_qj * obj_qi;
+	const GEN_FLT x29 = x5 * lh_qk;
+	const GEN_FLT x30 = x9 * lh_qi;
+	const GEN_FLT x32 = 0.523598775598299 + (-1 * tilt_1);
+	const GEN_FLT x33 = x5 * lh_qj;
+	const GEN_FLT x34 = x8 * lh_qk * lh_qi;
+	const GEN_FLT x41 = cos(x32);
+	const GEN_FLT c0 = x21 + x19;
+	const GEN_FLT c1 = x23 + (-1 * x22);
+	const GEN_FLT c2 = x16 + (x11 * x17);
+	const GEN_FLT c3 = x26 + x25;
+	const GEN_FLT c4 = x16 + (x12 * x17);
+	const GEN_FLT c5 = x21 + (-1 * x19);
+	const GEN_FLT c6 = x26 + (-1 * x25);
+	const GEN_FLT c7 = x23 + x22;
+	const GEN_FLT c8 = x16 + (x13 * x17);
+	const GEN_FLT c9 = x30 + x29;
+	const GEN_FLT c10 = x7 + (x1 * x8);
+	const GEN_FLT c11 = x10 + (-1 * x6);
+	const GEN_FLT c12 = x34 + (-1 * x33);
+	const GEN_FLT c13 = x10 + x6;
+	const GEN_FLT c14 = x7 + (x0 * x8);
+	const GEN_FLT c15 = x30 + (-1 * x29);
+	const GEN_FLT c16 = x34 + x33;
+	const GEN_FLT c17 = x7 + (x2 * x8);
+	const GEN_FLT c18 = tan(x32);
+	const GEN_FLT c19 = 1. / x41;
+	const GEN_FLT c20 = sin(x32);
+	const GEN_FLT c21 = -1 * gibPhase_1;
+	const GEN_FLT c22 = -1 * phase_1;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x24 = (c0 * sensor_y) + (c1 * sensor_x) + (c2 * sensor_z) + obj_pz;
+		const GEN_FLT x27 = (c3 * sensor_x) + (c4 * sensor_y) + (c5 * sensor_z) + obj_py;
+		const GEN_FLT x28 = (c6 * sensor_y) + (c7 * sensor_z) + (c8 * sensor_x) + obj_px;
+		const GEN_FLT x31 = lh_py + (c9 * x28) + (x27 * c10) + (x24 * c11);
+		const GEN_FLT x35 = (c12 * x28) + (x27 * c13) + (x24 * c14) + lh_pz;
+		const GEN_FLT x36 = (c15 * x27) + (c16 * x24) + (x28 * c17) + lh_px;
+		const GEN_FLT x37 = (x36 * x36) + (x35 * x35);
+		const GEN_FLT x38 = -1 * x31 * (1. / sqrt(x37)) * c18;
+		const GEN_FLT x39 = atan2(-1 * x35, x36);
+		const GEN_FLT x40 = (sin(x39 + ogeeMag_1 + (-1 * asin(x38))) * ogeePhase_1) + curve_1;
+		const GEN_FLT x42 = asin(c19 * x31 * (1. / sqrt(x37 + (x31 * x31))));
+		const GEN_FLT x43 = 0.0028679863 + (x42 * (-8.0108022e-06 + (-8.0108022e-06 * x42)));
+		const GEN_FLT x44 = 5.3685255e-06 + (x42 * x43);
+		const GEN_FLT x45 = 0.0076069798 + (x42 * x44);
+		const GEN_FLT x46 = asin(x38 + (x40 * (x42 * x42) * x45 * (1. / (x41 + (x40 * c20 * ((x42 * (x45 + (x42 * (x44
+			+ (x42 * (x43 + (x42 * (-8.0108022e-06 + (-1.60216044e-05 * x42))))))))) + (x42 * x45)))))));
+		out[i] = -1.5707963267949 + x39 + (-1 * sin((-1 * x39) + x46 + c21) * gibMag_1) + (-1 * x46) + c22;
+	}
+}
+
+// Jacobian of reproject_axis_y_gen2 wrt [obj_px, obj_py, obj_pz, obj_qi, obj_qj, obj_qk]
+static inline void gen_reproject_axis_y_gen2_jac_obj_p_axis_angle_batch(FLT *GEN_RESTRICT out, size_t n,
+																		const LinmathAxisAnglePose *obj_p,
+																		const FLT *GEN_RESTRICT sensor_pt,
+																		const LinmathAxisAnglePose *lh_p,
+																		const BaseStationCal *bsc1) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_1 = (*bsc1).phase;
+	const GEN_FLT tilt_1 = (*bsc1).tilt;
+	const GEN_FLT curve_1 = (*bsc1).curve;
+	const GEN_FLT gibPhase_1 = (*bsc1).gibpha;
+	const GEN_FLT gibMag_1 = (*bsc1).gibmag;
+	const GEN_FLT ogeeMag_1 = (*bsc1).ogeephase;
+	const GEN_FLT ogeePhase_1 = (*bsc1).ogeemag;
+	const GEN_FLT x0 = lh_qk * lh_qk;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qi * lh_qi;
+	const GEN_FLT x3 = 1e-10 + x2 + x1 + x0;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = (1. / x4) * sin(x4);
+	const GEN_FLT x6 = x5 * lh_qj;
+	const GEN_FLT x7 = cos(x4);
+	const GEN_FLT x8 = (1. / x3) * (1 + (-1 * x7));
+	const GEN_FLT x9 = x8 * lh_qi;
+	const GEN_FLT x10 = x9 * lh_qk;
+	const GEN_FLT x11 = x10 + (-1 * x6);
+	const GEN_FLT x12 = x10 + x6;
+	const GEN_FLT x13 = obj_qk * obj_qk;
+	const GEN_FLT x14 = obj_qj * obj_qj;
+	const GEN_FLT x15 = obj_qi * obj_qi;
+	const GEN_FLT x16 = 1e-10 + x15 + x14 + x13;
+	const GEN_FLT x17 = 1. / x16;
+	const GEN_FLT x18 = sqrt(x16);
+	const GEN_FLT x19 = cos(x18);
+	const GEN_FLT x20 = 1 + (-1 * x19);
+	const GEN_FLT x21 = x20 * x17;
+	const GEN_FLT x22 = sin(x18);
+	const GEN_FLT x23 = x22 * (1. / x18);
+	const GEN_FLT x24 = x23 * obj_qi;
+	const GEN_FLT x25 = x21 * obj_qj;
+	const GEN_FLT x26 = x25 * obj_qk;
+	const GEN_FLT x27 = x23 * obj_qj;
+	const GEN_FLT x28 = -1 * x27;
+	const GEN_FLT x29 = x21 * obj_qi;
+	const GEN_FLT x30 = x29 * obj_qk;
+	const GEN_FLT x32 = -1 * x24;
+	const GEN_FLT x33 = x23 * obj_qk;
+	const GEN_FLT x34 = x25 * obj_qi;
+	const GEN_FLT x36 = x5 * lh_qk;
+	const GEN_FLT x37 = x9 * lh_qj;
+	const GEN_FLT x38 = x37 + (-1 * x36);
+	const GEN_FLT x39 = -1 * x33;
+	const GEN_FLT x41 = x7 + (x2 * x8);
+	const GEN_FLT x45 = x7 + (x0 * x8);
+	const GEN_FLT x46 = x5 * lh_qi;
+	const GEN_FLT x47 = x8 * lh_qk * lh_qj;
+	const GEN_FLT x48 = x47 + x46;
+	const GEN_FLT x55 = x47 + (-1 * x46);
+	const GEN_FLT x56 = x7 + (x1 * x8);
+	const GEN_FLT x57 = x37 + x36;
+	const GEN_FLT x59 = 0.523598775598299 + (-1 * tilt_1);
+	const GEN_FLT x60 = cos(x59);
+	const GEN_FLT x61 = 1. / x60;
+	const GEN_FLT x72 = tan(x59);
+	const GEN_FLT x84 = sin(x59);
+	const GEN_FLT x140 = obj_qi * obj_qi * obj_qi;
+	const GEN_FLT x141 = x22 * (1. / (x16 * sqrt(x16)));
+	const GEN_FLT x142 = 2 * x20 * (1. / (x16 * x16));
+	const GEN_FLT x143 = x19 * x17;
+	const GEN_FLT x144 = x143 * obj_qk;
+	const GEN_FLT x145 = x144 * obj_qi;
+	const GEN_FLT x146 = x141 * obj_qk;
+	const GEN_FLT x147 = x146 * obj_qi;
+	const GEN_FLT x148 = x147 + (-1 * x145);
+	const GEN_FLT x149 = x15 * x141;
+	const GEN_FLT x150 = x15 * x142;
+	const GEN_FLT x151 = (-1 * x150 * obj_qj) + (x149 * obj_qj);
+	const GEN_FLT x152 = x151 + x25;
+	const GEN_FLT x153 = obj_qj * obj_qi;
+	const GEN_FLT x154 = x143 * x153;
+	const GEN_FLT x155 = x141 * x153;
+	const GEN_FLT x156 = (-1 * x155) + x154;
+	const GEN_FLT x157 = x21 * obj_qk;
+	const GEN_FLT x158 = (-1 * x150 * obj_qk) + (x149 * obj_qk);
+	const GEN_FLT x159 = x158 + x157;
+	const GEN_FLT x161 = (-1 * x147) + x145;
+	const GEN_FLT x162 = x14 * x141;
+	const GEN_FLT x163 = x142 * obj_qi;
+	const GEN_FLT x164 = (-1 * x14 * x163) + (x162 * obj_qi);
+	const GEN_FLT x165 = x15 * x143;
+	const GEN_FLT x166 = x142 * obj_qk;
+	const GEN_FLT x167 = (-1 * x166 * x153) + (x155 * obj_qk);
+	const GEN_FLT x168 = x167 + (-1 * x23);
+	const GEN_FLT x170 = x155 + (-1 * x154);
+	const GEN_FLT x171 = x167 + x23;
+	const GEN_FLT x172 = x13 * x141;
+	const GEN_FLT x173 = (-1 * x13 * x163) + (x172 * obj_qi);
+	const GEN_FLT x188 = x164 + x29;
+	const GEN_FLT x189 = x144 * obj_qj;
+	const GEN_FLT x190 = x146 * obj_qj;
+	const GEN_FLT x191 = (-1 * x190) + x189;
+	const GEN_FLT x192 = obj_qj * obj_qj * obj_qj;
+	const GEN_FLT x193 = (-1 * x14 * x166) + (x162 * obj_qk);
+	const GEN_FLT x194 = x193 + x157;
+	const GEN_FLT x196 = x190 + (-1 * x189);
+	const GEN_FLT x197 = x14 * x143;
+	const GEN_FLT x199 = (-1 * x13 * x142 * obj_qj) + (x172 * obj_qj);
+	const GEN_FLT x214 = x13 * x143;
+	const GEN_FLT x215 = x173 + x29;
+	const GEN_FLT x217 = x199 + x25;
+	const GEN_FLT x219 = obj_qk * obj_qk * obj_qk;
+	const GEN_FLT c0 = x30 + x28;
+	const GEN_FLT c1 = x26 + x24;
+	const GEN_FLT c2 = x19 + (x21 * x13);
+	const GEN_FLT c3 = x34 + x33;
+	const GEN_FLT c4 = x19 + (x21 * x14);
+	const GEN_FLT c5 = x26 + x32;
+	const GEN_FLT c6 = x34 + x39;
+	const GEN_FLT c7 = x19 + (x21 * x15);
+	const GEN_FLT c8 = x30 + x27;
+	const GEN_FLT c9 = x72 * x72;
+	const GEN_FLT c10 = 1. / (x60 * x60);
+	const GEN_FLT c11 = x159 + x156;
+	const GEN_FLT c12 = x152 + x148;
+	const GEN_FLT c13 = (-1 * x140 * x142) + (x140 * x141) + (2 * x29) + x32;
+	const GEN_FLT c14 = x168 + x149 + (-1 * x165);
+	const GEN_FLT c15 = x164 + x32;
+	const GEN_FLT c16 = x152 + x161;
+	const GEN_FLT c17 = x173 + x32;
+	const GEN_FLT c18 = x171 + (-1 * x149) + x165;
+	const GEN_FLT c19 = x170 + x159;
+	const GEN_FLT c20 = x170 + x194;
+	const GEN_FLT c21 = (-1 * x192 * x142) + (x192 * x141) + (2 * x25) + x28;
+	const GEN_FLT c22 = x191 + x188;
+	const GEN_FLT c23 = x171 + (-1 * x162) + x197;
+	const GEN_FLT c24 = x196 + x188;
+	const GEN_FLT c25 = x151 + x28;
+	const GEN_FLT c26 = x199 + x28;
+	const GEN_FLT c27 = x156 + x194;
+	const GEN_FLT c28 = x168 + x162 + (-1 * x197);
+	const GEN_FLT c29 = x215 + x191;
+	const GEN_FLT c30 = x168 + x172 + (-1 * x214);
+	const GEN_FLT c31 = x158 + x39;
+	const GEN_FLT c32 = x148 + x217;
+	const GEN_FLT c33 = x193 + x39;
+	const GEN_FLT c34 = x171 + (-1 * x172) + x214;
+	const GEN_FLT c35 = (-1 * x219 * x142) + x39 + (x219 * x141) + (2 * x157);
+	const GEN_FLT c36 = x161 + x217;
+	const GEN_FLT c37 = x215 + x196;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x31 = (c0 * sensor_x) + (c1 * sensor_y) + (c2 * sensor_z) + obj_pz;
+		const GEN_FLT x35 = (c3 * sensor_x) + (c4 * sensor_y) + (c5 * sensor_z) + obj_py;
+		const GEN_FLT x40 = (c6 * sensor_y) + (c7 * sensor_x) + (c8 * sensor_z) + obj_px;
+		const GEN_FLT x42 = (x40 * x41) + (x31 * x12) + (x35 * x38) + lh_px;
+		const GEN_FLT x43 = 1. / x42;
+		const GEN_FLT x44 = x42 * x42;
+		const GEN_FLT x49 = (x40 * x11) + (x45 * x31) + (x48 * x35) + lh_pz;
+		const GEN_FLT x50 = (1. / x44) * x49;
+		const GEN_FLT x51 = x44 + (x49 * x49);
+		const GEN_FLT x52 = 1. / x51;
+		const GEN_FLT x53 = x52 * x44;
+		const GEN_FLT x54 = ((x50 * x41) + (-1 * x43 * x11)) * x53;
+		const GEN_FLT x58 = (x57 * x40) + lh_py + (x56 * x35) + (x55 * x31);
+		const GEN_FLT x62 = x58 * x58;
+		const GEN_FLT x63 = x51 + x62;
+		const GEN_FLT x64 = (1. / sqrt(x63)) * x61;
+		const GEN_FLT x65 = asin(x64 * x58);
+		const GEN_FLT x66 = 8.0108022e-06 * x65;
+		const GEN_FLT x67 = -8.0108022e-06 + (-1 * x66);
+		const GEN_FLT x68 = 0.0028679863 + (x67 * x65);
+		const GEN_FLT x69 = 5.3685255e-06 + (x68 * x65);
+		const GEN_FLT x70 = 0.0076069798 + (x65 * x69);
+		const GEN_FLT x71 = x65 * x65;
+		const GEN_FLT x73 = x72 * (1. / sqrt(x51));
+		const GEN_FLT x74 = -1 * x73 * x58;
+		const GEN_FLT x75 = atan2(-1 * x49, x42);
+		const GEN_FLT x76 = x75 + ogeeMag_1 + (-1 * asin(x74));
+		const GEN_FLT x77 = (sin(x76) * ogeePhase_1) + curve_1;
+		const GEN_FLT x78 = x70 * x65;
+		const GEN_FLT x79 = -8.0108022e-06 + (-1.60216044e-05 * x65);
+		const GEN_FLT x80 = x68 + (x79 * x65);
+		const GEN_FLT x81 = x69 + (x80 * x65);
+		const GEN_FLT x82 = x70 + (x81 * x65);
+		const GEN_FLT x83 = (x82 * x65) + x78;
+		const GEN_FLT x85 = x84 * x77;
+		const GEN_FLT x86 = x60 + (x83 * x85);
+		const GEN_FLT x87 = 1. / x86;
+		const GEN_FLT x88 = x87 * x77;
+		const GEN_FLT x89 = x88 * x71;
+		const GEN_FLT x90 = x74 + (x89 * x70);
+		const GEN_FLT x91 = 1. / sqrt(1 + (-1 * (x90 * x90)));
+		const GEN_FLT x92 = 1. / sqrt(1 + (-1 * c9 * x62 * x52));
+		const GEN_FLT x93 = 2 * x42;
+		const GEN_FLT x94 = 2 * x49;
+		const GEN_FLT x95 = (x94 * x11) + (x93 * x41);
+		const GEN_FLT x96 = 1.0 / 2.0 * x58;
+		const GEN_FLT x97 = x72 * (1. / (x51 * sqrt(x51))) * x96;
+		const GEN_FLT x98 = (-1 * x73 * x57) + (x97 * x95);
+		const GEN_FLT x99 = (-1 * x92 * x98) + x54;
+		const GEN_FLT x100 = cos(x76) * ogeePhase_1;
+		const GEN_FLT x101 = x71 * x70;
+		const GEN_FLT x102 = x87 * x101;
+		const GEN_FLT x103 = x100 * x102;
+		const GEN_FLT x104 = 1. / sqrt(1 + (-1 * c10 * (1. / x63) * x62));
+		const GEN_FLT x105 = 2 * x58;
+		const GEN_FLT x106 = (1. / (x63 * sqrt(x63))) * x61 * x96;
+		const GEN_FLT x107 = (x64 * x57) + (-1 * x106 * (x95 + (x57 * x105)));
+		const GEN_FLT x108 = x104 * x107;
+		const GEN_FLT x109 = 2 * x88 * x78;
+		const GEN_FLT x110 = x67 * x108;
+		const GEN_FLT x111 = (x68 * x108) + (x65 * (x110 + (-1 * x66 * x108)));
+		const GEN_FLT x112 = (x69 * x108) + (x65 * x111);
+		const GEN_FLT x113 = x83 * x84;
+		const GEN_FLT x114 = x100 * x113;
+		const GEN_FLT x115 = x82 * x104;
+		const GEN_FLT x116 = 2.40324066e-05 * x65;
+		const GEN_FLT x117 = (1. / (x86 * x86)) * x77 * x101;
+		const GEN_FLT x118 = x91 * (x98 + (-1 * x117 * ((x85 * ((x65 * x112) + (x70 * x108) + (x65 * ((x65 * (x111 +
+			(x80 * x108) + (x65 * ((x79 * x108) + (-1 * x108 * x116) + x110)))) + x112 + (x81 * x108))) + (x107 *
+			x115))) + (x99 * x114))) + (x89 * x112) + (x109 * x108) + (x99 * x103));
+		const GEN_FLT x119 = cos(x75 + (-1 * asin(x90)) + gibPhase_1) * gibMag_1;
+		const GEN_FLT x120 = ((x50 * x38) + (-1 * x43 * x48)) * x53;
+		const GEN_FLT x121 = (x94 * x48) + (x93 * x38);
+		const GEN_FLT x122 = (-1 * x73 * x56) + (x97 * x121);
+		const GEN_FLT x123 = x100 * ((-1 * x92 * x122) + x120);
+		const GEN_FLT x124 = (x64 * x56) + (-1 * x106 * (x121 + (x56 * x105)));
+		const GEN_FLT x125 = x104 * x124;
+		const GEN_FLT x126 = x67 * x125;
+		const GEN_FLT x127 = (x68 * x125) + (x65 * (x126 + (-1 * x66 * x125)));
+		const GEN_FLT x128 = (x69 * x125) + (x65 * x127);
+		const GEN_FLT x129 = x91 * ((-1 * x117 * ((x85 * ((x65 * x128) + (x70 * x125) + (x65 * ((x65 * (x127 + (x80 *
+			x125) + (x65 * ((x79 * x125) + (-1 * x116 * x125) + x126)))) + x128 + (x81 * x125))) + (x115 * x124))) +
+			(x113 * x123))) + (x109 * x125) + (x89 * x128) + x122 + (x102 * x123));
+		const GEN_FLT x130 = ((x50 * x12) + (-1 * x43 * x45)) * x53;
+		const GEN_FLT x131 = (x94 * x45) + (x93 * x12);
+		const GEN_FLT x132 = (-1 * x73 * x55) + (x97 * x131);
+		const GEN_FLT x133 = (-1 * x92 * x132) + x130;
+		const GEN_FLT x134 = (x64 * x55) + (-1 * x106 * (x131 + (x55 * x105)));
+		const GEN_FLT x135 = x104 * x134;
+		const GEN_FLT x136 = x67 * x135;
+		const GEN_FLT x137 = (x68 * x135) + (x65 * (x136 + (-1 * x66 * x135)));
+		const GEN_FLT x138 = (x69 * x135) + (x65 * x137);
+		const GEN_FLT x139 = x91 * (x132 + (x89 * x138) + (x109 * x135) + (-1 * x117 * ((x85 * ((x65 * x138) + (x70 *
+			x135) + (x65 * (x138 + (x65 * (x137 + (x80 * x135) + (x65 * ((x79 * x135) + (-1 * x116 * x135) + x136)))) +
+			(x81 * x135))) + (x115 * x134))) + (x114 * x133))) + (x103 * x133));
+		const GEN_FLT x160 = (c11 * sensor_z) + (c12 * sensor_y) + (c13 * sensor_x);
+		const GEN_FLT x169 = (c14 * sensor_z) + (c15 * sensor_y) + (c16 * sensor_x);
+		const GEN_FLT x174 = (c17 * sensor_z) + (c18 * sensor_y) + (c19 * sensor_x);
+		const GEN_FLT x175 = (x45 * x174) + (x48 * x169) + (x11 * x160);
+		const GEN_FLT x176 = (x38 * x169) + (x12 * x174) + (x41 * x160);
+		const GEN_FLT x177 = ((x50 * x176) + (-1 * x43 * x175)) * x53;
+		const GEN_FLT x178 = (x94 * x175) + (x93 * x176);
+		const GEN_FLT x179 = (x55 * x174) + (x56 * x169) + (x57 * x160);
+		const GEN_FLT x180 = (-1 * x73 * x179) + (x97 * x178);
+		const GEN_FLT x181 = (-1 * x92 * x180) + x177;
+		const GEN_FLT x182 = (x64 * x179) + (-1 * x106 * (x178 + (x105 * x179)));
+		const GEN_FLT x183 = x104 * x182;
+		const GEN_FLT x184 = x67 * x183;
+		const GEN_FLT x185 = (x68 * x183) + (x65 * (x184 + (-1 * x66 * x183)));
+		const GEN_FLT x186 = (x69 * x183) + (x65 * x185);
+		const GEN_FLT x187 = x91 * (x180 + (x89 * x186) + (x109 * x183) + (-1 * x117 * ((x85 * ((x65 * x186) + (x70 *
+			x183) + (x65 * (x186 + (x65 * (x185 + (x80 * x183) + (x65 * ((x79 * x183) + (-1 * x116 * x183) + x184)))) +
+			(x81 * x183))) + (x115 * x182))) + (x114 * x181))) + (x103 * x181));
+		const GEN_FLT x195 = (c20 * sensor_z) + (c21 * sensor_y) + (c22 * sensor_x);
+		const GEN_FLT x198 = (c23 * sensor_z) + (c24 * sensor_y) + (c25 * sensor_x);
+		const GEN_FLT x200 = (c26 * sensor_z) + (c27 * sensor_y) + (c28 * sensor_x);
+		const GEN_FLT x201 = (x11 * x198) + (x45 * x200) + (x48 * x195);
+		const GEN_FLT x202 = (x12 * x200) + (x38 * x195) + (x41 * x198);
+		const GEN_FLT x203 = ((x50 * x202) + (-1 * x43 * x201)) * x53;
+		const GEN_FLT x204 = (x94 * x201) + (x93 * x202);
+		const GEN_FLT x205 = (x55 * x200) + (x56 * x195) + (x57 * x198);
+		const GEN_FLT x206 = (-1 * x73 * x205) + (x97 * x204);
+		const GEN_FLT x207 = (-1 * x92 * x206) + x203;
+		const GEN_FLT x208 = (x64 * x205) + (-1 * x106 * (x204 + (x205 * x105)));
+		const GEN_FLT x209 = x208 * x104;
+		const GEN_FLT x210 = x67 * x209;
+		const GEN_FLT x211 = (x68 * x209) + (x65 * (x210 + (-1 * x66 * x209)));
+		const GEN_FLT x212 = (x69 * x209) + (x65 * x211);
+		const GEN_FLT x213 = x91 * (x206 + (-1 * x117 * ((x85 * ((x65 * x212) + (x70 * x209) + (x65 * (x212 + (x65 *
+			(x211 + (x80 * x209) + (x65 * ((x79 * x209) + (-1 * x209 * x116) + x210)))) + (x81 * x209))) + (x208 *
+			x115))) + (x207 * x114))) + (x89 * x212) + (x209 * x109) + (x207 * x103));
+		const GEN_FLT x216 = (c29 * sensor_z) + (c30 * sensor_y) + (c31 * sensor_x);
+		const GEN_FLT x218 = (c32 * sensor_z) + (c33 * sensor_y) + (c34 * sensor_x);
+		const GEN_FLT x220 = (c35 * sensor_z) + (c36 * sensor_y) + (c37 * sensor_x);
+		const GEN_FLT x221 = (x48 * x218) + (x45 * x220) + (x11 * x216);
+		const GEN_FLT x222 = (x12 * x220) + (x38 * x218) + (x41 * x216);
+		const GEN_FLT x223 = ((x50 * x222) + (-1 * x43 * x221)) * x53;
+		const GEN_FLT x224 = (x94 * x221) + (x93 * x222);
+		const GEN_FLT x225 = (x55 * x220) + (x56 * x218) + (x57 * x216);
+		const GEN_FLT x226 = (-1 * x73 * x225) + (x97 * x224);
+		const GEN_FLT x227 = (-1 * x92 * x226) + x223;
+		const GEN_FLT x228 = (x64 * x225) + (-1 * x106 * (x224 + (x225 * x105)));
+		const GEN_FLT x229 = x228 * x104;
+		const GEN_FLT x230 = x67 * x229;
+		const GEN_FLT x231 = (x68 * x229) + (x65 * (x230 + (-1 * x66 * x229)));
+		const GEN_FLT x232 = (x69 * x229) + (x65 * x231);
+		const GEN_FLT x233 = x91 * (x226 + (x89 * x232) + (-1 * x117 * ((x85 * ((x65 * x232) + (x70 * x229) + (x65 *
+			(x232 + (x65 * (x231 + (x80 * x229) + (x65 * ((x79 * x229) + (-1 * x229 * x116) + x230)))) + (x81 * x229)))
+			+ (x228 * x115))) + (x227 * x114))) + (x229 * x109) + (x227 * x103));
+		out[i] = (-1 * x118) + (-1 * x119 * (x118 + (-1 * x54))) + x54;
+		out[n + i] = (-1 * x129) + (-1 * (x129 + (-1 * x120)) * x119) + x120;
+		out[2 * n + i] = (-1 * x139) + (-1 * (x139 + (-1 * x130)) * x119) + x130;
+		out[3 * n + i] = (-1 * x187) + (-1 * (x187 + (-1 * x177)) * x119) + x177;
+		out[4 * n + i] = (-1 * x213) + (-1 * (x213 + (-1 * x203)) * x119) + x203;
+		out[5 * n + i] = (-1 * x233) + (-1 * (x233 + (-1 * x223)) * x119) + x223;
+	}
+}
+
+static inline void gen_reproject_axis_angle_batch(FLT *GEN_RESTRICT out, size_t n, const LinmathAxisAnglePose *obj_p,
+												  const FLT *GEN_RESTRICT sensor_pt, const LinmathAxisAnglePose *lh_p,
+												  const BaseStationCal *bsd) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_0 = bsd[0].phase;
+	const GEN_FLT tilt_0 = bsd[0].tilt;
+	const GEN_FLT curve_0 = bsd[0].curve;
+	const GEN_FLT gibPhase_0 = bsd[0].gibpha;
+	const GEN_FLT gibMag_0 = bsd[0].gibmag;
+	const GEN_FLT ogeeMag_0 = bsd[0].ogeephase;
+	const GEN_FLT ogeePhase_0 = bsd[0].ogeemag;
+	const GEN_FLT phase_1 = bsd[1].phase;
+	const GEN_FLT tilt_1 = bsd[1].tilt;
+	const GEN_FLT curve_1 = bsd[1].curve;
+	const GEN_FLT gibPhase_1 = bsd[1].gibpha;
+	const GEN_FLT gibMag_1 = bsd[1].gibmag;
+	const GEN_FLT ogeeMag_1 = bsd[1].ogeephase;
+	const GEN_FLT ogeePhase_1 = bsd[1].ogeemag;
+	const GEN_FLT x0 = lh_qk * lh_qk;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qi * lh_qi;
+	const GEN_FLT x3 = 1e-10 + x2 + x1 + x0;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = (1. / x4) * sin(x4);
+	const GEN_FLT x6 = x5 * lh_qi;
+	const GEN_FLT x7 = cos(x4);
+	const GEN_FLT x8 = (1. / x3) * (1 + (-1 * x7));
+	const GEN_FLT x9 = x8 * lh_qj;
+	const GEN_FLT x10 = x9 * lh_qk;
+	const GEN_FLT x11 = obj_qk * obj_qk;
+	const GEN_FLT x12 = obj_qj * obj_qj;
+	const GEN_FLT x13 = obj_qi * obj_qi;
+	const GEN_FLT x14 = 1e-10 + x13 + x12 + x11;
+	const GEN_FLT x15 = sqrt(x14);
+	const GEN_FLT x16 = cos(x15);
+	const GEN_FLT x17 = (1. / x14) * (1 + (-1 * x16));
+	const GEN_FLT x18 = (1. / x15) * sin(x15);
+	const GEN_FLT x19 = x18 * obj_qi;
+	const GEN_FLT x20 = x17 * obj_qk;
+	const GEN_FLT x21 = x20 * obj_qj;
+	const GEN_FLT x22 = x18 * obj_qj;
+	const GEN_FLT x23 = x20 * obj_qi;
+	const GEN_FLT x25 = x18 * obj_qk;
+	const GEN_FLT x26 = x17 * obj_qj * obj_qi;
+	const GEN_FLT x29 = x5 * lh_qk;
+	const GEN_FLT x30 = x9 * lh_qi;
+	const GEN_FLT x32 = x5 * lh_qj;
+	const GEN_FLT x33 = x8 * lh_qk * lh_qi;
+	const GEN_FLT c0 = x21 + x19;
+	const GEN_FLT c1 = x23 + (-1 * x22);
+	const GEN_FLT c2 = x16 + (x11 * x17);
+	const GEN_FLT c3 = x26 + x25;
+	const GEN_FLT c4 = x16 + (x12 * x17);
+	const GEN_FLT c5 = x21 + (-1 * x19);
+	const GEN_FLT c6 = x26 + (-1 * x25);
+	const GEN_FLT c7 = x23 + x22;
+	const GEN_FLT c8 = x16 + (x13 * x17);
+	const GEN_FLT c9 = x30 + x29;
+	const GEN_FLT c10 = x7 + (x1 * x8);
+	const GEN_FLT c11 = x10 + (-1 * x6);
+	const GEN_FLT c12 = x33 + (-1 * x32);
+	const GEN_FLT c13 = x10 + x6;
+	const GEN_FLT c14 = x7 + (x0 * x8);
+	const GEN_FLT c15 = x30 + (-1 * x29);
+	const GEN_FLT c16 = x33 + x32;
+	const GEN_FLT c17 = x7 + (x2 * x8);
+	const GEN_FLT c18 = -1 * phase_0;
+	const GEN_FLT c19 = -1 * phase_1;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x24 = (c0 * sensor_y) + (c1 * sensor_x) + (c2 * sensor_z) + obj_pz;
+		const GEN_FLT x27 = (c3 * sensor_x) + (c4 * sensor_y) + (c5 * sensor_z) + obj_py;
+		const GEN_FLT x28 = (c6 * sensor_y) + (c7 * sensor_z) + (c8 * sensor_x) + obj_px;
+		const GEN_FLT x31 = lh_py + (c9 * x28) + (x27 * c10) + (x24 * c11);
+		const GEN_FLT x34 = (c12 * x28) + (x27 * c13) + (x24 * c14) + lh_pz;
+		const GEN_FLT x35 = -1 * x34;
+		const GEN_FLT x36 = x34 * x34;
+		const GEN_FLT x37 = (c15 * x27) + (c16 * x24) + (x28 * c17) + lh_px;
+		const GEN_FLT x38 = atan2(x37, x35);
+		const GEN_FLT x39 = (-1 * x38) + c18 + (-1 * asin(x31 * (1. / sqrt((x37 * x37) + x36)) * tilt_0));
+		const GEN_FLT x40 = (-1 * atan2(-1 * x31, x35)) + c19 + (-1 * asin(x37 * (1. / sqrt((x31 * x31) + x36)) *
+			tilt_1));
+		out[i] = x39 + (-1 * cos(1.5707963267949 + x39 + gibPhase_0) * gibMag_0) + ((atan2(x31, x35) * atan2(x31, x35))
+			* curve_0);
+		out[n + i] = x40 + (-1 * cos(1.5707963267949 + x40 + gibPhase_1) * gibMag_1) + ((x38 * x38) * curve_1);
+	}
+}
+
+// Jacobian of reproject wrt [obj_px, obj_py, obj_pz, obj_qi, obj_qj, obj_qk]
+static inline void gen_reproject_jac_obj_p_axis_angle_batch(FLT *GEN_RESTRICT out, size_t n,
+															const LinmathAxisAnglePose *obj_p,
+															const FLT *GEN_RESTRICT sensor_pt,
+															const LinmathAxisAnglePose *lh_p,
+															const BaseStationCal *bsd) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_0 = bsd[0].phase;
+	const GEN_FLT tilt_0 = bsd[0].tilt;
+	const GEN_FLT curve_0 = bsd[0].curve;
+	const GEN_FLT gibPhase_0 = bsd[0].gibpha;
+	const GEN_FLT gibMag_0 = bsd[0].gibmag;
+	const GEN_FLT ogeeMag_0 = bsd[0].ogeephase;
+	const GEN_FLT ogeePhase_0 = bsd[0].ogeemag;
+	const GEN_FLT phase_1 = bsd[1].phase;
+	const GEN_FLT tilt_1 = bsd[1].tilt;
+	const GEN_FLT curve_1 = bsd[1].curve;
+	const GEN_FLT gibPhase_1 = bsd[1].gibpha;
+	const GEN_FLT gibMag_1 = bsd[1].gibmag;
+	const GEN_FLT ogeeMag_1 = bsd[1].ogeephase;
+	const GEN_FLT ogeePhase_1 = bsd[1].ogeemag;
+	const GEN_FLT x0 = lh_qk * lh_qk;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qi * lh_qi;
+	const GEN_FLT x3 = 1e-10 + x2 + x1 + x0;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = (1. / x4) * sin(x4);
+	const GEN_FLT x6 = x5 * lh_qj;
+	const GEN_FLT x7 = cos(x4);
+	const GEN_FLT x8 = (1. / x3) * (1 + (-1 * x7));
+	const GEN_FLT x9 = x8 * lh_qk;
+	const GEN_FLT x10 = x9 * lh_qi;
+	const GEN_FLT x11 = x10 + (-1 * x6);
+	const GEN_FLT x12 = x10 + x6;
+	const GEN_FLT x13 = obj_qk * obj_qk;
+	const GEN_FLT x14 = obj_qj * obj_qj;
+	const GEN_FLT x15 = obj_qi * obj_qi;
+	const GEN_FLT x16 = 1e-10 + x15 + x14 + x13;
+	const GEN_FLT x17 = 1. / x16;
+	const GEN_FLT x18 = sqrt(x16);
+	const GEN_FLT x19 = cos(x18);
+	const GEN_FLT x20 = 1 + (-1 * x19);
+	const GEN_FLT x21 = x20 * x17;
+	const GEN_FLT x22 = sin(x18);
+	const GEN_FLT x23 = x22 * (1. / x18);
+	const GEN_FLT x24 = x23 * obj_qi;
+	const GEN_FLT x25 = x21 * obj_qk;
+	const GEN_FLT x26 = x25 * obj_qj;
+	const GEN_FLT x27 = x23 * obj_qj;
+	const GEN_FLT x28 = -1 * x27;
+	const GEN_FLT x29 = x25 * obj_qi;
+	const GEN_FLT x31 = -1 * x24;
+	const GEN_FLT x32 = x23 * obj_qk;
+	const GEN_FLT x33 = x21 * obj_qi;
+	const GEN_FLT x34 = x33 * obj_qj;
+	const GEN_FLT x36 = x5 * lh_qk;
+	const GEN_FLT x37 = x8 * lh_qj * lh_qi;
+	const GEN_FLT x38 = x37 + (-1 * x36);
+	const GEN_FLT x39 = -1 * x32;
+	const GEN_FLT x41 = x7 + (x2 * x8);
+	const GEN_FLT x43 = x7 + (x0 * x8);
+	const GEN_FLT x44 = x5 * lh_qi;
+	const GEN_FLT x45 = x9 * lh_qj;
+	const GEN_FLT x46 = x45 + x44;
+	const GEN_FLT x60 = x45 + (-1 * x44);
+	const GEN_FLT x61 = x7 + (x1 * x8);
+	const GEN_FLT x62 = x37 + x36;
+	const GEN_FLT x89 = obj_qi * obj_qi * obj_qi;
+	const GEN_FLT x90 = x22 * (1. / (x16 * sqrt(x16)));
+	const GEN_FLT x91 = 2 * x20 * (1. / (x16 * x16));
+	const GEN_FLT x92 = x21 * obj_qj;
+	const GEN_FLT x93 = x90 * x15;
+	const GEN_FLT x94 = x91 * x15;
+	const GEN_FLT x95 = (-1 * x94 * obj_qj) + (x93 * obj_qj);
+	const GEN_FLT x96 = x95 + x92;
+	const GEN_FLT x97 = x19 * x17;
+	const GEN_FLT x98 = obj_qk * obj_qi;
+	const GEN_FLT x99 = x98 * x97;
+	const GEN_FLT x100 = x90 * x98;
+	const GEN_FLT x101 = x100 + (-1 * x99);
+	const GEN_FLT x102 = (-1 * x94 * obj_qk) + (x93 * obj_qk);
+	const GEN_FLT x103 = x102 + x25;
+	const GEN_FLT x104 = obj_qj * obj_qi;
+	const GEN_FLT x105 = x97 * x104;
+	const GEN_FLT x106 = x90 * x104;
+	const GEN_FLT x107 = (-1 * x106) + x105;
+	const GEN_FLT x109 = (-1 * x100) + x99;
+	const GEN_FLT x110 = x90 * x14;
+	const GEN_FLT x111 = x91 * obj_qi;
+	const GEN_FLT x112 = (-1 * x14 * x111) + (x110 * obj_qi);
+	const GEN_FLT x113 = x97 * x15;
+	const GEN_FLT x114 = obj_qk * obj_qj;
+	const GEN_FLT x115 = x90 * x114;
+	const GEN_FLT x116 = (-1 * x111 * x114) + (x115 * obj_qi);
+	const GEN_FLT x117 = x116 + (-1 * x23);
+	const GEN_FLT x119 = x106 + (-1 * x105);
+	const GEN_FLT x120 = x116 + x23;
+	const GEN_FLT x121 = x90 * x13;
+	const GEN_FLT x122 = (-1 * x13 * x111) + (x121 * obj_qi);
+	const GEN_FLT x132 = x97 * x114;
+	const GEN_FLT x133 = (-1 * x115) + x132;
+	const GEN_FLT x134 = x112 + x33;
+	const GEN_FLT x135 = obj_qj * obj_qj * obj_qj;
+	const GEN_FLT x136 = (-1 * x91 * x14 * obj_qk) + (x110 * obj_qk);
+	const GEN_FLT x137 = x136 + x25;
+	const GEN_FLT x139 = x115 + (-1 * x132);
+	const GEN_FLT x140 = x97 * x14;
+	const GEN_FLT x142 = (-1 * x91 * x13 * obj_qj) + (x121 * obj_qj);
+	const GEN_FLT x152 = x97 * x13;
+	const GEN_FLT x153 = x122 + x33;
+	const GEN_FLT x155 = x142 + x92;
+	const GEN_FLT x157 = obj_qk * obj_qk * obj_qk;
+	const GEN_FLT c0 = x29 + x28;
+	const GEN_FLT c1 = x26 + x24;
+	const GEN_FLT c2 = x19 + (x21 * x13);
+	const GEN_FLT c3 = x19 + (x21 * x14);
+	const GEN_FLT c4 = x34 + x32;
+	const GEN_FLT c5 = x26 + x31;
+	const GEN_FLT c6 = x19 + (x21 * x15);
+	const GEN_FLT c7 = x34 + x39;
+	const GEN_FLT c8 = x29 + x27;
+	const GEN_FLT c9 = tilt_0 * tilt_0;
+	const GEN_FLT c10 = -1 * phase_0;
+	const GEN_FLT c11 = x107 + x103;
+	const GEN_FLT c12 = x101 + x96;
+	const GEN_FLT c13 = (-1 * x89 * x91) + (x89 * x90) + (2 * x33) + x31;
+	const GEN_FLT c14 = x117 + x93 + (-1 * x113);
+	const GEN_FLT c15 = x112 + x31;
+	const GEN_FLT c16 = x109 + x96;
+	const GEN_FLT c17 = x120 + (-1 * x93) + x113;
+	const GEN_FLT c18 = x122 + x31;
+	const GEN_FLT c19 = x119 + x103;
+	const GEN_FLT c20 = x137 + x119;
+	const GEN_FLT c21 = (-1 * x91 * x135) + (x90 * x135) + (2 * x92) + x28;
+	const GEN_FLT c22 = x134 + x133;
+	const GEN_FLT c23 = x120 + (-1 * x110) + x140;
+	const GEN_FLT c24 = x134 + x139;
+	const GEN_FLT c25 = x95 + x28;
+	const GEN_FLT c26 = x142 + x28;
+	const GEN_FLT c27 = x107 + x137;
+	const GEN_FLT c28 = x117 + x110 + (-1 * x140);
+	const GEN_FLT c29 = x133 + x153;
+	const GEN_FLT c30 = x121 + x117 + (-1 * x152);
+	const GEN_FLT c31 = x102 + x39;
+	const GEN_FLT c32 = x155 + x101;
+	const GEN_FLT c33 = x136 + x39;
+	const GEN_FLT c34 = (-1 * x121) + x120 + x152;
+	const GEN_FLT c35 = (-1 * x91 * x157) + (x90 * x157) + x39 + (2 * x25);
+	const GEN_FLT c36 = x155 + x109;
+	const GEN_FLT c37 = x139 + x153;
+	const GEN_FLT c38 = tilt_1 * tilt_1;
+	const GEN_FLT c39 = -1 * phase_1;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x30 = (c0 * sensor_x) + (c1 * sensor_y) + (c2 * sensor_z) + obj_pz;
+		const GEN_FLT x35 = (c3 * sensor_y) + (c4 * sensor_x) + (c5 * sensor_z) + obj_py;
+		const GEN_FLT x40 = (c6 * sensor_x) + (c7 * sensor_y) + (c8 * sensor_z) + obj_px;
+		const GEN_FLT x42 = (x40 * x41) + (x30 * x12) + (x35 * x38) + lh_px;
+		const GEN_FLT x47 = (x40 * x11) + (x46 * x35) + (x43 * x30) + lh_pz;
+		const GEN_FLT x48 = x47 * x47;
+		const GEN_FLT x49 = 1. / x48;
+		const GEN_FLT x50 = x42 * x49;
+		const GEN_FLT x51 = 1. / x47;
+		const GEN_FLT x52 = x42 * x42;
+		const GEN_FLT x53 = x48 + x52;
+		const GEN_FLT x54 = 1. / x53;
+		const GEN_FLT x55 = x54 * x48;
+		const GEN_FLT x56 = ((-1 * x51 * x41) + (x50 * x11)) * x55;
+		const GEN_FLT x57 = 2 * x42;
+		const GEN_FLT x58 = 2 * x47;
+		const GEN_FLT x59 = x58 * x11;
+		const GEN_FLT x63 = lh_py + (x61 * x35) + (x62 * x40) + (x60 * x30);
+		const GEN_FLT x64 = 1.0 / 2.0 * x63 * (1. / (x53 * sqrt(x53))) * tilt_0;
+		const GEN_FLT x65 = (1. / sqrt(x53)) * tilt_0;
+		const GEN_FLT x66 = x63 * x63;
+		const GEN_FLT x67 = 1. / sqrt(1 + (-1 * x66 * x54 * c9));
+		const GEN_FLT x68 = (-1 * x67 * ((x62 * x65) + (-1 * x64 * (x59 + (x57 * x41))))) + (-1 * x56);
+		const GEN_FLT x69 = -1 * x47;
+		const GEN_FLT x70 = atan2(x42, x69);
+		const GEN_FLT x71 = sin(1.5707963267949 + (-1 * x70) + c10 + (-1 * asin(x63 * x65)) + gibPhase_0) * gibMag_0;
+		const GEN_FLT x72 = x63 * x49;
+		const GEN_FLT x73 = x72 * x11;
+		const GEN_FLT x74 = x62 * x51;
+		const GEN_FLT x75 = x48 + x66;
+		const GEN_FLT x76 = 1. / x75;
+		const GEN_FLT x77 = x76 * x48;
+		const GEN_FLT x78 = 2 * x77 * atan2(x63, x69) * curve_0;
+		const GEN_FLT x79 = ((-1 * x51 * x38) + (x50 * x46)) * x55;
+		const GEN_FLT x80 = x58 * x46;
+		const GEN_FLT x81 = (-1 * x67 * ((x61 * x65) + (-1 * x64 * (x80 + (x57 * x38))))) + (-1 * x79);
+		const GEN_FLT x82 = x72 * x46;
+		const GEN_FLT x83 = x61 * x51;
+		const GEN_FLT x84 = ((-1 * x51 * x12) + (x50 * x43)) * x55;
+		const GEN_FLT x85 = x58 * x43;
+		const GEN_FLT x86 = (-1 * x67 * ((x60 * x65) + (-1 * x64 * (x85 + (x57 * x12))))) + (-1 * x84);
+		const GEN_FLT x87 = x72 * x43;
+		const GEN_FLT x88 = x60 * x51;
+		const GEN_FLT x108 = (c11 * sensor_z) + (c12 * sensor_y) + (c13 * sensor_x);
+		const GEN_FLT x118 = (c14 * sensor_z) + (c15 * sensor_y) + (c16 * sensor_x);
+		const GEN_FLT x123 = (c17 * sensor_y) + (c18 * sensor_z) + (c19 * sensor_x);
+		const GEN_FLT x124 = (x43 * x123) + (x46 * x118) + (x11 * x108);
+		const GEN_FLT x125 = (x12 * x123) + (x38 * x118) + (x41 * x108);
+		const GEN_FLT x126 = ((-1 * x51 * x125) + (x50 * x124)) * x55;
+		const GEN_FLT x127 = x58 * x124;
+		const GEN_FLT x128 = (x60 * x123) + (x61 * x118) + (x62 * x108);
+		const GEN_FLT x129 = (-1 * x67 * ((x65 * x128) + (-1 * x64 * (x127 + (x57 * x125))))) + (-1 * x126);
+		const GEN_FLT x130 = x72 * x124;
+		const GEN_FLT x131 = x51 * x128;
+		const GEN_FLT x138 = (c20 * sensor_z) + (c21 * sensor_y) + (c22 * sensor_x);
+		const GEN_FLT x141 = (c23 * sensor_z) + (c24 * sensor_y) + (c25 * sensor_x);
+		const GEN_FLT x143 = (c26 * sensor_z) + (c27 * sensor_y) + (c28 * sensor_x);
+		const GEN_FLT x144 = (x43 * x143) + (x11 * x141) + (x46 * x138);
+		const GEN_FLT x145 = (x12 * x143) + (x38 * x138) + (x41 * x141);
+		const GEN_FLT x146 = ((-1 * x51 * x145) + (x50 * x144)) * x55;
+		const GEN_FLT x147 = x58 * x144;
+		const GEN_FLT x148 = (x60 * x143) + (x61 * x138) + (x62 * x141);
+		const GEN_FLT x149 = (-1 * x67 * ((x65 * x148) + (-1 * x64 * (x147 + (x57 * x145))))) + (-1 * x146);
+		const GEN_FLT x150 = x72 * x144;
+		const GEN_FLT x151 = x51 * x148;
+		const GEN_FLT x154 = (c29 * sensor_z) + (c30 * sensor_y) + (c31 * sensor_x);
+		const GEN_FLT x156 = (c32 * sensor_z) + (c33 * sensor_y) + (c34 * sensor_x);
+		const GEN_FLT x158 = (c35 * sensor_z) + (c36 * sensor_y) + (c37 * sensor_x);
+		const GEN_FLT x159 = (x43 * x158) + (x46 * x156) + (x11 * x154);
+		const GEN_FLT x160 = (x12 * x158) + (x38 * x156) + (x41 * x154);
+		const GEN_FLT x161 = ((-1 * x51 * x160) + (x50 * x159)) * x55;
+		const GEN_FLT x162 = x58 * x159;
+		const GEN_FLT x163 = (x60 * x158) + (x61 * x156) + (x62 * x154);
+		const GEN_FLT x164 = (-1 * x67 * ((x65 * x163) + (-1 * x64 * (x162 + (x57 * x160))))) + (-1 * x161);
+		const GEN_FLT x165 = x72 * x159;
+		const GEN_FLT x166 = x51 * x163;
+		const GEN_FLT x167 = 1. / sqrt(1 + (-1 * x76 * x52 * c38));
+		const GEN_FLT x168 = 2 * x63;
+		const GEN_FLT x169 = 1.0 / 2.0 * (1. / (x75 * sqrt(x75))) * x42 * tilt_1;
+		const GEN_FLT x170 = (1. / sqrt(x75)) * tilt_1;
+		const GEN_FLT x171 = (-1 * x167 * ((x41 * x170) + (-1 * x169 * (x59 + (x62 * x168))))) + (-1 * (x74 + (-1 *
+			x73)) * x77);
+		const GEN_FLT x172 = sin(1.5707963267949 + (-1 * atan2(-1 * x63, x69)) + c39 + (-1 * asin(x42 * x170)) +
+			gibPhase_1) * gibMag_1;
+		const GEN_FLT x173 = 2 * x70 * curve_1;
+		const GEN_FLT x174 = (-1 * x167 * ((x38 * x170) + (-1 * x169 * (x80 + (x61 * x168))))) + (-1 * (x83 + (-1 *
+			x82)) * x77);
+		const GEN_FLT x175 = (-1 * x167 * ((x12 * x170) + (-1 * x169 * (x85 + (x60 * x168))))) + (-1 * (x88 + (-1 *
+			x87)) * x77);
+		const GEN_FLT x176 = (-1 * x167 * ((x125 * x170) + (-1 * x169 * (x127 + (x128 * x168))))) + (-1 * (x131 + (-1 *
+			x130)) * x77);
+		const GEN_FLT x177 = (-1 * x167 * ((x170 * x145) + (-1 * x169 * (x147 + (x168 * x148))))) + (-1 * (x151 + (-1 *
+			x150)) * x77);
+		const GEN_FLT x178 = (-1 * x167 * ((x160 * x170) + (-1 * x169 * (x162 + (x168 * x163))))) + (-1 * (x166 + (-1 *
+			x165)) * x77);
+		out[i] = (((-1 * x74) + x73) * x78) + x68 + (x71 * x68);
+		out[n + i] = x81 + (((-1 * x83) + x82) * x78) + (x81 * x71);
+		out[2 * n + i] = (((-1 * x88) + x87) * x78) + x86 + (x86 * x71);
+		out[3 * n + i] = x129 + (((-1 * x131) + x130) * x78) + (x71 * x129);
+		out[4 * n + i] = x149 + (((-1 * x151) + x150) * x78) + (x71 * x149);
+		out[5 * n + i] = x164 + (((-1 * x166) + x165) * x78) + (x71 * x164);
+		out[6 * n + i] = x171 + (x56 * x173) + (x171 * x172);
+		out[7 * n + i] = x174 + (x79 * x173) + (x174 * x172);
+		out[8 * n + i] = x175 + (x84 * x173) + (x175 * x172);
+		out[9 * n + i] = x176 + (x126 * x173) + (x176 * x172);
+		out[10 * n + i] = x177 + (x173 * x146) + (x177 * x172);
+		out[11 * n + i] = x178 + (x161 * x173) + (x178 * x172);
+	}
+}
+
+static inline void gen_reproject_axis_x_axis_angle_batch(FLT *GEN_RESTRICT out, size_t n,
+														 const LinmathAxisAnglePose *obj_p,
+														 const FLT *GEN_RESTRICT sensor_pt,
+														 const LinmathAxisAnglePose *lh_p, const BaseStationCal *bsc0) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_0 = (*bsc0).phase;
+	const GEN_FLT tilt_0 = (*bsc0).tilt;
+	const GEN_FLT curve_0 = (*bsc0).curve;
+	const GEN_FLT gibPhase_0 = (*bsc0).gibpha;
+	const GEN_FLT gibMag_0 = (*bsc0).gibmag;
+	const GEN_FLT ogeeMag_0 = (*bsc0).ogeephase;
+	const GEN_FLT ogeePhase_0 = (*bsc0).ogeemag;
+	const GEN_FLT x0 = lh_qk * lh_qk;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qi * lh_qi;
+	const GEN_FLT x3 = 1e-10 + x2 + x1 + x0;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = (1. / x4) * sin(x4);
+	const GEN_FLT x6 = x5 * lh_qi;
+	const GEN_FLT x7 = cos(x4);
+	const GEN_FLT x8 = (1. / x3) * (1 + (-1 * x7));
+	const GEN_FLT x9 = x8 * lh_qj;
+	const GEN_FLT x10 = x9 * lh_qk;
+	const GEN_FLT x11 = obj_qk * obj_qk;
+	const GEN_FLT x12 = obj_qj * obj_qj;
+	const GEN_FLT x13 = obj_qi * obj_qi;
+	const GEN_FLT x14 = 1e-10 + x13 + x12 + x11;
+	const GEN_FLT x15 = sqrt(x14);
+	const GEN_FLT x16 = cos(x15);
+	const GEN_FLT x17 = (1. / x14) * (1 + (-1 * x16));
+	const GEN_FLT x18 = (1. / x15) * sin(x15);
+	const GEN_FLT x19 = x18 * obj_qi;
+	const GEN_FLT x20 = x17 * obj_qk;
+	const GEN_FLT x21 = x20 * obj_qj;
+	const GEN_FLT x22 = x18 * obj_qj;
+	const GEN_FLT x23 = x20 * obj_qi;
+	const GEN_FLT x25 = x18 * obj_qk;
+	const GEN_FLT x26 = x17 * obj_qj * obj_qi;
+	const GEN_FLT x29 = x5 * lh_qk;
+	const GEN_FLT x30 = x9 * lh_qi;
+	const GEN_FLT x32 = x5 * lh_qj;
+	const GEN_FLT x33 = x8 * lh_qk * lh_qi;
+	const GEN_FLT c0 = x21 + x19;
+	const GEN_FLT c1 = x23 + (-1 * x22);
+	const GEN_FLT c2 = x16 + (x11 * x17);
+	const GEN_FLT c3 = x26 + x25;
+	const GEN_FLT c4 = x16 + (x12 * x17);
+	const GEN_FLT c5 = x21 + (-1 * x19);
+	const GEN_FLT c6 = x26 + (-1 * x25);
+	const GEN_FLT c7 = x23 + x22;
+	const GEN_FLT c8 = x16 + (x13 * x17);
+	const GEN_FLT c9 = x30 + x29;
+	const GEN_FLT c10 = x7 + (x1 * x8);
+	const GEN_FLT c11 = x10 + (-1 * x6);
+	const GEN_FLT c12 = x33 + (-1 * x32);
+	const GEN_FLT c13 = x10 + x6;
+	const GEN_FLT c14 = x7 + (x0 * x8);
+	const GEN_FLT c15 = x30 + (-1 * x29);
+	const GEN_FLT c16 = x33 + x32;
+	const GEN_FLT c17 = x7 + (x2 * x8);
+	const GEN_FLT c18 = -1 * phase_0;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x24 = (c0 * sensor_y) + (c1 * sensor_x) + (c2 * sensor_z) + obj_pz;
+		const GEN_FLT x27 = (c3 * sensor_x) + (c4 * sensor_y) + (c5 * sensor_z) + obj_py;
+		const GEN_FLT x28 = (c6 * sensor_y) + (c7 * sensor_z) + (c8 * sensor_x) + obj_px;
+		const GEN_FLT x31 = lh_py + (c9 * x28) + (x27 * c10) + (x24 * c11);
+		const GEN_FLT x34 = (c12 * x28) + (x27 * c13) + (x24 * c14) + lh_pz;
+		const GEN_FLT x35 = -1 * x34;
+		const GEN_FLT x36 = (c15 * x27) + (c16 * x24) + (x28 * c17) + lh_px;
+		const GEN_FLT x37 = (-1 * atan2(x36, x35)) + c18 + (-1 * asin((1. / sqrt((x36 * x36) + (x34 * x34))) * x31 *
+			tilt_0));
+		out[i] = x37 + (-1 * cos(1.5707963267949 + x37 + gibPhase_0) * gibMag_0) + ((atan2(x31, x35) * atan2(x31, x35))
+			* curve_0);
+	}
+}
+
+// Jacobian of reproject_axis_x wrt [obj_px, obj_py, obj_pz, obj_qi, obj_qj, obj_qk]
+static inline void gen_reproject_axis_x_jac_obj_p_axis_angle_batch(FLT *GEN_RESTRICT out, size_t n,
+																   const LinmathAxisAnglePose *obj_p,
+																   const FLT *GEN_RESTRICT sensor_pt,
+																   const LinmathAxisAnglePose *lh_p,
+																   const BaseStationCal *bsc0) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_0 = (*bsc0).phase;
+	const GEN_FLT tilt_0 = (*bsc0).tilt;
+	const GEN_FLT curve_0 = (*bsc0).curve;
+	const GEN_FLT gibPhase_0 = (*bsc0).gibpha;
+	const GEN_FLT gibMag_0 = (*bsc0).gibmag;
+	const GEN_FLT ogeeMag_0 = (*bsc0).ogeephase;
+	const GEN_FLT ogeePhase_0 = (*bsc0).ogeemag;
+	const GEN_FLT x0 = lh_qk * lh_qk;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qi * lh_qi;
+	const GEN_FLT x3 = 1e-10 + x2 + x1 + x0;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = (1. / x4) * sin(x4);
+	const GEN_FLT x6 = x5 * lh_qj;
+	const GEN_FLT x7 = cos(x4);
+	const GEN_FLT x8 = (1. / x3) * (1 + (-1 * x7));
+	const GEN_FLT x9 = x8 * lh_qk * lh_qi;
+	const GEN_FLT x10 = x9 + (-1 * x6);
+	const GEN_FLT x11 = x9 + x6;
+	const GEN_FLT x12 = obj_qk * obj_qk;
+	const GEN_FLT x13 = obj_qj * obj_qj;
+	const GEN_FLT x14 = obj_qi * obj_qi;
+	const GEN_FLT x15 = 1e-10 + x14 + x13 + x12;
+	const GEN_FLT x16 = 1. / x15;
+	const GEN_FLT x17 = sqrt(x15);
+	const GEN_FLT x18 = cos(x17);
+	const GEN_FLT x19 = 1 + (-1 * x18);
+	const GEN_FLT x20 = x19 * x16;
+	const GEN_FLT x21 = sin(x17);
+	const GEN_FLT x22 = x21 * (1. / x17);
+	const GEN_FLT x23 = x22 * obj_qi;
+	const GEN_FLT x24 = x20 * obj_qj;
+	const GEN_FLT x25 = x24 * obj_qk;
+	const GEN_FLT x26 = x22 * obj_qj;
+	const GEN_FLT x27 = -1 * x26;
+	const GEN_FLT x28 = x20 * obj_qi;
+	const GEN_FLT x29 = x28 * obj_qk;
+	const GEN_FLT x31 = -1 * x23;
+	const GEN_FLT x32 = x22 * obj_qk;
+	const GEN_FLT x33 = x24 * obj_qi;
+	const GEN_FLT x35 = x5 * lh_qk;
+	const GEN_FLT x36 = x8 * lh_qj;
+	const GEN_FLT x37 = x36 * lh_qi;
+	const GEN_FLT x38 = x37 + (-1 * x35);
+	const GEN_FLT x39 = -1 * x32;
+	const GEN_FLT x41 = x7 + (x2 * x8);
+	const GEN_FLT x43 = x7 + (x0 * x8);
+	const GEN_FLT x44 = x5 * lh_qi;
+	const GEN_FLT x45 = x36 * lh_qk;
+	const GEN_FLT x46 = x45 + x44;
+	const GEN_FLT x57 = x45 + (-1 * x44);
+	const GEN_FLT x58 = x7 + (x1 * x8);
+	const GEN_FLT x59 = x37 + x35;
+	const GEN_FLT x72 = obj_qi * obj_qi * obj_qi;
+	const GEN_FLT x73 = x21 * (1. / (x15 * sqrt(x15)));
+	const GEN_FLT x74 = 2 * (1. / (x15 * x15)) * x19;
+	const GEN_FLT x75 = x73 * x14;
+	const GEN_FLT x76 = x74 * obj_qj;
+	const GEN_FLT x77 = (-1 * x76 * x14) + (x75 * obj_qj);
+	const GEN_FLT x78 = x77 + x24;
+	const GEN_FLT x79 = x18 * x16;
+	const GEN_FLT x80 = x79 * obj_qk;
+	const GEN_FLT x81 = x80 * obj_qi;
+	const GEN_FLT x82 = x73 * obj_qk;
+	const GEN_FLT x83 = x82 * obj_qi;
+	const GEN_FLT x84 = x83 + (-1 * x81);
+	const GEN_FLT x85 = x20 * obj_qk;
+	const GEN_FLT x86 = x74 * obj_qk;
+	const GEN_FLT x87 = (-1 * x86 * x14) + (x75 * obj_qk);
+	const GEN_FLT x88 = x87 + x85;
+	const GEN_FLT x89 = obj_qj * obj_qi;
+	const GEN_FLT x90 = x89 * x79;
+	const GEN_FLT x91 = x89 * x73;
+	const GEN_FLT x92 = (-1 * x91) + x90;
+	const GEN_FLT x94 = (-1 * x83) + x81;
+	const GEN_FLT x95 = x73 * x13;
+	const GEN_FLT x96 = x74 * obj_qi;
+	const GEN_FLT x97 = (-1 * x96 * x13) + (x95 * obj_qi);
+	const GEN_FLT x98 = x79 * x14;
+	const GEN_FLT x99 = x82 * obj_qj;
+	const GEN_FLT x100 = (-1 * x89 * x86) + (x99 * obj_qi);
+	const GEN_FLT x101 = x100 + (-1 * x22);
+	const GEN_FLT x103 = x91 + (-1 * x90);
+	const GEN_FLT x104 = x100 + x22;
+	const GEN_FLT x105 = x73 * x12;
+	const GEN_FLT x106 = (-1 * x96 * x12) + (x105 * obj_qi);
+	const GEN_FLT x112 = x80 * obj_qj;
+	const GEN_FLT x113 = (-1 * x99) + x112;
+	const GEN_FLT x114 = x97 + x28;
+	const GEN_FLT x115 = obj_qj * obj_qj * obj_qj;
+	const GEN_FLT x116 = (-1 * x86 * x13) + (x95 * obj_qk);
+	const GEN_FLT x117 = x116 + x85;
+	const GEN_FLT x119 = x99 + (-1 * x112);
+	const GEN_FLT x120 = x79 * x13;
+	const GEN_FLT x122 = (-1 * x76 * x12) + (x105 * obj_qj);
+	const GEN_FLT x129 = x79 * x12;
+	const GEN_FLT x130 = x106 + x28;
+	const GEN_FLT x132 = x122 + x24;
+	const GEN_FLT x134 = obj_qk * obj_qk * obj_qk;
+	const GEN_FLT c0 = x29 + x27;
+	const GEN_FLT c1 = x25 + x23;
+	const GEN_FLT c2 = x18 + (x20 * x12);
+	const GEN_FLT c3 = x33 + x32;
+	const GEN_FLT c4 = x25 + x31;
+	const GEN_FLT c5 = x18 + (x20 * x13);
+	const GEN_FLT c6 = x18 + (x20 * x14);
+	const GEN_FLT c7 = x33 + x39;
+	const GEN_FLT c8 = x29 + x26;
+	const GEN_FLT c9 = tilt_0 * tilt_0;
+	const GEN_FLT c10 = -1 * phase_0;
+	const GEN_FLT c11 = x92 + x88;
+	const GEN_FLT c12 = x84 + x78;
+	const GEN_FLT c13 = (-1 * x72 * x74) + (x73 * x72) + (2 * x28) + x31;
+	const GEN_FLT c14 = x97 + x31;
+	const GEN_FLT c15 = x75 + x101 + (-1 * x98);
+	const GEN_FLT c16 = x94 + x78;
+	const GEN_FLT c17 = x106 + x31;
+	const GEN_FLT c18 = x104 + (-1 * x75) + x98;
+	const GEN_FLT c19 = x103 + x88;
+	const GEN_FLT c20 = x103 + x117;
+	const GEN_FLT c21 = (-1 * x74 * x115) + (x73 * x115) + (2 * x24) + x27;
+	const GEN_FLT c22 = x114 + x113;
+	const GEN_FLT c23 = (-1 * x95) + x104 + x120;
+	const GEN_FLT c24 = x114 + x119;
+	const GEN_FLT c25 = x77 + x27;
+	const GEN_FLT c26 = x122 + x27;
+	const GEN_FLT c27 = x117 + x92;
+	const GEN_FLT c28 = x101 + x95 + (-1 * x120);
+	const GEN_FLT c29 = x113 + x130;
+	const GEN_FLT c30 = x101 + x105 + (-1 * x129);
+	const GEN_FLT c31 = x87 + x39;
+	const GEN_FLT c32 = x132 + x84;
+	const GEN_FLT c33 = x116 + x39;
+	const GEN_FLT c34 = x104 + (-1 * x105) + x129;
+	const GEN_FLT c35 = x39 + (x73 * x134) + (-1 * x74 * x134) + (2 * x85);
+	const GEN_FLT c36 = x132 + x94;
+	const GEN_FLT c37 = x119 + x130;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x30 = (c0 * sensor_x) + (c1 * sensor_y) + (c2 * sensor_z) + obj_pz;
+		const GEN_FLT x34 = (c3 * sensor_x) + (c4 * sensor_z) + (c5 * sensor_y) + obj_py;
+		const GEN_FLT x40 = (c6 * sensor_x) + (c7 * sensor_y) + (c8 * sensor_z) + obj_px;
+		const GEN_FLT x42 = (x40 * x41) + (x30 * x11) + (x34 * x38) + lh_px;
+		const GEN_FLT x47 = (x40 * x10) + (x46 * x34) + (x43 * x30) + lh_pz;
+		const GEN_FLT x48 = x47 * x47;
+		const GEN_FLT x49 = 1. / x48;
+		const GEN_FLT x50 = x42 * x49;
+		const GEN_FLT x51 = 1. / x47;
+		const GEN_FLT x52 = x48 + (x42 * x42);
+		const GEN_FLT x53 = 1. / x52;
+		const GEN_FLT x54 = x53 * x48;
+		const GEN_FLT x55 = 2 * x42;
+		const GEN_FLT x56 = 2 * x47;
+		const GEN_FLT x60 = (x59 * x40) + lh_py + (x58 * x34) + (x57 * x30);
+		const GEN_FLT x61 = 1.0 / 2.0 * x60 * (1. / (x52 * sqrt(x52))) * tilt_0;
+		const GEN_FLT x62 = (1. / sqrt(x52)) * tilt_0;
+		const GEN_FLT x63 = x60 * x60;
+		const GEN_FLT x64 = 1. / sqrt(1 + (-1 * x63 * x53 * c9));
+		const GEN_FLT x65 = (-1 * x64 * ((x62 * x59) + (-1 * ((x56 * x10) + (x55 * x41)) * x61))) + (-1 * ((-1 * x51 *
+			x41) + (x50 * x10)) * x54);
+		const GEN_FLT x66 = -1 * x47;
+		const GEN_FLT x67 = sin(1.5707963267949 + c10 + (-1 * atan2(x42, x66)) + (-1 * asin(x60 * x62)) + gibPhase_0) *
+			gibMag_0;
+		const GEN_FLT x68 = x60 * x49;
+		const GEN_FLT x69 = 2 * (1. / (x48 + x63)) * x48 * atan2(x60, x66) * curve_0;
+		const GEN_FLT x70 = (-1 * x64 * ((x62 * x58) + (-1 * ((x56 * x46) + (x55 * x38)) * x61))) + (-1 * ((-1 * x51 *
+			x38) + (x50 * x46)) * x54);
+		const GEN_FLT x71 = (-1 * x64 * ((x62 * x57) + (-1 * ((x56 * x43) + (x55 * x11)) * x61))) + (-1 * ((-1 * x51 *
+			x11) + (x50 * x43)) * x54);
+		const GEN_FLT x93 = (c11 * sensor_z) + (c12 * sensor_y) + (c13 * sensor_x);
+		const GEN_FLT x102 = (c14 * sensor_y) + (c15 * sensor_z) + (c16 * sensor_x);
+		const GEN_FLT x107 = (c17 * sensor_z) + (c18 * sensor_y) + (c19 * sensor_x);
+		const GEN_FLT x108 = (x43 * x107) + (x46 * x102) + (x93 * x10);
+		const GEN_FLT x109 = (x11 * x107) + (x38 * x102) + (x93 * x41);
+		const GEN_FLT x110 = (x57 * x107) + (x58 * x102) + (x59 * x93);
+		const GEN_FLT x111 = (-1 * x64 * ((x62 * x110) + (-1 * ((x56 * x108) + (x55 * x109)) * x61))) + (-1 * ((-1 *
+			x51 * x109) + (x50 * x108)) * x54);
+		const GEN_FLT x118 = (c20 * sensor_z) + (c21 * sensor_y) + (c22 * sensor_x);
+		const GEN_FLT x121 = (c23 * sensor_z) + (c24 * sensor_y) + (c25 * sensor_x);
+		const GEN_FLT x123 = (c26 * sensor_z) + (c27 * sensor_y) + (c28 * sensor_x);
+		const GEN_FLT x124 = (x43 * x123) + (x10 * x121) + (x46 * x118);
+		const GEN_FLT x125 = x49 * x124;
+		const GEN_FLT x126 = (x11 * x123) + (x38 * x118) + (x41 * x121);
+		const GEN_FLT x127 = (x57 * x123) + (x58 * x118) + (x59 * x121);
+		const GEN_FLT x128 = (-1 * x64 * ((x62 * x127) + (-1 * ((x56 * x124) + (x55 * x126)) * x61))) + (-1 * ((-1 *
+			x51 * x126) + (x42 * x125)) * x54);
+		const GEN_FLT x131 = (c29 * sensor_z) + (c30 * sensor_y) + (c31 * sensor_x);
+		const GEN_FLT x133 = (c32 * sensor_z) + (c33 * sensor_y) + (c34 * sensor_x);
+		const GEN_FLT x135 = (c35 * sensor_z) + (c36 * sensor_y) + (c37 * sensor_x);
+		const GEN_FLT x136 = (x43 * x135) + (x46 * x133) + (x10 * x131);
+		const GEN_FLT x137 = (x11 * x135) + (x38 * x133) + (x41 * x131);
+		const GEN_FLT x138 = (x57 * x135) + (x58 * x133) + (x59 * x131);
+		const GEN_FLT x139 = (-1 * x64 * ((x62 * x138) + (-1 * ((x56 * x136) + (x55 * x137)) * x61))) + (-1 * ((-1 *
+			x51 * x137) + (x50 * x136)) * x54);
+		out[i] = x65 + (((-1 * x51 * x59) + (x68 * x10)) * x69) + (x67 * x65);
+		out[n + i] = x70 + (((-1 * x51 * x58) + (x68 * x46)) * x69) + (x70 * x67);
+		out[2 * n + i] = (((-1 * x51 * x57) + (x68 * x43)) * x69) + x71 + (x71 * x67);
+		out[3 * n + i] = x111 + (((-1 * x51 * x110) + (x68 * x108)) * x69) + (x67 * x111);
+		out[4 * n + i] = x128 + (((-1 * x51 * x127) + (x60 * x125)) * x69) + (x67 * x128);
+		out[5 * n + i] = x139 + (((-1 * x51 * x138) + (x68 * x136)) * x69) + (x67 * x139);
+	}
+}
+
+static inline void gen_reproject_axis_y_axis_angle_batch(FLT *GEN_RESTRICT out, size_t n,
+														 const LinmathAxisAnglePose *obj_p,
+														 const FLT *GEN_RESTRICT sensor_pt,
+														 const LinmathAxisAnglePose *lh_p, const BaseStationCal *bsc1) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_1 = (*bsc1).phase;
+	const GEN_FLT tilt_1 = (*bsc1).tilt;
+	const GEN_FLT curve_1 = (*bsc1).curve;
+	const GEN_FLT gibPhase_1 = (*bsc1).gibpha;
+	const GEN_FLT gibMag_1 = (*bsc1).gibmag;
+	const GEN_FLT ogeeMag_1 = (*bsc1).ogeephase;
+	const GEN_FLT ogeePhase_1 = (*bsc1).ogeemag;
+	const GEN_FLT x0 = lh_qk * lh_qk;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qi * lh_qi;
+	const GEN_FLT x3 = 1e-10 + x2 + x1 + x0;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = (1. / x4) * sin(x4);
+	const GEN_FLT x6 = x5 * lh_qj;
+	const GEN_FLT x7 = cos(x4);
+	const GEN_FLT x8 = (1. / x3) * (1 + (-1 * x7));
+	const GEN_FLT x9 = x8 * lh_qk * lh_qi;
+	const GEN_FLT x10 = obj_qk * obj_qk;
+	const GEN_FLT x11 = obj_qj * obj_qj;
+	const GEN_FLT x12 = obj_qi * obj_qi;
+	const GEN_FLT x13 = 1e-10 + x12 + x11 + x10;
+	const GEN_FLT x14 = sqrt(x13);
+	const GEN_FLT x15 = cos(x14);
+	const GEN_FLT x16 = (1. / x13) * (1 + (-1 * x15));
+	const GEN_FLT x17 = (1. / x14) * sin(x14);
+	const GEN_FLT x18 = x17 * obj_qi;
+	const GEN_FLT x19 = x16 * obj_qk;
+	const GEN_FLT x20 = x19 * obj_qj;
+	const GEN_FLT x21 = x17 * obj_qj;
+	const GEN_FLT x22 = x19 * obj_qi;
+	const GEN_FLT x24 = x17 * obj_qk;
+	const GEN_FLT x25 = x16 * obj_qj * obj_qi;
+	const GEN_FLT x27 = x5 * lh_qk;
+	const GEN_FLT x28 = x8 * lh_qj;
+	const GEN_FLT x29 = x28 * lh_qi;
+	const GEN_FLT x32 = x5 * lh_qi;
+	const GEN_FLT x33 = x28 * lh_qk;
+	const GEN_FLT c0 = x20 + x18;
+	const GEN_FLT c1 = x22 + (-1 * x21);
+	const GEN_FLT c2 = x15 + (x10 * x16);
+	const GEN_FLT c3 = x25 + x24;
+	const GEN_FLT c4 = x15 + (x11 * x16);
+	const GEN_FLT c5 = x20 + (-1 * x18);
+	const GEN_FLT c6 = x15 + (x12 * x16);
+	const GEN_FLT c7 = x25 + (-1 * x24);
+	const GEN_FLT c8 = x22 + x21;
+	const GEN_FLT c9 = x9 + x6;
+	const GEN_FLT c10 = x7 + (x2 * x8);
+	const GEN_FLT c11 = x29 + (-1 * x27);
+	const GEN_FLT c12 = x9 + (-1 * x6);
+	const GEN_FLT c13 = x33 + x32;
+	const GEN_FLT c14 = x7 + (x0 * x8);
+	const GEN_FLT c15 = x29 + x27;
+	const GEN_FLT c16 = x7 + (x1 * x8);
+	const GEN_FLT c17 = x33 + (-1 * x32);
+	const GEN_FLT c18 = -1 * phase_1;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x23 = (c0 * sensor_y) + (c1 * sensor_x) + (c2 * sensor_z) + obj_pz;
+		const GEN_FLT x26 = (c3 * sensor_x) + (c4 * sensor_y) + (c5 * sensor_z) + obj_py;
+		const GEN_FLT x30 = (c6 * sensor_x) + (c7 * sensor_y) + (c8 * sensor_z) + obj_px;
+		const GEN_FLT x31 = (c9 * x23) + (x30 * c10) + (c11 * x26) + lh_px;
+		const GEN_FLT x34 = (c12 * x30) + (c13 * x26) + (x23 * c14) + lh_pz;
+		const GEN_FLT x35 = -1 * x34;
+		const GEN_FLT x36 = (c15 * x30) + lh_py + (x26 * c16) + (c17 * x23);
+		const GEN_FLT x37 = (-1 * atan2(-1 * x36, x35)) + c18 + (-1 * asin((1. / sqrt((x36 * x36) + (x34 * x34))) * x31
+			* tilt_1));
+		out[i] = x37 + (-1 * cos(1.5707963267949 + x37 + gibPhase_1) * gibMag_1) + ((atan2(x31, x35) * atan2(x31, x35))
+			* curve_1);
+	}
+}
+
+// Jacobian of reproject_axis_y wrt [obj_px, obj_py, obj_pz, obj_qi, obj_qj, obj_qk]
+static inline void gen_reproject_axis_y_jac_obj_p_axis_angle_batch(FLT *GEN_RESTRICT out, size_t n,
+																   const LinmathAxisAnglePose *obj_p,
+																   const FLT *GEN_RESTRICT sensor_pt,
+																   const LinmathAxisAnglePose *lh_p,
+																   const BaseStationCal *bsc1) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_1 = (*bsc1).phase;
+	const GEN_FLT tilt_1 = (*bsc1).tilt;
+	const GEN_FLT curve_1 = (*bsc1).curve;
+	const GEN_FLT gibPhase_1 = (*bsc1).gibpha;
+	const GEN_FLT gibMag_1 = (*bsc1).gibmag;
+	const GEN_FLT ogeeMag_1 = (*bsc1).ogeephase;
+	const GEN_FLT ogeePhase_1 = (*bsc1).ogeemag;
+	const GEN_FLT x0 = lh_qk * lh_qk;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qi * lh_qi;
+	const GEN_FLT x3 = 1e-10 + x2 + x1 + x0;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = (1. / x4) * sin(x4);
+	const GEN_FLT x6 = x5 * lh_qj;
+	const GEN_FLT x7 = cos(x4);
+	const GEN_FLT x8 = (1. / x3) * (1 + (-1 * x7));
+	const GEN_FLT x9 = x8 * lh_qk * lh_qi;
+	const GEN_FLT x10 = x9 + (-1 * x6);
+	const GEN_FLT x11 = x5 * lh_qi;
+	const GEN_FLT x12 = x8 * lh_qj;
+	const GEN_FLT x13 = x12 * lh_qk;
+	const GEN_FLT x14 = x13 + (-1 * x11);
+	const GEN_FLT x15 = obj_qk * obj_qk;
+	const GEN_FLT x16 = obj_qj * obj_qj;
+	const GEN_FLT x17 = obj_qi * obj_qi;
+	const GEN_FLT x18 = 1e-10 + x17 + x16 + x15;
+	const GEN_FLT x19 = 1. / x18;
+	const GEN_FLT x20 = sqrt(x18);
+	const GEN_FLT x21 = cos(x20);
+	const GEN_FLT x22 = 1 + (-1 * x21);
+	const GEN_FLT x23 = x22 * x19;
+	const GEN_FLT x24 = sin(x20);
+	const GEN_FLT x25 = x24 * (1. / x20);
+	const GEN_FLT x26 = x25 * obj_qi;
+	const GEN_FLT x27 = x23 * obj_qk;
+	const GEN_FLT x28 = x27 * obj_qj;
+	const GEN_FLT x29 = x25 * obj_qj;
+	const GEN_FLT x30 = -1 * x29;
+	const GEN_FLT x31 = x27 * obj_qi;
+	const GEN_FLT x33 = -1 * x26;
+	const GEN_FLT x34 = x25 * obj_qk;
+	const GEN_FLT x35 = x23 * obj_qi;
+	const GEN_FLT x36 = x35 * obj_qj;
+	const GEN_FLT x38 = x7 + (x1 * x8);
+	const GEN_FLT x39 = -1 * x34;
+	const GEN_FLT x41 = x5 * lh_qk;
+	const GEN_FLT x42 = x12 * lh_qi;
+	const GEN_FLT x43 = x42 + x41;
+	const GEN_FLT x45 = x7 + (x0 * x8);
+	const GEN_FLT x46 = x13 + x11;
+	const GEN_FLT x55 = x9 + x6;
+	const GEN_FLT x56 = x42 + (-1 * x41);
+	const GEN_FLT x57 = x7 + (x2 * x8);
+	const GEN_FLT x72 = obj_qi * obj_qi * obj_qi;
+	const GEN_FLT x73 = x24 * (1. / (x18 * sqrt(x18)));
+	const GEN_FLT x74 = 2 * x22 * (1. / (x18 * x18));
+	const GEN_FLT x75 = x21 * x19;
+	const GEN_FLT x76 = x75 * obj_qk;
+	const GEN_FLT x77 = x76 * obj_qi;
+	const GEN_FLT x78 = x73 * obj_qk;
+	const GEN_FLT x79 = x78 * obj_qi;
+	const GEN_FLT x80 = x79 + (-1 * x77);
+	const GEN_FLT x81 = x23 * obj_qj;
+	const GEN_FLT x82 = x73 * x17;
+	const GEN_FLT x83 = (-1 * x74 * x17 * obj_qj) + (x82 * obj_qj);
+	const GEN_FLT x84 = x83 + x81;
+	const GEN_FLT x85 = obj_qj * obj_qi;
+	const GEN_FLT x86 = x85 * x75;
+	const GEN_FLT x87 = x85 * x73;
+	const GEN_FLT x88 = (-1 * x87) + x86;
+	const GEN_FLT x89 = x74 * obj_qk;
+	const GEN_FLT x90 = (-1 * x89 * x17) + (x82 * obj_qk);
+	const GEN_FLT x91 = x90 + x27;
+	const GEN_FLT x93 = (-1 * x79) + x77;
+	const GEN_FLT x94 = x73 * x16;
+	const GEN_FLT x95 = (-1 * x74 * x16 * obj_qi) + (x94 * obj_qi);
+	const GEN_FLT x96 = x75 * x17;
+	const GEN_FLT x97 = x78 * obj_qj;
+	const GEN_FLT x98 = (-1 * x89 * x85) + (x97 * obj_qi);
+	const GEN_FLT x99 = x98 + (-1 * x25);
+	const GEN_FLT x101 = x87 + (-1 * x86);
+	const GEN_FLT x102 = x98 + x25;
+	const GEN_FLT x103 = x73 * x15;
+	const GEN_FLT x104 = x74 * x15;
+	const GEN_FLT x105 = (-1 * x104 * obj_qi) + (x103 * obj_qi);
+	const GEN_FLT x111 = x76 * obj_qj;
+	const GEN_FLT x112 = (-1 * x97) + x111;
+	const GEN_FLT x113 = x95 + x35;
+	const GEN_FLT x114 = obj_qj * obj_qj * obj_qj;
+	const GEN_FLT x115 = (-1 * x89 * x16) + (x94 * obj_qk);
+	const GEN_FLT x116 = x115 + x27;
+	const GEN_FLT x118 = x97 + (-1 * x111);
+	const GEN_FLT x119 = x75 * x16;
+	const GEN_FLT x121 = (-1 * x104 * obj_qj) + (x103 * obj_qj);
+	const GEN_FLT x127 = x75 * x15;
+	const GEN_FLT x128 = x105 + x35;
+	const GEN_FLT x130 = x121 + x81;
+	const GEN_FLT x132 = obj_qk * obj_qk * obj_qk;
+	const GEN_FLT c0 = x31 + x30;
+	const GEN_FLT c1 = x28 + x26;
+	const GEN_FLT c2 = x21 + (x23 * x15);
+	const GEN_FLT c3 = x36 + x34;
+	const GEN_FLT c4 = x21 + (x23 * x16);
+	const GEN_FLT c5 = x28 + x33;
+	const GEN_FLT c6 = x21 + (x23 * x17);
+	const GEN_FLT c7 = x36 + x39;
+	const GEN_FLT c8 = x31 + x29;
+	const GEN_FLT c9 = tilt_1 * tilt_1;
+	const GEN_FLT c10 = -1 * phase_1;
+	const GEN_FLT c11 = x91 + x88;
+	const GEN_FLT c12 = x84 + x80;
+	const GEN_FLT c13 = (-1 * x72 * x74) + (x73 * x72) + (2 * x35) + x33;
+	const GEN_FLT c14 = x99 + x82 + (-1 * x96);
+	const GEN_FLT c15 = x95 + x33;
+	const GEN_FLT c16 = x84 + x93;
+	const GEN_FLT c17 = x105 + x33;
+	const GEN_FLT c18 = x102 + (-1 * x82) + x96;
+	const GEN_FLT c19 = x91 + x101;
+	const GEN_FLT c20 = x101 + x116;
+	const GEN_FLT c21 = (x73 * x114) + (-1 * x74 * x114) + (2 * x81) + x30;
+	const GEN_FLT c22 = x113 + x112;
+	const GEN_FLT c23 = x102 + (-1 * x94) + x119;
+	const GEN_FLT c24 = x113 + x118;
+	const GEN_FLT c25 = x83 + x30;
+	const GEN_FLT c26 = x121 + x30;
+	const GEN_FLT c27 = x88 + x116;
+	const GEN_FLT c28 = x99 + x94 + (-1 * x119);
+	const GEN_FLT c29 = x112 + x128;
+	const GEN_FLT c30 = x103 + x99 + (-1 * x127);
+	const GEN_FLT c31 = x90 + x39;
+	const GEN_FLT c32 = x80 + x130;
+	const GEN_FLT c33 = x115 + x39;
+	const GEN_FLT c34 = x102 + (-1 * x103) + x127;
+	const GEN_FLT c35 = (-1 * x74 * x132) + x39 + (x73 * x132) + (2 * x27);
+	const GEN_FLT c36 = x93 + x130;
+	const GEN_FLT c37 = x118 + x128;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x32 = (c0 * sensor_x) + (c1 * sensor_y) + (c2 * sensor_z) + obj_pz;
+		const GEN_FLT x37 = (c3 * sensor_x) + (c4 * sensor_y) + (c5 * sensor_z) + obj_py;
+		const GEN_FLT x40 = (c6 * sensor_x) + (c7 * sensor_y) + (c8 * sensor_z) + obj_px;
+		const GEN_FLT x44 = (x40 * x43) + lh_py + (x38 * x37) + (x32 * x14);
+		const GEN_FLT x47 = (x40 * x10) + (x46 * x37) + (x45 * x32) + lh_pz;
+		const GEN_FLT x48 = x47 * x47;
+		const GEN_FLT x49 = 1. / x48;
+		const GEN_FLT x50 = x44 * x49;
+		const GEN_FLT x51 = 1. / x47;
+		const GEN_FLT x52 = (x44 * x44) + x48;
+		const GEN_FLT x53 = 1. / x52;
+		const GEN_FLT x54 = x53 * x48;
+		const GEN_FLT x58 = (x57 * x40) + (x56 * x37) + (x55 * x32) + lh_px;
+		const GEN_FLT x59 = x58 * x58;
+		const GEN_FLT x60 = 1. / sqrt(1 + (-1 * x53 * x59 * c9));
+		const GEN_FLT x61 = 2 * x44;
+		const GEN_FLT x62 = 2 * x47;
+		const GEN_FLT x63 = 1.0 / 2.0 * (1. / (x52 * sqrt(x52))) * x58 * tilt_1;
+		const GEN_FLT x64 = (1. / sqrt(x52)) * tilt_1;
+		const GEN_FLT x65 = (-1 * x60 * ((x64 * x57) + (-1 * ((x62 * x10) + (x61 * x43)) * x63))) + (-1 * ((x51 * x43)
+			+ (-1 * x50 * x10)) * x54);
+		const GEN_FLT x66 = -1 * x47;
+		const GEN_FLT x67 = sin(1.5707963267949 + (-1 * atan2(-1 * x44, x66)) + c10 + (-1 * asin(x64 * x58)) +
+			gibPhase_1) * gibMag_1;
+		const GEN_FLT x68 = x58 * x49;
+		const GEN_FLT x69 = 2 * (1. / (x48 + x59)) * x48 * atan2(x58, x66) * curve_1;
+		const GEN_FLT x70 = (-1 * x60 * ((x64 * x56) + (-1 * ((x62 * x46) + (x61 * x38)) * x63))) + (-1 * ((x51 * x38)
+			+ (-1 * x50 * x46)) * x54);
+		const GEN_FLT x71 = (-1 * x60 * ((x64 * x55) + (-1 * ((x62 * x45) + (x61 * x14)) * x63))) + (-1 * ((x51 * x14)
+			+ (-1 * x50 * x45)) * x54);
+		const GEN_FLT x92 = (c11 * sensor_z) + (c12 * sensor_y) + (c13 * sensor_x);
+		const GEN_FLT x100 = (c14 * sensor_z) + (c15 * sensor_y) + (c16 * sensor_x);
+		const GEN_FLT x106 = (c17 * sensor_z) + (c18 * sensor_y) + (c19 * sensor_x);
+		const GEN_FLT x107 = (x45 * x106) + (x46 * x100) + (x92 * x10);
+		const GEN_FLT x108 = (x14 * x106) + (x38 * x100) + (x92 * x43);
+		const GEN_FLT x109 = (x55 * x106) + (x56 * x100) + (x57 * x92);
+		const GEN_FLT x110 = (-1 * x60 * ((x64 * x109) + (-1 * ((x62 * x107) + (x61 * x108)) * x63))) + (-1 * ((x51 *
+			x108) + (-1 * x50 * x107)) * x54);
+		const GEN_FLT x117 = (c20 * sensor_z) + (c21 * sensor_y) + (c22 * sensor_x);
+		const GEN_FLT x120 = (c23 * sensor_z) + (c24 * sensor_y) + (c25 * sensor_x);
+		const GEN_FLT x122 = (c26 * sensor_z) + (c27 * sensor_y) + (c28 * sensor_x);
+		const GEN_FLT x123 = (x45 * x122) + (x10 * x120) + (x46 * x117);
+		const GEN_FLT x124 = (x14 * x122) + (x38 * x117) + (x43 * x120);
+		const GEN_FLT x125 = (x55 * x122) + (x56 * x117) + (x57 * x120);
+		const GEN_FLT x126 = (-1 * x60 * ((x64 * x125) + (-1 * ((x62 * x123) + (x61 * x124)) * x63))) + (-1 * ((x51 *
+			x124) + (-1 * x50 * x123)) * x54);
+		const GEN_FLT x129 = (c29 * sensor_z) + (c30 * sensor_y) + (c31 * sensor_x);
+		const GEN_FLT x131 = (c32 * sensor_z) + (c33 * sensor_y) + (c34 * sensor_x);
+		const GEN_FLT x133 = (c35 * sensor_z) + (c36 * sensor_y) + (c37 * sensor_x);
+		const GEN_FLT x134 = (x45 * x133) + (x46 * x131) + (x10 * x129);
+		const GEN_FLT x135 = (x38 * x131) + (x14 * x133) + (x43 * x129);
+		const GEN_FLT x136 = (x55 * x133) + (x56 * x131) + (x57 * x129);
+		const GEN_FLT x137 = (-1 * x60 * ((x64 * x136) + (-1 * ((x62 * x134) + (x61 * x135)) * x63))) + (-1 * ((x51 *
+			x135) + (-1 * x50 * x134)) * x54);
+		out[i] = x65 + (((-1 * x51 * x57) + (x68 * x10)) * x69) + (x67 * x65);
+		out[n + i] = x70 + (((-1 * x51 * x56) + (x68 * x46)) * x69) + (x70 * x67);
+		out[2 * n + i] = (((-1 * x51 * x55) + (x68 * x45)) * x69) + x71 + (x71 * x67);
+		out[3 * n + i] = x110 + (((-1 * x51 * x109) + (x68 * x107)) * x69) + (x67 * x110);
+		out[4 * n + i] = x126 + (((-1 * x51 * x125) + (x68 * x123)) * x69) + (x67 * x126);
+		out[5 * n + i] = x137 + (((-1 * x51 * x136) + (x68 * x134)) * x69) + (x67 * x137);
+	}
+}
+
+static inline void gen_reproject_gen2_batch(FLT *GEN_RESTRICT out, size_t n, const SurvivePose *obj_p,
+											const FLT *GEN_RESTRICT sensor_pt, const SurvivePose *lh_p,
+											const BaseStationCal *bsd) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qw = (*obj_p).Rot[0];
+	const GEN_FLT obj_qi = (*obj_p).Rot[1];
+	const GEN_FLT obj_qj = (*obj_p).Rot[2];
+	const GEN_FLT obj_qk = (*obj_p).Rot[3];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qw = (*lh_p).Rot[0];
+	const GEN_FLT lh_qi = (*lh_p).Rot[1];
+	const GEN_FLT lh_qj = (*lh_p).Rot[2];
+	const GEN_FLT lh_qk = (*lh_p).Rot[3];
+	const GEN_FLT phase_0 = bsd[0].phase;
+	const GEN_FLT tilt_0 = bsd[0].tilt;
+	const GEN_FLT curve_0 = bsd[0].curve;
+	const GEN_FLT gibPhase_0 = bsd[0].gibpha;
+	const GEN_FLT gibMag_0 = bsd[0].gibmag;
+	const GEN_FLT ogeeMag_0 = bsd[0].ogeephase;
+	const GEN_FLT ogeePhase_0 = bsd[0].ogeemag;
+	const GEN_FLT phase_1 = bsd[1].phase;
+	const GEN_FLT tilt_1 = bsd[1].tilt;
+	const GEN_FLT curve_1 = bsd[1].curve;
+	const GEN_FLT gibPhase_1 = bsd[1].gibpha;
+	const GEN_FLT gibMag_1 = bsd[1].gibmag;
+	const GEN_FLT ogeeMag_1 = bsd[1].ogeephase;
+	const GEN_FLT ogeePhase_1 = bsd[1].ogeemag;
+	const GEN_FLT x0 = 0.523598775598299 + tilt_0;
+	const GEN_FLT x18 = cos(x0);
+	const GEN_FLT x25 = 0.523598775598299 + (-1 * tilt_1);
+	const GEN_FLT x26 = cos(x25);
+	const GEN_FLT c0 = tan(x0);
+	const GEN_FLT c1 = 1. / x18;
+	const GEN_FLT c2 = sin(x0);
+	const GEN_FLT c3 = 1. / x26;
+	const GEN_FLT c4 = tan(x25);
+	const GEN_FLT c5 = sin(x25);
+	const GEN_FLT c6 = -1 * gibPhase_0;
+	const GEN_FLT c7 = -1 * phase_0;
+	const GEN_FLT c8 = -1 * phase_1;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x1 = (obj_qk * sensor_x) + (-1 * obj_qi * sensor_z) + (obj_qw * sensor_y);
+		const GEN_FLT x2 = (obj_qi * sensor_y) + (obj_qw * sensor_z) + (-1 * obj_qj * sensor_x);
+		const GEN_FLT x3 = sensor_x + (2 * ((x2 * obj_qj) + (-1 * x1 * obj_qk))) + obj_px;
+		const GEN_FLT x4 = (obj_qj * sensor_z) + (-1 * obj_qk * sensor_y) + (obj_qw * sensor_x);
+		const GEN_FLT x5 = sensor_y + (2 * ((x4 * obj_qk) + (-1 * x2 * obj_qi))) + obj_py;
+		const GEN_FLT x6 = sensor_z + (2 * ((x1 * obj_qi) + (-1 * x4 * obj_qj))) + obj_pz;
+		const GEN_FLT x7 = (x6 * lh_qj) + (-1 * x5 * lh_qk) + (x3 * lh_qw);
+		const GEN_FLT x8 = (x3 * lh_qk) + (-1 * x6 * lh_qi) + (x5 * lh_qw);
+		const GEN_FLT x9 = x6 + (2 * ((x8 * lh_qi) + (-1 * x7 * lh_qj))) + lh_pz;
+		const GEN_FLT x10 = (x5 * lh_qi) + (-1 * x3 * lh_qj) + (x6 * lh_qw);
+		const GEN_FLT x11 = x3 + (2 * ((x10 * lh_qj) + (-1 * x8 * lh_qk))) + lh_px;
+		const GEN_FLT x12 = (x11 * x11) + (x9 * x9);
+		const GEN_FLT x13 = x5 + (2 * ((x7 * lh_qk) + (-1 * x10 * lh_qi))) + lh_py;
+		const GEN_FLT x14 = x13 * (1. / sqrt(x12));
+		const GEN_FLT x15 = c0 * x14;
+		const GEN_FLT x16 = atan2(-1 * x9, x11);
+		const GEN_FLT x17 = (sin(x16 + (-1 * asin(x15)) + ogeeMag_0) * ogeePhase_0) + curve_0;
+		const GEN_FLT x19 = x13 * (1. / sqrt(x12 + (x13 * x13)));
+		const GEN_FLT x20 = asin(x19 * c1);
+		const GEN_FLT x21 = 0.0028679863 + (x20 * (-8.0108022e-06 + (-8.0108022e-06 * x20)));
+		const GEN_FLT x22 = 5.3685255e-06 + (x20 * x21);
+		const GEN_FLT x23 = 0.0076069798 + (x22 * x20);
+		const GEN_FLT x24 = asin(x15 + (x23 * (x20 * x20) * x17 * (1. / (x18 + (-1 * c2 * x17 * ((x20 * (x23 + (x20 *
+			(x22 + (x20 * (x21 + (x20 * (-8.0108022e-06 + (-1.60216044e-05 * x20))))))))) + (x23 * x20)))))));
+		const GEN_FLT x27 = asin(c3 * x19);
+		const GEN_FLT x28 = 0.0028679863 + (x27 * (-8.0108022e-06 + (-8.0108022e-06 * x27)));
+		const GEN_FLT x29 = 5.3685255e-06 + (x28 * x27);
+		const GEN_FLT x30 = 0.0076069798 + (x29 * x27);
+		const GEN_FLT x31 = -1 * x14 * c4;
+		const GEN_FLT x32 = (sin(x16 + (-1 * asin(x31)) + ogeeMag_1) * ogeePhase_1) + curve_1;
+		const GEN_FLT x33 = (-1 * asin(x31 + (x30 * x32 * (x27 * x27) * (1. / (x26 + (x32 * c5 * ((x27 * (x30 + (x27 *
+			(x29 + (x27 * (x28 + (x27 * (-8.0108022e-06 + (-1.60216044e-05 * x27))))))))) + (x30 * x27)))))))) + x16;
+		out[i] = -1.5707963267949 + x16 + (-1 * x24) + (-1 * sin((-1 * x16) + x24 + c6) * gibMag_0) + c7;
+		out[n + i] = -1.5707963267949 + x33 + (sin(x33 + gibPhase_1) * gibMag_1) + c8;
+	}
+}
+
+// Jacobian of reproject_gen2 wrt [obj_px, obj_py, obj_pz, obj_qw, obj_qi, obj_qj, obj_qk]
+static inline void gen_reproject_gen2_jac_obj_p_batch(FLT *GEN_RESTRICT out, size_t n, const SurvivePose *obj_p,
+													  const FLT *GEN_RESTRICT sensor_pt, const SurvivePose *lh_p,
+													  const BaseStationCal *bsd) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qw = (*obj_p).Rot[0];
+	const GEN_FLT obj_qi = (*obj_p).Rot[1];
+	const GEN_FLT obj_qj = (*obj_p).Rot[2];
+	const GEN_FLT obj_qk = (*obj_p).Rot[3];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qw = (*lh_p).Rot[0];
+	const GEN_FLT lh_qi = (*lh_p).Rot[1];
+	const GEN_FLT lh_qj = (*lh_p).Rot[2];
+	const GEN_FLT lh_qk = (*lh_p).Rot[3];
+	const GEN_FLT phase_0 = bsd[0].phase;
+	const GEN_FLT tilt_0 = bsd[0].tilt;
+	const GEN_FLT curve_0 = bsd[0].curve;
+	const GEN_FLT gibPhase_0 = bsd[0].gibpha;
+	const GEN_FLT gibMag_0 = bsd[0].gibmag;
+	const GEN_FLT ogeeMag_0 = bsd[0].ogeephase;
+	const GEN_FLT ogeePhase_0 = bsd[0].ogeemag;
+	const GEN_FLT phase_1 = bsd[1].phase;
+	const GEN_FLT tilt_1 = bsd[1].tilt;
+	const GEN_FLT curve_1 = bsd[1].curve;
+	const GEN_FLT gibPhase_1 = bsd[1].gibpha;
+	const GEN_FLT gibMag_1 = bsd[1].gibmag;
+	const GEN_FLT ogeeMag_1 = bsd[1].ogeephase;
+	const GEN_FLT ogeePhase_1 = bsd[1].ogeemag;
+	const GEN_FLT x0 = 2 * lh_qj;
+	const GEN_FLT x1 = x0 * lh_qw;
+	const GEN_FLT x2 = 2 * lh_qk;
+	const GEN_FLT x3 = x2 * lh_qi;
+	const GEN_FLT x4 = x3 + (-1 * x1);
+	const GEN_FLT x24 = -2 * (lh_qk * lh_qk);
+	const GEN_FLT x25 = -2 * (lh_qj * lh_qj);
+	const GEN_FLT x26 = 1 + x25 + x24;
+	const GEN_FLT x35 = 0.523598775598299 + tilt_0;
+	const GEN_FLT x36 = cos(x35);
+	const GEN_FLT x37 = 1. / x36;
+	const GEN_FLT x55 = sin(x35);
+	const GEN_FLT x57 = tan(x35);
+	const GEN_FLT x73 = x0 * lh_qi;
+	const GEN_FLT x74 = x2 * lh_qw;
+	const GEN_FLT x75 = x74 + x73;
+	const GEN_FLT x115 = x2 * lh_qj;
+	const GEN_FLT x116 = 2 * lh_qi;
+	const GEN_FLT x117 = x116 * lh_qw;
+	const GEN_FLT x118 = x117 + x115;
+	const GEN_FLT x119 = x73 + (-1 * x74);
+	const GEN_FLT x121 = 1 + (-2 * (lh_qi * lh_qi));
+	const GEN_FLT x122 = x121 + x24;
+	const GEN_FLT x137 = x121 + x25;
+	const GEN_FLT x138 = x1 + x3;
+	const GEN_FLT x140 = x115 + (-1 * x117);
+	const GEN_FLT x253 = 0.523598775598299 + (-1 * tilt_1);
+	const GEN_FLT x254 = cos(x253);
+	const GEN_FLT x255 = 1. / x254;
+	const GEN_FLT x278 = sin(x253);
+	const GEN_FLT x279 = tan(x253);
+	const GEN_FLT c0 = x57 * x57;
+	const GEN_FLT c1 = 1. / (x36 * x36);
+	const GEN_FLT c2 = 1. / (x254 * x254);
+	const GEN_FLT c3 = x279 * x279;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x5 = obj_qj * sensor_x;
+		const GEN_FLT x6 = obj_qw * sensor_z;
+		const GEN_FLT x7 = obj_qi * sensor_y;
+		const GEN_FLT x8 = x7 + x6 + (-1 * x5);
+		const GEN_FLT x9 = obj_qw * sensor_x;
+		const GEN_FLT x10 = obj_qk * sensor_y;
+		const GEN_FLT x11 = obj_qj * sensor_z;
+		const GEN_FLT x12 = x11 + (-1 * x10) + x9;
+		const GEN_FLT x13 = sensor_y + (2 * ((x12 * obj_qk) + (-1 * x8 * obj_qi))) + obj_py;
+		const GEN_FLT x14 = obj_qw * sensor_y;
+		const GEN_FLT x15 = obj_qi * sensor_z;
+		const GEN_FLT x16 = obj_qk * sensor_x;
+		const GEN_FLT x17 = x16 + (-1 * x15) + x14;
+		const GEN_FLT x18 = sensor_z + (2 * ((x17 * obj_qi) + (-1 * x12 * obj_qj))) + obj_pz;
+		const GEN_FLT x19 = sensor_x + (2 * ((x8 * obj_qj) + (-1 * x17 * obj_qk))) + obj_px;
+		const GEN_FLT x20 = (x19 * lh_qk) + (-1 * x18 * lh_qi) + (x13 * lh_qw);
+		const GEN_FLT x21 = (x13 * lh_qi) + (-1 * x19 * lh_qj) + (x18 * lh_qw);
+		const GEN_FLT x22 = x19 + (2 * ((x21 * lh_qj) + (-1 * x20 * lh_qk))) + lh_px;
+		const GEN_FLT x23 = 1. / x22;
+		const GEN_FLT x27 = x22 * x22;
+		const GEN_FLT x28 = (x18 * lh_qj) + (-1 * x13 * lh_qk) + (x19 * lh_qw);
+		const GEN_FLT x29 = x18 + (2 * ((x20 * lh_qi) + (-1 * x28 * lh_qj))) + lh_pz;
+		const GEN_FLT x30 = x29 * (1. / x27);
+		const GEN_FLT x31 = x27 + (x29 * x29);
+		const GEN_FLT x32 = 1. / x31;
+		const GEN_FLT x33 = x32 * x27;
+		const GEN_FLT x34 = x33 * ((x30 * x26) + (-1 * x4 * x23));
+		const GEN_FLT x38 = x13 + (2 * ((x28 * lh_qk) + (-1 * x21 * lh_qi))) + lh_py;
+		const GEN_FLT x39 = x38 * x38;
+		const GEN_FLT x40 = x31 + x39;
+		const GEN_FLT x41 = 1. / sqrt(x40);
+		const GEN_FLT x42 = x41 * x38;
+		const GEN_FLT x43 = asin(x42 * x37);
+		const GEN_FLT x44 = 8.0108022e-06 * x43;
+		const GEN_FLT x45 = -8.0108022e-06 + (-1 * x44);
+		const GEN_FLT x46 = 0.0028679863 + (x43 * x45);
+		const GEN_FLT x47 = 5.3685255e-06 + (x43 * x46);
+		const GEN_FLT x48 = 0.0076069798 + (x43 * x47);
+		const GEN_FLT x49 = x43 * x48;
+		const GEN_FLT x50 = -8.0108022e-06 + (-1.60216044e-05 * x43);
+		const GEN_FLT x51 = x46 + (x50 * x43);
+		const GEN_FLT x52 = x47 + (x51 * x43);
+		const GEN_FLT x53 = x48 + (x52 * x43);
+		const GEN_FLT x54 = (x53 * x43) + x49;
+		const GEN_FLT x56 = 1. / sqrt(x31);
+		const GEN_FLT x58 = x57 * x56;
+		const GEN_FLT x59 = x58 * x38;
+		const GEN_FLT x60 = atan2(-1 * x29, x22);
+		const GEN_FLT x61 = x60 + (-1 * asin(x59)) + ogeeMag_0;
+		const GEN_FLT x62 = (sin(x61) * ogeePhase_0) + curve_0;
+		const GEN_FLT x63 = x62 * x55;
+		const GEN_FLT x64 = x36 + (-1 * x63 * x54);
+		const GEN_FLT x65 = 1. / x64;
+		const GEN_FLT x66 = x43 * x43;
+		const GEN_FLT x67 = x62 * x66;
+		const GEN_FLT x68 = x67 * x65;
+		const GEN_FLT x69 = x59 + (x68 * x48);
+		const GEN_FLT x70 = 1. / sqrt(1 + (-1 * (x69 * x69)));
+		const GEN_FLT x71 = x32 * x39;
+		const GEN_FLT x72 = 1. / sqrt(1 + (-1 * x71 * c0));
+		const GEN_FLT x76 = x75 * x56;
+		const GEN_FLT x77 = 2 * x22;
+		const GEN_FLT x78 = 2 * x29;
+		const GEN_FLT x79 = (x4 * x78) + (x77 * x26);
+		const GEN_FLT x80 = 1.0 / 2.0 * x38;
+		const GEN_FLT x81 = x80 * (1. / (x31 * sqrt(x31)));
+		const GEN_FLT x82 = x81 * x57;
+		const GEN_FLT x83 = (-1 * x82 * x79) + (x76 * x57);
+		const GEN_FLT x84 = cos(x61) * ogeePhase_0;
+		const GEN_FLT x85 = x84 * ((-1 * x83 * x72) + x34);
+		const GEN_FLT x86 = x65 * x66 * x48;
+		const GEN_FLT x87 = 2 * x38;
+		const GEN_FLT x88 = x79 + (x87 * x75);
+		const GEN_FLT x89 = x80 * (1. / (x40 * sqrt(x40)));
+		const GEN_FLT x90 = x89 * x37;
+		const GEN_FLT x91 = x75 * x41;
+		const GEN_FLT x92 = (x91 * x37) + (-1 * x88 * x90);
+		const GEN_FLT x93 = (1. / x40) * x39;
+		const GEN_FLT x94 = 1. / sqrt(1 + (-1 * x93 * c1));
+		const GEN_FLT x95 = x94 * x47;
+		const GEN_FLT x96 = x94 * x44;
+		const GEN_FLT x97 = x94 * x45;
+		const GEN_FLT x98 = x92 * x97;
+		const GEN_FLT x99 = x94 * x46;
+		const GEN_FLT x100 = (x92 * x99) + (x43 * (x98 + (-1 * x92 * x96)));
+		const GEN_FLT x101 = (x43 * x100) + (x92 * x95);
+		const GEN_FLT x102 = x53 * x94;
+		const GEN_FLT x103 = x51 * x94;
+		const GEN_FLT x104 = 2.40324066e-05 * x43;
+		const GEN_FLT x105 = x94 * x104;
+		const GEN_FLT x106 = x50 * x94;
+		const GEN_FLT x107 = x52 * x94;
+		const GEN_FLT x108 = x94 * x48;
+		const GEN_FLT x109 = x54 * x55;
+		const GEN_FLT x110 = (1. / (x64 * x64)) * x67 * x48;
+		const GEN_FLT x111 = 2 * x62 * x65 * x49;
+		const GEN_FLT x112 = x94 * x111;
+		const GEN_FLT x113 = x70 * (x83 + (-1 * x110 * ((-1 * x85 * x109) + (-1 * x63 * ((x43 * x101) + (x92 * x108) +
+			(x43 * ((x92 * x107) + x101 + (x43 * ((x43 * ((x92 * x106) + (-1 * x92 * x105) + x98)) + x100 + (x92 *
+			x103))))) + (x92 * x102))))) + (x92 * x112) + (x68 * x101) + (x85 * x86));
+		const GEN_FLT x114 = cos((-1 * asin(x69)) + x60 + gibPhase_0) * gibMag_0;
+		const GEN_FLT x120 = ((x30 * x119) + (-1 * x23 * x118)) * x33;
+		const GEN_FLT x123 = (x78 * x118) + (x77 * x119);
+		const GEN_FLT x124 = x81 * x123;
+		const GEN_FLT x125 = (-1 * x57 * x124) + (x58 * x122);
+		const GEN_FLT x126 = (-1 * x72 * x125) + x120;
+		const GEN_FLT x127 = x84 * x86;
+		const GEN_FLT x128 = x123 + (x87 * x122);
+		const GEN_FLT x129 = x41 * x122;
+		const GEN_FLT x130 = (x37 * x129) + (-1 * x90 * x128);
+		const GEN_FLT x131 = x94 * x130;
+		const GEN_FLT x132 = x45 * x131;
+		const GEN_FLT x133 = (x46 * x131) + (x43 * (x132 + (-1 * x44 * x131)));
+		const GEN_FLT x134 = (x43 * x133) + (x47 * x131);
+		const GEN_FLT x135 = x84 * x109;
+		const GEN_FLT x136 = x70 * (x125 + (x111 * x131) + (-1 * x110 * ((-1 * x126 * x135) + (-1 * x63 * ((x108 *
+			x130) + (x43 * x134) + (x43 * (x134 + (x107 * x130) + (x43 * (x133 + (x43 * ((x50 * x131) + (-1 * x104 *
+			x131) + x132)) + (x103 * x130))))) + (x53 * x131))))) + (x68 * x134) + (x127 * x126));
+		const GEN_FLT x139 = ((x30 * x138) + (-1 * x23 * x137)) * x33;
+		const GEN_FLT x141 = x56 * x140;
+		const GEN_FLT x142 = (x78 * x137) + (x77 * x138);
+		const GEN_FLT x143 = x81 * x142;
+		const GEN_FLT x144 = (-1 * x57 * x143) + (x57 * x141);
+		const GEN_FLT x145 = (-1 * x72 * x144) + x139;
+		const GEN_FLT x146 = x142 + (x87 * x140);
+		const GEN_FLT x147 = x41 * x140;
+		const GEN_FLT x148 = (x37 * x147) + (-1 * x90 * x146);
+		const GEN_FLT x149 = x94 * x148;
+		const GEN_FLT x150 = x45 * x149;
+		const GEN_FLT x151 = (x46 * x149) + (x43 * (x150 + (-1 * x44 * x149)));
+		const GEN_FLT x152 = (x43 * x151) + (x47 * x149);
+		const GEN_FLT x153 = x70 * (x144 + (-1 * x110 * ((-1 * x135 * x145) + (-1 * x63 * ((x108 * x148) + (x43 * x152)
+			+ (x43 * (x152 + (x52 * x149) + (x43 * ((x43 * ((-1 * x104 * x149) + (x50 * x149) + x150)) + x151 + (x51 *
+			x149))))) + (x53 * x149))))) + (x68 * x152) + (x111 * x149) + (x127 * x145));
+		const GEN_FLT x154 = 2 * x5;
+		const GEN_FLT x155 = 2 * x7;
+		const GEN_FLT x156 = x155 + (-1 * x154);
+		const GEN_FLT x157 = 2 * x15;
+		const GEN_FLT x158 = 2 * x16;
+		const GEN_FLT x159 = x158 + (-1 * x157);
+		const GEN_FLT x160 = 2 * x10;
+		const GEN_FLT x161 = 2 * x11;
+		const GEN_FLT x162 = x161 + (-1 * x160);
+		const GEN_FLT x163 = (x162 * lh_qw) + (-1 * x159 * lh_qk) + (x156 * lh_qj);
+		const GEN_FLT x164 = (-1 * x156 * lh_qi) + (x159 * lh_qw) + (x162 * lh_qk);
+		const GEN_FLT x165 = x156 + (x116 * x164) + (-1 * x0 * x163);
+		const GEN_FLT x166 = (x156 * lh_qw) + (-1 * x162 * lh_qj) + (x159 * lh_qi);
+		const GEN_FLT x167 = x162 + (x0 * x166) + (-1 * x2 * x164);
+		const GEN_FLT x168 = ((x30 * x167) + (-1 * x23 * x165)) * x33;
+		const GEN_FLT x169 = x159 + (x2 * x163) + (-1 * x116 * x166);
+		const GEN_FLT x170 = (x78 * x165) + (x77 * x167);
+		const GEN_FLT x171 = x81 * x170;
+		const GEN_FLT x172 = (-1 * x57 * x171) + (x58 * x169);
+		const GEN_FLT x173 = (-1 * x72 * x172) + x168;
+		const GEN_FLT x174 = x170 + (x87 * x169);
+		const GEN_FLT x175 = x41 * x169;
+		const GEN_FLT x176 = (x37 * x175) + (-1 * x90 * x174);
+		const GEN_FLT x177 = x94 * x176;
+		const GEN_FLT x178 = x97 * x176;
+		const GEN_FLT x179 = (x99 * x176) + (x43 * (x178 + (-1 * x44 * x177)));
+		const GEN_FLT x180 = (x43 * x179) + (x95 * x176);
+		const GEN_FLT x181 = x70 * (x172 + (x111 * x177) + (-1 * x110 * ((-1 * x173 * x135) + (-1 * x63 * ((x108 *
+			x176) + (x43 * x180) + (x43 * (x180 + (x107 * x176) + (x43 * (x179 + (x43 * ((x106 * x176) + (-1 * x104 *
+			x177) + x178)) + (x103 * x176))))) + (x102 * x176))))) + (x68 * x180) + (x127 * x173));
+		const GEN_FLT x182 = 2 * x14;
+		const GEN_FLT x183 = x182 + (-4 * x15) + x158;
+		const GEN_FLT x184 = 2 * x6;
+		const GEN_FLT x185 = x154 + (-1 * x184) + (-4 * x7);
+		const GEN_FLT x186 = 2 * obj_qk * sensor_z;
+		const GEN_FLT x187 = 2 * obj_qj * sensor_y;
+		const GEN_FLT x188 = x187 + x186;
+		const GEN_FLT x189 = (x188 * lh_qw) + (-1 * x185 * lh_qk) + (x183 * lh_qj);
+		const GEN_FLT x190 = (x185 * lh_qw) + (-1 * x183 * lh_qi) + (x188 * lh_qk);
+		const GEN_FLT x191 = x183 + (x116 * x190) + (-1 * x0 * x189);
+		const GEN_FLT x192 = (-1 * x188 * lh_qj) + (x183 * lh_qw) + (x185 * lh_qi);
+		const GEN_FLT x193 = x188 + (x0 * x192) + (-1 * x2 * x190);
+		const GEN_FLT x194 = ((x30 * x193) + (-1 * x23 * x191)) * x33;
+		const GEN_FLT x195 = x185 + (x2 * x189) + (-1 * x116 * x192);
+		const GEN_FLT x196 = x56 * x195;
+		const GEN_FLT x197 = (x78 * x191) + (x77 * x193);
+		const GEN_FLT x198 = x81 * x197;
+		const GEN_FLT x199 = (-1 * x57 * x198) + (x57 * x196);
+		const GEN_FLT x200 = (-1 * x72 * x199) + x194;
+		const GEN_FLT x201 = x89 * (x197 + (x87 * x195));
+		const GEN_FLT x202 = x41 * x195;
+		const GEN_FLT x203 = (x37 * x202) + (-1 * x37 * x201);
+		const GEN_FLT x204 = x97 * x203;
+		const GEN_FLT x205 = (x99 * x203) + (x43 * (x204 + (-1 * x96 * x203)));
+		const GEN_FLT x206 = (x43 * x205) + (x95 * x203);
+		const GEN_FLT x207 = x70 * ((x203 * x112) + x199 + (-1 * x110 * ((-1 * x200 * x135) + (-1 * x63 * ((x203 *
+			x108) + (x43 * x206) + (x43 * ((x203 * x107) + x206 + (x43 * ((x43 * ((x203 * x106) + x204 + (-1 * x203 *
+			x105))) + x205 + (x203 * x103))))) + (x203 * x102))))) + (x68 * x206) + (x200 * x127));
+		const GEN_FLT x208 = 2 * x9;
+		const GEN_FLT x209 = (-1 * x208) + x160 + (-4 * x11);
+		const GEN_FLT x210 = 2 * obj_qi * sensor_x;
+		const GEN_FLT x211 = x186 + x210;
+		const GEN_FLT x212 = (-4 * x5) + x184 + x155;
+		const GEN_FLT x213 = (x212 * lh_qw) + (-1 * x211 * lh_qk) + (x209 * lh_qj);
+		const GEN_FLT x214 = (x211 * lh_qw) + (-1 * x209 * lh_qi) + (x212 * lh_qk);
+		const GEN_FLT x215 = x209 + (x214 * x116) + (-1 * x0 * x213);
+		const GEN_FLT x216 = 2 * ((x209 * lh_qw) + (-1 * x212 * lh_qj) + (x211 * lh_qi));
+		const GEN_FLT x217 = x212 + (x216 * lh_qj) + (-1 * x2 * x214);
+		const GEN_FLT x218 = ((x30 * x217) + (-1 * x23 * x215)) * x33;
+		const GEN_FLT x219 = x211 + (x2 * x213) + (-1 * x216 * lh_qi);
+		const GEN_FLT x220 = x56 * x219;
+		const GEN_FLT x221 = (x78 * x215) + (x77 * x217);
+		const GEN_FLT x222 = (-1 * x82 * x221) + (x57 * x220);
+		const GEN_FLT x223 = (-1 * x72 * x222) + x218;
+		const GEN_FLT x224 = x221 + (x87 * x219);
+		const GEN_FLT x225 = x41 * x219;
+		const GEN_FLT x226 = (x37 * x225) + (-1 * x90 * x224);
+		const GEN_FLT x227 = x97 * x226;
+		const GEN_FLT x228 = (x99 * x226) + (x43 * (x227 + (-1 * x96 * x226)));
+		const GEN_FLT x229 = (x43 * x228) + (x95 * x226);
+		const GEN_FLT x230 = x70 * (x222 + (x226 * x112) + (-1 * x110 * ((-1 * x223 * x135) + (-1 * x63 * ((x43 * x229)
+			+ (x226 * x108) + (x43 * (x229 + (x226 * x107) + (x43 * (x228 + (x43 * ((x226 * x106) + (-1 * x226 * x105)
+			+ x227)) + (x226 * x103))))) + (x226 * x102))))) + (x68 * x229) + (x223 * x127));
+		const GEN_FLT x231 = x210 + x187;
+		const GEN_FLT x232 = x208 + (-4 * x10) + x161;
+		const GEN_FLT x233 = (-1 * x182) + x157 + (-4 * x16);
+		const GEN_FLT x234 = (x233 * lh_qw) + (-1 * x232 * lh_qk) + (x231 * lh_qj);
+		const GEN_FLT x235 = (x232 * lh_qw) + (-1 * x231 * lh_qi) + (x233 * lh_qk);
+		const GEN_FLT x236 = x231 + (x235 * x116) + (-1 * x0 * x234);
+		const GEN_FLT x237 = (x231 * lh_qw) + (-1 * x233 * lh_qj) + (x232 * lh_qi);
+		const GEN_FLT x238 = x233 + (x0 * x237) + (-1 * x2 * x235);
+		const GEN_FLT x239 = ((x30 * x238) + (-1 * x23 * x236)) * x33;
+		const GEN_FLT x240 = x232 + (x2 * x234) + (-1 * x237 * x116);
+		const GEN_FLT x241 = x56 * x240;
+		const GEN_FLT x242 = (x78 * x236) + (x77 * x238);
+		const GEN_FLT x243 = x81 * x242;
+		const GEN_FLT x244 = (-1 * x57 * x243) + (x57 * x241);
+		const GEN_FLT x245 = (-1 * x72 * x244) + x239;
+		const GEN_FLT x246 = x242 + (x87 * x240);
+		const GEN_FLT x247 = x41 * x240;
+		const GEN_FLT x248 = (x37 * x247) + (-1 * x90 * x246);
+		const GEN_FLT x249 = x97 * x248;
+		const GEN_FLT x250 = (x99 * x248) + (x43 * (x249 + (-1 * x96 * x248)));
+		const GEN_FLT x251 = (x43 * x250) + (x95 * x248);
+		const GEN_FLT x252 = x70 * (x244 + (x248 * x112) + (-1 * x110 * ((-1 * x245 * x135) + (-1 * x63 * ((x248 *
+			x108) + (x43 * x251) + (x43 * (x251 + (x248 * x107) + (x43 * (x250 + (x43 * ((-1 * x248 * x105) + (x248 *
+			x106) + x249)) + (x248 * x103))))) + (x248 * x102))))) + (x68 * x251) + (x245 * x127));
+		const GEN_FLT x256 = asin(x42 * x255);
+		const GEN_FLT x257 = 8.0108022e-06 * x256;
+		const GEN_FLT x258 = 1. / sqrt(1 + (-1 * x93 * c2));
+		const GEN_FLT x259 = x89 * x255;
+		const GEN_FLT x260 = (x91 * x255) + (-1 * x88 * x259);
+		const GEN_FLT x261 = x260 * x258;
+		const GEN_FLT x262 = -8.0108022e-06 + (-1 * x257);
+		const GEN_FLT x263 = x262 * x258;
+		const GEN_FLT x264 = x263 * x260;
+		const GEN_FLT x265 = 0.0028679863 + (x262 * x256);
+		const GEN_FLT x266 = x265 * x258;
+		const GEN_FLT x267 = (x266 * x260) + (x256 * (x264 + (-1 * x261 * x257)));
+		const GEN_FLT x268 = 5.3685255e-06 + (x265 * x256);
+		const GEN_FLT x269 = x268 * x258;
+		const GEN_FLT x270 = (x269 * x260) + (x267 * x256);
+		const GEN_FLT x271 = 0.0076069798 + (x268 * x256);
+		const GEN_FLT x272 = x271 * x256;
+		const GEN_FLT x273 = -8.0108022e-06 + (-1.60216044e-05 * x256);
+		const GEN_FLT x274 = x265 + (x273 * x256);
+		const GEN_FLT x275 = x268 + (x274 * x256);
+		const GEN_FLT x276 = x271 + (x275 * x256);
+		const GEN_FLT x277 = (x276 * x256) + x272;
+		const GEN_FLT x280 = x56 * x279;
+		const GEN_FLT x281 = -1 * x38 * x280;
+		const GEN_FLT x282 = x60 + (-1 * asin(x281)) + ogeeMag_1;
+		const GEN_FLT x283 = (sin(x282) * ogeePhase_1) + curve_1;
+		const GEN_FLT x284 = x278 * x283;
+		const GEN_FLT x285 = x254 + (x277 * x284);
+		const GEN_FLT x286 = 1. / x285;
+		const GEN_FLT x287 = x256 * x256;
+		const GEN_FLT x288 = x287 * x283;
+		const GEN_FLT x289 = x286 * x288;
+		const GEN_FLT x290 = 1. / sqrt(1 + (-1 * x71 * c3));
+		const GEN_FLT x291 = x81 * x279;
+		const GEN_FLT x292 = (x79 * x291) + (-1 * x76 * x279);
+		const GEN_FLT x293 = cos(x282) * ogeePhase_1;
+		const GEN_FLT x294 = x293 * ((-1 * x292 * x290) + x34);
+		const GEN_FLT x295 = x271 * x286 * x287;
+		const GEN_FLT x296 = 2 * x272 * x286 * x283;
+		const GEN_FLT x297 = x275 * x258;
+		const GEN_FLT x298 = 2.40324066e-05 * x256;
+		const GEN_FLT x299 = x273 * x258;
+		const GEN_FLT x300 = x274 * x258;
+		const GEN_FLT x301 = x276 * x258;
+		const GEN_FLT x302 = x271 * x258;
+		const GEN_FLT x303 = x278 * x277;
+		const GEN_FLT x304 = x271 * x288 * (1. / (x285 * x285));
+		const GEN_FLT x305 = x281 + (x271 * x289);
+		const GEN_FLT x306 = 1. / sqrt(1 + (-1 * (x305 * x305)));
+		const GEN_FLT x307 = (-1 * x306 * (x292 + (-1 * x304 * ((x294 * x303) + (x284 * ((x260 * x302) + (x270 * x256)
+			+ (x260 * x301) + (x256 * (x270 + (x256 * (x267 + (x260 * x300) + (x256 * ((x299 * x260) + (-1 * x298 *
+			x261) + x264)))) + (x297 * x260))))))) + (x296 * x261) + (x295 * x294) + (x270 * x289))) + x34;
+		const GEN_FLT x308 = cos(x60 + (-1 * asin(x305)) + gibPhase_1) * gibMag_1;
+		const GEN_FLT x309 = (x255 * x129) + (-1 * x259 * x128);
+		const GEN_FLT x310 = x258 * x257;
+		const GEN_FLT x311 = x263 * x309;
+		const GEN_FLT x312 = (x266 * x309) + (x256 * (x311 + (-1 * x309 * x310)));
+		const GEN_FLT x313 = (x269 * x309) + (x256 * x312);
+		const GEN_FLT x314 = (x279 * x124) + (-1 * x280 * x122);
+		const GEN_FLT x315 = (-1 * x290 * x314) + x120;
+		const GEN_FLT x316 = x293 * x295;
+		const GEN_FLT x317 = x296 * x258;
+		const GEN_FLT x318 = x298 * x258;
+		const GEN_FLT x319 = x293 * x303;
+		const GEN_FLT x320 = (-1 * x306 * (x314 + (-1 * x304 * ((x315 * x319) + (x284 * ((x309 * x302) + (x256 * x313)
+			+ (x309 * x301) + (x256 * (x313 + (x256 * (x312 + (x309 * x300) + (x256 * ((x299 * x309) + x311 + (-1 *
+			x309 * x318))))) + (x297 * x309))))))) + (x309 * x317) + (x315 * x316) + (x289 * x313))) + x120;
+		const GEN_FLT x321 = ((x255 * x147) + (-1 * x259 * x146)) * x258;
+		const GEN_FLT x322 = x262 * x321;
+		const GEN_FLT x323 = (x265 * x321) + (x256 * (x322 + (-1 * x257 * x321)));
+		const GEN_FLT x324 = (x268 * x321) + (x256 * x323);
+		const GEN_FLT x325 = (x279 * x143) + (-1 * x279 * x141);
+		const GEN_FLT x326 = (-1 * x290 * x325) + x139;
+		const GEN_FLT x327 = (-1 * x306 * ((-1 * x304 * ((x326 * x319) + (x284 * ((x271 * x321) + (x256 * x324) + (x276
+			* x321) + (x256 * (x324 + (x256 * (x323 + (x274 * x321) + (x256 * ((-1 * x298 * x321) + (x273 * x321) +
+			x322)))) + (x275 * x321))))))) + (x296 * x321) + (x326 * x316) + x325 + (x289 * x324))) + x139;
+		const GEN_FLT x328 = (x255 * x175) + (-1 * x259 * x174);
+		const GEN_FLT x329 = x263 * x328;
+		const GEN_FLT x330 = (x266 * x328) + (x256 * (x329 + (-1 * x328 * x310)));
+		const GEN_FLT x331 = (x269 * x328) + (x256 * x330);
+		const GEN_FLT x332 = (x279 * x171) + (-1 * x280 * x169);
+		const GEN_FLT x333 = (-1 * x290 * x332) + x168;
+		const GEN_FLT x334 = (-1 * x306 * (x332 + (x328 * x317) + (x333 * x316) + (-1 * x304 * ((x333 * x319) + (x284 *
+			((x302 * x328) + (x301 * x328) + (x256 * (x331 + (x256 * (x330 + (x300 * x328) + (x256 * ((x299 * x328) +
+			(-1 * x328 * x318) + x329)))) + (x297 * x328))) + (x256 * x331))))) + (x289 * x331))) + x168;
+		const GEN_FLT x335 = (x202 * x255) + (-1 * x201 * x255);
+		const GEN_FLT x336 = x263 * x335;
+		const GEN_FLT x337 = (x266 * x335) + (x256 * (x336 + (-1 * x310 * x335)));
+		const GEN_FLT x338 = (x269 * x335) + (x256 * x337);
+		const GEN_FLT x339 = (x279 * x198) + (-1 * x279 * x196);
+		const GEN_FLT x340 = (-1 * x290 * x339) + x194;
+		const GEN_FLT x341 = (-1 * x306 * ((-1 * x304 * ((x319 * x340) + (x284 * ((x256 * x338) + (x302 * x335) + (x301
+			* x335) + (x256 * (x338 + (x256 * (x337 + (x300 * x335) + (x256 * ((x299 * x335) + (-1 * x335 * x318) +
+			x336)))) + (x297 * x335))))))) + (x335 * x317) + x339 + (x316 * x340) + (x289 * x338))) + x194;
+		const GEN_FLT x342 = (x255 * x225) + (-1 * x259 * x224);
+		const GEN_FLT x343 = x263 * x342;
+		const GEN_FLT x344 = (x266 * x342) + (x256 * (x343 + (-1 * x310 * x342)));
+		const GEN_FLT x345 = (x269 * x342) + (x256 * x344);
+		const GEN_FLT x346 = (x291 * x221) + (-1 * x279 * x220);
+		const GEN_FLT x347 = (-1 * x290 * x346) + x218;
+		const GEN_FLT x348 = (-1 * x306 * ((x317 * x342) + (-1 * x304 * ((x347 * x319) + (x284 * ((x302 * x342) + (x256
+			* x345) + (x301 * x342) + (x256 * (x345 + (x256 * (x344 + (x300 * x342) + (x256 * ((x299 * x342) + (-1 *
+			x318 * x342) + x343)))) + (x297 * x342))))))) + x346 + (x347 * x316) + (x289 * x345))) + x218;
+		const GEN_FLT x349 = ((x255 * x247) + (-1 * x259 * x246)) * x258;
+		const GEN_FLT x350 = x262 * x349;
+		const GEN_FLT x351 = (x265 * x349) + (x256 * (x350 + (-1 * x257 * x349)));
+		const GEN_FLT x352 = (x268 * x349) + (x256 * x351);
+		const GEN_FLT x353 = (x279 * x243) + (-1 * x279 * x241);
+		const GEN_FLT x354 = (-1 * x290 * x353) + x239;
+		const GEN_FLT x355 = (-1 * x306 * ((-1 * x304 * ((x354 * x319) + (x284 * ((x271 * x349) + (x256 * x352) + (x276
+			* x349) + (x256 * (x352 + (x256 * (x351 + (x274 * x349) + (x256 * ((x273 * x349) + (-1 * x298 * x349) +
+			x350)))) + (x275 * x349))))))) + x353 + (x354 * x316) + (x296 * x349) + (x289 * x352))) + x239;
+		out[i] = (-1 * x114 * (x113 + (-1 * x34))) + (-1 * x113) + x34;
+		out[n + i] = (-1 * (x136 + (-1 * x120)) * x114) + x120 + (-1 * x136);
+		out[2 * n + i] = (-1 * (x153 + (-1 * x139)) * x114) + (-1 * x153) + x139;
+		out[3 * n + i] = (-1 * x181) + (-1 * (x181 + (-1 * x168)) * x114) + x168;
+		out[4 * n + i] = (-1 * (x207 + (-1 * x194)) * x114) + (-1 * x207) + x194;
+		out[5 * n + i] = (-1 * (x230 + (-1 * x218)) * x114) + x218 + (-1 * x230);
+		out[6 * n + i] = (-1 * (x252 + (-1 * x239)) * x114) + (-1 * x252) + x239;
+		out[7 * n + i] = x307 + (x307 * x308);
+		out[8 * n + i] = x320 + (x308 * x320);
+		out[9 * n + i] = x327 + (x308 * x327);
+		out[10 * n + i] = x334 + (x308 * x334);
+		out[11 * n + i] = x341 + (x308 * x341);
+		out[12 * n + i] = x348 + (x308 * x348);
+		out[13 * n + i] = x355 + (x355 * x308);
+	}
+}
+
+static inline void gen_reproject_axis_x_gen2_batch(FLT *GEN_RESTRICT out, size_t n, const SurvivePose *obj_p,
+												   const FLT *GEN_RESTRICT sensor_pt, const SurvivePose *lh_p,
+												   const BaseStationCal *bsc0) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qw = (*obj_p).Rot[0];
+	const GEN_FLT obj_qi = (*obj_p).Rot[1];
+	const GEN_FLT obj_qj = (*obj_p).Rot[2];
+	const GEN_FLT obj_qk = (*obj_p).Rot[3];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qw = (*lh_p).Rot[0];
+	const GEN_FLT lh_qi = (*lh_p).Rot[1];
+	const GEN_FLT lh_qj = (*lh_p).Rot[2];
+	const GEN_FLT lh_qk = (*lh_p).Rot[3];
+	const GEN_FLT phase_0 = (*bsc0).phase;
+	const GEN_FLT tilt_0 = (*bsc0).tilt;
+	const GEN_FLT curve_0 = (*bsc0).curve;
+	const GEN_FLT gibPhase_0 = (*bsc0).gibpha;
+	const GEN_FLT gibMag_0 = (*bsc0).gibmag;
+	const GEN_FLT ogeeMag_0 = (*bsc0).ogeephase;
+	const GEN_FLT ogeePhase_0 = (*bsc0).ogeemag;
+	const GEN_FLT x12 = 0.523598775598299 + tilt_0;
+	const GEN_FLT x17 = cos(x12);
+	const GEN_FLT c0 = tan(x12);
+	const GEN_FLT c1 = 1. / x17;
+	const GEN_FLT c2 = sin(x12);
+	const GEN_FLT c3 = -1 * gibPhase_0;
+	const GEN_FLT c4 = -1 * phase_0;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x0 = (obj_qk * sensor_x) + (-1 * obj_qi * sensor_z) + (obj_qw * sensor_y);
+		const GEN_FLT x1 = (obj_qi * sensor_y) + (obj_qw * sensor_z) + (-1 * obj_qj * sensor_x);
+		const GEN_FLT x2 = sensor_x + (2 * ((x1 * obj_qj) + (-1 * x0 * obj_qk))) + obj_px;
+		const GEN_FLT x3 = (obj_qj * sensor_z) + (-1 * obj_qk * sensor_y) + (obj_qw * sensor_x);
+		const GEN_FLT x4 = sensor_y + (2 * ((x3 * obj_qk) + (-1 * x1 * obj_qi))) + obj_py;
+		const GEN_FLT x5 = sensor_z + (2 * ((x0 * obj_qi) + (-1 * x3 * obj_qj))) + obj_pz;
+		const GEN_FLT x6 = (x5 * lh_qj) + (-1 * x4 * lh_qk) + (x2 * lh_qw);
+		const GEN_FLT x7 = (x2 * lh_qk) + (-1 * x5 * lh_qi) + (x4 * lh_qw);
+		const GEN_FLT x8 = x5 + (2 * ((x7 * lh_qi) + (-1 * x6 * lh_qj))) + lh_pz;
+		const GEN_FLT x9 = (x4 * lh_qi) + (-1 * x2 * lh_qj) + (x5 * lh_qw);
+		const GEN_FLT x10 = x2 + (2 * ((x9 * lh_qj) + (-1 * x7 * lh_qk))) + lh_px;
+		const GEN_FLT x11 = (x10 * x10) + (x8 * x8);
+		const GEN_FLT x13 = (2 * ((x6 * lh_qk) + (-1 * x9 * lh_qi))) + x4 + lh_py;
+		const GEN_FLT x14 = x13 * (1. / sqrt(x11)) * c0;
+		const GEN_FLT x15 = atan2(-1 * x8, x10);
+		const GEN_FLT x16 = (sin(x15 + (-1 * asin(x14)) + ogeeMag_0) * ogeePhase_0) + curve_0;
+		const GEN_FLT x18 = asin(x13 * c1 * (1. / sqrt(x11 + (x13 * x13))));
+		const GEN_FLT x19 = 0.0028679863 + (x18 * (-8.0108022e-06 + (-8.0108022e-06 * x18)));
+		const GEN_FLT x20 = 5.3685255e-06 + (x19 * x18);
+		const GEN_FLT x21 = 0.0076069798 + (x20 * x18);
+		const GEN_FLT x22 = asin(x14 + (x21 * (x18 * x18) * x16 * (1. / (x17 + (-1 * x16 * c2 * ((x18 * (x21 + (x18 *
+			(x20 + (x18 * (x19 + (x18 * (-8.0108022e-06 + (-1.60216044e-05 * x18))))))))) + (x21 * x18)))))));
+		out[i] = -1.5707963267949 + x15 + (-1 * x22) + (-1 * sin((-1 * x15) + x22 + c3) * gibMag_0) + c4;
+	}
+}
+
+// Jacobian of reproject_axis_x_gen2 wrt [obj_px, obj_py, obj_pz, obj_qw, obj_qi, obj_qj, obj_qk]
+static inline void gen_reproject_axis_x_gen2_jac_obj_p_batch(FLT *GEN_RESTRICT out, size_t n, const SurvivePose *obj_p,
+															 const FLT *GEN_RESTRICT sensor_pt, const SurvivePose *lh_p,
+															 const BaseStationCal *bsc0) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qw = (*obj_p).Rot[0];
+	const GEN_FLT obj_qi = (*obj_p).Rot[1];
+	const GEN_FLT obj_qj = (*obj_p).Rot[2];
+	const GEN_FLT obj_qk = (*obj_p).Rot[3];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qw = (*lh_p).Rot[0];
+	const GEN_FLT lh_qi = (*lh_p).Rot[1];
+	const GEN_FLT lh_qj = (*lh_p).Rot[2];
+	const GEN_FLT lh_qk = (*lh_p).Rot[3];
+	const GEN_FLT phase_0 = (*bsc0).phase;
+	const GEN_FLT tilt_0 = (*bsc0).tilt;
+	const GEN_FLT curve_0 = (*bsc0).curve;
+	const GEN_FLT gibPhase_0 = (*bsc0).gibpha;
+	const GEN_FLT gibMag_0 = (*bsc0).gibmag;
+	const GEN_FLT ogeeMag_0 = (*bsc0).ogeephase;
+	const GEN_FLT ogeePhase_0 = (*bsc0).ogeemag;
+	const GEN_FLT x0 = 2 * lh_qw;
+	const GEN_FLT x1 = x0 * lh_qj;
+	const GEN_FLT x2 = 2 * lh_qk;
+	const GEN_FLT x3 = x2 * lh_qi;
+	const GEN_FLT x4 = x3 + (-1 * x1);
+	const GEN_FLT x24 = -2 * (lh_qk * lh_qk);
+	const GEN_FLT x25 = -2 * (lh_qj * lh_qj);
+	const GEN_FLT x26 = 1 + x25 + x24;
+	const GEN_FLT x36 = 0.523598775598299 + tilt_0;
+	const GEN_FLT x37 = cos(x36);
+	const GEN_FLT x38 = 1. / x37;
+	const GEN_FLT x54 = sin(x36);
+	const GEN_FLT x55 = tan(x36);
+	const GEN_FLT x70 = 2 * lh_qi;
+	const GEN_FLT x71 = x70 * lh_qj;
+	const GEN_FLT x72 = x0 * lh_qk;
+	const GEN_FLT x73 = x72 + x71;
+	const GEN_FLT x98 = x2 * lh_qj;
+	const GEN_FLT x99 = x0 * lh_qi;
+	const GEN_FLT x100 = x99 + x98;
+	const GEN_FLT x101 = x71 + (-1 * x72);
+	const GEN_FLT x103 = 1 + (-2 * (lh_qi * lh_qi));
+	const GEN_FLT x104 = x103 + x24;
+	const GEN_FLT x113 = x103 + x25;
+	const GEN_FLT x114 = x1 + x3;
+	const GEN_FLT x116 = x98 + (-1 * x99);
+	const GEN_FLT x137 = 2 * lh_qj;
+	const GEN_FLT c0 = x55 * x55;
+	const GEN_FLT c1 = 1. / (x37 * x37);
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x5 = obj_qj * sensor_x;
+		const GEN_FLT x6 = obj_qw * sensor_z;
+		const GEN_FLT x7 = obj_qi * sensor_y;
+		const GEN_FLT x8 = x7 + x6 + (-1 * x5);
+		const GEN_FLT x9 = obj_qw * sensor_x;
+		const GEN_FLT x10 = obj_qk * sensor_y;
+		const GEN_FLT x11 = obj_qj * sensor_z;
+		const GEN_FLT x12 = x11 + (-1 * x10) + x9;
+		const GEN_FLT x13 = sensor_y + (2 * ((x12 * obj_qk) + (-1 * x8 * obj_qi))) + obj_py;
+		const GEN_FLT x14 = obj_qw * sensor_y;
+		const GEN_FLT x15 = obj_qi * sensor_z;
+		const GEN_FLT x16 = obj_qk * sensor_x;
+		const GEN_FLT x17 = x16 + (-1 * x15) + x14;
+		const GEN_FLT x18 = sensor_z + (2 * ((x17 * obj_qi) + (-1 * x12 * obj_qj))) + obj_pz;
+		const GEN_FLT x19 = sensor_x + (2 * ((x8 * obj_qj) + (-1 * x17 * obj_qk))) + obj_px;
+		const GEN_FLT x20 = (x19 * lh_qk) + (-1 * x18 * lh_qi) + (x13 * lh_qw);
+		const GEN_FLT x21 = (x13 * lh_qi) + (-1 * x19 * lh_qj) + (x18 * lh_qw);
+		const GEN_FLT x22 = x19 + (2 * ((x21 * lh_qj) + (-1 * x20 * lh_qk))) + lh_px;
+		const GEN_FLT x23 = 1. / x22;
+		const GEN_FLT x27 = (x18 * lh_qj) + (-1 * x13 * lh_qk) + (x19 * lh_qw);
+		const GEN_FLT x28 = x18 + (2 * ((x20 * lh_qi) + (-1 * x27 * lh_qj))) + lh_pz;
+		const GEN_FLT x29 = x22 * x22;
+		const GEN_FLT x30 = x28 * (1. / x29);
+		const GEN_FLT x31 = x29 + (x28 * x28);
+		const GEN_FLT x32 = 1. / x31;
+		const GEN_FLT x33 = x32 * x29;
+		const GEN_FLT x34 = x33 * ((x30 * x26) + (-1 * x4 * x23));
+		const GEN_FLT x35 = x13 + (2 * ((x27 * lh_qk) + (-1 * x21 * lh_qi))) + lh_py;
+		const GEN_FLT x39 = x35 * x35;
+		const GEN_FLT x40 = x31 + x39;
+		const GEN_FLT x41 = (1. / sqrt(x40)) * x38;
+		const GEN_FLT x42 = asin(x41 * x35);
+		const GEN_FLT x43 = 8.0108022e-06 * x42;
+		const GEN_FLT x44 = -8.0108022e-06 + (-1 * x43);
+		const GEN_FLT x45 = 0.0028679863 + (x42 * x44);
+		const GEN_FLT x46 = 5.3685255e-06 + (x42 * x45);
+		const GEN_FLT x47 = 0.0076069798 + (x42 * x46);
+		const GEN_FLT x48 = x42 * x47;
+		const GEN_FLT x49 = -8.0108022e-06 + (-1.60216044e-05 * x42);
+		const GEN_FLT x50 = x45 + (x42 * x49);
+		const GEN_FLT x51 = x46 + (x50 * x42);
+		const GEN_FLT x52 = x47 + (x51 * x42);
+		const GEN_FLT x53 = (x52 * x42) + x48;
+		const GEN_FLT x56 = x55 * (1. / sqrt(x31));
+		const GEN_FLT x57 = x56 * x35;
+		const GEN_FLT x58 = atan2(-1 * x28, x22);
+		const GEN_FLT x59 = x58 + (-1 * asin(x57)) + ogeeMag_0;
+		const GEN_FLT x60 = (sin(x59) * ogeePhase_0) + curve_0;
+		const GEN_FLT x61 = x60 * x54;
+		const GEN_FLT x62 = x37 + (-1 * x61 * x53);
+		const GEN_FLT x63 = 1. / x62;
+		const GEN_FLT x64 = x42 * x42;
+		const GEN_FLT x65 = x60 * x64;
+		const GEN_FLT x66 = x63 * x65;
+		const GEN_FLT x67 = x57 + (x66 * x47);
+		const GEN_FLT x68 = 1. / sqrt(1 + (-1 * (x67 * x67)));
+		const GEN_FLT x69 = 1. / sqrt(1 + (-1 * c0 * x32 * x39));
+		const GEN_FLT x74 = 2 * x22;
+		const GEN_FLT x75 = 2 * x28;
+		const GEN_FLT x76 = (x4 * x75) + (x74 * x26);
+		const GEN_FLT x77 = 1.0 / 2.0 * x35;
+		const GEN_FLT x78 = x77 * x55 * (1. / (x31 * sqrt(x31)));
+		const GEN_FLT x79 = (-1 * x78 * x76) + (x73 * x56);
+		const GEN_FLT x80 = (-1 * x79 * x69) + x34;
+		const GEN_FLT x81 = cos(x59) * ogeePhase_0;
+		const GEN_FLT x82 = x63 * x64 * x47;
+		const GEN_FLT x83 = x81 * x82;
+		const GEN_FLT x84 = 1. / sqrt(1 + (-1 * (1. / x40) * c1 * x39));
+		const GEN_FLT x85 = 2 * x35;
+		const GEN_FLT x86 = x77 * (1. / (x40 * sqrt(x40))) * x38;
+		const GEN_FLT x87 = x84 * ((x73 * x41) + (-1 * x86 * (x76 + (x85 * x73))));
+		const GEN_FLT x88 = x87 * x44;
+		const GEN_FLT x89 = (x87 * x45) + (x42 * (x88 + (-1 * x87 * x43)));
+		const GEN_FLT x90 = (x89 * x42) + (x87 * x46);
+		const GEN_FLT x91 = 2.40324066e-05 * x42;
+		const GEN_FLT x92 = x54 * x53;
+		const GEN_FLT x93 = x81 * x92;
+		const GEN_FLT x94 = (1. / (x62 * x62)) * x65 * x47;
+		const GEN_FLT x95 = 2 * x60 * x63 * x48;
+		const GEN_FLT x96 = x68 * (x79 + (-1 * x94 * ((-1 * x80 * x93) + (-1 * x61 * ((x87 * x47) + (x90 * x42) + (x42
+			* (x90 + (x87 * x51) + (x42 * ((x42 * ((-1 * x87 * x91) + (x87 * x49) + x88)) + x89 + (x87 * x50))))) +
+			(x87 * x52))))) + (x66 * x90) + (x87 * x95) + (x80 * x83));
+		const GEN_FLT x97 = cos(x58 + (-1 * asin(x67)) + gibPhase_0) * gibMag_0;
+		const GEN_FLT x102 = ((x30 * x101) + (-1 * x23 * x100)) * x33;
+		const GEN_FLT x105 = (x75 * x100) + (x74 * x101);
+		const GEN_FLT x106 = (-1 * x78 * x105) + (x56 * x104);
+		const GEN_FLT x107 = (-1 * x69 * x106) + x102;
+		const GEN_FLT x108 = x84 * ((x41 * x104) + (-1 * x86 * (x105 + (x85 * x104))));
+		const GEN_FLT x109 = x44 * x108;
+		const GEN_FLT x110 = (x45 * x108) + (x42 * (x109 + (-1 * x43 * x108)));
+		const GEN_FLT x111 = (x42 * x110) + (x46 * x108);
+		const GEN_FLT x112 = x68 * (x106 + (-1 * x94 * ((-1 * x93 * x107) + (-1 * x61 * ((x47 * x108) + (x42 * x111) +
+			(x42 * (x111 + (x51 * x108) + (x42 * (x110 + (x42 * ((x49 * x108) + (-1 * x91 * x108) + x109)) + (x50 *
+			x108))))) + (x52 * x108))))) + (x95 * x108) + (x66 * x111) + (x83 * x107));
+		const GEN_FLT x115 = ((x30 * x114) + (-1 * x23 * x113)) * x33;
+		const GEN_FLT x117 = (x75 * x113) + (x74 * x114);
+		const GEN_FLT x118 = (-1 * x78 * x117) + (x56 * x116);
+		const GEN_FLT x119 = (-1 * x69 * x118) + x115;
+		const GEN_FLT x120 = (x41 * x116) + (-1 * x86 * (x117 + (x85 * x116)));
+		const GEN_FLT x121 = x84 * x120;
+		const GEN_FLT x122 = x44 * x121;
+		const GEN_FLT x123 = (x45 * x121) + (x42 * (x122 + (-1 * x43 * x121)));
+		const GEN_FLT x124 = (x42 * x123) + (x46 * x121);
+		const GEN_FLT x125 = x84 * x50;
+		const GEN_FLT x126 = x68 * ((x95 * x121) + (x66 * x124) + x118 + (-1 * x94 * ((-1 * x93 * x119) + (-1 * x61 *
+			((x47 * x121) + (x42 * x124) + (x42 * (x124 + (x51 * x121) + (x42 * (x123 + (x42 * ((-1 * x91 * x121) +
+			(x49 * x121) + x122)) + (x120 * x125))))) + (x52 * x121))))) + (x83 * x119));
+		const GEN_FLT x127 = 2 * x5;
+		const GEN_FLT x128 = 2 * x7;
+		const GEN_FLT x129 = x128 + (-1 * x127);
+		const GEN_FLT x130 = 2 * x15;
+		const GEN_FLT x131 = 2 * x16;
+		const GEN_FLT x132 = x131 + (-1 * x130);
+		const GEN_FLT x133 = 2 * x10;
+		const GEN_FLT x134 = 2 * x11;
+		const GEN_FLT x135 = x134 + (-1 * x133);
+		const GEN_FLT x136 = (x135 * lh_qw) + (-1 * x132 * lh_qk) + (x129 * lh_qj);
+		const GEN_FLT x138 = (-1 * x129 * lh_qi) + (x132 * lh_qw) + (x135 * lh_qk);
+		const GEN_FLT x139 = x129 + (x70 * x138) + (-1 * x137 * x136);
+		const GEN_FLT x140 = (x129 * lh_qw) + (-1 * x135 * lh_qj) + (x132 * lh_qi);
+		const GEN_FLT x141 = x135 + (x137 * x140) + (-1 * x2 * x138);
+		const GEN_FLT x142 = ((x30 * x141) + (-1 * x23 * x139)) * x33;
+		const GEN_FLT x143 = x132 + (x2 * x136) + (-1 * x70 * x140);
+		const GEN_FLT x144 = (x75 * x139) + (x74 * x141);
+		const GEN_FLT x145 = (-1 * x78 * x144) + (x56 * x143);
+		const GEN_FLT x146 = (-1 * x69 * x145) + x142;
+		const GEN_FLT x147 = (x41 * x143) + (-1 * x86 * (x144 + (x85 * x143)));
+		const GEN_FLT x148 = x84 * x147;
+		const GEN_FLT x149 = x44 * x148;
+		const GEN_FLT x150 = (x45 * x148) + (x42 * (x149 + (-1 * x43 * x148)));
+		const GEN_FLT x151 = (x42 * x150) + (x46 * x148);
+		const GEN_FLT x152 = x68 * (x145 + (x95 * x148) + (-1 * x94 * ((-1 * x93 * x146) + (-1 * x61 * ((x47 * x148) +
+			(x42 * x151) + (x42 * (x151 + (x51 * x148) + (x42 * (x150 + (x42 * ((x49 * x148) + (-1 * x91 * x148) +
+			x149)) + (x125 * x147))))) + (x52 * x148))))) + (x66 * x151) + (x83 * x146));
+		const GEN_FLT x153 = 2 * x14;
+		const GEN_FLT x154 = x153 + (-4 * x15) + x131;
+		const GEN_FLT x155 = 2 * x6;
+		const GEN_FLT x156 = x127 + (-1 * x155) + (-4 * x7);
+		const GEN_FLT x157 = 2 * obj_qk * sensor_z;
+		const GEN_FLT x158 = 2 * obj_qj * sensor_y;
+		const GEN_FLT x159 = x158 + x157;
+		const GEN_FLT x160 = 2 * ((x159 * lh_qw) + (-1 * x156 * lh_qk) + (x154 * lh_qj));
+		const GEN_FLT x161 = (x156 * lh_qw) + (-1 * x154 * lh_qi) + (x159 * lh_qk);
+		const GEN_FLT x162 = x154 + (x70 * x161) + (-1 * x160 * lh_qj);
+		const GEN_FLT x163 = (x154 * lh_qw) + (-1 * x159 * lh_qj) + (x156 * lh_qi);
+		const GEN_FLT x164 = x159 + (x163 * x137) + (-1 * x2 * x161);
+		const GEN_FLT x165 = ((x30 * x164) + (-1 * x23 * x162)) * x33;
+		const GEN_FLT x166 = x156 + (x160 * lh_qk) + (-1 * x70 * x163);
+		const GEN_FLT x167 = (x75 * x162) + (x74 * x164);
+		const GEN_FLT x168 = (-1 * x78 * x167) + (x56 * x166);
+		const GEN_FLT x169 = (-1 * x69 * x168) + x165;
+		const GEN_FLT x170 = (x41 * x166) + (-1 * x86 * (x167 + (x85 * x166)));
+		const GEN_FLT x171 = x84 * x170;
+		const GEN_FLT x172 = x44 * x171;
+		const GEN_FLT x173 = (x45 * x171) + (x42 * (x172 + (-1 * x43 * x171)));
+		const GEN_FLT x174 = (x42 * x173) + (x46 * x171);
+		const GEN_FLT x175 = x68 * (x168 + (x95 * x171) + (-1 * x94 * ((-1 * x93 * x169) + (-1 * x61 * ((x47 * x171) +
+			(x42 * x174) + (x42 * (x174 + (x51 * x171) + (x42 * (x173 + (x42 * ((x49 * x171) + x172 + (-1 * x91 *
+			x171))) + (x125 * x170))))) + (x52 * x171))))) + (x66 * x174) + (x83 * x169));
+		const GEN_FLT x176 = 2 * x9;
+		const GEN_FLT x177 = (-1 * x176) + x133 + (-4 * x11);
+		const GEN_FLT x178 = 2 * obj_qi * sensor_x;
+		const GEN_FLT x179 = x157 + x178;
+		const GEN_FLT x180 = (-4 * x5) + x155 + x128;
+		const GEN_FLT x181 = (-1 * x179 * lh_qk) + (x180 * lh_qw) + (x177 * lh_qj);
+		const GEN_FLT x182 = (x179 * lh_qw) + (-1 * x177 * lh_qi) + (x180 * lh_qk);
+		const GEN_FLT x183 = x177 + (x70 * x182) + (-1 * x181 * x137);
+		const GEN_FLT x184 = (x177 * lh_qw) + (-1 * x180 * lh_qj) + (x179 * lh_qi);
+		const GEN_FLT x185 = x180 + (x184 * x137) + (-1 * x2 * x182);
+		const GEN_FLT x186 = ((x30 * x185) + (-1 * x23 * x183)) * x33;
+		const GEN_FLT x187 = (x2 * x181) + x179 + (-1 * x70 * x184);
+		const GEN_FLT x188 = (x75 * x183) + (x74 * x185);
+		const GEN_FLT x189 = (-1 * x78 * x188) + (x56 * x187);
+		const GEN_FLT x190 = (-1 * x69 * x189) + x186;
+		const GEN_FLT x191 = (x41 * x187) + (-1 * x86 * (x188 + (x85 * x187)));
+		const GEN_FLT x192 = x84 * x191;
+		const GEN_FLT x193 = x44 * x192;
+		const GEN_FLT x194 = (x45 * x192) + (x42 * (x193 + (-1 * x43 * x192)));
+		const GEN_FLT x195 = (x42 * x194) + (x46 * x192);
+		const GEN_FLT x196 = x68 * (x189 + (x95 * x192) + (x66 * x195) + (-1 * x94 * ((-1 * x93 * x190) + (-1 * x61 *
+			((x47 * x192) + (x42 * x195) + (x42 * (x195 + (x51 * x192) + (x42 * (x194 + (x42 * ((x49 * x192) + (-1 *
+			x91 * x192) + x193)) + (x125 * x191))))) + (x52 * x192))))) + (x83 * x190));
+		const GEN_FLT x197 = x178 + x158;
+		const GEN_FLT x198 = x176 + (-4 * x10) + x134;
+		const GEN_FLT x199 = (-1 * x153) + x130 + (-4 * x16);
+		const GEN_FLT x200 = (-1 * x198 * lh_qk) + (x199 * lh_qw) + (x197 * lh_qj);
+		const GEN_FLT x201 = (-1 * x197 * lh_qi) + (x198 * lh_qw) + (x199 * lh_qk);
+		const GEN_FLT x202 = x197 + (x70 * x201) + (-1 * x200 * x137);
+		const GEN_FLT x203 = (x197 * lh_qw) + (-1 * x199 * lh_qj) + (x198 * lh_qi);
+		const GEN_FLT x204 = x199 + (x203 * x137) + (-1 * x2 * x201);
+		const GEN_FLT x205 = ((x30 * x204) + (-1 * x23 * x202)) * x33;
+		const GEN_FLT x206 = x198 + (x2 * x200) + (-1 * x70 * x203);
+		const GEN_FLT x207 = (x75 * x202) + (x74 * x204);
+		const GEN_FLT x208 = (-1 * x78 * x207) + (x56 * x206);
+		const GEN_FLT x209 = x81 * ((-1 * x69 * x208) + x205);
+		const GEN_FLT x210 = x84 * ((x41 * x206) + (-1 * x86 * (x207 + (x85 * x206))));
+		const GEN_FLT x211 = x44 * x210;
+		const GEN_FLT x212 = (x45 * x210) + (x42 * (x211 + (-1 * x43 * x210)));
+		const GEN_FLT x213 = (x42 * x212) + (x46 * x210);
+		const GEN_FLT x214 = x68 * (x208 + (-1 * x94 * ((-1 * x92 * x209) + (-1 * x61 * ((x47 * x210) + (x42 * x213) +
+			(x42 * (x213 + (x51 * x210) + (x42 * (x212 + (x42 * ((x49 * x210) + (-1 * x91 * x210) + x211)) + (x50 *
+			x210))))) + (x52 * x210))))) + (x66 * x213) + (x95 * x210) + (x82 * x209));
+		out[i] = (-1 * (x96 + (-1 * x34)) * x97) + (-1 * x96) + x34;
+		out[n + i] = x102 + (-1 * (x112 + (-1 * x102)) * x97) + (-1 * x112);
+		out[2 * n + i] = (-1 * (x126 + (-1 * x115)) * x97) + (-1 * x126) + x115;
+		out[3 * n + i] = (-1 * (x152 + (-1 * x142)) * x97) + (-1 * x152) + x142;
+		out[4 * n + i] = (-1 * (x175 + (-1 * x165)) * x97) + (-1 * x175) + x165;
+		out[5 * n + i] = (-1 * (x196 + (-1 * x186)) * x97) + x186 + (-1 * x196);
+		out[6 * n + i] = (-1 * (x214 + (-1 * x205)) * x97) + (-1 * x214) + x205;
+	}
+}
+
+static inline void gen_reproject_axis_y_gen2_batch(FLT *GEN_RESTRICT out, size_t n, const SurvivePose *obj_p,
+												   const FLT *GEN_RESTRICT sensor_pt, const SurvivePose *lh_p,
+												   const BaseStationCal *bsc1) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qw = (*obj_p).Rot[0];
+	const GEN_FLT obj_qi = (*obj_p).Rot[1];
+	const GEN_FLT obj_qj = (*obj_p).Rot[2];
+	const GEN_FLT obj_qk = (*obj_p).Rot[3];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qw = (*lh_p).Rot[0];
+	const GEN_FLT lh_qi = (*lh_p).Rot[1];
+	const GEN_FLT lh_qj = (*lh_p).Rot[2];
+	const GEN_FLT lh_qk = (*lh_p).Rot[3];
+	const GEN_FLT phase_1 = (*bsc1).phase;
+	const GEN_FLT tilt_1 = (*bsc1).tilt;
+	const GEN_FLT curve_1 = (*bsc1).curve;
+	const GEN_FLT gibPhase_1 = (*bsc1).gibpha;
+	const GEN_FLT gibMag_1 = (*bsc1).gibmag;
+	const GEN_FLT ogeeMag_1 = (*bsc1).ogeephase;
+	const GEN_FLT ogeePhase_1 = (*bsc1).ogeemag;
+	const GEN_FLT x0 = 0.523598775598299 + (-1 * tilt_1);
+	const GEN_FLT x1 = cos(x0);
+	const GEN_FLT c0 = 1. / x1;
+	const GEN_FLT c1 = tan(x0);
+	const GEN_FLT c2 = sin(x0);
+	const GEN_FLT c3 = -1 * phase_1;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x2 = (obj_qj * sensor_z) + (-1 * obj_qk * sensor_y) + (obj_qw * sensor_x);
+		const GEN_FLT x3 = (obj_qk * sensor_x) + (-1 * obj_qi * sensor_z) + (obj_qw * sensor_y);
+		const GEN_FLT x4 = sensor_z + (2 * ((x3 * obj_qi) + (-1 * x2 * obj_qj))) + obj_pz;
+		const GEN_FLT x5 = (obj_qi * sensor_y) + (obj_qw * sensor_z) + (-1 * obj_qj * sensor_x);
+		const GEN_FLT x6 = sensor_x + (2 * ((x5 * obj_qj) + (-1 * x3 * obj_qk))) + obj_px;
+		const GEN_FLT x7 = sensor_y + (2 * ((x2 * obj_qk) + (-1 * x5 * obj_qi))) + obj_py;
+		const GEN_FLT x8 = (x7 * lh_qi) + (-1 * x6 * lh_qj) + (x4 * lh_qw);
+		const GEN_FLT x9 = (x4 * lh_qj) + (-1 * x7 * lh_qk) + (x6 * lh_qw);
+		const GEN_FLT x10 = x7 + (2 * ((x9 * lh_qk) + (-1 * x8 * lh_qi))) + lh_py;
+		const GEN_FLT x11 = (x6 * lh_qk) + (-1 * x4 * lh_qi) + (x7 * lh_qw);
+		const GEN_FLT x12 = x4 + (2 * ((x11 * lh_qi) + (-1 * x9 * lh_qj))) + lh_pz;
+		const GEN_FLT x13 = x6 + (2 * ((x8 * lh_qj) + (-1 * x11 * lh_qk))) + lh_px;
+		const GEN_FLT x14 = (x13 * x13) + (x12 * x12);
+		const GEN_FLT x15 = asin(c0 * x10 * (1. / sqrt(x14 + (x10 * x10))));
+		const GEN_FLT x16 = 0.0028679863 + (x15 * (-8.0108022e-06 + (-8.0108022e-06 * x15)));
+		const GEN_FLT x17 = 5.3685255e-06 + (x15 * x16);
+		const GEN_FLT x18 = 0.0076069798 + (x15 * x17);
+		const GEN_FLT x19 = -1 * c1 * (1. / sqrt(x14)) * x10;
+		const GEN_FLT x20 = atan2(-1 * x12, x13);
+		const GEN_FLT x21 = (sin(x20 + (-1 * asin(x19)) + ogeeMag_1) * ogeePhase_1) + curve_1;
+		const GEN_FLT x22 = x20 + (-1 * asin(x19 + (x21 * (x15 * x15) * x18 * (1. / (x1 + (c2 * x21 * ((x15 * (x18 +
+			(x15 * (x17 + (x15 * (x16 + (x15 * (-8.0108022e-06 + (-1.60216044e-05 * x15))))))))) + (x15 * x18))))))));
+		out[i] = -1.5707963267949 + x22 + (sin(x22 + gibPhase_1) * gibMag_1) + c3;
+	}
+}
+
+// Jacobian of reproject_axis_y_gen2 wrt [obj_px, obj_py, obj_pz, obj_qw, obj_qi, obj_qj, obj_qk]
+static inline void gen_reproject_axis_y_gen2_jac_obj_p_batch(FLT *GEN_RESTRICT out, size_t n, const SurvivePose *obj_p,
+															 const FLT *GEN_RESTRICT sensor_pt, const SurvivePose *lh_p,
+															 const BaseStationCal *bsc1) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qw = (*obj_p).Rot[0];
+	const GEN_FLT obj_qi = (*obj_p).Rot[1];
+	const GEN_FLT obj_qj = (*obj_p).Rot[2];
+	const GEN_FLT obj_qk = (*obj_p).Rot[3];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qw = (*lh_p).Rot[0];
+	const GEN_FLT lh_qi = (*lh_p).Rot[1];
+	const GEN_FLT lh_qj = (*lh_p).Rot[2];
+	const GEN_FLT lh_qk = (*lh_p).Rot[3];
+	const GEN_FLT phase_1 = (*bsc1).phase;
+	const GEN_FLT tilt_1 = (*bsc1).tilt;
+	const GEN_FLT curve_1 = (*bsc1).curve;
+	const GEN_FLT gibPhase_1 = (*bsc1).gibpha;
+	const GEN_FLT gibMag_1 = (*bsc1).gibmag;
+	const GEN_FLT ogeeMag_1 = (*bsc1).ogeephase;
+	const GEN_FLT ogeePhase_1 = (*bsc1).ogeemag;
+	const GEN_FLT x0 = 2 * lh_qw;
+	const GEN_FLT x1 = x0 * lh_qj;
+	const GEN_FLT x2 = 2 * lh_qk;
+	const GEN_FLT x3 = x2 * lh_qi;
+	const GEN_FLT x4 = x3 + (-1 * x1);
+	const GEN_FLT x24 = -2 * (lh_qk * lh_qk);
+	const GEN_FLT x25 = -2 * (lh_qj * lh_qj);
+	const GEN_FLT x26 = 1 + x25 + x24;
+	const GEN_FLT x36 = 0.523598775598299 + (-1 * tilt_1);
+	const GEN_FLT x37 = cos(x36);
+	const GEN_FLT x38 = 1. / x37;
+	const GEN_FLT x45 = 2 * lh_qj;
+	const GEN_FLT x46 = x45 * lh_qi;
+	const GEN_FLT x47 = x2 * lh_qw;
+	const GEN_FLT x48 = x47 + x46;
+	const GEN_FLT x69 = sin(x36);
+	const GEN_FLT x70 = tan(x36);
+	const GEN_FLT x98 = x2 * lh_qj;
+	const GEN_FLT x99 = x0 * lh_qi;
+	const GEN_FLT x100 = x99 + x98;
+	const GEN_FLT x101 = x46 + (-1 * x47);
+	const GEN_FLT x103 = 1 + (-2 * (lh_qi * lh_qi));
+	const GEN_FLT x104 = x103 + x24;
+	const GEN_FLT x113 = x103 + x25;
+	const GEN_FLT x114 = x1 + x3;
+	const GEN_FLT x116 = x98 + (-1 * x99);
+	const GEN_FLT x140 = 2 * lh_qi;
+	const GEN_FLT c0 = 1. / (x37 * x37);
+	const GEN_FLT c1 = x70 * x70;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x5 = obj_qj * sensor_x;
+		const GEN_FLT x6 = obj_qw * sensor_z;
+		const GEN_FLT x7 = obj_qi * sensor_y;
+		const GEN_FLT x8 = x7 + x6 + (-1 * x5);
+		const GEN_FLT x9 = obj_qw * sensor_x;
+		const GEN_FLT x10 = obj_qk * sensor_y;
+		const GEN_FLT x11 = obj_qj * sensor_z;
+		const GEN_FLT x12 = x11 + (-1 * x10) + x9;
+		const GEN_FLT x13 = sensor_y + (2 * ((x12 * obj_qk) + (-1 * x8 * obj_qi))) + obj_py;
+		const GEN_FLT x14 = obj_qw * sensor_y;
+		const GEN_FLT x15 = obj_qi * sensor_z;
+		const GEN_FLT x16 = obj_qk * sensor_x;
+		const GEN_FLT x17 = x16 + (-1 * x15) + x14;
+		const GEN_FLT x18 = sensor_z + (2 * ((x17 * obj_qi) + (-1 * x12 * obj_qj))) + obj_pz;
+		const GEN_FLT x19 = sensor_x + (2 * ((x8 * obj_qj) + (-1 * x17 * obj_qk))) + obj_px;
+		const GEN_FLT x20 = (x19 * lh_qk) + (-1 * x18 * lh_qi) + (x13 * lh_qw);
+		const GEN_FLT x21 = (x13 * lh_qi) + (-1 * x19 * lh_qj) + (x18 * lh_qw);
+		const GEN_FLT x22 = x19 + (2 * ((x21 * lh_qj) + (-1 * x20 * lh_qk))) + lh_px;
+		const GEN_FLT x23 = 1. / x22;
+		const GEN_FLT x27 = (x18 * lh_qj) + (-1 * x13 * lh_qk) + (x19 * lh_qw);
+		const GEN_FLT x28 = x18 + (2 * ((x20 * lh_qi) + (-1 * x27 * lh_qj))) + lh_pz;
+		const GEN_FLT x29 = x22 * x22;
+		const GEN_FLT x30 = x28 * (1. / x29);
+		const GEN_FLT x31 = x29 + (x28 * x28);
+		const GEN_FLT x32 = 1. / x31;
+		const GEN_FLT x33 = x32 * x29;
+		const GEN_FLT x34 = x33 * ((x30 * x26) + (-1 * x4 * x23));
+		const GEN_FLT x35 = x13 + (2 * ((x27 * lh_qk) + (-1 * x21 * lh_qi))) + lh_py;
+		const GEN_FLT x39 = x35 * x35;
+		const GEN_FLT x40 = x31 + x39;
+		const GEN_FLT x41 = (1. / sqrt(x40)) * x38;
+		const GEN_FLT x42 = asin(x41 * x35);
+		const GEN_FLT x43 = 8.0108022e-06 * x42;
+		const GEN_FLT x44 = 1. / sqrt(1 + (-1 * (1. / x40) * c0 * x39));
+		const GEN_FLT x49 = 2 * x35;
+		const GEN_FLT x50 = 2 * x22;
+		const GEN_FLT x51 = 2 * x28;
+		const GEN_FLT x52 = (x4 * x51) + (x50 * x26);
+		const GEN_FLT x53 = 1.0 / 2.0 * x35;
+		const GEN_FLT x54 = x53 * (1. / (x40 * sqrt(x40))) * x38;
+		const GEN_FLT x55 = x44 * ((x41 * x48) + (-1 * x54 * (x52 + (x48 * x49))));
+		const GEN_FLT x56 = -8.0108022e-06 + (-1 * x43);
+		const GEN_FLT x57 = x56 * x55;
+		const GEN_FLT x58 = 0.0028679863 + (x56 * x42);
+		const GEN_FLT x59 = (x58 * x55) + (x42 * (x57 + (-1 * x55 * x43)));
+		const GEN_FLT x60 = 5.3685255e-06 + (x58 * x42);
+		const GEN_FLT x61 = (x60 * x55) + (x59 * x42);
+		const GEN_FLT x62 = 0.0076069798 + (x60 * x42);
+		const GEN_FLT x63 = x62 * x42;
+		const GEN_FLT x64 = -8.0108022e-06 + (-1.60216044e-05 * x42);
+		const GEN_FLT x65 = x58 + (x64 * x42);
+		const GEN_FLT x66 = x60 + (x65 * x42);
+		const GEN_FLT x67 = x62 + (x66 * x42);
+		const GEN_FLT x68 = (x67 * x42) + x63;
+		const GEN_FLT x71 = x70 * (1. / sqrt(x31));
+		const GEN_FLT x72 = -1 * x71 * x35;
+		const GEN_FLT x73 = atan2(-1 * x28, x22);
+		const GEN_FLT x74 = x73 + (-1 * asin(x72)) + ogeeMag_1;
+		const GEN_FLT x75 = (sin(x74) * ogeePhase_1) + curve_1;
+		const GEN_FLT x76 = x75 * x69;
+		const GEN_FLT x77 = x37 + (x76 * x68);
+		const GEN_FLT x78 = 1. / x77;
+		const GEN_FLT x79 = x42 * x42;
+		const GEN_FLT x80 = x79 * x75;
+		const GEN_FLT x81 = x80 * x78;
+		const GEN_FLT x82 = 1. / sqrt(1 + (-1 * c1 * x32 * x39));
+		const GEN_FLT x83 = x70 * x53 * (1. / (x31 * sqrt(x31)));
+		const GEN_FLT x84 = (x83 * x52) + (-1 * x71 * x48);
+		const GEN_FLT x85 = (-1 * x82 * x84) + x34;
+		const GEN_FLT x86 = cos(x74) * ogeePhase_1;
+		const GEN_FLT x87 = x79 * x78 * x62;
+		const GEN_FLT x88 = x86 * x87;
+		const GEN_FLT x89 = 2 * x78 * x75 * x63;
+		const GEN_FLT x90 = 2.40324066e-05 * x42;
+		const GEN_FLT x91 = x68 * x69;
+		const GEN_FLT x92 = x86 * x91;
+		const GEN_FLT x93 = x80 * (1. / (x77 * x77)) * x62;
+		const GEN_FLT x94 = x72 + (x81 * x62);
+		const GEN_FLT x95 = 1. / sqrt(1 + (-1 * (x94 * x94)));
+		const GEN_FLT x96 = (-1 * x95 * ((-1 * x93 * ((x85 * x92) + (x76 * ((x62 * x55) + (x61 * x42) + (x67 * x55) +
+			(x42 * (x61 + (x42 * (x59 + (x65 * x55) + (x42 * ((x64 * x55) + (-1 * x55 * x90) + x57)))) + (x66 *
+			x55))))))) + (x89 * x55) + (x88 * x85) + x84 + (x81 * x61))) + x34;
+		const GEN_FLT x97 = cos(x73 + (-1 * asin(x94)) + gibPhase_1) * gibMag_1;
+		const GEN_FLT x102 = ((x30 * x101) + (-1 * x23 * x100)) * x33;
+		const GEN_FLT x105 = (x51 * x100) + (x50 * x101);
+		const GEN_FLT x106 = x44 * ((x41 * x104) + (-1 * x54 * (x105 + (x49 * x104))));
+		const GEN_FLT x107 = x56 * x106;
+		const GEN_FLT x108 = (x58 * x106) + (x42 * (x107 + (-1 * x43 * x106)));
+		const GEN_FLT x109 = (x60 * x106) + (x42 * x108);
+		const GEN_FLT x110 = (x83 * x105) + (-1 * x71 * x104);
+		const GEN_FLT x111 = (-1 * x82 * x110) + x102;
+		const GEN_FLT x112 = (-1 * x95 * (x110 + (x89 * x106) + (-1 * x93 * ((x92 * x111) + (x76 * ((x62 * x106) + (x42
+			* x109) + (x67 * x106) + (x42 * (x109 + (x42 * ((x65 * x106) + x108 + (x42 * (x107 + (x64 * x106) + (-1 *
+			x90 * x106))))) + (x66 * x106))))))) + (x88 * x111) + (x81 * x109))) + x102;
+		const GEN_FLT x115 = ((x30 * x114) + (-1 * x23 * x113)) * x33;
+		const GEN_FLT x117 = (x51 * x113) + (x50 * x114);
+		const GEN_FLT x118 = (x41 * x116) + (-1 * x54 * (x117 + (x49 * x116)));
+		const GEN_FLT x119 = x44 * x118;
+		const GEN_FLT x120 = x56 * x44;
+		const GEN_FLT x121 = x118 * x120;
+		const GEN_FLT x122 = (x58 * x119) + (x42 * (x121 + (-1 * x43 * x119)));
+		const GEN_FLT x123 = (x60 * x119) + (x42 * x122);
+		const GEN_FLT x124 = (x83 * x117) + (-1 * x71 * x116);
+		const GEN_FLT x125 = (-1 * x82 * x124) + x115;
+		const GEN_FLT x126 = x66 * x44;
+		const GEN_FLT x127 = x64 * x44;
+		const GEN_FLT x128 = (-1 * x95 * (x124 + (x89 * x119) + (-1 * x93 * ((x92 * x125) + (x76 * ((x62 * x119) + (x42
+			* x123) + (x67 * x119) + (x42 * (x123 + (x42 * (x122 + (x65 * x119) + (x42 * ((x118 * x127) + (-1 * x90 *
+			x119) + x121)))) + (x118 * x126))))))) + (x88 * x125) + (x81 * x123))) + x115;
+		const GEN_FLT x129 = 2 * x5;
+		const GEN_FLT x130 = 2 * x7;
+		const GEN_FLT x131 = x130 + (-1 * x129);
+		const GEN_FLT x132 = 2 * x15;
+		const GEN_FLT x133 = 2 * x16;
+		const GEN_FLT x134 = x133 + (-1 * x132);
+		const GEN_FLT x135 = 2 * x10;
+		const GEN_FLT x136 = 2 * x11;
+		const GEN_FLT x137 = x136 + (-1 * x135);
+		const GEN_FLT x138 = (x137 * lh_qw) + (-1 * x134 * lh_qk) + (x131 * lh_qj);
+		const GEN_FLT x139 = (x134 * lh_qw) + (-1 * x131 * lh_qi) + (x137 * lh_qk);
+		const GEN_FLT x141 = x131 + (x139 * x140) + (-1 * x45 * x138);
+		const GEN_FLT x142 = (x131 * lh_qw) + (-1 * x137 * lh_qj) + (x134 * lh_qi);
+		const GEN_FLT x143 = x137 + (x45 * x142) + (-1 * x2 * x139);
+		const GEN_FLT x144 = ((x30 * x143) + (-1 * x23 * x141)) * x33;
+		const GEN_FLT x145 = (x2 * x138) + x134 + (-1 * x140 * x142);
+		const GEN_FLT x146 = (x51 * x141) + (x50 * x143);
+		const GEN_FLT x147 = x44 * ((x41 * x145) + (-1 * x54 * (x146 + (x49 * x145))));
+		const GEN_FLT x148 = x56 * x147;
+		const GEN_FLT x149 = (x58 * x147) + (x42 * (x148 + (-1 * x43 * x147)));
+		const GEN_FLT x150 = (x60 * x147) + (x42 * x149);
+		const GEN_FLT x151 = (x83 * x146) + (-1 * x71 * x145);
+		const GEN_FLT x152 = (-1 * x82 * x151) + x144;
+		const GEN_FLT x153 = (-1 * x95 * (x151 + (-1 * x93 * ((x92 * x152) + (x76 * ((x62 * x147) + (x67 * x147) + (x42
+			* (x150 + (x42 * (x149 + (x65 * x147) + (x42 * ((x64 * x147) + (-1 * x90 * x147) + x148)))) + (x66 *
+			x147))) + (x42 * x150))))) + (x89 * x147) + (x88 * x152) + (x81 * x150))) + x144;
+		const GEN_FLT x154 = 2 * x14;
+		const GEN_FLT x155 = x154 + (-4 * x15) + x133;
+		const GEN_FLT x156 = 2 * x6;
+		const GEN_FLT x157 = x129 + (-1 * x156) + (-4 * x7);
+		const GEN_FLT x158 = 2 * obj_qk * sensor_z;
+		const GEN_FLT x159 = 2 * obj_qj * sensor_y;
+		const GEN_FLT x160 = x159 + x158;
+		const GEN_FLT x161 = (x160 * lh_qw) + (-1 * x157 * lh_qk) + (x155 * lh_qj);
+		const GEN_FLT x162 = (x157 * lh_qw) + (-1 * x155 * lh_qi) + (x160 * lh_qk);
+		const GEN_FLT x163 = x155 + (x162 * x140) + (-1 * x45 * x161);
+		const GEN_FLT x164 = (x155 * lh_qw) + (-1 * x160 * lh_qj) + (x157 * lh_qi);
+		const GEN_FLT x165 = x160 + (x45 * x164) + (-1 * x2 * x162);
+		const GEN_FLT x166 = ((x30 * x165) + (-1 * x23 * x163)) * x33;
+		const GEN_FLT x167 = x157 + (x2 * x161) + (-1 * x164 * x140);
+		const GEN_FLT x168 = (x51 * x163) + (x50 * x165);
+		const GEN_FLT x169 = (x41 * x167) + (-1 * x54 * (x168 + (x49 * x167)));
+		const GEN_FLT x170 = x44 * x169;
+		const GEN_FLT x171 = x120 * x169;
+		const GEN_FLT x172 = x58 * x44;
+		const GEN_FLT x173 = (x169 * x172) + (x42 * (x171 + (-1 * x43 * x170)));
+		const GEN_FLT x174 = (x60 * x170) + (x42 * x173);
+		const GEN_FLT x175 = (x83 * x168) + (-1 * x71 * x167);
+		const GEN_FLT x176 = x86 * ((-1 * x82 * x175) + x166);
+		const GEN_FLT x177 = x62 * x44;
+		const GEN_FLT x178 = (-1 * x95 * (x175 + (-1 * x93 * ((x91 * x176) + (x76 * ((x42 * x174) + (x67 * x170) +
+			(x169 * x177) + (x42 * (x174 + (x42 * (x173 + (x65 * x170) + (x42 * ((x127 * x169) + (-1 * x90 * x170) +
+			x171)))) + (x126 * x169))))))) + (x89 * x170) + (x87 * x176) + (x81 * x174))) + x166;
+		const GEN_FLT x179 = 2 * x9;
+		const GEN_FLT x180 = (-1 * x179) + x135 + (-4 * x11);
+		const GEN_FLT x181 = 2 * obj_qi * sensor_x;
+		const GEN_FLT x182 = x158 + x181;
+		const GEN_FLT x183 = (-4 * x5) + x156 + x130;
+		const GEN_FLT x184 = (x183 * lh_qw) + (-1 * x182 * lh_qk) + (x180 * lh_qj);
+		const GEN_FLT x185 = (x182 * lh_qw) + (-1 * x180 * lh_qi) + (x183 * lh_qk);
+		const GEN_FLT x186 = x180 + (x185 * x140) + (-1 * x45 * x184);
+		const GEN_FLT x187 = (-1 * x183 * lh_qj) + (x180 * lh_qw) + (x182 * lh_qi);
+		const GEN_FLT x188 = (x45 * x187) + x183 + (-1 * x2 * x185);
+		const GEN_FLT x189 = ((x30 * x188) + (-1 * x23 * x186)) * x33;
+		const GEN_FLT x190 = x182 + (x2 * x184) + (-1 * x187 * x140);
+		const GEN_FLT x191 = (x51 * x186) + (x50 * x188);
+		const GEN_FLT x192 = (x41 * x190) + (-1 * x54 * (x191 + (x49 * x190)));
+		const GEN_FLT x193 = x44 * x192;
+		const GEN_FLT x194 = x120 * x192;
+		const GEN_FLT x195 = (x172 * x192) + (x42 * (x194 + (-1 * x43 * x193)));
+		const GEN_FLT x196 = (x60 * x193) + (x42 * x195);
+		const GEN_FLT x197 = (x83 * x191) + (-1 * x71 * x190);
+		const GEN_FLT x198 = (-1 * x82 * x197) + x189;
+		const GEN_FLT x199 = (-1 * x95 * (x197 + (x89 * x193) + (-1 * x93 * ((x92 * x198) + (x76 * ((x177 * x192) +
+			(x42 * x196) + (x67 * x193) + (x42 * (x196 + (x42 * (x195 + (x65 * x193) + (x42 * ((x127 * x192) + (-1 *
+			x90 * x193) + x194)))) + (x126 * x192))))))) + (x88 * x198) + (x81 * x196))) + x189;
+		const GEN_FLT x200 = x181 + x159;
+		const GEN_FLT x201 = x179 + (-4 * x10) + x136;
+		const GEN_FLT x202 = (-1 * x154) + x132 + (-4 * x16);
+		const GEN_FLT x203 = (-1 * x201 * lh_qk) + (x202 * lh_qw) + (x200 * lh_qj);
+		const GEN_FLT x204 = (-1 * x200 * lh_qi) + (x201 * lh_qw) + (x202 * lh_qk);
+		const GEN_FLT x205 = x200 + (x204 * x140) + (-1 * x45 * x203);
+		const GEN_FLT x206 = (x200 * lh_qw) + (-1 * x202 * lh_qj) + (x201 * lh_qi);
+		const GEN_FLT x207 = x202 + (x45 * x206) + (-1 * x2 * x204);
+		const GEN_FLT x208 = ((x30 * x207) + (-1 * x23 * x205)) * x33;
+		const GEN_FLT x209 = x201 + (x2 * x203) + (-1 * x206 * x140);
+		const GEN_FLT x210 = (x51 * x205) + (x50 * x207);
+		const GEN_FLT x211 = (x41 * x209) + (-1 * x54 * (x210 + (x49 * x209)));
+		const GEN_FLT x212 = x44 * x211;
+		const GEN_FLT x213 = x211 * x120;
+		const GEN_FLT x214 = (x211 * x172) + (x42 * (x213 + (-1 * x43 * x212)));
+		const GEN_FLT x215 = (x60 * x212) + (x42 * x214);
+		const GEN_FLT x216 = (x83 * x210) + (-1 * x71 * x209);
+		const GEN_FLT x217 = (-1 * x82 * x216) + x208;
+		const GEN_FLT x218 = (-1 * x95 * (x216 + (-1 * x93 * ((x92 * x217) + (x76 * ((x42 * x215) + (x67 * x212) +
+			(x211 * x177) + (x42 * (x215 + (x42 * (x214 + (x65 * x212) + (x42 * ((x211 * x127) + (-1 * x90 * x212) +
+			x213)))) + (x211 * x126))))))) + (x89 * x212) + (x88 * x217) + (x81 * x215))) + x208;
+		out[i] = x96 + (x97 * x96);
+		out[n + i] = x112 + (x97 * x112);
+		out[2 * n + i] = x128 + (x97 * x128);
+		out[3 * n + i] = x153 + (x97 * x153);
+		out[4 * n + i] = x178 + (x97 * x178);
+		out[5 * n + i] = x199 + (x97 * x199);
+		out[6 * n + i] = x218 + (x97 * x218);
+	}
+}
+
+static inline void gen_reproject_batch(FLT *GEN_RESTRICT out, size_t n, const SurvivePose *obj_p,
+									   const FLT *GEN_RESTRICT sensor_pt, const SurvivePose *lh_p,
+									   const BaseStationCal *bsd) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qw = (*obj_p).Rot[0];
+	const GEN_FLT obj_qi = (*obj_p).Rot[1];
+	const GEN_FLT obj_qj = (*obj_p).Rot[2];
+	const GEN_FLT obj_qk = (*obj_p).Rot[3];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qw = (*lh_p).Rot[0];
+	const GEN_FLT lh_qi = (*lh_p).Rot[1];
+	const GEN_FLT lh_qj = (*lh_p).Rot[2];
+	const GEN_FLT lh_qk = (*lh_p).Rot[3];
+	const GEN_FLT phase_0 = bsd[0].phase;
+	const GEN_FLT tilt_0 = bsd[0].tilt;
+	const GEN_FLT curve_0 = bsd[0].curve;
+	const GEN_FLT gibPhase_0 = bsd[0].gibpha;
+	const GEN_FLT gibMag_0 = bsd[0].gibmag;
+	const GEN_FLT ogeeMag_0 = bsd[0].ogeephase;
+	const GEN_FLT ogeePhase_0 = bsd[0].ogeemag;
+	const GEN_FLT phase_1 = bsd[1].phase;
+	const GEN_FLT tilt_1 = bsd[1].tilt;
+	const GEN_FLT curve_1 = bsd[1].curve;
+	const GEN_FLT gibPhase_1 = bsd[1].gibpha;
+	const GEN_FLT gibMag_1 = bsd[1].gibmag;
+	const GEN_FLT ogeeMag_1 = bsd[1].ogeephase;
+	const GEN_FLT ogeePhase_1 = bsd[1].ogeemag;
+	const GEN_FLT c0 = -1 * phase_0;
+	const GEN_FLT c1 = -1 * phase_1;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x0 = (obj_qj * sensor_z) + (-1 * obj_qk * sensor_y) + (obj_qw * sensor_x);
+		const GEN_FLT x1 = (obj_qk * sensor_x) + (-1 * obj_qi * sensor_z) + (obj_qw * sensor_y);
+		const GEN_FLT x2 = sensor_z + (2 * ((x1 * obj_qi) + (-1 * x0 * obj_qj))) + obj_pz;
+		const GEN_FLT x3 = (obj_qi * sensor_y) + (obj_qw * sensor_z) + (-1 * obj_qj * sensor_x);
+		const GEN_FLT x4 = sensor_x + (2 * ((x3 * obj_qj) + (-1 * x1 * obj_qk))) + obj_px;
+		const GEN_FLT x5 = sensor_y + (2 * ((x0 * obj_qk) + (-1 * x3 * obj_qi))) + obj_py;
+		const GEN_FLT x6 = (x5 * lh_qi) + (-1 * x4 * lh_qj) + (x2 * lh_qw);
+		const GEN_FLT x7 = (-1 * x5 * lh_qk) + (x2 * lh_qj) + (x4 * lh_qw);
+		const GEN_FLT x8 = x5 + (2 * ((x7 * lh_qk) + (-1 * x6 * lh_qi))) + lh_py;
+		const GEN_FLT x9 = (x4 * lh_qk) + (-1 * x2 * lh_qi) + (x5 * lh_qw);
+		const GEN_FLT x10 = x2 + (2 * ((x9 * lh_qi) + (-1 * x7 * lh_qj))) + lh_pz;
+		const GEN_FLT x11 = -1 * x10;
+		const GEN_FLT x12 = x10 * x10;
+		const GEN_FLT x13 = x4 + (2 * ((x6 * lh_qj) + (-1 * x9 * lh_qk))) + lh_px;
+		const GEN_FLT x14 = atan2(x13, x11);
+		const GEN_FLT x15 = (-1 * x14) + c0 + (-1 * asin(x8 * (1. / sqrt((x13 * x13) + x12)) * tilt_0));
+		const GEN_FLT x16 = (-1 * atan2(-1 * x8, x11)) + (-1 * asin(x13 * (1. / sqrt((x8 * x8) + x12)) * tilt_1)) + c1;
+		out[i] = x15 + (-1 * cos(1.5707963267949 + x15 + gibPhase_0) * gibMag_0) + ((atan2(x8, x11) * atan2(x8, x11)) *
+			curve_0);
+		out[n + i] = x16 + ((x14 * x14) * curve_1) + (-1 * cos(1.5707963267949 + x16 + gibPhase_1) * gibMag_1);
+	}
+}
+
+// Jacobian of reproject wrt [obj_px, obj_py, obj_pz, obj_qw, obj_qi, obj_qj, obj_qk]
+static inline void gen_reproject_jac_obj_p_batch(FLT *GEN_RESTRICT out, size_t n, const SurvivePose *obj_p,
+												 const FLT *GEN_RESTRICT sensor_pt, const SurvivePose *lh_p,
+												 const BaseStationCal *bsd) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qw = (*obj_p).Rot[0];
+	const GEN_FLT obj_qi = (*obj_p).Rot[1];
+	const GEN_FLT obj_qj = (*obj_p).Rot[2];
+	const GEN_FLT obj_qk = (*obj_p).Rot[3];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qw = (*lh_p).Rot[0];
+	const GEN_FLT lh_qi = (*lh_p).Rot[1];
+	const GEN_FLT lh_qj = (*lh_p).Rot[2];
+	const GEN_FLT lh_qk = (*lh_p).Rot[3];
+	const GEN_FLT phase_0 = bsd[0].phase;
+	const GEN_FLT tilt_0 = bsd[0].tilt;
+	const GEN_FLT curve_0 = bsd[0].curve;
+	const GEN_FLT gibPhase_0 = bsd[0].gibpha;
+	const GEN_FLT gibMag_0 = bsd[0].gibmag;
+	const GEN_FLT ogeeMag_0 = bsd[0].ogeephase;
+	const GEN_FLT ogeePhase_0 = bsd[0].ogeemag;
+	const GEN_FLT phase_1 = bsd[1].phase;
+	const GEN_FLT tilt_1 = bsd[1].tilt;
+	const GEN_FLT curve_1 = bsd[1].curve;
+	const GEN_FLT gibPhase_1 = bsd[1].gibpha;
+	const GEN_FLT gibMag_1 = bsd[1].gibmag;
+	const GEN_FLT ogeeMag_1 = bsd[1].ogeephase;
+	const GEN_FLT ogeePhase_1 = bsd[1].ogeemag;
+	const GEN_FLT x0 = 2 * lh_qj;
+	const GEN_FLT x1 = x0 * lh_qw;
+	const GEN_FLT x2 = 2 * lh_qi;
+	const GEN_FLT x3 = x2 * lh_qk;
+	const GEN_FLT x4 = x3 + (-1 * x1);
+	const GEN_FLT x28 = -2 * (lh_qk * lh_qk);
+	const GEN_FLT x29 = -2 * (lh_qj * lh_qj);
+	const GEN_FLT x30 = 1 + x29 + x28;
+	const GEN_FLT x37 = x0 * lh_qi;
+	const GEN_FLT x38 = 2 * lh_qw;
+	const GEN_FLT x39 = x38 * lh_qk;
+	const GEN_FLT x40 = x39 + x37;
+	const GEN_FLT x60 = x0 * lh_qk;
+	const GEN_FLT x61 = x38 * lh_qi;
+	const GEN_FLT x62 = x61 + x60;
+	const GEN_FLT x63 = x37 + (-1 * x39);
+	const GEN_FLT x65 = 1 + (-2 * (lh_qi * lh_qi));
+	const GEN_FLT x66 = x65 + x28;
+	const GEN_FLT x71 = x65 + x29;
+	const GEN_FLT x72 = x1 + x3;
+	const GEN_FLT x74 = x60 + (-1 * x61);
+	const GEN_FLT x91 = 2 * lh_qk;
+	const GEN_FLT c0 = tilt_0 * tilt_0;
+	const GEN_FLT c1 = -1 * phase_0;
+	const GEN_FLT c2 = tilt_1 * tilt_1;
+	const GEN_FLT c3 = -1 * phase_1;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x5 = obj_qj * sensor_x;
+		const GEN_FLT x6 = obj_qw * sensor_z;
+		const GEN_FLT x7 = obj_qi * sensor_y;
+		const GEN_FLT x8 = x7 + x6 + (-1 * x5);
+		const GEN_FLT x9 = obj_qw * sensor_x;
+		const GEN_FLT x10 = obj_qk * sensor_y;
+		const GEN_FLT x11 = obj_qj * sensor_z;
+		const GEN_FLT x12 = x11 + (-1 * x10) + x9;
+		const GEN_FLT x13 = sensor_y + (2 * ((x12 * obj_qk) + (-1 * x8 * obj_qi))) + obj_py;
+		const GEN_FLT x14 = obj_qw * sensor_y;
+		const GEN_FLT x15 = obj_qi * sensor_z;
+		const GEN_FLT x16 = obj_qk * sensor_x;
+		const GEN_FLT x17 = x16 + (-1 * x15) + x14;
+		const GEN_FLT x18 = sensor_z + (2 * ((x17 * obj_qi) + (-1 * x12 * obj_qj))) + obj_pz;
+		const GEN_FLT x19 = sensor_x + (2 * ((x8 * obj_qj) + (-1 * x17 * obj_qk))) + obj_px;
+		const GEN_FLT x20 = (x19 * lh_qk) + (-1 * x18 * lh_qi) + (x13 * lh_qw);
+		const GEN_FLT x21 = (x13 * lh_qi) + (-1 * x19 * lh_qj) + (x18 * lh_qw);
+		const GEN_FLT x22 = x19 + (2 * ((x21 * lh_qj) + (-1 * x20 * lh_qk))) + lh_px;
+		const GEN_FLT x23 = (x18 * lh_qj) + (-1 * x13 * lh_qk) + (x19 * lh_qw);
+		const GEN_FLT x24 = x18 + (2 * ((x20 * lh_qi) + (-1 * x23 * lh_qj))) + lh_pz;
+		const GEN_FLT x25 = x24 * x24;
+		const GEN_FLT x26 = 1. / x25;
+		const GEN_FLT x27 = x22 * x26;
+		const GEN_FLT x31 = 1. / x24;
+		const GEN_FLT x32 = x22 * x22;
+		const GEN_FLT x33 = x25 + x32;
+		const GEN_FLT x34 = 1. / x33;
+		const GEN_FLT x35 = x34 * x25;
+		const GEN_FLT x36 = x35 * ((-1 * x30 * x31) + (x4 * x27));
+		const GEN_FLT x41 = (1. / sqrt(x33)) * tilt_0;
+		const GEN_FLT x42 = 2 * x22;
+		const GEN_FLT x43 = 2 * x24;
+		const GEN_FLT x44 = x4 * x43;
+		const GEN_FLT x45 = x13 + (2 * ((x23 * lh_qk) + (-1 * x21 * lh_qi))) + lh_py;
+		const GEN_FLT x46 = 1.0 / 2.0 * x45 * (1. / (x33 * sqrt(x33))) * tilt_0;
+		const GEN_FLT x47 = x45 * x45;
+		const GEN_FLT x48 = 1. / sqrt(1 + (-1 * x47 * x34 * c0));
+		const GEN_FLT x49 = (-1 * x48 * ((-1 * x46 * (x44 + (x42 * x30))) + (x40 * x41))) + (-1 * x36);
+		const GEN_FLT x50 = -1 * x24;
+		const GEN_FLT x51 = atan2(x22, x50);
+		const GEN_FLT x52 = sin(1.5707963267949 + (-1 * x51) + c1 + (-1 * asin(x41 * x45)) + gibPhase_0) * gibMag_0;
+		const GEN_FLT x53 = x45 * x26;
+		const GEN_FLT x54 = x4 * x53;
+		const GEN_FLT x55 = x40 * x31;
+		const GEN_FLT x56 = x25 + x47;
+		const GEN_FLT x57 = 1. / x56;
+		const GEN_FLT x58 = x57 * x25;
+		const GEN_FLT x59 = 2 * x58 * atan2(x45, x50) * curve_0;
+		const GEN_FLT x64 = ((-1 * x63 * x31) + (x62 * x27)) * x35;
+		const GEN_FLT x67 = x62 * x43;
+		const GEN_FLT x68 = (-1 * x48 * ((-1 * x46 * (x67 + (x63 * x42))) + (x66 * x41))) + (-1 * x64);
+		const GEN_FLT x69 = x62 * x53;
+		const GEN_FLT x70 = x66 * x31;
+		const GEN_FLT x73 = ((-1 * x72 * x31) + (x71 * x27)) * x35;
+		const GEN_FLT x75 = x71 * x43;
+		const GEN_FLT x76 = (-1 * x48 * ((-1 * x46 * (x75 + (x72 * x42))) + (x74 * x41))) + (-1 * x73);
+		const GEN_FLT x77 = x71 * x53;
+		const GEN_FLT x78 = x74 * x31;
+		const GEN_FLT x79 = 2 * x5;
+		const GEN_FLT x80 = 2 * x7;
+		const GEN_FLT x81 = x80 + (-1 * x79);
+		const GEN_FLT x82 = 2 * x15;
+		const GEN_FLT x83 = 2 * x16;
+		const GEN_FLT x84 = x83 + (-1 * x82);
+		const GEN_FLT x85 = 2 * x10;
+		const GEN_FLT x86 = 2 * x11;
+		const GEN_FLT x87 = x86 + (-1 * x85);
+		const GEN_FLT x88 = (x87 * lh_qw) + (-1 * x84 * lh_qk) + (x81 * lh_qj);
+		const GEN_FLT x89 = (x84 * lh_qw) + (-1 * x81 * lh_qi) + (x87 * lh_qk);
+		const GEN_FLT x90 = x81 + (x2 * x89) + (-1 * x0 * x88);
+		const GEN_FLT x92 = (x81 * lh_qw) + (-1 * x87 * lh_qj) + (x84 * lh_qi);
+		const GEN_FLT x93 = x87 + (x0 * x92) + (-1 * x89 * x91);
+		const GEN_FLT x94 = ((-1 * x93 * x31) + (x90 * x27)) * x35;
+		const GEN_FLT x95 = x84 + (x88 * x91) + (-1 * x2 * x92);
+		const GEN_FLT x96 = x90 * x43;
+		const GEN_FLT x97 = (-1 * x48 * ((-1 * x46 * (x96 + (x93 * x42))) + (x95 * x41))) + (-1 * x94);
+		const GEN_FLT x98 = x53 * x90;
+		const GEN_FLT x99 = x95 * x31;
+		const GEN_FLT x100 = 2 * x14;
+		const GEN_FLT x101 = (-4 * x15) + x100 + x83;
+		const GEN_FLT x102 = 2 * x6;
+		const GEN_FLT x103 = x79 + (-1 * x102) + (-4 * x7);
+		const GEN_FLT x104 = 2 * obj_qk * sensor_z;
+		const GEN_FLT x105 = 2 * obj_qj * sensor_y;
+		const GEN_FLT x106 = x105 + x104;
+		const GEN_FLT x107 = (x106 * lh_qw) + (-1 * x103 * lh_qk) + (x101 * lh_qj);
+		const GEN_FLT x108 = (x103 * lh_qw) + (-1 * x101 * lh_qi) + (x106 * lh_qk);
+		const GEN_FLT x109 = x101 + (x2 * x108) + (-1 * x0 * x107);
+		const GEN_FLT x110 = x26 * x109;
+		const GEN_FLT x111 = (x101 * lh_qw) + (-1 * x106 * lh_qj) + (x103 * lh_qi);
+		const GEN_FLT x112 = x106 + (x0 * x111) + (-1 * x91 * x108);
+		const GEN_FLT x113 = ((-1 * x31 * x112) + (x22 * x110)) * x35;
+		const GEN_FLT x114 = x103 + (x91 * x107) + (-1 * x2 * x111);
+		const GEN_FLT x115 = x43 * x109;
+		const GEN_FLT x116 = (-1 * x48 * ((-1 * x46 * (x115 + (x42 * x112))) + (x41 * x114))) + (-1 * x113);
+		const GEN_FLT x117 = x45 * x110;
+		const GEN_FLT x118 = x31 * x114;
+		const GEN_FLT x119 = 2 * x9;
+		const GEN_FLT x120 = (-1 * x119) + x85 + (-4 * x11);
+		const GEN_FLT x121 = 2 * obj_qi * sensor_x;
+		const GEN_FLT x122 = x104 + x121;
+		const GEN_FLT x123 = (-4 * x5) + x102 + x80;
+		const GEN_FLT x124 = (x123 * lh_qw) + (-1 * x122 * lh_qk) + (x120 * lh_qj);
+		const GEN_FLT x125 = (-1 * x120 * lh_qi) + (x122 * lh_qw) + (x123 * lh_qk);
+		const GEN_FLT x126 = x120 + (x2 * x125) + (-1 * x0 * x124);
+		const GEN_FLT x127 = (-1 * x123 * lh_qj) + (x120 * lh_qw) + (x122 * lh_qi);
+		const GEN_FLT x128 = x123 + (x0 * x127) + (-1 * x91 * x125);
+		const GEN_FLT x129 = ((-1 * x31 * x128) + (x27 * x126)) * x35;
+		const GEN_FLT x130 = x122 + (x91 * x124) + (-1 * x2 * x127);
+		const GEN_FLT x131 = x43 * x126;
+		const GEN_FLT x132 = (-1 * x48 * ((-1 * x46 * (x131 + (x42 * x128))) + (x41 * x130))) + (-1 * x129);
+		const GEN_FLT x133 = x53 * x126;
+		const GEN_FLT x134 = x31 * x130;
+		const GEN_FLT x135 = x121 + x105;
+		const GEN_FLT x136 = x119 + (-4 * x10) + x86;
+		const GEN_FLT x137 = (-1 * x100) + x82 + (-4 * x16);
+		const GEN_FLT x138 = (-1 * x136 * lh_qk) + (x137 * lh_qw) + (x135 * lh_qj);
+		const GEN_FLT x139 = (x136 * lh_qw) + (-1 * x135 * lh_qi) + (x137 * lh_qk);
+		const GEN_FLT x140 = x135 + (x2 * x139) + (-1 * x0 * x138);
+		const GEN_FLT x141 = (x135 * lh_qw) + (-1 * x137 * lh_qj) + (x136 * lh_qi);
+		const GEN_FLT x142 = x137 + (x0 * x141) + (-1 * x91 * x139);
+		const GEN_FLT x143 = ((-1 * x31 * x142) + (x27 * x140)) * x35;
+		const GEN_FLT x144 = x136 + (x91 * x138) + (-1 * x2 * x141);
+		const GEN_FLT x145 = x43 * x140;
+		const GEN_FLT x146 = (-1 * x48 * ((-1 * x46 * (x145 + (x42 * x142))) + (x41 * x144))) + (-1 * x143);
+		const GEN_FLT x147 = x53 * x140;
+		const GEN_FLT x148 = x31 * x144;
+		const GEN_FLT x149 = 2 * x51 * curve_1;
+		const GEN_FLT x150 = 1. / sqrt(1 + (-1 * x57 * x32 * c2));
+		const GEN_FLT x151 = (1. / sqrt(x56)) * tilt_1;
+		const GEN_FLT x152 = 2 * x45;
+		const GEN_FLT x153 = 1.0 / 2.0 * (1. / (x56 * sqrt(x56))) * x22 * tilt_1;
+		const GEN_FLT x154 = (-1 * x150 * ((-1 * x153 * (x44 + (x40 * x152))) + (x30 * x151))) + (-1 * (x55 + (-1 *
+			x54)) * x58);
+		const GEN_FLT x155 = sin(1.5707963267949 + (-1 * asin(x22 * x151)) + (-1 * atan2(-1 * x45, x50)) + c3 +
+			gibPhase_1) * gibMag_1;
+		const GEN_FLT x156 = (-1 * x150 * ((-1 * x153 * (x67 + (x66 * x152))) + (x63 * x151))) + (-1 * (x70 + (-1 *
+			x69)) * x58);
+		const GEN_FLT x157 = (-1 * x150 * ((-1 * x153 * (x75 + (x74 * x152))) + (x72 * x151))) + (-1 * (x78 + (-1 *
+			x77)) * x58);
+		const GEN_FLT x158 = (-1 * x150 * ((-1 * x153 * (x96 + (x95 * x152))) + (x93 * x151))) + (-1 * (x99 + (-1 *
+			x98)) * x58);
+		const GEN_FLT x159 = (-1 * x150 * ((-1 * x153 * (x115 + (x114 * x152))) + (x112 * x151))) + (-1 * (x118 + (-1 *
+			x117)) * x58);
+		const GEN_FLT x160 = (-1 * x150 * ((-1 * x153 * (x131 + (x130 * x152))) + (x128 * x151))) + (-1 * (x134 + (-1 *
+			x133)) * x58);
+		const GEN_FLT x161 = (-1 * x150 * ((-1 * x153 * (x145 + (x144 * x152))) + (x142 * x151))) + (-1 * (x148 + (-1 *
+			x147)) * x58);
+		out[i] = x49 + (((-1 * x55) + x54) * x59) + (x52 * x49);
+		out[n + i] = x68 + (((-1 * x70) + x69) * x59) + (x68 * x52);
+		out[2 * n + i] = (((-1 * x78) + x77) * x59) + x76 + (x76 * x52);
+		out[3 * n + i] = x97 + (((-1 * x99) + x98) * x59) + (x52 * x97);
+		out[4 * n + i] = x116 + (((-1 * x118) + x117) * x59) + (x52 * x116);
+		out[5 * n + i] = x132 + (((-1 * x134) + x133) * x59) + (x52 * x132);
+		out[6 * n + i] = x146 + (((-1 * x148) + x147) * x59) + (x52 * x146);
+		out[7 * n + i] = x154 + (x154 * x155) + (x36 * x149);
+		out[8 * n + i] = x156 + (x155 * x156) + (x64 * x149);
+		out[9 * n + i] = x157 + (x155 * x157) + (x73 * x149);
+		out[10 * n + i] = x158 + (x155 * x158) + (x94 * x149);
+		out[11 * n + i] = x159 + (x155 * x159) + (x113 * x149);
+		out[12 * n + i] = (x160 * x155) + x160 + (x129 * x149);
+		out[13 * n + i] = x161 + (x161 * x155) + (x143 * x149);
+	}
+}
+
+static inline void gen_reproject_axis_x_batch(FLT *GEN_RESTRICT out, size_t n, const SurvivePose *obj_p,
+											  const FLT *GEN_RESTRICT sensor_pt, const SurvivePose *lh_p,
+											  const BaseStationCal *bsc0) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qw = (*obj_p).Rot[0];
+	const GEN_FLT obj_qi = (*obj_p).Rot[1];
+	const GEN_FLT obj_qj = (*obj_p).Rot[2];
+	const GEN_FLT obj_qk = (*obj_p).Rot[3];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qw = (*lh_p).Rot[0];
+	const GEN_FLT lh_qi = (*lh_p).Rot[1];
+	const GEN_FLT lh_qj = (*lh_p).Rot[2];
+	const GEN_FLT lh_qk = (*lh_p).Rot[3];
+	const GEN_FLT phase_0 = (*bsc0).phase;
+	const GEN_FLT tilt_0 = (*bsc0).tilt;
+	const GEN_FLT curve_0 = (*bsc0).curve;
+	const GEN_FLT gibPhase_0 = (*bsc0).gibpha;
+	const GEN_FLT gibMag_0 = (*bsc0).gibmag;
+	const GEN_FLT ogeeMag_0 = (*bsc0).ogeephase;
+	const GEN_FLT ogeePhase_0 = (*bsc0).ogeemag;
+	const GEN_FLT c0 = -1 * phase_0;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x0 = (obj_qj * sensor_z) + (-1 * obj_qk * sensor_y) + (obj_qw * sensor_x);
+		const GEN_FLT x1 = (obj_qk * sensor_x) + (-1 * obj_qi * sensor_z) + (obj_qw * sensor_y);
+		const GEN_FLT x2 = sensor_z + (2 * ((x1 * obj_qi) + (-1 * x0 * obj_qj))) + obj_pz;
+		const GEN_FLT x3 = (obj_qi * sensor_y) + (obj_qw * sensor_z) + (-1 * obj_qj * sensor_x);
+		const GEN_FLT x4 = sensor_x + (2 * ((x3 * obj_qj) + (-1 * x1 * obj_qk))) + obj_px;
+		const GEN_FLT x5 = sensor_y + (2 * ((x0 * obj_qk) + (-1 * x3 * obj_qi))) + obj_py;
+		const GEN_FLT x6 = (x5 * lh_qi) + (-1 * x4 * lh_qj) + (x2 * lh_qw);
+		const GEN_FLT x7 = (-1 * x5 * lh_qk) + (x2 * lh_qj) + (x4 * lh_qw);
+		const GEN_FLT x8 = x5 + (2 * ((x7 * lh_qk) + (-1 * x6 * lh_qi))) + lh_py;
+		const GEN_FLT x9 = (x4 * lh_qk) + (-1 * x2 * lh_qi) + (x5 * lh_qw);
+		const GEN_FLT x10 = x2 + (2 * ((x9 * lh_qi) + (-1 * x7 * lh_qj))) + lh_pz;
+		const GEN_FLT x11 = -1 * x10;
+		const GEN_FLT x12 = x4 + (2 * ((x6 * lh_qj) + (-1 * x9 * lh_qk))) + lh_px;
+		const GEN_FLT x13 = (-1 * atan2(x12, x11)) + c0 + (-1 * asin((1. / sqrt((x12 * x12) + (x10 * x10))) * x8 *
+			tilt_0));
+		out[i] = x13 + (-1 * cos(1.5707963267949 + x13 + gibPhase_0) * gibMag_0) + ((atan2(x8, x11) * atan2(x8, x11)) *
+			curve_0);
+	}
+}
+
+// Jacobian of reproject_axis_x wrt [obj_px, obj_py, obj_pz, obj_qw, obj_qi, obj_qj, obj_qk]
+static inline void gen_reproject_axis_x_jac_obj_p_batch(FLT *GEN_RESTRICT out, size_t n, const SurvivePose *obj_p,
+														const FLT *GEN_RESTRICT sensor_pt, const SurvivePose *lh_p,
+														const BaseStationCal *bsc0) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qw = (*obj_p).Rot[0];
+	const GEN_FLT obj_qi = (*obj_p).Rot[1];
+	const GEN_FLT obj_qj = (*obj_p).Rot[2];
+	const GEN_FLT obj_qk = (*obj_p).Rot[3];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qw = (*lh_p).Rot[0];
+	const GEN_FLT lh_qi = (*lh_p).Rot[1];
+	const GEN_FLT lh_qj = (*lh_p).Rot[2];
+	const GEN_FLT lh_qk = (*lh_p).Rot[3];
+	const GEN_FLT phase_0 = (*bsc0).phase;
+	const GEN_FLT tilt_0 = (*bsc0).tilt;
+	const GEN_FLT curve_0 = (*bsc0).curve;
+	const GEN_FLT gibPhase_0 = (*bsc0).gibpha;
+	const GEN_FLT gibMag_0 = (*bsc0).gibmag;
+	const GEN_FLT ogeeMag_0 = (*bsc0).ogeephase;
+	const GEN_FLT ogeePhase_0 = (*bsc0).ogeemag;
+	const GEN_FLT x0 = 2 * lh_qj;
+	const GEN_FLT x1 = x0 * lh_qw;
+	const GEN_FLT x2 = 2 * lh_qk;
+	const GEN_FLT x3 = x2 * lh_qi;
+	const GEN_FLT x4 = x3 + (-1 * x1);
+	const GEN_FLT x28 = -2 * (lh_qk * lh_qk);
+	const GEN_FLT x29 = -2 * (lh_qj * lh_qj);
+	const GEN_FLT x30 = 1 + x29 + x28;
+	const GEN_FLT x35 = 2 * lh_qi;
+	const GEN_FLT x36 = x35 * lh_qj;
+	const GEN_FLT x37 = x2 * lh_qw;
+	const GEN_FLT x38 = x37 + x36;
+	const GEN_FLT x51 = x2 * lh_qj;
+	const GEN_FLT x52 = x35 * lh_qw;
+	const GEN_FLT x53 = x52 + x51;
+	const GEN_FLT x55 = x36 + (-1 * x37);
+	const GEN_FLT x56 = 1 + (-2 * (lh_qi * lh_qi));
+	const GEN_FLT x57 = x56 + x28;
+	const GEN_FLT x59 = x56 + x29;
+	const GEN_FLT x60 = x1 + x3;
+	const GEN_FLT x61 = x51 + (-1 * x52);
+	const GEN_FLT c0 = tilt_0 * tilt_0;
+	const GEN_FLT c1 = -1 * phase_0;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x5 = obj_qw * sensor_y;
+		const GEN_FLT x6 = obj_qi * sensor_z;
+		const GEN_FLT x7 = obj_qk * sensor_x;
+		const GEN_FLT x8 = x7 + (-1 * x6) + x5;
+		const GEN_FLT x9 = obj_qj * sensor_x;
+		const GEN_FLT x10 = obj_qw * sensor_z;
+		const GEN_FLT x11 = obj_qi * sensor_y;
+		const GEN_FLT x12 = x11 + x10 + (-1 * x9);
+		const GEN_FLT x13 = sensor_x + (2 * ((x12 * obj_qj) + (-1 * x8 * obj_qk))) + obj_px;
+		const GEN_FLT x14 = obj_qw * sensor_x;
+		const GEN_FLT x15 = obj_qk * sensor_y;
+		const GEN_FLT x16 = obj_qj * sensor_z;
+		const GEN_FLT x17 = x16 + (-1 * x15) + x14;
+		const GEN_FLT x18 = sensor_y + (2 * ((x17 * obj_qk) + (-1 * x12 * obj_qi))) + obj_py;
+		const GEN_FLT x19 = sensor_z + (2 * ((x8 * obj_qi) + (-1 * x17 * obj_qj))) + obj_pz;
+		const GEN_FLT x20 = (x19 * lh_qj) + (-1 * x18 * lh_qk) + (x13 * lh_qw);
+		const GEN_FLT x21 = (x13 * lh_qk) + (-1 * x19 * lh_qi) + (x18 * lh_qw);
+		const GEN_FLT x22 = (2 * ((x21 * lh_qi) + (-1 * x20 * lh_qj))) + x19 + lh_pz;
+		const GEN_FLT x23 = x22 * x22;
+		const GEN_FLT x24 = 1. / x23;
+		const GEN_FLT x25 = (x18 * lh_qi) + (-1 * x13 * lh_qj) + (x19 * lh_qw);
+		const GEN_FLT x26 = x13 + (2 * ((x25 * lh_qj) + (-1 * x21 * lh_qk))) + lh_px;
+		const GEN_FLT x27 = x24 * x26;
+		const GEN_FLT x31 = 1. / x22;
+		const GEN_FLT x32 = x23 + (x26 * x26);
+		const GEN_FLT x33 = 1. / x32;
+		const GEN_FLT x34 = x33 * x23;
+		const GEN_FLT x39 = (1. / sqrt(x32)) * tilt_0;
+		const GEN_FLT x40 = 2 * x26;
+		const GEN_FLT x41 = 2 * x22;
+		const GEN_FLT x42 = x18 + (2 * ((x20 * lh_qk) + (-1 * x25 * lh_qi))) + lh_py;
+		const GEN_FLT x43 = 1.0 / 2.0 * x42 * (1. / (x32 * sqrt(x32))) * tilt_0;
+		const GEN_FLT x44 = x42 * x42;
+		const GEN_FLT x45 = 1. / sqrt(1 + (-1 * x44 * x33 * c0));
+		const GEN_FLT x46 = (-1 * x45 * ((-1 * x43 * ((x4 * x41) + (x40 * x30))) + (x38 * x39))) + (-1 * x34 * ((-1 *
+			x30 * x31) + (x4 * x27)));
+		const GEN_FLT x47 = -1 * x22;
+		const GEN_FLT x48 = sin(1.5707963267949 + (-1 * atan2(x26, x47)) + c1 + (-1 * asin(x42 * x39)) + gibPhase_0) *
+			gibMag_0;
+		const GEN_FLT x49 = x42 * x24;
+		const GEN_FLT x50 = 2 * (1. / (x23 + x44)) * x23 * atan2(x42, x47) * curve_0;
+		const GEN_FLT x54 = x53 * x24;
+		const GEN_FLT x58 = (-1 * x45 * ((-1 * ((x53 * x41) + (x55 * x40)) * x43) + (x57 * x39))) + (-1 * ((-1 * x55 *
+			x31) + (x54 * x26)) * x34);
+		const GEN_FLT x62 = (-1 * x45 * ((-1 * ((x59 * x41) + (x60 * x40)) * x43) + (x61 * x39))) + (-1 * ((-1 * x60 *
+			x31) + (x59 * x27)) * x34);
+		const GEN_FLT x63 = 2 * x9;
+		const GEN_FLT x64 = 2 * x11;
+		const GEN_FLT x65 = x64 + (-1 * x63);
+		const GEN_FLT x66 = 2 * x6;
+		const GEN_FLT x67 = 2 * x7;
+		const GEN_FLT x68 = x67 + (-1 * x66);
+		const GEN_FLT x69 = 2 * x15;
+		const GEN_FLT x70 = 2 * x16;
+		const GEN_FLT x71 = x70 + (-1 * x69);
+		const GEN_FLT x72 = (x71 * lh_qw) + (-1 * x68 * lh_qk) + (x65 * lh_qj);
+		const GEN_FLT x73 = (x68 * lh_qw) + (-1 * x65 * lh_qi) + (x71 * lh_qk);
+		const GEN_FLT x74 = x65 + (x73 * x35) + (-1 * x0 * x72);
+		const GEN_FLT x75 = (x65 * lh_qw) + (-1 * x71 * lh_qj) + (x68 * lh_qi);
+		const GEN_FLT x76 = x71 + (x0 * x75) + (-1 * x2 * x73);
+		const GEN_FLT x77 = x68 + (x2 * x72) + (-1 * x75 * x35);
+		const GEN_FLT x78 = (-1 * x45 * ((-1 * ((x74 * x41) + (x76 * x40)) * x43) + (x77 * x39))) + (-1 * ((-1 * x76 *
+			x31) + (x74 * x27)) * x34);
+		const GEN_FLT x79 = 2 * x5;
+		const GEN_FLT x80 = x79 + (-4 * x6) + x67;
+		const GEN_FLT x81 = 2 * x10;
+		const GEN_FLT x82 = x63 + (-1 * x81) + (-4 * x11);
+		const GEN_FLT x83 = 2 * obj_qk * sensor_z;
+		const GEN_FLT x84 = 2 * obj_qj * sensor_y;
+		const GEN_FLT x85 = x84 + x83;
+		const GEN_FLT x86 = (x85 * lh_qw) + (-1 * x82 * lh_qk) + (x80 * lh_qj);
+		const GEN_FLT x87 = (x82 * lh_qw) + (-1 * x80 * lh_qi) + (x85 * lh_qk);
+		const GEN_FLT x88 = (x87 * x35) + x80 + (-1 * x0 * x86);
+		const GEN_FLT x89 = x88 * x24;
+		const GEN_FLT x90 = (x80 * lh_qw) + (-1 * x85 * lh_qj) + (x82 * lh_qi);
+		const GEN_FLT x91 = x85 + (x0 * x90) + (-1 * x2 * x87);
+		const GEN_FLT x92 = x82 + (x2 * x86) + (-1 * x90 * x35);
+		const GEN_FLT x93 = (-1 * x45 * ((-1 * ((x88 * x41) + (x91 * x40)) * x43) + (x92 * x39))) + (-1 * ((-1 * x91 *
+			x31) + (x89 * x26)) * x34);
+		const GEN_FLT x94 = 2 * x14;
+		const GEN_FLT x95 = (-1 * x94) + x69 + (-4 * x16);
+		const GEN_FLT x96 = 2 * obj_qi * sensor_x;
+		const GEN_FLT x97 = x83 + x96;
+		const GEN_FLT x98 = (-4 * x9) + x81 + x64;
+		const GEN_FLT x99 = (-1 * x97 * lh_qk) + (x98 * lh_qw) + (x95 * lh_qj);
+		const GEN_FLT x100 = (x97 * lh_qw) + (-1 * x95 * lh_qi) + (x98 * lh_qk);
+		const GEN_FLT x101 = (x35 * x100) + x95 + (-1 * x0 * x99);
+		const GEN_FLT x102 = (x95 * lh_qw) + (-1 * x98 * lh_qj) + (x97 * lh_qi);
+		const GEN_FLT x103 = x98 + (x0 * x102) + (-1 * x2 * x100);
+		const GEN_FLT x104 = x97 + (x2 * x99) + (-1 * x35 * x102);
+		const GEN_FLT x105 = (-1 * x45 * ((-1 * ((x41 * x101) + (x40 * x103)) * x43) + (x39 * x104))) + (-1 * ((-1 *
+			x31 * x103) + (x27 * x101)) * x34);
+		const GEN_FLT x106 = x96 + x84;
+		const GEN_FLT x107 = x94 + (-4 * x15) + x70;
+		const GEN_FLT x108 = (-1 * x79) + x66 + (-4 * x7);
+		const GEN_FLT x109 = (x108 * lh_qw) + (-1 * x107 * lh_qk) + (x106 * lh_qj);
+		const GEN_FLT x110 = (x107 * lh_qw) + (-1 * x106 * lh_qi) + (x108 * lh_qk);
+		const GEN_FLT x111 = x106 + (x35 * x110) + (-1 * x0 * x109);
+		const GEN_FLT x112 = (x106 * lh_qw) + (-1 * x108 * lh_qj) + (x107 * lh_qi);
+		const GEN_FLT x113 = x108 + (x0 * x112) + (-1 * x2 * x110);
+		const GEN_FLT x114 = x107 + (x2 * x109) + (-1 * x35 * x112);
+		const GEN_FLT x115 = (-1 * x45 * ((-1 * ((x41 * x111) + (x40 * x113)) * x43) + (x39 * x114))) + (-1 * ((-1 *
+			x31 * x113) + (x27 * x111)) * x34);
+		out[i] = x46 + (x50 * ((-1 * x31 * x38) + (x4 * x49))) + (x46 * x48);
+		out[n + i] = x58 + (((-1 * x57 * x31) + (x54 * x42)) * x50) + (x58 * x48);
+		out[2 * n + i] = x62 + (((-1 * x61 * x31) + (x59 * x49)) * x50) + (x62 * x48);
+		out[3 * n + i] = x78 + (((-1 * x77 * x31) + (x74 * x49)) * x50) + (x78 * x48);
+		out[4 * n + i] = x93 + (((-1 * x92 * x31) + (x89 * x42)) * x50) + (x93 * x48);
+		out[5 * n + i] = x105 + (((-1 * x31 * x104) + (x49 * x101)) * x50) + (x48 * x105);
+		out[6 * n + i] = x115 + (((-1 * x31 * x114) + (x49 * x111)) * x50) + (x48 * x115);
+	}
+}
+
+static inline void gen_reproject_axis_y_batch(FLT *GEN_RESTRICT out, size_t n, const SurvivePose *obj_p,
+											  const FLT *GEN_RESTRICT sensor_pt, const SurvivePose *lh_p,
+											  const BaseStationCal *bsc1) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qw = (*obj_p).Rot[0];
+	const GEN_FLT obj_qi = (*obj_p).Rot[1];
+	const GEN_FLT obj_qj = (*obj_p).Rot[2];
+	const GEN_FLT obj_qk = (*obj_p).Rot[3];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qw = (*lh_p).Rot[0];
+	const GEN_FLT lh_qi = (*lh_p).Rot[1];
+	const GEN_FLT lh_qj = (*lh_p).Rot[2];
+	const GEN_FLT lh_qk = (*lh_p).Rot[3];
+	const GEN_FLT phase_1 = (*bsc1).phase;
+	const GEN_FLT tilt_1 = (*bsc1).tilt;
+	const GEN_FLT curve_1 = (*bsc1).curve;
+	const GEN_FLT gibPhase_1 = (*bsc1).gibpha;
+	const GEN_FLT gibMag_1 = (*bsc1).gibmag;
+	const GEN_FLT ogeeMag_1 = (*bsc1).ogeephase;
+	const GEN_FLT ogeePhase_1 = (*bsc1).ogeemag;
+	const GEN_FLT c0 = -1 * phase_1;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x0 = (obj_qk * sensor_x) + (-1 * obj_qi * sensor_z) + (obj_qw * sensor_y);
+		const GEN_FLT x1 = (obj_qi * sensor_y) + (obj_qw * sensor_z) + (-1 * obj_qj * sensor_x);
+		const GEN_FLT x2 = sensor_x + (2 * ((x1 * obj_qj) + (-1 * x0 * obj_qk))) + obj_px;
+		const GEN_FLT x3 = (obj_qj * sensor_z) + (-1 * obj_qk * sensor_y) + (obj_qw * sensor_x);
+		const GEN_FLT x4 = sensor_y + (2 * ((x3 * obj_qk) + (-1 * x1 * obj_qi))) + obj_py;
+		const GEN_FLT x5 = sensor_z + (2 * ((x0 * obj_qi) + (-1 * x3 * obj_qj))) + obj_pz;
+		const GEN_FLT x6 = (x5 * lh_qj) + (-1 * x4 * lh_qk) + (x2 * lh_qw);
+		const GEN_FLT x7 = (x2 * lh_qk) + (-1 * x5 * lh_qi) + (x4 * lh_qw);
+		const GEN_FLT x8 = x5 + (2 * ((x7 * lh_qi) + (-1 * x6 * lh_qj))) + lh_pz;
+		const GEN_FLT x9 = (x4 * lh_qi) + (-1 * x2 * lh_qj) + (x5 * lh_qw);
+		const GEN_FLT x10 = (2 * ((x6 * lh_qk) + (-1 * x9 * lh_qi))) + x4 + lh_py;
+		const GEN_FLT x11 = x2 + (2 * ((x9 * lh_qj) + (-1 * x7 * lh_qk))) + lh_px;
+		const GEN_FLT x12 = -1 * x8;
+		const GEN_FLT x13 = (-1 * atan2(-1 * x10, x12)) + (-1 * asin(x11 * (1. / sqrt((x10 * x10) + (x8 * x8))) *
+			tilt_1)) + c0;
+		out[i] = x13 + ((atan2(x11, x12) * atan2(x11, x12)) * curve_1) + (-1 * cos(1.5707963267949 + x13 + gibPhase_1)
+			* gibMag_1);
+	}
+}
+
+// Jacobian of reproject_axis_y wrt [obj_px, obj_py, obj_pz, obj_qw, obj_qi, obj_qj, obj_qk]
+static inline void gen_reproject_axis_y_jac_obj_p_batch(FLT *GEN_RESTRICT out, size_t n, const SurvivePose *obj_p,
+														const FLT *GEN_RESTRICT sensor_pt, const SurvivePose *lh_p,
+														const BaseStationCal *bsc1) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qw = (*obj_p).Rot[0];
+	const GEN_FLT obj_qi = (*obj_p).Rot[1];
+	const GEN_FLT obj_qj = (*obj_p).Rot[2];
+	const GEN_FLT obj_qk = (*obj_p).Rot[3];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qw = (*lh_p).Rot[0];
+	const GEN_FLT lh_qi = (*lh_p).Rot[1];
+	const GEN_FLT lh_qj = (*lh_p).Rot[2];
+	const GEN_FLT lh_qk = (*lh_p).Rot[3];
+	const GEN_FLT phase_1 = (*bsc1).phase;
+	const GEN_FLT tilt_1 = (*bsc1).tilt;
+	const GEN_FLT curve_1 = (*bsc1).curve;
+	const GEN_FLT gibPhase_1 = (*bsc1).gibpha;
+	const GEN_FLT gibMag_1 = (*bsc1).gibmag;
+	const GEN_FLT ogeeMag_1 = (*bsc1).ogeephase;
+	const GEN_FLT ogeePhase_1 = (*bsc1).ogeemag;
+	const GEN_FLT x0 = 2 * lh_qj;
+	const GEN_FLT x1 = x0 * lh_qw;
+	const GEN_FLT x2 = 2 * lh_qk;
+	const GEN_FLT x3 = x2 * lh_qi;
+	const GEN_FLT x4 = x3 + (-1 * x1);
+	const GEN_FLT x28 = -2 * (lh_qk * lh_qk);
+	const GEN_FLT x29 = -2 * (lh_qj * lh_qj);
+	const GEN_FLT x30 = 1 + x29 + x28;
+	const GEN_FLT x37 = x0 * lh_qi;
+	const GEN_FLT x38 = x2 * lh_qw;
+	const GEN_FLT x39 = x38 + x37;
+	const GEN_FLT x50 = x2 * lh_qj;
+	const GEN_FLT x51 = 2 * lh_qi;
+	const GEN_FLT x52 = x51 * lh_qw;
+	const GEN_FLT x53 = x52 + x50;
+	const GEN_FLT x54 = x37 + (-1 * x38);
+	const GEN_FLT x55 = 1 + (-2 * (lh_qi * lh_qi));
+	const GEN_FLT x56 = x55 + x28;
+	const GEN_FLT x58 = x55 + x29;
+	const GEN_FLT x59 = x1 + x3;
+	const GEN_FLT x60 = x50 + (-1 * x52);
+	const GEN_FLT c0 = tilt_1 * tilt_1;
+	const GEN_FLT c1 = -1 * phase_1;
+	for (size_t i = 0; i < n; i++) {
+		const GEN_FLT sensor_x = sensor_pt[i];
+		const GEN_FLT sensor_y = sensor_pt[n + i];
+		const GEN_FLT sensor_z = sensor_pt[2 * n + i];
+		const GEN_FLT x5 = obj_qj * sensor_x;
+		const GEN_FLT x6 = obj_qw * sensor_z;
+		const GEN_FLT x7 = obj_qi * sensor_y;
+		const GEN_FLT x8 = x7 + x6 + (-1 * x5);
+		const GEN_FLT x9 = obj_qw * sensor_x;
+		const GEN_FLT x10 = obj_qk * sensor_y;
+		const GEN_FLT x11 = obj_qj * sensor_z;
+		const GEN_FLT x12 = x11 + (-1 * x10) + x9;
+		const GEN_FLT x13 = sensor_y + (2 * ((x12 * obj_qk) + (-1 * x8 * obj_qi))) + obj_py;
+		const GEN_FLT x14 = obj_qw * sensor_y;
+		const GEN_FLT x15 = obj_qi * sensor_z;
+		const GEN_FLT x16 = obj_qk * sensor_x;
+		const GEN_FLT x17 = x16 + (-1 * x15) + x14;
+		const GEN_FLT x18 = sensor_z + (2 * ((x17 * obj_qi) + (-1 * x12 * obj_qj))) + obj_pz;
+		const GEN_FLT x19 = sensor_x + (2 * ((x8 * obj_qj) + (-1 * x17 * obj_qk))) + obj_px;
+		const GEN_FLT x20 = (x19 * lh_qk) + (-1 * x18 * lh_qi) + (x13 * lh_qw);
+		const GEN_FLT x21 = (x13 * lh_qi) + (-1 * x19 * lh_qj) + (x18 * lh_qw);
+		const GEN_FLT x22 = x19 + (2 * ((x21 * lh_qj) + (-1 * x20 * lh_qk))) + lh_px;
+		const GEN_FLT x23 = (x18 * lh_qj) + (-1 * x13 * lh_qk) + (x19 * lh_qw);
+		const GEN_FLT x24 = x18 + (2 * ((x20 * lh_qi) + (-1 * x23 * lh_qj))) + lh_pz;
+		const GEN_FLT x25 = x24 * x24;
+		const GEN_FLT x26 = 1. / x25;
+		const GEN_FLT x27 = x22 * x26;
+		const GEN_FLT x31 = 1. / x24;
+		const GEN_FLT x32 = x22 * x22;
+		const GEN_FLT x33 = -1 * x24;
+		const GEN_FLT x34 = 2 * (1. / (x25 + x32)) * x25 * atan2(x22, x33) * curve_1;
+		const GEN_FLT x35 = x13 + (2 * ((x23 * lh_qk) + (-1 * x21 * lh_qi))) + lh_py;
+		const GEN_FLT x36 = x35 * x26;
+		const GEN_FLT x40 = x25 + (x35 * x35);
+		const GEN_FLT x41 = 1. / x40;
+		const GEN_FLT x42 = x41 * x25;
+		const GEN_FLT x43 = 1. / sqrt(1 + (-1 * x41 * x32 * c0));
+		const GEN_FLT x44 = (1. / sqrt(x40)) * tilt_1;
+		const GEN_FLT x45 = 2 * x35;
+		const GEN_FLT x46 = 2 * x24;
+		const GEN_FLT x47 = 1.0 / 2.0 * (1. / (x40 * sqrt(x40))) * x22 * tilt_1;
+		const GEN_FLT x48 = (-1 * x43 * ((-1 * x47 * ((x4 * x46) + (x45 * x39))) + (x44 * x30))) + (-1 * x42 * ((x31 *
+			x39) + (-1 * x4 * x36)));
+		const GEN_FLT x49 = sin(1.5707963267949 + (-1 * atan2(-1 * x35, x33)) + (-1 * asin(x44 * x22)) + c1 +
+			gibPhase_1) * gibMag_1;
+		const GEN_FLT x57 = (-1 * x43 * ((-1 * ((x53 * x46) + (x56 * x45)) * x47) + (x54 * x44))) + (-1 * ((x56 * x31)
+			+ (-1 * x53 * x36)) * x42);
+		const GEN_FLT x61 = (-1 * x43 * ((-1 * ((x58 * x46) + (x60 * x45)) * x47) + (x59 * x44))) + (-1 * ((x60 * x31)
+			+ (-1 * x58 * x36)) * x42);
+		const GEN_FLT x62 = 2 * x5;
+		const GEN_FLT x63 = 2 * x7;
+		const GEN_FLT x64 = x63 + (-1 * x62);
+		const GEN_FLT x65 = 2 * x15;
+		const GEN_FLT x66 = 2 * x16;
+		const GEN_FLT x67 = x66 + (-1 * x65);
+		const GEN_FLT x68 = 2 * x10;
+		const GEN_FLT x69 = 2 * x11;
+		const GEN_FLT x70 = x69 + (-1 * x68);
+		const GEN_FLT x71 = (x70 * lh_qw) + (-1 * x67 * lh_qk) + (x64 * lh_qj);
+		const GEN_FLT x72 = (x67 * lh_qw) + (-1 * x64 * lh_qi) + (x70 * lh_qk);
+		const GEN_FLT x73 = x64 + (x72 * x51) + (-1 * x0 * x71);
+		const GEN_FLT x74 = (x64 * lh_qw) + (-1 * x70 * lh_qj) + (x67 * lh_qi);
+		const GEN_FLT x75 = x70 + (x0 * x74) + (-1 * x2 * x72);
+		const GEN_FLT x76 = x67 + (x2 * x71) + (-1 * x74 * x51);
+		const GEN_FLT x77 = (-1 * x43 * ((-1 * ((x73 * x46) + (x76 * x45)) * x47) + (x75 * x44))) + (-1 * ((x76 * x31)
+			+ (-1 * x73 * x36)) * x42);
+		const GEN_FLT x78 = 2 * x14;
+		const GEN_FLT x79 = (-4 * x15) + x78 + x66;
+		const GEN_FLT x80 = 2 * x6;
+		const GEN_FLT x81 = x62 + (-1 * x80) + (-4 * x7);
+		const GEN_FLT x82 = 2 * obj_qk * sensor_z;
+		const GEN_FLT x83 = 2 * obj_qj * sensor_y;
+		const GEN_FLT x84 = x83 + x82;
+		const GEN_FLT x85 = (x84 * lh_qw) + (-1 * x81 * lh_qk) + (x79 * lh_qj);
+		const GEN_FLT x86 = (x81 * lh_qw) + (-1 * x79 * lh_qi) + (x84 * lh_qk);
+		const GEN_FLT x87 = x79 + (x86 * x51) + (-1 * x0 * x85);
+		const GEN_FLT x88 = (x79 * lh_qw) + (-1 * x84 * lh_qj) + (x81 * lh_qi);
+		const GEN_FLT x89 = x84 + (x0 * x88) + (-1 * x2 * x86);
+		const GEN_FLT x90 = x81 + (x2 * x85) + (-1 * x88 * x51);
+		const GEN_FLT x91 = (-1 * x43 * ((-1 * ((x87 * x46) + (x90 * x45)) * x47) + (x89 * x44))) + (-1 * ((x90 * x31)
+			+ (-1 * x87 * x36)) * x42);
+		const GEN_FLT x92 = 2 * x9;
+		const GEN_FLT x93 = (-1 * x92) + x68 + (-4 * x11);
+		const GEN_FLT x94 = 2 * obj_qi * sensor_x;
+		const GEN_FLT x95 = x82 + x94;
+		const GEN_FLT x96 = (-4 * x5) + x80 + x63;
+		const GEN_FLT x97 = (x96 * lh_qw) + (-1 * x95 * lh_qk) + (x93 * lh_qj);
+		const GEN_FLT x98 = (x95 * lh_qw) + (-1 * x93 * lh_qi) + (x96 * lh_qk);
+		const GEN_FLT x99 = x93 + (x51 * x98) + (-1 * x0 * x97);
+		const GEN_FLT x100 = (x93 * lh_qw) + (-1 * x96 * lh_qj) + (x95 * lh_qi);
+		const GEN_FLT x101 = x96 + (x0 * x100) + (-1 * x2 * x98);
+		const GEN_FLT x102 = x95 + (x2 * x97) + (-1 * x51 * x100);
+		const GEN_FLT x103 = (-1 * x43 * ((-1 * x47 * ((x99 * x46) + (x45 * x102))) + (x44 * x101))) + (-1 * x42 *
+			((x31 * x102) + (-1 * x99 * x36)));
+		const GEN_FLT x104 = x94 + x83;
+		const GEN_FLT x105 = x92 + (-4 * x10) + x69;
+		const GEN_FLT x106 = (-1 * x78) + x65 + (-4 * x16);
+		const GEN_FLT x107 = (-1 * x105 * lh_qk) + (x106 * lh_qw) + (x104 * lh_qj);
+		const GEN_FLT x108 = (x105 * lh_qw) + (-1 * x104 * lh_qi) + (x106 * lh_qk);
+		const GEN_FLT x109 = x104 + (x51 * x108) + (-1 * x0 * x107);
+		const GEN_FLT x110 = 2 * ((x104 * lh_qw) + (-1 * x106 * lh_qj) + (x105 * lh_qi));
+		const GEN_FLT x111 = (x110 * lh_qj) + x106 + (-1 * x2 * x108);
+		const GEN_FLT x112 = x105 + (x2 * x107) + (-1 * x110 * lh_qi);
+		const GEN_FLT x113 = (-1 * x43 * ((-1 * ((x46 * x109) + (x45 * x112)) * x47) + (x44 * x111))) + (-1 * ((x31 *
+			x112) + (-1 * x36 * x109)) * x42);
+		out[i] = x48 + (x48 * x49) + (x34 * ((-1 * x30 * x31) + (x4 * x27)));
+		out[n + i] = x57 + (x57 * x49) + (((-1 * x54 * x31) + (x53 * x27)) * x34);
+		out[2 * n + i] = x61 + (x61 * x49) + (((-1 * x59 * x31) + (x58 * x27)) * x34);
+		out[3 * n + i] = x77 + (x77 * x49) + (((-1 * x75 * x31) + (x73 * x27)) * x34);
+		out[4 * n + i] = x91 + (x91 * x49) + (((-1 * x89 * x31) + (x87 * x27)) * x34);
+		out[5 * n + i] = x103 + (x49 * x103) + (x34 * ((-1 * x31 * x101) + (x99 * x27)));
+		out[6 * n + i] = x113 + (x49 * x113) + (((-1 * x31 * x111) + (x27 * x109)) * x34);
+	}
+}
+
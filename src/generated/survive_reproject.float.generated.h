@@ -0,0 +1,347 @@
+#pragma once
+#include "common_float.h"
+static inline void gen_reproject_gen2_axis_angle_eval_float(FLT *out, const FLT *prepared, const FLT *sensor_pt) {
+	const GEN_FLTF obj_px = prepared[0];
+	const GEN_FLTF obj_py = prepared[1];
+	const GEN_FLTF obj_pz = prepared[2];
+	const GEN_FLTF lh_px = prepared[3];
+	const GEN_FLTF lh_py = prepared[4];
+	const GEN_FLTF curve_0 = prepared[5];
+	const GEN_FLTF gibPhase_0 = prepared[6];
+	const GEN_FLTF gibMag_0 = prepared[7];
+	const GEN_FLTF ogeeMag_0 = prepared[8];
+	const GEN_FLTF ogeePhase_0 = prepared[9];
+	const GEN_FLTF curve_1 = prepared[10];
+	const GEN_FLTF gibPhase_1 = prepared[11];
+	const GEN_FLTF gibMag_1 = prepared[12];
+	const GEN_FLTF ogeeMag_1 = prepared[13];
+	const GEN_FLTF ogeePhase_1 = prepared[14];
+	const GEN_FLTF x43 = prepared[15];
+	const GEN_FLTF x54 = prepared[16];
+	const GEN_FLTF c0 = prepared[17];
+	const GEN_FLTF c1 = prepared[18];
+	const GEN_FLTF c2 = prepared[19];
+	const GEN_FLTF c3 = prepared[20];
+	const GEN_FLTF c4 = prepared[21];
+	const GEN_FLTF c5 = prepared[22];
+	const GEN_FLTF c6 = prepared[23];
+	const GEN_FLTF c7 = prepared[24];
+	const GEN_FLTF c8 = prepared[25];
+	const GEN_FLTF c9 = prepared[26];
+	const GEN_FLTF c10 = prepared[27];
+	const GEN_FLTF c11 = prepared[28];
+	const GEN_FLTF c12 = prepared[29];
+	const GEN_FLTF c13 = prepared[30];
+	const GEN_FLTF c14 = prepared[31];
+	const GEN_FLTF c15 = prepared[32];
+	const GEN_FLTF c16 = prepared[33];
+	const GEN_FLTF c17 = prepared[34];
+	const GEN_FLTF c18 = prepared[35];
+	const GEN_FLTF c19 = prepared[36];
+	const GEN_FLTF c20 = prepared[37];
+	const GEN_FLTF c21 = prepared[38];
+	const GEN_FLTF c22 = prepared[39];
+	const GEN_FLTF c23 = prepared[40];
+	const GEN_FLTF c24 = prepared[41];
+	const GEN_FLTF c25 = prepared[42];
+	const GEN_FLTF c26 = prepared[43];
+	const GEN_FLTF sensor_x = sensor_pt[0];
+	const GEN_FLTF sensor_y = sensor_pt[1];
+	const GEN_FLTF sensor_z = sensor_pt[2];
+	const GEN_FLTF x23 = obj_pz + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLTF x28 = obj_py + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLTF x32 = obj_px + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLTF x33 = c9 + (-1 * x23 * c10) + (-1 * x28 * c11) + (-1 * x32 * c12);
+	const GEN_FLTF x36 = lh_px + (x23 * c13) + (x28 * c14) + (x32 * c15);
+	const GEN_FLTF x37 = __fast_atan2f(x33, x36);
+	const GEN_FLTF x39 = (x33 * x33) + (x36 * x36);
+	const GEN_FLTF x40 = lh_py + (x23 * c16) + (x28 * c17) + (x32 * c18);
+	const GEN_FLTF x41 = x40 * (1.f / __fast_sqrtf(x39));
+	const GEN_FLTF x42 = x41 * c19;
+	const GEN_FLTF x44 = x40 * (1.f / __fast_sqrtf(x39 + (x40 * x40)));
+	const GEN_FLTF x45 = __fast_asinf(x44 * c20);
+	const GEN_FLTF x46 = curve_0 + (ogeePhase_0 * __fast_sinf(ogeeMag_0 + x37 + (-1 * __fast_asinf(x42))));
+	const GEN_FLTF x47 = 0.0028679863f + (x45 * (-8.0108022e-06f + (-8.0108022e-06f * x45)));
+	const GEN_FLTF x48 = 5.3685255e-06f + (x45 * x47);
+	const GEN_FLTF x49 = 0.0076069798f + (x45 * x48);
+	const GEN_FLTF x50 = __fast_asinf(x42 + (x46 * x49 * (x45 * x45) * (1.f / (x43 + (-1 * x46 * ((x45 * x49) + (x45 *
+		(x49 +
+		(x45 * (x48 + (x45 * (x47 + (x45 * (-8.0108022e-06f + (-1.60216044e-05f * x45)))))))))) * c21)))));
+	const GEN_FLTF x51 = 1.5707963267949f + (-1 * x37);
+	const GEN_FLTF x53 = x41 * c22;
+	const GEN_FLTF x55 = __fast_asinf(x44 * c23);
+	const GEN_FLTF x56 = curve_1 + (ogeePhase_1 * __fast_sinf(ogeeMag_1 + x37 + (-1 * __fast_asinf(x53))));
+	const GEN_FLTF x57 = 0.0028679863f + (x55 * (-8.0108022e-06f + (-8.0108022e-06f * x55)));
+	const GEN_FLTF x58 = 5.3685255e-06f + (x55 * x57);
+	const GEN_FLTF x59 = 0.0076069798f + (x55 * x58);
+	const GEN_FLTF x60 = __fast_asinf(x53 + (x56 * x59 * (x55 * x55) * (1.f / (x54 + (-1 * x56 * ((x55 * x59) + (x55 *
+		(x59 +
+		(x55 * (x58 + (x55 * (x57 + (x55 * (-8.0108022e-06f + (-1.60216044e-05f * x55)))))))))) * c24)))));
+	out[0] = c25 + (-1 * x50) + (-1 * x51) + (gibMag_0 * __fast_sinf(gibPhase_0 + x37 + (-1 * x50)));
+	out[1] = c26 + (-1 * x51) + (-1 * x60) + (gibMag_1 * __fast_sinf(gibPhase_1 + x37 + (-1 * x60)));
+}
+
+static inline void gen_reproject_axis_x_gen2_axis_angle_eval_float(FLT *out, const FLT *prepared,
+																   const FLT *sensor_pt) {
+	const GEN_FLTF obj_px = prepared[0];
+	const GEN_FLTF obj_py = prepared[1];
+	const GEN_FLTF obj_pz = prepared[2];
+	const GEN_FLTF lh_px = prepared[3];
+	const GEN_FLTF lh_py = prepared[4];
+	const GEN_FLTF curve_0 = prepared[5];
+	const GEN_FLTF gibPhase_0 = prepared[6];
+	const GEN_FLTF gibMag_0 = prepared[7];
+	const GEN_FLTF ogeeMag_0 = prepared[8];
+	const GEN_FLTF ogeePhase_0 = prepared[9];
+	const GEN_FLTF x42 = prepared[10];
+	const GEN_FLTF c0 = prepared[11];
+	const GEN_FLTF c1 = prepared[12];
+	const GEN_FLTF c2 = prepared[13];
+	const GEN_FLTF c3 = prepared[14];
+	const GEN_FLTF c4 = prepared[15];
+	const GEN_FLTF c5 = prepared[16];
+	const GEN_FLTF c6 = prepared[17];
+	const GEN_FLTF c7 = prepared[18];
+	const GEN_FLTF c8 = prepared[19];
+	const GEN_FLTF c9 = prepared[20];
+	const GEN_FLTF c10 = prepared[21];
+	const GEN_FLTF c11 = prepared[22];
+	const GEN_FLTF c12 = prepared[23];
+	const GEN_FLTF c13 = prepared[24];
+	const GEN_FLTF c14 = prepared[25];
+	const GEN_FLTF c15 = prepared[26];
+	const GEN_FLTF c16 = prepared[27];
+	const GEN_FLTF c17 = prepared[28];
+	const GEN_FLTF c18 = prepared[29];
+	const GEN_FLTF c19 = prepared[30];
+	const GEN_FLTF c20 = prepared[31];
+	const GEN_FLTF c21 = prepared[32];
+	const GEN_FLTF c22 = prepared[33];
+	const GEN_FLTF sensor_x = sensor_pt[0];
+	const GEN_FLTF sensor_y = sensor_pt[1];
+	const GEN_FLTF sensor_z = sensor_pt[2];
+	const GEN_FLTF x23 = obj_pz + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLTF x28 = obj_py + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLTF x32 = obj_px + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLTF x33 = c9 + (-1 * x23 * c10) + (-1 * x28 * c11) + (-1 * x32 * c12);
+	const GEN_FLTF x36 = lh_px + (x23 * c13) + (x28 * c14) + (x32 * c15);
+	const GEN_FLTF x37 = __fast_atan2f(x33, x36);
+	const GEN_FLTF x39 = lh_py + (x23 * c16) + (x28 * c17) + (x32 * c18);
+	const GEN_FLTF x40 = (x33 * x33) + (x36 * x36);
+	const GEN_FLTF x41 = x39 * (1.f / __fast_sqrtf(x40)) * c19;
+	const GEN_FLTF x43 = __fast_asinf(x39 * c20 * (1.f / __fast_sqrtf(x40 + (x39 * x39))));
+	const GEN_FLTF x44 = curve_0 + (ogeePhase_0 * __fast_sinf(ogeeMag_0 + x37 + (-1 * __fast_asinf(x41))));
+	const GEN_FLTF x45 = 0.0028679863f + (x43 * (-8.0108022e-06f + (-8.0108022e-06f * x43)));
+	const GEN_FLTF x46 = 5.3685255e-06f + (x43 * x45);
+	const GEN_FLTF x47 = 0.0076069798f + (x43 * x46);
+	const GEN_FLTF x48 = __fast_asinf(x41 + (x44 * x47 * (x43 * x43) * (1.f / (x42 + (-1 * x44 * ((x43 * x47) + (x43 *
+		(x47 +
+		(x43 * (x46 + (x43 * (x45 + (x43 * (-8.0108022e-06f + (-1.60216044e-05f * x43)))))))))) * c21)))));
+	out[0] = -1.5707963267949f + x37 + c22 + (-1 * x48) + (gibMag_0 * __fast_sinf(gibPhase_0 + x37 + (-1 * x48)));
+}
+
+static inline void gen_reproject_axis_y_gen2_axis_angle_eval_float(FLT *out, const FLT *prepared,
+																   const FLT *sensor_pt) {
+	const GEN_FLTF obj_px = prepared[0];
+	const GEN_FLTF obj_py = prepared[1];
+	const GEN_FLTF obj_pz = prepared[2];
+	const GEN_FLTF lh_px = prepared[3];
+	const GEN_FLTF lh_py = prepared[4];
+	const GEN_FLTF curve_1 = prepared[5];
+	const GEN_FLTF gibPhase_1 = prepared[6];
+	const GEN_FLTF gibMag_1 = prepared[7];
+	const GEN_FLTF ogeeMag_1 = prepared[8];
+	const GEN_FLTF ogeePhase_1 = prepared[9];
+	const GEN_FLTF x42 = prepared[10];
+	const GEN_FLTF c0 = prepared[11];
+	const GEN_FLTF c1 = prepared[12];
+	const GEN_FLTF c2 = prepared[13];
+	const GEN_FLTF c3 = prepared[14];
+	const GEN_FLTF c4 = prepared[15];
+	const GEN_FLTF c5 = prepared[16];
+	const GEN_FLTF c6 = prepared[17];
+	const GEN_FLTF c7 = prepared[18];
+	const GEN_FLTF c8 = prepared[19];
+	const GEN_FLTF c9 = prepared[20];
+	const GEN_FLTF c10 = prepared[21];
+	const GEN_FLTF c11 = prepared[22];
+	const GEN_FLTF c12 = prepared[23];
+	const GEN_FLTF c13 = prepared[24];
+	const GEN_FLTF c14 = prepared[25];
+	const GEN_FLTF c15 = prepared[26];
+	const GEN_FLTF c16 = prepared[27];
+	const GEN_FLTF c17 = prepared[28];
+	const GEN_FLTF c18 = prepared[29];
+	const GEN_FLTF c19 = prepared[30];
+	const GEN_FLTF c20 = prepared[31];
+	const GEN_FLTF c21 = prepared[32];
+	const GEN_FLTF c22 = prepared[33];
+	const GEN_FLTF sensor_x = sensor_pt[0];
+	const GEN_FLTF sensor_y = sensor_pt[1];
+	const GEN_FLTF sensor_z = sensor_pt[2];
+	const GEN_FLTF x23 = obj_pz + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLTF x28 = obj_py + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLTF x32 = obj_px + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLTF x33 = c9 + (-1 * x23 * c10) + (-1 * x28 * c11) + (-1 * x32 * c12);
+	const GEN_FLTF x36 = lh_px + (x23 * c13) + (x28 * c14) + (x32 * c15);
+	const GEN_FLTF x37 = __fast_atan2f(x33, x36);
+	const GEN_FLTF x39 = lh_py + (x23 * c16) + (x28 * c17) + (x32 * c18);
+	const GEN_FLTF x40 = (x33 * x33) + (x36 * x36);
+	const GEN_FLTF x41 = x39 * (1.f / __fast_sqrtf(x40)) * c19;
+	const GEN_FLTF x43 = __fast_asinf(x39 * c20 * (1.f / __fast_sqrtf(x40 + (x39 * x39))));
+	const GEN_FLTF x44 = curve_1 + (ogeePhase_1 * __fast_sinf(ogeeMag_1 + x37 + (-1 * __fast_asinf(x41))));
+	const GEN_FLTF x45 = 0.0028679863f + (x43 * (-8.0108022e-06f + (-8.0108022e-06f * x43)));
+	const GEN_FLTF x46 = 5.3685255e-06f + (x43 * x45);
+	const GEN_FLTF x47 = 0.0076069798f + (x43 * x46);
+	const GEN_FLTF x48 = __fast_asinf(x41 + (x44 * x47 * (x43 * x43) * (1.f / (x42 + (-1 * x44 * ((x43 * x47) + (x43 *
+		(x47 +
+		(x43 * (x46 + (x43 * (x45 + (x43 * (-8.0108022e-06f + (-1.60216044e-05f * x43)))))))))) * c21)))));
+	out[0] = -1.5707963267949f + x37 + c22 + (-1 * x48) + (gibMag_1 * __fast_sinf(gibPhase_1 + x37 + (-1 * x48)));
+}
+
+static inline void gen_reproject_axis_angle_eval_float(FLT *out, const FLT *prepared, const FLT *sensor_pt) {
+	const GEN_FLTF obj_px = prepared[0];
+	const GEN_FLTF obj_py = prepared[1];
+	const GEN_FLTF obj_pz = prepared[2];
+	const GEN_FLTF lh_px = prepared[3];
+	const GEN_FLTF lh_py = prepared[4];
+	const GEN_FLTF phase_0 = prepared[5];
+	const GEN_FLTF tilt_0 = prepared[6];
+	const GEN_FLTF curve_0 = prepared[7];
+	const GEN_FLTF gibPhase_0 = prepared[8];
+	const GEN_FLTF gibMag_0 = prepared[9];
+	const GEN_FLTF tilt_1 = prepared[10];
+	const GEN_FLTF curve_1 = prepared[11];
+	const GEN_FLTF gibPhase_1 = prepared[12];
+	const GEN_FLTF gibMag_1 = prepared[13];
+	const GEN_FLTF c0 = prepared[14];
+	const GEN_FLTF c1 = prepared[15];
+	const GEN_FLTF c2 = prepared[16];
+	const GEN_FLTF c3 = prepared[17];
+	const GEN_FLTF c4 = prepared[18];
+	const GEN_FLTF c5 = prepared[19];
+	const GEN_FLTF c6 = prepared[20];
+	const GEN_FLTF c7 = prepared[21];
+	const GEN_FLTF c8 = prepared[22];
+	const GEN_FLTF c9 = prepared[23];
+	const GEN_FLTF c10 = prepared[24];
+	const GEN_FLTF c11 = prepared[25];
+	const GEN_FLTF c12 = prepared[26];
+	const GEN_FLTF c13 = prepared[27];
+	const GEN_FLTF c14 = prepared[28];
+	const GEN_FLTF c15 = prepared[29];
+	const GEN_FLTF c16 = prepared[30];
+	const GEN_FLTF c17 = prepared[31];
+	const GEN_FLTF c18 = prepared[32];
+	const GEN_FLTF c19 = prepared[33];
+	const GEN_FLTF sensor_x = sensor_pt[0];
+	const GEN_FLTF sensor_y = sensor_pt[1];
+	const GEN_FLTF sensor_z = sensor_pt[2];
+	const GEN_FLTF x22 = obj_py + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLTF x30 = obj_px + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLTF x32 = obj_pz + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLTF x33 = lh_py + (x22 * c9) + (x30 * c10) + (x32 * c11);
+	const GEN_FLTF x36 = lh_px + (x22 * c12) + (x30 * c13) + (x32 * c14);
+	const GEN_FLTF x37 = c15 + (-1 * x22 * c16) + (-1 * x30 * c17) + (-1 * x32 * c18);
+	const GEN_FLTF x38 = x37 * x37;
+	const GEN_FLTF x39 = __fast_atan2f(x36, x37);
+	const GEN_FLTF x40 = phase_0 + x39 + __fast_asinf(tilt_0 * x33 * (1.f / __fast_sqrtf(x38 + (x36 * x36))));
+	const GEN_FLTF x41 = __fast_atan2f(x33, x37);
+	const GEN_FLTF x42 = __fast_asinf(tilt_1 * x36 * (1.f / __fast_sqrtf(x38 + (x33 * x33))));
+	out[0] = (-1 * x40) + (curve_0 * (x41 * x41)) + (-1 * gibMag_0 * __fast_cosf(1.5707963267949f + gibPhase_0 + (-1 *
+		x40)));
+	out[1] = x41 + c19 + (-1 * x42) + (curve_1 * (x39 * x39)) + (-1 * gibMag_1 * __fast_cosf(1.5707963267949f +
+		gibPhase_1 + x41
+		+ c19 + (-1 * x42)));
+}
+
+static inline void gen_reproject_axis_x_axis_angle_eval_float(FLT *out, const FLT *prepared, const FLT *sensor_pt) {
+	const GEN_FLTF obj_px = prepared[0];
+	const GEN_FLTF obj_py = prepared[1];
+	const GEN_FLTF obj_pz = prepared[2];
+	const GEN_FLTF lh_px = prepared[3];
+	const GEN_FLTF lh_py = prepared[4];
+	const GEN_FLTF phase_0 = prepared[5];
+	const GEN_FLTF tilt_0 = prepared[6];
+	const GEN_FLTF curve_0 = prepared[7];
+	const GEN_FLTF gibPhase_0 = prepared[8];
+	const GEN_FLTF gibMag_0 = prepared[9];
+	const GEN_FLTF c0 = prepared[10];
+	const GEN_FLTF c1 = prepared[11];
+	const GEN_FLTF c2 = prepared[12];
+	const GEN_FLTF c3 = prepared[13];
+	const GEN_FLTF c4 = prepared[14];
+	const GEN_FLTF c5 = prepared[15];
+	const GEN_FLTF c6 = prepared[16];
+	const GEN_FLTF c7 = prepared[17];
+	const GEN_FLTF c8 = prepared[18];
+	const GEN_FLTF c9 = prepared[19];
+	const GEN_FLTF c10 = prepared[20];
+	const GEN_FLTF c11 = prepared[21];
+	const GEN_FLTF c12 = prepared[22];
+	const GEN_FLTF c13 = prepared[23];
+	const GEN_FLTF c14 = prepared[24];
+	const GEN_FLTF c15 = prepared[25];
+	const GEN_FLTF c16 = prepared[26];
+	const GEN_FLTF c17 = prepared[27];
+	const GEN_FLTF c18 = prepared[28];
+	const GEN_FLTF sensor_x = sensor_pt[0];
+	const GEN_FLTF sensor_y = sensor_pt[1];
+	const GEN_FLTF sensor_z = sensor_pt[2];
+	const GEN_FLTF x22 = obj_py + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLTF x30 = obj_px + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLTF x32 = obj_pz + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLTF x33 = lh_py + (x22 * c9) + (x30 * c10) + (x32 * c11);
+	const GEN_FLTF x36 = lh_px + (x22 * c12) + (x30 * c13) + (x32 * c14);
+	const GEN_FLTF x37 = c15 + (-1 * x22 * c16) + (-1 * x30 * c17) + (-1 * x32 * c18);
+	const GEN_FLTF x38 = phase_0 + __fast_asinf(tilt_0 * x33 * (1.f / __fast_sqrtf((x36 * x36) + (x37 * x37)))) +
+		__fast_atan2f(x36, x37);
+	out[0] = (-1 * x38) + (curve_0 * (__fast_atan2f(x33, x37) * __fast_atan2f(x33, x37))) + (-1 * gibMag_0 *
+		__fast_cosf(1.5707963267949f +
+		gibPhase_0 + (-1 * x38)));
+}
+
+static inline void gen_reproject_axis_y_axis_angle_eval_float(FLT *out, const FLT *prepared, const FLT *sensor_pt) {
+	const GEN_FLTF obj_px = prepared[0];
+	const GEN_FLTF obj_py = prepared[1];
+	const GEN_FLTF obj_pz = prepared[2];
+	const GEN_FLTF lh_px = prepared[3];
+	const GEN_FLTF lh_py = prepared[4];
+	const GEN_FLTF tilt_1 = prepared[5];
+	const GEN_FLTF curve_1 = prepared[6];
+	const GEN_FLTF gibPhase_1 = prepared[7];
+	const GEN_FLTF gibMag_1 = prepared[8];
+	const GEN_FLTF c0 = prepared[9];
+	const GEN_FLTF c1 = prepared[10];
+	const GEN_FLTF c2 = prepared[11];
+	const GEN_FLTF c3 = prepared[12];
+	const GEN_FLTF c4 = prepared[13];
+	const GEN_FLTF c5 = prepared[14];
+	const GEN_FLTF c6 = prepared[15];
+	const GEN_FLTF c7 = prepared[16];
+	const GEN_FLTF c8 = prepared[17];
+	const GEN_FLTF c9 = prepared[18];
+	const GEN_FLTF c10 = prepared[19];
+	const GEN_FLTF c11 = prepared[20];
+	const GEN_FLTF c12 = prepared[21];
+	const GEN_FLTF c13 = prepared[22];
+	const GEN_FLTF c14 = prepared[23];
+	const GEN_FLTF c15 = prepared[24];
+	const GEN_FLTF c16 = prepared[25];
+	const GEN_FLTF c17 = prepared[26];
+	const GEN_FLTF c18 = prepared[27];
+	const GEN_FLTF c19 = prepared[28];
+	const GEN_FLTF sensor_x = sensor_pt[0];
+	const GEN_FLTF sensor_y = sensor_pt[1];
+	const GEN_FLTF sensor_z = sensor_pt[2];
+	const GEN_FLTF x23 = obj_py + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLTF x30 = obj_px + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLTF x32 = obj_pz + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLTF x33 = lh_py + (x23 * c9) + (x30 * c10) + (x32 * c11);
+	const GEN_FLTF x36 = c12 + (-1 * x23 * c13) + (-1 * x30 * c14) + (-1 * x32 * c15);
+	const GEN_FLTF x37 = __fast_atan2f(x33, x36);
+	const GEN_FLTF x38 = lh_px + (x23 * c16) + (x30 * c17) + (x32 * c18);
+	const GEN_FLTF x39 = __fast_asinf(tilt_1 * x38 * (1.f / __fast_sqrtf((x33 * x33) + (x36 * x36))));
+	out[0] = x37 + c19 + (-1 * x39) + (curve_1 * (__fast_atan2f(x38, x36) * __fast_atan2f(x38, x36))) + (-1 * gibMag_1 *
+		__fast_cosf(1.5707963267949f + gibPhase_1 + x37 + c19 + (-1 * x39)));
+}
@@ -0,0 +1,8296 @@
+#pragma once
+#include "common.h"
+enum { gen_reproject_gen2_axis_angle_prepared_size = 44 };
+
+static inline void gen_reproject_gen2_axis_angle_prepare(FLT *prepared, const LinmathAxisAnglePose *obj_p,
+														 const LinmathAxisAnglePose *lh_p, const BaseStationCal *bsd) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_0 = bsd[0].phase;
+	const GEN_FLT tilt_0 = bsd[0].tilt;
+	const GEN_FLT curve_0 = bsd[0].curve;
+	const GEN_FLT gibPhase_0 = bsd[0].gibpha;
+	const GEN_FLT gibMag_0 = bsd[0].gibmag;
+	const GEN_FLT ogeeMag_0 = bsd[0].ogeephase;
+	const GEN_FLT ogeePhase_0 = bsd[0].ogeemag;
+	const GEN_FLT phase_1 = bsd[1].phase;
+	const GEN_FLT tilt_1 = bsd[1].tilt;
+	const GEN_FLT curve_1 = bsd[1].curve;
+	const GEN_FLT gibPhase_1 = bsd[1].gibpha;
+	const GEN_FLT gibMag_1 = bsd[1].gibmag;
+	const GEN_FLT ogeeMag_1 = bsd[1].ogeephase;
+	const GEN_FLT ogeePhase_1 = bsd[1].ogeemag;
+	const GEN_FLT x0 = lh_qi * lh_qi;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qk * lh_qk;
+	const GEN_FLT x3 = 1e-10 + x0 + x1 + x2;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = cos(x4);
+	const GEN_FLT x6 = 1. / x3;
+	const GEN_FLT x7 = 1 + (-1 * x5);
+	const GEN_FLT x8 = x6 * x7;
+	const GEN_FLT x9 = obj_qi * obj_qi;
+	const GEN_FLT x10 = obj_qj * obj_qj;
+	const GEN_FLT x11 = obj_qk * obj_qk;
+	const GEN_FLT x12 = 1e-10 + x10 + x11 + x9;
+	const GEN_FLT x13 = sqrt(x12);
+	const GEN_FLT x14 = cos(x13);
+	const GEN_FLT x15 = 1. / x12;
+	const GEN_FLT x16 = 1 + (-1 * x14);
+	const GEN_FLT x17 = x15 * x16;
+	const GEN_FLT x18 = (1. / x13) * sin(x13);
+	const GEN_FLT x19 = obj_qi * x18;
+	const GEN_FLT x20 = obj_qk * x17;
+	const GEN_FLT x21 = obj_qj * x18;
+	const GEN_FLT x22 = obj_qi * x20;
+	const GEN_FLT x24 = (1. / x4) * sin(x4);
+	const GEN_FLT x25 = lh_qi * x24;
+	const GEN_FLT x26 = obj_qk * x18;
+	const GEN_FLT x27 = obj_qi * obj_qj * x17;
+	const GEN_FLT x29 = lh_qj * x24;
+	const GEN_FLT x30 = lh_qi * x8;
+	const GEN_FLT x31 = lh_qk * x30;
+	const GEN_FLT x34 = lh_qk * x24;
+	const GEN_FLT x35 = lh_qj * x30;
+	const GEN_FLT x38 = 0.523598775598299 + tilt_0;
+	const GEN_FLT x43 = cos(x38);
+	const GEN_FLT x52 = -0.523598775598299 + tilt_1;
+	const GEN_FLT x54 = cos(x52);
+	const GEN_FLT c0 = x22 + (-1 * x21);
+	const GEN_FLT c1 = x19 + (obj_qj * x20);
+	const GEN_FLT c2 = x14 + (x11 * x17);
+	const GEN_FLT c3 = x26 + x27;
+	const GEN_FLT c4 = x14 + (x10 * x17);
+	const GEN_FLT c5 = (-1 * x19) + (obj_qj * obj_qk * x15 * x16);
+	const GEN_FLT c6 = x14 + (x17 * x9);
+	const GEN_FLT c7 = x27 + (-1 * x26);
+	const GEN_FLT c8 = x21 + x22;
+	const GEN_FLT c9 = -1 * lh_pz;
+	const GEN_FLT c10 = x5 + (x2 * x8);
+	const GEN_FLT c11 = x25 + (lh_qj * lh_qk * x8);
+	const GEN_FLT c12 = x31 + (-1 * x29);
+	const GEN_FLT c13 = x29 + x31;
+	const GEN_FLT c14 = x35 + (-1 * x34);
+	const GEN_FLT c15 = x5 + (x0 * x8);
+	const GEN_FLT c16 = (-1 * x25) + (lh_qj * lh_qk * x6 * x7);
+	const GEN_FLT c17 = x5 + (x1 * x8);
+	const GEN_FLT c18 = x34 + x35;
+	const GEN_FLT c19 = tan(x38);
+	const GEN_FLT c20 = 1. / x43;
+	const GEN_FLT c21 = sin(x38);
+	const GEN_FLT c22 = tan(x52);
+	const GEN_FLT c23 = 1. / x54;
+	const GEN_FLT c24 = sin(x52);
+	const GEN_FLT c25 = -1 * phase_0;
+	const GEN_FLT c26 = -1 * phase_1;
+	prepared[0] = obj_px;
+	prepared[1] = obj_py;
+	prepared[2] = obj_pz;
+	prepared[3] = lh_px;
+	prepared[4] = lh_py;
+	prepared[5] = curve_0;
+	prepared[6] = gibPhase_0;
+	prepared[7] = gibMag_0;
+	prepared[8] = ogeeMag_0;
+	prepared[9] = ogeePhase_0;
+	prepared[10] = curve_1;
+	prepared[11] = gibPhase_1;
+	prepared[12] = gibMag_1;
+	prepared[13] = ogeeMag_1;
+	prepared[14] = ogeePhase_1;
+	prepared[15] = x43;
+	prepared[16] = x54;
+	prepared[17] = c0;
+	prepared[18] = c1;
+	prepared[19] = c2;
+	prepared[20] = c3;
+	prepared[21] = c4;
+	prepared[22] = c5;
+	prepared[23] = c6;
+	prepared[24] = c7;
+	prepared[25] = c8;
+	prepared[26] = c9;
+	prepared[27] = c10;
+	prepared[28] = c11;
+	prepared[29] = c12;
+	prepared[30] = c13;
+	prepared[31] = c14;
+	prepared[32] = c15;
+	prepared[33] = c16;
+	prepared[34] = c17;
+	prepared[35] = c18;
+	prepared[36] = c19;
+	prepared[37] = c20;
+	prepared[38] = c21;
+	prepared[39] = c22;
+	prepared[40] = c23;
+	prepared[41] = c24;
+	prepared[42] = c25;
+	prepared[43] = c26;
+}
+
+static inline void gen_reproject_gen2_axis_angle_eval(FLT *out, const FLT *prepared, const FLT *sensor_pt) {
+	const GEN_FLT obj_px = prepared[0];
+	const GEN_FLT obj_py = prepared[1];
+	const GEN_FLT obj_pz = prepared[2];
+	const GEN_FLT lh_px = prepared[3];
+	const GEN_FLT lh_py = prepared[4];
+	const GEN_FLT curve_0 = prepared[5];
+	const GEN_FLT gibPhase_0 = prepared[6];
+	const GEN_FLT gibMag_0 = prepared[7];
+	const GEN_FLT ogeeMag_0 = prepared[8];
+	const GEN_FLT ogeePhase_0 = prepared[9];
+	const GEN_FLT curve_1 = prepared[10];
+	const GEN_FLT gibPhase_1 = prepared[11];
+	const GEN_FLT gibMag_1 = prepared[12];
+	const GEN_FLT ogeeMag_1 = prepared[13];
+	const GEN_FLT ogeePhase_1 = prepared[14];
+	const GEN_FLT x43 = prepared[15];
+	const GEN_FLT x54 = prepared[16];
+	const GEN_FLT c0 = prepared[17];
+	const GEN_FLT c1 = prepared[18];
+	const GEN_FLT c2 = prepared[19];
+	const GEN_FLT c3 = prepared[20];
+	const GEN_FLT c4 = prepared[21];
+	const GEN_FLT c5 = prepared[22];
+	const GEN_FLT c6 = prepared[23];
+	const GEN_FLT c7 = prepared[24];
+	const GEN_FLT c8 = prepared[25];
+	const GEN_FLT c9 = prepared[26];
+	const GEN_FLT c10 = prepared[27];
+	const GEN_FLT c11 = prepared[28];
+	const GEN_FLT c12 = prepared[29];
+	const GEN_FLT c13 = prepared[30];
+	const GEN_FLT c14 = prepared[31];
+	const GEN_FLT c15 = prepared[32];
+	const GEN_FLT c16 = prepared[33];
+	const GEN_FLT c17 = prepared[34];
+	const GEN_FLT c18 = prepared[35];
+	const GEN_FLT c19 = prepared[36];
+	const GEN_FLT c20 = prepared[37];
+	const GEN_FLT c21 = prepared[38];
+	const GEN_FLT c22 = prepared[39];
+	const GEN_FLT c23 = prepared[40];
+	const GEN_FLT c24 = prepared[41];
+	const GEN_FLT c25 = prepared[42];
+	const GEN_FLT c26 = prepared[43];
+	const GEN_FLT sensor_x = sensor_pt[0];
+	const GEN_FLT sensor_y = sensor_pt[1];
+	const GEN_FLT sensor_z = sensor_pt[2];
+	const GEN_FLT x23 = obj_pz + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLT x28 = obj_py + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLT x32 = obj_px + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLT x33 = c9 + (-1 * x23 * c10) + (-1 * x28 * c11) + (-1 * x32 * c12);
+	const GEN_FLT x36 = lh_px + (x23 * c13) + (x28 * c14) + (x32 * c15);
+	const GEN_FLT x37 = atan2(x33, x36);
+	const GEN_FLT x39 = (x33 * x33) + (x36 * x36);
+	const GEN_FLT x40 = lh_py + (x23 * c16) + (x28 * c17) + (x32 * c18);
+	const GEN_FLT x41 = x40 * (1. / sqrt(x39));
+	const GEN_FLT x42 = x41 * c19;
+	const GEN_FLT x44 = x40 * (1. / sqrt(x39 + (x40 * x40)));
+	const GEN_FLT x45 = asin(x44 * c20);
+	const GEN_FLT x46 = curve_0 + (ogeePhase_0 * sin(ogeeMag_0 + x37 + (-1 * asin(x42))));
+	const GEN_FLT x47 = 0.0028679863 + (x45 * (-8.0108022e-06 + (-8.0108022e-06 * x45)));
+	const GEN_FLT x48 = 5.3685255e-06 + (x45 * x47);
+	const GEN_FLT x49 = 0.0076069798 + (x45 * x48);
+	const GEN_FLT x50 = asin(x42 + (x46 * x49 * (x45 * x45) * (1. / (x43 + (-1 * x46 * ((x45 * x49) + (x45 * (x49 +
+		(x45 * (x48 + (x45 * (x47 + (x45 * (-8.0108022e-06 + (-1.60216044e-05 * x45)))))))))) * c21)))));
+	const GEN_FLT x51 = 1.5707963267949 + (-1 * x37);
+	const GEN_FLT x53 = x41 * c22;
+	const GEN_FLT x55 = asin(x44 * c23);
+	const GEN_FLT x56 = curve_1 + (ogeePhase_1 * sin(ogeeMag_1 + x37 + (-1 * asin(x53))));
+	const GEN_FLT x57 = 0.0028679863 + (x55 * (-8.0108022e-06 + (-8.0108022e-06 * x55)));
+	const GEN_FLT x58 = 5.3685255e-06 + (x55 * x57);
+	const GEN_FLT x59 = 0.0076069798 + (x55 * x58);
+	const GEN_FLT x60 = asin(x53 + (x56 * x59 * (x55 * x55) * (1. / (x54 + (-1 * x56 * ((x55 * x59) + (x55 * (x59 +
+		(x55 * (x58 + (x55 * (x57 + (x55 * (-8.0108022e-06 + (-1.60216044e-05 * x55)))))))))) * c24)))));
+	out[0] = c25 + (-1 * x50) + (-1 * x51) + (gibMag_0 * sin(gibPhase_0 + x37 + (-1 * x50)));
+	out[1] = c26 + (-1 * x51) + (-1 * x60) + (gibMag_1 * sin(gibPhase_1 + x37 + (-1 * x60)));
+}
+
+// Value of reproject_gen2 then its jacobian wrt obj_p
+enum { gen_reproject_gen2_val_jac_obj_p_axis_angle_prepared_size = 84 };
+
+static inline void gen_reproject_gen2_val_jac_obj_p_axis_angle_prepare(FLT *prepared, const LinmathAxisAnglePose *obj_p,
+																	   const LinmathAxisAnglePose *lh_p,
+																	   const BaseStationCal *bsd) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_0 = bsd[0].phase;
+	const GEN_FLT tilt_0 = bsd[0].tilt;
+	const GEN_FLT curve_0 = bsd[0].curve;
+	const GEN_FLT gibPhase_0 = bsd[0].gibpha;
+	const GEN_FLT gibMag_0 = bsd[0].gibmag;
+	const GEN_FLT ogeeMag_0 = bsd[0].ogeephase;
+	const GEN_FLT ogeePhase_0 = bsd[0].ogeemag;
+	const GEN_FLT phase_1 = bsd[1].phase;
+	const GEN_FLT tilt_1 = bsd[1].tilt;
+	const GEN_FLT curve_1 = bsd[1].curve;
+	const GEN_FLT gibPhase_1 = bsd[1].gibpha;
+	const GEN_FLT gibMag_1 = bsd[1].gibmag;
+	const GEN_FLT ogeeMag_1 = bsd[1].ogeephase;
+	const GEN_FLT ogeePhase_1 = bsd[1].ogeemag;
+	const GEN_FLT x0 = lh_qi * lh_qi;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qk * lh_qk;
+	const GEN_FLT x3 = 1e-10 + x0 + x1 + x2;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = cos(x4);
+	const GEN_FLT x6 = (1. / x3) * (1 + (-1 * x5));
+	const GEN_FLT x7 = x2 * x6;
+	const GEN_FLT x8 = x5 + x7;
+	const GEN_FLT x9 = obj_qi * obj_qi;
+	const GEN_FLT x10 = obj_qj * obj_qj;
+	const GEN_FLT x11 = obj_qk * obj_qk;
+	const GEN_FLT x12 = 1e-10 + x10 + x11 + x9;
+	const GEN_FLT x13 = sqrt(x12);
+	const GEN_FLT x14 = cos(x13);
+	const GEN_FLT x15 = 1. / x12;
+	const GEN_FLT x16 = 1 + (-1 * x14);
+	const GEN_FLT x17 = x15 * x16;
+	const GEN_FLT x18 = sin(x13);
+	const GEN_FLT x19 = x18 * (1. / x13);
+	const GEN_FLT x20 = obj_qi * x19;
+	const GEN_FLT x21 = obj_qj * x17;
+	const GEN_FLT x22 = obj_qj * x19;
+	const GEN_FLT x23 = obj_qk * x17;
+	const GEN_FLT x24 = obj_qi * x23;
+	const GEN_FLT x26 = 1. / x4;
+	const GEN_FLT x27 = sin(x4);
+	const GEN_FLT x28 = x26 * x27;
+	const GEN_FLT x29 = lh_qi * x28;
+	const GEN_FLT x30 = lh_qj * lh_qk * x6;
+	const GEN_FLT x31 = x29 + x30;
+	const GEN_FLT x32 = obj_qk * x19;
+	const GEN_FLT x33 = obj_qi * x21;
+	const GEN_FLT x35 = lh_qj * x28;
+	const GEN_FLT x36 = lh_qi * x6;
+	const GEN_FLT x37 = lh_qk * x36;
+	const GEN_FLT x38 = x37 + (-1 * x35);
+	const GEN_FLT x42 = x0 * x6;
+	const GEN_FLT x43 = x42 + x5;
+	const GEN_FLT x44 = x35 + x37;
+	const GEN_FLT x45 = lh_qk * x28;
+	const GEN_FLT x46 = lh_qj * x36;
+	const GEN_FLT x47 = x46 + (-1 * x45);
+	const GEN_FLT x50 = 0.523598775598299 + tilt_0;
+	const GEN_FLT x51 = tan(x50);
+	const GEN_FLT x54 = x1 * x6;
+	const GEN_FLT x55 = x5 + x54;
+	const GEN_FLT x56 = x45 + x46;
+	const GEN_FLT x57 = x30 + (-1 * x29);
+	const GEN_FLT x61 = cos(x50);
+	const GEN_FLT x62 = 1. / x61;
+	const GEN_FLT x82 = sin(x50);
+	const GEN_FLT x92 = -0.523598775598299 + tilt_1;
+	const GEN_FLT x93 = tan(x92);
+	const GEN_FLT x95 = cos(x92);
+	const GEN_FLT x96 = 1. / x95;
+	const GEN_FLT x112 = sin(x92);
+	const GEN_FLT x125 = 2 * x45;
+	const GEN_FLT x126 = 2 * x46;
+	const GEN_FLT x128 = 2 * x5;
+	const GEN_FLT x130 = 2 * x37;
+	const GEN_FLT x161 = 2 * x29;
+	const GEN_FLT x162 = 2 * x30;
+	const GEN_FLT x187 = 1. / (x12 * sqrt(x12));
+	const GEN_FLT x188 = 2 * x16 * (1. / (x12 * x12));
+	const GEN_FLT x189 = obj_qi * x188;
+	const GEN_FLT x190 = x10 * x189;
+	const GEN_FLT x191 = x14 * x15;
+	const GEN_FLT x192 = x18 * x187;
+	const GEN_FLT x193 = x192 * x9;
+	const GEN_FLT x194 = x19 + (-1 * x193) + (x191 * x9);
+	const GEN_FLT x195 = obj_qi * obj_qk;
+	const GEN_FLT x196 = obj_qj * x188;
+	const GEN_FLT x197 = x195 * x196;
+	const GEN_FLT x198 = x197 + (-1 * obj_qi * obj_qj * obj_qk * x18 * x187);
+	const GEN_FLT x199 = x188 * x9;
+	const GEN_FLT x200 = obj_qj * x199;
+	const GEN_FLT x201 = x21 + (-1 * x200) + (obj_qj * x193);
+	const GEN_FLT x202 = x191 * x195;
+	const GEN_FLT x203 = x192 * x195;
+	const GEN_FLT x204 = x202 + (-1 * x203);
+	const GEN_FLT x207 = x11 * x189;
+	const GEN_FLT x208 = (-1 * x197) + (obj_qj * x203);
+	const GEN_FLT x209 = obj_qk * x199;
+	const GEN_FLT x210 = x23 + (-1 * x209) + (obj_qk * x193);
+	const GEN_FLT x211 = obj_qi * obj_qj;
+	const GEN_FLT x212 = x192 * x211;
+	const GEN_FLT x213 = x191 * x211;
+	const GEN_FLT x214 = x212 + (-1 * x213);
+	const GEN_FLT x217 = obj_qi * obj_qi * obj_qi;
+	const GEN_FLT x218 = x203 + (-1 * x202);
+	const GEN_FLT x219 = x213 + (-1 * x212);
+	const GEN_FLT x240 = x19 + x208;
+	const GEN_FLT x241 = x10 * x192;
+	const GEN_FLT x242 = (-1 * x241) + (x10 * x191);
+	const GEN_FLT x243 = obj_qi * x17;
+	const GEN_FLT x244 = x243 + (-1 * x190) + (obj_qi * x241);
+	const GEN_FLT x245 = obj_qj * obj_qk;
+	const GEN_FLT x246 = x192 * x245;
+	const GEN_FLT x247 = x191 * x245;
+	const GEN_FLT x248 = x246 + (-1 * x247);
+	const GEN_FLT x251 = x11 * x196;
+	const GEN_FLT x252 = x19 + x198;
+	const GEN_FLT x253 = obj_qk * x10 * x188;
+	const GEN_FLT x254 = x23 + (-1 * x253) + (obj_qk * x241);
+	const GEN_FLT x257 = obj_qj * obj_qj * obj_qj;
+	const GEN_FLT x258 = x247 + (-1 * x246);
+	const GEN_FLT x279 = x11 * x192;
+	const GEN_FLT x280 = (-1 * x279) + (x11 * x191);
+	const GEN_FLT x281 = x21 + (-1 * x251) + (obj_qj * x279);
+	const GEN_FLT x284 = x243 + (-1 * x207) + (obj_qi * x279);
+	const GEN_FLT x287 = obj_qk * obj_qk * obj_qk;
+	const GEN_FLT c0 = x24 + (-1 * x22);
+	const GEN_FLT c1 = x20 + (obj_qk * x21);
+	const GEN_FLT c2 = x14 + (x11 * x17);
+	const GEN_FLT c3 = x32 + x33;
+	const GEN_FLT c4 = x14 + (x10 * x17);
+	const GEN_FLT c5 = (-1 * x20) + (obj_qj * obj_qk * x15 * x16);
+	const GEN_FLT c6 = x14 + (x17 * x9);
+	const GEN_FLT c7 = x33 + (-1 * x32);
+	const GEN_FLT c8 = x22 + x24;
+	const GEN_FLT c9 = 1. / (x61 * x61);
+	const GEN_FLT c10 = x128 + (2 * x42);
+	const GEN_FLT c11 = (-1 * x130) + (2 * lh_qj * x26 * x27);
+	const GEN_FLT c12 = x125 + x126;
+	const GEN_FLT c13 = x51 * x51;
+	const GEN_FLT c14 = x126 + (-1 * x125);
+	const GEN_FLT c15 = (-1 * x161) + (-1 * x162);
+	const GEN_FLT c16 = x128 + (2 * x54);
+	const GEN_FLT c17 = x130 + (2 * x35);
+	const GEN_FLT c18 = (-1 * x128) + (-2 * x7);
+	const GEN_FLT c19 = x162 + (-1 * x161);
+	const GEN_FLT c20 = x201 + x204;
+	const GEN_FLT c21 = (-1 * x190) + (-1 * x20) + (obj_qi * x10 * x18 * x187);
+	const GEN_FLT c22 = (-1 * x194) + (-1 * x198);
+	const GEN_FLT c23 = x210 + x214;
+	const GEN_FLT c24 = x194 + x208;
+	const GEN_FLT c25 = (-1 * x20) + (-1 * x207) + (obj_qi * x11 * x18 * x187);
+	const GEN_FLT c26 = (-1 * x20) + (-1 * x188 * x217) + (x18 * x187 * x217) + (2 * obj_qi * x15 * x16);
+	const GEN_FLT c27 = x201 + x218;
+	const GEN_FLT c28 = x210 + x219;
+	const GEN_FLT c29 = (-1 * x200) + (-1 * x22) + (obj_qj * x18 * x187 * x9);
+	const GEN_FLT c30 = x244 + x248;
+	const GEN_FLT c31 = x240 + x242;
+	const GEN_FLT c32 = (-1 * x242) + (-1 * x252);
+	const GEN_FLT c33 = x219 + x254;
+	const GEN_FLT c34 = (-1 * x22) + (-1 * x251) + (obj_qj * x11 * x18 * x187);
+	const GEN_FLT c35 = x244 + x258;
+	const GEN_FLT c36 = (-1 * x22) + (-1 * x188 * x257) + (x18 * x187 * x257) + (2 * obj_qj * x15 * x16);
+	const GEN_FLT c37 = x214 + x254;
+	const GEN_FLT c38 = x240 + x280;
+	const GEN_FLT c39 = (-1 * x253) + (-1 * x32) + (obj_qk * x10 * x18 * x187);
+	const GEN_FLT c40 = x218 + x281;
+	const GEN_FLT c41 = (-1 * x209) + (-1 * x32) + (obj_qk * x18 * x187 * x9);
+	const GEN_FLT c42 = (-1 * x252) + (-1 * x280);
+	const GEN_FLT c43 = x258 + x284;
+	const GEN_FLT c44 = x248 + x284;
+	const GEN_FLT c45 = x204 + x281;
+	const GEN_FLT c46 = (-1 * x32) + (-1 * x188 * x287) + (x18 * x187 * x287) + (2 * obj_qk * x15 * x16);
+	const GEN_FLT c47 = 1. / (x95 * x95);
+	const GEN_FLT c48 = x93 * x93;
+	const GEN_FLT c49 = -1 * phase_0;
+	const GEN_FLT c50 = -1 * phase_1;
+	prepared[0] = obj_px;
+	prepared[1] = obj_py;
+	prepared[2] = obj_pz;
+	prepared[3] = lh_px;
+	prepared[4] = lh_py;
+	prepared[5] = lh_pz;
+	prepared[6] = curve_0;
+	prepared[7] = gibPhase_0;
+	prepared[8] = gibMag_0;
+	prepared[9] = ogeeMag_0;
+	prepared[10] = ogeePhase_0;
+	prepared[11] = curve_1;
+	prepared[12] = gibPhase_1;
+	prepared[13] = gibMag_1;
+	prepared[14] = ogeeMag_1;
+	prepared[15] = ogeePhase_1;
+	prepared[16] = x8;
+	prepared[17] = x31;
+	prepared[18] = x38;
+	prepared[19] = x43;
+	prepared[20] = x44;
+	prepared[21] = x47;
+	prepared[22] = x51;
+	prepared[23] = x55;
+	prepared[24] = x56;
+	prepared[25] = x57;
+	prepared[26] = x61;
+	prepared[27] = x62;
+	prepared[28] = x82;
+	prepared[29] = x93;
+	prepared[30] = x95;
+	prepared[31] = x96;
+	prepared[32] = x112;
+	prepared[33] = c0;
+	prepared[34] = c1;
+	prepared[35] = c2;
+	prepared[36] = c3;
+	prepared[37] = c4;
+	prepared[38] = c5;
+	prepared[39] = c6;
+	prepared[40] = c7;
+	prepared[41] = c8;
+	prepared[42] = c9;
+	prepared[43] = c10;
+	prepared[44] = c11;
+	prepared[45] = c12;
+	prepared[46] = c13;
+	prepared[47] = c14;
+	prepared[48] = c15;
+	prepared[49] = c16;
+	prepared[50] = c17;
+	prepared[51] = c18;
+	prepared[52] = c19;
+	prepared[53] = c20;
+	prepared[54] = c21;
+	prepared[55] = c22;
+	prepared[56] = c23;
+	prepared[57] = c24;
+	prepared[58] = c25;
+	prepared[59] = c26;
+	prepared[60] = c27;
+	prepared[61] = c28;
+	prepared[62] = c29;
+	prepared[63] = c30;
+	prepared[64] = c31;
+	prepared[65] = c32;
+	prepared[66] = c33;
+	prepared[67] = c34;
+	prepared[68] = c35;
+	prepared[69] = c36;
+	prepared[70] = c37;
+	prepared[71] = c38;
+	prepared[72] = c39;
+	prepared[73] = c40;
+	prepared[74] = c41;
+	prepared[75] = c42;
+	prepared[76] = c43;
+	prepared[77] = c44;
+	prepared[78] = c45;
+	prepared[79] = c46;
+	prepared[80] = c47;
+	prepared[81] = c48;
+	prepared[82] = c49;
+	prepared[83] = c50;
+}
+
+static inline void gen_reproject_gen2_val_jac_obj_p_axis_angle_eval(FLT *out, const FLT *prepared,
+																	const FLT *sensor_pt) {
+	const GEN_FLT obj_px = prepared[0];
+	const GEN_FLT obj_py = prepared[1];
+	const GEN_FLT obj_pz = prepared[2];
+	const GEN_FLT lh_px = prepared[3];
+	const GEN_FLT lh_py = prepared[4];
+	const GEN_FLT lh_pz = prepared[5];
+	const GEN_FLT curve_0 = prepared[6];
+	const GEN_FLT gibPhase_0 = prepared[7];
+	const GEN_FLT gibMag_0 = prepared[8];
+	const GEN_FLT ogeeMag_0 = prepared[9];
+	const GEN_FLT ogeePhase_0 = prepared[10];
+	const GEN_FLT curve_1 = prepared[11];
+	const GEN_FLT gibPhase_1 = prepared[12];
+	const GEN_FLT gibMag_1 = prepared[13];
+	const GEN_FLT ogeeMag_1 = prepared[14];
+	const GEN_FLT ogeePhase_1 = prepared[15];
+	const GEN_FLT x8 = prepared[16];
+	const GEN_FLT x31 = prepared[17];
+	const GEN_FLT x38 = prepared[18];
+	const GEN_FLT x43 = prepared[19];
+	const GEN_FLT x44 = prepared[20];
+	const GEN_FLT x47 = prepared[21];
+	const GEN_FLT x51 = prepared[22];
+	const GEN_FLT x55 = prepared[23];
+	const GEN_FLT x56 = prepared[24];
+	const GEN_FLT x57 = prepared[25];
+	const GEN_FLT x61 = prepared[26];
+	const GEN_FLT x62 = prepared[27];
+	const GEN_FLT x82 = prepared[28];
+	const GEN_FLT x93 = prepared[29];
+	const GEN_FLT x95 = prepared[30];
+	const GEN_FLT x96 = prepared[31];
+	const GEN_FLT x112 = prepared[32];
+	const GEN_FLT c0 = prepared[33];
+	const GEN_FLT c1 = prepared[34];
+	const GEN_FLT c2 = prepared[35];
+	const GEN_FLT c3 = prepared[36];
+	const GEN_FLT c4 = prepared[37];
+	const GEN_FLT c5 = prepared[38];
+	const GEN_FLT c6 = prepared[39];
+	const GEN_FLT c7 = prepared[40];
+	const GEN_FLT c8 = prepared[41];
+	const GEN_FLT c9 = prepared[42];
+	const GEN_FLT c10 = prepared[43];
+	const GEN_FLT c11 = prepared[44];
+	const GEN_FLT c12 = prepared[45];
+	const GEN_FLT c13 = prepared[46];
+	const GEN_FLT c14 = prepared[47];
+	const GEN_FLT c15 = prepared[48];
+	const GEN_FLT c16 = prepared[49];
+	const GEN_FLT c17 = prepared[50];
+	const GEN_FLT c18 = prepared[51];
+	const GEN_FLT c19 = prepared[52];
+	const GEN_FLT c20 = prepared[53];
+	const GEN_FLT c21 = prepared[54];
+	const GEN_FLT c22 = prepared[55];
+	const GEN_FLT c23 = prepared[56];
+	const GEN_FLT c24 = prepared[57];
+	const GEN_FLT c25 = prepared[58];
+	const GEN_FLT c26 = prepared[59];
+	const GEN_FLT c27 = prepared[60];
+	const GEN_FLT c28 = prepared[61];
+	const GEN_FLT c29 = prepared[62];
+	const GEN_FLT c30 = prepared[63];
+	const GEN_FLT c31 = prepared[64];
+	const GEN_FLT c32 = prepared[65];
+	const GEN_FLT c33 = prepared[66];
+	const GEN_FLT c34 = prepared[67];
+	const GEN_FLT c35 = prepared[68];
+	const GEN_FLT c36 = prepared[69];
+	const GEN_FLT c37 = prepared[70];
+	const GEN_FLT c38 = prepared[71];
+	const GEN_FLT c39 = prepared[72];
+	const GEN_FLT c40 = prepared[73];
+	const GEN_FLT c41 = prepared[74];
+	const GEN_FLT c42 = prepared[75];
+	const GEN_FLT c43 = prepared[76];
+	const GEN_FLT c44 = prepared[77];
+	const GEN_FLT c45 = prepared[78];
+	const GEN_FLT c46 = prepared[79];
+	const GEN_FLT c47 = prepared[80];
+	const GEN_FLT c48 = prepared[81];
+	const GEN_FLT c49 = prepared[82];
+	const GEN_FLT c50 = prepared[83];
+	const GEN_FLT sensor_x = sensor_pt[0];
+	const GEN_FLT sensor_y = sensor_pt[1];
+	const GEN_FLT sensor_z = sensor_pt[2];
+	const GEN_FLT x25 = obj_pz + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLT x34 = obj_py + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLT x39 = obj_px + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLT x40 = lh_pz + (x25 * x8) + (x31 * x34) + (x38 * x39);
+	const GEN_FLT x41 = -1 * x40;
+	const GEN_FLT x48 = lh_px + (x25 * x44) + (x34 * x47) + (x39 * x43);
+	const GEN_FLT x49 = atan2(x41, x48);
+	const GEN_FLT x52 = (x41 * x41) + (x48 * x48);
+	const GEN_FLT x53 = 1. / sqrt(x52);
+	const GEN_FLT x58 = lh_py + (x25 * x57) + (x34 * x55) + (x39 * x56);
+	const GEN_FLT x59 = x53 * x58;
+	const GEN_FLT x60 = x51 * x59;
+	const GEN_FLT x63 = x58 * x58;
+	const GEN_FLT x64 = x52 + x63;
+	const GEN_FLT x65 = 1. / sqrt(x64);
+	const GEN_FLT x66 = x58 * x65;
+	const GEN_FLT x67 = asin(x62 * x66);
+	const GEN_FLT x68 = 8.0108022e-06 * x67;
+	const GEN_FLT x69 = -8.0108022e-06 + (-1 * x68);
+	const GEN_FLT x70 = 0.0028679863 + (x67 * x69);
+	const GEN_FLT x71 = 5.3685255e-06 + (x67 * x70);
+	const GEN_FLT x72 = 0.0076069798 + (x67 * x71);
+	const GEN_FLT x73 = x67 * x67;
+	const GEN_FLT x74 = ogeeMag_0 + x49 + (-1 * asin(x60));
+	const GEN_FLT x75 = curve_0 + (ogeePhase_0 * sin(x74));
+	const GEN_FLT x76 = x67 * x72;
+	const GEN_FLT x77 = -8.0108022e-06 + (-1.60216044e-05 * x67);
+	const GEN_FLT x78 = x70 + (x67 * x77);
+	const GEN_FLT x79 = x71 + (x67 * x78);
+	const GEN_FLT x80 = x72 + (x67 * x79);
+	const GEN_FLT x81 = x76 + (x67 * x80);
+	const GEN_FLT x83 = x75 * x82;
+	const GEN_FLT x84 = x61 + (-1 * x81 * x83);
+	const GEN_FLT x85 = 1. / x84;
+	const GEN_FLT x86 = x75 * x85;
+	const GEN_FLT x87 = x73 * x86;
+	const GEN_FLT x88 = x60 + (x72 * x87);
+	const GEN_FLT x89 = asin(x88);
+	const GEN_FLT x90 = gibPhase_0 + x49 + (-1 * x89);
+	const GEN_FLT x91 = 1.5707963267949 + (-1 * x49);
+	const GEN_FLT x94 = x59 * x93;
+	const GEN_FLT x97 = asin(x66 * x96);
+	const GEN_FLT x98 = 8.0108022e-06 * x97;
+	const GEN_FLT x99 = -8.0108022e-06 + (-1 * x98);
+	const GEN_FLT x100 = 0.0028679863 + (x97 * x99);
+	const GEN_FLT x101 = 5.3685255e-06 + (x100 * x97);
+	const GEN_FLT x102 = 0.0076069798 + (x101 * x97);
+	const GEN_FLT x103 = x97 * x97;
+	const GEN_FLT x104 = ogeeMag_1 + x49 + (-1 * asin(x94));
+	const GEN_FLT x105 = curve_1 + (ogeePhase_1 * sin(x104));
+	const GEN_FLT x106 = x102 * x97;
+	const GEN_FLT x107 = -8.0108022e-06 + (-1.60216044e-05 * x97);
+	const GEN_FLT x108 = x100 + (x107 * x97);
+	const GEN_FLT x109 = x101 + (x108 * x97);
+	const GEN_FLT x110 = x102 + (x109 * x97);
+	const GEN_FLT x111 = x106 + (x110 * x97);
+	const GEN_FLT x113 = x105 * x112;
+	const GEN_FLT x114 = x95 + (-1 * x111 * x113);
+	const GEN_FLT x115 = 1. / x114;
+	const GEN_FLT x116 = x105 * x115;
+	const GEN_FLT x117 = x103 * x116;
+	const GEN_FLT x118 = x94 + (x102 * x117);
+	const GEN_FLT x119 = asin(x118);
+	const GEN_FLT x120 = gibPhase_1 + x49 + (-1 * x119);
+	const GEN_FLT x121 = 1. / sqrt(1 + (-1 * (x88 * x88)));
+	const GEN_FLT x122 = x63 * (1. / x64);
+	const GEN_FLT x123 = 1. / sqrt(1 + (-1 * x122 * c9));
+	const GEN_FLT x124 = x62 * x65;
+	const GEN_FLT x127 = 1.0/2.0 * x58;
+	const GEN_FLT x129 = 1.0/2.0 * x48;
+	const GEN_FLT x131 = 1.0/2.0 * x41;
+	const GEN_FLT x132 = (x129 * c10) + (x131 * c11);
+	const GEN_FLT x133 = (-1 * x132) + (-1 * x127 * c12);
+	const GEN_FLT x134 = x58 * (1. / (x64 * sqrt(x64)));
+	const GEN_FLT x135 = x134 * x62;
+	const GEN_FLT x136 = x123 * ((x124 * x56) + (x133 * x135));
+	const GEN_FLT x137 = x136 * x69;
+	const GEN_FLT x138 = (x136 * x70) + (x67 * (x137 + (-1 * x136 * x68)));
+	const GEN_FLT x139 = (x136 * x71) + (x138 * x67);
+	const GEN_FLT x140 = 1. / x52;
+	const GEN_FLT x141 = x140 * x63;
+	const GEN_FLT x142 = 1. / sqrt(1 + (-1 * x141 * c13));
+	const GEN_FLT x143 = x51 * x53;
+	const GEN_FLT x144 = -1 * x132;
+	const GEN_FLT x145 = x58 * (1. / (x52 * sqrt(x52)));
+	const GEN_FLT x146 = x145 * x51;
+	const GEN_FLT x147 = (x143 * x56) + (x144 * x146);
+	const GEN_FLT x148 = x140 * x48;
+	const GEN_FLT x149 = x140 * x40;
+	const GEN_FLT x150 = (x149 * x43) + (-1 * x148 * x38);
+	const GEN_FLT x151 = ogeePhase_0 * cos(x74);
+	const GEN_FLT x152 = x151 * (x150 + (-1 * x142 * x147));
+	const GEN_FLT x153 = x81 * x82;
+	const GEN_FLT x154 = 2.40324066e-05 * x67;
+	const GEN_FLT x155 = x72 * x73;
+	const GEN_FLT x156 = x155 * x75 * (1. / (x84 * x84));
+	const GEN_FLT x157 = x155 * x85;
+	const GEN_FLT x158 = 2 * x76 * x86;
+	const GEN_FLT x159 = x150 + (-1 * x121 * (x147 + (x136 * x158) + (x139 * x87) + (x152 * x157) + (x156 * ((x152 *
+		x153) + (x83 * ((x136 * x72) + (x136 * x80) + (x139 * x67) + (x67 * (x139 + (x136 * x79) + (x67 * (x138 + (x136
+		* x78) + (x67 * (x137 + (x136 * x77) + (-1 * x136 * x154)))))))))))));
+	const GEN_FLT x160 = gibMag_0 * cos(x90);
+	const GEN_FLT x163 = (x129 * c14) + (x131 * c15);
+	const GEN_FLT x164 = (-1 * x163) + (-1 * x127 * c16);
+	const GEN_FLT x165 = x123 * ((x124 * x55) + (x135 * x164));
+	const GEN_FLT x166 = x165 * x69;
+	const GEN_FLT x167 = (x165 * x70) + (x67 * (x166 + (-1 * x165 * x68)));
+	const GEN_FLT x168 = (x165 * x71) + (x167 * x67);
+	const GEN_FLT x169 = -1 * x163;
+	const GEN_FLT x170 = (x143 * x55) + (x146 * x169);
+	const GEN_FLT x171 = (x149 * x47) + (-1 * x148 * x31);
+	const GEN_FLT x172 = x171 + (-1 * x142 * x170);
+	const GEN_FLT x173 = x151 * x153;
+	const GEN_FLT x174 = x151 * x157;
+	const GEN_FLT x175 = x171 + (-1 * x121 * (x170 + (x156 * ((x172 * x173) + (x83 * ((x165 * x72) + (x165 * x80) +
+		(x168 * x67) + (x67 * (x168 + (x165 * x79) + (x67 * (x167 + (x165 * x78) + (x67 * (x166 + (x165 * x77) + (-1 *
+		x154 * x165))))))))))) + (x158 * x165) + (x168 * x87) + (x172 * x174)));
+	const GEN_FLT x176 = (x129 * c17) + (x131 * c18);
+	const GEN_FLT x177 = (-1 * x176) + (-1 * x127 * c19);
+	const GEN_FLT x178 = x123 * ((x124 * x57) + (x135 * x177));
+	const GEN_FLT x179 = x178 * x69;
+	const GEN_FLT x180 = (x178 * x70) + (x67 * (x179 + (-1 * x178 * x68)));
+	const GEN_FLT x181 = (x178 * x71) + (x180 * x67);
+	const GEN_FLT x182 = -1 * x176;
+	const GEN_FLT x183 = (x143 * x57) + (x146 * x182);
+	const GEN_FLT x184 = (x149 * x44) + (-1 * x148 * x8);
+	const GEN_FLT x185 = x184 + (-1 * x142 * x183);
+	const GEN_FLT x186 = x184 + (-1 * x121 * (x183 + (x156 * ((x173 * x185) + (x83 * ((x178 * x72) + (x178 * x80) +
+		(x181 * x67) + (x67 * (x181 + (x178 * x79) + (x67 * (x180 + (x178 * x78) + (x67 * (x179 + (x178 * x77) + (-1 *
+		x154 * x178))))))))))) + (x158 * x178) + (x174 * x185) + (x181 * x87)));
+	const GEN_FLT x205 = (sensor_x * c20) + (sensor_y * c21) + (sensor_z * c22);
+	const GEN_FLT x206 = x205 * x55;
+	const GEN_FLT x215 = (sensor_x * c23) + (sensor_y * c24) + (sensor_z * c25);
+	const GEN_FLT x216 = x215 * x57;
+	const GEN_FLT x220 = (sensor_x * c26) + (sensor_y * c27) + (sensor_z * c28);
+	const GEN_FLT x221 = x220 * x56;
+	const GEN_FLT x222 = x206 + x216 + x221;
+	const GEN_FLT x223 = x215 * x44;
+	const GEN_FLT x224 = x205 * x47;
+	const GEN_FLT x225 = x220 * x43;
+	const GEN_FLT x226 = x215 * x8;
+	const GEN_FLT x227 = x205 * x31;
+	const GEN_FLT x228 = x220 * x38;
+	const GEN_FLT x229 = (x129 * ((2 * x223) + (2 * x224) + (2 * x225))) + (x131 * ((-2 * x226) + (-2 * x227) + (-2 *
+		x228)));
+	const GEN_FLT x230 = (-1 * x229) + (-1 * x127 * ((2 * x206) + (2 * x216) + (2 * x221)));
+	const GEN_FLT x231 = x123 * ((x124 * x222) + (x135 * x230));
+	const GEN_FLT x232 = x231 * x69;
+	const GEN_FLT x233 = (x231 * x70) + (x67 * (x232 + (-1 * x231 * x68)));
+	const GEN_FLT x234 = (x231 * x71) + (x233 * x67);
+	const GEN_FLT x235 = -1 * x229;
+	const GEN_FLT x236 = (x143 * x222) + (x146 * x235);
+	const GEN_FLT x237 = (x148 * ((-1 * x226) + (-1 * x227) + (-1 * x228))) + (x149 * (x223 + x224 + x225));
+	const GEN_FLT x238 = x237 + (-1 * x142 * x236);
+	const GEN_FLT x239 = x237 + (-1 * x121 * (x236 + (x156 * ((x173 * x238) + (x83 * ((x231 * x72) + (x231 * x80) +
+		(x234 * x67) + (x67 * (x234 + (x231 * x79) + (x67 * (x233 + (x231 * x78) + (x67 * (x232 + (x231 * x77) + (-1 *
+		x154 * x231))))))))))) + (x158 * x231) + (x174 * x238) + (x234 * x87)));
+	const GEN_FLT x249 = (sensor_x * c29) + (sensor_y * c30) + (sensor_z * c31);
+	const GEN_FLT x250 = x249 * x56;
+	const GEN_FLT x255 = (sensor_x * c32) + (sensor_y * c33) + (sensor_z * c34);
+	const GEN_FLT x256 = x255 * x57;
+	const GEN_FLT x259 = (sensor_x * c35) + (sensor_y * c36) + (sensor_z * c37);
+	const GEN_FLT x260 = x259 * x55;
+	const GEN_FLT x261 = x250 + x256 + x260;
+	const GEN_FLT x262 = x249 * x43;
+	const GEN_FLT x263 = x255 * x44;
+	const GEN_FLT x264 = x259 * x47;
+	const GEN_FLT x265 = x255 * x8;
+	const GEN_FLT x266 = x249 * x38;
+	const GEN_FLT x267 = x259 * x31;
+	const GEN_FLT x268 = (x129 * ((2 * x262) + (2 * x263) + (2 * x264))) + (x131 * ((-2 * x265) + (-2 * x266) + (-2 *
+		x267)));
+	const GEN_FLT x269 = (-1 * x268) + (-1 * x127 * ((2 * x250) + (2 * x256) + (2 * x260)));
+	const GEN_FLT x270 = x123 * ((x124 * x261) + (x135 * x269));
+	const GEN_FLT x271 = x270 * x69;
+	const GEN_FLT x272 = (x270 * x70) + (x67 * (x271 + (-1 * x270 * x68)));
+	const GEN_FLT x273 = (x270 * x71) + (x272 * x67);
+	const GEN_FLT x274 = -1 * x268;
+	const GEN_FLT x275 = (x143 * x261) + (x146 * x274);
+	const GEN_FLT x276 = (x148 * ((-1 * x265) + (-1 * x266) + (-1 * x267))) + (x149 * (x262 + x263 + x264));
+	const GEN_FLT x277 = x276 + (-1 * x142 * x275);
+	const GEN_FLT x278 = x276 + (-1 * x121 * (x275 + (x156 * ((x173 * x277) + (x83 * ((x270 * x72) + (x270 * x80) +
+		(x273 * x67) + (x67 * (x273 + (x270 * x79) + (x67 * (x272 + (x270 * x78) + (x67 * (x271 + (x270 * x77) + (-1 *
+		x154 * x270))))))))))) + (x158 * x270) + (x174 * x277) + (x273 * x87)));
+	const GEN_FLT x282 = (sensor_x * c38) + (sensor_y * c39) + (sensor_z * c40);
+	const GEN_FLT x283 = x282 * x55;
+	const GEN_FLT x285 = (sensor_x * c41) + (sensor_y * c42) + (sensor_z * c43);
+	const GEN_FLT x286 = x285 * x56;
+	const GEN_FLT x288 = (sensor_x * c44) + (sensor_y * c45) + (sensor_z * c46);
+	const GEN_FLT x289 = x288 * x57;
+	const GEN_FLT x290 = x283 + x286 + x289;
+	const GEN_FLT x291 = x285 * x43;
+	const GEN_FLT x292 = x282 * x47;
+	const GEN_FLT x293 = x288 * x44;
+	const GEN_FLT x294 = x282 * x31;
+	const GEN_FLT x295 = x285 * x38;
+	const GEN_FLT x296 = x288 * x8;
+	const GEN_FLT x297 = (x129 * ((2 * x291) + (2 * x292) + (2 * x293))) + (x131 * ((-2 * x294) + (-2 * x295) + (-2 *
+		x296)));
+	const GEN_FLT x298 = (-1 * x297) + (-1 * x127 * ((2 * x283) + (2 * x286) + (2 * x289)));
+	const GEN_FLT x299 = x123 * ((x124 * x290) + (x135 * x298));
+	const GEN_FLT x300 = x299 * x69;
+	const GEN_FLT x301 = (x299 * x70) + (x67 * (x300 + (-1 * x299 * x68)));
+	const GEN_FLT x302 = (x299 * x71) + (x301 * x67);
+	const GEN_FLT x303 = -1 * x297;
+	const GEN_FLT x304 = (x143 * x290) + (x146 * x303);
+	const GEN_FLT x305 = (x148 * ((-1 * x294) + (-1 * x295) + (-1 * x296))) + (x149 * (x291 + x292 + x293));
+	const GEN_FLT x306 = x305 + (-1 * x142 * x304);
+	const GEN_FLT x307 = x305 + (-1 * x121 * (x304 + (x156 * ((x173 * x306) + (x83 * ((x299 * x72) + (x299 * x80) +
+		(x302 * x67) + (x67 * (x302 + (x299 * x79) + (x67 * (x301 + (x299 * x78) + (x67 * (x300 + (x299 * x77) + (-1 *
+		x154 * x299))))))))))) + (x158 * x299) + (x174 * x306) + (x302 * x87)));
+	const GEN_FLT x308 = 1. / sqrt(1 + (-1 * (x118 * x118)));
+	const GEN_FLT x309 = 1. / sqrt(1 + (-1 * x122 * c47));
+	const GEN_FLT x310 = x65 * x96;
+	const GEN_FLT x311 = x134 * x96;
+	const GEN_FLT x312 = x309 * ((x133 * x311) + (x310 * x56));
+	const GEN_FLT x313 = x312 * x99;
+	const GEN_FLT x314 = (x100 * x312) + (x97 * (x313 + (-1 * x312 * x98)));
+	const GEN_FLT x315 = (x101 * x312) + (x314 * x97);
+	const GEN_FLT x316 = 1. / sqrt(1 + (-1 * x141 * c48));
+	const GEN_FLT x317 = x53 * x93;
+	const GEN_FLT x318 = x145 * x93;
+	const GEN_FLT x319 = (x144 * x318) + (x317 * x56);
+	const GEN_FLT x320 = ogeePhase_1 * cos(x104);
+	const GEN_FLT x321 = x320 * (x150 + (-1 * x316 * x319));
+	const GEN_FLT x322 = x111 * x112;
+	const GEN_FLT x323 = 2.40324066e-05 * x97;
+	const GEN_FLT x324 = x102 * x103;
+	const GEN_FLT x325 = x105 * x324 * (1. / (x114 * x114));
+	const GEN_FLT x326 = x115 * x324;
+	const GEN_FLT x327 = 2 * x106 * x116;
+	const GEN_FLT x328 = x150 + (-1 * x308 * (x319 + (x117 * x315) + (x312 * x327) + (x321 * x326) + (x325 * ((x113 *
+		((x102 * x312) + (x110 * x312) + (x315 * x97) + (x97 * (x315 + (x109 * x312) + (x97 * (x314 + (x108 * x312) +
+		(x97 * (x313 + (x107 * x312) + (-1 * x312 * x323))))))))) + (x321 * x322)))));
+	const GEN_FLT x329 = gibMag_1 * cos(x120);
+	const GEN_FLT x330 = x309 * ((x164 * x311) + (x310 * x55));
+	const GEN_FLT x331 = x330 * x99;
+	const GEN_FLT x332 = (x100 * x330) + (x97 * (x331 + (-1 * x330 * x98)));
+	const GEN_FLT x333 = (x101 * x330) + (x332 * x97);
+	const GEN_FLT x334 = (x169 * x318) + (x317 * x55);
+	const GEN_FLT x335 = x171 + (-1 * x316 * x334);
+	const GEN_FLT x336 = x320 * x322;
+	const GEN_FLT x337 = x320 * x326;
+	const GEN_FLT x338 = x171 + (-1 * x308 * (x334 + (x117 * x333) + (x325 * ((x113 * ((x102 * x330) + (x110 * x330) +
+		(x333 * x97) + (x97 * (x333 + (x109 * x330) + (x97 * (x332 + (x108 * x330) + (x97 * (x331 + (x107 * x330) + (-1
+		* x323 * x330))))))))) + (x335 * x336))) + (x327 * x330) + (x335 * x337)));
+	const GEN_FLT x339 = x309 * ((x177 * x311) + (x310 * x57));
+	const GEN_FLT x340 = x339 * x99;
+	const GEN_FLT x341 = (x100 * x339) + (x97 * (x340 + (-1 * x339 * x98)));
+	const GEN_FLT x342 = (x101 * x339) + (x341 * x97);
+	const GEN_FLT x343 = (x182 * x318) + (x317 * x57);
+	const GEN_FLT x344 = x184 + (-1 * x316 * x343);
+	const GEN_FLT x345 = x184 + (-1 * x308 * (x343 + (x117 * x342) + (x325 * ((x113 * ((x102 * x339) + (x110 * x339) +
+		(x342 * x97) + (x97 * (x342 + (x109 * x339) + (x97 * (x341 + (x108 * x339) + (x97 * (x340 + (x107 * x339) + (-1
+		* x323 * x339))))))))) + (x336 * x344))) + (x327 * x339) + (x337 * x344)));
+	const GEN_FLT x346 = x309 * ((x222 * x310) + (x230 * x311));
+	const GEN_FLT x347 = x346 * x99;
+	const GEN_FLT x348 = (x100 * x346) + (x97 * (x347 + (-1 * x346 * x98)));
+	const GEN_FLT x349 = (x101 * x346) + (x348 * x97);
+	const GEN_FLT x350 = (x222 * x317) + (x235 * x318);
+	const GEN_FLT x351 = x237 + (-1 * x316 * x350);
+	const GEN_FLT x352 = x237 + (-1 * x308 * (x350 + (x117 * x349) + (x325 * ((x113 * ((x102 * x346) + (x110 * x346) +
+		(x349 * x97) + (x97 * (x349 + (x109 * x346) + (x97 * (x348 + (x108 * x346) + (x97 * (x347 + (x107 * x346) + (-1
+		* x323 * x346))))))))) + (x336 * x351))) + (x327 * x346) + (x337 * x351)));
+	const GEN_FLT x353 = x309 * ((x261 * x310) + (x269 * x311));
+	const GEN_FLT x354 = x353 * x99;
+	const GEN_FLT x355 = (x100 * x353) + (x97 * (x354 + (-1 * x353 * x98)));
+	const GEN_FLT x356 = (x101 * x353) + (x355 * x97);
+	const GEN_FLT x357 = (x261 * x317) + (x274 * x318);
+	const GEN_FLT x358 = x276 + (-1 * x316 * x357);
+	const GEN_FLT x359 = x276 + (-1 * x308 * (x357 + (x117 * x356) + (x325 * ((x113 * ((x102 * x353) + (x110 * x353) +
+		(x356 * x97) + (x97 * (x356 + (x109 * x353) + (x97 * (x355 + (x108 * x353) + (x97 * (x354 + (x107 * x353) + (-1
+		* x323 * x353))))))))) + (x336 * x358))) + (x327 * x353) + (x337 * x358)));
+	const GEN_FLT x360 = x309 * ((x290 * x310) + (x298 * x311));
+	const GEN_FLT x361 = x360 * x99;
+	const GEN_FLT x362 = (x100 * x360) + (x97 * (x361 + (-1 * x360 * x98)));
+	const GEN_FLT x363 = (x101 * x360) + (x362 * x97);
+	const GEN_FLT x364 = (x290 * x317) + (x303 * x318);
+	const GEN_FLT x365 = x305 + (-1 * x316 * x364);
+	const GEN_FLT x366 = x305 + (-1 * x308 * (x364 + (x117 * x363) + (x325 * ((x113 * ((x102 * x360) + (x110 * x360) +
+		(x363 * x97) + (x97 * (x363 + (x109 * x360) + (x97 * (x362 + (x108 * x360) + (x97 * (x361 + (x107 * x360) + (-1
+		* x323 * x360))))))))) + (x336 * x365))) + (x327 * x360) + (x337 * x365)));
+	out[0] = c49 + (-1 * x89) + (-1 * x91) + (gibMag_0 * sin(x90));
+	out[1] = c50 + (-1 * x119) + (-1 * x91) + (gibMag_1 * sin(x120));
+	out[2] = x159 + (x159 * x160);
+	out[3] = x175 + (x160 * x175);
+	out[4] = x186 + (x160 * x186);
+	out[5] = x239 + (x160 * x239);
+	out[6] = x278 + (x160 * x278);
+	out[7] = x307 + (x160 * x307);
+	out[8] = x328 + (x328 * x329);
+	out[9] = x338 + (x329 * x338);
+	out[10] = x345 + (x329 * x345);
+	out[11] = x352 + (x329 * x352);
+	out[12] = x359 + (x329 * x359);
+	out[13] = x366 + (x329 * x366);
+}
+
+// Value of reproject_gen2 then its jacobian wrt obj_p, lh_p
+enum { gen_reproject_gen2_val_jac_obj_p_lh_p_axis_angle_prepared_size = 111 };
+
+static inline void gen_reproject_gen2_val_jac_obj_p_lh_p_axis_angle_prepare(FLT *prepared,
+																			const LinmathAxisAnglePose *obj_p,
+																			const LinmathAxisAnglePose *lh_p,
+																			const BaseStationCal *bsd) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_0 = bsd[0].phase;
+	const GEN_FLT tilt_0 = bsd[0].tilt;
+	const GEN_FLT curve_0 = bsd[0].curve;
+	const GEN_FLT gibPhase_0 = bsd[0].gibpha;
+	const GEN_FLT gibMag_0 = bsd[0].gibmag;
+	const GEN_FLT ogeeMag_0 = bsd[0].ogeephase;
+	const GEN_FLT ogeePhase_0 = bsd[0].ogeemag;
+	const GEN_FLT phase_1 = bsd[1].phase;
+	const GEN_FLT tilt_1 = bsd[1].tilt;
+	const GEN_FLT curve_1 = bsd[1].curve;
+	const GEN_FLT gibPhase_1 = bsd[1].gibpha;
+	const GEN_FLT gibMag_1 = bsd[1].gibmag;
+	const GEN_FLT ogeeMag_1 = bsd[1].ogeephase;
+	const GEN_FLT ogeePhase_1 = bsd[1].ogeemag;
+	const GEN_FLT x0 = lh_qi * lh_qi;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qk * lh_qk;
+	const GEN_FLT x3 = 1e-10 + x0 + x1 + x2;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = cos(x4);
+	const GEN_FLT x6 = 1. / x3;
+	const GEN_FLT x7 = 1 + (-1 * x5);
+	const GEN_FLT x8 = x6 * x7;
+	const GEN_FLT x9 = x2 * x8;
+	const GEN_FLT x10 = x5 + x9;
+	const GEN_FLT x11 = obj_qi * obj_qi;
+	const GEN_FLT x12 = obj_qj * obj_qj;
+	const GEN_FLT x13 = obj_qk * obj_qk;
+	const GEN_FLT x14 = 1e-10 + x11 + x12 + x13;
+	const GEN_FLT x15 = sqrt(x14);
+	const GEN_FLT x16 = cos(x15);
+	const GEN_FLT x17 = 1. / x14;
+	const GEN_FLT x18 = 1 + (-1 * x16);
+	const GEN_FLT x19 = x17 * x18;
+	const GEN_FLT x20 = sin(x15);
+	const GEN_FLT x21 = x20 * (1. / x15);
+	const GEN_FLT x22 = obj_qi * x21;
+	const GEN_FLT x23 = obj_qj * x19;
+	const GEN_FLT x24 = obj_qj * x21;
+	const GEN_FLT x25 = obj_qk * x19;
+	const GEN_FLT x26 = obj_qi * x25;
+	const GEN_FLT x28 = 1. / x4;
+	const GEN_FLT x29 = sin(x4);
+	const GEN_FLT x30 = x28 * x29;
+	const GEN_FLT x31 = lh_qi * x30;
+	const GEN_FLT x32 = lh_qj * x8;
+	const GEN_FLT x33 = lh_qk * x32;
+	const GEN_FLT x34 = x31 + x33;
+	const GEN_FLT x35 = obj_qk * x21;
+	const GEN_FLT x36 = obj_qi * x23;
+	const GEN_FLT x38 = lh_qj * x30;
+	const GEN_FLT x39 = lh_qk * x8;
+	const GEN_FLT x40 = lh_qi * x39;
+	const GEN_FLT x41 = x40 + (-1 * x38);
+	const GEN_FLT x45 = x0 * x8;
+	const GEN_FLT x46 = x45 + x5;
+	const GEN_FLT x47 = x38 + x40;
+	const GEN_FLT x48 = lh_qk * x30;
+	const GEN_FLT x49 = lh_qi * x32;
+	const GEN_FLT x50 = x49 + (-1 * x48);
+	const GEN_FLT x53 = x1 * x8;
+	const GEN_FLT x54 = x5 + x53;
+	const GEN_FLT x55 = x48 + x49;
+	const GEN_FLT x56 = x33 + (-1 * x31);
+	const GEN_FLT x58 = 0.523598775598299 + tilt_0;
+	const GEN_FLT x59 = tan(x58);
+	const GEN_FLT x64 = cos(x58);
+	const GEN_FLT x65 = 1. / x64;
+	const GEN_FLT x85 = sin(x58);
+	const GEN_FLT x95 = -0.523598775598299 + tilt_1;
+	const GEN_FLT x96 = tan(x95);
+	const GEN_FLT x99 = cos(x95);
+	const GEN_FLT x100 = 1. / x99;
+	const GEN_FLT x117 = sin(x95);
+	const GEN_FLT x129 = 2 * x48;
+	const GEN_FLT x130 = 2 * x49;
+	const GEN_FLT x132 = 2 * x5;
+	const GEN_FLT x134 = 2 * x40;
+	const GEN_FLT x165 = 2 * x31;
+	const GEN_FLT x166 = 2 * x33;
+	const GEN_FLT x191 = 1. / (x14 * sqrt(x14));
+	const GEN_FLT x192 = 2 * x18 * (1. / (x14 * x14));
+	const GEN_FLT x193 = obj_qi * x192;
+	const GEN_FLT x194 = x12 * x193;
+	const GEN_FLT x195 = x16 * x17;
+	const GEN_FLT x196 = x191 * x20;
+	const GEN_FLT x197 = x11 * x196;
+	const GEN_FLT x198 = x21 + (-1 * x197) + (x11 * x195);
+	const GEN_FLT x199 = obj_qi * obj_qk;
+	const GEN_FLT x200 = obj_qj * x192;
+	const GEN_FLT x201 = x199 * x200;
+	const GEN_FLT x202 = x201 + (-1 * obj_qi * obj_qj * obj_qk * x191 * x20);
+	const GEN_FLT x203 = x11 * x192;
+	const GEN_FLT x204 = obj_qj * x203;
+	const GEN_FLT x205 = x23 + (-1 * x204) + (obj_qj * x197);
+	const GEN_FLT x206 = x195 * x199;
+	const GEN_FLT x207 = x196 * x199;
+	const GEN_FLT x208 = x206 + (-1 * x207);
+	const GEN_FLT x211 = x13 * x193;
+	const GEN_FLT x212 = (-1 * x201) + (obj_qj * x207);
+	const GEN_FLT x213 = obj_qk * x203;
+	const GEN_FLT x214 = x25 + (-1 * x213) + (obj_qk * x197);
+	const GEN_FLT x215 = obj_qi * obj_qj;
+	const GEN_FLT x216 = x196 * x215;
+	const GEN_FLT x217 = x195 * x215;
+	const GEN_FLT x218 = x216 + (-1 * x217);
+	const GEN_FLT x221 = obj_qi * obj_qi * obj_qi;
+	const GEN_FLT x222 = x207 + (-1 * x206);
+	const GEN_FLT x223 = x217 + (-1 * x216);
+	const GEN_FLT x244 = x21 + x212;
+	const GEN_FLT x245 = x12 * x196;
+	const GEN_FLT x246 = (-1 * x245) + (x12 * x195);
+	const GEN_FLT x247 = obj_qi * x19;
+	const GEN_FLT x248 = x247 + (-1 * x194) + (obj_qi * x245);
+	const GEN_FLT x249 = obj_qj * obj_qk;
+	const GEN_FLT x250 = x196 * x249;
+	const GEN_FLT x251 = x195 * x249;
+	const GEN_FLT x252 = x250 + (-1 * x251);
+	const GEN_FLT x255 = x13 * x200;
+	const GEN_FLT x256 = x202 + x21;
+	const GEN_FLT x257 = obj_qk * x12 * x192;
+	const GEN_FLT x258 = x25 + (-1 * x257) + (obj_qk * x245);
+	const GEN_FLT x261 = obj_qj * obj_qj * obj_qj;
+	const GEN_FLT x262 = x251 + (-1 * x250);
+	const GEN_FLT x283 = x13 * x196;
+	const GEN_FLT x284 = (-1 * x283) + (x13 * x195);
+	const GEN_FLT x285 = x23 + (-1 * x255) + (obj_qj * x283);
+	const GEN_FLT x288 = x247 + (-1 * x211) + (obj_qi * x283);
+	const GEN_FLT x291 = obj_qk * obj_qk * obj_qk;
+	const GEN_FLT x393 = 1. / (x3 * sqrt(x3));
+	const GEN_FLT x394 = 2 * x7 * (1. / (x3 * x3));
+	const GEN_FLT x395 = lh_qi * x394;
+	const GEN_FLT x396 = x1 * x395;
+	const GEN_FLT x398 = x5 * x6;
+	const GEN_FLT x399 = x29 * x393;
+	const GEN_FLT x400 = x0 * x399;
+	const GEN_FLT x401 = x30 + (-1 * x400) + (x0 * x398);
+	const GEN_FLT x402 = lh_qi * lh_qk;
+	const GEN_FLT x403 = lh_qj * x394;
+	const GEN_FLT x404 = x402 * x403;
+	const GEN_FLT x405 = x404 + (-1 * lh_qi * lh_qj * lh_qk * x29 * x393);
+	const GEN_FLT x407 = x0 * x394;
+	const GEN_FLT x408 = lh_qj * x407;
+	const GEN_FLT x409 = x32 + (-1 * x408) + (lh_qj * x400);
+	const GEN_FLT x410 = x398 * x402;
+	const GEN_FLT x411 = x399 * x402;
+	const GEN_FLT x412 = x410 + (-1 * x411);
+	const GEN_FLT x415 = x2 * x395;
+	const GEN_FLT x417 = (-1 * x404) + (lh_qj * x411);
+	const GEN_FLT x419 = lh_qk * x407;
+	const GEN_FLT x420 = x39 + (-1 * x419) + (lh_qk * x400);
+	const GEN_FLT x421 = lh_qi * lh_qj;
+	const GEN_FLT x422 = x399 * x421;
+	const GEN_FLT x423 = x398 * x421;
+	const GEN_FLT x424 = x422 + (-1 * x423);
+	const GEN_FLT x426 = lh_qi * lh_qi * lh_qi;
+	const GEN_FLT x428 = x411 + (-1 * x410);
+	const GEN_FLT x430 = x423 + (-1 * x422);
+	const GEN_FLT x443 = lh_qj * lh_qj * lh_qj;
+	const GEN_FLT x445 = lh_qi * x8;
+	const GEN_FLT x446 = x1 * x399;
+	const GEN_FLT x447 = x445 + (-1 * x396) + (lh_qi * x446);
+	const GEN_FLT x448 = lh_qj * lh_qk;
+	const GEN_FLT x449 = x398 * x448;
+	const GEN_FLT x450 = x399 * x448;
+	const GEN_FLT x451 = x449 + (-1 * x450);
+	const GEN_FLT x453 = lh_qk * x1 * x394;
+	const GEN_FLT x454 = x39 + (-1 * x453) + (lh_qk * x446);
+	const GEN_FLT x458 = (-1 * x446) + (x1 * x398);
+	const GEN_FLT x459 = x30 + x417;
+	const GEN_FLT x461 = x450 + (-1 * x449);
+	const GEN_FLT x463 = x2 * x403;
+	const GEN_FLT x465 = x30 + x405;
+	const GEN_FLT x480 = x2 * x399;
+	const GEN_FLT x481 = (-1 * x480) + (x2 * x398);
+	const GEN_FLT x483 = x32 + (-1 * x463) + (lh_qj * x480);
+	const GEN_FLT x488 = x445 + (-1 * x415) + (lh_qi * x480);
+	const GEN_FLT x490 = lh_qk * lh_qk * lh_qk;
+	const GEN_FLT c0 = x26 + (-1 * x24);
+	const GEN_FLT c1 = x22 + (obj_qk * x23);
+	const GEN_FLT c2 = x16 + (x13 * x19);
+	const GEN_FLT c3 = x35 + x36;
+	const GEN_FLT c4 = x16 + (x12 * x19);
+	const GEN_FLT c5 = (-1 * x22) + (obj_qj * obj_qk * x17 * x18);
+	const GEN_FLT c6 = x16 + (x11 * x19);
+	const GEN_FLT c7 = x36 + (-1 * x35);
+	const GEN_FLT c8 = x24 + x26;
+	const GEN_FLT c9 = 1. / (x64 * x64);
+	const GEN_FLT c10 = x132 + (2 * x45);
+	const GEN_FLT c11 = (-1 * x134) + (2 * lh_qj * x28 * x29);
+	const GEN_FLT c12 = x129 + x130;
+	const GEN_FLT c13 = x59 * x59;
+	const GEN_FLT c14 = x130 + (-1 * x129);
+	const GEN_FLT c15 = (-1 * x165) + (-1 * x166);
+	const GEN_FLT c16 = x132 + (2 * x53);
+	const GEN_FLT c17 = x134 + (2 * x38);
+	const GEN_FLT c18 = (-1 * x132) + (-2 * x9);
+	const GEN_FLT c19 = x166 + (-1 * x165);
+	const GEN_FLT c20 = x205 + x208;
+	const GEN_FLT c21 = (-1 * x194) + (-1 * x22) + (obj_qi * x12 * x191 * x20);
+	const GEN_FLT c22 = (-1 * x198) + (-1 * x202);
+	const GEN_FLT c23 = x214 + x218;
+	const GEN_FLT c24 = x198 + x212;
+	const GEN_FLT c25 = (-1 * x211) + (-1 * x22) + (obj_qi * x13 * x191 * x20);
+	const GEN_FLT c26 = (-1 * x22) + (-1 * x192 * x221) + (x191 * x20 * x221) + (2 * obj_qi * x17 * x18);
+	const GEN_FLT c27 = x205 + x222;
+	const GEN_FLT c28 = x214 + x223;
+	const GEN_FLT c29 = (-1 * x204) + (-1 * x24) + (obj_qj * x11 * x191 * x20);
+	const GEN_FLT c30 = x248 + x252;
+	const GEN_FLT c31 = x244 + x246;
+	const GEN_FLT c32 = (-1 * x246) + (-1 * x256);
+	const GEN_FLT c33 = x223 + x258;
+	const GEN_FLT c34 = (-1 * x24) + (-1 * x255) + (obj_qj * x13 * x191 * x20);
+	const GEN_FLT c35 = x248 + x262;
+	const GEN_FLT c36 = (-1 * x24) + (-1 * x192 * x261) + (x191 * x20 * x261) + (2 * obj_qj * x17 * x18);
+	const GEN_FLT c37 = x218 + x258;
+	const GEN_FLT c38 = x244 + x284;
+	const GEN_FLT c39 = (-1 * x257) + (-1 * x35) + (obj_qk * x12 * x191 * x20);
+	const GEN_FLT c40 = x222 + x285;
+	const GEN_FLT c41 = (-1 * x213) + (-1 * x35) + (obj_qk * x11 * x191 * x20);
+	const GEN_FLT c42 = (-1 * x256) + (-1 * x284);
+	const GEN_FLT c43 = x262 + x288;
+	const GEN_FLT c44 = x252 + x288;
+	const GEN_FLT c45 = x208 + x285;
+	const GEN_FLT c46 = (-1 * x35) + (-1 * x192 * x291) + (x191 * x20 * x291) + (2 * obj_qk * x17 * x18);
+	const GEN_FLT c47 = 1. / (x99 * x99);
+	const GEN_FLT c48 = x96 * x96;
+	const GEN_FLT c49 = (-1 * x31) + (-1 * x396) + (lh_qi * x1 * x29 * x393);
+	const GEN_FLT c50 = (-1 * x401) + (-1 * x405);
+	const GEN_FLT c51 = x409 + x412;
+	const GEN_FLT c52 = (-1 * x31) + (-1 * x415) + (lh_qi * x2 * x29 * x393);
+	const GEN_FLT c53 = x401 + x417;
+	const GEN_FLT c54 = x420 + x424;
+	const GEN_FLT c55 = (-1 * x31) + (-1 * x394 * x426) + (x29 * x393 * x426) + (2 * lh_qi * x6 * x7);
+	const GEN_FLT c56 = x409 + x428;
+	const GEN_FLT c57 = x420 + x430;
+	const GEN_FLT c58 = (-1 * x38) + (-1 * x394 * x443) + (x29 * x393 * x443) + (2 * lh_qj * x6 * x7);
+	const GEN_FLT c59 = x447 + x451;
+	const GEN_FLT c60 = x424 + x454;
+	const GEN_FLT c61 = (-1 * x38) + (-1 * x408) + (lh_qj * x0 * x29 * x393);
+	const GEN_FLT c62 = x458 + x459;
+	const GEN_FLT c63 = x447 + x461;
+	const GEN_FLT c64 = (-1 * x38) + (-1 * x463) + (lh_qj * x2 * x29 * x393);
+	const GEN_FLT c65 = (-1 * x458) + (-1 * x465);
+	const GEN_FLT c66 = x430 + x454;
+	const GEN_FLT c67 = (-1 * x453) + (-1 * x48) + (lh_qk * x1 * x29 * x393);
+	const GEN_FLT c68 = x459 + x481;
+	const GEN_FLT c69 = x428 + x483;
+	const GEN_FLT c70 = (-1 * x419) + (-1 * x48) + (lh_qk * x0 * x29 * x393);
+	const GEN_FLT c71 = (-1 * x465) + (-1 * x481);
+	const GEN_FLT c72 = x451 + x488;
+	const GEN_FLT c73 = (-1 * x48) + (-1 * x394 * x490) + (x29 * x393 * x490) + (2 * lh_qk * x6 * x7);
+	const GEN_FLT c74 = x461 + x488;
+	const GEN_FLT c75 = x412 + x483;
+	const GEN_FLT c76 = -1 * phase_0;
+	const GEN_FLT c77 = -1 * phase_1;
+	prepared[0] = obj_px;
+	prepared[1] = obj_py;
+	prepared[2] = obj_pz;
+	prepared[3] = lh_px;
+	prepared[4] = lh_py;
+	prepared[5] = lh_pz;
+	prepared[6] = curve_0;
+	prepared[7] = gibPhase_0;
+	prepared[8] = gibMag_0;
+	prepared[9] = ogeeMag_0;
+	prepared[10] = ogeePhase_0;
+	prepared[11] = curve_1;
+	prepared[12] = gibPhase_1;
+	prepared[13] = gibMag_1;
+	prepared[14] = ogeeMag_1;
+	prepared[15] = ogeePhase_1;
+	prepared[16] = x10;
+	prepared[17] = x34;
+	prepared[18] = x41;
+	prepared[19] = x46;
+	prepared[20] = x47;
+	prepared[21] = x50;
+	prepared[22] = x54;
+	prepared[23] = x55;
+	prepared[24] = x56;
+	prepared[25] = x59;
+	prepared[26] = x64;
+	prepared[27] = x65;
+	prepared[28] = x85;
+	prepared[29] = x96;
+	prepared[30] = x99;
+	prepared[31] = x100;
+	prepared[32] = x117;
+	prepared[33] = c0;
+	prepared[34] = c1;
+	prepared[35] = c2;
+	prepared[36] = c3;
+	prepared[37] = c4;
+	prepared[38] = c5;
+	prepared[39] = c6;
+	prepared[40] = c7;
+	prepared[41] = c8;
+	prepared[42] = c9;
+	prepared[43] = c10;
+	prepared[44] = c11;
+	prepared[45] = c12;
+	prepared[46] = c13;
+	prepared[47] = c14;
+	prepared[48] = c15;
+	prepared[49] = c16;
+	prepared[50] = c17;
+	prepared[51] = c18;
+	prepared[52] = c19;
+	prepared[53] = c20;
+	prepared[54] = c21;
+	prepared[55] = c22;
+	prepared[56] = c23;
+	prepared[57] = c24;
+	prepared[58] = c25;
+	prepared[59] = c26;
+	prepared[60] = c27;
+	prepared[61] = c28;
+	prepared[62] = c29;
+	prepared[63] = c30;
+	prepared[64] = c31;
+	prepared[65] = c32;
+	prepared[66] = c33;
+	prepared[67] = c34;
+	prepared[68] = c35;
+	prepared[69] = c36;
+	prepared[70] = c37;
+	prepared[71] = c38;
+	prepared[72] = c39;
+	prepared[73] = c40;
+	prepared[74] = c41;
+	prepared[75] = c42;
+	prepared[76] = c43;
+	prepared[77] = c44;
+	prepared[78] = c45;
+	prepared[79] = c46;
+	prepared[80] = c47;
+	prepared[81] = c48;
+	prepared[82] = c49;
+	prepared[83] = c50;
+	prepared[84] = c51;
+	prepared[85] = c52;
+	prepared[86] = c53;
+	prepared[87] = c54;
+	prepared[88] = c55;
+	prepared[89] = c56;
+	prepared[90] = c57;
+	prepared[91] = c58;
+	prepared[92] = c59;
+	prepared[93] = c60;
+	prepared[94] = c61;
+	prepared[95] = c62;
+	prepared[96] = c63;
+	prepared[97] = c64;
+	prepared[98] = c65;
+	prepared[99] = c66;
+	prepared[100] = c67;
+	prepared[101] = c68;
+	prepared[102] = c69;
+	prepared[103] = c70;
+	prepared[104] = c71;
+	prepared[105] = c72;
+	prepared[106] = c73;
+	prepared[107] = c74;
+	prepared[108] = c75;
+	prepared[109] = c76;
+	prepared[110] = c77;
+}
+
+static inline void gen_reproject_gen2_val_jac_obj_p_lh_p_axis_angle_eval(FLT *out, const FLT *prepared,
+																		 const FLT *sensor_pt) {
+	const GEN_FLT obj_px = prepared[0];
+	const GEN_FLT obj_py = prepared[1];
+	const GEN_FLT obj_pz = prepared[2];
+	const GEN_FLT lh_px = prepared[3];
+	const GEN_FLT lh_py = prepared[4];
+	const GEN_FLT lh_pz = prepared[5];
+	const GEN_FLT curve_0 = prepared[6];
+	const GEN_FLT gibPhase_0 = prepared[7];
+	const GEN_FLT gibMag_0 = prepared[8];
+	const GEN_FLT ogeeMag_0 = prepared[9];
+	const GEN_FLT ogeePhase_0 = prepared[10];
+	const GEN_FLT curve_1 = prepared[11];
+	const GEN_FLT gibPhase_1 = prepared[12];
+	const GEN_FLT gibMag_1 = prepared[13];
+	const GEN_FLT ogeeMag_1 = prepared[14];
+	const GEN_FLT ogeePhase_1 = prepared[15];
+	const GEN_FLT x10 = prepared[16];
+	const GEN_FLT x34 = prepared[17];
+	const GEN_FLT x41 = prepared[18];
+	const GEN_FLT x46 = prepared[19];
+	const GEN_FLT x47 = prepared[20];
+	const GEN_FLT x50 = prepared[21];
+	const GEN_FLT x54 = prepared[22];
+	const GEN_FLT x55 = prepared[23];
+	const GEN_FLT x56 = prepared[24];
+	const GEN_FLT x59 = prepared[25];
+	const GEN_FLT x64 = prepared[26];
+	const GEN_FLT x65 = prepared[27];
+	const GEN_FLT x85 = prepared[28];
+	const GEN_FLT x96 = prepared[29];
+	const GEN_FLT x99 = prepared[30];
+	const GEN_FLT x100 = prepared[31];
+	const GEN_FLT x117 = prepared[32];
+	const GEN_FLT c0 = prepared[33];
+	const GEN_FLT c1 = prepared[34];
+	const GEN_FLT c2 = prepared[35];
+	const GEN_FLT c3 = prepared[36];
+	const GEN_FLT c4 = prepared[37];
+	const GEN_FLT c5 = prepared[38];
+	const GEN_FLT c6 = prepared[39];
+	const GEN_FLT c7 = prepared[40];
+	const GEN_FLT c8 = prepared[41];
+	const GEN_FLT c9 = prepared[42];
+	const GEN_FLT c10 = prepared[43];
+	const GEN_FLT c11 = prepared[44];
+	const GEN_FLT c12 = prepared[45];
+	const GEN_FLT c13 = prepared[46];
+	const GEN_FLT c14 = prepared[47];
+	const GEN_FLT c15 = prepared[48];
+	const GEN_FLT c16 = prepared[49];
+	const GEN_FLT c17 = prepared[50];
+	const GEN_FLT c18 = prepared[51];
+	const GEN_FLT c19 = prepared[52];
+	const GEN_FLT c20 = prepared[53];
+	const GEN_FLT c21 = prepared[54];
+	const GEN_FLT c22 = prepared[55];
+	const GEN_FLT c23 = prepared[56];
+	const GEN_FLT c24 = prepared[57];
+	const GEN_FLT c25 = prepared[58];
+	const GEN_FLT c26 = prepared[59];
+	const GEN_FLT c27 = prepared[60];
+	const GEN_FLT c28 = prepared[61];
+	const GEN_FLT c29 = prepared[62];
+	const GEN_FLT c30 = prepared[63];
+	const GEN_FLT c31 = prepared[64];
+	const GEN_FLT c32 = prepared[65];
+	const GEN_FLT c33 = prepared[66];
+	const GEN_FLT c34 = prepared[67];
+	const GEN_FLT c35 = prepared[68];
+	const GEN_FLT c36 = prepared[69];
+	const GEN_FLT c37 = prepared[70];
+	const GEN_FLT c38 = prepared[71];
+	const GEN_FLT c39 = prepared[72];
+	const GEN_FLT c40 = prepared[73];
+	const GEN_FLT c41 = prepared[74];
+	const GEN_FLT c42 = prepared[75];
+	const GEN_FLT c43 = prepared[76];
+	const GEN_FLT c44 = prepared[77];
+	const GEN_FLT c45 = prepared[78];
+	const GEN_FLT c46 = prepared[79];
+	const GEN_FLT c47 = prepared[80];
+	const GEN_FLT c48 = prepared[81];
+	const GEN_FLT c49 = prepared[82];
+	const GEN_FLT c50 = prepared[83];
+	const GEN_FLT c51 = prepared[84];
+	const GEN_FLT c52 = prepared[85];
+	const GEN_FLT c53 = prepared[86];
+	const GEN_FLT c54 = prepared[87];
+	const GEN_FLT c55 = prepared[88];
+	const GEN_FLT c56 = prepared[89];
+	const GEN_FLT c57 = prepared[90];
+	const GEN_FLT c58 = prepared[91];
+	const GEN_FLT c59 = prepared[92];
+	const GEN_FLT c60 = prepared[93];
+	const GEN_FLT c61 = prepared[94];
+	const GEN_FLT c62 = prepared[95];
+	const GEN_FLT c63 = prepared[96];
+	const GEN_FLT c64 = prepared[97];
+	const GEN_FLT c65 = prepared[98];
+	const GEN_FLT c66 = prepared[99];
+	const GEN_FLT c67 = prepared[100];
+	const GEN_FLT c68 = prepared[101];
+	const GEN_FLT c69 = prepared[102];
+	const GEN_FLT c70 = prepared[103];
+	const GEN_FLT c71 = prepared[104];
+	const GEN_FLT c72 = prepared[105];
+	const GEN_FLT c73 = prepared[106];
+	const GEN_FLT c74 = prepared[107];
+	const GEN_FLT c75 = prepared[108];
+	const GEN_FLT c76 = prepared[109];
+	const GEN_FLT c77 = prepared[110];
+	const GEN_FLT sensor_x = sensor_pt[0];
+	const GEN_FLT sensor_y = sensor_pt[1];
+	const GEN_FLT sensor_z = sensor_pt[2];
+	const GEN_FLT x27 = obj_pz + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLT x37 = obj_py + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLT x42 = obj_px + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLT x43 = lh_pz + (x10 * x27) + (x34 * x37) + (x41 * x42);
+	const GEN_FLT x44 = -1 * x43;
+	const GEN_FLT x51 = lh_px + (x27 * x47) + (x37 * x50) + (x42 * x46);
+	const GEN_FLT x52 = atan2(x44, x51);
+	const GEN_FLT x57 = lh_py + (x27 * x56) + (x37 * x54) + (x42 * x55);
+	const GEN_FLT x60 = (x44 * x44) + (x51 * x51);
+	const GEN_FLT x61 = 1. / sqrt(x60);
+	const GEN_FLT x62 = x59 * x61;
+	const GEN_FLT x63 = x57 * x62;
+	const GEN_FLT x66 = x57 * x57;
+	const GEN_FLT x67 = x60 + x66;
+	const GEN_FLT x68 = 1. / sqrt(x67);
+	const GEN_FLT x69 = x65 * x68;
+	const GEN_FLT x70 = asin(x57 * x69);
+	const GEN_FLT x71 = 8.0108022e-06 * x70;
+	const GEN_FLT x72 = -8.0108022e-06 + (-1 * x71);
+	const GEN_FLT x73 = 0.0028679863 + (x70 * x72);
+	const GEN_FLT x74 = 5.3685255e-06 + (x70 * x73);
+	const GEN_FLT x75 = 0.0076069798 + (x70 * x74);
+	const GEN_FLT x76 = x70 * x70;
+	const GEN_FLT x77 = ogeeMag_0 + x52 + (-1 * asin(x63));
+	const GEN_FLT x78 = curve_0 + (ogeePhase_0 * sin(x77));
+	const GEN_FLT x79 = x70 * x75;
+	const GEN_FLT x80 = -8.0108022e-06 + (-1.60216044e-05 * x70);
+	const GEN_FLT x81 = x73 + (x70 * x80);
+	const GEN_FLT x82 = x74 + (x70 * x81);
+	const GEN_FLT x83 = x75 + (x70 * x82);
+	const GEN_FLT x84 = x79 + (x70 * x83);
+	const GEN_FLT x86 = x78 * x85;
+	const GEN_FLT x87 = x64 + (-1 * x84 * x86);
+	const GEN_FLT x88 = 1. / x87;
+	const GEN_FLT x89 = x78 * x88;
+	const GEN_FLT x90 = x76 * x89;
+	const GEN_FLT x91 = x63 + (x75 * x90);
+	const GEN_FLT x92 = asin(x91);
+	const GEN_FLT x93 = gibPhase_0 + x52 + (-1 * x92);
+	const GEN_FLT x94 = 1.5707963267949 + (-1 * x52);
+	const GEN_FLT x97 = x61 * x96;
+	const GEN_FLT x98 = x57 * x97;
+	const GEN_FLT x101 = x100 * x68;
+	const GEN_FLT x102 = asin(x101 * x57);
+	const GEN_FLT x103 = 8.0108022e-06 * x102;
+	const GEN_FLT x104 = -8.0108022e-06 + (-1 * x103);
+	const GEN_FLT x105 = 0.0028679863 + (x102 * x104);
+	const GEN_FLT x106 = 5.3685255e-06 + (x102 * x105);
+	const GEN_FLT x107 = 0.0076069798 + (x102 * x106);
+	const GEN_FLT x108 = x102 * x102;
+	const GEN_FLT x109 = ogeeMag_1 + x52 + (-1 * asin(x98));
+	const GEN_FLT x110 = curve_1 + (ogeePhase_1 * sin(x109));
+	const GEN_FLT x111 = x102 * x107;
+	const GEN_FLT x112 = -8.0108022e-06 + (-1.60216044e-05 * x102);
+	const GEN_FLT x113 = x105 + (x102 * x112);
+	const GEN_FLT x114 = x106 + (x102 * x113);
+	const GEN_FLT x115 = x107 + (x102 * x114);
+	const GEN_FLT x116 = x111 + (x102 * x115);
+	const GEN_FLT x118 = x110 * x117;
+	const GEN_FLT x119 = x99 + (-1 * x116 * x118);
+	const GEN_FLT x120 = 1. / x119;
+	const GEN_FLT x121 = x110 * x120;
+	const GEN_FLT x122 = x108 * x121;
+	const GEN_FLT x123 = x98 + (x107 * x122);
+	const GEN_FLT x124 = asin(x123);
+	const GEN_FLT x125 = gibPhase_1 + x52 + (-1 * x124);
+	const GEN_FLT x126 = 1. / sqrt(1 + (-1 * (x91 * x91)));
+	const GEN_FLT x127 = x66 * (1. / x67);
+	const GEN_FLT x128 = 1. / sqrt(1 + (-1 * x127 * c9));
+	const GEN_FLT x131 = 1.0/2.0 * x57;
+	const GEN_FLT x133 = 1.0/2.0 * x51;
+	const GEN_FLT x135 = 1.0/2.0 * x44;
+	const GEN_FLT x136 = (x133 * c10) + (x135 * c11);
+	const GEN_FLT x137 = (-1 * x136) + (-1 * x131 * c12);
+	const GEN_FLT x138 = x57 * (1. / (x67 * sqrt(x67)));
+	const GEN_FLT x139 = x138 * x65;
+	const GEN_FLT x140 = x128 * ((x137 * x139) + (x55 * x69));
+	const GEN_FLT x141 = x140 * x72;
+	const GEN_FLT x142 = (x140 * x73) + (x70 * (x141 + (-1 * x140 * x71)));
+	const GEN_FLT x143 = (x140 * x74) + (x142 * x70);
+	const GEN_FLT x144 = 1. / x60;
+	const GEN_FLT x145 = x144 * x66;
+	const GEN_FLT x146 = 1. / sqrt(1 + (-1 * x145 * c13));
+	const GEN_FLT x147 = -1 * x136;
+	const GEN_FLT x148 = x57 * (1. / (x60 * sqrt(x60)));
+	const GEN_FLT x149 = x148 * x59;
+	const GEN_FLT x150 = (x147 * x149) + (x55 * x62);
+	const GEN_FLT x151 = x144 * x51;
+	const GEN_FLT x152 = x144 * x43;
+	const GEN_FLT x153 = (x152 * x46) + (-1 * x151 * x41);
+	const GEN_FLT x154 = ogeePhase_0 * cos(x77);
+	const GEN_FLT x155 = x154 * (x153 + (-1 * x146 * x150));
+	const GEN_FLT x156 = x84 * x85;
+	const GEN_FLT x157 = 2.40324066e-05 * x70;
+	const GEN_FLT x158 = x75 * x76;
+	const GEN_FLT x159 = x158 * x78 * (1. / (x87 * x87));
+	const GEN_FLT x160 = x158 * x88;
+	const GEN_FLT x161 = 2 * x79 * x89;
+	const GEN_FLT x162 = x153 + (-1 * x126 * (x150 + (x140 * x161) + (x143 * x90) + (x155 * x160) + (x159 * ((x155 *
+		x156) + (x86 * ((x140 * x75) + (x140 * x83) + (x143 * x70) + (x70 * (x143 + (x140 * x82) + (x70 * (x142 + (x140
+		* x81) + (x70 * (x141 + (x140 * x80) + (-1 * x140 * x157)))))))))))));
+	const GEN_FLT x163 = cos(x93);
+	const GEN_FLT x164 = gibMag_0 * x163;
+	const GEN_FLT x167 = (x133 * c14) + (x135 * c15);
+	const GEN_FLT x168 = (-1 * x167) + (-1 * x131 * c16);
+	const GEN_FLT x169 = x128 * ((x139 * x168) + (x54 * x69));
+	const GEN_FLT x170 = x169 * x72;
+	const GEN_FLT x171 = (x169 * x73) + (x70 * (x170 + (-1 * x169 * x71)));
+	const GEN_FLT x172 = (x169 * x74) + (x171 * x70);
+	const GEN_FLT x173 = -1 * x167;
+	const GEN_FLT x174 = (x149 * x173) + (x54 * x62);
+	const GEN_FLT x175 = (x152 * x50) + (-1 * x151 * x34);
+	const GEN_FLT x176 = x175 + (-1 * x146 * x174);
+	const GEN_FLT x177 = x154 * x156;
+	const GEN_FLT x178 = x154 * x160;
+	const GEN_FLT x179 = x175 + (-1 * x126 * (x174 + (x159 * ((x176 * x177) + (x86 * ((x169 * x75) + (x169 * x83) +
+		(x172 * x70) + (x70 * (x172 + (x169 * x82) + (x70 * (x171 + (x169 * x81) + (x70 * (x170 + (x169 * x80) + (-1 *
+		x157 * x169))))))))))) + (x161 * x169) + (x172 * x90) + (x176 * x178)));
+	const GEN_FLT x180 = (x133 * c17) + (x135 * c18);
+	const GEN_FLT x181 = (-1 * x180) + (-1 * x131 * c19);
+	const GEN_FLT x182 = x128 * ((x139 * x181) + (x56 * x69));
+	const GEN_FLT x183 = x182 * x72;
+	const GEN_FLT x184 = (x182 * x73) + (x70 * (x183 + (-1 * x182 * x71)));
+	const GEN_FLT x185 = (x182 * x74) + (x184 * x70);
+	const GEN_FLT x186 = -1 * x180;
+	const GEN_FLT x187 = (x149 * x186) + (x56 * x62);
+	const GEN_FLT x188 = (x152 * x47) + (-1 * x10 * x151);
+	const GEN_FLT x189 = x188 + (-1 * x146 * x187);
+	const GEN_FLT x190 = x188 + (-1 * x126 * (x187 + (x159 * ((x177 * x189) + (x86 * ((x182 * x75) + (x182 * x83) +
+		(x185 * x70) + (x70 * (x185 + (x182 * x82) + (x70 * (x184 + (x182 * x81) + (x70 * (x183 + (x182 * x80) + (-1 *
+		x157 * x182))))))))))) + (x161 * x182) + (x178 * x189) + (x185 * x90)));
+	const GEN_FLT x209 = (sensor_x * c20) + (sensor_y * c21) + (sensor_z * c22);
+	const GEN_FLT x210 = x209 * x54;
+	const GEN_FLT x219 = (sensor_x * c23) + (sensor_y * c24) + (sensor_z * c25);
+	const GEN_FLT x220 = x219 * x56;
+	const GEN_FLT x224 = (sensor_x * c26) + (sensor_y * c27) + (sensor_z * c28);
+	const GEN_FLT x225 = x224 * x55;
+	const GEN_FLT x226 = x210 + x220 + x225;
+	const GEN_FLT x227 = x219 * x47;
+	const GEN_FLT x228 = x209 * x50;
+	const GEN_FLT x229 = x224 * x46;
+	const GEN_FLT x230 = x10 * x219;
+	const GEN_FLT x231 = x209 * x34;
+	const GEN_FLT x232 = x224 * x41;
+	const GEN_FLT x233 = (x133 * ((2 * x227) + (2 * x228) + (2 * x229))) + (x135 * ((-2 * x230) + (-2 * x231) + (-2 *
+		x232)));
+	const GEN_FLT x234 = (-1 * x233) + (-1 * x131 * ((2 * x210) + (2 * x220) + (2 * x225)));
+	const GEN_FLT x235 = x128 * ((x139 * x234) + (x226 * x69));
+	const GEN_FLT x236 = x235 * x72;
+	const GEN_FLT x237 = (x235 * x73) + (x70 * (x236 + (-1 * x235 * x71)));
+	const GEN_FLT x238 = (x235 * x74) + (x237 * x70);
+	const GEN_FLT x239 = -1 * x233;
+	const GEN_FLT x240 = (x149 * x239) + (x226 * x62);
+	const GEN_FLT x241 = (x151 * ((-1 * x230) + (-1 * x231) + (-1 * x232))) + (x152 * (x227 + x228 + x229));
+	const GEN_FLT x242 = x241 + (-1 * x146 * x240);
+	const GEN_FLT x243 = x241 + (-1 * x126 * (x240 + (x159 * ((x177 * x242) + (x86 * ((x235 * x75) + (x235 * x83) +
+		(x238 * x70) + (x70 * (x238 + (x235 * x82) + (x70 * (x237 + (x235 * x81) + (x70 * (x236 + (x235 * x80) + (-1 *
+		x157 * x235))))))))))) + (x161 * x235) + (x178 * x242) + (x238 * x90)));
+	const GEN_FLT x253 = (sensor_x * c29) + (sensor_y * c30) + (sensor_z * c31);
+	const GEN_FLT x254 = x253 * x55;
+	const GEN_FLT x259 = (sensor_x * c32) + (sensor_y * c33) + (sensor_z * c34);
+	const GEN_FLT x260 = x259 * x56;
+	const GEN_FLT x263 = (sensor_x * c35) + (sensor_y * c36) + (sensor_z * c37);
+	const GEN_FLT x264 = x263 * x54;
+	const GEN_FLT x265 = x254 + x260 + x264;
+	const GEN_FLT x266 = x253 * x46;
+	const GEN_FLT x267 = x259 * x47;
+	const GEN_FLT x268 = x263 * x50;
+	const GEN_FLT x269 = x10 * x259;
+	const GEN_FLT x270 = x253 * x41;
+	const GEN_FLT x271 = x263 * x34;
+	const GEN_FLT x272 = (x133 * ((2 * x266) + (2 * x267) + (2 * x268))) + (x135 * ((-2 * x269) + (-2 * x270) + (-2 *
+		x271)));
+	const GEN_FLT x273 = (-1 * x272) + (-1 * x131 * ((2 * x254) + (2 * x260) + (2 * x264)));
+	const GEN_FLT x274 = x128 * ((x139 * x273) + (x265 * x69));
+	const GEN_FLT x275 = x274 * x72;
+	const GEN_FLT x276 = (x274 * x73) + (x70 * (x275 + (-1 * x274 * x71)));
+	const GEN_FLT x277 = (x274 * x74) + (x276 * x70);
+	const GEN_FLT x278 = -1 * x272;
+	const GEN_FLT x279 = (x149 * x278) + (x265 * x62);
+	const GEN_FLT x280 = (x151 * ((-1 * x269) + (-1 * x270) + (-1 * x271))) + (x152 * (x266 + x267 + x268));
+	const GEN_FLT x281 = x280 + (-1 * x146 * x279);
+	const GEN_FLT x282 = x280 + (-1 * x126 * (x279 + (x159 * ((x177 * x281) + (x86 * ((x274 * x75) + (x274 * x83) +
+		(x277 * x70) + (x70 * (x277 + (x274 * x82) + (x70 * (x276 + (x274 * x81) + (x70 * (x275 + (x274 * x80) + (-1 *
+		x157 * x274))))))))))) + (x161 * x274) + (x178 * x281) + (x277 * x90)));
+	const GEN_FLT x286 = (sensor_x * c38) + (sensor_y * c39) + (sensor_z * c40);
+	const GEN_FLT x287 = x286 * x54;
+	const GEN_FLT x289 = (sensor_x * c41) + (sensor_y * c42) + (sensor_z * c43);
+	const GEN_FLT x290 = x289 * x55;
+	const GEN_FLT x292 = (sensor_x * c44) + (sensor_y * c45) + (sensor_z * c46);
+	const GEN_FLT x293 = x292 * x56;
+	const GEN_FLT x294 = x287 + x290 + x293;
+	const GEN_FLT x295 = x289 * x46;
+	const GEN_FLT x296 = x286 * x50;
+	const GEN_FLT x297 = x292 * x47;
+	const GEN_FLT x298 = x286 * x34;
+	const GEN_FLT x299 = x289 * x41;
+	const GEN_FLT x300 = x10 * x292;
+	const GEN_FLT x301 = (x133 * ((2 * x295) + (2 * x296) + (2 * x297))) + (x135 * ((-2 * x298) + (-2 * x299) + (-2 *
+		x300)));
+	const GEN_FLT x302 = (-1 * x301) + (-1 * x131 * ((2 * x287) + (2 * x290) + (2 * x293)));
+	const GEN_FLT x303 = x128 * ((x139 * x302) + (x294 * x69));
+	const GEN_FLT x304 = x303 * x72;
+	const GEN_FLT x305 = (x303 * x73) + (x70 * (x304 + (-1 * x303 * x71)));
+	const GEN_FLT x306 = (x303 * x74) + (x305 * x70);
+	const GEN_FLT x307 = -1 * x301;
+	const GEN_FLT x308 = (x149 * x307) + (x294 * x62);
+	const GEN_FLT x309 = (x151 * ((-1 * x298) + (-1 * x299) + (-1 * x300))) + (x152 * (x295 + x296 + x297));
+	const GEN_FLT x310 = x309 + (-1 * x146 * x308);
+	const GEN_FLT x311 = x309 + (-1 * x126 * (x308 + (x159 * ((x177 * x310) + (x86 * ((x303 * x75) + (x303 * x83) +
+		(x306 * x70) + (x70 * (x306 + (x303 * x82) + (x70 * (x305 + (x303 * x81) + (x70 * (x304 + (x303 * x80) + (-1 *
+		x157 * x303))))))))))) + (x161 * x303) + (x178 * x310) + (x306 * x90)));
+	const GEN_FLT x312 = 1. / sqrt(1 + (-1 * (x123 * x123)));
+	const GEN_FLT x313 = 1. / sqrt(1 + (-1 * x127 * c47));
+	const GEN_FLT x314 = x100 * x138;
+	const GEN_FLT x315 = x313 * ((x101 * x55) + (x137 * x314));
+	const GEN_FLT x316 = x104 * x315;
+	const GEN_FLT x317 = (x102 * (x316 + (-1 * x103 * x315))) + (x105 * x315);
+	const GEN_FLT x318 = (x102 * x317) + (x106 * x315);
+	const GEN_FLT x319 = 1. / sqrt(1 + (-1 * x145 * c48));
+	const GEN_FLT x320 = x148 * x96;
+	const GEN_FLT x321 = (x147 * x320) + (x55 * x97);
+	const GEN_FLT x322 = ogeePhase_1 * cos(x109);
+	const GEN_FLT x323 = x322 * (x153 + (-1 * x319 * x321));
+	const GEN_FLT x324 = x116 * x117;
+	const GEN_FLT x325 = 2.40324066e-05 * x102;
+	const GEN_FLT x326 = x107 * x108;
+	const GEN_FLT x327 = x110 * x326 * (1. / (x119 * x119));
+	const GEN_FLT x328 = x120 * x326;
+	const GEN_FLT x329 = 2 * x111 * x121;
+	const GEN_FLT x330 = x153 + (-1 * x312 * (x321 + (x122 * x318) + (x315 * x329) + (x323 * x328) + (x327 * ((x118 *
+		((x102 * x318) + (x102 * (x318 + (x102 * (x317 + (x102 * (x316 + (x112 * x315) + (-1 * x315 * x325))) + (x113 *
+		x315))) + (x114 * x315))) + (x107 * x315) + (x115 * x315))) + (x323 * x324)))));
+	const GEN_FLT x331 = cos(x125);
+	const GEN_FLT x332 = gibMag_1 * x331;
+	const GEN_FLT x333 = x313 * ((x101 * x54) + (x168 * x314));
+	const GEN_FLT x334 = x104 * x333;
+	const GEN_FLT x335 = (x102 * (x334 + (-1 * x103 * x333))) + (x105 * x333);
+	const GEN_FLT x336 = (x102 * x335) + (x106 * x333);
+	const GEN_FLT x337 = (x173 * x320) + (x54 * x97);
+	const GEN_FLT x338 = x175 + (-1 * x319 * x337);
+	const GEN_FLT x339 = x322 * x324;
+	const GEN_FLT x340 = x322 * x328;
+	const GEN_FLT x341 = x175 + (-1 * x312 * (x337 + (x122 * x336) + (x327 * ((x118 * ((x102 * x336) + (x102 * (x336 +
+		(x102 * (x335 + (x102 * (x334 + (x112 * x333) + (-1 * x325 * x333))) + (x113 * x333))) + (x114 * x333))) +
+		(x107 * x333) + (x115 * x333))) + (x338 * x339))) + (x329 * x333) + (x338 * x340)));
+	const GEN_FLT x342 = x313 * ((x101 * x56) + (x181 * x314));
+	const GEN_FLT x343 = x104 * x342;
+	const GEN_FLT x344 = (x102 * (x343 + (-1 * x103 * x342))) + (x105 * x342);
+	const GEN_FLT x345 = (x102 * x344) + (x106 * x342);
+	const GEN_FLT x346 = (x186 * x320) + (x56 * x97);
+	const GEN_FLT x347 = x188 + (-1 * x319 * x346);
+	const GEN_FLT x348 = x188 + (-1 * x312 * (x346 + (x122 * x345) + (x327 * ((x118 * ((x102 * x345) + (x102 * (x345 +
+		(x102 * (x344 + (x102 * (x343 + (x112 * x342) + (-1 * x325 * x342))) + (x113 * x342))) + (x114 * x342))) +
+		(x107 * x342) + (x115 * x342))) + (x339 * x347))) + (x329 * x342) + (x340 * x347)));
+	const GEN_FLT x349 = x313 * ((x101 * x226) + (x234 * x314));
+	const GEN_FLT x350 = x104 * x349;
+	const GEN_FLT x351 = (x102 * (x350 + (-1 * x103 * x349))) + (x105 * x349);
+	const GEN_FLT x352 = (x102 * x351) + (x106 * x349);
+	const GEN_FLT x353 = (x226 * x97) + (x239 * x320);
+	const GEN_FLT x354 = x241 + (-1 * x319 * x353);
+	const GEN_FLT x355 = x241 + (-1 * x312 * (x353 + (x122 * x352) + (x327 * ((x118 * ((x102 * x352) + (x102 * (x352 +
+		(x102 * (x351 + (x102 * (x350 + (x112 * x349) + (-1 * x325 * x349))) + (x113 * x349))) + (x114 * x349))) +
+		(x107 * x349) + (x115 * x349))) + (x339 * x354))) + (x329 * x349) + (x340 * x354)));
+	const GEN_FLT x356 = x313 * ((x101 * x265) + (x273 * x314));
+	const GEN_FLT x357 = x104 * x356;
+	const GEN_FLT x358 = (x102 * (x357 + (-1 * x103 * x356))) + (x105 * x356);
+	const GEN_FLT x359 = (x102 * x358) + (x106 * x356);
+	const GEN_FLT x360 = (x265 * x97) + (x278 * x320);
+	const GEN_FLT x361 = x280 + (-1 * x319 * x360);
+	const GEN_FLT x362 = x280 + (-1 * x312 * (x360 + (x122 * x359) + (x327 * ((x118 * ((x102 * x359) + (x102 * (x359 +
+		(x102 * (x358 + (x102 * (x357 + (x112 * x356) + (-1 * x325 * x356))) + (x113 * x356))) + (x114 * x356))) +
+		(x107 * x356) + (x115 * x356))) + (x339 * x361))) + (x329 * x356) + (x340 * x361)));
+	const GEN_FLT x363 = x313 * ((x101 * x294) + (x302 * x314));
+	const GEN_FLT x364 = x104 * x363;
+	const GEN_FLT x365 = (x102 * (x364 + (-1 * x103 * x363))) + (x105 * x363);
+	const GEN_FLT x366 = (x102 * x365) + (x106 * x363);
+	const GEN_FLT x367 = (x294 * x97) + (x307 * x320);
+	const GEN_FLT x368 = x309 + (-1 * x319 * x367);
+	const GEN_FLT x369 = x309 + (-1 * x312 * (x367 + (x122 * x366) + (x327 * ((x118 * ((x102 * x366) + (x102 * (x366 +
+		(x102 * (x365 + (x102 * (x364 + (x112 * x363) + (-1 * x325 * x363))) + (x113 * x363))) + (x114 * x363))) +
+		(x107 * x363) + (x115 * x363))) + (x339 * x368))) + (x329 * x363) + (x340 * x368)));
+	const GEN_FLT x370 = -1 * x51;
+	const GEN_FLT x371 = x149 * x370;
+	const GEN_FLT x372 = x128 * x139;
+	const GEN_FLT x373 = x370 * x372;
+	const GEN_FLT x374 = x152 + (-1 * x146 * x371);
+	const GEN_FLT x375 = x373 * x72;
+	const GEN_FLT x376 = (x373 * x73) + (x70 * (x375 + (-1 * x373 * x71)));
+	const GEN_FLT x377 = (x373 * x74) + (x376 * x70);
+	const GEN_FLT x378 = x152 + (-1 * x126 * (x371 + (x159 * ((x177 * x374) + (x86 * ((x373 * x75) + (x373 * x83) +
+		(x377 * x70) + (x70 * (x377 + (x373 * x82) + (x70 * (x376 + (x373 * x81) + (x70 * (x375 + (x373 * x80) + (-1 *
+		x157 * x373))))))))))) + (x161 * x373) + (x178 * x374) + (x377 * x90)));
+	const GEN_FLT x379 = x146 * x62;
+	const GEN_FLT x380 = -1 * x57;
+	const GEN_FLT x381 = x128 * (x69 + (x139 * x380));
+	const GEN_FLT x382 = x381 * x72;
+	const GEN_FLT x383 = (x381 * x73) + (x70 * (x382 + (-1 * x381 * x71)));
+	const GEN_FLT x384 = (x381 * x74) + (x383 * x70);
+	const GEN_FLT x385 = x126 * (x62 + (x159 * ((-1 * x177 * x379) + (x78 * x85 * ((x381 * x75) + (x381 * x83) + (x384
+		* x70) + (x70 * (x384 + (x381 * x82) + (x70 * (x383 + (x381 * x81) + (x70 * (x382 + (x381 * x80) + (-1 * x157 *
+		x381))))))))))) + (x161 * x381) + (x384 * x90) + (-1 * x178 * x379));
+	const GEN_FLT x386 = x149 * x44;
+	const GEN_FLT x387 = x372 * x44;
+	const GEN_FLT x388 = (-1 * x151) + (-1 * x146 * x386);
+	const GEN_FLT x389 = x387 * x72;
+	const GEN_FLT x390 = (x387 * x73) + (x70 * (x389 + (-1 * x387 * x71)));
+	const GEN_FLT x391 = (x387 * x74) + (x390 * x70);
+	const GEN_FLT x392 = x151 + (x126 * (x386 + (x159 * ((x177 * x388) + (x86 * ((x387 * x75) + (x387 * x83) + (x391 *
+		x70) + (x70 * (x391 + (x387 * x82) + (x70 * (x390 + (x387 * x81) + (x70 * (x389 + (x387 * x80) + (-1 * x157 *
+		x387))))))))))) + (x161 * x387) + (x178 * x388) + (x391 * x90)));
+	const GEN_FLT x397 = x37 * c49;
+	const GEN_FLT x406 = x27 * c50;
+	const GEN_FLT x413 = x42 * c51;
+	const GEN_FLT x414 = x397 + x406 + x413;
+	const GEN_FLT x416 = x27 * c52;
+	const GEN_FLT x418 = x37 * c53;
+	const GEN_FLT x425 = x42 * c54;
+	const GEN_FLT x427 = x42 * c55;
+	const GEN_FLT x429 = x37 * c56;
+	const GEN_FLT x431 = x27 * c57;
+	const GEN_FLT x432 = (x133 * ((2 * x427) + (2 * x429) + (2 * x431))) + (x135 * ((-2 * x416) + (-2 * x418) + (-2 *
+		x425)));
+	const GEN_FLT x433 = (-1 * x432) + (-1 * x131 * ((2 * x397) + (2 * x406) + (2 * x413)));
+	const GEN_FLT x434 = x128 * ((x139 * x433) + (x414 * x69));
+	const GEN_FLT x435 = x434 * x72;
+	const GEN_FLT x436 = (x434 * x73) + (x70 * (x435 + (-1 * x434 * x71)));
+	const GEN_FLT x437 = (x434 * x74) + (x436 * x70);
+	const GEN_FLT x438 = -1 * x432;
+	const GEN_FLT x439 = (x149 * x438) + (x414 * x62);
+	const GEN_FLT x440 = (x151 * ((-1 * x416) + (-1 * x418) + (-1 * x425))) + (x152 * (x427 + x429 + x431));
+	const GEN_FLT x441 = x440 + (-1 * x146 * x439);
+	const GEN_FLT x442 = x440 + (-1 * x126 * (x439 + (x159 * ((x177 * x441) + (x86 * ((x434 * x75) + (x434 * x83) +
+		(x437 * x70) + (x70 * (x437 + (x434 * x82) + (x70 * (x436 + (x434 * x81) + (x70 * (x435 + (x434 * x80) + (-1 *
+		x157 * x434))))))))))) + (x161 * x434) + (x178 * x441) + (x437 * x90)));
+	const GEN_FLT x444 = x37 * c58;
+	const GEN_FLT x452 = x42 * c59;
+	const GEN_FLT x455 = x27 * c60;
+	const GEN_FLT x456 = x444 + x452 + x455;
+	const GEN_FLT x457 = x42 * c61;
+	const GEN_FLT x460 = x27 * c62;
+	const GEN_FLT x462 = x37 * c63;
+	const GEN_FLT x464 = x27 * c64;
+	const GEN_FLT x466 = x42 * c65;
+	const GEN_FLT x467 = x37 * c66;
+	const GEN_FLT x468 = (x133 * ((2 * x457) + (2 * x460) + (2 * x462))) + (x135 * ((-2 * x464) + (-2 * x466) + (-2 *
+		x467)));
+	const GEN_FLT x469 = (-1 * x468) + (-1 * x131 * ((2 * x444) + (2 * x452) + (2 * x455)));
+	const GEN_FLT x470 = x128 * ((x139 * x469) + (x456 * x69));
+	const GEN_FLT x471 = x470 * x72;
+	const GEN_FLT x472 = (x470 * x73) + (x70 * (x471 + (-1 * x470 * x71)));
+	const GEN_FLT x473 = (x470 * x74) + (x472 * x70);
+	const GEN_FLT x474 = -1 * x468;
+	const GEN_FLT x475 = (x149 * x474) + (x456 * x62);
+	const GEN_FLT x476 = (x151 * ((-1 * x464) + (-1 * x466) + (-1 * x467))) + (x152 * (x457 + x460 + x462));
+	const GEN_FLT x477 = x476 + (-1 * x146 * x475);
+	const GEN_FLT x478 = x476 + (-1 * x126 * (x475 + (x159 * ((x177 * x477) + (x86 * ((x470 * x75) + (x470 * x83) +
+		(x473 * x70) + (x70 * (x473 + (x470 * x82) + (x70 * (x472 + (x470 * x81) + (x70 * (x471 + (x470 * x80) + (-1 *
+		x157 * x470))))))))))) + (x161 * x470) + (x178 * x477) + (x473 * x90)));
+	const GEN_FLT x479 = x37 * c67;
+	const GEN_FLT x482 = x42 * c68;
+	const GEN_FLT x484 = x27 * c69;
+	const GEN_FLT x485 = x479 + x482 + x484;
+	const GEN_FLT x486 = x42 * c70;
+	const GEN_FLT x487 = x37 * c71;
+	const GEN_FLT x489 = x27 * c72;
+	const GEN_FLT x491 = x27 * c73;
+	const GEN_FLT x492 = x42 * c74;
+	const GEN_FLT x493 = x37 * c75;
+	const GEN_FLT x494 = (x133 * ((2 * x486) + (2 * x487) + (2 * x489))) + (x135 * ((-2 * x491) + (-2 * x492) + (-2 *
+		x493)));
+	const GEN_FLT x495 = (-1 * x494) + (-1 * x131 * ((2 * x479) + (2 * x482) + (2 * x484)));
+	const GEN_FLT x496 = x128 * ((x139 * x495) + (x485 * x69));
+	const GEN_FLT x497 = x496 * x72;
+	const GEN_FLT x498 = (x496 * x73) + (x70 * (x497 + (-1 * x496 * x71)));
+	const GEN_FLT x499 = (x496 * x74) + (x498 * x70);
+	const GEN_FLT x500 = -1 * x494;
+	const GEN_FLT x501 = (x149 * x500) + (x485 * x62);
+	const GEN_FLT x502 = (x151 * ((-1 * x491) + (-1 * x492) + (-1 * x493))) + (x152 * (x486 + x487 + x489));
+	const GEN_FLT x503 = x502 + (-1 * x146 * x501);
+	const GEN_FLT x504 = x502 + (-1 * x126 * (x501 + (x159 * ((x177 * x503) + (x86 * ((x496 * x75) + (x496 * x83) +
+		(x499 * x70) + (x70 * (x499 + (x496 * x82) + (x70 * (x498 + (x496 * x81) + (x70 * (x497 + (x496 * x80) + (-1 *
+		x157 * x496))))))))))) + (x161 * x496) + (x178 * x503) + (x499 * x90)));
+	const GEN_FLT x505 = x320 * x370;
+	const GEN_FLT x506 = x313 * x314;
+	const GEN_FLT x507 = x370 * x506;
+	const GEN_FLT x508 = x152 + (-1 * x319 * x505);
+	const GEN_FLT x509 = x104 * x507;
+	const GEN_FLT x510 = (x102 * (x509 + (-1 * x103 * x507))) + (x105 * x507);
+	const GEN_FLT x511 = (x102 * x510) + (x106 * x507);
+	const GEN_FLT x512 = x152 + (-1 * x312 * (x505 + (x122 * x511) + (x327 * ((x118 * ((x102 * x511) + (x102 * (x511 +
+		(x102 * (x510 + (x102 * (x509 + (x112 * x507) + (-1 * x325 * x507))) + (x113 * x507))) + (x114 * x507))) +
+		(x107 * x507) + (x115 * x507))) + (x339 * x508))) + (x329 * x507) + (x340 * x508)));
+	const GEN_FLT x513 = x319 * x97;
+	const GEN_FLT x514 = x313 * (x101 + (x314 * x380));
+	const GEN_FLT x515 = x104 * x514;
+	const GEN_FLT x516 = (x102 * (x515 + (-1 * x103 * x514))) + (x105 * x514);
+	const GEN_FLT x517 = (x102 * x516) + (x106 * x514);
+	const GEN_FLT x518 = x312 * (x97 + (x122 * x517) + (x327 * ((-1 * x339 * x513) + (x110 * x117 * ((x102 * x517) +
+		(x102 * (x517 + (x102 * (x516 + (x102 * (x515 + (x112 * x514) + (-1 * x325 * x514))) + (x113 * x514))) + (x114
+		* x514))) + (x107 * x514) + (x115 * x514))))) + (x329 * x514) + (-1 * x340 * x513));
+	const GEN_FLT x519 = x320 * x44;
+	const GEN_FLT x520 = x44 * x506;
+	const GEN_FLT x521 = (-1 * x151) + (-1 * x319 * x519);
+	const GEN_FLT x522 = x104 * x520;
+	const GEN_FLT x523 = (x102 * (x522 + (-1 * x103 * x520))) + (x105 * x520);
+	const GEN_FLT x524 = (x102 * x523) + (x106 * x520);
+	const GEN_FLT x525 = x151 + (x312 * (x519 + (x122 * x524) + (x327 * ((x118 * ((x102 * x524) + (x102 * (x524 + (x102
+		* (x523 + (x102 * (x522 + (x112 * x520) + (-1 * x325 * x520))) + (x113 * x520))) + (x114 * x520))) + (x107 *
+		x520) + (x115 * x520))) + (x339 * x521))) + (x329 * x520) + (x340 * x521)));
+	const GEN_FLT x526 = x313 * ((x101 * x414) + (x314 * x433));
+	const GEN_FLT x527 = x104 * x526;
+	const GEN_FLT x528 = (x102 * (x527 + (-1 * x103 * x526))) + (x105 * x526);
+	const GEN_FLT x529 = (x102 * x528) + (x106 * x526);
+	const GEN_FLT x530 = (x320 * x438) + (x414 * x97);
+	const GEN_FLT x531 = x440 + (-1 * x319 * x530);
+	const GEN_FLT x532 = x440 + (-1 * x312 * (x530 + (x122 * x529) + (x327 * ((x118 * ((x102 * x529) + (x102 * (x529 +
+		(x102 * (x528 + (x102 * (x527 + (x112 * x526) + (-1 * x325 * x526))) + (x113 * x526))) + (x114 * x526))) +
+		(x107 * x526) + (x115 * x526))) + (x339 * x531))) + (x329 * x526) + (x340 * x531)));
+	const GEN_FLT x533 = x313 * ((x101 * x456) + (x314 * x469));
+	const GEN_FLT x534 = x104 * x533;
+	const GEN_FLT x535 = (x102 * (x534 + (-1 * x103 * x533))) + (x105 * x533);
+	const GEN_FLT x536 = (x102 * x535) + (x106 * x533);
+	const GEN_FLT x537 = (x320 * x474) + (x456 * x97);
+	const GEN_FLT x538 = x476 + (-1 * x319 * x537);
+	const GEN_FLT x539 = x476 + (-1 * x312 * (x537 + (x122 * x536) + (x327 * ((x118 * ((x102 * x536) + (x102 * (x536 +
+		(x102 * (x535 + (x102 * (x534 + (x112 * x533) + (-1 * x325 * x533))) + (x113 * x533))) + (x114 * x533))) +
+		(x107 * x533) + (x115 * x533))) + (x339 * x538))) + (x329 * x533) + (x340 * x538)));
+	const GEN_FLT x540 = x313 * ((x101 * x485) + (x314 * x495));
+	const GEN_FLT x541 = x104 * x540;
+	const GEN_FLT x542 = (x102 * (x541 + (-1 * x103 * x540))) + (x105 * x540);
+	const GEN_FLT x543 = (x102 * x542) + (x106 * x540);
+	const GEN_FLT x544 = (x320 * x500) + (x485 * x97);
+	const GEN_FLT x545 = x502 + (-1 * x319 * x544);
+	const GEN_FLT x546 = x502 + (-1 * x312 * (x544 + (x122 * x543) + (x327 * ((x118 * ((x102 * x543) + (x102 * (x543 +
+		(x102 * (x542 + (x102 * (x541 + (x112 * x540) + (-1 * x325 * x540))) + (x113 * x540))) + (x114 * x540))) +
+		(x107 * x540) + (x115 * x540))) + (x339 * x545))) + (x329 * x540) + (x340 * x545)));
+	out[0] = c76 + (-1 * x92) + (-1 * x94) + (gibMag_0 * sin(x93));
+	out[1] = c77 + (-1 * x124) + (-1 * x94) + (gibMag_1 * sin(x125));
+	out[2] = x162 + (x162 * x164);
+	out[3] = x179 + (x164 * x179);
+	out[4] = x190 + (x164 * x190);
+	out[5] = x243 + (x164 * x243);
+	out[6] = x282 + (x164 * x282);
+	out[7] = x311 + (x164 * x311);
+	out[8] = x330 + (x330 * x332);
+	out[9] = x341 + (x332 * x341);
+	out[10] = x348 + (x332 * x348);
+	out[11] = x355 + (x332 * x355);
+	out[12] = x362 + (x332 * x362);
+	out[13] = x369 + (x332 * x369);
+	out[14] = x378 + (x164 * x378);
+	out[15] = (-1 * x385) + (-1 * x164 * x385);
+	out[16] = (-1 * x392) + (-1 * gibMag_0 * x163 * x392);
+	out[17] = x442 + (x164 * x442);
+	out[18] = x478 + (x164 * x478);
+	out[19] = x504 + (x164 * x504);
+	out[20] = x512 + (x332 * x512);
+	out[21] = (-1 * x518) + (-1 * x332 * x518);
+	out[22] = (-1 * x525) + (-1 * gibMag_1 * x331 * x525);
+	out[23] = x532 + (x332 * x532);
+	out[24] = x539 + (x332 * x539);
+	out[25] = x546 + (x332 * x546);
+}
+
+enum { gen_reproject_axis_x_gen2_axis_angle_prepared_size = 34 };
+
+static inline void gen_reproject_axis_x_gen2_axis_angle_prepare(FLT *prepared, const LinmathAxisAnglePose *obj_p,
+																const LinmathAxisAnglePose *lh_p,
+																const BaseStationCal *bsc0) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_0 = (*bsc0).phase;
+	const GEN_FLT tilt_0 = (*bsc0).tilt;
+	const GEN_FLT curve_0 = (*bsc0).curve;
+	const GEN_FLT gibPhase_0 = (*bsc0).gibpha;
+	const GEN_FLT gibMag_0 = (*bsc0).gibmag;
+	const GEN_FLT ogeeMag_0 = (*bsc0).ogeephase;
+	const GEN_FLT ogeePhase_0 = (*bsc0).ogeemag;
+	const GEN_FLT x0 = lh_qi * lh_qi;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qk * lh_qk;
+	const GEN_FLT x3 = 1e-10 + x0 + x1 + x2;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = cos(x4);
+	const GEN_FLT x6 = 1. / x3;
+	const GEN_FLT x7 = 1 + (-1 * x5);
+	const GEN_FLT x8 = x6 * x7;
+	const GEN_FLT x9 = obj_qi * obj_qi;
+	const GEN_FLT x10 = obj_qj * obj_qj;
+	const GEN_FLT x11 = obj_qk * obj_qk;
+	const GEN_FLT x12 = 1e-10 + x10 + x11 + x9;
+	const GEN_FLT x13 = sqrt(x12);
+	const GEN_FLT x14 = cos(x13);
+	const GEN_FLT x15 = 1. / x12;
+	const GEN_FLT x16 = 1 + (-1 * x14);
+	const GEN_FLT x17 = x15 * x16;
+	const GEN_FLT x18 = (1. / x13) * sin(x13);
+	const GEN_FLT x19 = obj_qi * x18;
+	const GEN_FLT x20 = obj_qk * x17;
+	const GEN_FLT x21 = obj_qj * x18;
+	const GEN_FLT x22 = obj_qi * x20;
+	const GEN_FLT x24 = (1. / x4) * sin(x4);
+	const GEN_FLT x25 = lh_qi * x24;
+	const GEN_FLT x26 = obj_qk * x18;
+	const GEN_FLT x27 = obj_qi * obj_qj * x17;
+	const GEN_FLT x29 = lh_qj * x24;
+	const GEN_FLT x30 = lh_qi * x8;
+	const GEN_FLT x31 = lh_qk * x30;
+	const GEN_FLT x34 = lh_qk * x24;
+	const GEN_FLT x35 = lh_qj * x30;
+	const GEN_FLT x38 = 0.523598775598299 + tilt_0;
+	const GEN_FLT x42 = cos(x38);
+	const GEN_FLT c0 = x22 + (-1 * x21);
+	const GEN_FLT c1 = x19 + (obj_qj * x20);
+	const GEN_FLT c2 = x14 + (x11 * x17);
+	const GEN_FLT c3 = x26 + x27;
+	const GEN_FLT c4 = x14 + (x10 * x17);
+	const GEN_FLT c5 = (-1 * x19) + (obj_qj * obj_qk * x15 * x16);
+	const GEN_FLT c6 = x14 + (x17 * x9);
+	const GEN_FLT c7 = x27 + (-1 * x26);
+	const GEN_FLT c8 = x21 + x22;
+	const GEN_FLT c9 = -1 * lh_pz;
+	const GEN_FLT c10 = x5 + (x2 * x8);
+	const GEN_FLT c11 = x25 + (lh_qj * lh_qk * x8);
+	const GEN_FLT c12 = x31 + (-1 * x29);
+	const GEN_FLT c13 = x29 + x31;
+	const GEN_FLT c14 = x35 + (-1 * x34);
+	const GEN_FLT c15 = x5 + (x0 * x8);
+	const GEN_FLT c16 = (-1 * x25) + (lh_qj * lh_qk * x6 * x7);
+	const GEN_FLT c17 = x5 + (x1 * x8);
+	const GEN_FLT c18 = x34 + x35;
+	const GEN_FLT c19 = tan(x38);
+	const GEN_FLT c20 = 1. / x42;
+	const GEN_FLT c21 = sin(x38);
+	const GEN_FLT c22 = -1 * phase_0;
+	prepared[0] = obj_px;
+	prepared[1] = obj_py;
+	prepared[2] = obj_pz;
+	prepared[3] = lh_px;
+	prepared[4] = lh_py;
+	prepared[5] = curve_0;
+	prepared[6] = gibPhase_0;
+	prepared[7] = gibMag_0;
+	prepared[8] = ogeeMag_0;
+	prepared[9] = ogeePhase_0;
+	prepared[10] = x42;
+	prepared[11] = c0;
+	prepared[12] = c1;
+	prepared[13] = c2;
+	prepared[14] = c3;
+	prepared[15] = c4;
+	prepared[16] = c5;
+	prepared[17] = c6;
+	prepared[18] = c7;
+	prepared[19] = c8;
+	prepared[20] = c9;
+	prepared[21] = c10;
+	prepared[22] = c11;
+	prepared[23] = c12;
+	prepared[24] = c13;
+	prepared[25] = c14;
+	prepared[26] = c15;
+	prepared[27] = c16;
+	prepared[28] = c17;
+	prepared[29] = c18;
+	prepared[30] = c19;
+	prepared[31] = c20;
+	prepared[32] = c21;
+	prepared[33] = c22;
+}
+
+static inline void gen_reproject_axis_x_gen2_axis_angle_eval(FLT *out, const FLT *prepared, const FLT *sensor_pt) {
+	const GEN_FLT obj_px = prepared[0];
+	const GEN_FLT obj_py = prepared[1];
+	const GEN_FLT obj_pz = prepared[2];
+	const GEN_FLT lh_px = prepared[3];
+	const GEN_FLT lh_py = prepared[4];
+	const GEN_FLT curve_0 = prepared[5];
+	const GEN_FLT gibPhase_0 = prepared[6];
+	const GEN_FLT gibMag_0 = prepared[7];
+	const GEN_FLT ogeeMag_0 = prepared[8];
+	const GEN_FLT ogeePhase_0 = prepared[9];
+	const GEN_FLT x42 = prepared[10];
+	const GEN_FLT c0 = prepared[11];
+	const GEN_FLT c1 = prepared[12];
+	const GEN_FLT c2 = prepared[13];
+	const GEN_FLT c3 = prepared[14];
+	const GEN_FLT c4 = prepared[15];
+	const GEN_FLT c5 = prepared[16];
+	const GEN_FLT c6 = prepared[17];
+	const GEN_FLT c7 = prepared[18];
+	const GEN_FLT c8 = prepared[19];
+	const GEN_FLT c9 = prepared[20];
+	const GEN_FLT c10 = prepared[21];
+	const GEN_FLT c11 = prepared[22];
+	const GEN_FLT c12 = prepared[23];
+	const GEN_FLT c13 = prepared[24];
+	const GEN_FLT c14 = prepared[25];
+	const GEN_FLT c15 = prepared[26];
+	const GEN_FLT c16 = prepared[27];
+	const GEN_FLT c17 = prepared[28];
+	const GEN_FLT c18 = prepared[29];
+	const GEN_FLT c19 = prepared[30];
+	const GEN_FLT c20 = prepared[31];
+	const GEN_FLT c21 = prepared[32];
+	const GEN_FLT c22 = prepared[33];
+	const GEN_FLT sensor_x = sensor_pt[0];
+	const GEN_FLT sensor_y = sensor_pt[1];
+	const GEN_FLT sensor_z = sensor_pt[2];
+	const GEN_FLT x23 = obj_pz + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLT x28 = obj_py + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLT x32 = obj_px + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLT x33 = c9 + (-1 * x23 * c10) + (-1 * x28 * c11) + (-1 * x32 * c12);
+	const GEN_FLT x36 = lh_px + (x23 * c13) + (x28 * c14) + (x32 * c15);
+	const GEN_FLT x37 = atan2(x33, x36);
+	const GEN_FLT x39 = lh_py + (x23 * c16) + (x28 * c17) + (x32 * c18);
+	const GEN_FLT x40 = (x33 * x33) + (x36 * x36);
+	const GEN_FLT x41 = x39 * (1. / sqrt(x40)) * c19;
+	const GEN_FLT x43 = asin(x39 * c20 * (1. / sqrt(x40 + (x39 * x39))));
+	const GEN_FLT x44 = curve_0 + (ogeePhase_0 * sin(ogeeMag_0 + x37 + (-1 * asin(x41))));
+	const GEN_FLT x45 = 0.0028679863 + (x43 * (-8.0108022e-06 + (-8.0108022e-06 * x43)));
+	const GEN_FLT x46 = 5.3685255e-06 + (x43 * x45);
+	const GEN_FLT x47 = 0.0076069798 + (x43 * x46);
+	const GEN_FLT x48 = asin(x41 + (x44 * x47 * (x43 * x43) * (1. / (x42 + (-1 * x44 * ((x43 * x47) + (x43 * (x47 +
+		(x43 * (x46 + (x43 * (x45 + (x43 * (-8.0108022e-06 + (-1.60216044e-05 * x43)))))))))) * c21)))));
+	out[0] = -1.5707963267949 + x37 + c22 + (-1 * x48) + (gibMag_0 * sin(gibPhase_0 + x37 + (-1 * x48)));
+}
+
+// Value of reproject_axis_x_gen2 then its jacobian wrt obj_p
+enum { gen_reproject_axis_x_gen2_val_jac_obj_p_axis_angle_prepared_size = 72 };
+
+static inline void gen_reproject_axis_x_gen2_val_jac_obj_p_axis_angle_prepare(FLT *prepared,
+																			  const LinmathAxisAnglePose *obj_p,
+																			  const LinmathAxisAnglePose *lh_p,
+																			  const BaseStationCal *bsc0) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_0 = (*bsc0).phase;
+	const GEN_FLT tilt_0 = (*bsc0).tilt;
+	const GEN_FLT curve_0 = (*bsc0).curve;
+	const GEN_FLT gibPhase_0 = (*bsc0).gibpha;
+	const GEN_FLT gibMag_0 = (*bsc0).gibmag;
+	const GEN_FLT ogeeMag_0 = (*bsc0).ogeephase;
+	const GEN_FLT ogeePhase_0 = (*bsc0).ogeemag;
+	const GEN_FLT x0 = lh_qi * lh_qi;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qk * lh_qk;
+	const GEN_FLT x3 = 1e-10 + x0 + x1 + x2;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = cos(x4);
+	const GEN_FLT x6 = (1. / x3) * (1 + (-1 * x5));
+	const GEN_FLT x7 = x2 * x6;
+	const GEN_FLT x8 = x5 + x7;
+	const GEN_FLT x9 = obj_qi * obj_qi;
+	const GEN_FLT x10 = obj_qj * obj_qj;
+	const GEN_FLT x11 = obj_qk * obj_qk;
+	const GEN_FLT x12 = 1e-10 + x10 + x11 + x9;
+	const GEN_FLT x13 = sqrt(x12);
+	const GEN_FLT x14 = cos(x13);
+	const GEN_FLT x15 = 1. / x12;
+	const GEN_FLT x16 = 1 + (-1 * x14);
+	const GEN_FLT x17 = x15 * x16;
+	const GEN_FLT x18 = sin(x13);
+	const GEN_FLT x19 = x18 * (1. / x13);
+	const GEN_FLT x20 = obj_qi * x19;
+	const GEN_FLT x21 = obj_qj * x17;
+	const GEN_FLT x22 = obj_qj * x19;
+	const GEN_FLT x23 = obj_qk * x17;
+	const GEN_FLT x24 = obj_qi * x23;
+	const GEN_FLT x26 = 1. / x4;
+	const GEN_FLT x27 = sin(x4);
+	const GEN_FLT x28 = x26 * x27;
+	const GEN_FLT x29 = lh_qi * x28;
+	const GEN_FLT x30 = lh_qj * lh_qk * x6;
+	const GEN_FLT x31 = x29 + x30;
+	const GEN_FLT x32 = obj_qk * x19;
+	const GEN_FLT x33 = obj_qi * x21;
+	const GEN_FLT x35 = lh_qj * x28;
+	const GEN_FLT x36 = lh_qi * x6;
+	const GEN_FLT x37 = lh_qk * x36;
+	const GEN_FLT x38 = x37 + (-1 * x35);
+	const GEN_FLT x42 = x0 * x6;
+	const GEN_FLT x43 = x42 + x5;
+	const GEN_FLT x44 = x35 + x37;
+	const GEN_FLT x45 = lh_qk * x28;
+	const GEN_FLT x46 = lh_qj * x36;
+	const GEN_FLT x47 = x46 + (-1 * x45);
+	const GEN_FLT x50 = x1 * x6;
+	const GEN_FLT x51 = x5 + x50;
+	const GEN_FLT x52 = x45 + x46;
+	const GEN_FLT x53 = x30 + (-1 * x29);
+	const GEN_FLT x56 = 0.523598775598299 + tilt_0;
+	const GEN_FLT x57 = tan(x56);
+	const GEN_FLT x62 = cos(x56);
+	const GEN_FLT x63 = 1. / x62;
+	const GEN_FLT x80 = sin(x56);
+	const GEN_FLT x91 = 2 * x45;
+	const GEN_FLT x92 = 2 * x46;
+	const GEN_FLT x94 = 2 * x5;
+	const GEN_FLT x96 = 2 * x37;
+	const GEN_FLT x121 = 2 * x29;
+	const GEN_FLT x122 = 2 * x30;
+	const GEN_FLT x143 = 1. / (x12 * sqrt(x12));
+	const GEN_FLT x144 = 2 * x16 * (1. / (x12 * x12));
+	const GEN_FLT x145 = obj_qi * x144;
+	const GEN_FLT x146 = x10 * x145;
+	const GEN_FLT x147 = x14 * x15;
+	const GEN_FLT x148 = x143 * x18;
+	const GEN_FLT x149 = x148 * x9;
+	const GEN_FLT x150 = x19 + (-1 * x149) + (x147 * x9);
+	const GEN_FLT x151 = obj_qi * obj_qk;
+	const GEN_FLT x152 = obj_qj * x144;
+	const GEN_FLT x153 = x151 * x152;
+	const GEN_FLT x154 = x153 + (-1 * obj_qi * obj_qj * obj_qk * x143 * x18);
+	const GEN_FLT x155 = x144 * x9;
+	const GEN_FLT x156 = obj_qj * x155;
+	const GEN_FLT x157 = x21 + (-1 * x156) + (obj_qj * x149);
+	const GEN_FLT x158 = x147 * x151;
+	const GEN_FLT x159 = x148 * x151;
+	const GEN_FLT x160 = x158 + (-1 * x159);
+	const GEN_FLT x163 = x11 * x145;
+	const GEN_FLT x164 = (-1 * x153) + (obj_qj * x159);
+	const GEN_FLT x165 = obj_qk * x155;
+	const GEN_FLT x166 = x23 + (-1 * x165) + (obj_qk * x149);
+	const GEN_FLT x167 = obj_qi * obj_qj;
+	const GEN_FLT x168 = x148 * x167;
+	const GEN_FLT x169 = x147 * x167;
+	const GEN_FLT x170 = x168 + (-1 * x169);
+	const GEN_FLT x173 = obj_qi * obj_qi * obj_qi;
+	const GEN_FLT x174 = x159 + (-1 * x158);
+	const GEN_FLT x175 = x169 + (-1 * x168);
+	const GEN_FLT x194 = x164 + x19;
+	const GEN_FLT x195 = x10 * x148;
+	const GEN_FLT x196 = (-1 * x195) + (x10 * x147);
+	const GEN_FLT x197 = obj_qi * x17;
+	const GEN_FLT x198 = x197 + (-1 * x146) + (obj_qi * x195);
+	const GEN_FLT x199 = obj_qj * obj_qk;
+	const GEN_FLT x200 = x148 * x199;
+	const GEN_FLT x201 = x147 * x199;
+	const GEN_FLT x202 = x200 + (-1 * x201);
+	const GEN_FLT x205 = x11 * x152;
+	const GEN_FLT x206 = x154 + x19;
+	const GEN_FLT x207 = obj_qk * x10 * x144;
+	const GEN_FLT x208 = x23 + (-1 * x207) + (obj_qk * x195);
+	const GEN_FLT x211 = obj_qj * obj_qj * obj_qj;
+	const GEN_FLT x212 = x201 + (-1 * x200);
+	const GEN_FLT x231 = x11 * x148;
+	const GEN_FLT x232 = (-1 * x231) + (x11 * x147);
+	const GEN_FLT x233 = x21 + (-1 * x205) + (obj_qj * x231);
+	const GEN_FLT x236 = x197 + (-1 * x163) + (obj_qi * x231);
+	const GEN_FLT x239 = obj_qk * obj_qk * obj_qk;
+	const GEN_FLT c0 = x24 + (-1 * x22);
+	const GEN_FLT c1 = x20 + (obj_qk * x21);
+	const GEN_FLT c2 = x14 + (x11 * x17);
+	const GEN_FLT c3 = x32 + x33;
+	const GEN_FLT c4 = x14 + (x10 * x17);
+	const GEN_FLT c5 = (-1 * x20) + (obj_qj * obj_qk * x15 * x16);
+	const GEN_FLT c6 = x14 + (x17 * x9);
+	const GEN_FLT c7 = x33 + (-1 * x32);
+	const GEN_FLT c8 = x22 + x24;
+	const GEN_FLT c9 = 1. / (x62 * x62);
+	const GEN_FLT c10 = x94 + (2 * x42);
+	const GEN_FLT c11 = (-1 * x96) + (2 * lh_qj * x26 * x27);
+	const GEN_FLT c12 = x91 + x92;
+	const GEN_FLT c13 = x57 * x57;
+	const GEN_FLT c14 = x92 + (-1 * x91);
+	const GEN_FLT c15 = (-1 * x121) + (-1 * x122);
+	const GEN_FLT c16 = x94 + (2 * x50);
+	const GEN_FLT c17 = x96 + (2 * x35);
+	const GEN_FLT c18 = (-1 * x94) + (-2 * x7);
+	const GEN_FLT c19 = x122 + (-1 * x121);
+	const GEN_FLT c20 = x157 + x160;
+	const GEN_FLT c21 = (-1 * x146) + (-1 * x20) + (obj_qi * x10 * x143 * x18);
+	const GEN_FLT c22 = (-1 * x150) + (-1 * x154);
+	const GEN_FLT c23 = x166 + x170;
+	const GEN_FLT c24 = x150 + x164;
+	const GEN_FLT c25 = (-1 * x163) + (-1 * x20) + (obj_qi * x11 * x143 * x18);
+	const GEN_FLT c26 = (-1 * x20) + (-1 * x144 * x173) + (x143 * x173 * x18) + (2 * obj_qi * x15 * x16);
+	const GEN_FLT c27 = x157 + x174;
+	const GEN_FLT c28 = x166 + x175;
+	const GEN_FLT c29 = (-1 * x156) + (-1 * x22) + (obj_qj * x143 * x18 * x9);
+	const GEN_FLT c30 = x198 + x202;
+	const GEN_FLT c31 = x194 + x196;
+	const GEN_FLT c32 = (-1 * x196) + (-1 * x206);
+	const GEN_FLT c33 = x175 + x208;
+	const GEN_FLT c34 = (-1 * x205) + (-1 * x22) + (obj_qj * x11 * x143 * x18);
+	const GEN_FLT c35 = x198 + x212;
+	const GEN_FLT c36 = (-1 * x22) + (-1 * x144 * x211) + (x143 * x18 * x211) + (2 * obj_qj * x15 * x16);
+	const GEN_FLT c37 = x170 + x208;
+	const GEN_FLT c38 = x194 + x232;
+	const GEN_FLT c39 = (-1 * x207) + (-1 * x32) + (obj_qk * x10 * x143 * x18);
+	const GEN_FLT c40 = x174 + x233;
+	const GEN_FLT c41 = (-1 * x165) + (-1 * x32) + (obj_qk * x143 * x18 * x9);
+	const GEN_FLT c42 = (-1 * x206) + (-1 * x232);
+	const GEN_FLT c43 = x212 + x236;
+	const GEN_FLT c44 = x202 + x236;
+	const GEN_FLT c45 = x160 + x233;
+	const GEN_FLT c46 = (-1 * x32) + (-1 * x144 * x239) + (x143 * x18 * x239) + (2 * obj_qk * x15 * x16);
+	const GEN_FLT c47 = -1 * phase_0;
+	prepared[0] = obj_px;
+	prepared[1] = obj_py;
+	prepared[2] = obj_pz;
+	prepared[3] = lh_px;
+	prepared[4] = lh_py;
+	prepared[5] = lh_pz;
+	prepared[6] = curve_0;
+	prepared[7] = gibPhase_0;
+	prepared[8] = gibMag_0;
+	prepared[9] = ogeeMag_0;
+	prepared[10] = ogeePhase_0;
+	prepared[11] = x8;
+	prepared[12] = x31;
+	prepared[13] = x38;
+	prepared[14] = x43;
+	prepared[15] = x44;
+	prepared[16] = x47;
+	prepared[17] = x51;
+	prepared[18] = x52;
+	prepared[19] = x53;
+	prepared[20] = x57;
+	prepared[21] = x62;
+	prepared[22] = x63;
+	prepared[23] = x80;
+	prepared[24] = c0;
+	prepared[25] = c1;
+	prepared[26] = c2;
+	prepared[27] = c3;
+	prepared[28] = c4;
+	prepared[29] = c5;
+	prepared[30] = c6;
+	prepared[31] = c7;
+	prepared[32] = c8;
+	prepared[33] = c9;
+	prepared[34] = c10;
+	prepared[35] = c11;
+	prepared[36] = c12;
+	prepared[37] = c13;
+	prepared[38] = c14;
+	prepared[39] = c15;
+	prepared[40] = c16;
+	prepared[41] = c17;
+	prepared[42] = c18;
+	prepared[43] = c19;
+	prepared[44] = c20;
+	prepared[45] = c21;
+	prepared[46] = c22;
+	prepared[47] = c23;
+	prepared[48] = c24;
+	prepared[49] = c25;
+	prepared[50] = c26;
+	prepared[51] = c27;
+	prepared[52] = c28;
+	prepared[53] = c29;
+	prepared[54] = c30;
+	prepared[55] = c31;
+	prepared[56] = c32;
+	prepared[57] = c33;
+	prepared[58] = c34;
+	prepared[59] = c35;
+	prepared[60] = c36;
+	prepared[61] = c37;
+	prepared[62] = c38;
+	prepared[63] = c39;
+	prepared[64] = c40;
+	prepared[65] = c41;
+	prepared[66] = c42;
+	prepared[67] = c43;
+	prepared[68] = c44;
+	prepared[69] = c45;
+	prepared[70] = c46;
+	prepared[71] = c47;
+}
+
+static inline void gen_reproject_axis_x_gen2_val_jac_obj_p_axis_angle_eval(FLT *out, const FLT *prepared,
+																		   const FLT *sensor_pt) {
+	const GEN_FLT obj_px = prepared[0];
+	const GEN_FLT obj_py = prepared[1];
+	const GEN_FLT obj_pz = prepared[2];
+	const GEN_FLT lh_px = prepared[3];
+	const GEN_FLT lh_py = prepared[4];
+	const GEN_FLT lh_pz = prepared[5];
+	const GEN_FLT curve_0 = prepared[6];
+	const GEN_FLT gibPhase_0 = prepared[7];
+	const GEN_FLT gibMag_0 = prepared[8];
+	const GEN_FLT ogeeMag_0 = prepared[9];
+	const GEN_FLT ogeePhase_0 = prepared[10];
+	const GEN_FLT x8 = prepared[11];
+	const GEN_FLT x31 = prepared[12];
+	const GEN_FLT x38 = prepared[13];
+	const GEN_FLT x43 = prepared[14];
+	const GEN_FLT x44 = prepared[15];
+	const GEN_FLT x47 = prepared[16];
+	const GEN_FLT x51 = prepared[17];
+	const GEN_FLT x52 = prepared[18];
+	const GEN_FLT x53 = prepared[19];
+	const GEN_FLT x57 = prepared[20];
+	const GEN_FLT x62 = prepared[21];
+	const GEN_FLT x63 = prepared[22];
+	const GEN_FLT x80 = prepared[23];
+	const GEN_FLT c0 = prepared[24];
+	const GEN_FLT c1 = prepared[25];
+	const GEN_FLT c2 = prepared[26];
+	const GEN_FLT c3 = prepared[27];
+	const GEN_FLT c4 = prepared[28];
+	const GEN_FLT c5 = prepared[29];
+	const GEN_FLT c6 = prepared[30];
+	const GEN_FLT c7 = prepared[31];
+	const GEN_FLT c8 = prepared[32];
+	const GEN_FLT c9 = prepared[33];
+	const GEN_FLT c10 = prepared[34];
+	const GEN_FLT c11 = prepared[35];
+	const GEN_FLT c12 = prepared[36];
+	const GEN_FLT c13 = prepared[37];
+	const GEN_FLT c14 = prepared[38];
+	const GEN_FLT c15 = prepared[39];
+	const GEN_FLT c16 = prepared[40];
+	const GEN_FLT c17 = prepared[41];
+	const GEN_FLT c18 = prepared[42];
+	const GEN_FLT c19 = prepared[43];
+	const GEN_FLT c20 = prepared[44];
+	const GEN_FLT c21 = prepared[45];
+	const GEN_FLT c22 = prepared[46];
+	const GEN_FLT c23 = prepared[47];
+	const GEN_FLT c24 = prepared[48];
+	const GEN_FLT c25 = prepared[49];
+	const GEN_FLT c26 = prepared[50];
+	const GEN_FLT c27 = prepared[51];
+	const GEN_FLT c28 = prepared[52];
+	const GEN_FLT c29 = prepared[53];
+	const GEN_FLT c30 = prepared[54];
+	const GEN_FLT c31 = prepared[55];
+	const GEN_FLT c32 = prepared[56];
+	const GEN_FLT c33 = prepared[57];
+	const GEN_FLT c34 = prepared[58];
+	const GEN_FLT c35 = prepared[59];
+	const GEN_FLT c36 = prepared[60];
+	const GEN_FLT c37 = prepared[61];
+	const GEN_FLT c38 = prepared[62];
+	const GEN_FLT c39 = prepared[63];
+	const GEN_FLT c40 = prepared[64];
+	const GEN_FLT c41 = prepared[65];
+	const GEN_FLT c42 = prepared[66];
+	const GEN_FLT c43 = prepared[67];
+	const GEN_FLT c44 = prepared[68];
+	const GEN_FLT c45 = prepared[69];
+	const GEN_FLT c46 = prepared[70];
+	const GEN_FLT c47 = prepared[71];
+	const GEN_FLT sensor_x = sensor_pt[0];
+	const GEN_FLT sensor_y = sensor_pt[1];
+	const GEN_FLT sensor_z = sensor_pt[2];
+	const GEN_FLT x25 = obj_pz + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLT x34 = obj_py + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLT x39 = obj_px + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLT x40 = lh_pz + (x25 * x8) + (x31 * x34) + (x38 * x39);
+	const GEN_FLT x41 = -1 * x40;
+	const GEN_FLT x48 = lh_px + (x25 * x44) + (x34 * x47) + (x39 * x43);
+	const GEN_FLT x49 = atan2(x41, x48);
+	const GEN_FLT x54 = lh_py + (x25 * x53) + (x34 * x51) + (x39 * x52);
+	const GEN_FLT x55 = (x41 * x41) + (x48 * x48);
+	const GEN_FLT x58 = x57 * (1. / sqrt(x55));
+	const GEN_FLT x59 = x54 * x58;
+	const GEN_FLT x60 = x54 * x54;
+	const GEN_FLT x61 = x55 + x60;
+	const GEN_FLT x64 = x63 * (1. / sqrt(x61));
+	const GEN_FLT x65 = asin(x54 * x64);
+	const GEN_FLT x66 = 8.0108022e-06 * x65;
+	const GEN_FLT x67 = -8.0108022e-06 + (-1 * x66);
+	const GEN_FLT x68 = 0.0028679863 + (x65 * x67);
+	const GEN_FLT x69 = 5.3685255e-06 + (x65 * x68);
+	const GEN_FLT x70 = 0.0076069798 + (x65 * x69);
+	const GEN_FLT x71 = x65 * x65;
+	const GEN_FLT x72 = ogeeMag_0 + x49 + (-1 * asin(x59));
+	const GEN_FLT x73 = curve_0 + (ogeePhase_0 * sin(x72));
+	const GEN_FLT x74 = x65 * x70;
+	const GEN_FLT x75 = -8.0108022e-06 + (-1.60216044e-05 * x65);
+	const GEN_FLT x76 = x68 + (x65 * x75);
+	const GEN_FLT x77 = x69 + (x65 * x76);
+	const GEN_FLT x78 = x70 + (x65 * x77);
+	const GEN_FLT x79 = x74 + (x65 * x78);
+	const GEN_FLT x81 = x73 * x80;
+	const GEN_FLT x82 = x62 + (-1 * x79 * x81);
+	const GEN_FLT x83 = 1. / x82;
+	const GEN_FLT x84 = x73 * x83;
+	const GEN_FLT x85 = x71 * x84;
+	const GEN_FLT x86 = x59 + (x70 * x85);
+	const GEN_FLT x87 = asin(x86);
+	const GEN_FLT x88 = gibPhase_0 + x49 + (-1 * x87);
+	const GEN_FLT x89 = 1. / sqrt(1 + (-1 * (x86 * x86)));
+	const GEN_FLT x90 = 1. / sqrt(1 + (-1 * x60 * (1. / x61) * c9));
+	const GEN_FLT x93 = 1.0/2.0 * x54;
+	const GEN_FLT x95 = 1.0/2.0 * x48;
+	const GEN_FLT x97 = 1.0/2.0 * x41;
+	const GEN_FLT x98 = (x95 * c10) + (x97 * c11);
+	const GEN_FLT x99 = x54 * x63 * (1. / (x61 * sqrt(x61)));
+	const GEN_FLT x100 = x90 * ((x52 * x64) + (x99 * ((-1 * x98) + (-1 * x93 * c12))));
+	const GEN_FLT x101 = x100 * x67;
+	const GEN_FLT x102 = (x100 * x68) + (x65 * (x101 + (-1 * x100 * x66)));
+	const GEN_FLT x103 = (x100 * x69) + (x102 * x65);
+	const GEN_FLT x104 = 1. / x55;
+	const GEN_FLT x105 = 1. / sqrt(1 + (-1 * x104 * x60 * c13));
+	const GEN_FLT x106 = x54 * x57 * (1. / (x55 * sqrt(x55)));
+	const GEN_FLT x107 = (x52 * x58) + (-1 * x106 * x98);
+	const GEN_FLT x108 = x104 * x48;
+	const GEN_FLT x109 = x104 * x40;
+	const GEN_FLT x110 = (x109 * x43) + (-1 * x108 * x38);
+	const GEN_FLT x111 = ogeePhase_0 * cos(x72);
+	const GEN_FLT x112 = x111 * (x110 + (-1 * x105 * x107));
+	const GEN_FLT x113 = x79 * x80;
+	const GEN_FLT x114 = 2.40324066e-05 * x65;
+	const GEN_FLT x115 = x70 * x71;
+	const GEN_FLT x116 = x115 * x73 * (1. / (x82 * x82));
+	const GEN_FLT x117 = x115 * x83;
+	const GEN_FLT x118 = 2 * x74 * x84;
+	const GEN_FLT x119 = x110 + (-1 * x89 * (x107 + (x100 * x118) + (x103 * x85) + (x112 * x117) + (x116 * ((x112 *
+		x113) + (x81 * ((x100 * x70) + (x100 * x78) + (x103 * x65) + (x65 * (x103 + (x100 * x77) + (x65 * (x102 + (x100
+		* x76) + (x65 * (x101 + (x100 * x75) + (-1 * x100 * x114)))))))))))));
+	const GEN_FLT x120 = gibMag_0 * cos(x88);
+	const GEN_FLT x123 = (x95 * c14) + (x97 * c15);
+	const GEN_FLT x124 = x90 * ((x51 * x64) + (x99 * ((-1 * x123) + (-1 * x93 * c16))));
+	const GEN_FLT x125 = x124 * x67;
+	const GEN_FLT x126 = (x124 * x68) + (x65 * (x125 + (-1 * x124 * x66)));
+	const GEN_FLT x127 = (x124 * x69) + (x126 * x65);
+	const GEN_FLT x128 = (x51 * x58) + (-1 * x106 * x123);
+	const GEN_FLT x129 = (x109 * x47) + (-1 * x108 * x31);
+	const GEN_FLT x130 = x129 + (-1 * x105 * x128);
+	const GEN_FLT x131 = x111 * x113;
+	const GEN_FLT x132 = x111 * x117;
+	const GEN_FLT x133 = x129 + (-1 * x89 * (x128 + (x116 * ((x130 * x131) + (x81 * ((x124 * x70) + (x124 * x78) +
+		(x127 * x65) + (x65 * (x127 + (x124 * x77) + (x65 * (x126 + (x124 * x76) + (x65 * (x125 + (x124 * x75) + (-1 *
+		x114 * x124))))))))))) + (x118 * x124) + (x127 * x85) + (x130 * x132)));
+	const GEN_FLT x134 = (x95 * c17) + (x97 * c18);
+	const GEN_FLT x135 = x90 * ((x53 * x64) + (x99 * ((-1 * x134) + (-1 * x93 * c19))));
+	const GEN_FLT x136 = x135 * x67;
+	const GEN_FLT x137 = (x135 * x68) + (x65 * (x136 + (-1 * x135 * x66)));
+	const GEN_FLT x138 = (x135 * x69) + (x137 * x65);
+	const GEN_FLT x139 = (x53 * x58) + (-1 * x106 * x134);
+	const GEN_FLT x140 = (x109 * x44) + (-1 * x108 * x8);
+	const GEN_FLT x141 = x140 + (-1 * x105 * x139);
+	const GEN_FLT x142 = x140 + (-1 * x89 * (x139 + (x116 * ((x131 * x141) + (x81 * ((x135 * x70) + (x135 * x78) +
+		(x138 * x65) + (x65 * (x138 + (x135 * x77) + (x65 * (x137 + (x135 * x76) + (x65 * (x136 + (x135 * x75) + (-1 *
+		x114 * x135))))))))))) + (x118 * x135) + (x132 * x141) + (x138 * x85)));
+	const GEN_FLT x161 = (sensor_x * c20) + (sensor_y * c21) + (sensor_z * c22);
+	const GEN_FLT x162 = x161 * x51;
+	const GEN_FLT x171 = (sensor_x * c23) + (sensor_y * c24) + (sensor_z * c25);
+	const GEN_FLT x172 = x171 * x53;
+	const GEN_FLT x176 = (sensor_x * c26) + (sensor_y * c27) + (sensor_z * c28);
+	const GEN_FLT x177 = x176 * x52;
+	const GEN_FLT x178 = x162 + x172 + x177;
+	const GEN_FLT x179 = x171 * x44;
+	const GEN_FLT x180 = x161 * x47;
+	const GEN_FLT x181 = x176 * x43;
+	const GEN_FLT x182 = x171 * x8;
+	const GEN_FLT x183 = x161 * x31;
+	const GEN_FLT x184 = x176 * x38;
+	const GEN_FLT x185 = (x95 * ((2 * x179) + (2 * x180) + (2 * x181))) + (x97 * ((-2 * x182) + (-2 * x183) + (-2 *
+		x184)));
+	const GEN_FLT x186 = x90 * ((x178 * x64) + (x99 * ((-1 * x185) + (-1 * x93 * ((2 * x162) + (2 * x172) + (2 *
+		x177))))));
+	const GEN_FLT x187 = x186 * x67;
+	const GEN_FLT x188 = (x186 * x68) + (x65 * (x187 + (-1 * x186 * x66)));
+	const GEN_FLT x189 = (x186 * x69) + (x188 * x65);
+	const GEN_FLT x190 = (x178 * x58) + (-1 * x106 * x185);
+	const GEN_FLT x191 = (x108 * ((-1 * x182) + (-1 * x183) + (-1 * x184))) + (x109 * (x179 + x180 + x181));
+	const GEN_FLT x192 = x191 + (-1 * x105 * x190);
+	const GEN_FLT x193 = x191 + (-1 * x89 * (x190 + (x116 * ((x131 * x192) + (x81 * ((x186 * x70) + (x186 * x78) +
+		(x189 * x65) + (x65 * (x189 + (x186 * x77) + (x65 * (x188 + (x186 * x76) + (x65 * (x187 + (x186 * x75) + (-1 *
+		x114 * x186))))))))))) + (x118 * x186) + (x132 * x192) + (x189 * x85)));
+	const GEN_FLT x203 = (sensor_x * c29) + (sensor_y * c30) + (sensor_z * c31);
+	const GEN_FLT x204 = x203 * x52;
+	const GEN_FLT x209 = (sensor_x * c32) + (sensor_y * c33) + (sensor_z * c34);
+	const GEN_FLT x210 = x209 * x53;
+	const GEN_FLT x213 = (sensor_x * c35) + (sensor_y * c36) + (sensor_z * c37);
+	const GEN_FLT x214 = x213 * x51;
+	const GEN_FLT x215 = x204 + x210 + x214;
+	const GEN_FLT x216 = x203 * x43;
+	const GEN_FLT x217 = x209 * x44;
+	const GEN_FLT x218 = x213 * x47;
+	const GEN_FLT x219 = x209 * x8;
+	const GEN_FLT x220 = x203 * x38;
+	const GEN_FLT x221 = x213 * x31;
+	const GEN_FLT x222 = (x95 * ((2 * x216) + (2 * x217) + (2 * x218))) + (x97 * ((-2 * x219) + (-2 * x220) + (-2 *
+		x221)));
+	const GEN_FLT x223 = x90 * ((x215 * x64) + (x99 * ((-1 * x222) + (-1 * x93 * ((2 * x204) + (2 * x210) + (2 *
+		x214))))));
+	const GEN_FLT x224 = x223 * x67;
+	const GEN_FLT x225 = (x223 * x68) + (x65 * (x224 + (-1 * x223 * x66)));
+	const GEN_FLT x226 = (x223 * x69) + (x225 * x65);
+	const GEN_FLT x227 = (x215 * x58) + (-1 * x106 * x222);
+	const GEN_FLT x228 = (x108 * ((-1 * x219) + (-1 * x220) + (-1 * x221))) + (x109 * (x216 + x217 + x218));
+	const GEN_FLT x229 = x228 + (-1 * x105 * x227);
+	const GEN_FLT x230 = x228 + (-1 * x89 * (x227 + (x116 * ((x131 * x229) + (x81 * ((x223 * x70) + (x223 * x78) +
+		(x226 * x65) + (x65 * (x226 + (x223 * x77) + (x65 * (x225 + (x223 * x76) + (x65 * (x224 + (x223 * x75) + (-1 *
+		x114 * x223))))))))))) + (x118 * x223) + (x132 * x229) + (x226 * x85)));
+	const GEN_FLT x234 = (sensor_x * c38) + (sensor_y * c39) + (sensor_z * c40);
+	const GEN_FLT x235 = x234 * x51;
+	const GEN_FLT x237 = (sensor_x * c41) + (sensor_y * c42) + (sensor_z * c43);
+	const GEN_FLT x238 = x237 * x52;
+	const GEN_FLT x240 = (sensor_x * c44) + (sensor_y * c45) + (sensor_z * c46);
+	const GEN_FLT x241 = x240 * x53;
+	const GEN_FLT x242 = x235 + x238 + x241;
+	const GEN_FLT x243 = x237 * x43;
+	const GEN_FLT x244 = x234 * x47;
+	const GEN_FLT x245 = x240 * x44;
+	const GEN_FLT x246 = x234 * x31;
+	const GEN_FLT x247 = x237 * x38;
+	const GEN_FLT x248 = x240 * x8;
+	const GEN_FLT x249 = (x95 * ((2 * x243) + (2 * x244) + (2 * x245))) + (x97 * ((-2 * x246) + (-2 * x247) + (-2 *
+		x248)));
+	const GEN_FLT x250 = x90 * ((x242 * x64) + (x99 * ((-1 * x249) + (-1 * x93 * ((2 * x235) + (2 * x238) + (2 *
+		x241))))));
+	const GEN_FLT x251 = x250 * x67;
+	const GEN_FLT x252 = (x250 * x68) + (x65 * (x251 + (-1 * x250 * x66)));
+	const GEN_FLT x253 = (x250 * x69) + (x252 * x65);
+	const GEN_FLT x254 = (x242 * x58) + (-1 * x106 * x249);
+	const GEN_FLT x255 = (x108 * ((-1 * x246) + (-1 * x247) + (-1 * x248))) + (x109 * (x243 + x244 + x245));
+	const GEN_FLT x256 = x255 + (-1 * x105 * x254);
+	const GEN_FLT x257 = x255 + (-1 * x89 * (x254 + (x116 * ((x131 * x256) + (x81 * ((x250 * x70) + (x250 * x78) +
+		(x253 * x65) + (x65 * (x253 + (x250 * x77) + (x65 * (x252 + (x250 * x76) + (x65 * (x251 + (x250 * x75) + (-1 *
+		x114 * x250))))))))))) + (x118 * x250) + (x132 * x256) + (x253 * x85)));
+	out[0] = -1.5707963267949 + x49 + c47 + (-1 * x87) + (gibMag_0 * sin(x88));
+	out[1] = x119 + (x119 * x120);
+	out[2] = x133 + (x120 * x133);
+	out[3] = x142 + (x120 * x142);
+	out[4] = x193 + (x120 * x193);
+	out[5] = x230 + (x120 * x230);
+	out[6] = x257 + (x120 * x257);
+}
+
+// Value of reproject_axis_x_gen2 then its jacobian wrt obj_p, lh_p
+enum { gen_reproject_axis_x_gen2_val_jac_obj_p_lh_p_axis_angle_prepared_size = 99 };
+
+static inline void gen_reproject_axis_x_gen2_val_jac_obj_p_lh_p_axis_angle_prepare(FLT *prepared,
+																				   const LinmathAxisAnglePose *obj_p,
+																				   const LinmathAxisAnglePose *lh_p,
+																				   const BaseStationCal *bsc0) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_0 = (*bsc0).phase;
+	const GEN_FLT tilt_0 = (*bsc0).tilt;
+	const GEN_FLT curve_0 = (*bsc0).curve;
+	const GEN_FLT gibPhase_0 = (*bsc0).gibpha;
+	const GEN_FLT gibMag_0 = (*bsc0).gibmag;
+	const GEN_FLT ogeeMag_0 = (*bsc0).ogeephase;
+	const GEN_FLT ogeePhase_0 = (*bsc0).ogeemag;
+	const GEN_FLT x0 = lh_qi * lh_qi;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qk * lh_qk;
+	const GEN_FLT x3 = 1e-10 + x0 + x1 + x2;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = cos(x4);
+	const GEN_FLT x6 = 1. / x3;
+	const GEN_FLT x7 = 1 + (-1 * x5);
+	const GEN_FLT x8 = x6 * x7;
+	const GEN_FLT x9 = x2 * x8;
+	const GEN_FLT x10 = x5 + x9;
+	const GEN_FLT x11 = obj_qi * obj_qi;
+	const GEN_FLT x12 = obj_qj * obj_qj;
+	const GEN_FLT x13 = obj_qk * obj_qk;
+	const GEN_FLT x14 = 1e-10 + x11 + x12 + x13;
+	const GEN_FLT x15 = sqrt(x14);
+	const GEN_FLT x16 = cos(x15);
+	const GEN_FLT x17 = 1. / x14;
+	const GEN_FLT x18 = 1 + (-1 * x16);
+	const GEN_FLT x19 = x17 * x18;
+	const GEN_FLT x20 = sin(x15);
+	const GEN_FLT x21 = x20 * (1. / x15);
+	const GEN_FLT x22 = obj_qi * x21;
+	const GEN_FLT x23 = obj_qj * x19;
+	const GEN_FLT x24 = obj_qj * x21;
+	const GEN_FLT x25 = obj_qk * x19;
+	const GEN_FLT x26 = obj_qi * x25;
+	const GEN_FLT x28 = 1. / x4;
+	const GEN_FLT x29 = sin(x4);
+	const GEN_FLT x30 = x28 * x29;
+	const GEN_FLT x31 = lh_qi * x30;
+	const GEN_FLT x32 = lh_qj * x8;
+	const GEN_FLT x33 = lh_qk * x32;
+	const GEN_FLT x34 = x31 + x33;
+	const GEN_FLT x35 = obj_qk * x21;
+	const GEN_FLT x36 = obj_qi * x23;
+	const GEN_FLT x38 = lh_qj * x30;
+	const GEN_FLT x39 = lh_qk * x8;
+	const GEN_FLT x40 = lh_qi * x39;
+	const GEN_FLT x41 = x40 + (-1 * x38);
+	const GEN_FLT x45 = x0 * x8;
+	const GEN_FLT x46 = x45 + x5;
+	const GEN_FLT x47 = x38 + x40;
+	const GEN_FLT x48 = lh_qk * x30;
+	const GEN_FLT x49 = lh_qi * x32;
+	const GEN_FLT x50 = x49 + (-1 * x48);
+	const GEN_FLT x53 = x1 * x8;
+	const GEN_FLT x54 = x5 + x53;
+	const GEN_FLT x55 = x48 + x49;
+	const GEN_FLT x56 = x33 + (-1 * x31);
+	const GEN_FLT x58 = 0.523598775598299 + tilt_0;
+	const GEN_FLT x59 = tan(x58);
+	const GEN_FLT x63 = cos(x58);
+	const GEN_FLT x64 = 1. / x63;
+	const GEN_FLT x83 = sin(x58);
+	const GEN_FLT x94 = 2 * x48;
+	const GEN_FLT x95 = 2 * x49;
+	const GEN_FLT x97 = 2 * x5;
+	const GEN_FLT x99 = 2 * x40;
+	const GEN_FLT x125 = 2 * x31;
+	const GEN_FLT x126 = 2 * x33;
+	const GEN_FLT x147 = 1. / (x14 * sqrt(x14));
+	const GEN_FLT x148 = 2 * x18 * (1. / (x14 * x14));
+	const GEN_FLT x149 = obj_qi * x148;
+	const GEN_FLT x150 = x12 * x149;
+	const GEN_FLT x151 = x16 * x17;
+	const GEN_FLT x152 = x147 * x20;
+	const GEN_FLT x153 = x11 * x152;
+	const GEN_FLT x154 = x21 + (-1 * x153) + (x11 * x151);
+	const GEN_FLT x155 = obj_qi * obj_qk;
+	const GEN_FLT x156 = obj_qj * x148;
+	const GEN_FLT x157 = x155 * x156;
+	const GEN_FLT x158 = x157 + (-1 * obj_qi * obj_qj * obj_qk * x147 * x20);
+	const GEN_FLT x159 = x11 * x148;
+	const GEN_FLT x160 = obj_qj * x159;
+	const GEN_FLT x161 = x23 + (-1 * x160) + (obj_qj * x153);
+	const GEN_FLT x162 = x151 * x155;
+	const GEN_FLT x163 = x152 * x155;
+	const GEN_FLT x164 = x162 + (-1 * x163);
+	const GEN_FLT x167 = x13 * x149;
+	const GEN_FLT x168 = (-1 * x157) + (obj_qj * x163);
+	const GEN_FLT x169 = obj_qk * x159;
+	const GEN_FLT x170 = x25 + (-1 * x169) + (obj_qk * x153);
+	const GEN_FLT x171 = obj_qi * obj_qj;
+	const GEN_FLT x172 = x152 * x171;
+	const GEN_FLT x173 = x151 * x171;
+	const GEN_FLT x174 = x172 + (-1 * x173);
+	const GEN_FLT x177 = obj_qi * obj_qi * obj_qi;
+	const GEN_FLT x178 = x163 + (-1 * x162);
+	const GEN_FLT x179 = x173 + (-1 * x172);
+	const GEN_FLT x198 = x168 + x21;
+	const GEN_FLT x199 = x12 * x152;
+	const GEN_FLT x200 = (-1 * x199) + (x12 * x151);
+	const GEN_FLT x201 = obj_qi * x19;
+	const GEN_FLT x202 = x201 + (-1 * x150) + (obj_qi * x199);
+	const GEN_FLT x203 = obj_qj * obj_qk;
+	const GEN_FLT x204 = x152 * x203;
+	const GEN_FLT x205 = x151 * x203;
+	const GEN_FLT x206 = x204 + (-1 * x205);
+	const GEN_FLT x209 = x13 * x156;
+	const GEN_FLT x210 = x158 + x21;
+	const GEN_FLT x211 = obj_qk * x12 * x148;
+	const GEN_FLT x212 = x25 + (-1 * x211) + (obj_qk * x199);
+	const GEN_FLT x215 = obj_qj * obj_qj * obj_qj;
+	const GEN_FLT x216 = x205 + (-1 * x204);
+	const GEN_FLT x235 = x13 * x152;
+	const GEN_FLT x236 = (-1 * x235) + (x13 * x151);
+	const GEN_FLT x237 = x23 + (-1 * x209) + (obj_qj * x235);
+	const GEN_FLT x240 = x201 + (-1 * x167) + (obj_qi * x235);
+	const GEN_FLT x243 = obj_qk * obj_qk * obj_qk;
+	const GEN_FLT x284 = 1. / (x3 * sqrt(x3));
+	const GEN_FLT x285 = 2 * x7 * (1. / (x3 * x3));
+	const GEN_FLT x286 = lh_qi * x285;
+	const GEN_FLT x287 = x1 * x286;
+	const GEN_FLT x289 = x5 * x6;
+	const GEN_FLT x290 = x284 * x29;
+	const GEN_FLT x291 = x0 * x290;
+	const GEN_FLT x292 = x30 + (-1 * x291) + (x0 * x289);
+	const GEN_FLT x293 = lh_qi * lh_qk;
+	const GEN_FLT x294 = lh_qj * x285;
+	const GEN_FLT x295 = x293 * x294;
+	const GEN_FLT x296 = x295 + (-1 * lh_qi * lh_qj * lh_qk * x284 * x29);
+	const GEN_FLT x298 = x0 * x285;
+	const GEN_FLT x299 = lh_qj * x298;
+	const GEN_FLT x300 = x32 + (-1 * x299) + (lh_qj * x291);
+	const GEN_FLT x301 = x289 * x293;
+	const GEN_FLT x302 = x290 * x293;
+	const GEN_FLT x303 = x301 + (-1 * x302);
+	const GEN_FLT x306 = x2 * x286;
+	const GEN_FLT x308 = (-1 * x295) + (lh_qj * x302);
+	const GEN_FLT x310 = lh_qk * x298;
+	const GEN_FLT x311 = x39 + (-1 * x310) + (lh_qk * x291);
+	const GEN_FLT x312 = lh_qi * lh_qj;
+	const GEN_FLT x313 = x290 * x312;
+	const GEN_FLT x314 = x289 * x312;
+	const GEN_FLT x315 = x313 + (-1 * x314);
+	const GEN_FLT x317 = lh_qi * lh_qi * lh_qi;
+	const GEN_FLT x319 = x302 + (-1 * x301);
+	const GEN_FLT x321 = x314 + (-1 * x313);
+	const GEN_FLT x332 = lh_qj * lh_qj * lh_qj;
+	const GEN_FLT x334 = lh_qi * x8;
+	const GEN_FLT x335 = x1 * x290;
+	const GEN_FLT x336 = x334 + (-1 * x287) + (lh_qi * x335);
+	const GEN_FLT x337 = lh_qj * lh_qk;
+	const GEN_FLT x338 = x289 * x337;
+	const GEN_FLT x339 = x290 * x337;
+	const GEN_FLT x340 = x338 + (-1 * x339);
+	const GEN_FLT x342 = lh_qk * x1 * x285;
+	const GEN_FLT x343 = x39 + (-1 * x342) + (lh_qk * x335);
+	const GEN_FLT x347 = (-1 * x335) + (x1 * x289);
+	const GEN_FLT x348 = x30 + x308;
+	const GEN_FLT x350 = x339 + (-1 * x338);
+	const GEN_FLT x352 = x2 * x294;
+	const GEN_FLT x354 = x296 + x30;
+	const GEN_FLT x367 = x2 * x290;
+	const GEN_FLT x368 = (-1 * x367) + (x2 * x289);
+	const GEN_FLT x370 = x32 + (-1 * x352) + (lh_qj * x367);
+	const GEN_FLT x375 = x334 + (-1 * x306) + (lh_qi * x367);
+	const GEN_FLT x377 = lh_qk * lh_qk * lh_qk;
+	const GEN_FLT c0 = x26 + (-1 * x24);
+	const GEN_FLT c1 = x22 + (obj_qk * x23);
+	const GEN_FLT c2 = x16 + (x13 * x19);
+	const GEN_FLT c3 = x35 + x36;
+	const GEN_FLT c4 = x16 + (x12 * x19);
+	const GEN_FLT c5 = (-1 * x22) + (obj_qj * obj_qk * x17 * x18);
+	const GEN_FLT c6 = x16 + (x11 * x19);
+	const GEN_FLT c7 = x36 + (-1 * x35);
+	const GEN_FLT c8 = x24 + x26;
+	const GEN_FLT c9 = 1. / (x63 * x63);
+	const GEN_FLT c10 = (-1 * x99) + (2 * lh_qj * x28 * x29);
+	const GEN_FLT c11 = x97 + (2 * x45);
+	const GEN_FLT c12 = x94 + x95;
+	const GEN_FLT c13 = x59 * x59;
+	const GEN_FLT c14 = (-1 * x125) + (-1 * x126);
+	const GEN_FLT c15 = x95 + (-1 * x94);
+	const GEN_FLT c16 = x97 + (2 * x53);
+	const GEN_FLT c17 = (-1 * x97) + (-2 * x9);
+	const GEN_FLT c18 = x99 + (2 * x38);
+	const GEN_FLT c19 = x126 + (-1 * x125);
+	const GEN_FLT c20 = x161 + x164;
+	const GEN_FLT c21 = (-1 * x150) + (-1 * x22) + (obj_qi * x12 * x147 * x20);
+	const GEN_FLT c22 = (-1 * x154) + (-1 * x158);
+	const GEN_FLT c23 = x170 + x174;
+	const GEN_FLT c24 = x154 + x168;
+	const GEN_FLT c25 = (-1 * x167) + (-1 * x22) + (obj_qi * x13 * x147 * x20);
+	const GEN_FLT c26 = (-1 * x22) + (-1 * x148 * x177) + (x147 * x177 * x20) + (2 * obj_qi * x17 * x18);
+	const GEN_FLT c27 = x161 + x178;
+	const GEN_FLT c28 = x170 + x179;
+	const GEN_FLT c29 = (-1 * x160) + (-1 * x24) + (obj_qj * x11 * x147 * x20);
+	const GEN_FLT c30 = x202 + x206;
+	const GEN_FLT c31 = x198 + x200;
+	const GEN_FLT c32 = (-1 * x200) + (-1 * x210);
+	const GEN_FLT c33 = x179 + x212;
+	const GEN_FLT c34 = (-1 * x209) + (-1 * x24) + (obj_qj * x13 * x147 * x20);
+	const GEN_FLT c35 = x202 + x216;
+	const GEN_FLT c36 = (-1 * x24) + (-1 * x148 * x215) + (x147 * x20 * x215) + (2 * obj_qj * x17 * x18);
+	const GEN_FLT c37 = x174 + x212;
+	const GEN_FLT c38 = x198 + x236;
+	const GEN_FLT c39 = (-1 * x211) + (-1 * x35) + (obj_qk * x12 * x147 * x20);
+	const GEN_FLT c40 = x178 + x237;
+	const GEN_FLT c41 = (-1 * x169) + (-1 * x35) + (obj_qk * x11 * x147 * x20);
+	const GEN_FLT c42 = (-1 * x210) + (-1 * x236);
+	const GEN_FLT c43 = x216 + x240;
+	const GEN_FLT c44 = x206 + x240;
+	const GEN_FLT c45 = x164 + x237;
+	const GEN_FLT c46 = (-1 * x35) + (-1 * x148 * x243) + (x147 * x20 * x243) + (2 * obj_qk * x17 * x18);
+	const GEN_FLT c47 = (-1 * x287) + (-1 * x31) + (lh_qi * x1 * x284 * x29);
+	const GEN_FLT c48 = (-1 * x292) + (-1 * x296);
+	const GEN_FLT c49 = x300 + x303;
+	const GEN_FLT c50 = (-1 * x306) + (-1 * x31) + (lh_qi * x2 * x284 * x29);
+	const GEN_FLT c51 = x292 + x308;
+	const GEN_FLT c52 = x311 + x315;
+	const GEN_FLT c53 = (-1 * x31) + (-1 * x285 * x317) + (x284 * x29 * x317) + (2 * lh_qi * x6 * x7);
+	const GEN_FLT c54 = x300 + x319;
+	const GEN_FLT c55 = x311 + x321;
+	const GEN_FLT c56 = (-1 * x38) + (-1 * x285 * x332) + (x284 * x29 * x332) + (2 * lh_qj * x6 * x7);
+	const GEN_FLT c57 = x336 + x340;
+	const GEN_FLT c58 = x315 + x343;
+	const GEN_FLT c59 = (-1 * x299) + (-1 * x38) + (lh_qj * x0 * x284 * x29);
+	const GEN_FLT c60 = x347 + x348;
+	const GEN_FLT c61 = x336 + x350;
+	const GEN_FLT c62 = (-1 * x352) + (-1 * x38) + (lh_qj * x2 * x284 * x29);
+	const GEN_FLT c63 = (-1 * x347) + (-1 * x354);
+	const GEN_FLT c64 = x321 + x343;
+	const GEN_FLT c65 = (-1 * x342) + (-1 * x48) + (lh_qk * x1 * x284 * x29);
+	const GEN_FLT c66 = x348 + x368;
+	const GEN_FLT c67 = x319 + x370;
+	const GEN_FLT c68 = (-1 * x310) + (-1 * x48) + (lh_qk * x0 * x284 * x29);
+	const GEN_FLT c69 = (-1 * x354) + (-1 * x368);
+	const GEN_FLT c70 = x340 + x375;
+	const GEN_FLT c71 = (-1 * x48) + (-1 * x285 * x377) + (x284 * x29 * x377) + (2 * lh_qk * x6 * x7);
+	const GEN_FLT c72 = x350 + x375;
+	const GEN_FLT c73 = x303 + x370;
+	const GEN_FLT c74 = -1 * phase_0;
+	prepared[0] = obj_px;
+	prepared[1] = obj_py;
+	prepared[2] = obj_pz;
+	prepared[3] = lh_px;
+	prepared[4] = lh_py;
+	prepared[5] = lh_pz;
+	prepared[6] = curve_0;
+	prepared[7] = gibPhase_0;
+	prepared[8] = gibMag_0;
+	prepared[9] = ogeeMag_0;
+	prepared[10] = ogeePhase_0;
+	prepared[11] = x10;
+	prepared[12] = x34;
+	prepared[13] = x41;
+	prepared[14] = x46;
+	prepared[15] = x47;
+	prepared[16] = x50;
+	prepared[17] = x54;
+	prepared[18] = x55;
+	prepared[19] = x56;
+	prepared[20] = x59;
+	prepared[21] = x63;
+	prepared[22] = x64;
+	prepared[23] = x83;
+	prepared[24] = c0;
+	prepared[25] = c1;
+	prepared[26] = c2;
+	prepared[27] = c3;
+	prepared[28] = c4;
+	prepared[29] = c5;
+	prepared[30] = c6;
+	prepared[31] = c7;
+	prepared[32] = c8;
+	prepared[33] = c9;
+	prepared[34] = c10;
+	prepared[35] = c11;
+	prepared[36] = c12;
+	prepared[37] = c13;
+	prepared[38] = c14;
+	prepared[39] = c15;
+	prepared[40] = c16;
+	prepared[41] = c17;
+	prepared[42] = c18;
+	prepared[43] = c19;
+	prepared[44] = c20;
+	prepared[45] = c21;
+	prepared[46] = c22;
+	prepared[47] = c23;
+	prepared[48] = c24;
+	prepared[49] = c25;
+	prepared[50] = c26;
+	prepared[51] = c27;
+	prepared[52] = c28;
+	prepared[53] = c29;
+	prepared[54] = c30;
+	prepared[55] = c31;
+	prepared[56] = c32;
+	prepared[57] = c33;
+	prepared[58] = c34;
+	prepared[59] = c35;
+	prepared[60] = c36;
+	prepared[61] = c37;
+	prepared[62] = c38;
+	prepared[63] = c39;
+	prepared[64] = c40;
+	prepared[65] = c41;
+	prepared[66] = c42;
+	prepared[67] = c43;
+	prepared[68] = c44;
+	prepared[69] = c45;
+	prepared[70] = c46;
+	prepared[71] = c47;
+	prepared[72] = c48;
+	prepared[73] = c49;
+	prepared[74] = c50;
+	prepared[75] = c51;
+	prepared[76] = c52;
+	prepared[77] = c53;
+	prepared[78] = c54;
+	prepared[79] = c55;
+	prepared[80] = c56;
+	prepared[81] = c57;
+	prepared[82] = c58;
+	prepared[83] = c59;
+	prepared[84] = c60;
+	prepared[85] = c61;
+	prepared[86] = c62;
+	prepared[87] = c63;
+	prepared[88] = c64;
+	prepared[89] = c65;
+	prepared[90] = c66;
+	prepared[91] = c67;
+	prepared[92] = c68;
+	prepared[93] = c69;
+	prepared[94] = c70;
+	prepared[95] = c71;
+	prepared[96] = c72;
+	prepared[97] = c73;
+	prepared[98] = c74;
+}
+
+static inline void gen_reproject_axis_x_gen2_val_jac_obj_p_lh_p_axis_angle_eval(FLT *out, const FLT *prepared,
+																				const FLT *sensor_pt) {
+	const GEN_FLT obj_px = prepared[0];
+	const GEN_FLT obj_py = prepared[1];
+	const GEN_FLT obj_pz = prepared[2];
+	const GEN_FLT lh_px = prepared[3];
+	const GEN_FLT lh_py = prepared[4];
+	const GEN_FLT lh_pz = prepared[5];
+	const GEN_FLT curve_0 = prepared[6];
+	const GEN_FLT gibPhase_0 = prepared[7];
+	const GEN_FLT gibMag_0 = prepared[8];
+	const GEN_FLT ogeeMag_0 = prepared[9];
+	const GEN_FLT ogeePhase_0 = prepared[10];
+	const GEN_FLT x10 = prepared[11];
+	const GEN_FLT x34 = prepared[12];
+	const GEN_FLT x41 = prepared[13];
+	const GEN_FLT x46 = prepared[14];
+	const GEN_FLT x47 = prepared[15];
+	const GEN_FLT x50 = prepared[16];
+	const GEN_FLT x54 = prepared[17];
+	const GEN_FLT x55 = prepared[18];
+	const GEN_FLT x56 = prepared[19];
+	const GEN_FLT x59 = prepared[20];
+	const GEN_FLT x63 = prepared[21];
+	const GEN_FLT x64 = prepared[22];
+	const GEN_FLT x83 = prepared[23];
+	const GEN_FLT c0 = prepared[24];
+	const GEN_FLT c1 = prepared[25];
+	const GEN_FLT c2 = prepared[26];
+	const GEN_FLT c3 = prepared[27];
+	const GEN_FLT c4 = prepared[28];
+	const GEN_FLT c5 = prepared[29];
+	const GEN_FLT c6 = prepared[30];
+	const GEN_FLT c7 = prepared[31];
+	const GEN_FLT c8 = prepared[32];
+	const GEN_FLT c9 = prepared[33];
+	const GEN_FLT c10 = prepared[34];
+	const GEN_FLT c11 = prepared[35];
+	const GEN_FLT c12 = prepared[36];
+	const GEN_FLT c13 = prepared[37];
+	const GEN_FLT c14 = prepared[38];
+	const GEN_FLT c15 = prepared[39];
+	const GEN_FLT c16 = prepared[40];
+	const GEN_FLT c17 = prepared[41];
+	const GEN_FLT c18 = prepared[42];
+	const GEN_FLT c19 = prepared[43];
+	const GEN_FLT c20 = prepared[44];
+	const GEN_FLT c21 = prepared[45];
+	const GEN_FLT c22 = prepared[46];
+	const GEN_FLT c23 = prepared[47];
+	const GEN_FLT c24 = prepared[48];
+	const GEN_FLT c25 = prepared[49];
+	const GEN_FLT c26 = prepared[50];
+	const GEN_FLT c27 = prepared[51];
+	const GEN_FLT c28 = prepared[52];
+	const GEN_FLT c29 = prepared[53];
+	const GEN_FLT c30 = prepared[54];
+	const GEN_FLT c31 = prepared[55];
+	const GEN_FLT c32 = prepared[56];
+	const GEN_FLT c33 = prepared[57];
+	const GEN_FLT c34 = prepared[58];
+	const GEN_FLT c35 = prepared[59];
+	const GEN_FLT c36 = prepared[60];
+	const GEN_FLT c37 = prepared[61];
+	const GEN_FLT c38 = prepared[62];
+	const GEN_FLT c39 = prepared[63];
+	const GEN_FLT c40 = prepared[64];
+	const GEN_FLT c41 = prepared[65];
+	const GEN_FLT c42 = prepared[66];
+	const GEN_FLT c43 = prepared[67];
+	const GEN_FLT c44 = prepared[68];
+	const GEN_FLT c45 = prepared[69];
+	const GEN_FLT c46 = prepared[70];
+	const GEN_FLT c47 = prepared[71];
+	const GEN_FLT c48 = prepared[72];
+	const GEN_FLT c49 = prepared[73];
+	const GEN_FLT c50 = prepared[74];
+	const GEN_FLT c51 = prepared[75];
+	const GEN_FLT c52 = prepared[76];
+	const GEN_FLT c53 = prepared[77];
+	const GEN_FLT c54 = prepared[78];
+	const GEN_FLT c55 = prepared[79];
+	const GEN_FLT c56 = prepared[80];
+	const GEN_FLT c57 = prepared[81];
+	const GEN_FLT c58 = prepared[82];
+	const GEN_FLT c59 = prepared[83];
+	const GEN_FLT c60 = prepared[84];
+	const GEN_FLT c61 = prepared[85];
+	const GEN_FLT c62 = prepared[86];
+	const GEN_FLT c63 = prepared[87];
+	const GEN_FLT c64 = prepared[88];
+	const GEN_FLT c65 = prepared[89];
+	const GEN_FLT c66 = prepared[90];
+	const GEN_FLT c67 = prepared[91];
+	const GEN_FLT c68 = prepared[92];
+	const GEN_FLT c69 = prepared[93];
+	const GEN_FLT c70 = prepared[94];
+	const GEN_FLT c71 = prepared[95];
+	const GEN_FLT c72 = prepared[96];
+	const GEN_FLT c73 = prepared[97];
+	const GEN_FLT c74 = prepared[98];
+	const GEN_FLT sensor_x = sensor_pt[0];
+	const GEN_FLT sensor_y = sensor_pt[1];
+	const GEN_FLT sensor_z = sensor_pt[2];
+	const GEN_FLT x27 = obj_pz + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLT x37 = obj_py + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLT x42 = obj_px + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLT x43 = lh_pz + (x10 * x27) + (x34 * x37) + (x41 * x42);
+	const GEN_FLT x44 = -1 * x43;
+	const GEN_FLT x51 = lh_px + (x27 * x47) + (x37 * x50) + (x42 * x46);
+	const GEN_FLT x52 = atan2(x44, x51);
+	const GEN_FLT x57 = lh_py + (x27 * x56) + (x37 * x54) + (x42 * x55);
+	const GEN_FLT x60 = (x44 * x44) + (x51 * x51);
+	const GEN_FLT x61 = x59 * (1. / sqrt(x60));
+	const GEN_FLT x62 = x57 * x61;
+	const GEN_FLT x65 = x57 * x57;
+	const GEN_FLT x66 = x60 + x65;
+	const GEN_FLT x67 = x64 * (1. / sqrt(x66));
+	const GEN_FLT x68 = asin(x57 * x67);
+	const GEN_FLT x69 = 8.0108022e-06 * x68;
+	const GEN_FLT x70 = -8.0108022e-06 + (-1 * x69);
+	const GEN_FLT x71 = 0.0028679863 + (x68 * x70);
+	const GEN_FLT x72 = 5.3685255e-06 + (x68 * x71);
+	const GEN_FLT x73 = 0.0076069798 + (x68 * x72);
+	const GEN_FLT x74 = x68 * x68;
+	const GEN_FLT x75 = ogeeMag_0 + x52 + (-1 * asin(x62));
+	const GEN_FLT x76 = curve_0 + (ogeePhase_0 * sin(x75));
+	const GEN_FLT x77 = x68 * x73;
+	const GEN_FLT x78 = -8.0108022e-06 + (-1.60216044e-05 * x68);
+	const GEN_FLT x79 = x71 + (x68 * x78);
+	const GEN_FLT x80 = x72 + (x68 * x79);
+	const GEN_FLT x81 = x73 + (x68 * x80);
+	const GEN_FLT x82 = x77 + (x68 * x81);
+	const GEN_FLT x84 = x76 * x83;
+	const GEN_FLT x85 = x63 + (-1 * x82 * x84);
+	const GEN_FLT x86 = 1. / x85;
+	const GEN_FLT x87 = x76 * x86;
+	const GEN_FLT x88 = x74 * x87;
+	const GEN_FLT x89 = x62 + (x73 * x88);
+	const GEN_FLT x90 = asin(x89);
+	const GEN_FLT x91 = gibPhase_0 + x52 + (-1 * x90);
+	const GEN_FLT x92 = 1. / sqrt(1 + (-1 * (x89 * x89)));
+	const GEN_FLT x93 = 1. / sqrt(1 + (-1 * x65 * c9 * (1. / x66)));
+	const GEN_FLT x96 = 1.0/2.0 * x57;
+	const GEN_FLT x98 = 1.0/2.0 * x51;
+	const GEN_FLT x100 = 1.0/2.0 * x44;
+	const GEN_FLT x101 = (x100 * c10) + (x98 * c11);
+	const GEN_FLT x102 = x57 * x64 * (1. / (x66 * sqrt(x66)));
+	const GEN_FLT x103 = x93 * ((x102 * ((-1 * x101) + (-1 * x96 * c12))) + (x55 * x67));
+	const GEN_FLT x104 = x103 * x70;
+	const GEN_FLT x105 = (x103 * x71) + (x68 * (x104 + (-1 * x103 * x69)));
+	const GEN_FLT x106 = (x103 * x72) + (x105 * x68);
+	const GEN_FLT x107 = 1. / x60;
+	const GEN_FLT x108 = 1. / sqrt(1 + (-1 * x107 * x65 * c13));
+	const GEN_FLT x109 = x57 * x59 * (1. / (x60 * sqrt(x60)));
+	const GEN_FLT x110 = (x55 * x61) + (-1 * x101 * x109);
+	const GEN_FLT x111 = x107 * x51;
+	const GEN_FLT x112 = x107 * x43;
+	const GEN_FLT x113 = (x112 * x46) + (-1 * x111 * x41);
+	const GEN_FLT x114 = ogeePhase_0 * cos(x75);
+	const GEN_FLT x115 = x114 * (x113 + (-1 * x108 * x110));
+	const GEN_FLT x116 = x82 * x83;
+	const GEN_FLT x117 = 2.40324066e-05 * x68;
+	const GEN_FLT x118 = x73 * x74;
+	const GEN_FLT x119 = x118 * x76 * (1. / (x85 * x85));
+	const GEN_FLT x120 = x118 * x86;
+	const GEN_FLT x121 = 2 * x77 * x87;
+	const GEN_FLT x122 = x113 + (-1 * x92 * (x110 + (x103 * x121) + (x106 * x88) + (x115 * x120) + (x119 * ((x115 *
+		x116) + (x84 * ((x103 * x73) + (x103 * x81) + (x106 * x68) + (x68 * (x106 + (x103 * x80) + (x68 * (x105 + (x103
+		* x79) + (x68 * (x104 + (x103 * x78) + (-1 * x103 * x117)))))))))))));
+	const GEN_FLT x123 = cos(x91);
+	const GEN_FLT x124 = gibMag_0 * x123;
+	const GEN_FLT x127 = (x100 * c14) + (x98 * c15);
+	const GEN_FLT x128 = x93 * ((x102 * ((-1 * x127) + (-1 * x96 * c16))) + (x54 * x67));
+	const GEN_FLT x129 = x128 * x70;
+	const GEN_FLT x130 = (x128 * x71) + (x68 * (x129 + (-1 * x128 * x69)));
+	const GEN_FLT x131 = (x128 * x72) + (x130 * x68);
+	const GEN_FLT x132 = (x54 * x61) + (-1 * x109 * x127);
+	const GEN_FLT x133 = (x112 * x50) + (-1 * x111 * x34);
+	const GEN_FLT x134 = x133 + (-1 * x108 * x132);
+	const GEN_FLT x135 = x114 * x116;
+	const GEN_FLT x136 = x114 * x120;
+	const GEN_FLT x137 = x133 + (-1 * x92 * (x132 + (x119 * ((x134 * x135) + (x84 * ((x128 * x73) + (x128 * x81) +
+		(x131 * x68) + (x68 * (x131 + (x128 * x80) + (x68 * (x130 + (x128 * x79) + (x68 * (x129 + (x128 * x78) + (-1 *
+		x117 * x128))))))))))) + (x121 * x128) + (x131 * x88) + (x134 * x136)));
+	const GEN_FLT x138 = (x100 * c17) + (x98 * c18);
+	const GEN_FLT x139 = x93 * ((x102 * ((-1 * x138) + (-1 * x96 * c19))) + (x56 * x67));
+	const GEN_FLT x140 = x139 * x70;
+	const GEN_FLT x141 = (x139 * x71) + (x68 * (x140 + (-1 * x139 * x69)));
+	const GEN_FLT x142 = (x139 * x72) + (x141 * x68);
+	const GEN_FLT x143 = (x56 * x61) + (-1 * x109 * x138);
+	const GEN_FLT x144 = (x112 * x47) + (-1 * x10 * x111);
+	const GEN_FLT x145 = x144 + (-1 * x108 * x143);
+	const GEN_FLT x146 = x144 + (-1 * x92 * (x143 + (x119 * ((x135 * x145) + (x84 * ((x139 * x73) + (x139 * x81) +
+		(x142 * x68) + (x68 * (x142 + (x139 * x80) + (x68 * (x141 + (x139 * x79) + (x68 * (x140 + (x139 * x78) + (-1 *
+		x117 * x139))))))))))) + (x121 * x139) + (x136 * x145) + (x142 * x88)));
+	const GEN_FLT x165 = (sensor_x * c20) + (sensor_y * c21) + (sensor_z * c22);
+	const GEN_FLT x166 = x165 * x54;
+	const GEN_FLT x175 = (sensor_x * c23) + (sensor_y * c24) + (sensor_z * c25);
+	const GEN_FLT x176 = x175 * x56;
+	const GEN_FLT x180 = (sensor_x * c26) + (sensor_y * c27) + (sensor_z * c28);
+	const GEN_FLT x181 = x180 * x55;
+	const GEN_FLT x182 = x166 + x176 + x181;
+	const GEN_FLT x183 = x175 * x47;
+	const GEN_FLT x184 = x165 * x50;
+	const GEN_FLT x185 = x180 * x46;
+	const GEN_FLT x186 = x10 * x175;
+	const GEN_FLT x187 = x165 * x34;
+	const GEN_FLT x188 = x180 * x41;
+	const GEN_FLT x189 = (x100 * ((-2 * x186) + (-2 * x187) + (-2 * x188))) + (x98 * ((2 * x183) + (2 * x184) + (2 *
+		x185)));
+	const GEN_FLT x190 = x93 * ((x102 * ((-1 * x189) + (-1 * x96 * ((2 * x166) + (2 * x176) + (2 * x181))))) + (x182 *
+		x67));
+	const GEN_FLT x191 = x190 * x70;
+	const GEN_FLT x192 = (x190 * x71) + (x68 * (x191 + (-1 * x190 * x69)));
+	const GEN_FLT x193 = (x190 * x72) + (x192 * x68);
+	const GEN_FLT x194 = (x182 * x61) + (-1 * x109 * x189);
+	const GEN_FLT x195 = (x111 * ((-1 * x186) + (-1 * x187) + (-1 * x188))) + (x112 * (x183 + x184 + x185));
+	const GEN_FLT x196 = x195 + (-1 * x108 * x194);
+	const GEN_FLT x197 = x195 + (-1 * x92 * (x194 + (x119 * ((x135 * x196) + (x84 * ((x190 * x73) + (x190 * x81) +
+		(x193 * x68) + (x68 * (x193 + (x190 * x80) + (x68 * (x192 + (x190 * x79) + (x68 * (x191 + (x190 * x78) + (-1 *
+		x117 * x190))))))))))) + (x121 * x190) + (x136 * x196) + (x193 * x88)));
+	const GEN_FLT x207 = (sensor_x * c29) + (sensor_y * c30) + (sensor_z * c31);
+	const GEN_FLT x208 = x207 * x55;
+	const GEN_FLT x213 = (sensor_x * c32) + (sensor_y * c33) + (sensor_z * c34);
+	const GEN_FLT x214 = x213 * x56;
+	const GEN_FLT x217 = (sensor_x * c35) + (sensor_y * c36) + (sensor_z * c37);
+	const GEN_FLT x218 = x217 * x54;
+	const GEN_FLT x219 = x208 + x214 + x218;
+	const GEN_FLT x220 = x207 * x46;
+	const GEN_FLT x221 = x213 * x47;
+	const GEN_FLT x222 = x217 * x50;
+	const GEN_FLT x223 = x10 * x213;
+	const GEN_FLT x224 = x207 * x41;
+	const GEN_FLT x225 = x217 * x34;
+	const GEN_FLT x226 = (x100 * ((-2 * x223) + (-2 * x224) + (-2 * x225))) + (x98 * ((2 * x220) + (2 * x221) + (2 *
+		x222)));
+	const GEN_FLT x227 = x93 * ((x102 * ((-1 * x226) + (-1 * x96 * ((2 * x208) + (2 * x214) + (2 * x218))))) + (x219 *
+		x67));
+	const GEN_FLT x228 = x227 * x70;
+	const GEN_FLT x229 = (x227 * x71) + (x68 * (x228 + (-1 * x227 * x69)));
+	const GEN_FLT x230 = (x227 * x72) + (x229 * x68);
+	const GEN_FLT x231 = (x219 * x61) + (-1 * x109 * x226);
+	const GEN_FLT x232 = (x111 * ((-1 * x223) + (-1 * x224) + (-1 * x225))) + (x112 * (x220 + x221 + x222));
+	const GEN_FLT x233 = x232 + (-1 * x108 * x231);
+	const GEN_FLT x234 = x232 + (-1 * x92 * (x231 + (x119 * ((x135 * x233) + (x84 * ((x227 * x73) + (x227 * x81) +
+		(x230 * x68) + (x68 * (x230 + (x227 * x80) + (x68 * (x229 + (x227 * x79) + (x68 * (x228 + (x227 * x78) + (-1 *
+		x117 * x227))))))))))) + (x121 * x227) + (x136 * x233) + (x230 * x88)));
+	const GEN_FLT x238 = (sensor_x * c38) + (sensor_y * c39) + (sensor_z * c40);
+	const GEN_FLT x239 = x238 * x54;
+	const GEN_FLT x241 = (sensor_x * c41) + (sensor_y * c42) + (sensor_z * c43);
+	const GEN_FLT x242 = x241 * x55;
+	const GEN_FLT x244 = (sensor_x * c44) + (sensor_y * c45) + (sensor_z * c46);
+	const GEN_FLT x245 = x244 * x56;
+	const GEN_FLT x246 = x239 + x242 + x245;
+	const GEN_FLT x247 = x241 * x46;
+	const GEN_FLT x248 = x238 * x50;
+	const GEN_FLT x249 = x244 * x47;
+	const GEN_FLT x250 = x238 * x34;
+	const GEN_FLT x251 = x241 * x41;
+	const GEN_FLT x252 = x10 * x244;
+	const GEN_FLT x253 = (x100 * ((-2 * x250) + (-2 * x251) + (-2 * x252))) + (x98 * ((2 * x247) + (2 * x248) + (2 *
+		x249)));
+	const GEN_FLT x254 = x93 * ((x102 * ((-1 * x253) + (-1 * x96 * ((2 * x239) + (2 * x242) + (2 * x245))))) + (x246 *
+		x67));
+	const GEN_FLT x255 = x254 * x70;
+	const GEN_FLT x256 = (x254 * x71) + (x68 * (x255 + (-1 * x254 * x69)));
+	const GEN_FLT x257 = (x254 * x72) + (x256 * x68);
+	const GEN_FLT x258 = (x246 * x61) + (-1 * x109 * x253);
+	const GEN_FLT x259 = (x111 * ((-1 * x250) + (-1 * x251) + (-1 * x252))) + (x112 * (x247 + x248 + x249));
+	const GEN_FLT x260 = x259 + (-1 * x108 * x258);
+	const GEN_FLT x261 = x259 + (-1 * x92 * (x258 + (x119 * ((x135 * x260) + (x84 * ((x254 * x73) + (x254 * x81) +
+		(x257 * x68) + (x68 * (x257 + (x254 * x80) + (x68 * (x256 + (x254 * x79) + (x68 * (x255 + (x254 * x78) + (-1 *
+		x117 * x254))))))))))) + (x121 * x254) + (x136 * x260) + (x257 * x88)));
+	const GEN_FLT x262 = -1 * x51;
+	const GEN_FLT x263 = x109 * x262;
+	const GEN_FLT x264 = x102 * x93;
+	const GEN_FLT x265 = x262 * x264;
+	const GEN_FLT x266 = x112 + (-1 * x108 * x263);
+	const GEN_FLT x267 = x265 * x70;
+	const GEN_FLT x268 = (x265 * x71) + (x68 * (x267 + (-1 * x265 * x69)));
+	const GEN_FLT x269 = (x265 * x72) + (x268 * x68);
+	const GEN_FLT x270 = x112 + (-1 * x92 * (x263 + (x119 * ((x135 * x266) + (x84 * ((x265 * x73) + (x265 * x81) +
+		(x269 * x68) + (x68 * (x269 + (x265 * x80) + (x68 * (x268 + (x265 * x79) + (x68 * (x267 + (x265 * x78) + (-1 *
+		x117 * x265))))))))))) + (x121 * x265) + (x136 * x266) + (x269 * x88)));
+	const GEN_FLT x271 = x108 * x61;
+	const GEN_FLT x272 = x93 * (x67 + (-1 * x102 * x57));
+	const GEN_FLT x273 = x272 * x70;
+	const GEN_FLT x274 = (x272 * x71) + (x68 * (x273 + (-1 * x272 * x69)));
+	const GEN_FLT x275 = (x272 * x72) + (x274 * x68);
+	const GEN_FLT x276 = x92 * (x61 + (x119 * ((-1 * x135 * x271) + (x76 * x83 * ((x272 * x73) + (x272 * x81) + (x275 *
+		x68) + (x68 * (x275 + (x272 * x80) + (x68 * (x274 + (x272 * x79) + (x68 * (x273 + (x272 * x78) + (-1 * x117 *
+		x272))))))))))) + (x121 * x272) + (x275 * x88) + (-1 * x136 * x271));
+	const GEN_FLT x277 = x109 * x44;
+	const GEN_FLT x278 = x264 * x44;
+	const GEN_FLT x279 = (-1 * x111) + (-1 * x108 * x277);
+	const GEN_FLT x280 = x278 * x70;
+	const GEN_FLT x281 = (x278 * x71) + (x68 * (x280 + (-1 * x278 * x69)));
+	const GEN_FLT x282 = (x278 * x72) + (x281 * x68);
+	const GEN_FLT x283 = x111 + (x92 * (x277 + (x119 * ((x135 * x279) + (x84 * ((x278 * x73) + (x278 * x81) + (x282 *
+		x68) + (x68 * (x282 + (x278 * x80) + (x68 * (x281 + (x278 * x79) + (x68 * (x280 + (x278 * x78) + (-1 * x117 *
+		x278))))))))))) + (x121 * x278) + (x136 * x279) + (x282 * x88)));
+	const GEN_FLT x288 = x37 * c47;
+	const GEN_FLT x297 = x27 * c48;
+	const GEN_FLT x304 = x42 * c49;
+	const GEN_FLT x305 = x288 + x297 + x304;
+	const GEN_FLT x307 = x27 * c50;
+	const GEN_FLT x309 = x37 * c51;
+	const GEN_FLT x316 = x42 * c52;
+	const GEN_FLT x318 = x42 * c53;
+	const GEN_FLT x320 = x37 * c54;
+	const GEN_FLT x322 = x27 * c55;
+	const GEN_FLT x323 = (x100 * ((-2 * x307) + (-2 * x309) + (-2 * x316))) + (x98 * ((2 * x318) + (2 * x320) + (2 *
+		x322)));
+	const GEN_FLT x324 = x93 * ((x102 * ((-1 * x323) + (-1 * x96 * ((2 * x288) + (2 * x297) + (2 * x304))))) + (x305 *
+		x67));
+	const GEN_FLT x325 = x324 * x70;
+	const GEN_FLT x326 = (x324 * x71) + (x68 * (x325 + (-1 * x324 * x69)));
+	const GEN_FLT x327 = (x324 * x72) + (x326 * x68);
+	const GEN_FLT x328 = (x305 * x61) + (-1 * x109 * x323);
+	const GEN_FLT x329 = (x111 * ((-1 * x307) + (-1 * x309) + (-1 * x316))) + (x112 * (x318 + x320 + x322));
+	const GEN_FLT x330 = x329 + (-1 * x108 * x328);
+	const GEN_FLT x331 = x329 + (-1 * x92 * (x328 + (x119 * ((x135 * x330) + (x84 * ((x324 * x73) + (x324 * x81) +
+		(x327 * x68) + (x68 * (x327 + (x324 * x80) + (x68 * (x326 + (x324 * x79) + (x68 * (x325 + (x324 * x78) + (-1 *
+		x117 * x324))))))))))) + (x121 * x324) + (x136 * x330) + (x327 * x88)));
+	const GEN_FLT x333 = x37 * c56;
+	const GEN_FLT x341 = x42 * c57;
+	const GEN_FLT x344 = x27 * c58;
+	const GEN_FLT x345 = x333 + x341 + x344;
+	const GEN_FLT x346 = x42 * c59;
+	const GEN_FLT x349 = x27 * c60;
+	const GEN_FLT x351 = x37 * c61;
+	const GEN_FLT x353 = x27 * c62;
+	const GEN_FLT x355 = x42 * c63;
+	const GEN_FLT x356 = x37 * c64;
+	const GEN_FLT x357 = (x100 * ((-2 * x353) + (-2 * x355) + (-2 * x356))) + (x98 * ((2 * x346) + (2 * x349) + (2 *
+		x351)));
+	const GEN_FLT x358 = x93 * ((x102 * ((-1 * x357) + (-1 * x96 * ((2 * x333) + (2 * x341) + (2 * x344))))) + (x345 *
+		x67));
+	const GEN_FLT x359 = x358 * x70;
+	const GEN_FLT x360 = (x358 * x71) + (x68 * (x359 + (-1 * x358 * x69)));
+	const GEN_FLT x361 = (x358 * x72) + (x360 * x68);
+	const GEN_FLT x362 = (x345 * x61) + (-1 * x109 * x357);
+	const GEN_FLT x363 = (x111 * ((-1 * x353) + (-1 * x355) + (-1 * x356))) + (x112 * (x346 + x349 + x351));
+	const GEN_FLT x364 = x363 + (-1 * x108 * x362);
+	const GEN_FLT x365 = x363 + (-1 * x92 * (x362 + (x119 * ((x135 * x364) + (x84 * ((x358 * x73) + (x358 * x81) +
+		(x361 * x68) + (x68 * (x361 + (x358 * x80) + (x68 * (x360 + (x358 * x79) + (x68 * (x359 + (x358 * x78) + (-1 *
+		x117 * x358))))))))))) + (x121 * x358) + (x136 * x364) + (x361 * x88)));
+	const GEN_FLT x366 = x37 * c65;
+	const GEN_FLT x369 = x42 * c66;
+	const GEN_FLT x371 = x27 * c67;
+	const GEN_FLT x372 = x366 + x369 + x371;
+	const GEN_FLT x373 = x42 * c68;
+	const GEN_FLT x374 = x37 * c69;
+	const GEN_FLT x376 = x27 * c70;
+	const GEN_FLT x378 = x27 * c71;
+	const GEN_FLT x379 = x42 * c72;
+	const GEN_FLT x380 = x37 * c73;
+	const GEN_FLT x381 = (x100 * ((-2 * x378) + (-2 * x379) + (-2 * x380))) + (x98 * ((2 * x373) + (2 * x374) + (2 *
+		x376)));
+	const GEN_FLT x382 = x93 * ((x102 * ((-1 * x381) + (-1 * x96 * ((2 * x366) + (2 * x369) + (2 * x371))))) + (x372 *
+		x67));
+	const GEN_FLT x383 = x382 * x70;
+	const GEN_FLT x384 = (x382 * x71) + (x68 * (x383 + (-1 * x382 * x69)));
+	const GEN_FLT x385 = (x382 * x72) + (x384 * x68);
+	const GEN_FLT x386 = (x372 * x61) + (-1 * x109 * x381);
+	const GEN_FLT x387 = (x111 * ((-1 * x378) + (-1 * x379) + (-1 * x380))) + (x112 * (x373 + x374 + x376));
+	const GEN_FLT x388 = x387 + (-1 * x108 * x386);
+	const GEN_FLT x389 = x387 + (-1 * x92 * (x386 + (x119 * ((x135 * x388) + (x84 * ((x382 * x73) + (x382 * x81) +
+		(x385 * x68) + (x68 * (x385 + (x382 * x80) + (x68 * (x384 + (x382 * x79) + (x68 * (x383 + (x382 * x78) + (-1 *
+		x117 * x382))))))))))) + (x121 * x382) + (x136 * x388) + (x385 * x88)));
+	out[0] = -1.5707963267949 + x52 + c74 + (-1 * x90) + (gibMag_0 * sin(x91));
+	out[1] = x122 + (x122 * x124);
+	out[2] = x137 + (x124 * x137);
+	out[3] = x146 + (x124 * x146);
+	out[4] = x197 + (x124 * x197);
+	out[5] = x234 + (x124 * x234);
+	out[6] = x261 + (x124 * x261);
+	out[7] = x270 + (x124 * x270);
+	out[8] = (-1 * x276) + (-1 * x124 * x276);
+	out[9] = (-1 * x283) + (-1 * gibMag_0 * x123 * x283);
+	out[10] = x331 + (x124 * x331);
+	out[11] = x365 + (x124 * x365);
+	out[12] = x389 + (x124 * x389);
+}
+
+enum { gen_reproject_axis_y_gen2_axis_angle_prepared_size = 34 };
+
+static inline void gen_reproject_axis_y_gen2_axis_angle_prepare(FLT *prepared, const LinmathAxisAnglePose *obj_p,
+																const LinmathAxisAnglePose *lh_p,
+																const BaseStationCal *bsc1) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_1 = (*bsc1).phase;
+	const GEN_FLT tilt_1 = (*bsc1).tilt;
+	const GEN_FLT curve_1 = (*bsc1).curve;
+	const GEN_FLT gibPhase_1 = (*bsc1).gibpha;
+	const GEN_FLT gibMag_1 = (*bsc1).gibmag;
+	const GEN_FLT ogeeMag_1 = (*bsc1).ogeephase;
+	const GEN_FLT ogeePhase_1 = (*bsc1).ogeemag;
+	const GEN_FLT x0 = lh_qi * lh_qi;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qk * lh_qk;
+	const GEN_FLT x3 = 1e-10 + x0 + x1 + x2;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = cos(x4);
+	const GEN_FLT x6 = 1. / x3;
+	const GEN_FLT x7 = 1 + (-1 * x5);
+	const GEN_FLT x8 = x6 * x7;
+	const GEN_FLT x9 = obj_qi * obj_qi;
+	const GEN_FLT x10 = obj_qj * obj_qj;
+	const GEN_FLT x11 = obj_qk * obj_qk;
+	const GEN_FLT x12 = 1e-10 + x10 + x11 + x9;
+	const GEN_FLT x13 = sqrt(x12);
+	const GEN_FLT x14 = cos(x13);
+	const GEN_FLT x15 = 1. / x12;
+	const GEN_FLT x16 = 1 + (-1 * x14);
+	const GEN_FLT x17 = x15 * x16;
+	const GEN_FLT x18 = (1. / x13) * sin(x13);
+	const GEN_FLT x19 = obj_qi * x18;
+	const GEN_FLT x20 = obj_qk * x17;
+	const GEN_FLT x21 = obj_qj * x18;
+	const GEN_FLT x22 = obj_qi * x20;
+	const GEN_FLT x24 = (1. / x4) * sin(x4);
+	const GEN_FLT x25 = lh_qi * x24;
+	const GEN_FLT x26 = obj_qk * x18;
+	const GEN_FLT x27 = obj_qi * obj_qj * x17;
+	const GEN_FLT x29 = lh_qj * x24;
+	const GEN_FLT x30 = lh_qi * x8;
+	const GEN_FLT x31 = lh_qk * x30;
+	const GEN_FLT x34 = lh_qk * x24;
+	const GEN_FLT x35 = lh_qj * x30;
+	const GEN_FLT x38 = -0.523598775598299 + tilt_1;
+	const GEN_FLT x42 = cos(x38);
+	const GEN_FLT c0 = x22 + (-1 * x21);
+	const GEN_FLT c1 = x19 + (obj_qj * x20);
+	const GEN_FLT c2 = x14 + (x11 * x17);
+	const GEN_FLT c3 = x26 + x27;
+	const GEN_FLT c4 = x14 + (x10 * x17);
+	const GEN_FLT c5 = (-1 * x19) + (obj_qj * obj_qk * x15 * x16);
+	const GEN_FLT c6 = x14 + (x17 * x9);
+	const GEN_FLT c7 = x27 + (-1 * x26);
+	const GEN_FLT c8 = x21 + x22;
+	const GEN_FLT c9 = -1 * lh_pz;
+	const GEN_FLT c10 = x5 + (x2 * x8);
+	const GEN_FLT c11 = x25 + (lh_qj * lh_qk * x8);
+	const GEN_FLT c12 = x31 + (-1 * x29);
+	const GEN_FLT c13 = x29 + x31;
+	const GEN_FLT c14 = x35 + (-1 * x34);
+	const GEN_FLT c15 = x5 + (x0 * x8);
+	const GEN_FLT c16 = (-1 * x25) + (lh_qj * lh_qk * x6 * x7);
+	const GEN_FLT c17 = x5 + (x1 * x8);
+	const GEN_FLT c18 = x34 + x35;
+	const GEN_FLT c19 = tan(x38);
+	const GEN_FLT c20 = 1. / x42;
+	const GEN_FLT c21 = sin(x38);
+	const GEN_FLT c22 = -1 * phase_1;
+	prepared[0] = obj_px;
+	prepared[1] = obj_py;
+	prepared[2] = obj_pz;
+	prepared[3] = lh_px;
+	prepared[4] = lh_py;
+	prepared[5] = curve_1;
+	prepared[6] = gibPhase_1;
+	prepared[7] = gibMag_1;
+	prepared[8] = ogeeMag_1;
+	prepared[9] = ogeePhase_1;
+	prepared[10] = x42;
+	prepared[11] = c0;
+	prepared[12] = c1;
+	prepared[13] = c2;
+	prepared[14] = c3;
+	prepared[15] = c4;
+	prepared[16] = c5;
+	prepared[17] = c6;
+	prepared[18] = c7;
+	prepared[19] = c8;
+	prepared[20] = c9;
+	prepared[21] = c10;
+	prepared[22] = c11;
+	prepared[23] = c12;
+	prepared[24] = c13;
+	prepared[25] = c14;
+	prepared[26] = c15;
+	prepared[27] = c16;
+	prepared[28] = c17;
+	prepared[29] = c18;
+	prepared[30] = c19;
+	prepared[31] = c20;
+	prepared[32] = c21;
+	prepared[33] = c22;
+}
+
+static inline void gen_reproject_axis_y_gen2_axis_angle_eval(FLT *out, const FLT *prepared, const FLT *sensor_pt) {
+	const GEN_FLT obj_px = prepared[0];
+	const GEN_FLT obj_py = prepared[1];
+	const GEN_FLT obj_pz = prepared[2];
+	const GEN_FLT lh_px = prepared[3];
+	const GEN_FLT lh_py = prepared[4];
+	const GEN_FLT curve_1 = prepared[5];
+	const GEN_FLT gibPhase_1 = prepared[6];
+	const GEN_FLT gibMag_1 = prepared[7];
+	const GEN_FLT ogeeMag_1 = prepared[8];
+	const GEN_FLT ogeePhase_1 = prepared[9];
+	const GEN_FLT x42 = prepared[10];
+	const GEN_FLT c0 = prepared[11];
+	const GEN_FLT c1 = prepared[12];
+	const GEN_FLT c2 = prepared[13];
+	const GEN_FLT c3 = prepared[14];
+	const GEN_FLT c4 = prepared[15];
+	const GEN_FLT c5 = prepared[16];
+	const GEN_FLT c6 = prepared[17];
+	const GEN_FLT c7 = prepared[18];
+	const GEN_FLT c8 = prepared[19];
+	const GEN_FLT c9 = prepared[20];
+	const GEN_FLT c10 = prepared[21];
+	const GEN_FLT c11 = prepared[22];
+	const GEN_FLT c12 = prepared[23];
+	const GEN_FLT c13 = prepared[24];
+	const GEN_FLT c14 = prepared[25];
+	const GEN_FLT c15 = prepared[26];
+	const GEN_FLT c16 = prepared[27];
+	const GEN_FLT c17 = prepared[28];
+	const GEN_FLT c18 = prepared[29];
+	const GEN_FLT c19 = prepared[30];
+	const GEN_FLT c20 = prepared[31];
+	const GEN_FLT c21 = prepared[32];
+	const GEN_FLT c22 = prepared[33];
+	const GEN_FLT sensor_x = sensor_pt[0];
+	const GEN_FLT sensor_y = sensor_pt[1];
+	const GEN_FLT sensor_z = sensor_pt[2];
+	const GEN_FLT x23 = obj_pz + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLT x28 = obj_py + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLT x32 = obj_px + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLT x33 = c9 + (-1 * x23 * c10) + (-1 * x28 * c11) + (-1 * x32 * c12);
+	const GEN_FLT x36 = lh_px + (x23 * c13) + (x28 * c14) + (x32 * c15);
+	const GEN_FLT x37 = atan2(x33, x36);
+	const GEN_FLT x39 = lh_py + (x23 * c16) + (x28 * c17) + (x32 * c18);
+	const GEN_FLT x40 = (x33 * x33) + (x36 * x36);
+	const GEN_FLT x41 = x39 * (1. / sqrt(x40)) * c19;
+	const GEN_FLT x43 = asin(x39 * c20 * (1. / sqrt(x40 + (x39 * x39))));
+	const GEN_FLT x44 = curve_1 + (ogeePhase_1 * sin(ogeeMag_1 + x37 + (-1 * asin(x41))));
+	const GEN_FLT x45 = 0.0028679863 + (x43 * (-8.0108022e-06 + (-8.0108022e-06 * x43)));
+	const GEN_FLT x46 = 5.3685255e-06 + (x43 * x45);
+	const GEN_FLT x47 = 0.0076069798 + (x43 * x46);
+	const GEN_FLT x48 = asin(x41 + (x44 * x47 * (x43 * x43) * (1. / (x42 + (-1 * x44 * ((x43 * x47) + (x43 * (x47 +
+		(x43 * (x46 + (x43 * (x45 + (x43 * (-8.0108022e-06 + (-1.60216044e-05 * x43)))))))))) * c21)))));
+	out[0] = -1.5707963267949 + x37 + c22 + (-1 * x48) + (gibMag_1 * sin(gibPhase_1 + x37 + (-1 * x48)));
+}
+
+// Value of reproject_axis_y_gen2 then its jacobian wrt obj_p
+enum { gen_reproject_axis_y_gen2_val_jac_obj_p_axis_angle_prepared_size = 72 };
+
+static inline void gen_reproject_axis_y_gen2_val_jac_obj_p_axis_angle_prepare(FLT *prepared,
+																			  const LinmathAxisAnglePose *obj_p,
+																			  const LinmathAxisAnglePose *lh_p,
+																			  const BaseStationCal *bsc1) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_1 = (*bsc1).phase;
+	const GEN_FLT tilt_1 = (*bsc1).tilt;
+	const GEN_FLT curve_1 = (*bsc1).curve;
+	const GEN_FLT gibPhase_1 = (*bsc1).gibpha;
+	const GEN_FLT gibMag_1 = (*bsc1).gibmag;
+	const GEN_FLT ogeeMag_1 = (*bsc1).ogeephase;
+	const GEN_FLT ogeePhase_1 = (*bsc1).ogeemag;
+	const GEN_FLT x0 = lh_qi * lh_qi;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qk * lh_qk;
+	const GEN_FLT x3 = 1e-10 + x0 + x1 + x2;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = cos(x4);
+	const GEN_FLT x6 = (1. / x3) * (1 + (-1 * x5));
+	const GEN_FLT x7 = x2 * x6;
+	const GEN_FLT x8 = x5 + x7;
+	const GEN_FLT x9 = obj_qi * obj_qi;
+	const GEN_FLT x10 = obj_qj * obj_qj;
+	const GEN_FLT x11 = obj_qk * obj_qk;
+	const GEN_FLT x12 = 1e-10 + x10 + x11 + x9;
+	const GEN_FLT x13 = sqrt(x12);
+	const GEN_FLT x14 = cos(x13);
+	const GEN_FLT x15 = 1. / x12;
+	const GEN_FLT x16 = 1 + (-1 * x14);
+	const GEN_FLT x17 = x15 * x16;
+	const GEN_FLT x18 = sin(x13);
+	const GEN_FLT x19 = x18 * (1. / x13);
+	const GEN_FLT x20 = obj_qi * x19;
+	const GEN_FLT x21 = obj_qj * x17;
+	const GEN_FLT x22 = obj_qj * x19;
+	const GEN_FLT x23 = obj_qk * x17;
+	const GEN_FLT x24 = obj_qi * x23;
+	const GEN_FLT x26 = 1. / x4;
+	const GEN_FLT x27 = sin(x4);
+	const GEN_FLT x28 = x26 * x27;
+	const GEN_FLT x29 = lh_qi * x28;
+	const GEN_FLT x30 = lh_qj * lh_qk * x6;
+	const GEN_FLT x31 = x29 + x30;
+	const GEN_FLT x32 = obj_qk * x19;
+	const GEN_FLT x33 = obj_qi * x21;
+	const GEN_FLT x35 = lh_qj * x28;
+	const GEN_FLT x36 = lh_qi * x6;
+	const GEN_FLT x37 = lh_qk * x36;
+	const GEN_FLT x38 = x37 + (-1 * x35);
+	const GEN_FLT x42 = x0 * x6;
+	const GEN_FLT x43 = x42 + x5;
+	const GEN_FLT x44 = x35 + x37;
+	const GEN_FLT x45 = lh_qk * x28;
+	const GEN_FLT x46 = lh_qj * x36;
+	const GEN_FLT x47 = x46 + (-1 * x45);
+	const GEN_FLT x50 = x1 * x6;
+	const GEN_FLT x51 = x5 + x50;
+	const GEN_FLT x52 = x45 + x46;
+	const GEN_FLT x53 = x30 + (-1 * x29);
+	const GEN_FLT x56 = -0.523598775598299 + tilt_1;
+	const GEN_FLT x57 = tan(x56);
+	const GEN_FLT x62 = cos(x56);
+	const GEN_FLT x63 = 1. / x62;
+	const GEN_FLT x80 = sin(x56);
+	const GEN_FLT x91 = 2 * x45;
+	const GEN_FLT x92 = 2 * x46;
+	const GEN_FLT x94 = 2 * x5;
+	const GEN_FLT x96 = 2 * x37;
+	const GEN_FLT x121 = 2 * x29;
+	const GEN_FLT x122 = 2 * x30;
+	const GEN_FLT x143 = 1. / (x12 * sqrt(x12));
+	const GEN_FLT x144 = 2 * x16 * (1. / (x12 * x12));
+	const GEN_FLT x145 = obj_qi * x144;
+	const GEN_FLT x146 = x10 * x145;
+	const GEN_FLT x147 = x14 * x15;
+	const GEN_FLT x148 = x143 * x18;
+	const GEN_FLT x149 = x148 * x9;
+	const GEN_FLT x150 = x19 + (-1 * x149) + (x147 * x9);
+	const GEN_FLT x151 = obj_qi * obj_qk;
+	const GEN_FLT x152 = obj_qj * x144;
+	const GEN_FLT x153 = x151 * x152;
+	const GEN_FLT x154 = x153 + (-1 * obj_qi * obj_qj * obj_qk * x143 * x18);
+	const GEN_FLT x155 = x144 * x9;
+	const GEN_FLT x156 = obj_qj * x155;
+	const GEN_FLT x157 = x21 + (-1 * x156) + (obj_qj * x149);
+	const GEN_FLT x158 = x147 * x151;
+	const GEN_FLT x159 = x148 * x151;
+	const GEN_FLT x160 = x158 + (-1 * x159);
+	const GEN_FLT x163 = x11 * x145;
+	const GEN_FLT x164 = (-1 * x153) + (obj_qj * x159);
+	const GEN_FLT x165 = obj_qk * x155;
+	const GEN_FLT x166 = x23 + (-1 * x165) + (obj_qk * x149);
+	const GEN_FLT x167 = obj_qi * obj_qj;
+	const GEN_FLT x168 = x148 * x167;
+	const GEN_FLT x169 = x147 * x167;
+	const GEN_FLT x170 = x168 + (-1 * x169);
+	const GEN_FLT x173 = obj_qi * obj_qi * obj_qi;
+	const GEN_FLT x174 = x159 + (-1 * x158);
+	const GEN_FLT x175 = x169 + (-1 * x168);
+	const GEN_FLT x194 = x164 + x19;
+	const GEN_FLT x195 = x10 * x148;
+	const GEN_FLT x196 = (-1 * x195) + (x10 * x147);
+	const GEN_FLT x197 = obj_qi * x17;
+	const GEN_FLT x198 = x197 + (-1 * x146) + (obj_qi * x195);
+	const GEN_FLT x199 = obj_qj * obj_qk;
+	const GEN_FLT x200 = x148 * x199;
+	const GEN_FLT x201 = x147 * x199;
+	const GEN_FLT x202 = x200 + (-1 * x201);
+	const GEN_FLT x205 = x11 * x152;
+	const GEN_FLT x206 = x154 + x19;
+	const GEN_FLT x207 = obj_qk * x10 * x144;
+	const GEN_FLT x208 = x23 + (-1 * x207) + (obj_qk * x195);
+	const GEN_FLT x211 = obj_qj * obj_qj * obj_qj;
+	const GEN_FLT x212 = x201 + (-1 * x200);
+	const GEN_FLT x231 = x11 * x148;
+	const GEN_FLT x232 = (-1 * x231) + (x11 * x147);
+	const GEN_FLT x233 = x21 + (-1 * x205) + (obj_qj * x231);
+	const GEN_FLT x236 = x197 + (-1 * x163) + (obj_qi * x231);
+	const GEN_FLT x239 = obj_qk * obj_qk * obj_qk;
+	const GEN_FLT c0 = x24 + (-1 * x22);
+	const GEN_FLT c1 = x20 + (obj_qk * x21);
+	const GEN_FLT c2 = x14 + (x11 * x17);
+	const GEN_FLT c3 = x32 + x33;
+	const GEN_FLT c4 = x14 + (x10 * x17);
+	const GEN_FLT c5 = (-1 * x20) + (obj_qj * obj_qk * x15 * x16);
+	const GEN_FLT c6 = x14 + (x17 * x9);
+	const GEN_FLT c7 = x33 + (-1 * x32);
+	const GEN_FLT c8 = x22 + x24;
+	const GEN_FLT c9 = 1. / (x62 * x62);
+	const GEN_FLT c10 = x94 + (2 * x42);
+	const GEN_FLT c11 = (-1 * x96) + (2 * lh_qj * x26 * x27);
+	const GEN_FLT c12 = x91 + x92;
+	const GEN_FLT c13 = x57 * x57;
+	const GEN_FLT c14 = x92 + (-1 * x91);
+	const GEN_FLT c15 = (-1 * x121) + (-1 * x122);
+	const GEN_FLT c16 = x94 + (2 * x50);
+	const GEN_FLT c17 = x96 + (2 * x35);
+	const GEN_FLT c18 = (-1 * x94) + (-2 * x7);
+	const GEN_FLT c19 = x122 + (-1 * x121);
+	const GEN_FLT c20 = x157 + x160;
+	const GEN_FLT c21 = (-1 * x146) + (-1 * x20) + (obj_qi * x10 * x143 * x18);
+	const GEN_FLT c22 = (-1 * x150) + (-1 * x154);
+	const GEN_FLT c23 = x166 + x170;
+	const GEN_FLT c24 = x150 + x164;
+	const GEN_FLT c25 = (-1 * x163) + (-1 * x20) + (obj_qi * x11 * x143 * x18);
+	const GEN_FLT c26 = (-1 * x20) + (-1 * x144 * x173) + (x143 * x173 * x18) + (2 * obj_qi * x15 * x16);
+	const GEN_FLT c27 = x157 + x174;
+	const GEN_FLT c28 = x166 + x175;
+	const GEN_FLT c29 = (-1 * x156) + (-1 * x22) + (obj_qj * x143 * x18 * x9);
+	const GEN_FLT c30 = x198 + x202;
+	const GEN_FLT c31 = x194 + x196;
+	const GEN_FLT c32 = (-1 * x196) + (-1 * x206);
+	const GEN_FLT c33 = x175 + x208;
+	const GEN_FLT c34 = (-1 * x205) + (-1 * x22) + (obj_qj * x11 * x143 * x18);
+	const GEN_FLT c35 = x198 + x212;
+	const GEN_FLT c36 = (-1 * x22) + (-1 * x144 * x211) + (x143 * x18 * x211) + (2 * obj_qj * x15 * x16);
+	const GEN_FLT c37 = x170 + x208;
+	const GEN_FLT c38 = x194 + x232;
+	const GEN_FLT c39 = (-1 * x207) + (-1 * x32) + (obj_qk * x10 * x143 * x18);
+	const GEN_FLT c40 = x174 + x233;
+	const GEN_FLT c41 = (-1 * x165) + (-1 * x32) + (obj_qk * x143 * x18 * x9);
+	const GEN_FLT c42 = (-1 * x206) + (-1 * x232);
+	const GEN_FLT c43 = x212 + x236;
+	const GEN_FLT c44 = x202 + x236;
+	const GEN_FLT c45 = x160 + x233;
+	const GEN_FLT c46 = (-1 * x32) + (-1 * x144 * x239) + (x143 * x18 * x239) + (2 * obj_qk * x15 * x16);
+	const GEN_FLT c47 = -1 * phase_1;
+	prepared[0] = obj_px;
+	prepared[1] = obj_py;
+	prepared[2] = obj_pz;
+	prepared[3] = lh_px;
+	prepared[4] = lh_py;
+	prepared[5] = lh_pz;
+	prepared[6] = curve_1;
+	prepared[7] = gibPhase_1;
+	prepared[8] = gibMag_1;
+	prepared[9] = ogeeMag_1;
+	prepared[10] = ogeePhase_1;
+	prepared[11] = x8;
+	prepared[12] = x31;
+	prepared[13] = x38;
+	prepared[14] = x43;
+	prepared[15] = x44;
+	prepared[16] = x47;
+	prepared[17] = x51;
+	prepared[18] = x52;
+	prepared[19] = x53;
+	prepared[20] = x57;
+	prepared[21] = x62;
+	prepared[22] = x63;
+	prepared[23] = x80;
+	prepared[24] = c0;
+	prepared[25] = c1;
+	prepared[26] = c2;
+	prepared[27] = c3;
+	prepared[28] = c4;
+	prepared[29] = c5;
+	prepared[30] = c6;
+	prepared[31] = c7;
+	prepared[32] = c8;
+	prepared[33] = c9;
+	prepared[34] = c10;
+	prepared[35] = c11;
+	prepared[36] = c12;
+	prepared[37] = c13;
+	prepared[38] = c14;
+	prepared[39] = c15;
+	prepared[40] = c16;
+	prepared[41] = c17;
+	prepared[42] = c18;
+	prepared[43] = c19;
+	prepared[44] = c20;
+	prepared[45] = c21;
+	prepared[46] = c22;
+	prepared[47] = c23;
+	prepared[48] = c24;
+	prepared[49] = c25;
+	prepared[50] = c26;
+	prepared[51] = c27;
+	prepared[52] = c28;
+	prepared[53] = c29;
+	prepared[54] = c30;
+	prepared[55] = c31;
+	prepared[56] = c32;
+	prepared[57] = c33;
+	prepared[58] = c34;
+	prepared[59] = c35;
+	prepared[60] = c36;
+	prepared[61] = c37;
+	prepared[62] = c38;
+	prepared[63] = c39;
+	prepared[64] = c40;
+	prepared[65] = c41;
+	prepared[66] = c42;
+	prepared[67] = c43;
+	prepared[68] = c44;
+	prepared[69] = c45;
+	prepared[70] = c46;
+	prepared[71] = c47;
+}
+
+static inline void gen_reproject_axis_y_gen2_val_jac_obj_p_axis_angle_eval(FLT *out, const FLT *prepared,
+																		   const FLT *sensor_pt) {
+	const GEN_FLT obj_px = prepared[0];
+	const GEN_FLT obj_py = prepared[1];
+	const GEN_FLT obj_pz = prepared[2];
+	const GEN_FLT lh_px = prepared[3];
+	const GEN_FLT lh_py = prepared[4];
+	const GEN_FLT lh_pz = prepared[5];
+	const GEN_FLT curve_1 = prepared[6];
+	const GEN_FLT gibPhase_1 = prepared[7];
+	const GEN_FLT gibMag_1 = prepared[8];
+	const GEN_FLT ogeeMag_1 = prepared[9];
+	const GEN_FLT ogeePhase_1 = prepared[10];
+	const GEN_FLT x8 = prepared[11];
+	const GEN_FLT x31 = prepared[12];
+	const GEN_FLT x38 = prepared[13];
+	const GEN_FLT x43 = prepared[14];
+	const GEN_FLT x44 = prepared[15];
+	const GEN_FLT x47 = prepared[16];
+	const GEN_FLT x51 = prepared[17];
+	const GEN_FLT x52 = prepared[18];
+	const GEN_FLT x53 = prepared[19];
+	const GEN_FLT x57 = prepared[20];
+	const GEN_FLT x62 = prepared[21];
+	const GEN_FLT x63 = prepared[22];
+	const GEN_FLT x80 = prepared[23];
+	const GEN_FLT c0 = prepared[24];
+	const GEN_FLT c1 = prepared[25];
+	const GEN_FLT c2 = prepared[26];
+	const GEN_FLT c3 = prepared[27];
+	const GEN_FLT c4 = prepared[28];
+	const GEN_FLT c5 = prepared[29];
+	const GEN_FLT c6 = prepared[30];
+	const GEN_FLT c7 = prepared[31];
+	const GEN_FLT c8 = prepared[32];
+	const GEN_FLT c9 = prepared[33];
+	const GEN_FLT c10 = prepared[34];
+	const GEN_FLT c11 = prepared[35];
+	const GEN_FLT c12 = prepared[36];
+	const GEN_FLT c13 = prepared[37];
+	const GEN_FLT c14 = prepared[38];
+	const GEN_FLT c15 = prepared[39];
+	const GEN_FLT c16 = prepared[40];
+	const GEN_FLT c17 = prepared[41];
+	const GEN_FLT c18 = prepared[42];
+	const GEN_FLT c19 = prepared[43];
+	const GEN_FLT c20 = prepared[44];
+	const GEN_FLT c21 = prepared[45];
+	const GEN_FLT c22 = prepared[46];
+	const GEN_FLT c23 = prepared[47];
+	const GEN_FLT c24 = prepared[48];
+	const GEN_FLT c25 = prepared[49];
+	const GEN_FLT c26 = prepared[50];
+	const GEN_FLT c27 = prepared[51];
+	const GEN_FLT c28 = prepared[52];
+	const GEN_FLT c29 = prepared[53];
+	const GEN_FLT c30 = prepared[54];
+	const GEN_FLT c31 = prepared[55];
+	const GEN_FLT c32 = prepared[56];
+	const GEN_FLT c33 = prepared[57];
+	const GEN_FLT c34 = prepared[58];
+	const GEN_FLT c35 = prepared[59];
+	const GEN_FLT c36 = prepared[60];
+	const GEN_FLT c37 = prepared[61];
+	const GEN_FLT c38 = prepared[62];
+	const GEN_FLT c39 = prepared[63];
+	const GEN_FLT c40 = prepared[64];
+	const GEN_FLT c41 = prepared[65];
+	const GEN_FLT c42 = prepared[66];
+	const GEN_FLT c43 = prepared[67];
+	const GEN_FLT c44 = prepared[68];
+	const GEN_FLT c45 = prepared[69];
+	const GEN_FLT c46 = prepared[70];
+	const GEN_FLT c47 = prepared[71];
+	const GEN_FLT sensor_x = sensor_pt[0];
+	const GEN_FLT sensor_y = sensor_pt[1];
+	const GEN_FLT sensor_z = sensor_pt[2];
+	const GEN_FLT x25 = obj_pz + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLT x34 = obj_py + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLT x39 = obj_px + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLT x40 = lh_pz + (x25 * x8) + (x31 * x34) + (x38 * x39);
+	const GEN_FLT x41 = -1 * x40;
+	const GEN_FLT x48 = lh_px + (x25 * x44) + (x34 * x47) + (x39 * x43);
+	const GEN_FLT x49 = atan2(x41, x48);
+	const GEN_FLT x54 = lh_py + (x25 * x53) + (x34 * x51) + (x39 * x52);
+	const GEN_FLT x55 = (x41 * x41) + (x48 * x48);
+	const GEN_FLT x58 = x57 * (1. / sqrt(x55));
+	const GEN_FLT x59 = x54 * x58;
+	const GEN_FLT x60 = x54 * x54;
+	const GEN_FLT x61 = x55 + x60;
+	const GEN_FLT x64 = x63 * (1. / sqrt(x61));
+	const GEN_FLT x65 = asin(x54 * x64);
+	const GEN_FLT x66 = 8.0108022e-06 * x65;
+	const GEN_FLT x67 = -8.0108022e-06 + (-1 * x66);
+	const GEN_FLT x68 = 0.0028679863 + (x65 * x67);
+	const GEN_FLT x69 = 5.3685255e-06 + (x65 * x68);
+	const GEN_FLT x70 = 0.0076069798 + (x65 * x69);
+	const GEN_FLT x71 = x65 * x65;
+	const GEN_FLT x72 = ogeeMag_1 + x49 + (-1 * asin(x59));
+	const GEN_FLT x73 = curve_1 + (ogeePhase_1 * sin(x72));
+	const GEN_FLT x74 = x65 * x70;
+	const GEN_FLT x75 = -8.0108022e-06 + (-1.60216044e-05 * x65);
+	const GEN_FLT x76 = x68 + (x65 * x75);
+	const GEN_FLT x77 = x69 + (x65 * x76);
+	const GEN_FLT x78 = x70 + (x65 * x77);
+	const GEN_FLT x79 = x74 + (x65 * x78);
+	const GEN_FLT x81 = x73 * x80;
+	const GEN_FLT x82 = x62 + (-1 * x79 * x81);
+	const GEN_FLT x83 = 1. / x82;
+	const GEN_FLT x84 = x73 * x83;
+	const GEN_FLT x85 = x71 * x84;
+	const GEN_FLT x86 = x59 + (x70 * x85);
+	const GEN_FLT x87 = asin(x86);
+	const GEN_FLT x88 = gibPhase_1 + x49 + (-1 * x87);
+	const GEN_FLT x89 = 1. / sqrt(1 + (-1 * (x86 * x86)));
+	const GEN_FLT x90 = 1. / sqrt(1 + (-1 * x60 * (1. / x61) * c9));
+	const GEN_FLT x93 = 1.0/2.0 * x54;
+	const GEN_FLT x95 = 1.0/2.0 * x48;
+	const GEN_FLT x97 = 1.0/2.0 * x41;
+	const GEN_FLT x98 = (x95 * c10) + (x97 * c11);
+	const GEN_FLT x99 = x54 * x63 * (1. / (x61 * sqrt(x61)));
+	const GEN_FLT x100 = x90 * ((x52 * x64) + (x99 * ((-1 * x98) + (-1 * x93 * c12))));
+	const GEN_FLT x101 = x100 * x67;
+	const GEN_FLT x102 = (x100 * x68) + (x65 * (x101 + (-1 * x100 * x66)));
+	const GEN_FLT x103 = (x100 * x69) + (x102 * x65);
+	const GEN_FLT x104 = 1. / x55;
+	const GEN_FLT x105 = 1. / sqrt(1 + (-1 * x104 * x60 * c13));
+	const GEN_FLT x106 = x54 * x57 * (1. / (x55 * sqrt(x55)));
+	const GEN_FLT x107 = (x52 * x58) + (-1 * x106 * x98);
+	const GEN_FLT x108 = x104 * x48;
+	const GEN_FLT x109 = x104 * x40;
+	const GEN_FLT x110 = (x109 * x43) + (-1 * x108 * x38);
+	const GEN_FLT x111 = ogeePhase_1 * cos(x72);
+	const GEN_FLT x112 = x111 * (x110 + (-1 * x105 * x107));
+	const GEN_FLT x113 = x79 * x80;
+	const GEN_FLT x114 = 2.40324066e-05 * x65;
+	const GEN_FLT x115 = x70 * x71;
+	const GEN_FLT x116 = x115 * x73 * (1. / (x82 * x82));
+	const GEN_FLT x117 = x115 * x83;
+	const GEN_FLT x118 = 2 * x74 * x84;
+	const GEN_FLT x119 = x110 + (-1 * x89 * (x107 + (x100 * x118) + (x103 * x85) + (x112 * x117) + (x116 * ((x112 *
+		x113) + (x81 * ((x100 * x70) + (x100 * x78) + (x103 * x65) + (x65 * (x103 + (x100 * x77) + (x65 * (x102 + (x100
+		* x76) + (x65 * (x101 + (x100 * x75) + (-1 * x100 * x114)))))))))))));
+	const GEN_FLT x120 = gibMag_1 * cos(x88);
+	const GEN_FLT x123 = (x95 * c14) + (x97 * c15);
+	const GEN_FLT x124 = x90 * ((x51 * x64) + (x99 * ((-1 * x123) + (-1 * x93 * c16))));
+	const GEN_FLT x125 = x124 * x67;
+	const GEN_FLT x126 = (x124 * x68) + (x65 * (x125 + (-1 * x124 * x66)));
+	const GEN_FLT x127 = (x124 * x69) + (x126 * x65);
+	const GEN_FLT x128 = (x51 * x58) + (-1 * x106 * x123);
+	const GEN_FLT x129 = (x109 * x47) + (-1 * x108 * x31);
+	const GEN_FLT x130 = x129 + (-1 * x105 * x128);
+	const GEN_FLT x131 = x111 * x113;
+	const GEN_FLT x132 = x111 * x117;
+	const GEN_FLT x133 = x129 + (-1 * x89 * (x128 + (x116 * ((x130 * x131) + (x81 * ((x124 * x70) + (x124 * x78) +
+		(x127 * x65) + (x65 * (x127 + (x124 * x77) + (x65 * (x126 + (x124 * x76) + (x65 * (x125 + (x124 * x75) + (-1 *
+		x114 * x124))))))))))) + (x118 * x124) + (x127 * x85) + (x130 * x132)));
+	const GEN_FLT x134 = (x95 * c17) + (x97 * c18);
+	const GEN_FLT x135 = x90 * ((x53 * x64) + (x99 * ((-1 * x134) + (-1 * x93 * c19))));
+	const GEN_FLT x136 = x135 * x67;
+	const GEN_FLT x137 = (x135 * x68) + (x65 * (x136 + (-1 * x135 * x66)));
+	const GEN_FLT x138 = (x135 * x69) + (x137 * x65);
+	const GEN_FLT x139 = (x53 * x58) + (-1 * x106 * x134);
+	const GEN_FLT x140 = (x109 * x44) + (-1 * x108 * x8);
+	const GEN_FLT x141 = x140 + (-1 * x105 * x139);
+	const GEN_FLT x142 = x140 + (-1 * x89 * (x139 + (x116 * ((x131 * x141) + (x81 * ((x135 * x70) + (x135 * x78) +
+		(x138 * x65) + (x65 * (x138 + (x135 * x77) + (x65 * (x137 + (x135 * x76) + (x65 * (x136 + (x135 * x75) + (-1 *
+		x114 * x135))))))))))) + (x118 * x135) + (x132 * x141) + (x138 * x85)));
+	const GEN_FLT x161 = (sensor_x * c20) + (sensor_y * c21) + (sensor_z * c22);
+	const GEN_FLT x162 = x161 * x51;
+	const GEN_FLT x171 = (sensor_x * c23) + (sensor_y * c24) + (sensor_z * c25);
+	const GEN_FLT x172 = x171 * x53;
+	const GEN_FLT x176 = (sensor_x * c26) + (sensor_y * c27) + (sensor_z * c28);
+	const GEN_FLT x177 = x176 * x52;
+	const GEN_FLT x178 = x162 + x172 + x177;
+	const GEN_FLT x179 = x171 * x44;
+	const GEN_FLT x180 = x161 * x47;
+	const GEN_FLT x181 = x176 * x43;
+	const GEN_FLT x182 = x171 * x8;
+	const GEN_FLT x183 = x161 * x31;
+	const GEN_FLT x184 = x176 * x38;
+	const GEN_FLT x185 = (x95 * ((2 * x179) + (2 * x180) + (2 * x181))) + (x97 * ((-2 * x182) + (-2 * x183) + (-2 *
+		x184)));
+	const GEN_FLT x186 = x90 * ((x178 * x64) + (x99 * ((-1 * x185) + (-1 * x93 * ((2 * x162) + (2 * x172) + (2 *
+		x177))))));
+	const GEN_FLT x187 = x186 * x67;
+	const GEN_FLT x188 = (x186 * x68) + (x65 * (x187 + (-1 * x186 * x66)));
+	const GEN_FLT x189 = (x186 * x69) + (x188 * x65);
+	const GEN_FLT x190 = (x178 * x58) + (-1 * x106 * x185);
+	const GEN_FLT x191 = (x108 * ((-1 * x182) + (-1 * x183) + (-1 * x184))) + (x109 * (x179 + x180 + x181));
+	const GEN_FLT x192 = x191 + (-1 * x105 * x190);
+	const GEN_FLT x193 = x191 + (-1 * x89 * (x190 + (x116 * ((x131 * x192) + (x81 * ((x186 * x70) + (x186 * x78) +
+		(x189 * x65) + (x65 * (x189 + (x186 * x77) + (x65 * (x188 + (x186 * x76) + (x65 * (x187 + (x186 * x75) + (-1 *
+		x114 * x186))))))))))) + (x118 * x186) + (x132 * x192) + (x189 * x85)));
+	const GEN_FLT x203 = (sensor_x * c29) + (sensor_y * c30) + (sensor_z * c31);
+	const GEN_FLT x204 = x203 * x52;
+	const GEN_FLT x209 = (sensor_x * c32) + (sensor_y * c33) + (sensor_z * c34);
+	const GEN_FLT x210 = x209 * x53;
+	const GEN_FLT x213 = (sensor_x * c35) + (sensor_y * c36) + (sensor_z * c37);
+	const GEN_FLT x214 = x213 * x51;
+	const GEN_FLT x215 = x204 + x210 + x214;
+	const GEN_FLT x216 = x203 * x43;
+	const GEN_FLT x217 = x209 * x44;
+	const GEN_FLT x218 = x213 * x47;
+	const GEN_FLT x219 = x209 * x8;
+	const GEN_FLT x220 = x203 * x38;
+	const GEN_FLT x221 = x213 * x31;
+	const GEN_FLT x222 = (x95 * ((2 * x216) + (2 * x217) + (2 * x218))) + (x97 * ((-2 * x219) + (-2 * x220) + (-2 *
+		x221)));
+	const GEN_FLT x223 = x90 * ((x215 * x64) + (x99 * ((-1 * x222) + (-1 * x93 * ((2 * x204) + (2 * x210) + (2 *
+		x214))))));
+	const GEN_FLT x224 = x223 * x67;
+	const GEN_FLT x225 = (x223 * x68) + (x65 * (x224 + (-1 * x223 * x66)));
+	const GEN_FLT x226 = (x223 * x69) + (x225 * x65);
+	const GEN_FLT x227 = (x215 * x58) + (-1 * x106 * x222);
+	const GEN_FLT x228 = (x108 * ((-1 * x219) + (-1 * x220) + (-1 * x221))) + (x109 * (x216 + x217 + x218));
+	const GEN_FLT x229 = x228 + (-1 * x105 * x227);
+	const GEN_FLT x230 = x228 + (-1 * x89 * (x227 + (x116 * ((x131 * x229) + (x81 * ((x223 * x70) + (x223 * x78) +
+		(x226 * x65) + (x65 * (x226 + (x223 * x77) + (x65 * (x225 + (x223 * x76) + (x65 * (x224 + (x223 * x75) + (-1 *
+		x114 * x223))))))))))) + (x118 * x223) + (x132 * x229) + (x226 * x85)));
+	const GEN_FLT x234 = (sensor_x * c38) + (sensor_y * c39) + (sensor_z * c40);
+	const GEN_FLT x235 = x234 * x51;
+	const GEN_FLT x237 = (sensor_x * c41) + (sensor_y * c42) + (sensor_z * c43);
+	const GEN_FLT x238 = x237 * x52;
+	const GEN_FLT x240 = (sensor_x * c44) + (sensor_y * c45) + (sensor_z * c46);
+	const GEN_FLT x241 = x240 * x53;
+	const GEN_FLT x242 = x235 + x238 + x241;
+	const GEN_FLT x243 = x237 * x43;
+	const GEN_FLT x244 = x234 * x47;
+	const GEN_FLT x245 = x240 * x44;
+	const GEN_FLT x246 = x234 * x31;
+	const GEN_FLT x247 = x237 * x38;
+	const GEN_FLT x248 = x240 * x8;
+	const GEN_FLT x249 = (x95 * ((2 * x243) + (2 * x244) + (2 * x245))) + (x97 * ((-2 * x246) + (-2 * x247) + (-2 *
+		x248)));
+	const GEN_FLT x250 = x90 * ((x242 * x64) + (x99 * ((-1 * x249) + (-1 * x93 * ((2 * x235) + (2 * x238) + (2 *
+		x241))))));
+	const GEN_FLT x251 = x250 * x67;
+	const GEN_FLT x252 = (x250 * x68) + (x65 * (x251 + (-1 * x250 * x66)));
+	const GEN_FLT x253 = (x250 * x69) + (x252 * x65);
+	const GEN_FLT x254 = (x242 * x58) + (-1 * x106 * x249);
+	const GEN_FLT x255 = (x108 * ((-1 * x246) + (-1 * x247) + (-1 * x248))) + (x109 * (x243 + x244 + x245));
+	const GEN_FLT x256 = x255 + (-1 * x105 * x254);
+	const GEN_FLT x257 = x255 + (-1 * x89 * (x254 + (x116 * ((x131 * x256) + (x81 * ((x250 * x70) + (x250 * x78) +
+		(x253 * x65) + (x65 * (x253 + (x250 * x77) + (x65 * (x252 + (x250 * x76) + (x65 * (x251 + (x250 * x75) + (-1 *
+		x114 * x250))))))))))) + (x118 * x250) + (x132 * x256) + (x253 * x85)));
+	out[0] = -1.5707963267949 + x49 + c47 + (-1 * x87) + (gibMag_1 * sin(x88));
+	out[1] = x119 + (x119 * x120);
+	out[2] = x133 + (x120 * x133);
+	out[3] = x142 + (x120 * x142);
+	out[4] = x193 + (x120 * x193);
+	out[5] = x230 + (x120 * x230);
+	out[6] = x257 + (x120 * x257);
+}
+
+// Value of reproject_axis_y_gen2 then its jacobian wrt obj_p, lh_p
+enum { gen_reproject_axis_y_gen2_val_jac_obj_p_lh_p_axis_angle_prepared_size = 99 };
+
+static inline void gen_reproject_axis_y_gen2_val_jac_obj_p_lh_p_axis_angle_prepare(FLT *prepared,
+																				   const LinmathAxisAnglePose *obj_p,
+																				   const LinmathAxisAnglePose *lh_p,
+																				   const BaseStationCal *bsc1) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_1 = (*bsc1).phase;
+	const GEN_FLT tilt_1 = (*bsc1).tilt;
+	const GEN_FLT curve_1 = (*bsc1).curve;
+	const GEN_FLT gibPhase_1 = (*bsc1).gibpha;
+	const GEN_FLT gibMag_1 = (*bsc1).gibmag;
+	const GEN_FLT ogeeMag_1 = (*bsc1).ogeephase;
+	const GEN_FLT ogeePhase_1 = (*bsc1).ogeemag;
+	const GEN_FLT x0 = lh_qi * lh_qi;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qk * lh_qk;
+	const GEN_FLT x3 = 1e-10 + x0 + x1 + x2;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = cos(x4);
+	const GEN_FLT x6 = 1. / x3;
+	const GEN_FLT x7 = 1 + (-1 * x5);
+	const GEN_FLT x8 = x6 * x7;
+	const GEN_FLT x9 = x2 * x8;
+	const GEN_FLT x10 = x5 + x9;
+	const GEN_FLT x11 = obj_qi * obj_qi;
+	const GEN_FLT x12 = obj_qj * obj_qj;
+	const GEN_FLT x13 = obj_qk * obj_qk;
+	const GEN_FLT x14 = 1e-10 + x11 + x12 + x13;
+	const GEN_FLT x15 = sqrt(x14);
+	const GEN_FLT x16 = cos(x15);
+	const GEN_FLT x17 = 1. / x14;
+	const GEN_FLT x18 = 1 + (-1 * x16);
+	const GEN_FLT x19 = x17 * x18;
+	const GEN_FLT x20 = sin(x15);
+	const GEN_FLT x21 = x20 * (1. / x15);
+	const GEN_FLT x22 = obj_qi * x21;
+	const GEN_FLT x23 = obj_qj * x19;
+	const GEN_FLT x24 = obj_qj * x21;
+	const GEN_FLT x25 = obj_qk * x19;
+	const GEN_FLT x26 = obj_qi * x25;
+	const GEN_FLT x28 = 1. / x4;
+	const GEN_FLT x29 = sin(x4);
+	const GEN_FLT x30 = x28 * x29;
+	const GEN_FLT x31 = lh_qi * x30;
+	const GEN_FLT x32 = lh_qj * x8;
+	const GEN_FLT x33 = lh_qk * x32;
+	const GEN_FLT x34 = x31 + x33;
+	const GEN_FLT x35 = obj_qk * x21;
+	const GEN_FLT x36 = obj_qi * x23;
+	const GEN_FLT x38 = lh_qj * x30;
+	const GEN_FLT x39 = lh_qk * x8;
+	const GEN_FLT x40 = lh_qi * x39;
+	const GEN_FLT x41 = x40 + (-1 * x38);
+	const GEN_FLT x45 = x0 * x8;
+	const GEN_FLT x46 = x45 + x5;
+	const GEN_FLT x47 = x38 + x40;
+	const GEN_FLT x48 = lh_qk * x30;
+	const GEN_FLT x49 = lh_qi * x32;
+	const GEN_FLT x50 = x49 + (-1 * x48);
+	const GEN_FLT x53 = x1 * x8;
+	const GEN_FLT x54 = x5 + x53;
+	const GEN_FLT x55 = x48 + x49;
+	const GEN_FLT x56 = x33 + (-1 * x31);
+	const GEN_FLT x58 = -0.523598775598299 + tilt_1;
+	const GEN_FLT x59 = tan(x58);
+	const GEN_FLT x63 = cos(x58);
+	const GEN_FLT x64 = 1. / x63;
+	const GEN_FLT x83 = sin(x58);
+	const GEN_FLT x94 = 2 * x48;
+	const GEN_FLT x95 = 2 * x49;
+	const GEN_FLT x97 = 2 * x5;
+	const GEN_FLT x99 = 2 * x40;
+	const GEN_FLT x125 = 2 * x31;
+	const GEN_FLT x126 = 2 * x33;
+	const GEN_FLT x147 = 1. / (x14 * sqrt(x14));
+	const GEN_FLT x148 = 2 * x18 * (1. / (x14 * x14));
+	const GEN_FLT x149 = obj_qi * x148;
+	const GEN_FLT x150 = x12 * x149;
+	const GEN_FLT x151 = x16 * x17;
+	const GEN_FLT x152 = x147 * x20;
+	const GEN_FLT x153 = x11 * x152;
+	const GEN_FLT x154 = x21 + (-1 * x153) + (x11 * x151);
+	const GEN_FLT x155 = obj_qi * obj_qk;
+	const GEN_FLT x156 = obj_qj * x148;
+	const GEN_FLT x157 = x155 * x156;
+	const GEN_FLT x158 = x157 + (-1 * obj_qi * obj_qj * obj_qk * x147 * x20);
+	const GEN_FLT x159 = x11 * x148;
+	const GEN_FLT x160 = obj_qj * x159;
+	const GEN_FLT x161 = x23 + (-1 * x160) + (obj_qj * x153);
+	const GEN_FLT x162 = x151 * x155;
+	const GEN_FLT x163 = x152 * x155;
+	const GEN_FLT x164 = x162 + (-1 * x163);
+	const GEN_FLT x167 = x13 * x149;
+	const GEN_FLT x168 = (-1 * x157) + (obj_qj * x163);
+	const GEN_FLT x169 = obj_qk * x159;
+	const GEN_FLT x170 = x25 + (-1 * x169) + (obj_qk * x153);
+	const GEN_FLT x171 = obj_qi * obj_qj;
+	const GEN_FLT x172 = x152 * x171;
+	const GEN_FLT x173 = x151 * x171;
+	const GEN_FLT x174 = x172 + (-1 * x173);
+	const GEN_FLT x177 = obj_qi * obj_qi * obj_qi;
+	const GEN_FLT x178 = x163 + (-1 * x162);
+	const GEN_FLT x179 = x173 + (-1 * x172);
+	const GEN_FLT x198 = x168 + x21;
+	const GEN_FLT x199 = x12 * x152;
+	const GEN_FLT x200 = (-1 * x199) + (x12 * x151);
+	const GEN_FLT x201 = obj_qi * x19;
+	const GEN_FLT x202 = x201 + (-1 * x150) + (obj_qi * x199);
+	const GEN_FLT x203 = obj_qj * obj_qk;
+	const GEN_FLT x204 = x152 * x203;
+	const GEN_FLT x205 = x151 * x203;
+	const GEN_FLT x206 = x204 + (-1 * x205);
+	const GEN_FLT x209 = x13 * x156;
+	const GEN_FLT x210 = x158 + x21;
+	const GEN_FLT x211 = obj_qk * x12 * x148;
+	const GEN_FLT x212 = x25 + (-1 * x211) + (obj_qk * x199);
+	const GEN_FLT x215 = obj_qj * obj_qj * obj_qj;
+	const GEN_FLT x216 = x205 + (-1 * x204);
+	const GEN_FLT x235 = x13 * x152;
+	const GEN_FLT x236 = (-1 * x235) + (x13 * x151);
+	const GEN_FLT x237 = x23 + (-1 * x209) + (obj_qj * x235);
+	const GEN_FLT x240 = x201 + (-1 * x167) + (obj_qi * x235);
+	const GEN_FLT x243 = obj_qk * obj_qk * obj_qk;
+	const GEN_FLT x284 = 1. / (x3 * sqrt(x3));
+	const GEN_FLT x285 = 2 * x7 * (1. / (x3 * x3));
+	const GEN_FLT x286 = lh_qi * x285;
+	const GEN_FLT x287 = x1 * x286;
+	const GEN_FLT x289 = x5 * x6;
+	const GEN_FLT x290 = x284 * x29;
+	const GEN_FLT x291 = x0 * x290;
+	const GEN_FLT x292 = x30 + (-1 * x291) + (x0 * x289);
+	const GEN_FLT x293 = lh_qi * lh_qk;
+	const GEN_FLT x294 = lh_qj * x285;
+	const GEN_FLT x295 = x293 * x294;
+	const GEN_FLT x296 = x295 + (-1 * lh_qi * lh_qj * lh_qk * x284 * x29);
+	const GEN_FLT x298 = x0 * x285;
+	const GEN_FLT x299 = lh_qj * x298;
+	const GEN_FLT x300 = x32 + (-1 * x299) + (lh_qj * x291);
+	const GEN_FLT x301 = x289 * x293;
+	const GEN_FLT x302 = x290 * x293;
+	const GEN_FLT x303 = x301 + (-1 * x302);
+	const GEN_FLT x306 = x2 * x286;
+	const GEN_FLT x308 = (-1 * x295) + (lh_qj * x302);
+	const GEN_FLT x310 = lh_qk * x298;
+	const GEN_FLT x311 = x39 + (-1 * x310) + (lh_qk * x291);
+	const GEN_FLT x312 = lh_qi * lh_qj;
+	const GEN_FLT x313 = x290 * x312;
+	const GEN_FLT x314 = x289 * x312;
+	const GEN_FLT x315 = x313 + (-1 * x314);
+	const GEN_FLT x317 = lh_qi * lh_qi * lh_qi;
+	const GEN_FLT x319 = x302 + (-1 * x301);
+	const GEN_FLT x321 = x314 + (-1 * x313);
+	const GEN_FLT x332 = lh_qj * lh_qj * lh_qj;
+	const GEN_FLT x334 = lh_qi * x8;
+	const GEN_FLT x335 = x1 * x290;
+	const GEN_FLT x336 = x334 + (-1 * x287) + (lh_qi * x335);
+	const GEN_FLT x337 = lh_qj * lh_qk;
+	const GEN_FLT x338 = x289 * x337;
+	const GEN_FLT x339 = x290 * x337;
+	const GEN_FLT x340 = x338 + (-1 * x339);
+	const GEN_FLT x342 = lh_qk * x1 * x285;
+	const GEN_FLT x343 = x39 + (-1 * x342) + (lh_qk * x335);
+	const GEN_FLT x347 = (-1 * x335) + (x1 * x289);
+	const GEN_FLT x348 = x30 + x308;
+	const GEN_FLT x350 = x339 + (-1 * x338);
+	const GEN_FLT x352 = x2 * x294;
+	const GEN_FLT x354 = x296 + x30;
+	const GEN_FLT x367 = x2 * x290;
+	const GEN_FLT x368 = (-1 * x367) + (x2 * x289);
+	const GEN_FLT x370 = x32 + (-1 * x352) + (lh_qj * x367);
+	const GEN_FLT x375 = x334 + (-1 * x306) + (lh_qi * x367);
+	const GEN_FLT x377 = lh_qk * lh_qk * lh_qk;
+	const GEN_FLT c0 = x26 + (-1 * x24);
+	const GEN_FLT c1 = x22 + (obj_qk * x23);
+	const GEN_FLT c2 = x16 + (x13 * x19);
+	const GEN_FLT c3 = x35 + x36;
+	const GEN_FLT c4 = x16 + (x12 * x19);
+	const GEN_FLT c5 = (-1 * x22) + (obj_qj * obj_qk * x17 * x18);
+	const GEN_FLT c6 = x16 + (x11 * x19);
+	const GEN_FLT c7 = x36 + (-1 * x35);
+	const GEN_FLT c8 = x24 + x26;
+	const GEN_FLT c9 = 1. / (x63 * x63);
+	const GEN_FLT c10 = (-1 * x99) + (2 * lh_qj * x28 * x29);
+	const GEN_FLT c11 = x97 + (2 * x45);
+	const GEN_FLT c12 = x94 + x95;
+	const GEN_FLT c13 = x59 * x59;
+	const GEN_FLT c14 = (-1 * x125) + (-1 * x126);
+	const GEN_FLT c15 = x95 + (-1 * x94);
+	const GEN_FLT c16 = x97 + (2 * x53);
+	const GEN_FLT c17 = (-1 * x97) + (-2 * x9);
+	const GEN_FLT c18 = x99 + (2 * x38);
+	const GEN_FLT c19 = x126 + (-1 * x125);
+	const GEN_FLT c20 = x161 + x164;
+	const GEN_FLT c21 = (-1 * x150) + (-1 * x22) + (obj_qi * x12 * x147 * x20);
+	const GEN_FLT c22 = (-1 * x154) + (-1 * x158);
+	const GEN_FLT c23 = x170 + x174;
+	const GEN_FLT c24 = x154 + x168;
+	const GEN_FLT c25 = (-1 * x167) + (-1 * x22) + (obj_qi * x13 * x147 * x20);
+	const GEN_FLT c26 = (-1 * x22) + (-1 * x148 * x177) + (x147 * x177 * x20) + (2 * obj_qi * x17 * x18);
+	const GEN_FLT c27 = x161 + x178;
+	const GEN_FLT c28 = x170 + x179;
+	const GEN_FLT c29 = (-1 * x160) + (-1 * x24) + (obj_qj * x11 * x147 * x20);
+	const GEN_FLT c30 = x202 + x206;
+	const GEN_FLT c31 = x198 + x200;
+	const GEN_FLT c32 = (-1 * x200) + (-1 * x210);
+	const GEN_FLT c33 = x179 + x212;
+	const GEN_FLT c34 = (-1 * x209) + (-1 * x24) + (obj_qj * x13 * x147 * x20);
+	const GEN_FLT c35 = x202 + x216;
+	const GEN_FLT c36 = (-1 * x24) + (-1 * x148 * x215) + (x147 * x20 * x215) + (2 * obj_qj * x17 * x18);
+	const GEN_FLT c37 = x174 + x212;
+	const GEN_FLT c38 = x198 + x236;
+	const GEN_FLT c39 = (-1 * x211) + (-1 * x35) + (obj_qk * x12 * x147 * x20);
+	const GEN_FLT c40 = x178 + x237;
+	const GEN_FLT c41 = (-1 * x169) + (-1 * x35) + (obj_qk * x11 * x147 * x20);
+	const GEN_FLT c42 = (-1 * x210) + (-1 * x236);
+	const GEN_FLT c43 = x216 + x240;
+	const GEN_FLT c44 = x206 + x240;
+	const GEN_FLT c45 = x164 + x237;
+	const GEN_FLT c46 = (-1 * x35) + (-1 * x148 * x243) + (x147 * x20 * x243) + (2 * obj_qk * x17 * x18);
+	const GEN_FLT c47 = (-1 * x287) + (-1 * x31) + (lh_qi * x1 * x284 * x29);
+	const GEN_FLT c48 = (-1 * x292) + (-1 * x296);
+	const GEN_FLT c49 = x300 + x303;
+	const GEN_FLT c50 = (-1 * x306) + (-1 * x31) + (lh_qi * x2 * x284 * x29);
+	const GEN_FLT c51 = x292 + x308;
+	const GEN_FLT c52 = x311 + x315;
+	const GEN_FLT c53 = (-1 * x31) + (-1 * x285 * x317) + (x284 * x29 * x317) + (2 * lh_qi * x6 * x7);
+	const GEN_FLT c54 = x300 + x319;
+	const GEN_FLT c55 = x311 + x321;
+	const GEN_FLT c56 = (-1 * x38) + (-1 * x285 * x332) + (x284 * x29 * x332) + (2 * lh_qj * x6 * x7);
+	const GEN_FLT c57 = x336 + x340;
+	const GEN_FLT c58 = x315 + x343;
+	const GEN_FLT c59 = (-1 * x299) + (-1 * x38) + (lh_qj * x0 * x284 * x29);
+	const GEN_FLT c60 = x347 + x348;
+	const GEN_FLT c61 = x336 + x350;
+	const GEN_FLT c62 = (-1 * x352) + (-1 * x38) + (lh_qj * x2 * x284 * x29);
+	const GEN_FLT c63 = (-1 * x347) + (-1 * x354);
+	const GEN_FLT c64 = x321 + x343;
+	const GEN_FLT c65 = (-1 * x342) + (-1 * x48) + (lh_qk * x1 * x284 * x29);
+	const GEN_FLT c66 = x348 + x368;
+	const GEN_FLT c67 = x319 + x370;
+	const GEN_FLT c68 = (-1 * x310) + (-1 * x48) + (lh_qk * x0 * x284 * x29);
+	const GEN_FLT c69 = (-1 * x354) + (-1 * x368);
+	const GEN_FLT c70 = x340 + x375;
+	const GEN_FLT c71 = (-1 * x48) + (-1 * x285 * x377) + (x284 * x29 * x377) + (2 * lh_qk * x6 * x7);
+	const GEN_FLT c72 = x350 + x375;
+	const GEN_FLT c73 = x303 + x370;
+	const GEN_FLT c74 = -1 * phase_1;
+	prepared[0] = obj_px;
+	prepared[1] = obj_py;
+	prepared[2] = obj_pz;
+	prepared[3] = lh_px;
+	prepared[4] = lh_py;
+	prepared[5] = lh_pz;
+	prepared[6] = curve_1;
+	prepared[7] = gibPhase_1;
+	prepared[8] = gibMag_1;
+	prepared[9] = ogeeMag_1;
+	prepared[10] = ogeePhase_1;
+	prepared[11] = x10;
+	prepared[12] = x34;
+	prepared[13] = x41;
+	prepared[14] = x46;
+	prepared[15] = x47;
+	prepared[16] = x50;
+	prepared[17] = x54;
+	prepared[18] = x55;
+	prepared[19] = x56;
+	prepared[20] = x59;
+	prepared[21] = x63;
+	prepared[22] = x64;
+	prepared[23] = x83;
+	prepared[24] = c0;
+	prepared[25] = c1;
+	prepared[26] = c2;
+	prepared[27] = c3;
+	prepared[28] = c4;
+	prepared[29] = c5;
+	prepared[30] = c6;
+	prepared[31] = c7;
+	prepared[32] = c8;
+	prepared[33] = c9;
+	prepared[34] = c10;
+	prepared[35] = c11;
+	prepared[36] = c12;
+	prepared[37] = c13;
+	prepared[38] = c14;
+	prepared[39] = c15;
+	prepared[40] = c16;
+	prepared[41] = c17;
+	prepared[42] = c18;
+	prepared[43] = c19;
+	prepared[44] = c20;
+	prepared[45] = c21;
+	prepared[46] = c22;
+	prepared[47] = c23;
+	prepared[48] = c24;
+	prepared[49] = c25;
+	prepared[50] = c26;
+	prepared[51] = c27;
+	prepared[52] = c28;
+	prepared[53] = c29;
+	prepared[54] = c30;
+	prepared[55] = c31;
+	prepared[56] = c32;
+	prepared[57] = c33;
+	prepared[58] = c34;
+	prepared[59] = c35;
+	prepared[60] = c36;
+	prepared[61] = c37;
+	prepared[62] = c38;
+	prepared[63] = c39;
+	prepared[64] = c40;
+	prepared[65] = c41;
+	prepared[66] = c42;
+	prepared[67] = c43;
+	prepared[68] = c44;
+	prepared[69] = c45;
+	prepared[70] = c46;
+	prepared[71] = c47;
+	prepared[72] = c48;
+	prepared[73] = c49;
+	prepared[74] = c50;
+	prepared[75] = c51;
+	prepared[76] = c52;
+	prepared[77] = c53;
+	prepared[78] = c54;
+	prepared[79] = c55;
+	prepared[80] = c56;
+	prepared[81] = c57;
+	prepared[82] = c58;
+	prepared[83] = c59;
+	prepared[84] = c60;
+	prepared[85] = c61;
+	prepared[86] = c62;
+	prepared[87] = c63;
+	prepared[88] = c64;
+	prepared[89] = c65;
+	prepared[90] = c66;
+	prepared[91] = c67;
+	prepared[92] = c68;
+	prepared[93] = c69;
+	prepared[94] = c70;
+	prepared[95] = c71;
+	prepared[96] = c72;
+	prepared[97] = c73;
+	prepared[98] = c74;
+}
+
+static inline void gen_reproject_axis_y_gen2_val_jac_obj_p_lh_p_axis_angle_eval(FLT *out, const FLT *prepared,
+																				const FLT *sensor_pt) {
+	const GEN_FLT obj_px = prepared[0];
+	const GEN_FLT obj_py = prepared[1];
+	const GEN_FLT obj_pz = prepared[2];
+	const GEN_FLT lh_px = prepared[3];
+	const GEN_FLT lh_py = prepared[4];
+	const GEN_FLT lh_pz = prepared[5];
+	const GEN_FLT curve_1 = prepared[6];
+	const GEN_FLT gibPhase_1 = prepared[7];
+	const GEN_FLT gibMag_1 = prepared[8];
+	const GEN_FLT ogeeMag_1 = prepared[9];
+	const GEN_FLT ogeePhase_1 = prepared[10];
+	const GEN_FLT x10 = prepared[11];
+	const GEN_FLT x34 = prepared[12];
+	const GEN_FLT x41 = prepared[13];
+	const GEN_FLT x46 = prepared[14];
+	const GEN_FLT x47 = prepared[15];
+	const GEN_FLT x50 = prepared[16];
+	const GEN_FLT x54 = prepared[17];
+	const GEN_FLT x55 = prepared[18];
+	const GEN_FLT x56 = prepared[19];
+	const GEN_FLT x59 = prepared[20];
+	const GEN_FLT x63 = prepared[21];
+	const GEN_FLT x64 = prepared[22];
+	const GEN_FLT x83 = prepared[23];
+	const GEN_FLT c0 = prepared[24];
+	const GEN_FLT c1 = prepared[25];
+	const GEN_FLT c2 = prepared[26];
+	const GEN_FLT c3 = prepared[27];
+	const GEN_FLT c4 = prepared[28];
+	const GEN_FLT c5 = prepared[29];
+	const GEN_FLT c6 = prepared[30];
+	const GEN_FLT c7 = prepared[31];
+	const GEN_FLT c8 = prepared[32];
+	const GEN_FLT c9 = prepared[33];
+	const GEN_FLT c10 = prepared[34];
+	const GEN_FLT c11 = prepared[35];
+	const GEN_FLT c12 = prepared[36];
+	const GEN_FLT c13 = prepared[37];
+	const GEN_FLT c14 = prepared[38];
+	const GEN_FLT c15 = prepared[39];
+	const GEN_FLT c16 = prepared[40];
+	const GEN_FLT c17 = prepared[41];
+	const GEN_FLT c18 = prepared[42];
+	const GEN_FLT c19 = prepared[43];
+	const GEN_FLT c20 = prepared[44];
+	const GEN_FLT c21 = prepared[45];
+	const GEN_FLT c22 = prepared[46];
+	const GEN_FLT c23 = prepared[47];
+	const GEN_FLT c24 = prepared[48];
+	const GEN_FLT c25 = prepared[49];
+	const GEN_FLT c26 = prepared[50];
+	const GEN_FLT c27 = prepared[51];
+	const GEN_FLT c28 = prepared[52];
+	const GEN_FLT c29 = prepared[53];
+	const GEN_FLT c30 = prepared[54];
+	const GEN_FLT c31 = prepared[55];
+	const GEN_FLT c32 = prepared[56];
+	const GEN_FLT c33 = prepared[57];
+	const GEN_FLT c34 = prepared[58];
+	const GEN_FLT c35 = prepared[59];
+	const GEN_FLT c36 = prepared[60];
+	const GEN_FLT c37 = prepared[61];
+	const GEN_FLT c38 = prepared[62];
+	const GEN_FLT c39 = prepared[63];
+	const GEN_FLT c40 = prepared[64];
+	const GEN_FLT c41 = prepared[65];
+	const GEN_FLT c42 = prepared[66];
+	const GEN_FLT c43 = prepared[67];
+	const GEN_FLT c44 = prepared[68];
+	const GEN_FLT c45 = prepared[69];
+	const GEN_FLT c46 = prepared[70];
+	const GEN_FLT c47 = prepared[71];
+	const GEN_FLT c48 = prepared[72];
+	const GEN_FLT c49 = prepared[73];
+	const GEN_FLT c50 = prepared[74];
+	const GEN_FLT c51 = prepared[75];
+	const GEN_FLT c52 = prepared[76];
+	const GEN_FLT c53 = prepared[77];
+	const GEN_FLT c54 = prepared[78];
+	const GEN_FLT c55 = prepared[79];
+	const GEN_FLT c56 = prepared[80];
+	const GEN_FLT c57 = prepared[81];
+	const GEN_FLT c58 = prepared[82];
+	const GEN_FLT c59 = prepared[83];
+	const GEN_FLT c60 = prepared[84];
+	const GEN_FLT c61 = prepared[85];
+	const GEN_FLT c62 = prepared[86];
+	const GEN_FLT c63 = prepared[87];
+	const GEN_FLT c64 = prepared[88];
+	const GEN_FLT c65 = prepared[89];
+	const GEN_FLT c66 = prepared[90];
+	const GEN_FLT c67 = prepared[91];
+	const GEN_FLT c68 = prepared[92];
+	const GEN_FLT c69 = prepared[93];
+	const GEN_FLT c70 = prepared[94];
+	const GEN_FLT c71 = prepared[95];
+	const GEN_FLT c72 = prepared[96];
+	const GEN_FLT c73 = prepared[97];
+	const GEN_FLT c74 = prepared[98];
+	const GEN_FLT sensor_x = sensor_pt[0];
+	const GEN_FLT sensor_y = sensor_pt[1];
+	const GEN_FLT sensor_z = sensor_pt[2];
+	const GEN_FLT x27 = obj_pz + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLT x37 = obj_py + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLT x42 = obj_px + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLT x43 = lh_pz + (x10 * x27) + (x34 * x37) + (x41 * x42);
+	const GEN_FLT x44 = -1 * x43;
+	const GEN_FLT x51 = lh_px + (x27 * x47) + (x37 * x50) + (x42 * x46);
+	const GEN_FLT x52 = atan2(x44, x51);
+	const GEN_FLT x57 = lh_py + (x27 * x56) + (x37 * x54) + (x42 * x55);
+	const GEN_FLT x60 = (x44 * x44) + (x51 * x51);
+	const GEN_FLT x61 = x59 * (1. / sqrt(x60));
+	const GEN_FLT x62 = x57 * x61;
+	const GEN_FLT x65 = x57 * x57;
+	const GEN_FLT x66 = x60 + x65;
+	const GEN_FLT x67 = x64 * (1. / sqrt(x66));
+	const GEN_FLT x68 = asin(x57 * x67);
+	const GEN_FLT x69 = 8.0108022e-06 * x68;
+	const GEN_FLT x70 = -8.0108022e-06 + (-1 * x69);
+	const GEN_FLT x71 = 0.0028679863 + (x68 * x70);
+	const GEN_FLT x72 = 5.3685255e-06 + (x68 * x71);
+	const GEN_FLT x73 = 0.0076069798 + (x68 * x72);
+	const GEN_FLT x74 = x68 * x68;
+	const GEN_FLT x75 = ogeeMag_1 + x52 + (-1 * asin(x62));
+	const GEN_FLT x76 = curve_1 + (ogeePhase_1 * sin(x75));
+	const GEN_FLT x77 = x68 * x73;
+	const GEN_FLT x78 = -8.0108022e-06 + (-1.60216044e-05 * x68);
+	const GEN_FLT x79 = x71 + (x68 * x78);
+	const GEN_FLT x80 = x72 + (x68 * x79);
+	const GEN_FLT x81 = x73 + (x68 * x80);
+	const GEN_FLT x82 = x77 + (x68 * x81);
+	const GEN_FLT x84 = x76 * x83;
+	const GEN_FLT x85 = x63 + (-1 * x82 * x84);
+	const GEN_FLT x86 = 1. / x85;
+	const GEN_FLT x87 = x76 * x86;
+	const GEN_FLT x88 = x74 * x87;
+	const GEN_FLT x89 = x62 + (x73 * x88);
+	const GEN_FLT x90 = asin(x89);
+	const GEN_FLT x91 = gibPhase_1 + x52 + (-1 * x90);
+	const GEN_FLT x92 = 1. / sqrt(1 + (-1 * (x89 * x89)));
+	const GEN_FLT x93 = 1. / sqrt(1 + (-1 * x65 * c9 * (1. / x66)));
+	const GEN_FLT x96 = 1.0/2.0 * x57;
+	const GEN_FLT x98 = 1.0/2.0 * x51;
+	const GEN_FLT x100 = 1.0/2.0 * x44;
+	const GEN_FLT x101 = (x100 * c10) + (x98 * c11);
+	const GEN_FLT x102 = x57 * x64 * (1. / (x66 * sqrt(x66)));
+	const GEN_FLT x103 = x93 * ((x102 * ((-1 * x101) + (-1 * x96 * c12))) + (x55 * x67));
+	const GEN_FLT x104 = x103 * x70;
+	const GEN_FLT x105 = (x103 * x71) + (x68 * (x104 + (-1 * x103 * x69)));
+	const GEN_FLT x106 = (x103 * x72) + (x105 * x68);
+	const GEN_FLT x107 = 1. / x60;
+	const GEN_FLT x108 = 1. / sqrt(1 + (-1 * x107 * x65 * c13));
+	const GEN_FLT x109 = x57 * x59 * (1. / (x60 * sqrt(x60)));
+	const GEN_FLT x110 = (x55 * x61) + (-1 * x101 * x109);
+	const GEN_FLT x111 = x107 * x51;
+	const GEN_FLT x112 = x107 * x43;
+	const GEN_FLT x113 = (x112 * x46) + (-1 * x111 * x41);
+	const GEN_FLT x114 = ogeePhase_1 * cos(x75);
+	const GEN_FLT x115 = x114 * (x113 + (-1 * x108 * x110));
+	const GEN_FLT x116 = x82 * x83;
+	const GEN_FLT x117 = 2.40324066e-05 * x68;
+	const GEN_FLT x118 = x73 * x74;
+	const GEN_FLT x119 = x118 * x76 * (1. / (x85 * x85));
+	const GEN_FLT x120 = x118 * x86;
+	const GEN_FLT x121 = 2 * x77 * x87;
+	const GEN_FLT x122 = x113 + (-1 * x92 * (x110 + (x103 * x121) + (x106 * x88) + (x115 * x120) + (x119 * ((x115 *
+		x116) + (x84 * ((x103 * x73) + (x103 * x81) + (x106 * x68) + (x68 * (x106 + (x103 * x80) + (x68 * (x105 + (x103
+		* x79) + (x68 * (x104 + (x103 * x78) + (-1 * x103 * x117)))))))))))));
+	const GEN_FLT x123 = cos(x91);
+	const GEN_FLT x124 = gibMag_1 * x123;
+	const GEN_FLT x127 = (x100 * c14) + (x98 * c15);
+	const GEN_FLT x128 = x93 * ((x102 * ((-1 * x127) + (-1 * x96 * c16))) + (x54 * x67));
+	const GEN_FLT x129 = x128 * x70;
+	const GEN_FLT x130 = (x128 * x71) + (x68 * (x129 + (-1 * x128 * x69)));
+	const GEN_FLT x131 = (x128 * x72) + (x130 * x68);
+	const GEN_FLT x132 = (x54 * x61) + (-1 * x109 * x127);
+	const GEN_FLT x133 = (x112 * x50) + (-1 * x111 * x34);
+	const GEN_FLT x134 = x133 + (-1 * x108 * x132);
+	const GEN_FLT x135 = x114 * x116;
+	const GEN_FLT x136 = x114 * x120;
+	const GEN_FLT x137 = x133 + (-1 * x92 * (x132 + (x119 * ((x134 * x135) + (x84 * ((x128 * x73) + (x128 * x81) +
+		(x131 * x68) + (x68 * (x131 + (x128 * x80) + (x68 * (x130 + (x128 * x79) + (x68 * (x129 + (x128 * x78) + (-1 *
+		x117 * x128))))))))))) + (x121 * x128) + (x131 * x88) + (x134 * x136)));
+	const GEN_FLT x138 = (x100 * c17) + (x98 * c18);
+	const GEN_FLT x139 = x93 * ((x102 * ((-1 * x138) + (-1 * x96 * c19))) + (x56 * x67));
+	const GEN_FLT x140 = x139 * x70;
+	const GEN_FLT x141 = (x139 * x71) + (x68 * (x140 + (-1 * x139 * x69)));
+	const GEN_FLT x142 = (x139 * x72) + (x141 * x68);
+	const GEN_FLT x143 = (x56 * x61) + (-1 * x109 * x138);
+	const GEN_FLT x144 = (x112 * x47) + (-1 * x10 * x111);
+	const GEN_FLT x145 = x144 + (-1 * x108 * x143);
+	const GEN_FLT x146 = x144 + (-1 * x92 * (x143 + (x119 * ((x135 * x145) + (x84 * ((x139 * x73) + (x139 * x81) +
+		(x142 * x68) + (x68 * (x142 + (x139 * x80) + (x68 * (x141 + (x139 * x79) + (x68 * (x140 + (x139 * x78) + (-1 *
+		x117 * x139))))))))))) + (x121 * x139) + (x136 * x145) + (x142 * x88)));
+	const GEN_FLT x165 = (sensor_x * c20) + (sensor_y * c21) + (sensor_z * c22);
+	const GEN_FLT x166 = x165 * x54;
+	const GEN_FLT x175 = (sensor_x * c23) + (sensor_y * c24) + (sensor_z * c25);
+	const GEN_FLT x176 = x175 * x56;
+	const GEN_FLT x180 = (sensor_x * c26) + (sensor_y * c27) + (sensor_z * c28);
+	const GEN_FLT x181 = x180 * x55;
+	const GEN_FLT x182 = x166 + x176 + x181;
+	const GEN_FLT x183 = x175 * x47;
+	const GEN_FLT x184 = x165 * x50;
+	const GEN_FLT x185 = x180 * x46;
+	const GEN_FLT x186 = x10 * x175;
+	const GEN_FLT x187 = x165 * x34;
+	const GEN_FLT x188 = x180 * x41;
+	const GEN_FLT x189 = (x100 * ((-2 * x186) + (-2 * x187) + (-2 * x188))) + (x98 * ((2 * x183) + (2 * x184) + (2 *
+		x185)));
+	const GEN_FLT x190 = x93 * ((x102 * ((-1 * x189) + (-1 * x96 * ((2 * x166) + (2 * x176) + (2 * x181))))) + (x182 *
+		x67));
+	const GEN_FLT x191 = x190 * x70;
+	const GEN_FLT x192 = (x190 * x71) + (x68 * (x191 + (-1 * x190 * x69)));
+	const GEN_FLT x193 = (x190 * x72) + (x192 * x68);
+	const GEN_FLT x194 = (x182 * x61) + (-1 * x109 * x189);
+	const GEN_FLT x195 = (x111 * ((-1 * x186) + (-1 * x187) + (-1 * x188))) + (x112 * (x183 + x184 + x185));
+	const GEN_FLT x196 = x195 + (-1 * x108 * x194);
+	const GEN_FLT x197 = x195 + (-1 * x92 * (x194 + (x119 * ((x135 * x196) + (x84 * ((x190 * x73) + (x190 * x81) +
+		(x193 * x68) + (x68 * (x193 + (x190 * x80) + (x68 * (x192 + (x190 * x79) + (x68 * (x191 + (x190 * x78) + (-1 *
+		x117 * x190))))))))))) + (x121 * x190) + (x136 * x196) + (x193 * x88)));
+	const GEN_FLT x207 = (sensor_x * c29) + (sensor_y * c30) + (sensor_z * c31);
+	const GEN_FLT x208 = x207 * x55;
+	const GEN_FLT x213 = (sensor_x * c32) + (sensor_y * c33) + (sensor_z * c34);
+	const GEN_FLT x214 = x213 * x56;
+	const GEN_FLT x217 = (sensor_x * c35) + (sensor_y * c36) + (sensor_z * c37);
+	const GEN_FLT x218 = x217 * x54;
+	const GEN_FLT x219 = x208 + x214 + x218;
+	const GEN_FLT x220 = x207 * x46;
+	const GEN_FLT x221 = x213 * x47;
+	const GEN_FLT x222 = x217 * x50;
+	const GEN_FLT x223 = x10 * x213;
+	const GEN_FLT x224 = x207 * x41;
+	const GEN_FLT x225 = x217 * x34;
+	const GEN_FLT x226 = (x100 * ((-2 * x223) + (-2 * x224) + (-2 * x225))) + (x98 * ((2 * x220) + (2 * x221) + (2 *
+		x222)));
+	const GEN_FLT x227 = x93 * ((x102 * ((-1 * x226) + (-1 * x96 * ((2 * x208) + (2 * x214) + (2 * x218))))) + (x219 *
+		x67));
+	const GEN_FLT x228 = x227 * x70;
+	const GEN_FLT x229 = (x227 * x71) + (x68 * (x228 + (-1 * x227 * x69)));
+	const GEN_FLT x230 = (x227 * x72) + (x229 * x68);
+	const GEN_FLT x231 = (x219 * x61) + (-1 * x109 * x226);
+	const GEN_FLT x232 = (x111 * ((-1 * x223) + (-1 * x224) + (-1 * x225))) + (x112 * (x220 + x221 + x222));
+	const GEN_FLT x233 = x232 + (-1 * x108 * x231);
+	const GEN_FLT x234 = x232 + (-1 * x92 * (x231 + (x119 * ((x135 * x233) + (x84 * ((x227 * x73) + (x227 * x81) +
+		(x230 * x68) + (x68 * (x230 + (x227 * x80) + (x68 * (x229 + (x227 * x79) + (x68 * (x228 + (x227 * x78) + (-1 *
+		x117 * x227))))))))))) + (x121 * x227) + (x136 * x233) + (x230 * x88)));
+	const GEN_FLT x238 = (sensor_x * c38) + (sensor_y * c39) + (sensor_z * c40);
+	const GEN_FLT x239 = x238 * x54;
+	const GEN_FLT x241 = (sensor_x * c41) + (sensor_y * c42) + (sensor_z * c43);
+	const GEN_FLT x242 = x241 * x55;
+	const GEN_FLT x244 = (sensor_x * c44) + (sensor_y * c45) + (sensor_z * c46);
+	const GEN_FLT x245 = x244 * x56;
+	const GEN_FLT x246 = x239 + x242 + x245;
+	const GEN_FLT x247 = x241 * x46;
+	const GEN_FLT x248 = x238 * x50;
+	const GEN_FLT x249 = x244 * x47;
+	const GEN_FLT x250 = x238 * x34;
+	const GEN_FLT x251 = x241 * x41;
+	const GEN_FLT x252 = x10 * x244;
+	const GEN_FLT x253 = (x100 * ((-2 * x250) + (-2 * x251) + (-2 * x252))) + (x98 * ((2 * x247) + (2 * x248) + (2 *
+		x249)));
+	const GEN_FLT x254 = x93 * ((x102 * ((-1 * x253) + (-1 * x96 * ((2 * x239) + (2 * x242) + (2 * x245))))) + (x246 *
+		x67));
+	const GEN_FLT x255 = x254 * x70;
+	const GEN_FLT x256 = (x254 * x71) + (x68 * (x255 + (-1 * x254 * x69)));
+	const GEN_FLT x257 = (x254 * x72) + (x256 * x68);
+	const GEN_FLT x258 = (x246 * x61) + (-1 * x109 * x253);
+	const GEN_FLT x259 = (x111 * ((-1 * x250) + (-1 * x251) + (-1 * x252))) + (x112 * (x247 + x248 + x249));
+	const GEN_FLT x260 = x259 + (-1 * x108 * x258);
+	const GEN_FLT x261 = x259 + (-1 * x92 * (x258 + (x119 * ((x135 * x260) + (x84 * ((x254 * x73) + (x254 * x81) +
+		(x257 * x68) + (x68 * (x257 + (x254 * x80) + (x68 * (x256 + (x254 * x79) + (x68 * (x255 + (x254 * x78) + (-1 *
+		x117 * x254))))))))))) + (x121 * x254) + (x136 * x260) + (x257 * x88)));
+	const GEN_FLT x262 = -1 * x51;
+	const GEN_FLT x263 = x109 * x262;
+	const GEN_FLT x264 = x102 * x93;
+	const GEN_FLT x265 = x262 * x264;
+	const GEN_FLT x266 = x112 + (-1 * x108 * x263);
+	const GEN_FLT x267 = x265 * x70;
+	const GEN_FLT x268 = (x265 * x71) + (x68 * (x267 + (-1 * x265 * x69)));
+	const GEN_FLT x269 = (x265 * x72) + (x268 * x68);
+	const GEN_FLT x270 = x112 + (-1 * x92 * (x263 + (x119 * ((x135 * x266) + (x84 * ((x265 * x73) + (x265 * x81) +
+		(x269 * x68) + (x68 * (x269 + (x265 * x80) + (x68 * (x268 + (x265 * x79) + (x68 * (x267 + (x265 * x78) + (-1 *
+		x117 * x265))))))))))) + (x121 * x265) + (x136 * x266) + (x269 * x88)));
+	const GEN_FLT x271 = x108 * x61;
+	const GEN_FLT x272 = x93 * (x67 + (-1 * x102 * x57));
+	const GEN_FLT x273 = x272 * x70;
+	const GEN_FLT x274 = (x272 * x71) + (x68 * (x273 + (-1 * x272 * x69)));
+	const GEN_FLT x275 = (x272 * x72) + (x274 * x68);
+	const GEN_FLT x276 = x92 * (x61 + (x119 * ((-1 * x135 * x271) + (x76 * x83 * ((x272 * x73) + (x272 * x81) + (x275 *
+		x68) + (x68 * (x275 + (x272 * x80) + (x68 * (x274 + (x272 * x79) + (x68 * (x273 + (x272 * x78) + (-1 * x117 *
+		x272))))))))))) + (x121 * x272) + (x275 * x88) + (-1 * x136 * x271));
+	const GEN_FLT x277 = x109 * x44;
+	const GEN_FLT x278 = x264 * x44;
+	const GEN_FLT x279 = (-1 * x111) + (-1 * x108 * x277);
+	const GEN_FLT x280 = x278 * x70;
+	const GEN_FLT x281 = (x278 * x71) + (x68 * (x280 + (-1 * x278 * x69)));
+	const GEN_FLT x282 = (x278 * x72) + (x281 * x68);
+	const GEN_FLT x283 = x111 + (x92 * (x277 + (x119 * ((x135 * x279) + (x84 * ((x278 * x73) + (x278 * x81) + (x282 *
+		x68) + (x68 * (x282 + (x278 * x80) + (x68 * (x281 + (x278 * x79) + (x68 * (x280 + (x278 * x78) + (-1 * x117 *
+		x278))))))))))) + (x121 * x278) + (x136 * x279) + (x282 * x88)));
+	const GEN_FLT x288 = x37 * c47;
+	const GEN_FLT x297 = x27 * c48;
+	const GEN_FLT x304 = x42 * c49;
+	const GEN_FLT x305 = x288 + x297 + x304;
+	const GEN_FLT x307 = x27 * c50;
+	const GEN_FLT x309 = x37 * c51;
+	const GEN_FLT x316 = x42 * c52;
+	const GEN_FLT x318 = x42 * c53;
+	const GEN_FLT x320 = x37 * c54;
+	const GEN_FLT x322 = x27 * c55;
+	const GEN_FLT x323 = (x100 * ((-2 * x307) + (-2 * x309) + (-2 * x316))) + (x98 * ((2 * x318) + (2 * x320) + (2 *
+		x322)));
+	const GEN_FLT x324 = x93 * ((x102 * ((-1 * x323) + (-1 * x96 * ((2 * x288) + (2 * x297) + (2 * x304))))) + (x305 *
+		x67));
+	const GEN_FLT x325 = x324 * x70;
+	const GEN_FLT x326 = (x324 * x71) + (x68 * (x325 + (-1 * x324 * x69)));
+	const GEN_FLT x327 = (x324 * x72) + (x326 * x68);
+	const GEN_FLT x328 = (x305 * x61) + (-1 * x109 * x323);
+	const GEN_FLT x329 = (x111 * ((-1 * x307) + (-1 * x309) + (-1 * x316))) + (x112 * (x318 + x320 + x322));
+	const GEN_FLT x330 = x329 + (-1 * x108 * x328);
+	const GEN_FLT x331 = x329 + (-1 * x92 * (x328 + (x119 * ((x135 * x330) + (x84 * ((x324 * x73) + (x324 * x81) +
+		(x327 * x68) + (x68 * (x327 + (x324 * x80) + (x68 * (x326 + (x324 * x79) + (x68 * (x325 + (x324 * x78) + (-1 *
+		x117 * x324))))))))))) + (x121 * x324) + (x136 * x330) + (x327 * x88)));
+	const GEN_FLT x333 = x37 * c56;
+	const GEN_FLT x341 = x42 * c57;
+	const GEN_FLT x344 = x27 * c58;
+	const GEN_FLT x345 = x333 + x341 + x344;
+	const GEN_FLT x346 = x42 * c59;
+	const GEN_FLT x349 = x27 * c60;
+	const GEN_FLT x351 = x37 * c61;
+	const GEN_FLT x353 = x27 * c62;
+	const GEN_FLT x355 = x42 * c63;
+	const GEN_FLT x356 = x37 * c64;
+	const GEN_FLT x357 = (x100 * ((-2 * x353) + (-2 * x355) + (-2 * x356))) + (x98 * ((2 * x346) + (2 * x349) + (2 *
+		x351)));
+	const GEN_FLT x358 = x93 * ((x102 * ((-1 * x357) + (-1 * x96 * ((2 * x333) + (2 * x341) + (2 * x344))))) + (x345 *
+		x67));
+	const GEN_FLT x359 = x358 * x70;
+	const GEN_FLT x360 = (x358 * x71) + (x68 * (x359 + (-1 * x358 * x69)));
+	const GEN_FLT x361 = (x358 * x72) + (x360 * x68);
+	const GEN_FLT x362 = (x345 * x61) + (-1 * x109 * x357);
+	const GEN_FLT x363 = (x111 * ((-1 * x353) + (-1 * x355) + (-1 * x356))) + (x112 * (x346 + x349 + x351));
+	const GEN_FLT x364 = x363 + (-1 * x108 * x362);
+	const GEN_FLT x365 = x363 + (-1 * x92 * (x362 + (x119 * ((x135 * x364) + (x84 * ((x358 * x73) + (x358 * x81) +
+		(x361 * x68) + (x68 * (x361 + (x358 * x80) + (x68 * (x360 + (x358 * x79) + (x68 * (x359 + (x358 * x78) + (-1 *
+		x117 * x358))))))))))) + (x121 * x358) + (x136 * x364) + (x361 * x88)));
+	const GEN_FLT x366 = x37 * c65;
+	const GEN_FLT x369 = x42 * c66;
+	const GEN_FLT x371 = x27 * c67;
+	const GEN_FLT x372 = x366 + x369 + x371;
+	const GEN_FLT x373 = x42 * c68;
+	const GEN_FLT x374 = x37 * c69;
+	const GEN_FLT x376 = x27 * c70;
+	const GEN_FLT x378 = x27 * c71;
+	const GEN_FLT x379 = x42 * c72;
+	const GEN_FLT x380 = x37 * c73;
+	const GEN_FLT x381 = (x100 * ((-2 * x378) + (-2 * x379) + (-2 * x380))) + (x98 * ((2 * x373) + (2 * x374) + (2 *
+		x376)));
+	const GEN_FLT x382 = x93 * ((x102 * ((-1 * x381) + (-1 * x96 * ((2 * x366) + (2 * x369) + (2 * x371))))) + (x372 *
+		x67));
+	const GEN_FLT x383 = x382 * x70;
+	const GEN_FLT x384 = (x382 * x71) + (x68 * (x383 + (-1 * x382 * x69)));
+	const GEN_FLT x385 = (x382 * x72) + (x384 * x68);
+	const GEN_FLT x386 = (x372 * x61) + (-1 * x109 * x381);
+	const GEN_FLT x387 = (x111 * ((-1 * x378) + (-1 * x379) + (-1 * x380))) + (x112 * (x373 + x374 + x376));
+	const GEN_FLT x388 = x387 + (-1 * x108 * x386);
+	const GEN_FLT x389 = x387 + (-1 * x92 * (x386 + (x119 * ((x135 * x388) + (x84 * ((x382 * x73) + (x382 * x81) +
+		(x385 * x68) + (x68 * (x385 + (x382 * x80) + (x68 * (x384 + (x382 * x79) + (x68 * (x383 + (x382 * x78) + (-1 *
+		x117 * x382))))))))))) + (x121 * x382) + (x136 * x388) + (x385 * x88)));
+	out[0] = -1.5707963267949 + x52 + c74 + (-1 * x90) + (gibMag_1 * sin(x91));
+	out[1] = x122 + (x122 * x124);
+	out[2] = x137 + (x124 * x137);
+	out[3] = x146 + (x124 * x146);
+	out[4] = x197 + (x124 * x197);
+	out[5] = x234 + (x124 * x234);
+	out[6] = x261 + (x124 * x261);
+	out[7] = x270 + (x124 * x270);
+	out[8] = (-1 * x276) + (-1 * x124 * x276);
+	out[9] = (-1 * x283) + (-1 * gibMag_1 * x123 * x283);
+	out[10] = x331 + (x124 * x331);
+	out[11] = x365 + (x124 * x365);
+	out[12] = x389 + (x124 * x389);
+}
+
+enum { gen_reproject_axis_angle_prepared_size = 34 };
+
+static inline void gen_reproject_axis_angle_prepare(FLT *prepared, const LinmathAxisAnglePose *obj_p,
+													const LinmathAxisAnglePose *lh_p, const BaseStationCal *bsd) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_0 = bsd[0].phase;
+	const GEN_FLT tilt_0 = bsd[0].tilt;
+	const GEN_FLT curve_0 = bsd[0].curve;
+	const GEN_FLT gibPhase_0 = bsd[0].gibpha;
+	const GEN_FLT gibMag_0 = bsd[0].gibmag;
+	const GEN_FLT ogeeMag_0 = bsd[0].ogeephase;
+	const GEN_FLT ogeePhase_0 = bsd[0].ogeemag;
+	const GEN_FLT phase_1 = bsd[1].phase;
+	const GEN_FLT tilt_1 = bsd[1].tilt;
+	const GEN_FLT curve_1 = bsd[1].curve;
+	const GEN_FLT gibPhase_1 = bsd[1].gibpha;
+	const GEN_FLT gibMag_1 = bsd[1].gibmag;
+	const GEN_FLT ogeeMag_1 = bsd[1].ogeephase;
+	const GEN_FLT ogeePhase_1 = bsd[1].ogeemag;
+	const GEN_FLT x0 = lh_qi * lh_qi;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qk * lh_qk;
+	const GEN_FLT x3 = 1e-10 + x0 + x1 + x2;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = cos(x4);
+	const GEN_FLT x6 = 1. / x3;
+	const GEN_FLT x7 = 1 + (-1 * x5);
+	const GEN_FLT x8 = x6 * x7;
+	const GEN_FLT x9 = obj_qi * obj_qi;
+	const GEN_FLT x10 = obj_qj * obj_qj;
+	const GEN_FLT x11 = obj_qk * obj_qk;
+	const GEN_FLT x12 = 1e-10 + x10 + x11 + x9;
+	const GEN_FLT x13 = sqrt(x12);
+	const GEN_FLT x14 = cos(x13);
+	const GEN_FLT x15 = 1. / x12;
+	const GEN_FLT x16 = 1 + (-1 * x14);
+	const GEN_FLT x17 = x15 * x16;
+	const GEN_FLT x18 = (1. / x13) * sin(x13);
+	const GEN_FLT x19 = obj_qk * x18;
+	const GEN_FLT x20 = obj_qi * obj_qj * x17;
+	const GEN_FLT x21 = obj_qi * x18;
+	const GEN_FLT x23 = (1. / x4) * sin(x4);
+	const GEN_FLT x24 = lh_qk * x23;
+	const GEN_FLT x25 = lh_qi * x8;
+	const GEN_FLT x26 = lh_qj * x25;
+	const GEN_FLT x27 = obj_qj * x18;
+	const GEN_FLT x28 = obj_qk * x17;
+	const GEN_FLT x29 = obj_qi * x28;
+	const GEN_FLT x31 = lh_qi * x23;
+	const GEN_FLT x34 = lh_qj * x23;
+	const GEN_FLT x35 = lh_qk * x25;
+	const GEN_FLT c0 = x19 + x20;
+	const GEN_FLT c1 = x14 + (x10 * x17);
+	const GEN_FLT c2 = (-1 * x21) + (obj_qj * obj_qk * x15 * x16);
+	const GEN_FLT c3 = x14 + (x17 * x9);
+	const GEN_FLT c4 = x20 + (-1 * x19);
+	const GEN_FLT c5 = x27 + x29;
+	const GEN_FLT c6 = x29 + (-1 * x27);
+	const GEN_FLT c7 = x21 + (obj_qj * x28);
+	const GEN_FLT c8 = x14 + (x11 * x17);
+	const GEN_FLT c9 = x5 + (x1 * x8);
+	const GEN_FLT c10 = x24 + x26;
+	const GEN_FLT c11 = (-1 * x31) + (lh_qj * lh_qk * x6 * x7);
+	const GEN_FLT c12 = x26 + (-1 * x24);
+	const GEN_FLT c13 = x5 + (x0 * x8);
+	const GEN_FLT c14 = x34 + x35;
+	const GEN_FLT c15 = -1 * lh_pz;
+	const GEN_FLT c16 = x31 + (lh_qj * lh_qk * x8);
+	const GEN_FLT c17 = x35 + (-1 * x34);
+	const GEN_FLT c18 = x5 + (x2 * x8);
+	const GEN_FLT c19 = -1 * phase_1;
+	prepared[0] = obj_px;
+	prepared[1] = obj_py;
+	prepared[2] = obj_pz;
+	prepared[3] = lh_px;
+	prepared[4] = lh_py;
+	prepared[5] = phase_0;
+	prepared[6] = tilt_0;
+	prepared[7] = curve_0;
+	prepared[8] = gibPhase_0;
+	prepared[9] = gibMag_0;
+	prepared[10] = tilt_1;
+	prepared[11] = curve_1;
+	prepared[12] = gibPhase_1;
+	prepared[13] = gibMag_1;
+	prepared[14] = c0;
+	prepared[15] = c1;
+	prepared[16] = c2;
+	prepared[17] = c3;
+	prepared[18] = c4;
+	prepared[19] = c5;
+	prepared[20] = c6;
+	prepared[21] = c7;
+	prepared[22] = c8;
+	prepared[23] = c9;
+	prepared[24] = c10;
+	prepared[25] = c11;
+	prepared[26] = c12;
+	prepared[27] = c13;
+	prepared[28] = c14;
+	prepared[29] = c15;
+	prepared[30] = c16;
+	prepared[31] = c17;
+	prepared[32] = c18;
+	prepared[33] = c19;
+}
+
+static inline void gen_reproject_axis_angle_eval(FLT *out, const FLT *prepared, const FLT *sensor_pt) {
+	const GEN_FLT obj_px = prepared[0];
+	const GEN_FLT obj_py = prepared[1];
+	const GEN_FLT obj_pz = prepared[2];
+	const GEN_FLT lh_px = prepared[3];
+	const GEN_FLT lh_py = prepared[4];
+	const GEN_FLT phase_0 = prepared[5];
+	const GEN_FLT tilt_0 = prepared[6];
+	const GEN_FLT curve_0 = prepared[7];
+	const GEN_FLT gibPhase_0 = prepared[8];
+	const GEN_FLT gibMag_0 = prepared[9];
+	const GEN_FLT tilt_1 = prepared[10];
+	const GEN_FLT curve_1 = prepared[11];
+	const GEN_FLT gibPhase_1 = prepared[12];
+	const GEN_FLT gibMag_1 = prepared[13];
+	const GEN_FLT c0 = prepared[14];
+	const GEN_FLT c1 = prepared[15];
+	const GEN_FLT c2 = prepared[16];
+	const GEN_FLT c3 = prepared[17];
+	const GEN_FLT c4 = prepared[18];
+	const GEN_FLT c5 = prepared[19];
+	const GEN_FLT c6 = prepared[20];
+	const GEN_FLT c7 = prepared[21];
+	const GEN_FLT c8 = prepared[22];
+	const GEN_FLT c9 = prepared[23];
+	const GEN_FLT c10 = prepared[24];
+	const GEN_FLT c11 = prepared[25];
+	const GEN_FLT c12 = prepared[26];
+	const GEN_FLT c13 = prepared[27];
+	const GEN_FLT c14 = prepared[28];
+	const GEN_FLT c15 = prepared[29];
+	const GEN_FLT c16 = prepared[30];
+	const GEN_FLT c17 = prepared[31];
+	const GEN_FLT c18 = prepared[32];
+	const GEN_FLT c19 = prepared[33];
+	const GEN_FLT sensor_x = sensor_pt[0];
+	const GEN_FLT sensor_y = sensor_pt[1];
+	const GEN_FLT sensor_z = sensor_pt[2];
+	const GEN_FLT x22 = obj_py + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLT x30 = obj_px + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLT x32 = obj_pz + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLT x33 = lh_py + (x22 * c9) + (x30 * c10) + (x32 * c11);
+	const GEN_FLT x36 = lh_px + (x22 * c12) + (x30 * c13) + (x32 * c14);
+	const GEN_FLT x37 = c15 + (-1 * x22 * c16) + (-1 * x30 * c17) + (-1 * x32 * c18);
+	const GEN_FLT x38 = x37 * x37;
+	const GEN_FLT x39 = atan2(x36, x37);
+	const GEN_FLT x40 = phase_0 + x39 + asin(tilt_0 * x33 * (1. / sqrt(x38 + (x36 * x36))));
+	const GEN_FLT x41 = atan2(x33, x37);
+	const GEN_FLT x42 = asin(tilt_1 * x36 * (1. / sqrt(x38 + (x33 * x33))));
+	out[0] = (-1 * x40) + (curve_0 * (x41 * x41)) + (-1 * gibMag_0 * cos(1.5707963267949 + gibPhase_0 + (-1 * x40)));
+	out[1] = x41 + c19 + (-1 * x42) + (curve_1 * (x39 * x39)) + (-1 * gibMag_1 * cos(1.5707963267949 + gibPhase_1 + x41
+		+ c19 + (-1 * x42)));
+}
+
+// Value of reproject then its jacobian wrt obj_p
+enum { gen_reproject_val_jac_obj_p_axis_angle_prepared_size = 75 };
+
+static inline void gen_reproject_val_jac_obj_p_axis_angle_prepare(FLT *prepared, const LinmathAxisAnglePose *obj_p,
+																  const LinmathAxisAnglePose *lh_p,
+																  const BaseStationCal *bsd) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_0 = bsd[0].phase;
+	const GEN_FLT tilt_0 = bsd[0].tilt;
+	const GEN_FLT curve_0 = bsd[0].curve;
+	const GEN_FLT gibPhase_0 = bsd[0].gibpha;
+	const GEN_FLT gibMag_0 = bsd[0].gibmag;
+	const GEN_FLT ogeeMag_0 = bsd[0].ogeephase;
+	const GEN_FLT ogeePhase_0 = bsd[0].ogeemag;
+	const GEN_FLT phase_1 = bsd[1].phase;
+	const GEN_FLT tilt_1 = bsd[1].tilt;
+	const GEN_FLT curve_1 = bsd[1].curve;
+	const GEN_FLT gibPhase_1 = bsd[1].gibpha;
+	const GEN_FLT gibMag_1 = bsd[1].gibmag;
+	const GEN_FLT ogeeMag_1 = bsd[1].ogeephase;
+	const GEN_FLT ogeePhase_1 = bsd[1].ogeemag;
+	const GEN_FLT x0 = lh_qi * lh_qi;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qk * lh_qk;
+	const GEN_FLT x3 = 1e-10 + x0 + x1 + x2;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = cos(x4);
+	const GEN_FLT x6 = (1. / x3) * (1 + (-1 * x5));
+	const GEN_FLT x7 = x1 * x6;
+	const GEN_FLT x8 = x5 + x7;
+	const GEN_FLT x9 = obj_qi * obj_qi;
+	const GEN_FLT x10 = obj_qj * obj_qj;
+	const GEN_FLT x11 = obj_qk * obj_qk;
+	const GEN_FLT x12 = 1e-10 + x10 + x11 + x9;
+	const GEN_FLT x13 = sqrt(x12);
+	const GEN_FLT x14 = cos(x13);
+	const GEN_FLT x15 = 1. / x12;
+	const GEN_FLT x16 = 1 + (-1 * x14);
+	const GEN_FLT x17 = x15 * x16;
+	const GEN_FLT x18 = sin(x13);
+	const GEN_FLT x19 = x18 * (1. / x13);
+	const GEN_FLT x20 = obj_qk * x19;
+	const GEN_FLT x21 = obj_qj * x17;
+	const GEN_FLT x22 = obj_qi * x21;
+	const GEN_FLT x23 = obj_qi * x19;
+	const GEN_FLT x25 = 1. / x4;
+	const GEN_FLT x26 = sin(x4);
+	const GEN_FLT x27 = x25 * x26;
+	const GEN_FLT x28 = lh_qk * x27;
+	const GEN_FLT x29 = lh_qi * x6;
+	const GEN_FLT x30 = lh_qj * x29;
+	const GEN_FLT x31 = x28 + x30;
+	const GEN_FLT x32 = obj_qj * x19;
+	const GEN_FLT x33 = obj_qk * x17;
+	const GEN_FLT x34 = obj_qi * x33;
+	const GEN_FLT x36 = lh_qi * x27;
+	const GEN_FLT x37 = lh_qj * lh_qk * x6;
+	const GEN_FLT x38 = x37 + (-1 * x36);
+	const GEN_FLT x41 = x0 * x6;
+	const GEN_FLT x42 = x41 + x5;
+	const GEN_FLT x43 = lh_qj * x27;
+	const GEN_FLT x44 = lh_qk * x29;
+	const GEN_FLT x45 = x43 + x44;
+	const GEN_FLT x46 = x30 + (-1 * x28);
+	const GEN_FLT x49 = x2 * x6;
+	const GEN_FLT x50 = x49 + x5;
+	const GEN_FLT x51 = x36 + x37;
+	const GEN_FLT x52 = x44 + (-1 * x43);
+	const GEN_FLT x69 = -1 * x52;
+	const GEN_FLT x79 = 2 * x5;
+	const GEN_FLT x81 = 2 * x44;
+	const GEN_FLT x87 = -1 * x51;
+	const GEN_FLT x91 = 2 * x28;
+	const GEN_FLT x92 = 2 * x30;
+	const GEN_FLT x93 = 2 * x36;
+	const GEN_FLT x94 = 2 * x37;
+	const GEN_FLT x97 = -1 * x50;
+	const GEN_FLT x104 = 1. / (x12 * sqrt(x12));
+	const GEN_FLT x105 = 2 * x16 * (1. / (x12 * x12));
+	const GEN_FLT x106 = obj_qi * x105;
+	const GEN_FLT x107 = x10 * x106;
+	const GEN_FLT x108 = x14 * x15;
+	const GEN_FLT x109 = x104 * x18;
+	const GEN_FLT x110 = x109 * x9;
+	const GEN_FLT x111 = x19 + (-1 * x110) + (x108 * x9);
+	const GEN_FLT x112 = obj_qi * obj_qk;
+	const GEN_FLT x113 = obj_qj * x105;
+	const GEN_FLT x114 = x112 * x113;
+	const GEN_FLT x115 = x114 + (-1 * obj_qi * obj_qj * obj_qk * x104 * x18);
+	const GEN_FLT x116 = x105 * x9;
+	const GEN_FLT x117 = obj_qj * x116;
+	const GEN_FLT x118 = x21 + (-1 * x117) + (obj_qj * x110);
+	const GEN_FLT x119 = x108 * x112;
+	const GEN_FLT x120 = x109 * x112;
+	const GEN_FLT x121 = x119 + (-1 * x120);
+	const GEN_FLT x124 = x106 * x11;
+	const GEN_FLT x125 = (-1 * x114) + (obj_qj * x120);
+	const GEN_FLT x126 = obj_qk * x116;
+	const GEN_FLT x127 = x33 + (-1 * x126) + (obj_qk * x110);
+	const GEN_FLT x128 = obj_qi * obj_qj;
+	const GEN_FLT x129 = x109 * x128;
+	const GEN_FLT x130 = x108 * x128;
+	const GEN_FLT x131 = x129 + (-1 * x130);
+	const GEN_FLT x134 = obj_qi * obj_qi * obj_qi;
+	const GEN_FLT x135 = x120 + (-1 * x119);
+	const GEN_FLT x136 = x130 + (-1 * x129);
+	const GEN_FLT x154 = x125 + x19;
+	const GEN_FLT x155 = x10 * x109;
+	const GEN_FLT x156 = (-1 * x155) + (x10 * x108);
+	const GEN_FLT x157 = obj_qi * x17;
+	const GEN_FLT x158 = x157 + (-1 * x107) + (obj_qi * x155);
+	const GEN_FLT x159 = obj_qj * obj_qk;
+	const GEN_FLT x160 = x109 * x159;
+	const GEN_FLT x161 = x108 * x159;
+	const GEN_FLT x162 = x160 + (-1 * x161);
+	const GEN_FLT x165 = x11 * x113;
+	const GEN_FLT x166 = x115 + x19;
+	const GEN_FLT x167 = obj_qk * x10 * x105;
+	const GEN_FLT x168 = x33 + (-1 * x167) + (obj_qk * x155);
+	const GEN_FLT x171 = obj_qj * obj_qj * obj_qj;
+	const GEN_FLT x172 = x161 + (-1 * x160);
+	const GEN_FLT x190 = x109 * x11;
+	const GEN_FLT x191 = (-1 * x190) + (x108 * x11);
+	const GEN_FLT x192 = x21 + (-1 * x165) + (obj_qj * x190);
+	const GEN_FLT x195 = x157 + (-1 * x124) + (obj_qi * x190);
+	const GEN_FLT x198 = obj_qk * obj_qk * obj_qk;
+	const GEN_FLT c0 = x20 + x22;
+	const GEN_FLT c1 = x14 + (x10 * x17);
+	const GEN_FLT c2 = (-1 * x23) + (obj_qj * obj_qk * x15 * x16);
+	const GEN_FLT c3 = x14 + (x17 * x9);
+	const GEN_FLT c4 = x22 + (-1 * x20);
+	const GEN_FLT c5 = x32 + x34;
+	const GEN_FLT c6 = x34 + (-1 * x32);
+	const GEN_FLT c7 = x23 + (obj_qk * x21);
+	const GEN_FLT c8 = x14 + (x11 * x17);
+	const GEN_FLT c9 = -1 * lh_pz;
+	const GEN_FLT c10 = -1 * gibPhase_0;
+	const GEN_FLT c11 = -1 * phase_1;
+	const GEN_FLT c12 = tilt_0 * tilt_0;
+	const GEN_FLT c13 = (-1 * x81) + (2 * lh_qj * x25 * x26);
+	const GEN_FLT c14 = x79 + (2 * x41);
+	const GEN_FLT c15 = (-1 * x93) + (-1 * x94);
+	const GEN_FLT c16 = x92 + (-1 * x91);
+	const GEN_FLT c17 = (-1 * x79) + (-2 * x49);
+	const GEN_FLT c18 = x81 + (2 * x43);
+	const GEN_FLT c19 = x118 + x121;
+	const GEN_FLT c20 = (-1 * x107) + (-1 * x23) + (obj_qi * x10 * x104 * x18);
+	const GEN_FLT c21 = (-1 * x111) + (-1 * x115);
+	const GEN_FLT c22 = x127 + x131;
+	const GEN_FLT c23 = x111 + x125;
+	const GEN_FLT c24 = (-1 * x124) + (-1 * x23) + (obj_qi * x104 * x11 * x18);
+	const GEN_FLT c25 = (-1 * x23) + (-1 * x105 * x134) + (x104 * x134 * x18) + (2 * obj_qi * x15 * x16);
+	const GEN_FLT c26 = x118 + x135;
+	const GEN_FLT c27 = x127 + x136;
+	const GEN_FLT c28 = (-1 * x117) + (-1 * x32) + (obj_qj * x104 * x18 * x9);
+	const GEN_FLT c29 = x158 + x162;
+	const GEN_FLT c30 = x154 + x156;
+	const GEN_FLT c31 = (-1 * x156) + (-1 * x166);
+	const GEN_FLT c32 = x136 + x168;
+	const GEN_FLT c33 = (-1 * x165) + (-1 * x32) + (obj_qj * x104 * x11 * x18);
+	const GEN_FLT c34 = x158 + x172;
+	const GEN_FLT c35 = (-1 * x32) + (-1 * x105 * x171) + (x104 * x171 * x18) + (2 * obj_qj * x15 * x16);
+	const GEN_FLT c36 = x131 + x168;
+	const GEN_FLT c37 = x154 + x191;
+	const GEN_FLT c38 = (-1 * x167) + (-1 * x20) + (obj_qk * x10 * x104 * x18);
+	const GEN_FLT c39 = x135 + x192;
+	const GEN_FLT c40 = (-1 * x126) + (-1 * x20) + (obj_qk * x104 * x18 * x9);
+	const GEN_FLT c41 = (-1 * x166) + (-1 * x191);
+	const GEN_FLT c42 = x172 + x195;
+	const GEN_FLT c43 = x162 + x195;
+	const GEN_FLT c44 = x121 + x192;
+	const GEN_FLT c45 = (-1 * x20) + (-1 * x105 * x198) + (x104 * x18 * x198) + (2 * obj_qk * x15 * x16);
+	const GEN_FLT c46 = tilt_1 * tilt_1;
+	const GEN_FLT c47 = x91 + x92;
+	const GEN_FLT c48 = x79 + (2 * x7);
+	const GEN_FLT c49 = x94 + (-1 * x93);
+	prepared[0] = obj_px;
+	prepared[1] = obj_py;
+	prepared[2] = obj_pz;
+	prepared[3] = lh_px;
+	prepared[4] = lh_py;
+	prepared[5] = phase_0;
+	prepared[6] = tilt_0;
+	prepared[7] = curve_0;
+	prepared[8] = gibMag_0;
+	prepared[9] = tilt_1;
+	prepared[10] = curve_1;
+	prepared[11] = gibPhase_1;
+	prepared[12] = gibMag_1;
+	prepared[13] = x8;
+	prepared[14] = x31;
+	prepared[15] = x38;
+	prepared[16] = x42;
+	prepared[17] = x45;
+	prepared[18] = x46;
+	prepared[19] = x50;
+	prepared[20] = x51;
+	prepared[21] = x52;
+	prepared[22] = x69;
+	prepared[23] = x87;
+	prepared[24] = x97;
+	prepared[25] = c0;
+	prepared[26] = c1;
+	prepared[27] = c2;
+	prepared[28] = c3;
+	prepared[29] = c4;
+	prepared[30] = c5;
+	prepared[31] = c6;
+	prepared[32] = c7;
+	prepared[33] = c8;
+	prepared[34] = c9;
+	prepared[35] = c10;
+	prepared[36] = c11;
+	prepared[37] = c12;
+	prepared[38] = c13;
+	prepared[39] = c14;
+	prepared[40] = c15;
+	prepared[41] = c16;
+	prepared[42] = c17;
+	prepared[43] = c18;
+	prepared[44] = c19;
+	prepared[45] = c20;
+	prepared[46] = c21;
+	prepared[47] = c22;
+	prepared[48] = c23;
+	prepared[49] = c24;
+	prepared[50] = c25;
+	prepared[51] = c26;
+	prepared[52] = c27;
+	prepared[53] = c28;
+	prepared[54] = c29;
+	prepared[55] = c30;
+	prepared[56] = c31;
+	prepared[57] = c32;
+	prepared[58] = c33;
+	prepared[59] = c34;
+	prepared[60] = c35;
+	prepared[61] = c36;
+	prepared[62] = c37;
+	prepared[63] = c38;
+	prepared[64] = c39;
+	prepared[65] = c40;
+	prepared[66] = c41;
+	prepared[67] = c42;
+	prepared[68] = c43;
+	prepared[69] = c44;
+	prepared[70] = c45;
+	prepared[71] = c46;
+	prepared[72] = c47;
+	prepared[73] = c48;
+	prepared[74] = c49;
+}
+
+static inline void gen_reproject_val_jac_obj_p_axis_angle_eval(FLT *out, const FLT *prepared, const FLT *sensor_pt) {
+	const GEN_FLT obj_px = prepared[0];
+	const GEN_FLT obj_py = prepared[1];
+	const GEN_FLT obj_pz = prepared[2];
+	const GEN_FLT lh_px = prepared[3];
+	const GEN_FLT lh_py = prepared[4];
+	const GEN_FLT phase_0 = prepared[5];
+	const GEN_FLT tilt_0 = prepared[6];
+	const GEN_FLT curve_0 = prepared[7];
+	const GEN_FLT gibMag_0 = prepared[8];
+	const GEN_FLT tilt_1 = prepared[9];
+	const GEN_FLT curve_1 = prepared[10];
+	const GEN_FLT gibPhase_1 = prepared[11];
+	const GEN_FLT gibMag_1 = prepared[12];
+	const GEN_FLT x8 = prepared[13];
+	const GEN_FLT x31 = prepared[14];
+	const GEN_FLT x38 = prepared[15];
+	const GEN_FLT x42 = prepared[16];
+	const GEN_FLT x45 = prepared[17];
+	const GEN_FLT x46 = prepared[18];
+	const GEN_FLT x50 = prepared[19];
+	const GEN_FLT x51 = prepared[20];
+	const GEN_FLT x52 = prepared[21];
+	const GEN_FLT x69 = prepared[22];
+	const GEN_FLT x87 = prepared[23];
+	const GEN_FLT x97 = prepared[24];
+	const GEN_FLT c0 = prepared[25];
+	const GEN_FLT c1 = prepared[26];
+	const GEN_FLT c2 = prepared[27];
+	const GEN_FLT c3 = prepared[28];
+	const GEN_FLT c4 = prepared[29];
+	const GEN_FLT c5 = prepared[30];
+	const GEN_FLT c6 = prepared[31];
+	const GEN_FLT c7 = prepared[32];
+	const GEN_FLT c8 = prepared[33];
+	const GEN_FLT c9 = prepared[34];
+	const GEN_FLT c10 = prepared[35];
+	const GEN_FLT c11 = prepared[36];
+	const GEN_FLT c12 = prepared[37];
+	const GEN_FLT c13 = prepared[38];
+	const GEN_FLT c14 = prepared[39];
+	const GEN_FLT c15 = prepared[40];
+	const GEN_FLT c16 = prepared[41];
+	const GEN_FLT c17 = prepared[42];
+	const GEN_FLT c18 = prepared[43];
+	const GEN_FLT c19 = prepared[44];
+	const GEN_FLT c20 = prepared[45];
+	const GEN_FLT c21 = prepared[46];
+	const GEN_FLT c22 = prepared[47];
+	const GEN_FLT c23 = prepared[48];
+	const GEN_FLT c24 = prepared[49];
+	const GEN_FLT c25 = prepared[50];
+	const GEN_FLT c26 = prepared[51];
+	const GEN_FLT c27 = prepared[52];
+	const GEN_FLT c28 = prepared[53];
+	const GEN_FLT c29 = prepared[54];
+	const GEN_FLT c30 = prepared[55];
+	const GEN_FLT c31 = prepared[56];
+	const GEN_FLT c32 = prepared[57];
+	const GEN_FLT c33 = prepared[58];
+	const GEN_FLT c34 = prepared[59];
+	const GEN_FLT c35 = prepared[60];
+	const GEN_FLT c36 = prepared[61];
+	const GEN_FLT c37 = prepared[62];
+	const GEN_FLT c38 = prepared[63];
+	const GEN_FLT c39 = prepared[64];
+	const GEN_FLT c40 = prepared[65];
+	const GEN_FLT c41 = prepared[66];
+	const GEN_FLT c42 = prepared[67];
+	const GEN_FLT c43 = prepared[68];
+	const GEN_FLT c44 = prepared[69];
+	const GEN_FLT c45 = prepared[70];
+	const GEN_FLT c46 = prepared[71];
+	const GEN_FLT c47 = prepared[72];
+	const GEN_FLT c48 = prepared[73];
+	const GEN_FLT c49 = prepared[74];
+	const GEN_FLT sensor_x = sensor_pt[0];
+	const GEN_FLT sensor_y = sensor_pt[1];
+	const GEN_FLT sensor_z = sensor_pt[2];
+	const GEN_FLT x24 = obj_py + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLT x35 = obj_px + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLT x39 = obj_pz + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLT x40 = lh_py + (x24 * x8) + (x31 * x35) + (x38 * x39);
+	const GEN_FLT x47 = lh_px + (x24 * x46) + (x35 * x42) + (x39 * x45);
+	const GEN_FLT x48 = x47 * x47;
+	const GEN_FLT x53 = c9 + (-1 * x24 * x51) + (-1 * x35 * x52) + (-1 * x39 * x50);
+	const GEN_FLT x54 = x53 * x53;
+	const GEN_FLT x55 = x48 + x54;
+	const GEN_FLT x56 = tilt_0 * (1. / sqrt(x55));
+	const GEN_FLT x57 = atan2(x47, x53);
+	const GEN_FLT x58 = phase_0 + x57 + asin(x40 * x56);
+	const GEN_FLT x59 = -1.5707963267949 + x58 + c10;
+	const GEN_FLT x60 = atan2(x40, x53);
+	const GEN_FLT x61 = x40 * x40;
+	const GEN_FLT x62 = x54 + x61;
+	const GEN_FLT x63 = tilt_1 * (1. / sqrt(x62));
+	const GEN_FLT x64 = asin(x47 * x63);
+	const GEN_FLT x65 = 1.5707963267949 + gibPhase_1 + x60 + c11 + (-1 * x64);
+	const GEN_FLT x66 = 1. / x62;
+	const GEN_FLT x67 = x53 * x66;
+	const GEN_FLT x68 = x31 * x67;
+	const GEN_FLT x70 = -1 * x40 * x66;
+	const GEN_FLT x71 = x69 * x70;
+	const GEN_FLT x72 = sin(x59);
+	const GEN_FLT x73 = 1. / x55;
+	const GEN_FLT x74 = x53 * x73;
+	const GEN_FLT x75 = x42 * x74;
+	const GEN_FLT x76 = -1 * x47 * x73;
+	const GEN_FLT x77 = x69 * x76;
+	const GEN_FLT x78 = 1. / sqrt(1 + (-1 * x61 * x73 * c12));
+	const GEN_FLT x80 = 1.0/2.0 * x47;
+	const GEN_FLT x82 = 1.0/2.0 * x53;
+	const GEN_FLT x83 = x82 * c13;
+	const GEN_FLT x84 = tilt_0 * x40 * (1. / (x55 * sqrt(x55)));
+	const GEN_FLT x85 = x75 + x77 + (x78 * ((x31 * x56) + (x84 * ((-1 * x83) + (-1 * x80 * c14)))));
+	const GEN_FLT x86 = x67 * x8;
+	const GEN_FLT x88 = x70 * x87;
+	const GEN_FLT x89 = x46 * x74;
+	const GEN_FLT x90 = x76 * x87;
+	const GEN_FLT x95 = x82 * c15;
+	const GEN_FLT x96 = x89 + x90 + (x78 * ((x56 * x8) + (x84 * ((-1 * x95) + (-1 * x80 * c16)))));
+	const GEN_FLT x98 = x70 * x97;
+	const GEN_FLT x99 = x38 * x67;
+	const GEN_FLT x100 = x76 * x97;
+	const GEN_FLT x101 = x45 * x74;
+	const GEN_FLT x102 = x82 * c17;
+	const GEN_FLT x103 = x100 + x101 + (x78 * ((x38 * x56) + (x84 * ((-1 * x102) + (-1 * x80 * c18)))));
+	const GEN_FLT x122 = (sensor_x * c19) + (sensor_y * c20) + (sensor_z * c21);
+	const GEN_FLT x123 = x122 * x8;
+	const GEN_FLT x132 = (sensor_x * c22) + (sensor_y * c23) + (sensor_z * c24);
+	const GEN_FLT x133 = x132 * x38;
+	const GEN_FLT x137 = (sensor_x * c25) + (sensor_y * c26) + (sensor_z * c27);
+	const GEN_FLT x138 = x137 * x31;
+	const GEN_FLT x139 = x123 + x133 + x138;
+	const GEN_FLT x140 = x139 * x67;
+	const GEN_FLT x141 = x132 * x50;
+	const GEN_FLT x142 = x122 * x51;
+	const GEN_FLT x143 = x137 * x52;
+	const GEN_FLT x144 = (-1 * x141) + (-1 * x142) + (-1 * x143);
+	const GEN_FLT x145 = x144 * x70;
+	const GEN_FLT x146 = x132 * x45;
+	const GEN_FLT x147 = x122 * x46;
+	const GEN_FLT x148 = x137 * x42;
+	const GEN_FLT x149 = x146 + x147 + x148;
+	const GEN_FLT x150 = x149 * x74;
+	const GEN_FLT x151 = x144 * x76;
+	const GEN_FLT x152 = x82 * ((-2 * x141) + (-2 * x142) + (-2 * x143));
+	const GEN_FLT x153 = x150 + x151 + (x78 * ((x139 * x56) + (x84 * ((-1 * x152) + (-1 * x80 * ((2 * x146) + (2 *
+		x147) + (2 * x148)))))));
+	const GEN_FLT x163 = (sensor_x * c28) + (sensor_y * c29) + (sensor_z * c30);
+	const GEN_FLT x164 = x163 * x31;
+	const GEN_FLT x169 = (sensor_x * c31) + (sensor_y * c32) + (sensor_z * c33);
+	const GEN_FLT x170 = x169 * x38;
+	const GEN_FLT x173 = (sensor_x * c34) + (sensor_y * c35) + (sensor_z * c36);
+	const GEN_FLT x174 = x173 * x8;
+	const GEN_FLT x175 = x164 + x170 + x174;
+	const GEN_FLT x176 = x175 * x67;
+	const GEN_FLT x177 = x169 * x50;
+	const GEN_FLT x178 = x163 * x52;
+	const GEN_FLT x179 = x173 * x51;
+	const GEN_FLT x180 = (-1 * x177) + (-1 * x178) + (-1 * x179);
+	const GEN_FLT x181 = x180 * x70;
+	const GEN_FLT x182 = x163 * x42;
+	const GEN_FLT x183 = x169 * x45;
+	const GEN_FLT x184 = x173 * x46;
+	const GEN_FLT x185 = x182 + x183 + x184;
+	const GEN_FLT x186 = x185 * x74;
+	const GEN_FLT x187 = x180 * x76;
+	const GEN_FLT x188 = x82 * ((-2 * x177) + (-2 * x178) + (-2 * x179));
+	const GEN_FLT x189 = x186 + x187 + (x78 * ((x175 * x56) + (x84 * ((-1 * x188) + (-1 * x80 * ((2 * x182) + (2 *
+		x183) + (2 * x184)))))));
+	const GEN_FLT x193 = (sensor_x * c37) + (sensor_y * c38) + (sensor_z * c39);
+	const GEN_FLT x194 = x193 * x8;
+	const GEN_FLT x196 = (sensor_x * c40) + (sensor_y * c41) + (sensor_z * c42);
+	const GEN_FLT x197 = x196 * x31;
+	const GEN_FLT x199 = (sensor_x * c43) + (sensor_y * c44) + (sensor_z * c45);
+	const GEN_FLT x200 = x199 * x38;
+	const GEN_FLT x201 = x194 + x197 + x200;
+	const GEN_FLT x202 = x201 * x67;
+	const GEN_FLT x203 = x193 * x51;
+	const GEN_FLT x204 = x196 * x52;
+	const GEN_FLT x205 = x199 * x50;
+	const GEN_FLT x206 = (-1 * x203) + (-1 * x204) + (-1 * x205);
+	const GEN_FLT x207 = x206 * x70;
+	const GEN_FLT x208 = x196 * x42;
+	const GEN_FLT x209 = x193 * x46;
+	const GEN_FLT x210 = x199 * x45;
+	const GEN_FLT x211 = x208 + x209 + x210;
+	const GEN_FLT x212 = x211 * x74;
+	const GEN_FLT x213 = x206 * x76;
+	const GEN_FLT x214 = x82 * ((-2 * x203) + (-2 * x204) + (-2 * x205));
+	const GEN_FLT x215 = x212 + x213 + (x78 * ((x201 * x56) + (x84 * ((-1 * x214) + (-1 * x80 * ((2 * x208) + (2 *
+		x209) + (2 * x210)))))));
+	const GEN_FLT x216 = curve_1 * x57;
+	const GEN_FLT x217 = 1. / sqrt(1 + (-1 * x48 * x66 * c46));
+	const GEN_FLT x218 = 1.0/2.0 * x40;
+	const GEN_FLT x219 = tilt_1 * x47 * (1. / (x62 * sqrt(x62)));
+	const GEN_FLT x220 = x68 + x71 + (-1 * x217 * ((x219 * ((-1 * x83) + (-1 * x218 * c47))) + (x42 * x63)));
+	const GEN_FLT x221 = gibMag_1 * sin(x65);
+	const GEN_FLT x222 = x86 + x88 + (-1 * x217 * ((x219 * ((-1 * x95) + (-1 * x218 * c48))) + (x46 * x63)));
+	const GEN_FLT x223 = x98 + x99 + (-1 * x217 * ((x219 * ((-1 * x102) + (-1 * x218 * c49))) + (x45 * x63)));
+	const GEN_FLT x224 = x140 + x145 + (-1 * x217 * ((x149 * x63) + (x219 * ((-1 * x152) + (-1 * x218 * ((2 * x123) +
+		(2 * x133) + (2 * x138)))))));
+	const GEN_FLT x225 = x176 + x181 + (-1 * x217 * ((x185 * x63) + (x219 * ((-1 * x188) + (-1 * x218 * ((2 * x164) +
+		(2 * x170) + (2 * x174)))))));
+	const GEN_FLT x226 = x202 + x207 + (-1 * x217 * ((x211 * x63) + (x219 * ((-1 * x214) + (-1 * x218 * ((2 * x194) +
+		(2 * x197) + (2 * x200)))))));
+	out[0] = (-1 * x58) + (curve_0 * (x60 * x60)) + (-1 * gibMag_0 * cos(x59));
+	out[1] = x60 + c11 + (-1 * x64) + (curve_1 * (x57 * x57)) + (-1 * gibMag_1 * cos(x65));
+	out[2] = (-1 * x85) + (curve_0 * x60 * ((2 * x68) + (2 * x71))) + (gibMag_0 * x72 * x85);
+	out[3] = (-1 * x96) + (curve_0 * x60 * ((2 * x86) + (2 * x88))) + (gibMag_0 * x72 * x96);
+	out[4] = (-1 * x103) + (curve_0 * x60 * ((2 * x98) + (2 * x99))) + (gibMag_0 * x103 * x72);
+	out[5] = (-1 * x153) + (curve_0 * x60 * ((2 * x140) + (2 * x145))) + (gibMag_0 * x153 * x72);
+	out[6] = (-1 * x189) + (curve_0 * x60 * ((2 * x176) + (2 * x181))) + (gibMag_0 * x189 * x72);
+	out[7] = (-1 * x215) + (curve_0 * x60 * ((2 * x202) + (2 * x207))) + (gibMag_0 * x215 * x72);
+	out[8] = x220 + (x216 * ((2 * x75) + (2 * x77))) + (x220 * x221);
+	out[9] = x222 + (x216 * ((2 * x89) + (2 * x90))) + (x221 * x222);
+	out[10] = x223 + (x216 * ((2 * x100) + (2 * x101))) + (x221 * x223);
+	out[11] = x224 + (x216 * ((2 * x150) + (2 * x151))) + (x221 * x224);
+	out[12] = x225 + (x216 * ((2 * x186) + (2 * x187))) + (x221 * x225);
+	out[13] = x226 + (x216 * ((2 * x212) + (2 * x213))) + (x221 * x226);
+}
+
+// Value of reproject then its jacobian wrt obj_p, lh_p
+enum { gen_reproject_val_jac_obj_p_lh_p_axis_angle_prepared_size = 102 };
+
+static inline void gen_reproject_val_jac_obj_p_lh_p_axis_angle_prepare(FLT *prepared, const LinmathAxisAnglePose *obj_p,
+																	   const LinmathAxisAnglePose *lh_p,
+																	   const BaseStationCal *bsd) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_0 = bsd[0].phase;
+	const GEN_FLT tilt_0 = bsd[0].tilt;
+	const GEN_FLT curve_0 = bsd[0].curve;
+	const GEN_FLT gibPhase_0 = bsd[0].gibpha;
+	const GEN_FLT gibMag_0 = bsd[0].gibmag;
+	const GEN_FLT ogeeMag_0 = bsd[0].ogeephase;
+	const GEN_FLT ogeePhase_0 = bsd[0].ogeemag;
+	const GEN_FLT phase_1 = bsd[1].phase;
+	const GEN_FLT tilt_1 = bsd[1].tilt;
+	const GEN_FLT curve_1 = bsd[1].curve;
+	const GEN_FLT gibPhase_1 = bsd[1].gibpha;
+	const GEN_FLT gibMag_1 = bsd[1].gibmag;
+	const GEN_FLT ogeeMag_1 = bsd[1].ogeephase;
+	const GEN_FLT ogeePhase_1 = bsd[1].ogeemag;
+	const GEN_FLT x0 = lh_qi * lh_qi;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qk * lh_qk;
+	const GEN_FLT x3 = 1e-10 + x0 + x1 + x2;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = cos(x4);
+	const GEN_FLT x6 = 1. / x3;
+	const GEN_FLT x7 = 1 + (-1 * x5);
+	const GEN_FLT x8 = x6 * x7;
+	const GEN_FLT x9 = x1 * x8;
+	const GEN_FLT x10 = x5 + x9;
+	const GEN_FLT x11 = obj_qi * obj_qi;
+	const GEN_FLT x12 = obj_qj * obj_qj;
+	const GEN_FLT x13 = obj_qk * obj_qk;
+	const GEN_FLT x14 = 1e-10 + x11 + x12 + x13;
+	const GEN_FLT x15 = sqrt(x14);
+	const GEN_FLT x16 = cos(x15);
+	const GEN_FLT x17 = 1. / x14;
+	const GEN_FLT x18 = 1 + (-1 * x16);
+	const GEN_FLT x19 = x17 * x18;
+	const GEN_FLT x20 = sin(x15);
+	const GEN_FLT x21 = x20 * (1. / x15);
+	const GEN_FLT x22 = obj_qk * x21;
+	const GEN_FLT x23 = obj_qj * x19;
+	const GEN_FLT x24 = obj_qi * x23;
+	const GEN_FLT x25 = obj_qi * x21;
+	const GEN_FLT x27 = 1. / x4;
+	const GEN_FLT x28 = sin(x4);
+	const GEN_FLT x29 = x27 * x28;
+	const GEN_FLT x30 = lh_qk * x29;
+	const GEN_FLT x31 = lh_qj * x8;
+	const GEN_FLT x32 = lh_qi * x31;
+	const GEN_FLT x33 = x30 + x32;
+	const GEN_FLT x34 = obj_qj * x21;
+	const GEN_FLT x35 = obj_qk * x19;
+	const GEN_FLT x36 = obj_qi * x35;
+	const GEN_FLT x38 = lh_qi * x29;
+	const GEN_FLT x39 = lh_qk * x31;
+	const GEN_FLT x40 = x39 + (-1 * x38);
+	const GEN_FLT x43 = x0 * x8;
+	const GEN_FLT x44 = x43 + x5;
+	const GEN_FLT x45 = lh_qj * x29;
+	const GEN_FLT x46 = lh_qk * x8;
+	const GEN_FLT x47 = lh_qi * x46;
+	const GEN_FLT x48 = x45 + x47;
+	const GEN_FLT x49 = x32 + (-1 * x30);
+	const GEN_FLT x52 = x2 * x8;
+	const GEN_FLT x53 = x5 + x52;
+	const GEN_FLT x54 = x38 + x39;
+	const GEN_FLT x55 = x47 + (-1 * x45);
+	const GEN_FLT x72 = -1 * x55;
+	const GEN_FLT x84 = 2 * x5;
+	const GEN_FLT x86 = 2 * x47;
+	const GEN_FLT x92 = -1 * x54;
+	const GEN_FLT x96 = 2 * x30;
+	const GEN_FLT x97 = 2 * x32;
+	const GEN_FLT x98 = 2 * x38;
+	const GEN_FLT x99 = 2 * x39;
+	const GEN_FLT x102 = -1 * x53;
+	const GEN_FLT x109 = 1. / (x14 * sqrt(x14));
+	const GEN_FLT x110 = 2 * x18 * (1. / (x14 * x14));
+	const GEN_FLT x111 = obj_qi * x110;
+	const GEN_FLT x112 = x111 * x12;
+	const GEN_FLT x113 = x16 * x17;
+	const GEN_FLT x114 = x109 * x20;
+	const GEN_FLT x115 = x11 * x114;
+	const GEN_FLT x116 = x21 + (-1 * x115) + (x11 * x113);
+	const GEN_FLT x117 = obj_qi * obj_qk;
+	const GEN_FLT x118 = obj_qj * x110;
+	const GEN_FLT x119 = x117 * x118;
+	const GEN_FLT x120 = x119 + (-1 * obj_qi * obj_qj * obj_qk * x109 * x20);
+	const GEN_FLT x121 = x11 * x110;
+	const GEN_FLT x122 = obj_qj * x121;
+	const GEN_FLT x123 = x23 + (-1 * x122) + (obj_qj * x115);
+	const GEN_FLT x124 = x113 * x117;
+	const GEN_FLT x125 = x114 * x117;
+	const GEN_FLT x126 = x124 + (-1 * x125);
+	const GEN_FLT x129 = x111 * x13;
+	const GEN_FLT x130 = (-1 * x119) + (obj_qj * x125);
+	const GEN_FLT x131 = obj_qk * x121;
+	const GEN_FLT x132 = x35 + (-1 * x131) + (obj_qk * x115);
+	const GEN_FLT x133 = obj_qi * obj_qj;
+	const GEN_FLT x134 = x114 * x133;
+	const GEN_FLT x135 = x113 * x133;
+	const GEN_FLT x136 = x134 + (-1 * x135);
+	const GEN_FLT x139 = obj_qi * obj_qi * obj_qi;
+	const GEN_FLT x140 = x125 + (-1 * x124);
+	const GEN_FLT x141 = x135 + (-1 * x134);
+	const GEN_FLT x159 = x130 + x21;
+	const GEN_FLT x160 = x114 * x12;
+	const GEN_FLT x161 = (-1 * x160) + (x113 * x12);
+	const GEN_FLT x162 = obj_qi * x19;
+	const GEN_FLT x163 = x162 + (-1 * x112) + (obj_qi * x160);
+	const GEN_FLT x164 = obj_qj * obj_qk;
+	const GEN_FLT x165 = x114 * x164;
+	const GEN_FLT x166 = x113 * x164;
+	const GEN_FLT x167 = x165 + (-1 * x166);
+	const GEN_FLT x170 = x118 * x13;
+	const GEN_FLT x171 = x120 + x21;
+	const GEN_FLT x172 = obj_qk * x110 * x12;
+	const GEN_FLT x173 = x35 + (-1 * x172) + (obj_qk * x160);
+	const GEN_FLT x176 = obj_qj * obj_qj * obj_qj;
+	const GEN_FLT x177 = x166 + (-1 * x165);
+	const GEN_FLT x195 = x114 * x13;
+	const GEN_FLT x196 = (-1 * x195) + (x113 * x13);
+	const GEN_FLT x197 = x23 + (-1 * x170) + (obj_qj * x195);
+	const GEN_FLT x200 = x162 + (-1 * x129) + (obj_qi * x195);
+	const GEN_FLT x203 = obj_qk * obj_qk * obj_qk;
+	const GEN_FLT x238 = 1. / (x3 * sqrt(x3));
+	const GEN_FLT x239 = 2 * x7 * (1. / (x3 * x3));
+	const GEN_FLT x240 = lh_qi * x239;
+	const GEN_FLT x241 = x1 * x240;
+	const GEN_FLT x243 = x5 * x6;
+	const GEN_FLT x244 = x238 * x28;
+	const GEN_FLT x245 = x0 * x244;
+	const GEN_FLT x246 = x29 + (-1 * x245) + (x0 * x243);
+	const GEN_FLT x247 = lh_qi * lh_qk;
+	const GEN_FLT x248 = lh_qj * x239;
+	const GEN_FLT x249 = x247 * x248;
+	const GEN_FLT x250 = x249 + (-1 * lh_qi * lh_qj * lh_qk * x238 * x28);
+	const GEN_FLT x252 = x0 * x239;
+	const GEN_FLT x253 = lh_qj * x252;
+	const GEN_FLT x254 = x31 + (-1 * x253) + (lh_qj * x245);
+	const GEN_FLT x255 = x243 * x247;
+	const GEN_FLT x256 = x244 * x247;
+	const GEN_FLT x257 = x255 + (-1 * x256);
+	const GEN_FLT x261 = x2 * x240;
+	const GEN_FLT x263 = (-1 * x249) + (lh_qj * x256);
+	const GEN_FLT x265 = lh_qk * x252;
+	const GEN_FLT x266 = x46 + (-1 * x265) + (lh_qk * x245);
+	const GEN_FLT x267 = lh_qi * lh_qj;
+	const GEN_FLT x268 = x244 * x267;
+	const GEN_FLT x269 = x243 * x267;
+	const GEN_FLT x270 = x268 + (-1 * x269);
+	const GEN_FLT x275 = lh_qi * lh_qi * lh_qi;
+	const GEN_FLT x277 = x256 + (-1 * x255);
+	const GEN_FLT x279 = x269 + (-1 * x268);
+	const GEN_FLT x285 = x2 * x248;
+	const GEN_FLT x287 = x250 + x29;
+	const GEN_FLT x288 = x1 * x244;
+	const GEN_FLT x289 = (-1 * x288) + (x1 * x243);
+	const GEN_FLT x291 = lh_qk * x1 * x239;
+	const GEN_FLT x292 = x46 + (-1 * x291) + (lh_qk * x288);
+	const GEN_FLT x296 = lh_qj * lh_qj * lh_qj;
+	const GEN_FLT x298 = lh_qi * x8;
+	const GEN_FLT x299 = x298 + (-1 * x241) + (lh_qi * x288);
+	const GEN_FLT x300 = lh_qj * lh_qk;
+	const GEN_FLT x301 = x243 * x300;
+	const GEN_FLT x302 = x244 * x300;
+	const GEN_FLT x303 = x301 + (-1 * x302);
+	const GEN_FLT x309 = x263 + x29;
+	const GEN_FLT x311 = x302 + (-1 * x301);
+	const GEN_FLT x319 = x2 * x244;
+	const GEN_FLT x320 = (-1 * x319) + (x2 * x243);
+	const GEN_FLT x322 = x31 + (-1 * x285) + (lh_qj * x319);
+	const GEN_FLT x326 = lh_qk * lh_qk * lh_qk;
+	const GEN_FLT x328 = x298 + (-1 * x261) + (lh_qi * x319);
+	const GEN_FLT c0 = x22 + x24;
+	const GEN_FLT c1 = x16 + (x12 * x19);
+	const GEN_FLT c2 = (-1 * x25) + (obj_qj * obj_qk * x17 * x18);
+	const GEN_FLT c3 = x16 + (x11 * x19);
+	const GEN_FLT c4 = x24 + (-1 * x22);
+	const GEN_FLT c5 = x34 + x36;
+	const GEN_FLT c6 = x36 + (-1 * x34);
+	const GEN_FLT c7 = x25 + (obj_qk * x23);
+	const GEN_FLT c8 = x16 + (x13 * x19);
+	const GEN_FLT c9 = -1 * lh_pz;
+	const GEN_FLT c10 = -1 * gibPhase_0;
+	const GEN_FLT c11 = -1 * phase_1;
+	const GEN_FLT c12 = tilt_0 * tilt_0;
+	const GEN_FLT c13 = (-1 * x86) + (2 * lh_qj * x27 * x28);
+	const GEN_FLT c14 = x84 + (2 * x43);
+	const GEN_FLT c15 = (-1 * x98) + (-1 * x99);
+	const GEN_FLT c16 = x97 + (-1 * x96);
+	const GEN_FLT c17 = (-1 * x84) + (-2 * x52);
+	const GEN_FLT c18 = x86 + (2 * x45);
+	const GEN_FLT c19 = x123 + x126;
+	const GEN_FLT c20 = (-1 * x112) + (-1 * x25) + (obj_qi * x109 * x12 * x20);
+	const GEN_FLT c21 = (-1 * x116) + (-1 * x120);
+	const GEN_FLT c22 = x132 + x136;
+	const GEN_FLT c23 = x116 + x130;
+	const GEN_FLT c24 = (-1 * x129) + (-1 * x25) + (obj_qi * x109 * x13 * x20);
+	const GEN_FLT c25 = (-1 * x25) + (-1 * x110 * x139) + (x109 * x139 * x20) + (2 * obj_qi * x17 * x18);
+	const GEN_FLT c26 = x123 + x140;
+	const GEN_FLT c27 = x132 + x141;
+	const GEN_FLT c28 = (-1 * x122) + (-1 * x34) + (obj_qj * x109 * x11 * x20);
+	const GEN_FLT c29 = x163 + x167;
+	const GEN_FLT c30 = x159 + x161;
+	const GEN_FLT c31 = (-1 * x161) + (-1 * x171);
+	const GEN_FLT c32 = x141 + x173;
+	const GEN_FLT c33 = (-1 * x170) + (-1 * x34) + (obj_qj * x109 * x13 * x20);
+	const GEN_FLT c34 = x163 + x177;
+	const GEN_FLT c35 = (-1 * x34) + (-1 * x110 * x176) + (x109 * x176 * x20) + (2 * obj_qj * x17 * x18);
+	const GEN_FLT c36 = x136 + x173;
+	const GEN_FLT c37 = x159 + x196;
+	const GEN_FLT c38 = (-1 * x172) + (-1 * x22) + (obj_qk * x109 * x12 * x20);
+	const GEN_FLT c39 = x140 + x197;
+	const GEN_FLT c40 = (-1 * x131) + (-1 * x22) + (obj_qk * x109 * x11 * x20);
+	const GEN_FLT c41 = (-1 * x171) + (-1 * x196);
+	const GEN_FLT c42 = x177 + x200;
+	const GEN_FLT c43 = x167 + x200;
+	const GEN_FLT c44 = x126 + x197;
+	const GEN_FLT c45 = (-1 * x22) + (-1 * x110 * x203) + (x109 * x20 * x203) + (2 * obj_qk * x17 * x18);
+	const GEN_FLT c46 = tilt_1 * tilt_1;
+	const GEN_FLT c47 = x96 + x97;
+	const GEN_FLT c48 = x84 + (2 * x9);
+	const GEN_FLT c49 = x99 + (-1 * x98);
+	const GEN_FLT c50 = (-1 * x241) + (-1 * x38) + (lh_qi * x1 * x238 * x28);
+	const GEN_FLT c51 = (-1 * x246) + (-1 * x250);
+	const GEN_FLT c52 = x254 + x257;
+	const GEN_FLT c53 = (-1 * x261) + (-1 * x38) + (lh_qi * x2 * x238 * x28);
+	const GEN_FLT c54 = x246 + x263;
+	const GEN_FLT c55 = x266 + x270;
+	const GEN_FLT c56 = (-1 * x38) + (-1 * x239 * x275) + (x238 * x275 * x28) + (2 * lh_qi * x6 * x7);
+	const GEN_FLT c57 = x254 + x277;
+	const GEN_FLT c58 = x266 + x279;
+	const GEN_FLT c59 = (-1 * x285) + (-1 * x45) + (lh_qj * x2 * x238 * x28);
+	const GEN_FLT c60 = (-1 * x287) + (-1 * x289);
+	const GEN_FLT c61 = x279 + x292;
+	const GEN_FLT c62 = (-1 * x45) + (-1 * x239 * x296) + (x238 * x28 * x296) + (2 * lh_qj * x6 * x7);
+	const GEN_FLT c63 = x299 + x303;
+	const GEN_FLT c64 = x270 + x292;
+	const GEN_FLT c65 = (-1 * x253) + (-1 * x45) + (lh_qj * x0 * x238 * x28);
+	const GEN_FLT c66 = x289 + x309;
+	const GEN_FLT c67 = x299 + x311;
+	const GEN_FLT c68 = (-1 * x291) + (-1 * x30) + (lh_qk * x1 * x238 * x28);
+	const GEN_FLT c69 = x309 + x320;
+	const GEN_FLT c70 = x277 + x322;
+	const GEN_FLT c71 = (-1 * x30) + (-1 * x239 * x326) + (x238 * x28 * x326) + (2 * lh_qk * x6 * x7);
+	const GEN_FLT c72 = x311 + x328;
+	const GEN_FLT c73 = x257 + x322;
+	const GEN_FLT c74 = (-1 * x265) + (-1 * x30) + (lh_qk * x0 * x238 * x28);
+	const GEN_FLT c75 = (-1 * x287) + (-1 * x320);
+	const GEN_FLT c76 = x303 + x328;
+	prepared[0] = obj_px;
+	prepared[1] = obj_py;
+	prepared[2] = obj_pz;
+	prepared[3] = lh_px;
+	prepared[4] = lh_py;
+	prepared[5] = phase_0;
+	prepared[6] = tilt_0;
+	prepared[7] = curve_0;
+	prepared[8] = gibMag_0;
+	prepared[9] = tilt_1;
+	prepared[10] = curve_1;
+	prepared[11] = gibPhase_1;
+	prepared[12] = gibMag_1;
+	prepared[13] = x10;
+	prepared[14] = x33;
+	prepared[15] = x40;
+	prepared[16] = x44;
+	prepared[17] = x48;
+	prepared[18] = x49;
+	prepared[19] = x53;
+	prepared[20] = x54;
+	prepared[21] = x55;
+	prepared[22] = x72;
+	prepared[23] = x92;
+	prepared[24] = x102;
+	prepared[25] = c0;
+	prepared[26] = c1;
+	prepared[27] = c2;
+	prepared[28] = c3;
+	prepared[29] = c4;
+	prepared[30] = c5;
+	prepared[31] = c6;
+	prepared[32] = c7;
+	prepared[33] = c8;
+	prepared[34] = c9;
+	prepared[35] = c10;
+	prepared[36] = c11;
+	prepared[37] = c12;
+	prepared[38] = c13;
+	prepared[39] = c14;
+	prepared[40] = c15;
+	prepared[41] = c16;
+	prepared[42] = c17;
+	prepared[43] = c18;
+	prepared[44] = c19;
+	prepared[45] = c20;
+	prepared[46] = c21;
+	prepared[47] = c22;
+	prepared[48] = c23;
+	prepared[49] = c24;
+	prepared[50] = c25;
+	prepared[51] = c26;
+	prepared[52] = c27;
+	prepared[53] = c28;
+	prepared[54] = c29;
+	prepared[55] = c30;
+	prepared[56] = c31;
+	prepared[57] = c32;
+	prepared[58] = c33;
+	prepared[59] = c34;
+	prepared[60] = c35;
+	prepared[61] = c36;
+	prepared[62] = c37;
+	prepared[63] = c38;
+	prepared[64] = c39;
+	prepared[65] = c40;
+	prepared[66] = c41;
+	prepared[67] = c42;
+	prepared[68] = c43;
+	prepared[69] = c44;
+	prepared[70] = c45;
+	prepared[71] = c46;
+	prepared[72] = c47;
+	prepared[73] = c48;
+	prepared[74] = c49;
+	prepared[75] = c50;
+	prepared[76] = c51;
+	prepared[77] = c52;
+	prepared[78] = c53;
+	prepared[79] = c54;
+	prepared[80] = c55;
+	prepared[81] = c56;
+	prepared[82] = c57;
+	prepared[83] = c58;
+	prepared[84] = c59;
+	prepared[85] = c60;
+	prepared[86] = c61;
+	prepared[87] = c62;
+	prepared[88] = c63;
+	prepared[89] = c64;
+	prepared[90] = c65;
+	prepared[91] = c66;
+	prepared[92] = c67;
+	prepared[93] = c68;
+	prepared[94] = c69;
+	prepared[95] = c70;
+	prepared[96] = c71;
+	prepared[97] = c72;
+	prepared[98] = c73;
+	prepared[99] = c74;
+	prepared[100] = c75;
+	prepared[101] = c76;
+}
+
+static inline void gen_reproject_val_jac_obj_p_lh_p_axis_angle_eval(FLT *out, const FLT *prepared,
+																	const FLT *sensor_pt) {
+	const GEN_FLT obj_px = prepared[0];
+	const GEN_FLT obj_py = prepared[1];
+	const GEN_FLT obj_pz = prepared[2];
+	const GEN_FLT lh_px = prepared[3];
+	const GEN_FLT lh_py = prepared[4];
+	const GEN_FLT phase_0 = prepared[5];
+	const GEN_FLT tilt_0 = prepared[6];
+	const GEN_FLT curve_0 = prepared[7];
+	const GEN_FLT gibMag_0 = prepared[8];
+	const GEN_FLT tilt_1 = prepared[9];
+	const GEN_FLT curve_1 = prepared[10];
+	const GEN_FLT gibPhase_1 = prepared[11];
+	const GEN_FLT gibMag_1 = prepared[12];
+	const GEN_FLT x10 = prepared[13];
+	const GEN_FLT x33 = prepared[14];
+	const GEN_FLT x40 = prepared[15];
+	const GEN_FLT x44 = prepared[16];
+	const GEN_FLT x48 = prepared[17];
+	const GEN_FLT x49 = prepared[18];
+	const GEN_FLT x53 = prepared[19];
+	const GEN_FLT x54 = prepared[20];
+	const GEN_FLT x55 = prepared[21];
+	const GEN_FLT x72 = prepared[22];
+	const GEN_FLT x92 = prepared[23];
+	const GEN_FLT x102 = prepared[24];
+	const GEN_FLT c0 = prepared[25];
+	const GEN_FLT c1 = prepared[26];
+	const GEN_FLT c2 = prepared[27];
+	const GEN_FLT c3 = prepared[28];
+	const GEN_FLT c4 = prepared[29];
+	const GEN_FLT c5 = prepared[30];
+	const GEN_FLT c6 = prepared[31];
+	const GEN_FLT c7 = prepared[32];
+	const GEN_FLT c8 = prepared[33];
+	const GEN_FLT c9 = prepared[34];
+	const GEN_FLT c10 = prepared[35];
+	const GEN_FLT c11 = prepared[36];
+	const GEN_FLT c12 = prepared[37];
+	const GEN_FLT c13 = prepared[38];
+	const GEN_FLT c14 = prepared[39];
+	const GEN_FLT c15 = prepared[40];
+	const GEN_FLT c16 = prepared[41];
+	const GEN_FLT c17 = prepared[42];
+	const GEN_FLT c18 = prepared[43];
+	const GEN_FLT c19 = prepared[44];
+	const GEN_FLT c20 = prepared[45];
+	const GEN_FLT c21 = prepared[46];
+	const GEN_FLT c22 = prepared[47];
+	const GEN_FLT c23 = prepared[48];
+	const GEN_FLT c24 = prepared[49];
+	const GEN_FLT c25 = prepared[50];
+	const GEN_FLT c26 = prepared[51];
+	const GEN_FLT c27 = prepared[52];
+	const GEN_FLT c28 = prepared[53];
+	const GEN_FLT c29 = prepared[54];
+	const GEN_FLT c30 = prepared[55];
+	const GEN_FLT c31 = prepared[56];
+	const GEN_FLT c32 = prepared[57];
+	const GEN_FLT c33 = prepared[58];
+	const GEN_FLT c34 = prepared[59];
+	const GEN_FLT c35 = prepared[60];
+	const GEN_FLT c36 = prepared[61];
+	const GEN_FLT c37 = prepared[62];
+	const GEN_FLT c38 = prepared[63];
+	const GEN_FLT c39 = prepared[64];
+	const GEN_FLT c40 = prepared[65];
+	const GEN_FLT c41 = prepared[66];
+	const GEN_FLT c42 = prepared[67];
+	const GEN_FLT c43 = prepared[68];
+	const GEN_FLT c44 = prepared[69];
+	const GEN_FLT c45 = prepared[70];
+	const GEN_FLT c46 = prepared[71];
+	const GEN_FLT c47 = prepared[72];
+	const GEN_FLT c48 = prepared[73];
+	const GEN_FLT c49 = prepared[74];
+	const GEN_FLT c50 = prepared[75];
+	const GEN_FLT c51 = prepared[76];
+	const GEN_FLT c52 = prepared[77];
+	const GEN_FLT c53 = prepared[78];
+	const GEN_FLT c54 = prepared[79];
+	const GEN_FLT c55 = prepared[80];
+	const GEN_FLT c56 = prepared[81];
+	const GEN_FLT c57 = prepared[82];
+	const GEN_FLT c58 = prepared[83];
+	const GEN_FLT c59 = prepared[84];
+	const GEN_FLT c60 = prepared[85];
+	const GEN_FLT c61 = prepared[86];
+	const GEN_FLT c62 = prepared[87];
+	const GEN_FLT c63 = prepared[88];
+	const GEN_FLT c64 = prepared[89];
+	const GEN_FLT c65 = prepared[90];
+	const GEN_FLT c66 = prepared[91];
+	const GEN_FLT c67 = prepared[92];
+	const GEN_FLT c68 = prepared[93];
+	const GEN_FLT c69 = prepared[94];
+	const GEN_FLT c70 = prepared[95];
+	const GEN_FLT c71 = prepared[96];
+	const GEN_FLT c72 = prepared[97];
+	const GEN_FLT c73 = prepared[98];
+	const GEN_FLT c74 = prepared[99];
+	const GEN_FLT c75 = prepared[100];
+	const GEN_FLT c76 = prepared[101];
+	const GEN_FLT sensor_x = sensor_pt[0];
+	const GEN_FLT sensor_y = sensor_pt[1];
+	const GEN_FLT sensor_z = sensor_pt[2];
+	const GEN_FLT x26 = obj_py + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLT x37 = obj_px + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLT x41 = obj_pz + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLT x42 = lh_py + (x10 * x26) + (x33 * x37) + (x40 * x41);
+	const GEN_FLT x50 = lh_px + (x26 * x49) + (x37 * x44) + (x41 * x48);
+	const GEN_FLT x51 = x50 * x50;
+	const GEN_FLT x56 = c9 + (-1 * x26 * x54) + (-1 * x37 * x55) + (-1 * x41 * x53);
+	const GEN_FLT x57 = x56 * x56;
+	const GEN_FLT x58 = x51 + x57;
+	const GEN_FLT x59 = tilt_0 * (1. / sqrt(x58));
+	const GEN_FLT x60 = atan2(x50, x56);
+	const GEN_FLT x61 = phase_0 + x60 + asin(x42 * x59);
+	const GEN_FLT x62 = -1.5707963267949 + x61 + c10;
+	const GEN_FLT x63 = atan2(x42, x56);
+	const GEN_FLT x64 = x42 * x42;
+	const GEN_FLT x65 = x57 + x64;
+	const GEN_FLT x66 = tilt_1 * (1. / sqrt(x65));
+	const GEN_FLT x67 = asin(x50 * x66);
+	const GEN_FLT x68 = 1.5707963267949 + gibPhase_1 + x63 + c11 + (-1 * x67);
+	const GEN_FLT x69 = 1. / x65;
+	const GEN_FLT x70 = x56 * x69;
+	const GEN_FLT x71 = x33 * x70;
+	const GEN_FLT x73 = -1 * x42;
+	const GEN_FLT x74 = x69 * x73;
+	const GEN_FLT x75 = x72 * x74;
+	const GEN_FLT x76 = sin(x62);
+	const GEN_FLT x77 = 1. / x58;
+	const GEN_FLT x78 = x56 * x77;
+	const GEN_FLT x79 = x44 * x78;
+	const GEN_FLT x80 = -1 * x50;
+	const GEN_FLT x81 = x77 * x80;
+	const GEN_FLT x82 = x72 * x81;
+	const GEN_FLT x83 = 1. / sqrt(1 + (-1 * x64 * x77 * c12));
+	const GEN_FLT x85 = 1.0/2.0 * x50;
+	const GEN_FLT x87 = 1.0/2.0 * x56;
+	const GEN_FLT x88 = x87 * c13;
+	const GEN_FLT x89 = tilt_0 * x42 * (1. / (x58 * sqrt(x58)));
+	const GEN_FLT x90 = x79 + x82 + (x83 * ((x33 * x59) + (x89 * ((-1 * x88) + (-1 * x85 * c14)))));
+	const GEN_FLT x91 = x10 * x70;
+	const GEN_FLT x93 = x74 * x92;
+	const GEN_FLT x94 = x49 * x78;
+	const GEN_FLT x95 = x81 * x92;
+	const GEN_FLT x100 = x87 * c15;
+	const GEN_FLT x101 = x94 + x95 + (x83 * ((x10 * x59) + (x89 * ((-1 * x100) + (-1 * x85 * c16)))));
+	const GEN_FLT x103 = x102 * x74;
+	const GEN_FLT x104 = x40 * x70;
+	const GEN_FLT x105 = x102 * x81;
+	const GEN_FLT x106 = x48 * x78;
+	const GEN_FLT x107 = x87 * c17;
+	const GEN_FLT x108 = x105 + x106 + (x83 * ((x40 * x59) + (x89 * ((-1 * x107) + (-1 * x85 * c18)))));
+	const GEN_FLT x127 = (sensor_x * c19) + (sensor_y * c20) + (sensor_z * c21);
+	const GEN_FLT x128 = x10 * x127;
+	const GEN_FLT x137 = (sensor_x * c22) + (sensor_y * c23) + (sensor_z * c24);
+	const GEN_FLT x138 = x137 * x40;
+	const GEN_FLT x142 = (sensor_x * c25) + (sensor_y * c26) + (sensor_z * c27);
+	const GEN_FLT x143 = x142 * x33;
+	const GEN_FLT x144 = x128 + x138 + x143;
+	const GEN_FLT x145 = x144 * x70;
+	const GEN_FLT x146 = x137 * x53;
+	const GEN_FLT x147 = x127 * x54;
+	const GEN_FLT x148 = x142 * x55;
+	const GEN_FLT x149 = (-1 * x146) + (-1 * x147) + (-1 * x148);
+	const GEN_FLT x150 = x149 * x74;
+	const GEN_FLT x151 = x137 * x48;
+	const GEN_FLT x152 = x127 * x49;
+	const GEN_FLT x153 = x142 * x44;
+	const GEN_FLT x154 = x151 + x152 + x153;
+	const GEN_FLT x155 = x154 * x78;
+	const GEN_FLT x156 = x149 * x81;
+	const GEN_FLT x157 = x87 * ((-2 * x146) + (-2 * x147) + (-2 * x148));
+	const GEN_FLT x158 = x155 + x156 + (x83 * ((x144 * x59) + (x89 * ((-1 * x157) + (-1 * x85 * ((2 * x151) + (2 *
+		x152) + (2 * x153)))))));
+	const GEN_FLT x168 = (sensor_x * c28) + (sensor_y * c29) + (sensor_z * c30);
+	const GEN_FLT x169 = x168 * x33;
+	const GEN_FLT x174 = (sensor_x * c31) + (sensor_y * c32) + (sensor_z * c33);
+	const GEN_FLT x175 = x174 * x40;
+	const GEN_FLT x178 = (sensor_x * c34) + (sensor_y * c35) + (sensor_z * c36);
+	const GEN_FLT x179 = x10 * x178;
+	const GEN_FLT x180 = x169 + x175 + x179;
+	const GEN_FLT x181 = x180 * x70;
+	const GEN_FLT x182 = x174 * x53;
+	const GEN_FLT x183 = x168 * x55;
+	const GEN_FLT x184 = x178 * x54;
+	const GEN_FLT x185 = (-1 * x182) + (-1 * x183) + (-1 * x184);
+	const GEN_FLT x186 = x185 * x74;
+	const GEN_FLT x187 = x168 * x44;
+	const GEN_FLT x188 = x174 * x48;
+	const GEN_FLT x189 = x178 * x49;
+	const GEN_FLT x190 = x187 + x188 + x189;
+	const GEN_FLT x191 = x190 * x78;
+	const GEN_FLT x192 = x185 * x81;
+	const GEN_FLT x193 = x87 * ((-2 * x182) + (-2 * x183) + (-2 * x184));
+	const GEN_FLT x194 = x191 + x192 + (x83 * ((x180 * x59) + (x89 * ((-1 * x193) + (-1 * x85 * ((2 * x187) + (2 *
+		x188) + (2 * x189)))))));
+	const GEN_FLT x198 = (sensor_x * c37) + (sensor_y * c38) + (sensor_z * c39);
+	const GEN_FLT x199 = x10 * x198;
+	const GEN_FLT x201 = (sensor_x * c40) + (sensor_y * c41) + (sensor_z * c42);
+	const GEN_FLT x202 = x201 * x33;
+	const GEN_FLT x204 = (sensor_x * c43) + (sensor_y * c44) + (sensor_z * c45);
+	const GEN_FLT x205 = x204 * x40;
+	const GEN_FLT x206 = x199 + x202 + x205;
+	const GEN_FLT x207 = x206 * x70;
+	const GEN_FLT x208 = x198 * x54;
+	const GEN_FLT x209 = x201 * x55;
+	const GEN_FLT x210 = x204 * x53;
+	const GEN_FLT x211 = (-1 * x208) + (-1 * x209) + (-1 * x210);
+	const GEN_FLT x212 = x211 * x74;
+	const GEN_FLT x213 = x201 * x44;
+	const GEN_FLT x214 = x198 * x49;
+	const GEN_FLT x215 = x204 * x48;
+	const GEN_FLT x216 = x213 + x214 + x215;
+	const GEN_FLT x217 = x216 * x78;
+	const GEN_FLT x218 = x211 * x81;
+	const GEN_FLT x219 = x87 * ((-2 * x208) + (-2 * x209) + (-2 * x210));
+	const GEN_FLT x220 = x217 + x218 + (x83 * ((x206 * x59) + (x89 * ((-1 * x219) + (-1 * x85 * ((2 * x213) + (2 *
+		x214) + (2 * x215)))))));
+	const GEN_FLT x221 = curve_1 * x60;
+	const GEN_FLT x222 = 1. / sqrt(1 + (-1 * x51 * x69 * c46));
+	const GEN_FLT x223 = 1.0/2.0 * x42;
+	const GEN_FLT x224 = tilt_1 * x50 * (1. / (x65 * sqrt(x65)));
+	const GEN_FLT x225 = x71 + x75 + (-1 * x222 * ((x224 * ((-1 * x88) + (-1 * x223 * c47))) + (x44 * x66)));
+	const GEN_FLT x226 = sin(x68);
+	const GEN_FLT x227 = gibMag_1 * x226;
+	const GEN_FLT x228 = x91 + x93 + (-1 * x222 * ((x224 * ((-1 * x100) + (-1 * x223 * c48))) + (x49 * x66)));
+	const GEN_FLT x229 = x103 + x104 + (-1 * x222 * ((x224 * ((-1 * x107) + (-1 * x223 * c49))) + (x48 * x66)));
+	const GEN_FLT x230 = x145 + x150 + (-1 * x222 * ((x154 * x66) + (x224 * ((-1 * x157) + (-1 * x223 * ((2 * x128) +
+		(2 * x138) + (2 * x143)))))));
+	const GEN_FLT x231 = x181 + x186 + (-1 * x222 * ((x190 * x66) + (x224 * ((-1 * x193) + (-1 * x223 * ((2 * x169) +
+		(2 * x175) + (2 * x179)))))));
+	const GEN_FLT x232 = x207 + x212 + (-1 * x222 * ((x216 * x66) + (x224 * ((-1 * x219) + (-1 * x223 * ((2 * x199) +
+		(2 * x202) + (2 * x205)))))));
+	const GEN_FLT x233 = x83 * x89;
+	const GEN_FLT x234 = x78 + (x233 * x80);
+	const GEN_FLT x235 = 2 * curve_0 * x63;
+	const GEN_FLT x236 = x59 * x83;
+	const GEN_FLT x237 = (-1 * x81) + (x233 * x56);
+	const GEN_FLT x242 = x26 * c50;
+	const GEN_FLT x251 = x41 * c51;
+	const GEN_FLT x258 = x37 * c52;
+	const GEN_FLT x259 = x242 + x251 + x258;
+	const GEN_FLT x260 = x259 * x70;
+	const GEN_FLT x262 = x41 * c53;
+	const GEN_FLT x264 = x26 * c54;
+	const GEN_FLT x271 = x37 * c55;
+	const GEN_FLT x272 = (-1 * x262) + (-1 * x264) + (-1 * x271);
+	const GEN_FLT x273 = x272 * x74;
+	const GEN_FLT x274 = x272 * x81;
+	const GEN_FLT x276 = x37 * c56;
+	const GEN_FLT x278 = x26 * c57;
+	const GEN_FLT x280 = x41 * c58;
+	const GEN_FLT x281 = x276 + x278 + x280;
+	const GEN_FLT x282 = x281 * x78;
+	const GEN_FLT x283 = x87 * ((-2 * x262) + (-2 * x264) + (-2 * x271));
+	const GEN_FLT x284 = x274 + x282 + (x83 * ((x259 * x59) + (x89 * ((-1 * x283) + (-1 * x85 * ((2 * x276) + (2 *
+		x278) + (2 * x280)))))));
+	const GEN_FLT x286 = x41 * c59;
+	const GEN_FLT x290 = x37 * c60;
+	const GEN_FLT x293 = x26 * c61;
+	const GEN_FLT x294 = (-1 * x286) + (-1 * x290) + (-1 * x293);
+	const GEN_FLT x295 = x294 * x74;
+	const GEN_FLT x297 = x26 * c62;
+	const GEN_FLT x304 = x37 * c63;
+	const GEN_FLT x305 = x41 * c64;
+	const GEN_FLT x306 = x297 + x304 + x305;
+	const GEN_FLT x307 = x306 * x70;
+	const GEN_FLT x308 = x37 * c65;
+	const GEN_FLT x310 = x41 * c66;
+	const GEN_FLT x312 = x26 * c67;
+	const GEN_FLT x313 = x308 + x310 + x312;
+	const GEN_FLT x314 = x313 * x78;
+	const GEN_FLT x315 = x294 * x81;
+	const GEN_FLT x316 = x87 * ((-2 * x286) + (-2 * x290) + (-2 * x293));
+	const GEN_FLT x317 = x314 + x315 + (x83 * ((x306 * x59) + (x89 * ((-1 * x316) + (-1 * x85 * ((2 * x308) + (2 *
+		x310) + (2 * x312)))))));
+	const GEN_FLT x318 = x26 * c68;
+	const GEN_FLT x321 = x37 * c69;
+	const GEN_FLT x323 = x41 * c70;
+	const GEN_FLT x324 = x318 + x321 + x323;
+	const GEN_FLT x325 = x324 * x70;
+	const GEN_FLT x327 = x41 * c71;
+	const GEN_FLT x329 = x37 * c72;
+	const GEN_FLT x330 = x26 * c73;
+	const GEN_FLT x331 = (-1 * x327) + (-1 * x329) + (-1 * x330);
+	const GEN_FLT x332 = x331 * x74;
+	const GEN_FLT x333 = x37 * c74;
+	const GEN_FLT x334 = x26 * c75;
+	const GEN_FLT x335 = x41 * c76;
+	const GEN_FLT x336 = x333 + x334 + x335;
+	const GEN_FLT x337 = x336 * x78;
+	const GEN_FLT x338 = x331 * x81;
+	const GEN_FLT x339 = x87 * ((-2 * x327) + (-2 * x329) + (-2 * x330));
+	const GEN_FLT x340 = x337 + x338 + (x83 * ((x324 * x59) + (x89 * ((-1 * x339) + (-1 * x85 * ((2 * x333) + (2 *
+		x334) + (2 * x335)))))));
+	const GEN_FLT x341 = x222 * x66;
+	const GEN_FLT x342 = x222 * x224;
+	const GEN_FLT x343 = x342 * x73;
+	const GEN_FLT x344 = x74 + (x342 * x56);
+	const GEN_FLT x345 = x260 + x273 + (-1 * x222 * ((x224 * ((-1 * x283) + (-1 * x223 * ((2 * x242) + (2 * x251) + (2
+		* x258))))) + (x281 * x66)));
+	const GEN_FLT x346 = x295 + x307 + (-1 * x222 * ((x224 * ((-1 * x316) + (-1 * x223 * ((2 * x297) + (2 * x304) + (2
+		* x305))))) + (x313 * x66)));
+	const GEN_FLT x347 = x325 + x332 + (-1 * x222 * ((x224 * ((-1 * x339) + (-1 * x223 * ((2 * x318) + (2 * x321) + (2
+		* x323))))) + (x336 * x66)));
+	out[0] = (-1 * x61) + (curve_0 * (x63 * x63)) + (-1 * gibMag_0 * cos(x62));
+	out[1] = x63 + c11 + (-1 * x67) + (curve_1 * (x60 * x60)) + (-1 * gibMag_1 * cos(x68));
+	out[2] = (-1 * x90) + (curve_0 * x63 * ((2 * x71) + (2 * x75))) + (gibMag_0 * x76 * x90);
+	out[3] = (-1 * x101) + (curve_0 * x63 * ((2 * x91) + (2 * x93))) + (gibMag_0 * x101 * x76);
+	out[4] = (-1 * x108) + (curve_0 * x63 * ((2 * x103) + (2 * x104))) + (gibMag_0 * x108 * x76);
+	out[5] = (-1 * x158) + (curve_0 * x63 * ((2 * x145) + (2 * x150))) + (gibMag_0 * x158 * x76);
+	out[6] = (-1 * x194) + (curve_0 * x63 * ((2 * x181) + (2 * x186))) + (gibMag_0 * x194 * x76);
+	out[7] = (-1 * x220) + (curve_0 * x63 * ((2 * x207) + (2 * x212))) + (gibMag_0 * x220 * x76);
+	out[8] = x225 + (x221 * ((2 * x79) + (2 * x82))) + (x225 * x227);
+	out[9] = x228 + (x221 * ((2 * x94) + (2 * x95))) + (x227 * x228);
+	out[10] = x229 + (x221 * ((2 * x105) + (2 * x106))) + (x227 * x229);
+	out[11] = x230 + (x221 * ((2 * x155) + (2 * x156))) + (x227 * x230);
+	out[12] = x231 + (x221 * ((2 * x191) + (2 * x192))) + (x227 * x231);
+	out[13] = x232 + (x221 * ((2 * x217) + (2 * x218))) + (x227 * x232);
+	out[14] = (-1 * x234) + (gibMag_0 * x234 * x76);
+	out[15] = (-1 * x236) + (x235 * x70) + (gibMag_0 * x236 * x76);
+	out[16] = (-1 * x237) + (-1 * x235 * x74) + (gibMag_0 * x237 * x76);
+	out[17] = (-1 * x284) + (curve_0 * x63 * ((2 * x260) + (2 * x273))) + (gibMag_0 * x284 * x76);
+	out[18] = (-1 * x317) + (curve_0 * x63 * ((2 * x295) + (2 * x307))) + (gibMag_0 * x317 * x76);
+	out[19] = (-1 * x340) + (curve_0 * x63 * ((2 * x325) + (2 * x332))) + (gibMag_0 * x340 * x76);
+	out[20] = (-1 * x341) + (-1 * x227 * x341) + (2 * curve_1 * x56 * x60 * x77);
+	out[21] = x70 + (-1 * x343) + (x227 * ((-1 * x343) + (x56 * x69)));
+	out[22] = (-1 * x344) + (-2 * x221 * x81) + (-1 * gibMag_1 * x226 * x344);
+	out[23] = x345 + (x221 * ((2 * x274) + (2 * x282))) + (x227 * x345);
+	out[24] = x346 + (x221 * ((2 * x314) + (2 * x315))) + (x227 * x346);
+	out[25] = x347 + (x221 * ((2 * x337) + (2 * x338))) + (x227 * x347);
+}
+
+enum { gen_reproject_axis_x_axis_angle_prepared_size = 29 };
+
+static inline void gen_reproject_axis_x_axis_angle_prepare(FLT *prepared, const LinmathAxisAnglePose *obj_p,
+														   const LinmathAxisAnglePose *lh_p,
+														   const BaseStationCal *bsc0) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_0 = (*bsc0).phase;
+	const GEN_FLT tilt_0 = (*bsc0).tilt;
+	const GEN_FLT curve_0 = (*bsc0).curve;
+	const GEN_FLT gibPhase_0 = (*bsc0).gibpha;
+	const GEN_FLT gibMag_0 = (*bsc0).gibmag;
+	const GEN_FLT ogeeMag_0 = (*bsc0).ogeephase;
+	const GEN_FLT ogeePhase_0 = (*bsc0).ogeemag;
+	const GEN_FLT x0 = lh_qi * lh_qi;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qk * lh_qk;
+	const GEN_FLT x3 = 1e-10 + x0 + x1 + x2;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = cos(x4);
+	const GEN_FLT x6 = 1. / x3;
+	const GEN_FLT x7 = 1 + (-1 * x5);
+	const GEN_FLT x8 = x6 * x7;
+	const GEN_FLT x9 = obj_qi * obj_qi;
+	const GEN_FLT x10 = obj_qj * obj_qj;
+	const GEN_FLT x11 = obj_qk * obj_qk;
+	const GEN_FLT x12 = 1e-10 + x10 + x11 + x9;
+	const GEN_FLT x13 = sqrt(x12);
+	const GEN_FLT x14 = cos(x13);
+	const GEN_FLT x15 = 1. / x12;
+	const GEN_FLT x16 = 1 + (-1 * x14);
+	const GEN_FLT x17 = x15 * x16;
+	const GEN_FLT x18 = (1. / x13) * sin(x13);
+	const GEN_FLT x19 = obj_qk * x18;
+	const GEN_FLT x20 = obj_qi * obj_qj * x17;
+	const GEN_FLT x21 = obj_qi * x18;
+	const GEN_FLT x23 = (1. / x4) * sin(x4);
+	const GEN_FLT x24 = lh_qk * x23;
+	const GEN_FLT x25 = lh_qi * x8;
+	const GEN_FLT x26 = lh_qj * x25;
+	const GEN_FLT x27 = obj_qj * x18;
+	const GEN_FLT x28 = obj_qk * x17;
+	const GEN_FLT x29 = obj_qi * x28;
+	const GEN_FLT x31 = lh_qi * x23;
+	const GEN_FLT x34 = lh_qj * x23;
+	const GEN_FLT x35 = lh_qk * x25;
+	const GEN_FLT c0 = x19 + x20;
+	const GEN_FLT c1 = x14 + (x10 * x17);
+	const GEN_FLT c2 = (-1 * x21) + (obj_qj * obj_qk * x15 * x16);
+	const GEN_FLT c3 = x14 + (x17 * x9);
+	const GEN_FLT c4 = x20 + (-1 * x19);
+	const GEN_FLT c5 = x27 + x29;
+	const GEN_FLT c6 = x29 + (-1 * x27);
+	const GEN_FLT c7 = x21 + (obj_qj * x28);
+	const GEN_FLT c8 = x14 + (x11 * x17);
+	const GEN_FLT c9 = x5 + (x1 * x8);
+	const GEN_FLT c10 = x24 + x26;
+	const GEN_FLT c11 = (-1 * x31) + (lh_qj * lh_qk * x6 * x7);
+	const GEN_FLT c12 = x26 + (-1 * x24);
+	const GEN_FLT c13 = x5 + (x0 * x8);
+	const GEN_FLT c14 = x34 + x35;
+	const GEN_FLT c15 = -1 * lh_pz;
+	const GEN_FLT c16 = x31 + (lh_qj * lh_qk * x8);
+	const GEN_FLT c17 = x35 + (-1 * x34);
+	const GEN_FLT c18 = x5 + (x2 * x8);
+	prepared[0] = obj_px;
+	prepared[1] = obj_py;
+	prepared[2] = obj_pz;
+	prepared[3] = lh_px;
+	prepared[4] = lh_py;
+	prepared[5] = phase_0;
+	prepared[6] = tilt_0;
+	prepared[7] = curve_0;
+	prepared[8] = gibPhase_0;
+	prepared[9] = gibMag_0;
+	prepared[10] = c0;
+	prepared[11] = c1;
+	prepared[12] = c2;
+	prepared[13] = c3;
+	prepared[14] = c4;
+	prepared[15] = c5;
+	prepared[16] = c6;
+	prepared[17] = c7;
+	prepared[18] = c8;
+	prepared[19] = c9;
+	prepared[20] = c10;
+	prepared[21] = c11;
+	prepared[22] = c12;
+	prepared[23] = c13;
+	prepared[24] = c14;
+	prepared[25] = c15;
+	prepared[26] = c16;
+	prepared[27] = c17;
+	prepared[28] = c18;
+}
+
+static inline void gen_reproject_axis_x_axis_angle_eval(FLT *out, const FLT *prepared, const FLT *sensor_pt) {
+	const GEN_FLT obj_px = prepared[0];
+	const GEN_FLT obj_py = prepared[1];
+	const GEN_FLT obj_pz = prepared[2];
+	const GEN_FLT lh_px = prepared[3];
+	const GEN_FLT lh_py = prepared[4];
+	const GEN_FLT phase_0 = prepared[5];
+	const GEN_FLT tilt_0 = prepared[6];
+	const GEN_FLT curve_0 = prepared[7];
+	const GEN_FLT gibPhase_0 = prepared[8];
+	const GEN_FLT gibMag_0 = prepared[9];
+	const GEN_FLT c0 = prepared[10];
+	const GEN_FLT c1 = prepared[11];
+	const GEN_FLT c2 = prepared[12];
+	const GEN_FLT c3 = prepared[13];
+	const GEN_FLT c4 = prepared[14];
+	const GEN_FLT c5 = prepared[15];
+	const GEN_FLT c6 = prepared[16];
+	const GEN_FLT c7 = prepared[17];
+	const GEN_FLT c8 = prepared[18];
+	const GEN_FLT c9 = prepared[19];
+	const GEN_FLT c10 = prepared[20];
+	const GEN_FLT c11 = prepared[21];
+	const GEN_FLT c12 = prepared[22];
+	const GEN_FLT c13 = prepared[23];
+	const GEN_FLT c14 = prepared[24];
+	const GEN_FLT c15 = prepared[25];
+	const GEN_FLT c16 = prepared[26];
+	const GEN_FLT c17 = prepared[27];
+	const GEN_FLT c18 = prepared[28];
+	const GEN_FLT sensor_x = sensor_pt[0];
+	const GEN_FLT sensor_y = sensor_pt[1];
+	const GEN_FLT sensor_z = sensor_pt[2];
+	const GEN_FLT x22 = obj_py + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLT x30 = obj_px + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLT x32 = obj_pz + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLT x33 = lh_py + (x22 * c9) + (x30 * c10) + (x32 * c11);
+	const GEN_FLT x36 = lh_px + (x22 * c12) + (x30 * c13) + (x32 * c14);
+	const GEN_FLT x37 = c15 + (-1 * x22 * c16) + (-1 * x30 * c17) + (-1 * x32 * c18);
+	const GEN_FLT x38 = phase_0 + asin(tilt_0 * x33 * (1. / sqrt((x36 * x36) + (x37 * x37)))) + atan2(x36, x37);
+	out[0] = (-1 * x38) + (curve_0 * (atan2(x33, x37) * atan2(x33, x37))) + (-1 * gibMag_0 * cos(1.5707963267949 +
+		gibPhase_0 + (-1 * x38)));
+}
+
+// Value of reproject_axis_x then its jacobian wrt obj_p
+enum { gen_reproject_axis_x_val_jac_obj_p_axis_angle_prepared_size = 66 };
+
+static inline void gen_reproject_axis_x_val_jac_obj_p_axis_angle_prepare(FLT *prepared,
+																		 const LinmathAxisAnglePose *obj_p,
+																		 const LinmathAxisAnglePose *lh_p,
+																		 const BaseStationCal *bsc0) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_0 = (*bsc0).phase;
+	const GEN_FLT tilt_0 = (*bsc0).tilt;
+	const GEN_FLT curve_0 = (*bsc0).curve;
+	const GEN_FLT gibPhase_0 = (*bsc0).gibpha;
+	const GEN_FLT gibMag_0 = (*bsc0).gibmag;
+	const GEN_FLT ogeeMag_0 = (*bsc0).ogeephase;
+	const GEN_FLT ogeePhase_0 = (*bsc0).ogeemag;
+	const GEN_FLT x0 = lh_qi * lh_qi;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qk * lh_qk;
+	const GEN_FLT x3 = 1e-10 + x0 + x1 + x2;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = cos(x4);
+	const GEN_FLT x6 = (1. / x3) * (1 + (-1 * x5));
+	const GEN_FLT x7 = x5 + (x1 * x6);
+	const GEN_FLT x8 = obj_qi * obj_qi;
+	const GEN_FLT x9 = obj_qj * obj_qj;
+	const GEN_FLT x10 = obj_qk * obj_qk;
+	const GEN_FLT x11 = 1e-10 + x10 + x8 + x9;
+	const GEN_FLT x12 = sqrt(x11);
+	const GEN_FLT x13 = cos(x12);
+	const GEN_FLT x14 = 1. / x11;
+	const GEN_FLT x15 = 1 + (-1 * x13);
+	const GEN_FLT x16 = x14 * x15;
+	const GEN_FLT x17 = sin(x12);
+	const GEN_FLT x18 = x17 * (1. / x12);
+	const GEN_FLT x19 = obj_qk * x18;
+	const GEN_FLT x20 = obj_qj * x16;
+	const GEN_FLT x21 = obj_qi * x20;
+	const GEN_FLT x22 = obj_qi * x18;
+	const GEN_FLT x24 = 1. / x4;
+	const GEN_FLT x25 = sin(x4);
+	const GEN_FLT x26 = x24 * x25;
+	const GEN_FLT x27 = lh_qk * x26;
+	const GEN_FLT x28 = lh_qi * x6;
+	const GEN_FLT x29 = lh_qj * x28;
+	const GEN_FLT x30 = x27 + x29;
+	const GEN_FLT x31 = obj_qj * x18;
+	const GEN_FLT x32 = obj_qk * x16;
+	const GEN_FLT x33 = obj_qi * x32;
+	const GEN_FLT x35 = lh_qi * x26;
+	const GEN_FLT x36 = lh_qj * lh_qk * x6;
+	const GEN_FLT x37 = x36 + (-1 * x35);
+	const GEN_FLT x40 = x0 * x6;
+	const GEN_FLT x41 = x40 + x5;
+	const GEN_FLT x42 = lh_qj * x26;
+	const GEN_FLT x43 = lh_qk * x28;
+	const GEN_FLT x44 = x42 + x43;
+	const GEN_FLT x45 = x29 + (-1 * x27);
+	const GEN_FLT x47 = x2 * x6;
+	const GEN_FLT x48 = x47 + x5;
+	const GEN_FLT x49 = x35 + x36;
+	const GEN_FLT x50 = x43 + (-1 * x42);
+	const GEN_FLT x61 = -1 * x50;
+	const GEN_FLT x68 = 2 * x5;
+	const GEN_FLT x70 = 2 * x43;
+	const GEN_FLT x74 = -1 * x49;
+	const GEN_FLT x76 = -1 * x48;
+	const GEN_FLT x78 = 1. / (x11 * sqrt(x11));
+	const GEN_FLT x79 = 2 * x15 * (1. / (x11 * x11));
+	const GEN_FLT x80 = obj_qi * x79;
+	const GEN_FLT x81 = x80 * x9;
+	const GEN_FLT x82 = x13 * x14;
+	const GEN_FLT x83 = x17 * x78;
+	const GEN_FLT x84 = x8 * x83;
+	const GEN_FLT x85 = x18 + (-1 * x84) + (x8 * x82);
+	const GEN_FLT x86 = obj_qi * obj_qk;
+	const GEN_FLT x87 = obj_qj * x79;
+	const GEN_FLT x88 = x86 * x87;
+	const GEN_FLT x89 = x88 + (-1 * obj_qi * obj_qj * obj_qk * x17 * x78);
+	const GEN_FLT x90 = x79 * x8;
+	const GEN_FLT x91 = obj_qj * x90;
+	const GEN_FLT x92 = x20 + (-1 * x91) + (obj_qj * x84);
+	const GEN_FLT x93 = x82 * x86;
+	const GEN_FLT x94 = x83 * x86;
+	const GEN_FLT x95 = x93 + (-1 * x94);
+	const GEN_FLT x97 = x10 * x80;
+	const GEN_FLT x98 = (-1 * x88) + (obj_qj * x94);
+	const GEN_FLT x99 = obj_qk * x90;
+	const GEN_FLT x100 = x32 + (-1 * x99) + (obj_qk * x84);
+	const GEN_FLT x101 = obj_qi * obj_qj;
+	const GEN_FLT x102 = x101 * x83;
+	const GEN_FLT x103 = x101 * x82;
+	const GEN_FLT x104 = x102 + (-1 * x103);
+	const GEN_FLT x106 = obj_qi * obj_qi * obj_qi;
+	const GEN_FLT x107 = x94 + (-1 * x93);
+	const GEN_FLT x108 = x103 + (-1 * x102);
+	const GEN_FLT x119 = x18 + x98;
+	const GEN_FLT x120 = x83 * x9;
+	const GEN_FLT x121 = (-1 * x120) + (x82 * x9);
+	const GEN_FLT x122 = obj_qi * x16;
+	const GEN_FLT x123 = x122 + (-1 * x81) + (obj_qi * x120);
+	const GEN_FLT x124 = obj_qj * obj_qk;
+	const GEN_FLT x125 = x124 * x83;
+	const GEN_FLT x126 = x124 * x82;
+	const GEN_FLT x127 = x125 + (-1 * x126);
+	const GEN_FLT x129 = x10 * x87;
+	const GEN_FLT x130 = x18 + x89;
+	const GEN_FLT x131 = obj_qk * x79 * x9;
+	const GEN_FLT x132 = x32 + (-1 * x131) + (obj_qk * x120);
+	const GEN_FLT x134 = obj_qj * obj_qj * obj_qj;
+	const GEN_FLT x135 = x126 + (-1 * x125);
+	const GEN_FLT x146 = x10 * x83;
+	const GEN_FLT x147 = (-1 * x146) + (x10 * x82);
+	const GEN_FLT x148 = x20 + (-1 * x129) + (obj_qj * x146);
+	const GEN_FLT x150 = x122 + (-1 * x97) + (obj_qi * x146);
+	const GEN_FLT x152 = obj_qk * obj_qk * obj_qk;
+	const GEN_FLT c0 = x19 + x21;
+	const GEN_FLT c1 = x13 + (x16 * x9);
+	const GEN_FLT c2 = (-1 * x22) + (obj_qj * obj_qk * x14 * x15);
+	const GEN_FLT c3 = x13 + (x16 * x8);
+	const GEN_FLT c4 = x21 + (-1 * x19);
+	const GEN_FLT c5 = x31 + x33;
+	const GEN_FLT c6 = x33 + (-1 * x31);
+	const GEN_FLT c7 = x22 + (obj_qk * x20);
+	const GEN_FLT c8 = x13 + (x10 * x16);
+	const GEN_FLT c9 = -1 * lh_pz;
+	const GEN_FLT c10 = -1 * gibPhase_0;
+	const GEN_FLT c11 = tilt_0 * tilt_0;
+	const GEN_FLT c12 = x68 + (2 * x40);
+	const GEN_FLT c13 = (-1 * x70) + (2 * lh_qj * x24 * x25);
+	const GEN_FLT c14 = (-2 * x27) + (2 * x29);
+	const GEN_FLT c15 = (-2 * x35) + (-2 * x36);
+	const GEN_FLT c16 = x70 + (2 * x42);
+	const GEN_FLT c17 = (-1 * x68) + (-2 * x47);
+	const GEN_FLT c18 = x92 + x95;
+	const GEN_FLT c19 = (-1 * x22) + (-1 * x81) + (obj_qi * x17 * x78 * x9);
+	const GEN_FLT c20 = (-1 * x85) + (-1 * x89);
+	const GEN_FLT c21 = x100 + x104;
+	const GEN_FLT c22 = x85 + x98;
+	const GEN_FLT c23 = (-1 * x22) + (-1 * x97) + (obj_qi * x10 * x17 * x78);
+	const GEN_FLT c24 = (-1 * x22) + (-1 * x106 * x79) + (x106 * x17 * x78) + (2 * obj_qi * x14 * x15);
+	const GEN_FLT c25 = x107 + x92;
+	const GEN_FLT c26 = x100 + x108;
+	const GEN_FLT c27 = (-1 * x31) + (-1 * x91) + (obj_qj * x17 * x78 * x8);
+	const GEN_FLT c28 = x123 + x127;
+	const GEN_FLT c29 = x119 + x121;
+	const GEN_FLT c30 = (-1 * x121) + (-1 * x130);
+	const GEN_FLT c31 = x108 + x132;
+	const GEN_FLT c32 = (-1 * x129) + (-1 * x31) + (obj_qj * x10 * x17 * x78);
+	const GEN_FLT c33 = x123 + x135;
+	const GEN_FLT c34 = (-1 * x31) + (-1 * x134 * x79) + (x134 * x17 * x78) + (2 * obj_qj * x14 * x15);
+	const GEN_FLT c35 = x104 + x132;
+	const GEN_FLT c36 = x119 + x147;
+	const GEN_FLT c37 = (-1 * x131) + (-1 * x19) + (obj_qk * x17 * x78 * x9);
+	const GEN_FLT c38 = x107 + x148;
+	const GEN_FLT c39 = (-1 * x19) + (-1 * x99) + (obj_qk * x17 * x78 * x8);
+	const GEN_FLT c40 = (-1 * x130) + (-1 * x147);
+	const GEN_FLT c41 = x135 + x150;
+	const GEN_FLT c42 = x127 + x150;
+	const GEN_FLT c43 = x148 + x95;
+	const GEN_FLT c44 = (-1 * x19) + (-1 * x152 * x79) + (x152 * x17 * x78) + (2 * obj_qk * x14 * x15);
+	prepared[0] = obj_px;
+	prepared[1] = obj_py;
+	prepared[2] = obj_pz;
+	prepared[3] = lh_px;
+	prepared[4] = lh_py;
+	prepared[5] = phase_0;
+	prepared[6] = tilt_0;
+	prepared[7] = curve_0;
+	prepared[8] = gibMag_0;
+	prepared[9] = x7;
+	prepared[10] = x30;
+	prepared[11] = x37;
+	prepared[12] = x41;
+	prepared[13] = x44;
+	prepared[14] = x45;
+	prepared[15] = x48;
+	prepared[16] = x49;
+	prepared[17] = x50;
+	prepared[18] = x61;
+	prepared[19] = x74;
+	prepared[20] = x76;
+	prepared[21] = c0;
+	prepared[22] = c1;
+	prepared[23] = c2;
+	prepared[24] = c3;
+	prepared[25] = c4;
+	prepared[26] = c5;
+	prepared[27] = c6;
+	prepared[28] = c7;
+	prepared[29] = c8;
+	prepared[30] = c9;
+	prepared[31] = c10;
+	prepared[32] = c11;
+	prepared[33] = c12;
+	prepared[34] = c13;
+	prepared[35] = c14;
+	prepared[36] = c15;
+	prepared[37] = c16;
+	prepared[38] = c17;
+	prepared[39] = c18;
+	prepared[40] = c19;
+	prepared[41] = c20;
+	prepared[42] = c21;
+	prepared[43] = c22;
+	prepared[44] = c23;
+	prepared[45] = c24;
+	prepared[46] = c25;
+	prepared[47] = c26;
+	prepared[48] = c27;
+	prepared[49] = c28;
+	prepared[50] = c29;
+	prepared[51] = c30;
+	prepared[52] = c31;
+	prepared[53] = c32;
+	prepared[54] = c33;
+	prepared[55] = c34;
+	prepared[56] = c35;
+	prepared[57] = c36;
+	prepared[58] = c37;
+	prepared[59] = c38;
+	prepared[60] = c39;
+	prepared[61] = c40;
+	prepared[62] = c41;
+	prepared[63] = c42;
+	prepared[64] = c43;
+	prepared[65] = c44;
+}
+
+static inline void gen_reproject_axis_x_val_jac_obj_p_axis_angle_eval(FLT *out, const FLT *prepared,
+																	  const FLT *sensor_pt) {
+	const GEN_FLT obj_px = prepared[0];
+	const GEN_FLT obj_py = prepared[1];
+	const GEN_FLT obj_pz = prepared[2];
+	const GEN_FLT lh_px = prepared[3];
+	const GEN_FLT lh_py = prepared[4];
+	const GEN_FLT phase_0 = prepared[5];
+	const GEN_FLT tilt_0 = prepared[6];
+	const GEN_FLT curve_0 = prepared[7];
+	const GEN_FLT gibMag_0 = prepared[8];
+	const GEN_FLT x7 = prepared[9];
+	const GEN_FLT x30 = prepared[10];
+	const GEN_FLT x37 = prepared[11];
+	const GEN_FLT x41 = prepared[12];
+	const GEN_FLT x44 = prepared[13];
+	const GEN_FLT x45 = prepared[14];
+	const GEN_FLT x48 = prepared[15];
+	const GEN_FLT x49 = prepared[16];
+	const GEN_FLT x50 = prepared[17];
+	const GEN_FLT x61 = prepared[18];
+	const GEN_FLT x74 = prepared[19];
+	const GEN_FLT x76 = prepared[20];
+	const GEN_FLT c0 = prepared[21];
+	const GEN_FLT c1 = prepared[22];
+	const GEN_FLT c2 = prepared[23];
+	const GEN_FLT c3 = prepared[24];
+	const GEN_FLT c4 = prepared[25];
+	const GEN_FLT c5 = prepared[26];
+	const GEN_FLT c6 = prepared[27];
+	const GEN_FLT c7 = prepared[28];
+	const GEN_FLT c8 = prepared[29];
+	const GEN_FLT c9 = prepared[30];
+	const GEN_FLT c10 = prepared[31];
+	const GEN_FLT c11 = prepared[32];
+	const GEN_FLT c12 = prepared[33];
+	const GEN_FLT c13 = prepared[34];
+	const GEN_FLT c14 = prepared[35];
+	const GEN_FLT c15 = prepared[36];
+	const GEN_FLT c16 = prepared[37];
+	const GEN_FLT c17 = prepared[38];
+	const GEN_FLT c18 = prepared[39];
+	const GEN_FLT c19 = prepared[40];
+	const GEN_FLT c20 = prepared[41];
+	const GEN_FLT c21 = prepared[42];
+	const GEN_FLT c22 = prepared[43];
+	const GEN_FLT c23 = prepared[44];
+	const GEN_FLT c24 = prepared[45];
+	const GEN_FLT c25 = prepared[46];
+	const GEN_FLT c26 = prepared[47];
+	const GEN_FLT c27 = prepared[48];
+	const GEN_FLT c28 = prepared[49];
+	const GEN_FLT c29 = prepared[50];
+	const GEN_FLT c30 = prepared[51];
+	const GEN_FLT c31 = prepared[52];
+	const GEN_FLT c32 = prepared[53];
+	const GEN_FLT c33 = prepared[54];
+	const GEN_FLT c34 = prepared[55];
+	const GEN_FLT c35 = prepared[56];
+	const GEN_FLT c36 = prepared[57];
+	const GEN_FLT c37 = prepared[58];
+	const GEN_FLT c38 = prepared[59];
+	const GEN_FLT c39 = prepared[60];
+	const GEN_FLT c40 = prepared[61];
+	const GEN_FLT c41 = prepared[62];
+	const GEN_FLT c42 = prepared[63];
+	const GEN_FLT c43 = prepared[64];
+	const GEN_FLT c44 = prepared[65];
+	const GEN_FLT sensor_x = sensor_pt[0];
+	const GEN_FLT sensor_y = sensor_pt[1];
+	const GEN_FLT sensor_z = sensor_pt[2];
+	const GEN_FLT x23 = obj_py + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLT x34 = obj_px + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLT x38 = obj_pz + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLT x39 = lh_py + (x23 * x7) + (x30 * x34) + (x37 * x38);
+	const GEN_FLT x46 = lh_px + (x23 * x45) + (x34 * x41) + (x38 * x44);
+	const GEN_FLT x51 = c9 + (-1 * x23 * x49) + (-1 * x34 * x50) + (-1 * x38 * x48);
+	const GEN_FLT x52 = x51 * x51;
+	const GEN_FLT x53 = x52 + (x46 * x46);
+	const GEN_FLT x54 = tilt_0 * (1. / sqrt(x53));
+	const GEN_FLT x55 = phase_0 + asin(x39 * x54) + atan2(x46, x51);
+	const GEN_FLT x56 = -1.5707963267949 + x55 + c10;
+	const GEN_FLT x57 = atan2(x39, x51);
+	const GEN_FLT x58 = x39 * x39;
+	const GEN_FLT x59 = 2 * (1. / (x52 + x58));
+	const GEN_FLT x60 = x51 * x59;
+	const GEN_FLT x62 = -1 * x39 * x59;
+	const GEN_FLT x63 = sin(x56);
+	const GEN_FLT x64 = 1. / x53;
+	const GEN_FLT x65 = x51 * x64;
+	const GEN_FLT x66 = -1 * x46 * x64;
+	const GEN_FLT x67 = 1. / sqrt(1 + (-1 * x58 * x64 * c11));
+	const GEN_FLT x69 = 1.0/2.0 * x46;
+	const GEN_FLT x71 = 1.0/2.0 * x51;
+	const GEN_FLT x72 = tilt_0 * x39 * (1. / (x53 * sqrt(x53)));
+	const GEN_FLT x73 = (x41 * x65) + (x61 * x66) + (x67 * ((x30 * x54) + (x72 * ((-1 * x69 * c12) + (-1 * x71 *
+		c13)))));
+	const GEN_FLT x75 = (x45 * x65) + (x66 * x74) + (x67 * ((x54 * x7) + (x72 * ((-1 * x69 * c14) + (-1 * x71 *
+		c15)))));
+	const GEN_FLT x77 = (x44 * x65) + (x66 * x76) + (x67 * ((x37 * x54) + (x72 * ((-1 * x69 * c16) + (-1 * x71 *
+		c17)))));
+	const GEN_FLT x96 = (sensor_x * c18) + (sensor_y * c19) + (sensor_z * c20);
+	const GEN_FLT x105 = (sensor_x * c21) + (sensor_y * c22) + (sensor_z * c23);
+	const GEN_FLT x109 = (sensor_x * c24) + (sensor_y * c25) + (sensor_z * c26);
+	const GEN_FLT x110 = (x105 * x37) + (x109 * x30) + (x7 * x96);
+	const GEN_FLT x111 = x105 * x48;
+	const GEN_FLT x112 = x49 * x96;
+	const GEN_FLT x113 = x109 * x50;
+	const GEN_FLT x114 = (-1 * x111) + (-1 * x112) + (-1 * x113);
+	const GEN_FLT x115 = x105 * x44;
+	const GEN_FLT x116 = x45 * x96;
+	const GEN_FLT x117 = x109 * x41;
+	const GEN_FLT x118 = (x114 * x66) + (x65 * (x115 + x116 + x117)) + (x67 * ((x110 * x54) + (x72 * ((-1 * x69 * ((2 *
+		x115) + (2 * x116) + (2 * x117))) + (-1 * x71 * ((-2 * x111) + (-2 * x112) + (-2 * x113)))))));
+	const GEN_FLT x128 = (sensor_x * c27) + (sensor_y * c28) + (sensor_z * c29);
+	const GEN_FLT x133 = (sensor_x * c30) + (sensor_y * c31) + (sensor_z * c32);
+	const GEN_FLT x136 = (sensor_x * c33) + (sensor_y * c34) + (sensor_z * c35);
+	const GEN_FLT x137 = (x128 * x30) + (x133 * x37) + (x136 * x7);
+	const GEN_FLT x138 = x133 * x48;
+	const GEN_FLT x139 = x128 * x50;
+	const GEN_FLT x140 = x136 * x49;
+	const GEN_FLT x141 = (-1 * x138) + (-1 * x139) + (-1 * x140);
+	const GEN_FLT x142 = x128 * x41;
+	const GEN_FLT x143 = x133 * x44;
+	const GEN_FLT x144 = x136 * x45;
+	const GEN_FLT x145 = (x141 * x66) + (x65 * (x142 + x143 + x144)) + (x67 * ((x137 * x54) + (x72 * ((-1 * x69 * ((2 *
+		x142) + (2 * x143) + (2 * x144))) + (-1 * x71 * ((-2 * x138) + (-2 * x139) + (-2 * x140)))))));
+	const GEN_FLT x149 = (sensor_x * c36) + (sensor_y * c37) + (sensor_z * c38);
+	const GEN_FLT x151 = (sensor_x * c39) + (sensor_y * c40) + (sensor_z * c41);
+	const GEN_FLT x153 = (sensor_x * c42) + (sensor_y * c43) + (sensor_z * c44);
+	const GEN_FLT x154 = (x149 * x7) + (x151 * x30) + (x153 * x37);
+	const GEN_FLT x155 = x149 * x49;
+	const GEN_FLT x156 = x151 * x50;
+	const GEN_FLT x157 = x153 * x48;
+	const GEN_FLT x158 = (-1 * x155) + (-1 * x156) + (-1 * x157);
+	const GEN_FLT x159 = x151 * x41;
+	const GEN_FLT x160 = x149 * x45;
+	const GEN_FLT x161 = x153 * x44;
+	const GEN_FLT x162 = (x158 * x66) + (x65 * (x159 + x160 + x161)) + (x67 * ((x154 * x54) + (x72 * ((-1 * x69 * ((2 *
+		x159) + (2 * x160) + (2 * x161))) + (-1 * x71 * ((-2 * x155) + (-2 * x156) + (-2 * x157)))))));
+	out[0] = (-1 * x55) + (curve_0 * (x57 * x57)) + (-1 * gibMag_0 * cos(x56));
+	out[1] = (-1 * x73) + (curve_0 * x57 * ((x30 * x60) + (x61 * x62))) + (gibMag_0 * x63 * x73);
+	out[2] = (-1 * x75) + (curve_0 * x57 * ((x60 * x7) + (x62 * x74))) + (gibMag_0 * x63 * x75);
+	out[3] = (-1 * x77) + (curve_0 * x57 * ((x37 * x60) + (x62 * x76))) + (gibMag_0 * x63 * x77);
+	out[4] = (-1 * x118) + (curve_0 * x57 * ((x110 * x60) + (x114 * x62))) + (gibMag_0 * x118 * x63);
+	out[5] = (-1 * x145) + (curve_0 * x57 * ((x137 * x60) + (x141 * x62))) + (gibMag_0 * x145 * x63);
+	out[6] = (-1 * x162) + (curve_0 * x57 * ((x154 * x60) + (x158 * x62))) + (gibMag_0 * x162 * x63);
+}
+
+// Value of reproject_axis_x then its jacobian wrt obj_p, lh_p
+enum { gen_reproject_axis_x_val_jac_obj_p_lh_p_axis_angle_prepared_size = 93 };
+
+static inline void gen_reproject_axis_x_val_jac_obj_p_lh_p_axis_angle_prepare(FLT *prepared,
+																			  const LinmathAxisAnglePose *obj_p,
+																			  const LinmathAxisAnglePose *lh_p,
+																			  const BaseStationCal *bsc0) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_0 = (*bsc0).phase;
+	const GEN_FLT tilt_0 = (*bsc0).tilt;
+	const GEN_FLT curve_0 = (*bsc0).curve;
+	const GEN_FLT gibPhase_0 = (*bsc0).gibpha;
+	const GEN_FLT gibMag_0 = (*bsc0).gibmag;
+	const GEN_FLT ogeeMag_0 = (*bsc0).ogeephase;
+	const GEN_FLT ogeePhase_0 = (*bsc0).ogeemag;
+	const GEN_FLT x0 = lh_qi * lh_qi;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qk * lh_qk;
+	const GEN_FLT x3 = 1e-10 + x0 + x1 + x2;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = cos(x4);
+	const GEN_FLT x6 = 1. / x3;
+	const GEN_FLT x7 = 1 + (-1 * x5);
+	const GEN_FLT x8 = x6 * x7;
+	const GEN_FLT x9 = x5 + (x1 * x8);
+	const GEN_FLT x10 = obj_qi * obj_qi;
+	const GEN_FLT x11 = obj_qj * obj_qj;
+	const GEN_FLT x12 = obj_qk * obj_qk;
+	const GEN_FLT x13 = 1e-10 + x10 + x11 + x12;
+	const GEN_FLT x14 = sqrt(x13);
+	const GEN_FLT x15 = cos(x14);
+	const GEN_FLT x16 = 1. / x13;
+	const GEN_FLT x17 = 1 + (-1 * x15);
+	const GEN_FLT x18 = x16 * x17;
+	const GEN_FLT x19 = sin(x14);
+	const GEN_FLT x20 = x19 * (1. / x14);
+	const GEN_FLT x21 = obj_qk * x20;
+	const GEN_FLT x22 = obj_qj * x18;
+	const GEN_FLT x23 = obj_qi * x22;
+	const GEN_FLT x24 = obj_qi * x20;
+	const GEN_FLT x26 = 1. / x4;
+	const GEN_FLT x27 = sin(x4);
+	const GEN_FLT x28 = x26 * x27;
+	const GEN_FLT x29 = lh_qk * x28;
+	const GEN_FLT x30 = lh_qj * x8;
+	const GEN_FLT x31 = lh_qi * x30;
+	const GEN_FLT x32 = x29 + x31;
+	const GEN_FLT x33 = obj_qj * x20;
+	const GEN_FLT x34 = obj_qk * x18;
+	const GEN_FLT x35 = obj_qi * x34;
+	const GEN_FLT x37 = lh_qi * x28;
+	const GEN_FLT x38 = lh_qk * x30;
+	const GEN_FLT x39 = x38 + (-1 * x37);
+	const GEN_FLT x42 = x0 * x8;
+	const GEN_FLT x43 = x42 + x5;
+	const GEN_FLT x44 = lh_qj * x28;
+	const GEN_FLT x45 = lh_qk * x8;
+	const GEN_FLT x46 = lh_qi * x45;
+	const GEN_FLT x47 = x44 + x46;
+	const GEN_FLT x48 = x31 + (-1 * x29);
+	const GEN_FLT x50 = x2 * x8;
+	const GEN_FLT x51 = x5 + x50;
+	const GEN_FLT x52 = x37 + x38;
+	const GEN_FLT x53 = x46 + (-1 * x44);
+	const GEN_FLT x64 = -1 * x53;
+	const GEN_FLT x72 = 2 * x5;
+	const GEN_FLT x74 = 2 * x46;
+	const GEN_FLT x78 = -1 * x52;
+	const GEN_FLT x80 = -1 * x51;
+	const GEN_FLT x82 = 1. / (x13 * sqrt(x13));
+	const GEN_FLT x83 = 2 * x17 * (1. / (x13 * x13));
+	const GEN_FLT x84 = obj_qi * x83;
+	const GEN_FLT x85 = x11 * x84;
+	const GEN_FLT x86 = x15 * x16;
+	const GEN_FLT x87 = x19 * x82;
+	const GEN_FLT x88 = x10 * x87;
+	const GEN_FLT x89 = x20 + (-1 * x88) + (x10 * x86);
+	const GEN_FLT x90 = obj_qi * obj_qk;
+	const GEN_FLT x91 = obj_qj * x83;
+	const GEN_FLT x92 = x90 * x91;
+	const GEN_FLT x93 = x92 + (-1 * obj_qi * obj_qj * obj_qk * x19 * x82);
+	const GEN_FLT x94 = x10 * x83;
+	const GEN_FLT x95 = obj_qj * x94;
+	const GEN_FLT x96 = x22 + (-1 * x95) + (obj_qj * x88);
+	const GEN_FLT x97 = x86 * x90;
+	const GEN_FLT x98 = x87 * x90;
+	const GEN_FLT x99 = x97 + (-1 * x98);
+	const GEN_FLT x101 = x12 * x84;
+	const GEN_FLT x102 = (-1 * x92) + (obj_qj * x98);
+	const GEN_FLT x103 = obj_qk * x94;
+	const GEN_FLT x104 = x34 + (-1 * x103) + (obj_qk * x88);
+	const GEN_FLT x105 = obj_qi * obj_qj;
+	const GEN_FLT x106 = x105 * x87;
+	const GEN_FLT x107 = x105 * x86;
+	const GEN_FLT x108 = x106 + (-1 * x107);
+	const GEN_FLT x110 = obj_qi * obj_qi * obj_qi;
+	const GEN_FLT x111 = x98 + (-1 * x97);
+	const GEN_FLT x112 = x107 + (-1 * x106);
+	const GEN_FLT x123 = x102 + x20;
+	const GEN_FLT x124 = x11 * x87;
+	const GEN_FLT x125 = (-1 * x124) + (x11 * x86);
+	const GEN_FLT x126 = obj_qi * x18;
+	const GEN_FLT x127 = x126 + (-1 * x85) + (obj_qi * x124);
+	const GEN_FLT x128 = obj_qj * obj_qk;
+	const GEN_FLT x129 = x128 * x87;
+	const GEN_FLT x130 = x128 * x86;
+	const GEN_FLT x131 = x129 + (-1 * x130);
+	const GEN_FLT x133 = x12 * x91;
+	const GEN_FLT x134 = x20 + x93;
+	const GEN_FLT x135 = obj_qk * x11 * x83;
+	const GEN_FLT x136 = x34 + (-1 * x135) + (obj_qk * x124);
+	const GEN_FLT x138 = obj_qj * obj_qj * obj_qj;
+	const GEN_FLT x139 = x130 + (-1 * x129);
+	const GEN_FLT x150 = x12 * x87;
+	const GEN_FLT x151 = (-1 * x150) + (x12 * x86);
+	const GEN_FLT x152 = x22 + (-1 * x133) + (obj_qj * x150);
+	const GEN_FLT x154 = x126 + (-1 * x101) + (obj_qi * x150);
+	const GEN_FLT x156 = obj_qk * obj_qk * obj_qk;
+	const GEN_FLT x172 = 1. / (x3 * sqrt(x3));
+	const GEN_FLT x173 = 2 * x7 * (1. / (x3 * x3));
+	const GEN_FLT x174 = lh_qi * x173;
+	const GEN_FLT x175 = x1 * x174;
+	const GEN_FLT x176 = x5 * x6;
+	const GEN_FLT x177 = x172 * x27;
+	const GEN_FLT x178 = x0 * x177;
+	const GEN_FLT x179 = x28 + (-1 * x178) + (x0 * x176);
+	const GEN_FLT x180 = lh_qi * lh_qk;
+	const GEN_FLT x181 = lh_qj * x173;
+	const GEN_FLT x182 = x180 * x181;
+	const GEN_FLT x183 = x182 + (-1 * lh_qi * lh_qj * lh_qk * x172 * x27);
+	const GEN_FLT x184 = x0 * x173;
+	const GEN_FLT x185 = lh_qj * x184;
+	const GEN_FLT x186 = x30 + (-1 * x185) + (lh_qj * x178);
+	const GEN_FLT x187 = x176 * x180;
+	const GEN_FLT x188 = x177 * x180;
+	const GEN_FLT x189 = x187 + (-1 * x188);
+	const GEN_FLT x191 = x174 * x2;
+	const GEN_FLT x193 = (-1 * x182) + (lh_qj * x188);
+	const GEN_FLT x195 = lh_qk * x184;
+	const GEN_FLT x196 = x45 + (-1 * x195) + (lh_qk * x178);
+	const GEN_FLT x197 = lh_qi * lh_qj;
+	const GEN_FLT x198 = x177 * x197;
+	const GEN_FLT x199 = x176 * x197;
+	const GEN_FLT x200 = x198 + (-1 * x199);
+	const GEN_FLT x203 = lh_qi * lh_qi * lh_qi;
+	const GEN_FLT x205 = x188 + (-1 * x187);
+	const GEN_FLT x207 = x199 + (-1 * x198);
+	const GEN_FLT x210 = x181 * x2;
+	const GEN_FLT x212 = x183 + x28;
+	const GEN_FLT x213 = x1 * x177;
+	const GEN_FLT x214 = (-1 * x213) + (x1 * x176);
+	const GEN_FLT x216 = lh_qk * x1 * x173;
+	const GEN_FLT x217 = x45 + (-1 * x216) + (lh_qk * x213);
+	const GEN_FLT x220 = lh_qj * lh_qj * lh_qj;
+	const GEN_FLT x221 = lh_qi * x8;
+	const GEN_FLT x222 = x221 + (-1 * x175) + (lh_qi * x213);
+	const GEN_FLT x223 = lh_qj * lh_qk;
+	const GEN_FLT x224 = x176 * x223;
+	const GEN_FLT x225 = x177 * x223;
+	const GEN_FLT x226 = x224 + (-1 * x225);
+	const GEN_FLT x229 = x193 + x28;
+	const GEN_FLT x231 = x225 + (-1 * x224);
+	const GEN_FLT x234 = x177 * x2;
+	const GEN_FLT x235 = (-1 * x234) + (x176 * x2);
+	const GEN_FLT x236 = x30 + (-1 * x210) + (lh_qj * x234);
+	const GEN_FLT x238 = lh_qk * lh_qk * lh_qk;
+	const GEN_FLT x240 = x221 + (-1 * x191) + (lh_qi * x234);
+	const GEN_FLT c0 = x21 + x23;
+	const GEN_FLT c1 = x15 + (x11 * x18);
+	const GEN_FLT c2 = (-1 * x24) + (obj_qj * obj_qk * x16 * x17);
+	const GEN_FLT c3 = x15 + (x10 * x18);
+	const GEN_FLT c4 = x23 + (-1 * x21);
+	const GEN_FLT c5 = x33 + x35;
+	const GEN_FLT c6 = x35 + (-1 * x33);
+	const GEN_FLT c7 = x24 + (obj_qk * x22);
+	const GEN_FLT c8 = x15 + (x12 * x18);
+	const GEN_FLT c9 = -1 * lh_pz;
+	const GEN_FLT c10 = -1 * gibPhase_0;
+	const GEN_FLT c11 = tilt_0 * tilt_0;
+	const GEN_FLT c12 = x72 + (2 * x42);
+	const GEN_FLT c13 = (-1 * x74) + (2 * lh_qj * x26 * x27);
+	const GEN_FLT c14 = (-2 * x29) + (2 * x31);
+	const GEN_FLT c15 = (-2 * x37) + (-2 * x38);
+	const GEN_FLT c16 = x74 + (2 * x44);
+	const GEN_FLT c17 = (-1 * x72) + (-2 * x50);
+	const GEN_FLT c18 = x96 + x99;
+	const GEN_FLT c19 = (-1 * x24) + (-1 * x85) + (obj_qi * x11 * x19 * x82);
+	const GEN_FLT c20 = (-1 * x89) + (-1 * x93);
+	const GEN_FLT c21 = x104 + x108;
+	const GEN_FLT c22 = x102 + x89;
+	const GEN_FLT c23 = (-1 * x101) + (-1 * x24) + (obj_qi * x12 * x19 * x82);
+	const GEN_FLT c24 = (-1 * x24) + (-1 * x110 * x83) + (x110 * x19 * x82) + (2 * obj_qi * x16 * x17);
+	const GEN_FLT c25 = x111 + x96;
+	const GEN_FLT c26 = x104 + x112;
+	const GEN_FLT c27 = (-1 * x33) + (-1 * x95) + (obj_qj * x10 * x19 * x82);
+	const GEN_FLT c28 = x127 + x131;
+	const GEN_FLT c29 = x123 + x125;
+	const GEN_FLT c30 = (-1 * x125) + (-1 * x134);
+	const GEN_FLT c31 = x112 + x136;
+	const GEN_FLT c32 = (-1 * x133) + (-1 * x33) + (obj_qj * x12 * x19 * x82);
+	const GEN_FLT c33 = x127 + x139;
+	const GEN_FLT c34 = (-1 * x33) + (-1 * x138 * x83) + (x138 * x19 * x82) + (2 * obj_qj * x16 * x17);
+	const GEN_FLT c35 = x108 + x136;
+	const GEN_FLT c36 = x123 + x151;
+	const GEN_FLT c37 = (-1 * x135) + (-1 * x21) + (obj_qk * x11 * x19 * x82);
+	const GEN_FLT c38 = x111 + x152;
+	const GEN_FLT c39 = (-1 * x103) + (-1 * x21) + (obj_qk * x10 * x19 * x82);
+	const GEN_FLT c40 = (-1 * x134) + (-1 * x151);
+	const GEN_FLT c41 = x139 + x154;
+	const GEN_FLT c42 = x131 + x154;
+	const GEN_FLT c43 = x152 + x99;
+	const GEN_FLT c44 = (-1 * x21) + (-1 * x156 * x83) + (x156 * x19 * x82) + (2 * obj_qk * x16 * x17);
+	const GEN_FLT c45 = (-1 * x175) + (-1 * x37) + (lh_qi * x1 * x172 * x27);
+	const GEN_FLT c46 = x186 + x189;
+	const GEN_FLT c47 = (-1 * x179) + (-1 * x183);
+	const GEN_FLT c48 = (-1 * x191) + (-1 * x37) + (lh_qi * x172 * x2 * x27);
+	const GEN_FLT c49 = x179 + x193;
+	const GEN_FLT c50 = x196 + x200;
+	const GEN_FLT c51 = (-1 * x37) + (-1 * x173 * x203) + (x172 * x203 * x27) + (2 * lh_qi * x6 * x7);
+	const GEN_FLT c52 = x186 + x205;
+	const GEN_FLT c53 = x196 + x207;
+	const GEN_FLT c54 = (-1 * x210) + (-1 * x44) + (lh_qj * x172 * x2 * x27);
+	const GEN_FLT c55 = (-1 * x212) + (-1 * x214);
+	const GEN_FLT c56 = x207 + x217;
+	const GEN_FLT c57 = (-1 * x44) + (-1 * x173 * x220) + (x172 * x220 * x27) + (2 * lh_qj * x6 * x7);
+	const GEN_FLT c58 = x222 + x226;
+	const GEN_FLT c59 = x200 + x217;
+	const GEN_FLT c60 = (-1 * x185) + (-1 * x44) + (lh_qj * x0 * x172 * x27);
+	const GEN_FLT c61 = x214 + x229;
+	const GEN_FLT c62 = x222 + x231;
+	const GEN_FLT c63 = (-1 * x216) + (-1 * x29) + (lh_qk * x1 * x172 * x27);
+	const GEN_FLT c64 = x229 + x235;
+	const GEN_FLT c65 = x205 + x236;
+	const GEN_FLT c66 = (-1 * x29) + (-1 * x173 * x238) + (x172 * x238 * x27) + (2 * lh_qk * x6 * x7);
+	const GEN_FLT c67 = x231 + x240;
+	const GEN_FLT c68 = x189 + x236;
+	const GEN_FLT c69 = (-1 * x195) + (-1 * x29) + (lh_qk * x0 * x172 * x27);
+	const GEN_FLT c70 = (-1 * x212) + (-1 * x235);
+	const GEN_FLT c71 = x226 + x240;
+	prepared[0] = obj_px;
+	prepared[1] = obj_py;
+	prepared[2] = obj_pz;
+	prepared[3] = lh_px;
+	prepared[4] = lh_py;
+	prepared[5] = phase_0;
+	prepared[6] = tilt_0;
+	prepared[7] = curve_0;
+	prepared[8] = gibMag_0;
+	prepared[9] = x9;
+	prepared[10] = x32;
+	prepared[11] = x39;
+	prepared[12] = x43;
+	prepared[13] = x47;
+	prepared[14] = x48;
+	prepared[15] = x51;
+	prepared[16] = x52;
+	prepared[17] = x53;
+	prepared[18] = x64;
+	prepared[19] = x78;
+	prepared[20] = x80;
+	prepared[21] = c0;
+	prepared[22] = c1;
+	prepared[23] = c2;
+	prepared[24] = c3;
+	prepared[25] = c4;
+	prepared[26] = c5;
+	prepared[27] = c6;
+	prepared[28] = c7;
+	prepared[29] = c8;
+	prepared[30] = c9;
+	prepared[31] = c10;
+	prepared[32] = c11;
+	prepared[33] = c12;
+	prepared[34] = c13;
+	prepared[35] = c14;
+	prepared[36] = c15;
+	prepared[37] = c16;
+	prepared[38] = c17;
+	prepared[39] = c18;
+	prepared[40] = c19;
+	prepared[41] = c20;
+	prepared[42] = c21;
+	prepared[43] = c22;
+	prepared[44] = c23;
+	prepared[45] = c24;
+	prepared[46] = c25;
+	prepared[47] = c26;
+	prepared[48] = c27;
+	prepared[49] = c28;
+	prepared[50] = c29;
+	prepared[51] = c30;
+	prepared[52] = c31;
+	prepared[53] = c32;
+	prepared[54] = c33;
+	prepared[55] = c34;
+	prepared[56] = c35;
+	prepared[57] = c36;
+	prepared[58] = c37;
+	prepared[59] = c38;
+	prepared[60] = c39;
+	prepared[61] = c40;
+	prepared[62] = c41;
+	prepared[63] = c42;
+	prepared[64] = c43;
+	prepared[65] = c44;
+	prepared[66] = c45;
+	prepared[67] = c46;
+	prepared[68] = c47;
+	prepared[69] = c48;
+	prepared[70] = c49;
+	prepared[71] = c50;
+	prepared[72] = c51;
+	prepared[73] = c52;
+	prepared[74] = c53;
+	prepared[75] = c54;
+	prepared[76] = c55;
+	prepared[77] = c56;
+	prepared[78] = c57;
+	prepared[79] = c58;
+	prepared[80] = c59;
+	prepared[81] = c60;
+	prepared[82] = c61;
+	prepared[83] = c62;
+	prepared[84] = c63;
+	prepared[85] = c64;
+	prepared[86] = c65;
+	prepared[87] = c66;
+	prepared[88] = c67;
+	prepared[89] = c68;
+	prepared[90] = c69;
+	prepared[91] = c70;
+	prepared[92] = c71;
+}
+
+static inline void gen_reproject_axis_x_val_jac_obj_p_lh_p_axis_angle_eval(FLT *out, const FLT *prepared,
+																		   const FLT *sensor_pt) {
+	const GEN_FLT obj_px = prepared[0];
+	const GEN_FLT obj_py = prepared[1];
+	const GEN_FLT obj_pz = prepared[2];
+	const GEN_FLT lh_px = prepared[3];
+	const GEN_FLT lh_py = prepared[4];
+	const GEN_FLT phase_0 = prepared[5];
+	const GEN_FLT tilt_0 = prepared[6];
+	const GEN_FLT curve_0 = prepared[7];
+	const GEN_FLT gibMag_0 = prepared[8];
+	const GEN_FLT x9 = prepared[9];
+	const GEN_FLT x32 = prepared[10];
+	const GEN_FLT x39 = prepared[11];
+	const GEN_FLT x43 = prepared[12];
+	const GEN_FLT x47 = prepared[13];
+	const GEN_FLT x48 = prepared[14];
+	const GEN_FLT x51 = prepared[15];
+	const GEN_FLT x52 = prepared[16];
+	const GEN_FLT x53 = prepared[17];
+	const GEN_FLT x64 = prepared[18];
+	const GEN_FLT x78 = prepared[19];
+	const GEN_FLT x80 = prepared[20];
+	const GEN_FLT c0 = prepared[21];
+	const GEN_FLT c1 = prepared[22];
+	const GEN_FLT c2 = prepared[23];
+	const GEN_FLT c3 = prepared[24];
+	const GEN_FLT c4 = prepared[25];
+	const GEN_FLT c5 = prepared[26];
+	const GEN_FLT c6 = prepared[27];
+	const GEN_FLT c7 = prepared[28];
+	const GEN_FLT c8 = prepared[29];
+	const GEN_FLT c9 = prepared[30];
+	const GEN_FLT c10 = prepared[31];
+	const GEN_FLT c11 = prepared[32];
+	const GEN_FLT c12 = prepared[33];
+	const GEN_FLT c13 = prepared[34];
+	const GEN_FLT c14 = prepared[35];
+	const GEN_FLT c15 = prepared[36];
+	const GEN_FLT c16 = prepared[37];
+	const GEN_FLT c17 = prepared[38];
+	const GEN_FLT c18 = prepared[39];
+	const GEN_FLT c19 = prepared[40];
+	const GEN_FLT c20 = prepared[41];
+	const GEN_FLT c21 = prepared[42];
+	const GEN_FLT c22 = prepared[43];
+	const GEN_FLT c23 = prepared[44];
+	const GEN_FLT c24 = prepared[45];
+	const GEN_FLT c25 = prepared[46];
+	const GEN_FLT c26 = prepared[47];
+	const GEN_FLT c27 = prepared[48];
+	const GEN_FLT c28 = prepared[49];
+	const GEN_FLT c29 = prepared[50];
+	const GEN_FLT c30 = prepared[51];
+	const GEN_FLT c31 = prepared[52];
+	const GEN_FLT c32 = prepared[53];
+	const GEN_FLT c33 = prepared[54];
+	const GEN_FLT c34 = prepared[55];
+	const GEN_FLT c35 = prepared[56];
+	const GEN_FLT c36 = prepared[57];
+	const GEN_FLT c37 = prepared[58];
+	const GEN_FLT c38 = prepared[59];
+	const GEN_FLT c39 = prepared[60];
+	const GEN_FLT c40 = prepared[61];
+	const GEN_FLT c41 = prepared[62];
+	const GEN_FLT c42 = prepared[63];
+	const GEN_FLT c43 = prepared[64];
+	const GEN_FLT c44 = prepared[65];
+	const GEN_FLT c45 = prepared[66];
+	const GEN_FLT c46 = prepared[67];
+	const GEN_FLT c47 = prepared[68];
+	const GEN_FLT c48 = prepared[69];
+	const GEN_FLT c49 = prepared[70];
+	const GEN_FLT c50 = prepared[71];
+	const GEN_FLT c51 = prepared[72];
+	const GEN_FLT c52 = prepared[73];
+	const GEN_FLT c53 = prepared[74];
+	const GEN_FLT c54 = prepared[75];
+	const GEN_FLT c55 = prepared[76];
+	const GEN_FLT c56 = prepared[77];
+	const GEN_FLT c57 = prepared[78];
+	const GEN_FLT c58 = prepared[79];
+	const GEN_FLT c59 = prepared[80];
+	const GEN_FLT c60 = prepared[81];
+	const GEN_FLT c61 = prepared[82];
+	const GEN_FLT c62 = prepared[83];
+	const GEN_FLT c63 = prepared[84];
+	const GEN_FLT c64 = prepared[85];
+	const GEN_FLT c65 = prepared[86];
+	const GEN_FLT c66 = prepared[87];
+	const GEN_FLT c67 = prepared[88];
+	const GEN_FLT c68 = prepared[89];
+	const GEN_FLT c69 = prepared[90];
+	const GEN_FLT c70 = prepared[91];
+	const GEN_FLT c71 = prepared[92];
+	const GEN_FLT sensor_x = sensor_pt[0];
+	const GEN_FLT sensor_y = sensor_pt[1];
+	const GEN_FLT sensor_z = sensor_pt[2];
+	const GEN_FLT x25 = obj_py + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLT x36 = obj_px + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLT x40 = obj_pz + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLT x41 = lh_py + (x25 * x9) + (x32 * x36) + (x39 * x40);
+	const GEN_FLT x49 = lh_px + (x25 * x48) + (x36 * x43) + (x40 * x47);
+	const GEN_FLT x54 = c9 + (-1 * x25 * x52) + (-1 * x36 * x53) + (-1 * x40 * x51);
+	const GEN_FLT x55 = x54 * x54;
+	const GEN_FLT x56 = x55 + (x49 * x49);
+	const GEN_FLT x57 = tilt_0 * (1. / sqrt(x56));
+	const GEN_FLT x58 = phase_0 + asin(x41 * x57) + atan2(x49, x54);
+	const GEN_FLT x59 = -1.5707963267949 + x58 + c10;
+	const GEN_FLT x60 = atan2(x41, x54);
+	const GEN_FLT x61 = x41 * x41;
+	const GEN_FLT x62 = 2 * (1. / (x55 + x61));
+	const GEN_FLT x63 = x54 * x62;
+	const GEN_FLT x65 = -1 * x41 * x62;
+	const GEN_FLT x66 = sin(x59);
+	const GEN_FLT x67 = 1. / x56;
+	const GEN_FLT x68 = x54 * x67;
+	const GEN_FLT x69 = -1 * x49;
+	const GEN_FLT x70 = x67 * x69;
+	const GEN_FLT x71 = 1. / sqrt(1 + (-1 * x61 * x67 * c11));
+	const GEN_FLT x73 = 1.0/2.0 * x49;
+	const GEN_FLT x75 = 1.0/2.0 * x54;
+	const GEN_FLT x76 = tilt_0 * x41 * (1. / (x56 * sqrt(x56)));
+	const GEN_FLT x77 = (x43 * x68) + (x64 * x70) + (x71 * ((x32 * x57) + (x76 * ((-1 * x73 * c12) + (-1 * x75 *
+		c13)))));
+	const GEN_FLT x79 = (x48 * x68) + (x70 * x78) + (x71 * ((x57 * x9) + (x76 * ((-1 * x73 * c14) + (-1 * x75 *
+		c15)))));
+	const GEN_FLT x81 = (x47 * x68) + (x70 * x80) + (x71 * ((x39 * x57) + (x76 * ((-1 * x73 * c16) + (-1 * x75 *
+		c17)))));
+	const GEN_FLT x100 = (sensor_x * c18) + (sensor_y * c19) + (sensor_z * c20);
+	const GEN_FLT x109 = (sensor_x * c21) + (sensor_y * c22) + (sensor_z * c23);
+	const GEN_FLT x113 = (sensor_x * c24) + (sensor_y * c25) + (sensor_z * c26);
+	const GEN_FLT x114 = (x100 * x9) + (x109 * x39) + (x113 * x32);
+	const GEN_FLT x115 = x109 * x51;
+	const GEN_FLT x116 = x100 * x52;
+	const GEN_FLT x117 = x113 * x53;
+	const GEN_FLT x118 = (-1 * x115) + (-1 * x116) + (-1 * x117);
+	const GEN_FLT x119 = x109 * x47;
+	const GEN_FLT x120 = x100 * x48;
+	const GEN_FLT x121 = x113 * x43;
+	const GEN_FLT x122 = (x118 * x70) + (x68 * (x119 + x120 + x121)) + (x71 * ((x114 * x57) + (x76 * ((-1 * x73 * ((2 *
+		x119) + (2 * x120) + (2 * x121))) + (-1 * x75 * ((-2 * x115) + (-2 * x116) + (-2 * x117)))))));
+	const GEN_FLT x132 = (sensor_x * c27) + (sensor_y * c28) + (sensor_z * c29);
+	const GEN_FLT x137 = (sensor_x * c30) + (sensor_y * c31) + (sensor_z * c32);
+	const GEN_FLT x140 = (sensor_x * c33) + (sensor_y * c34) + (sensor_z * c35);
+	const GEN_FLT x141 = (x132 * x32) + (x137 * x39) + (x140 * x9);
+	const GEN_FLT x142 = x137 * x51;
+	const GEN_FLT x143 = x132 * x53;
+	const GEN_FLT x144 = x140 * x52;
+	const GEN_FLT x145 = (-1 * x142) + (-1 * x143) + (-1 * x144);
+	const GEN_FLT x146 = x132 * x43;
+	const GEN_FLT x147 = x137 * x47;
+	const GEN_FLT x148 = x140 * x48;
+	const GEN_FLT x149 = (x145 * x70) + (x68 * (x146 + x147 + x148)) + (x71 * ((x141 * x57) + (x76 * ((-1 * x73 * ((2 *
+		x146) + (2 * x147) + (2 * x148))) + (-1 * x75 * ((-2 * x142) + (-2 * x143) + (-2 * x144)))))));
+	const GEN_FLT x153 = (sensor_x * c36) + (sensor_y * c37) + (sensor_z * c38);
+	const GEN_FLT x155 = (sensor_x * c39) + (sensor_y * c40) + (sensor_z * c41);
+	const GEN_FLT x157 = (sensor_x * c42) + (sensor_y * c43) + (sensor_z * c44);
+	const GEN_FLT x158 = (x153 * x9) + (x155 * x32) + (x157 * x39);
+	const GEN_FLT x159 = x153 * x52;
+	const GEN_FLT x160 = x155 * x53;
+	const GEN_FLT x161 = x157 * x51;
+	const GEN_FLT x162 = (-1 * x159) + (-1 * x160) + (-1 * x161);
+	const GEN_FLT x163 = x155 * x43;
+	const GEN_FLT x164 = x153 * x48;
+	const GEN_FLT x165 = x157 * x47;
+	const GEN_FLT x166 = (x162 * x70) + (x68 * (x163 + x164 + x165)) + (x71 * ((x158 * x57) + (x76 * ((-1 * x73 * ((2 *
+		x163) + (2 * x164) + (2 * x165))) + (-1 * x75 * ((-2 * x159) + (-2 * x160) + (-2 * x161)))))));
+	const GEN_FLT x167 = x71 * x76;
+	const GEN_FLT x168 = x68 + (x167 * x69);
+	const GEN_FLT x169 = curve_0 * x60;
+	const GEN_FLT x170 = x57 * x71;
+	const GEN_FLT x171 = (-1 * x70) + (x167 * x54);
+	const GEN_FLT x190 = (x25 * c45) + (x36 * c46) + (x40 * c47);
+	const GEN_FLT x192 = x40 * c48;
+	const GEN_FLT x194 = x25 * c49;
+	const GEN_FLT x201 = x36 * c50;
+	const GEN_FLT x202 = (-1 * x192) + (-1 * x194) + (-1 * x201);
+	const GEN_FLT x204 = x36 * c51;
+	const GEN_FLT x206 = x25 * c52;
+	const GEN_FLT x208 = x40 * c53;
+	const GEN_FLT x209 = (x202 * x70) + (x68 * (x204 + x206 + x208)) + (x71 * ((x190 * x57) + (x76 * ((-1 * x73 * ((2 *
+		x204) + (2 * x206) + (2 * x208))) + (-1 * x75 * ((-2 * x192) + (-2 * x194) + (-2 * x201)))))));
+	const GEN_FLT x211 = x40 * c54;
+	const GEN_FLT x215 = x36 * c55;
+	const GEN_FLT x218 = x25 * c56;
+	const GEN_FLT x219 = (-1 * x211) + (-1 * x215) + (-1 * x218);
+	const GEN_FLT x227 = (x25 * c57) + (x36 * c58) + (x40 * c59);
+	const GEN_FLT x228 = x36 * c60;
+	const GEN_FLT x230 = x40 * c61;
+	const GEN_FLT x232 = x25 * c62;
+	const GEN_FLT x233 = (x219 * x70) + (x68 * (x228 + x230 + x232)) + (x71 * ((x227 * x57) + (x76 * ((-1 * x73 * ((2 *
+		x228) + (2 * x230) + (2 * x232))) + (-1 * x75 * ((-2 * x211) + (-2 * x215) + (-2 * x218)))))));
+	const GEN_FLT x237 = (x25 * c63) + (x36 * c64) + (x40 * c65);
+	const GEN_FLT x239 = x40 * c66;
+	const GEN_FLT x241 = x36 * c67;
+	const GEN_FLT x242 = x25 * c68;
+	const GEN_FLT x243 = (-1 * x239) + (-1 * x241) + (-1 * x242);
+	const GEN_FLT x244 = x36 * c69;
+	const GEN_FLT x245 = x25 * c70;
+	const GEN_FLT x246 = x40 * c71;
+	const GEN_FLT x247 = (x243 * x70) + (x68 * (x244 + x245 + x246)) + (x71 * ((x237 * x57) + (x76 * ((-1 * x73 * ((2 *
+		x244) + (2 * x245) + (2 * x246))) + (-1 * x75 * ((-2 * x239) + (-2 * x241) + (-2 * x242)))))));
+	out[0] = (-1 * x58) + (curve_0 * (x60 * x60)) + (-1 * gibMag_0 * cos(x59));
+	out[1] = (-1 * x77) + (curve_0 * x60 * ((x32 * x63) + (x64 * x65))) + (gibMag_0 * x66 * x77);
+	out[2] = (-1 * x79) + (curve_0 * x60 * ((x63 * x9) + (x65 * x78))) + (gibMag_0 * x66 * x79);
+	out[3] = (-1 * x81) + (curve_0 * x60 * ((x39 * x63) + (x65 * x80))) + (gibMag_0 * x66 * x81);
+	out[4] = (-1 * x122) + (curve_0 * x60 * ((x114 * x63) + (x118 * x65))) + (gibMag_0 * x122 * x66);
+	out[5] = (-1 * x149) + (curve_0 * x60 * ((x141 * x63) + (x145 * x65))) + (gibMag_0 * x149 * x66);
+	out[6] = (-1 * x166) + (curve_0 * x60 * ((x158 * x63) + (x162 * x65))) + (gibMag_0 * x166 * x66);
+	out[7] = (-1 * x168) + (gibMag_0 * x168 * x66);
+	out[8] = (-1 * x170) + (x169 * x63) + (gibMag_0 * x170 * x66);
+	out[9] = (-1 * x171) + (-1 * x169 * x65) + (gibMag_0 * x171 * x66);
+	out[10] = (-1 * x209) + (curve_0 * x60 * ((x190 * x63) + (x202 * x65))) + (gibMag_0 * x209 * x66);
+	out[11] = (-1 * x233) + (curve_0 * x60 * ((x219 * x65) + (x227 * x63))) + (gibMag_0 * x233 * x66);
+	out[12] = (-1 * x247) + (curve_0 * x60 * ((x237 * x63) + (x243 * x65))) + (gibMag_0 * x247 * x66);
+}
+
+enum { gen_reproject_axis_y_axis_angle_prepared_size = 29 };
+
+static inline void gen_reproject_axis_y_axis_angle_prepare(FLT *prepared, const LinmathAxisAnglePose *obj_p,
+														   const LinmathAxisAnglePose *lh_p,
+														   const BaseStationCal *bsc1) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_1 = (*bsc1).phase;
+	const GEN_FLT tilt_1 = (*bsc1).tilt;
+	const GEN_FLT curve_1 = (*bsc1).curve;
+	const GEN_FLT gibPhase_1 = (*bsc1).gibpha;
+	const GEN_FLT gibMag_1 = (*bsc1).gibmag;
+	const GEN_FLT ogeeMag_1 = (*bsc1).ogeephase;
+	const GEN_FLT ogeePhase_1 = (*bsc1).ogeemag;
+	const GEN_FLT x0 = lh_qi * lh_qi;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qk * lh_qk;
+	const GEN_FLT x3 = 1e-10 + x0 + x1 + x2;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = cos(x4);
+	const GEN_FLT x6 = 1. / x3;
+	const GEN_FLT x7 = 1 + (-1 * x5);
+	const GEN_FLT x8 = x6 * x7;
+	const GEN_FLT x9 = obj_qi * obj_qi;
+	const GEN_FLT x10 = obj_qj * obj_qj;
+	const GEN_FLT x11 = obj_qk * obj_qk;
+	const GEN_FLT x12 = 1e-10 + x10 + x11 + x9;
+	const GEN_FLT x13 = sqrt(x12);
+	const GEN_FLT x14 = cos(x13);
+	const GEN_FLT x15 = 1. / x12;
+	const GEN_FLT x16 = 1 + (-1 * x14);
+	const GEN_FLT x17 = x15 * x16;
+	const GEN_FLT x18 = (1. / x13) * sin(x13);
+	const GEN_FLT x19 = obj_qk * x18;
+	const GEN_FLT x20 = obj_qi * x17;
+	const GEN_FLT x21 = obj_qj * x20;
+	const GEN_FLT x22 = obj_qi * x18;
+	const GEN_FLT x24 = (1. / x4) * sin(x4);
+	const GEN_FLT x25 = lh_qk * x24;
+	const GEN_FLT x26 = lh_qj * x8;
+	const GEN_FLT x27 = lh_qi * x26;
+	const GEN_FLT x28 = obj_qj * x18;
+	const GEN_FLT x29 = obj_qk * x20;
+	const GEN_FLT x31 = lh_qi * x24;
+	const GEN_FLT x34 = lh_qj * x24;
+	const GEN_FLT x35 = lh_qi * lh_qk * x8;
+	const GEN_FLT c0 = x19 + x21;
+	const GEN_FLT c1 = x14 + (x10 * x17);
+	const GEN_FLT c2 = (-1 * x22) + (obj_qj * obj_qk * x15 * x16);
+	const GEN_FLT c3 = x14 + (x17 * x9);
+	const GEN_FLT c4 = x21 + (-1 * x19);
+	const GEN_FLT c5 = x28 + x29;
+	const GEN_FLT c6 = x29 + (-1 * x28);
+	const GEN_FLT c7 = x22 + (obj_qj * obj_qk * x17);
+	const GEN_FLT c8 = x14 + (x11 * x17);
+	const GEN_FLT c9 = x5 + (x1 * x8);
+	const GEN_FLT c10 = x25 + x27;
+	const GEN_FLT c11 = (-1 * x31) + (lh_qj * lh_qk * x6 * x7);
+	const GEN_FLT c12 = -1 * lh_pz;
+	const GEN_FLT c13 = x31 + (lh_qk * x26);
+	const GEN_FLT c14 = x35 + (-1 * x34);
+	const GEN_FLT c15 = x5 + (x2 * x8);
+	const GEN_FLT c16 = x27 + (-1 * x25);
+	const GEN_FLT c17 = x5 + (x0 * x8);
+	const GEN_FLT c18 = x34 + x35;
+	const GEN_FLT c19 = -1 * phase_1;
+	prepared[0] = obj_px;
+	prepared[1] = obj_py;
+	prepared[2] = obj_pz;
+	prepared[3] = lh_px;
+	prepared[4] = lh_py;
+	prepared[5] = tilt_1;
+	prepared[6] = curve_1;
+	prepared[7] = gibPhase_1;
+	prepared[8] = gibMag_1;
+	prepared[9] = c0;
+	prepared[10] = c1;
+	prepared[11] = c2;
+	prepared[12] = c3;
+	prepared[13] = c4;
+	prepared[14] = c5;
+	prepared[15] = c6;
+	prepared[16] = c7;
+	prepared[17] = c8;
+	prepared[18] = c9;
+	prepared[19] = c10;
+	prepared[20] = c11;
+	prepared[21] = c12;
+	prepared[22] = c13;
+	prepared[23] = c14;
+	prepared[24] = c15;
+	prepared[25] = c16;
+	prepared[26] = c17;
+	prepared[27] = c18;
+	prepared[28] = c19;
+}
+
+static inline void gen_reproject_axis_y_axis_angle_eval(FLT *out, const FLT *prepared, const FLT *sensor_pt) {
+	const GEN_FLT obj_px = prepared[0];
+	const GEN_FLT obj_py = prepared[1];
+	const GEN_FLT obj_pz = prepared[2];
+	const GEN_FLT lh_px = prepared[3];
+	const GEN_FLT lh_py = prepared[4];
+	const GEN_FLT tilt_1 = prepared[5];
+	const GEN_FLT curve_1 = prepared[6];
+	const GEN_FLT gibPhase_1 = prepared[7];
+	const GEN_FLT gibMag_1 = prepared[8];
+	const GEN_FLT c0 = prepared[9];
+	const GEN_FLT c1 = prepared[10];
+	const GEN_FLT c2 = prepared[11];
+	const GEN_FLT c3 = prepared[12];
+	const GEN_FLT c4 = prepared[13];
+	const GEN_FLT c5 = prepared[14];
+	const GEN_FLT c6 = prepared[15];
+	const GEN_FLT c7 = prepared[16];
+	const GEN_FLT c8 = prepared[17];
+	const GEN_FLT c9 = prepared[18];
+	const GEN_FLT c10 = prepared[19];
+	const GEN_FLT c11 = prepared[20];
+	const GEN_FLT c12 = prepared[21];
+	const GEN_FLT c13 = prepared[22];
+	const GEN_FLT c14 = prepared[23];
+	const GEN_FLT c15 = prepared[24];
+	const GEN_FLT c16 = prepared[25];
+	const GEN_FLT c17 = prepared[26];
+	const GEN_FLT c18 = prepared[27];
+	const GEN_FLT c19 = prepared[28];
+	const GEN_FLT sensor_x = sensor_pt[0];
+	const GEN_FLT sensor_y = sensor_pt[1];
+	const GEN_FLT sensor_z = sensor_pt[2];
+	const GEN_FLT x23 = obj_py + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLT x30 = obj_px + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLT x32 = obj_pz + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLT x33 = lh_py + (x23 * c9) + (x30 * c10) + (x32 * c11);
+	const GEN_FLT x36 = c12 + (-1 * x23 * c13) + (-1 * x30 * c14) + (-1 * x32 * c15);
+	const GEN_FLT x37 = atan2(x33, x36);
+	const GEN_FLT x38 = lh_px + (x23 * c16) + (x30 * c17) + (x32 * c18);
+	const GEN_FLT x39 = asin(tilt_1 * x38 * (1. / sqrt((x33 * x33) + (x36 * x36))));
+	out[0] = x37 + c19 + (-1 * x39) + (curve_1 * (atan2(x38, x36) * atan2(x38, x36))) + (-1 * gibMag_1 *
+		cos(1.5707963267949 + gibPhase_1 + x37 + c19 + (-1 * x39)));
+}
+
+// Value of reproject_axis_y then its jacobian wrt obj_p
+enum { gen_reproject_axis_y_val_jac_obj_p_axis_angle_prepared_size = 66 };
+
+static inline void gen_reproject_axis_y_val_jac_obj_p_axis_angle_prepare(FLT *prepared,
+																		 const LinmathAxisAnglePose *obj_p,
+																		 const LinmathAxisAnglePose *lh_p,
+																		 const BaseStationCal *bsc1) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_1 = (*bsc1).phase;
+	const GEN_FLT tilt_1 = (*bsc1).tilt;
+	const GEN_FLT curve_1 = (*bsc1).curve;
+	const GEN_FLT gibPhase_1 = (*bsc1).gibpha;
+	const GEN_FLT gibMag_1 = (*bsc1).gibmag;
+	const GEN_FLT ogeeMag_1 = (*bsc1).ogeephase;
+	const GEN_FLT ogeePhase_1 = (*bsc1).ogeemag;
+	const GEN_FLT x0 = lh_qi * lh_qi;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qk * lh_qk;
+	const GEN_FLT x3 = 1e-10 + x0 + x1 + x2;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = cos(x4);
+	const GEN_FLT x6 = (1. / x3) * (1 + (-1 * x5));
+	const GEN_FLT x7 = x1 * x6;
+	const GEN_FLT x8 = x5 + x7;
+	const GEN_FLT x9 = obj_qi * obj_qi;
+	const GEN_FLT x10 = obj_qj * obj_qj;
+	const GEN_FLT x11 = obj_qk * obj_qk;
+	const GEN_FLT x12 = 1e-10 + x10 + x11 + x9;
+	const GEN_FLT x13 = sqrt(x12);
+	const GEN_FLT x14 = cos(x13);
+	const GEN_FLT x15 = 1. / x12;
+	const GEN_FLT x16 = 1 + (-1 * x14);
+	const GEN_FLT x17 = x15 * x16;
+	const GEN_FLT x18 = sin(x13);
+	const GEN_FLT x19 = x18 * (1. / x13);
+	const GEN_FLT x20 = obj_qk * x19;
+	const GEN_FLT x21 = obj_qj * x17;
+	const GEN_FLT x22 = obj_qi * x21;
+	const GEN_FLT x23 = obj_qi * x19;
+	const GEN_FLT x25 = 1. / x4;
+	const GEN_FLT x26 = sin(x4);
+	const GEN_FLT x27 = x25 * x26;
+	const GEN_FLT x28 = lh_qk * x27;
+	const GEN_FLT x29 = lh_qj * x6;
+	const GEN_FLT x30 = lh_qi * x29;
+	const GEN_FLT x31 = x28 + x30;
+	const GEN_FLT x32 = obj_qj * x19;
+	const GEN_FLT x33 = obj_qk * x17;
+	const GEN_FLT x34 = obj_qi * x33;
+	const GEN_FLT x36 = lh_qi * x27;
+	const GEN_FLT x37 = lh_qk * x29;
+	const GEN_FLT x38 = x37 + (-1 * x36);
+	const GEN_FLT x41 = x2 * x6;
+	const GEN_FLT x42 = x41 + x5;
+	const GEN_FLT x43 = x36 + x37;
+	const GEN_FLT x44 = lh_qj * x27;
+	const GEN_FLT x45 = lh_qi * lh_qk * x6;
+	const GEN_FLT x46 = x45 + (-1 * x44);
+	const GEN_FLT x49 = x5 + (x0 * x6);
+	const GEN_FLT x50 = x44 + x45;
+	const GEN_FLT x51 = x30 + (-1 * x28);
+	const GEN_FLT x62 = -1 * x46;
+	const GEN_FLT x74 = -1 * x43;
+	const GEN_FLT x75 = 2 * x5;
+	const GEN_FLT x76 = 2 * x36;
+	const GEN_FLT x77 = 2 * x37;
+	const GEN_FLT x79 = -1 * x42;
+	const GEN_FLT x81 = 1. / (x12 * sqrt(x12));
+	const GEN_FLT x82 = 2 * x16 * (1. / (x12 * x12));
+	const GEN_FLT x83 = obj_qi * x82;
+	const GEN_FLT x84 = x11 * x83;
+	const GEN_FLT x85 = x14 * x15;
+	const GEN_FLT x86 = x18 * x81;
+	const GEN_FLT x87 = x86 * x9;
+	const GEN_FLT x88 = x19 + (-1 * x87) + (x85 * x9);
+	const GEN_FLT x89 = obj_qi * obj_qj;
+	const GEN_FLT x90 = x86 * x89;
+	const GEN_FLT x91 = obj_qk * x82;
+	const GEN_FLT x92 = x89 * x91;
+	const GEN_FLT x93 = (-1 * x92) + (obj_qk * x90);
+	const GEN_FLT x94 = x82 * x9;
+	const GEN_FLT x95 = obj_qk * x94;
+	const GEN_FLT x96 = x33 + (-1 * x95) + (obj_qk * x87);
+	const GEN_FLT x97 = x85 * x89;
+	const GEN_FLT x98 = x90 + (-1 * x97);
+	const GEN_FLT x100 = x10 * x83;
+	const GEN_FLT x101 = x92 + (-1 * obj_qi * obj_qj * obj_qk * x18 * x81);
+	const GEN_FLT x102 = obj_qj * x94;
+	const GEN_FLT x103 = x21 + (-1 * x102) + (obj_qj * x87);
+	const GEN_FLT x104 = obj_qi * obj_qk;
+	const GEN_FLT x105 = x104 * x85;
+	const GEN_FLT x106 = x104 * x86;
+	const GEN_FLT x107 = x105 + (-1 * x106);
+	const GEN_FLT x109 = obj_qi * obj_qi * obj_qi;
+	const GEN_FLT x110 = x106 + (-1 * x105);
+	const GEN_FLT x111 = x97 + (-1 * x90);
+	const GEN_FLT x122 = x10 * x86;
+	const GEN_FLT x123 = (-1 * x122) + (x10 * x85);
+	const GEN_FLT x124 = x19 + x93;
+	const GEN_FLT x125 = obj_qi * x17;
+	const GEN_FLT x126 = x125 + (-1 * x100) + (obj_qi * x122);
+	const GEN_FLT x127 = obj_qj * obj_qk;
+	const GEN_FLT x128 = x127 * x86;
+	const GEN_FLT x129 = x127 * x85;
+	const GEN_FLT x130 = x128 + (-1 * x129);
+	const GEN_FLT x132 = obj_qj * x11 * x82;
+	const GEN_FLT x133 = x101 + x19;
+	const GEN_FLT x134 = x10 * x91;
+	const GEN_FLT x135 = x33 + (-1 * x134) + (obj_qk * x122);
+	const GEN_FLT x137 = obj_qj * obj_qj * obj_qj;
+	const GEN_FLT x138 = x129 + (-1 * x128);
+	const GEN_FLT x149 = x11 * x86;
+	const GEN_FLT x150 = (-1 * x149) + (x11 * x85);
+	const GEN_FLT x151 = x125 + (-1 * x84) + (obj_qi * x149);
+	const GEN_FLT x153 = x21 + (-1 * x132) + (obj_qj * x149);
+	const GEN_FLT x155 = obj_qk * obj_qk * obj_qk;
+	const GEN_FLT c0 = x20 + x22;
+	const GEN_FLT c1 = x14 + (x10 * x17);
+	const GEN_FLT c2 = (-1 * x23) + (obj_qj * obj_qk * x15 * x16);
+	const GEN_FLT c3 = x14 + (x17 * x9);
+	const GEN_FLT c4 = x22 + (-1 * x20);
+	const GEN_FLT c5 = x32 + x34;
+	const GEN_FLT c6 = x34 + (-1 * x32);
+	const GEN_FLT c7 = x23 + (obj_qj * x33);
+	const GEN_FLT c8 = x14 + (x11 * x17);
+	const GEN_FLT c9 = -1 * lh_pz;
+	const GEN_FLT c10 = -1 * phase_1;
+	const GEN_FLT c11 = tilt_1 * tilt_1;
+	const GEN_FLT c12 = (2 * x28) + (2 * x30);
+	const GEN_FLT c13 = (-2 * x45) + (2 * lh_qj * x25 * x26);
+	const GEN_FLT c14 = x75 + (2 * x7);
+	const GEN_FLT c15 = (-1 * x76) + (-1 * x77);
+	const GEN_FLT c16 = x77 + (-1 * x76);
+	const GEN_FLT c17 = (-1 * x75) + (-2 * x41);
+	const GEN_FLT c18 = x96 + x98;
+	const GEN_FLT c19 = x88 + x93;
+	const GEN_FLT c20 = (-1 * x23) + (-1 * x84) + (obj_qi * x11 * x18 * x81);
+	const GEN_FLT c21 = x103 + x107;
+	const GEN_FLT c22 = (-1 * x100) + (-1 * x23) + (obj_qi * x10 * x18 * x81);
+	const GEN_FLT c23 = (-1 * x101) + (-1 * x88);
+	const GEN_FLT c24 = (-1 * x23) + (-1 * x109 * x82) + (x109 * x18 * x81) + (2 * obj_qi * x15 * x16);
+	const GEN_FLT c25 = x103 + x110;
+	const GEN_FLT c26 = x111 + x96;
+	const GEN_FLT c27 = (-1 * x102) + (-1 * x32) + (obj_qj * x18 * x81 * x9);
+	const GEN_FLT c28 = x126 + x130;
+	const GEN_FLT c29 = x123 + x124;
+	const GEN_FLT c30 = (-1 * x123) + (-1 * x133);
+	const GEN_FLT c31 = x111 + x135;
+	const GEN_FLT c32 = (-1 * x132) + (-1 * x32) + (obj_qj * x11 * x18 * x81);
+	const GEN_FLT c33 = x126 + x138;
+	const GEN_FLT c34 = (-1 * x32) + (-1 * x137 * x82) + (x137 * x18 * x81) + (2 * obj_qj * x15 * x16);
+	const GEN_FLT c35 = x135 + x98;
+	const GEN_FLT c36 = (-1 * x20) + (-1 * x95) + (obj_qk * x18 * x81 * x9);
+	const GEN_FLT c37 = (-1 * x133) + (-1 * x150);
+	const GEN_FLT c38 = x138 + x151;
+	const GEN_FLT c39 = x124 + x150;
+	const GEN_FLT c40 = (-1 * x134) + (-1 * x20) + (obj_qk * x10 * x18 * x81);
+	const GEN_FLT c41 = x110 + x153;
+	const GEN_FLT c42 = x130 + x151;
+	const GEN_FLT c43 = x107 + x153;
+	const GEN_FLT c44 = (-1 * x20) + (-1 * x155 * x82) + (x155 * x18 * x81) + (2 * obj_qk * x15 * x16);
+	prepared[0] = obj_px;
+	prepared[1] = obj_py;
+	prepared[2] = obj_pz;
+	prepared[3] = lh_px;
+	prepared[4] = lh_py;
+	prepared[5] = tilt_1;
+	prepared[6] = curve_1;
+	prepared[7] = gibPhase_1;
+	prepared[8] = gibMag_1;
+	prepared[9] = x8;
+	prepared[10] = x31;
+	prepared[11] = x38;
+	prepared[12] = x42;
+	prepared[13] = x43;
+	prepared[14] = x46;
+	prepared[15] = x49;
+	prepared[16] = x50;
+	prepared[17] = x51;
+	prepared[18] = x62;
+	prepared[19] = x74;
+	prepared[20] = x79;
+	prepared[21] = c0;
+	prepared[22] = c1;
+	prepared[23] = c2;
+	prepared[24] = c3;
+	prepared[25] = c4;
+	prepared[26] = c5;
+	prepared[27] = c6;
+	prepared[28] = c7;
+	prepared[29] = c8;
+	prepared[30] = c9;
+	prepared[31] = c10;
+	prepared[32] = c11;
+	prepared[33] = c12;
+	prepared[34] = c13;
+	prepared[35] = c14;
+	prepared[36] = c15;
+	prepared[37] = c16;
+	prepared[38] = c17;
+	prepared[39] = c18;
+	prepared[40] = c19;
+	prepared[41] = c20;
+	prepared[42] = c21;
+	prepared[43] = c22;
+	prepared[44] = c23;
+	prepared[45] = c24;
+	prepared[46] = c25;
+	prepared[47] = c26;
+	prepared[48] = c27;
+	prepared[49] = c28;
+	prepared[50] = c29;
+	prepared[51] = c30;
+	prepared[52] = c31;
+	prepared[53] = c32;
+	prepared[54] = c33;
+	prepared[55] = c34;
+	prepared[56] = c35;
+	prepared[57] = c36;
+	prepared[58] = c37;
+	prepared[59] = c38;
+	prepared[60] = c39;
+	prepared[61] = c40;
+	prepared[62] = c41;
+	prepared[63] = c42;
+	prepared[64] = c43;
+	prepared[65] = c44;
+}
+
+static inline void gen_reproject_axis_y_val_jac_obj_p_axis_angle_eval(FLT *out, const FLT *prepared,
+																	  const FLT *sensor_pt) {
+	const GEN_FLT obj_px = prepared[0];
+	const GEN_FLT obj_py = prepared[1];
+	const GEN_FLT obj_pz = prepared[2];
+	const GEN_FLT lh_px = prepared[3];
+	const GEN_FLT lh_py = prepared[4];
+	const GEN_FLT tilt_1 = prepared[5];
+	const GEN_FLT curve_1 = prepared[6];
+	const GEN_FLT gibPhase_1 = prepared[7];
+	const GEN_FLT gibMag_1 = prepared[8];
+	const GEN_FLT x8 = prepared[9];
+	const GEN_FLT x31 = prepared[10];
+	const GEN_FLT x38 = prepared[11];
+	const GEN_FLT x42 = prepared[12];
+	const GEN_FLT x43 = prepared[13];
+	const GEN_FLT x46 = prepared[14];
+	const GEN_FLT x49 = prepared[15];
+	const GEN_FLT x50 = prepared[16];
+	const GEN_FLT x51 = prepared[17];
+	const GEN_FLT x62 = prepared[18];
+	const GEN_FLT x74 = prepared[19];
+	const GEN_FLT x79 = prepared[20];
+	const GEN_FLT c0 = prepared[21];
+	const GEN_FLT c1 = prepared[22];
+	const GEN_FLT c2 = prepared[23];
+	const GEN_FLT c3 = prepared[24];
+	const GEN_FLT c4 = prepared[25];
+	const GEN_FLT c5 = prepared[26];
+	const GEN_FLT c6 = prepared[27];
+	const GEN_FLT c7 = prepared[28];
+	const GEN_FLT c8 = prepared[29];
+	const GEN_FLT c9 = prepared[30];
+	const GEN_FLT c10 = prepared[31];
+	const GEN_FLT c11 = prepared[32];
+	const GEN_FLT c12 = prepared[33];
+	const GEN_FLT c13 = prepared[34];
+	const GEN_FLT c14 = prepared[35];
+	const GEN_FLT c15 = prepared[36];
+	const GEN_FLT c16 = prepared[37];
+	const GEN_FLT c17 = prepared[38];
+	const GEN_FLT c18 = prepared[39];
+	const GEN_FLT c19 = prepared[40];
+	const GEN_FLT c20 = prepared[41];
+	const GEN_FLT c21 = prepared[42];
+	const GEN_FLT c22 = prepared[43];
+	const GEN_FLT c23 = prepared[44];
+	const GEN_FLT c24 = prepared[45];
+	const GEN_FLT c25 = prepared[46];
+	const GEN_FLT c26 = prepared[47];
+	const GEN_FLT c27 = prepared[48];
+	const GEN_FLT c28 = prepared[49];
+	const GEN_FLT c29 = prepared[50];
+	const GEN_FLT c30 = prepared[51];
+	const GEN_FLT c31 = prepared[52];
+	const GEN_FLT c32 = prepared[53];
+	const GEN_FLT c33 = prepared[54];
+	const GEN_FLT c34 = prepared[55];
+	const GEN_FLT c35 = prepared[56];
+	const GEN_FLT c36 = prepared[57];
+	const GEN_FLT c37 = prepared[58];
+	const GEN_FLT c38 = prepared[59];
+	const GEN_FLT c39 = prepared[60];
+	const GEN_FLT c40 = prepared[61];
+	const GEN_FLT c41 = prepared[62];
+	const GEN_FLT c42 = prepared[63];
+	const GEN_FLT c43 = prepared[64];
+	const GEN_FLT c44 = prepared[65];
+	const GEN_FLT sensor_x = sensor_pt[0];
+	const GEN_FLT sensor_y = sensor_pt[1];
+	const GEN_FLT sensor_z = sensor_pt[2];
+	const GEN_FLT x24 = obj_py + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLT x35 = obj_px + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLT x39 = obj_pz + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLT x40 = lh_py + (x24 * x8) + (x31 * x35) + (x38 * x39);
+	const GEN_FLT x47 = c9 + (-1 * x24 * x43) + (-1 * x35 * x46) + (-1 * x39 * x42);
+	const GEN_FLT x48 = atan2(x40, x47);
+	const GEN_FLT x52 = lh_px + (x24 * x51) + (x35 * x49) + (x39 * x50);
+	const GEN_FLT x53 = atan2(x52, x47);
+	const GEN_FLT x54 = x47 * x47;
+	const GEN_FLT x55 = x54 + (x40 * x40);
+	const GEN_FLT x56 = tilt_1 * (1. / sqrt(x55));
+	const GEN_FLT x57 = asin(x52 * x56);
+	const GEN_FLT x58 = 1.5707963267949 + gibPhase_1 + x48 + c10 + (-1 * x57);
+	const GEN_FLT x59 = x52 * x52;
+	const GEN_FLT x60 = 2 * (1. / (x54 + x59));
+	const GEN_FLT x61 = x47 * x60;
+	const GEN_FLT x63 = -1 * x52 * x60;
+	const GEN_FLT x64 = curve_1 * x53;
+	const GEN_FLT x65 = 1. / x55;
+	const GEN_FLT x66 = x47 * x65;
+	const GEN_FLT x67 = -1 * x40 * x65;
+	const GEN_FLT x68 = 1. / sqrt(1 + (-1 * x59 * x65 * c11));
+	const GEN_FLT x69 = 1.0/2.0 * x40;
+	const GEN_FLT x70 = 1.0/2.0 * x47;
+	const GEN_FLT x71 = tilt_1 * x52 * (1. / (x55 * sqrt(x55)));
+	const GEN_FLT x72 = (x31 * x66) + (x62 * x67) + (-1 * x68 * ((x49 * x56) + (x71 * ((-1 * x69 * c12) + (-1 * x70 *
+		c13)))));
+	const GEN_FLT x73 = gibMag_1 * sin(x58);
+	const GEN_FLT x78 = (x66 * x8) + (x67 * x74) + (-1 * x68 * ((x51 * x56) + (x71 * ((-1 * x69 * c14) + (-1 * x70 *
+		c15)))));
+	const GEN_FLT x80 = (x38 * x66) + (x67 * x79) + (-1 * x68 * ((x50 * x56) + (x71 * ((-1 * x69 * c16) + (-1 * x70 *
+		c17)))));
+	const GEN_FLT x99 = (sensor_x * c18) + (sensor_y * c19) + (sensor_z * c20);
+	const GEN_FLT x108 = (sensor_x * c21) + (sensor_y * c22) + (sensor_z * c23);
+	const GEN_FLT x112 = (sensor_x * c24) + (sensor_y * c25) + (sensor_z * c26);
+	const GEN_FLT x113 = (x108 * x51) + (x112 * x49) + (x50 * x99);
+	const GEN_FLT x114 = x42 * x99;
+	const GEN_FLT x115 = x108 * x43;
+	const GEN_FLT x116 = x112 * x46;
+	const GEN_FLT x117 = (-1 * x114) + (-1 * x115) + (-1 * x116);
+	const GEN_FLT x118 = x108 * x8;
+	const GEN_FLT x119 = x38 * x99;
+	const GEN_FLT x120 = x112 * x31;
+	const GEN_FLT x121 = (x117 * x67) + (x66 * (x118 + x119 + x120)) + (-1 * x68 * ((x113 * x56) + (x71 * ((-1 * x69 *
+		((2 * x118) + (2 * x119) + (2 * x120))) + (-1 * x70 * ((-2 * x114) + (-2 * x115) + (-2 * x116)))))));
+	const GEN_FLT x131 = (sensor_x * c27) + (sensor_y * c28) + (sensor_z * c29);
+	const GEN_FLT x136 = (sensor_x * c30) + (sensor_y * c31) + (sensor_z * c32);
+	const GEN_FLT x139 = (sensor_x * c33) + (sensor_y * c34) + (sensor_z * c35);
+	const GEN_FLT x140 = (x131 * x49) + (x136 * x50) + (x139 * x51);
+	const GEN_FLT x141 = x136 * x42;
+	const GEN_FLT x142 = x131 * x46;
+	const GEN_FLT x143 = x139 * x43;
+	const GEN_FLT x144 = (-1 * x141) + (-1 * x142) + (-1 * x143);
+	const GEN_FLT x145 = x131 * x31;
+	const GEN_FLT x146 = x136 * x38;
+	const GEN_FLT x147 = x139 * x8;
+	const GEN_FLT x148 = (x144 * x67) + (x66 * (x145 + x146 + x147)) + (-1 * x68 * ((x140 * x56) + (x71 * ((-1 * x69 *
+		((2 * x145) + (2 * x146) + (2 * x147))) + (-1 * x70 * ((-2 * x141) + (-2 * x142) + (-2 * x143)))))));
+	const GEN_FLT x152 = (sensor_x * c36) + (sensor_y * c37) + (sensor_z * c38);
+	const GEN_FLT x154 = (sensor_x * c39) + (sensor_y * c40) + (sensor_z * c41);
+	const GEN_FLT x156 = (sensor_x * c42) + (sensor_y * c43) + (sensor_z * c44);
+	const GEN_FLT x157 = (x152 * x49) + (x154 * x51) + (x156 * x50);
+	const GEN_FLT x158 = x154 * x43;
+	const GEN_FLT x159 = x152 * x46;
+	const GEN_FLT x160 = x156 * x42;
+	const GEN_FLT x161 = (-1 * x158) + (-1 * x159) + (-1 * x160);
+	const GEN_FLT x162 = x154 * x8;
+	const GEN_FLT x163 = x152 * x31;
+	const GEN_FLT x164 = x156 * x38;
+	const GEN_FLT x165 = (x161 * x67) + (x66 * (x162 + x163 + x164)) + (-1 * x68 * ((x157 * x56) + (x71 * ((-1 * x69 *
+		((2 * x162) + (2 * x163) + (2 * x164))) + (-1 * x70 * ((-2 * x158) + (-2 * x159) + (-2 * x160)))))));
+	out[0] = x48 + c10 + (-1 * x57) + (curve_1 * (x53 * x53)) + (-1 * gibMag_1 * cos(x58));
+	out[1] = x72 + (x64 * ((x49 * x61) + (x62 * x63))) + (x72 * x73);
+	out[2] = x78 + (x64 * ((x51 * x61) + (x63 * x74))) + (x73 * x78);
+	out[3] = x80 + (x64 * ((x50 * x61) + (x63 * x79))) + (x73 * x80);
+	out[4] = x121 + (x121 * x73) + (x64 * ((x113 * x61) + (x117 * x63)));
+	out[5] = x148 + (x148 * x73) + (x64 * ((x140 * x61) + (x144 * x63)));
+	out[6] = x165 + (x165 * x73) + (x64 * ((x157 * x61) + (x161 * x63)));
+}
+
+// Value of reproject_axis_y then its jacobian wrt obj_p, lh_p
+enum { gen_reproject_axis_y_val_jac_obj_p_lh_p_axis_angle_prepared_size = 93 };
+
+static inline void gen_reproject_axis_y_val_jac_obj_p_lh_p_axis_angle_prepare(FLT *prepared,
+																			  const LinmathAxisAnglePose *obj_p,
+																			  const LinmathAxisAnglePose *lh_p,
+																			  const BaseStationCal *bsc1) {
+	const GEN_FLT obj_px = (*obj_p).Pos[0];
+	const GEN_FLT obj_py = (*obj_p).Pos[1];
+	const GEN_FLT obj_pz = (*obj_p).Pos[2];
+	const GEN_FLT obj_qi = (*obj_p).AxisAngleRot[0];
+	const GEN_FLT obj_qj = (*obj_p).AxisAngleRot[1];
+	const GEN_FLT obj_qk = (*obj_p).AxisAngleRot[2];
+	const GEN_FLT lh_px = (*lh_p).Pos[0];
+	const GEN_FLT lh_py = (*lh_p).Pos[1];
+	const GEN_FLT lh_pz = (*lh_p).Pos[2];
+	const GEN_FLT lh_qi = (*lh_p).AxisAngleRot[0];
+	const GEN_FLT lh_qj = (*lh_p).AxisAngleRot[1];
+	const GEN_FLT lh_qk = (*lh_p).AxisAngleRot[2];
+	const GEN_FLT phase_1 = (*bsc1).phase;
+	const GEN_FLT tilt_1 = (*bsc1).tilt;
+	const GEN_FLT curve_1 = (*bsc1).curve;
+	const GEN_FLT gibPhase_1 = (*bsc1).gibpha;
+	const GEN_FLT gibMag_1 = (*bsc1).gibmag;
+	const GEN_FLT ogeeMag_1 = (*bsc1).ogeephase;
+	const GEN_FLT ogeePhase_1 = (*bsc1).ogeemag;
+	const GEN_FLT x0 = lh_qi * lh_qi;
+	const GEN_FLT x1 = lh_qj * lh_qj;
+	const GEN_FLT x2 = lh_qk * lh_qk;
+	const GEN_FLT x3 = 1e-10 + x0 + x1 + x2;
+	const GEN_FLT x4 = sqrt(x3);
+	const GEN_FLT x5 = cos(x4);
+	const GEN_FLT x6 = 1. / x3;
+	const GEN_FLT x7 = 1 + (-1 * x5);
+	const GEN_FLT x8 = x6 * x7;
+	const GEN_FLT x9 = x1 * x8;
+	const GEN_FLT x10 = x5 + x9;
+	const GEN_FLT x11 = obj_qi * obj_qi;
+	const GEN_FLT x12 = obj_qj * obj_qj;
+	const GEN_FLT x13 = obj_qk * obj_qk;
+	const GEN_FLT x14 = 1e-10 + x11 + x12 + x13;
+	const GEN_FLT x15 = sqrt(x14);
+	const GEN_FLT x16 = cos(x15);
+	const GEN_FLT x17 = 1. / x14;
+	const GEN_FLT x18 = 1 + (-1 * x16);
+	const GEN_FLT x19 = x17 * x18;
+	const GEN_FLT x20 = sin(x15);
+	const GEN_FLT x21 = x20 * (1. / x15);
+	const GEN_FLT x22 = obj_qk * x21;
+	const GEN_FLT x23 = obj_qj * x19;
+	const GEN_FLT x24 = obj_qi * x23;
+	const GEN_FLT x25 = obj_qi * x21;
+	const GEN_FLT x27 = 1. / x4;
+	const GEN_FLT x28 = sin(x4);
+	const GEN_FLT x29 = x27 * x28;
+	const GEN_FLT x30 = lh_qk * x29;
+	const GEN_FLT x31 = lh_qj * x8;
+	const GEN_FLT x32 = lh_qi * x31;
+	const GEN_FLT x33 = x30 + x32;
+	const GEN_FLT x34 = obj_qj * x21;
+	const GEN_FLT x35 = obj_qk * x19;
+	const GEN_FLT x36 = obj_qi * x35;
+	const GEN_FLT x38 = lh_qi * x29;
+	const GEN_FLT x39 = lh_qk * x31;
+	const GEN_FLT x40 = x39 + (-1 * x38);
+	const GEN_FLT x43 = x2 * x8;
+	const GEN_FLT x44 = x43 + x5;
+	const GEN_FLT x45 = x38 + x39;
+	const GEN_FLT x46 = lh_qj * x29;
+	const GEN_FLT x47 = lh_qk * x8;
+	const GEN_FLT x48 = lh_qi * x47;
+	const GEN_FLT x49 = x48 + (-1 * x46);
+	const GEN_FLT x52 = x5 + (x0 * x8);
+	const GEN_FLT x53 = x46 + x48;
+	const GEN_FLT x54 = x32 + (-1 * x30);
+	const GEN_FLT x66 = -1 * x49;
+	const GEN_FLT x80 = -1 * x45;
+	const GEN_FLT x81 = 2 * x5;
+	const GEN_FLT x82 = 2 * x38;
+	const GEN_FLT x83 = 2 * x39;
+	const GEN_FLT x85 = -1 * x44;
+	const GEN_FLT x87 = 1. / (x14 * sqrt(x14));
+	const GEN_FLT x88 = 2 * x18 * (1. / (x14 * x14));
+	const GEN_FLT x89 = obj_qi * x88;
+	const GEN_FLT x90 = x13 * x89;
+	const GEN_FLT x91 = x16 * x17;
+	const GEN_FLT x92 = x20 * x87;
+	const GEN_FLT x93 = x11 * x92;
+	const GEN_FLT x94 = x21 + (-1 * x93) + (x11 * x91);
+	const GEN_FLT x95 = obj_qi * obj_qj;
+	const GEN_FLT x96 = x92 * x95;
+	const GEN_FLT x97 = obj_qk * x88;
+	const GEN_FLT x98 = x95 * x97;
+	const GEN_FLT x99 = (-1 * x98) + (obj_qk * x96);
+	const GEN_FLT x100 = x11 * x88;
+	const GEN_FLT x101 = obj_qk * x100;
+	const GEN_FLT x102 = x35 + (-1 * x101) + (obj_qk * x93);
+	const GEN_FLT x103 = x91 * x95;
+	const GEN_FLT x104 = x96 + (-1 * x103);
+	const GEN_FLT x106 = x12 * x89;
+	const GEN_FLT x107 = x98 + (-1 * obj_qi * obj_qj * obj_qk * x20 * x87);
+	const GEN_FLT x108 = obj_qj * x100;
+	const GEN_FLT x109 = x23 + (-1 * x108) + (obj_qj * x93);
+	const GEN_FLT x110 = obj_qi * obj_qk;
+	const GEN_FLT x111 = x110 * x91;
+	const GEN_FLT x112 = x110 * x92;
+	const GEN_FLT x113 = x111 + (-1 * x112);
+	const GEN_FLT x115 = obj_qi * obj_qi * obj_qi;
+	const GEN_FLT x116 = x112 + (-1 * x111);
+	const GEN_FLT x117 = x103 + (-1 * x96);
+	const GEN_FLT x128 = x12 * x92;
+	const GEN_FLT x129 = (-1 * x128) + (x12 * x91);
+	const GEN_FLT x130 = x21 + x99;
+	const GEN_FLT x131 = obj_qi * x19;
+	const GEN_FLT x132 = x131 + (-1 * x106) + (obj_qi * x128);
+	const GEN_FLT x133 = obj_qj * obj_qk;
+	const GEN_FLT x134 = x133 * x92;
+	const GEN_FLT x135 = x133 * x91;
+	const GEN_FLT x136 = x134 + (-1 * x135);
+	const GEN_FLT x138 = obj_qj * x13 * x88;
+	const GEN_FLT x139 = x107 + x21;
+	const GEN_FLT x140 = x12 * x97;
+	const GEN_FLT x141 = x35 + (-1 * x140) + (obj_qk * x128);
+	const GEN_FLT x143 = obj_qj * obj_qj * obj_qj;
+	const GEN_FLT x144 = x135 + (-1 * x134);
+	const GEN_FLT x155 = x13 * x92;
+	const GEN_FLT x156 = (-1 * x155) + (x13 * x91);
+	const GEN_FLT x157 = x131 + (-1 * x90) + (obj_qi * x155);
+	const GEN_FLT x159 = x23 + (-1 * x138) + (obj_qj * x155);
+	const GEN_FLT x161 = obj_qk * obj_qk * obj_qk;
+	const GEN_FLT x176 = 1. / (x3 * sqrt(x3));
+	const GEN_FLT x177 = 2 * x7 * (1. / (x3 * x3));
+	const GEN_FLT x178 = lh_qi * x177;
+	const GEN_FLT x179 = x178 * x2;
+	const GEN_FLT x181 = x5 * x6;
+	const GEN_FLT x182 = x176 * x28;
+	const GEN_FLT x183 = x0 * x182;
+	const GEN_FLT x184 = x29 + (-1 * x183) + (x0 * x181);
+	const GEN_FLT x185 = lh_qi * lh_qk;
+	const GEN_FLT x186 = x182 * x185;
+	const GEN_FLT x187 = lh_qj * x177;
+	const GEN_FLT x188 = x185 * x187;
+	const GEN_FLT x189 = (-1 * x188) + (lh_qj * x186);
+	const GEN_FLT x191 = x0 * x177;
+	const GEN_FLT x192 = lh_qk * x191;
+	const GEN_FLT x193 = x47 + (-1 * x192) + (lh_qk * x183);
+	const GEN_FLT x194 = lh_qi * lh_qj;
+	const GEN_FLT x195 = x182 * x194;
+	const GEN_FLT x196 = x181 * x194;
+	const GEN_FLT x197 = x195 + (-1 * x196);
+	const GEN_FLT x200 = lh_qi * lh_qi * lh_qi;
+	const GEN_FLT x201 = lh_qj * x191;
+	const GEN_FLT x202 = x31 + (-1 * x201) + (lh_qj * x183);
+	const GEN_FLT x203 = x181 * x185;
+	const GEN_FLT x204 = x186 + (-1 * x203);
+	const GEN_FLT x205 = x196 + (-1 * x195);
+	const GEN_FLT x207 = x1 * x178;
+	const GEN_FLT x209 = x188 + (-1 * lh_qi * lh_qj * lh_qk * x176 * x28);
+	const GEN_FLT x211 = x203 + (-1 * x186);
+	const GEN_FLT x214 = x189 + x29;
+	const GEN_FLT x215 = x1 * x182;
+	const GEN_FLT x216 = (-1 * x215) + (x1 * x181);
+	const GEN_FLT x217 = lh_qi * x8;
+	const GEN_FLT x218 = x217 + (-1 * x207) + (lh_qi * x215);
+	const GEN_FLT x219 = lh_qj * lh_qk;
+	const GEN_FLT x220 = x182 * x219;
+	const GEN_FLT x221 = x181 * x219;
+	const GEN_FLT x222 = x220 + (-1 * x221);
+	const GEN_FLT x224 = x187 * x2;
+	const GEN_FLT x226 = x209 + x29;
+	const GEN_FLT x228 = lh_qk * x1 * x177;
+	const GEN_FLT x229 = x47 + (-1 * x228) + (lh_qk * x215);
+	const GEN_FLT x232 = lh_qj * lh_qj * lh_qj;
+	const GEN_FLT x234 = x221 + (-1 * x220);
+	const GEN_FLT x238 = x182 * x2;
+	const GEN_FLT x239 = (-1 * x238) + (x181 * x2);
+	const GEN_FLT x240 = x217 + (-1 * x179) + (lh_qi * x238);
+	const GEN_FLT x242 = lh_qk * lh_qk * lh_qk;
+	const GEN_FLT x245 = x31 + (-1 * x224) + (lh_qj * x238);
+	const GEN_FLT c0 = x22 + x24;
+	const GEN_FLT c1 = x16 + (x12 * x19);
+	const GEN_FLT c2 = (-1 * x25) + (obj_qj * obj_qk * x17 * x18);
+	const GEN_FLT c3 = x16 + (x11 * x19);
+	const GEN_FLT c4 = x24 + (-1 * x22);
+	const GEN_FLT c5 = x34 + x36;
+	const GEN_FLT c6 = x36 + (-1 * x34);
+	const GEN_FLT c7 = x25 + (obj_qj * x35);
+	const GEN_FLT c8 = x16 + (x13 * x19);
+	const GEN_FLT c9 = -1 * lh_pz;
+	const GEN_FLT c10 = -1 * phase_1;
+	const GEN_FLT c11 = tilt_1 * tilt_1;
+	const GEN_FLT c12 = (2 * x30) + (2 * x32);
+	const GEN_FLT c13 = (-2 * x48) + (2 * lh_qj * x27 * x28);
+	const GEN_FLT c14 = x81 + (2 * x9);
+	const GEN_FLT c15 = (-1 * x82) + (-1 * x83);
+	const GEN_FLT c16 = x83 + (-1 * x82);
+	const GEN_FLT c17 = (-1 * x81) + (-2 * x43);
+	const GEN_FLT c18 = x102 + x104;
+	const GEN_FLT c19 = x94 + x99;
+	const GEN_FLT c20 = (-1 * x25) + (-1 * x90) + (obj_qi * x13 * x20 * x87);
+	const GEN_FLT c21 = x109 + x113;
+	const GEN_FLT c22 = (-1 * x106) + (-1 * x25) + (obj_qi * x12 * x20 * x87);
+	const GEN_FLT c23 = (-1 * x107) + (-1 * x94);
+	const GEN_FLT c24 = (-1 * x25) + (-1 * x115 * x88) + (x115 * x20 * x87) + (2 * obj_qi * x17 * x18);
+	const GEN_FLT c25 = x109 + x116;
+	const GEN_FLT c26 = x102 + x117;
+	const GEN_FLT c27 = (-1 * x108) + (-1 * x34) + (obj_qj * x11 * x20 * x87);
+	const GEN_FLT c28 = x132 + x136;
+	const GEN_FLT c29 = x129 + x130;
+	const GEN_FLT c30 = (-1 * x129) + (-1 * x139);
+	const GEN_FLT c31 = x117 + x141;
+	const GEN_FLT c32 = (-1 * x138) + (-1 * x34) + (obj_qj * x13 * x20 * x87);
+	const GEN_FLT c33 = x132 + x144;
+	const GEN_FLT c34 = (-1 * x34) + (-1 * x143 * x88) + (x143 * x20 * x87) + (2 * obj_qj * x17 * x18);
+	const GEN_FLT c35 = x104 + x141;
+	const GEN_FLT c36 = (-1 * x101) + (-1 * x22) + (obj_qk * x11 * x20 * x87);
+	const GEN_FLT c37 = (-1 * x139) + (-1 * x156);
+	const GEN_FLT c38 = x144 + x157;
+	const GEN_FLT c39 = x130 + x156;
+	const GEN_FLT c40 = (-1 * x140) + (-1 * x22) + (obj_qk * x12 * x20 * x87);
+	const GEN_FLT c41 = x116 + x159;
+	const GEN_FLT c42 = x136 + x157;
+	const GEN_FLT c43 = x113 + x159;
+	const GEN_FLT c44 = (-1 * x22) + (-1 * x161 * x88) + (x161 * x20 * x87) + (2 * obj_qk * x17 * x18);
+	const GEN_FLT c45 = (-1 * x179) + (-1 * x38) + (lh_qi * x176 * x2 * x28);
+	const GEN_FLT c46 = x184 + x189;
+	const GEN_FLT c47 = x193 + x197;
+	const GEN_FLT c48 = x202 + x204;
+	const GEN_FLT c49 = (-1 * x38) + (-1 * x177 * x200) + (x176 * x200 * x28) + (2 * lh_qi * x6 * x7);
+	const GEN_FLT c50 = x193 + x205;
+	const GEN_FLT c51 = (-1 * x207) + (-1 * x38) + (lh_qi * x1 * x176 * x28);
+	const GEN_FLT c52 = (-1 * x184) + (-1 * x209);
+	const GEN_FLT c53 = x202 + x211;
+	const GEN_FLT c54 = x218 + x222;
+	const GEN_FLT c55 = (-1 * x201) + (-1 * x46) + (lh_qj * x0 * x176 * x28);
+	const GEN_FLT c56 = x214 + x216;
+	const GEN_FLT c57 = (-1 * x224) + (-1 * x46) + (lh_qj * x176 * x2 * x28);
+	const GEN_FLT c58 = (-1 * x216) + (-1 * x226);
+	const GEN_FLT c59 = x205 + x229;
+	const GEN_FLT c60 = (-1 * x46) + (-1 * x177 * x232) + (x176 * x232 * x28) + (2 * lh_qj * x6 * x7);
+	const GEN_FLT c61 = x218 + x234;
+	const GEN_FLT c62 = x197 + x229;
+	const GEN_FLT c63 = (-1 * x226) + (-1 * x239);
+	const GEN_FLT c64 = (-1 * x192) + (-1 * x30) + (lh_qk * x0 * x176 * x28);
+	const GEN_FLT c65 = x234 + x240;
+	const GEN_FLT c66 = (-1 * x30) + (-1 * x177 * x242) + (x176 * x242 * x28) + (2 * lh_qk * x6 * x7);
+	const GEN_FLT c67 = x222 + x240;
+	const GEN_FLT c68 = x211 + x245;
+	const GEN_FLT c69 = (-1 * x228) + (-1 * x30) + (lh_qk * x1 * x176 * x28);
+	const GEN_FLT c70 = x214 + x239;
+	const GEN_FLT c71 = x204 + x245;
+	prepared[0] = obj_px;
+	prepared[1] = obj_py;
+	prepared[2] = obj_pz;
+	prepared[3] = lh_px;
+	prepared[4] = lh_py;
+	prepared[5] = tilt_1;
+	prepared[6] = curve_1;
+	prepared[7] = gibPhase_1;
+	prepared[8] = gibMag_1;
+	prepared[9] = x10;
+	prepared[10] = x33;
+	prepared[11] = x40;
+	prepared[12] = x44;
+	prepared[13] = x45;
+	prepared[14] = x49;
+	prepared[15] = x52;
+	prepared[16] = x53;
+	prepared[17] = x54;
+	prepared[18] = x66;
+	prepared[19] = x80;
+	prepared[20] = x85;
+	prepared[21] = c0;
+	prepared[22] = c1;
+	prepared[23] = c2;
+	prepared[24] = c3;
+	prepared[25] = c4;
+	prepared[26] = c5;
+	prepared[27] = c6;
+	prepared[28] = c7;
+	prepared[29] = c8;
+	prepared[30] = c9;
+	prepared[31] = c10;
+	prepared[32] = c11;
+	prepared[33] = c12;
+	prepared[34] = c13;
+	prepared[35] = c14;
+	prepared[36] = c15;
+	prepared[37] = c16;
+	prepared[38] = c17;
+	prepared[39] = c18;
+	prepared[40] = c19;
+	prepared[41] = c20;
+	prepared[42] = c21;
+	prepared[43] = c22;
+	prepared[44] = c23;
+	prepared[45] = c24;
+	prepared[46] = c25;
+	prepared[47] = c26;
+	prepared[48] = c27;
+	prepared[49] = c28;
+	prepared[50] = c29;
+	prepared[51] = c30;
+	prepared[52] = c31;
+	prepared[53] = c32;
+	prepared[54] = c33;
+	prepared[55] = c34;
+	prepared[56] = c35;
+	prepared[57] = c36;
+	prepared[58] = c37;
+	prepared[59] = c38;
+	prepared[60] = c39;
+	prepared[61] = c40;
+	prepared[62] = c41;
+	prepared[63] = c42;
+	prepared[64] = c43;
+	prepared[65] = c44;
+	prepared[66] = c45;
+	prepared[67] = c46;
+	prepared[68] = c47;
+	prepared[69] = c48;
+	prepared[70] = c49;
+	prepared[71] = c50;
+	prepared[72] = c51;
+	prepared[73] = c52;
+	prepared[74] = c53;
+	prepared[75] = c54;
+	prepared[76] = c55;
+	prepared[77] = c56;
+	prepared[78] = c57;
+	prepared[79] = c58;
+	prepared[80] = c59;
+	prepared[81] = c60;
+	prepared[82] = c61;
+	prepared[83] = c62;
+	prepared[84] = c63;
+	prepared[85] = c64;
+	prepared[86] = c65;
+	prepared[87] = c66;
+	prepared[88] = c67;
+	prepared[89] = c68;
+	prepared[90] = c69;
+	prepared[91] = c70;
+	prepared[92] = c71;
+}
+
+static inline void gen_reproject_axis_y_val_jac_obj_p_lh_p_axis_angle_eval(FLT *out, const FLT *prepared,
+																		   const FLT *sensor_pt) {
+	const GEN_FLT obj_px = prepared[0];
+	const GEN_FLT obj_py = prepared[1];
+	const GEN_FLT obj_pz = prepared[2];
+	const GEN_FLT lh_px = prepared[3];
+	const GEN_FLT lh_py = prepared[4];
+	const GEN_FLT tilt_1 = prepared[5];
+	const GEN_FLT curve_1 = prepared[6];
+	const GEN_FLT gibPhase_1 = prepared[7];
+	const GEN_FLT gibMag_1 = prepared[8];
+	const GEN_FLT x10 = prepared[9];
+	const GEN_FLT x33 = prepared[10];
+	const GEN_FLT x40 = prepared[11];
+	const GEN_FLT x44 = prepared[12];
+	const GEN_FLT x45 = prepared[13];
+	const GEN_FLT x49 = prepared[14];
+	const GEN_FLT x52 = prepared[15];
+	const GEN_FLT x53 = prepared[16];
+	const GEN_FLT x54 = prepared[17];
+	const GEN_FLT x66 = prepared[18];
+	const GEN_FLT x80 = prepared[19];
+	const GEN_FLT x85 = prepared[20];
+	const GEN_FLT c0 = prepared[21];
+	const GEN_FLT c1 = prepared[22];
+	const GEN_FLT c2 = prepared[23];
+	const GEN_FLT c3 = prepared[24];
+	const GEN_FLT c4 = prepared[25];
+	const GEN_FLT c5 = prepared[26];
+	const GEN_FLT c6 = prepared[27];
+	const GEN_FLT c7 = prepared[28];
+	const GEN_FLT c8 = prepared[29];
+	const GEN_FLT c9 = prepared[30];
+	const GEN_FLT c10 = prepared[31];
+	const GEN_FLT c11 = prepared[32];
+	const GEN_FLT c12 = prepared[33];
+	const GEN_FLT c13 = prepared[34];
+	const GEN_FLT c14 = prepared[35];
+	const GEN_FLT c15 = prepared[36];
+	const GEN_FLT c16 = prepared[37];
+	const GEN_FLT c17 = prepared[38];
+	const GEN_FLT c18 = prepared[39];
+	const GEN_FLT c19 = prepared[40];
+	const GEN_FLT c20 = prepared[41];
+	const GEN_FLT c21 = prepared[42];
+	const GEN_FLT c22 = prepared[43];
+	const GEN_FLT c23 = prepared[44];
+	const GEN_FLT c24 = prepared[45];
+	const GEN_FLT c25 = prepared[46];
+	const GEN_FLT c26 = prepared[47];
+	const GEN_FLT c27 = prepared[48];
+	const GEN_FLT c28 = prepared[49];
+	const GEN_FLT c29 = prepared[50];
+	const GEN_FLT c30 = prepared[51];
+	const GEN_FLT c31 = prepared[52];
+	const GEN_FLT c32 = prepared[53];
+	const GEN_FLT c33 = prepared[54];
+	const GEN_FLT c34 = prepared[55];
+	const GEN_FLT c35 = prepared[56];
+	const GEN_FLT c36 = prepared[57];
+	const GEN_FLT c37 = prepared[58];
+	const GEN_FLT c38 = prepared[59];
+	const GEN_FLT c39 = prepared[60];
+	const GEN_FLT c40 = prepared[61];
+	const GEN_FLT c41 = prepared[62];
+	const GEN_FLT c42 = prepared[63];
+	const GEN_FLT c43 = prepared[64];
+	const GEN_FLT c44 = prepared[65];
+	const GEN_FLT c45 = prepared[66];
+	const GEN_FLT c46 = prepared[67];
+	const GEN_FLT c47 = prepared[68];
+	const GEN_FLT c48 = prepared[69];
+	const GEN_FLT c49 = prepared[70];
+	const GEN_FLT c50 = prepared[71];
+	const GEN_FLT c51 = prepared[72];
+	const GEN_FLT c52 = prepared[73];
+	const GEN_FLT c53 = prepared[74];
+	const GEN_FLT c54 = prepared[75];
+	const GEN_FLT c55 = prepared[76];
+	const GEN_FLT c56 = prepared[77];
+	const GEN_FLT c57 = prepared[78];
+	const GEN_FLT c58 = prepared[79];
+	const GEN_FLT c59 = prepared[80];
+	const GEN_FLT c60 = prepared[81];
+	const GEN_FLT c61 = prepared[82];
+	const GEN_FLT c62 = prepared[83];
+	const GEN_FLT c63 = prepared[84];
+	const GEN_FLT c64 = prepared[85];
+	const GEN_FLT c65 = prepared[86];
+	const GEN_FLT c66 = prepared[87];
+	const GEN_FLT c67 = prepared[88];
+	const GEN_FLT c68 = prepared[89];
+	const GEN_FLT c69 = prepared[90];
+	const GEN_FLT c70 = prepared[91];
+	const GEN_FLT c71 = prepared[92];
+	const GEN_FLT sensor_x = sensor_pt[0];
+	const GEN_FLT sensor_y = sensor_pt[1];
+	const GEN_FLT sensor_z = sensor_pt[2];
+	const GEN_FLT x26 = obj_py + (sensor_x * c0) + (sensor_y * c1) + (sensor_z * c2);
+	const GEN_FLT x37 = obj_px + (sensor_x * c3) + (sensor_y * c4) + (sensor_z * c5);
+	const GEN_FLT x41 = obj_pz + (sensor_x * c6) + (sensor_y * c7) + (sensor_z * c8);
+	const GEN_FLT x42 = lh_py + (x10 * x26) + (x33 * x37) + (x40 * x41);
+	const GEN_FLT x50 = c9 + (-1 * x26 * x45) + (-1 * x37 * x49) + (-1 * x41 * x44);
+	const GEN_FLT x51 = atan2(x42, x50);
+	const GEN_FLT x55 = lh_px + (x26 * x54) + (x37 * x52) + (x41 * x53);
+	const GEN_FLT x56 = atan2(x55, x50);
+	const GEN_FLT x57 = x50 * x50;
+	const GEN_FLT x58 = x57 + (x42 * x42);
+	const GEN_FLT x59 = tilt_1 * (1. / sqrt(x58));
+	const GEN_FLT x60 = asin(x55 * x59);
+	const GEN_FLT x61 = 1.5707963267949 + gibPhase_1 + x51 + c10 + (-1 * x60);
+	const GEN_FLT x62 = x55 * x55;
+	const GEN_FLT x63 = 1. / (x57 + x62);
+	const GEN_FLT x64 = 2 * x63;
+	const GEN_FLT x65 = x50 * x64;
+	const GEN_FLT x67 = -1 * x55 * x64;
+	const GEN_FLT x68 = curve_1 * x56;
+	const GEN_FLT x69 = 1. / x58;
+	const GEN_FLT x70 = x50 * x69;
+	const GEN_FLT x71 = -1 * x42;
+	const GEN_FLT x72 = x69 * x71;
+	const GEN_FLT x73 = 1. / sqrt(1 + (-1 * x62 * x69 * c11));
+	const GEN_FLT x74 = 1.0/2.0 * x42;
+	const GEN_FLT x75 = 1.0/2.0 * x50;
+	const GEN_FLT x76 = tilt_1 * x55 * (1. / (x58 * sqrt(x58)));
+	const GEN_FLT x77 = (x33 * x70) + (x66 * x72) + (-1 * x73 * ((x52 * x59) + (x76 * ((-1 * x74 * c12) + (-1 * x75 *
+		c13)))));
+	const GEN_FLT x78 = sin(x61);
+	const GEN_FLT x79 = gibMag_1 * x78;
+	const GEN_FLT x84 = (x10 * x70) + (x72 * x80) + (-1 * x73 * ((x54 * x59) + (x76 * ((-1 * x74 * c14) + (-1 * x75 *
+		c15)))));
+	const GEN_FLT x86 = (x40 * x70) + (x72 * x85) + (-1 * x73 * ((x53 * x59) + (x76 * ((-1 * x74 * c16) + (-1 * x75 *
+		c17)))));
+	const GEN_FLT x105 = (sensor_x * c18) + (sensor_y * c19) + (sensor_z * c20);
+	const GEN_FLT x114 = (sensor_x * c21) + (sensor_y * c22) + (sensor_z * c23);
+	const GEN_FLT x118 = (sensor_x * c24) + (sensor_y * c25) + (sensor_z * c26);
+	const GEN_FLT x119 = (x105 * x53) + (x114 * x54) + (x118 * x52);
+	const GEN_FLT x120 = x105 * x44;
+	const GEN_FLT x121 = x114 * x45;
+	const GEN_FLT x122 = x118 * x49;
+	const GEN_FLT x123 = (-1 * x120) + (-1 * x121) + (-1 * x122);
+	const GEN_FLT x124 = x10 * x114;
+	const GEN_FLT x125 = x105 * x40;
+	const GEN_FLT x126 = x118 * x33;
+	const GEN_FLT x127 = (x123 * x72) + (x70 * (x124 + x125 + x126)) + (-1 * x73 * ((x119 * x59) + (x76 * ((-1 * x74 *
+		((2 * x124) + (2 * x125) + (2 * x126))) + (-1 * x75 * ((-2 * x120) + (-2 * x121) + (-2 * x122)))))));
+	const GEN_FLT x137 = (sensor_x * c27) + (sensor_y * c28) + (sensor_z * c29);
+	const GEN_FLT x142 = (sensor_x * c30) + (sensor_y * c31) + (sensor_z * c32);
+	const GEN_FLT x145 = (sensor_x * c33) + (sensor_y * c34) + (sensor_z * c35);
+	const GEN_FLT x146 = (x137 * x52) + (x142 * x53) + (x145 * x54);
+	const GEN_FLT x147 = x142 * x44;
+	const GEN_FLT x148 = x137 * x49;
+	const GEN_FLT x149 = x145 * x45;
+	const GEN_FLT x150 = (-1 * x147) + (-1 * x148) + (-1 * x149);
+	const GEN_FLT x151 = x137 * x33;
+	const GEN_FLT x152 = x142 * x40;
+	const GEN_FLT x153 = x10 * x145;
+	const GEN_FLT x154 = (x150 * x72) + (x70 * (x151 + x152 + x153)) + (-1 * x73 * ((x146 * x59) + (x76 * ((-1 * x74 *
+		((2 * x151) + (2 * x152) + (2 * x153))) + (-1 * x75 * ((-2 * x147) + (-2 * x148) + (-2 * x149)))))));
+	const GEN_FLT x158 = (sensor_x * c36) + (sensor_y * c37) + (sensor_z * c38);
+	const GEN_FLT x160 = (sensor_x * c39) + (sensor_y * c40) + (sensor_z * c41);
+	const GEN_FLT x162 = (sensor_x * c42) + (sensor_y * c43) + (sensor_z * c44);
+	const GEN_FLT x163 = (x158 * x52) + (x160 * x54) + (x162 * x53);
+	const GEN_FLT x164 = x160 * x45;
+	const GEN_FLT x165 = x158 * x49;
+	const GEN_FLT x166 = x162 * x44;
+	const GEN_FLT x167 = (-1 * x164) + (-1 * x165) + (-1 * x166);
+	const GEN_FLT x168 = x10 * x160;
+	const GEN_FLT x169 = x158 * x33;
+	const GEN_FLT x170 = x162 * x40;
+	const GEN_FLT x171 = (x167 * x72) + (x70 * (x168 + x169 + x170)) + (-1 * x73 * ((x163 * x59) + (x76 * ((-1 * x74 *
+		((2 * x168) + (2 * x169) + (2 * x170))) + (-1 * x75 * ((-2 * x164) + (-2 * x165) + (-2 * x166)))))));
+	const GEN_FLT x172 = x59 * x73;
+	const GEN_FLT x173 = x73 * x76;
+	const GEN_FLT x174 = x173 * x71;
+	const GEN_FLT x175 = x72 + (x173 * x50);
+	const GEN_FLT x180 = x41 * c45;
+	const GEN_FLT x190 = x26 * c46;
+	const GEN_FLT x198 = x37 * c47;
+	const GEN_FLT x199 = (-1 * x180) + (-1 * x190) + (-1 * x198);
+	const GEN_FLT x206 = (x26 * c48) + (x37 * c49) + (x41 * c50);
+	const GEN_FLT x208 = x26 * c51;
+	const GEN_FLT x210 = x41 * c52;
+	const GEN_FLT x212 = x37 * c53;
+	const GEN_FLT x213 = (x199 * x72) + (x70 * (x208 + x210 + x212)) + (-1 * x73 * ((x206 * x59) + (x76 * ((-1 * x74 *
+		((2 * x208) + (2 * x210) + (2 * x212))) + (-1 * x75 * ((-2 * x180) + (-2 * x190) + (-2 * x198)))))));
+	const GEN_FLT x223 = (x26 * c54) + (x37 * c55) + (x41 * c56);
+	const GEN_FLT x225 = x41 * c57;
+	const GEN_FLT x227 = x37 * c58;
+	const GEN_FLT x230 = x26 * c59;
+	const GEN_FLT x231 = (-1 * x225) + (-1 * x227) + (-1 * x230);
+	const GEN_FLT x233 = x26 * c60;
+	const GEN_FLT x235 = x37 * c61;
+	const GEN_FLT x236 = x41 * c62;
+	const GEN_FLT x237 = (x231 * x72) + (x70 * (x233 + x235 + x236)) + (-1 * x73 * ((x223 * x59) + (x76 * ((-1 * x74 *
+		((2 * x233) + (2 * x235) + (2 * x236))) + (-1 * x75 * ((-2 * x225) + (-2 * x227) + (-2 * x230)))))));
+	const GEN_FLT x241 = (x26 * c63) + (x37 * c64) + (x41 * c65);
+	const GEN_FLT x243 = x41 * c66;
+	const GEN_FLT x244 = x37 * c67;
+	const GEN_FLT x246 = x26 * c68;
+	const GEN_FLT x247 = (-1 * x243) + (-1 * x244) + (-1 * x246);
+	const GEN_FLT x248 = x26 * c69;
+	const GEN_FLT x249 = x37 * c70;
+	const GEN_FLT x250 = x41 * c71;
+	const GEN_FLT x251 = (x247 * x72) + (x70 * (x248 + x249 + x250)) + (-1 * x73 * ((x241 * x59) + (x76 * ((-1 * x74 *
+		((2 * x248) + (2 * x249) + (2 * x250))) + (-1 * x75 * ((-2 * x243) + (-2 * x244) + (-2 * x246)))))));
+	out[0] = x51 + c10 + (-1 * x60) + (curve_1 * (x56 * x56)) + (-1 * gibMag_1 * cos(x61));
+	out[1] = x77 + (x68 * ((x52 * x65) + (x66 * x67))) + (x77 * x79);
+	out[2] = x84 + (x68 * ((x54 * x65) + (x67 * x80))) + (x79 * x84);
+	out[3] = x86 + (x68 * ((x53 * x65) + (x67 * x85))) + (x79 * x86);
+	out[4] = x127 + (x127 * x79) + (x68 * ((x119 * x65) + (x123 * x67)));
+	out[5] = x154 + (x154 * x79) + (x68 * ((x146 * x65) + (x150 * x67)));
+	out[6] = x171 + (x171 * x79) + (x68 * ((x163 * x65) + (x167 * x67)));
+	out[7] = (-1 * x172) + (-1 * x172 * x79) + (2 * curve_1 * x50 * x56 * x63);
+	out[8] = x70 + (-1 * x174) + (x79 * ((-1 * x174) + (x50 * x69)));
+	out[9] = (-1 * x175) + (-1 * x67 * x68) + (-1 * gibMag_1 * x175 * x78);
+	out[10] = x213 + (x213 * x79) + (x68 * ((x199 * x67) + (x206 * x65)));
+	out[11] = x237 + (x237 * x79) + (x68 * ((x223 * x65) + (x231 * x67)));
+	out[12] = x251 + (x251 * x79) + (x68 * ((x241 * x65) + (x247 * x67)));
+}
@@ -12,6 +12,14 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "survive_internal.h"
+#include <os_generic.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
 SURVIVE_EXPORT int32_t PoserData_size(const PoserData *poser_data) {
 	switch (poser_data->pt) {
 	case POSERDATA_DISASSOCIATE:
@@ -163,7 +171,11 @@ void PoserData_lighthouse_pose_func(PoserData *poser_data, SurviveObject *so, ui
 		for (int i = 0; i < 7; i++)
 			assert(!isnan(((FLT *)&lighthouse2world)[i]));
 
+		survive_get_bsd_lock(ctx);
 		so->ctx->bsd[lighthouse].confidence = 1.;
+		survive_release_bsd_lock(ctx);
+
+		// Not under the bsd lock; the hook runs user callbacks and can block on recording
 		SURVIVE_INVOKE_HOOK(lighthouse_pose, so->ctx, lighthouse, &lighthouse2world);
 	}
 }
@@ -171,6 +183,7 @@ void PoserData_lighthouse_pose_func(PoserData *poser_data, SurviveObject *so, ui
 int8_t survive_get_reference_bsd(SurviveContext *ctx, SurvivePose *lighthouse_pose, uint32_t lighthouse_count) {
 	uint32_t reference_basestation = survive_configi(ctx, "reference-basestation", SC_GET, 0);
 	int8_t ref = 0;
+	survive_get_bsd_lock(ctx);
 	for (int lh = 0; lh < lighthouse_count; lh++) {
 		SurvivePose lh2object = lighthouse_pose[lh];
 		if (quatmagnitude(lh2object.Rot) != 0.0) {
@@ -182,6 +195,7 @@ int8_t survive_get_reference_bsd(SurviveContext *ctx, SurvivePose *lighthouse_po
 			}
 		}
 	}
+	survive_release_bsd_lock(ctx);
 	return ref;
 }
 
@@ -215,6 +229,7 @@ void PoserData_lighthouse_poses_func(PoserData *poser_data, SurviveObject *so, S
 
 		uint32_t reference_basestation = survive_configi(so->ctx, "reference-basestation", SC_GET, 0);
 
+		survive_get_bsd_lock(so->ctx);
 		for (int lh = 0; lh < lighthouse_count; lh++) {
 			SurvivePose lh2object = lighthouse_pose[lh];
 			if (quatmagnitude(lh2object.Rot) != 0.0) {
@@ -230,9 +245,11 @@ void PoserData_lighthouse_poses_func(PoserData *poser_data, SurviveObject *so, S
 				cnt++;
 			}
 		}
+		uint32_t reference_id = so->ctx->bsd[lh_indices[0]].BaseStationID;
+		survive_release_bsd_lock(so->ctx);
 
 		struct SurviveContext *ctx = so->ctx;
-		SV_INFO("Using LH %d (%08x) as reference lighthouse", lh_indices[0], so->ctx->bsd[lh_indices[0]].BaseStationID);
+		SV_INFO("Using LH %d (%08x) as reference lighthouse", lh_indices[0], reference_id);
 		for (int lh_idx = 0; lh_idx < cnt; lh_idx++) {
 			int lh = lh_indices[lh_idx];
 
@@ -259,16 +276,19 @@ void PoserData_lighthouse_poses_func(PoserData *poser_data, SurviveObject *so, S
 }
 
 FLT survive_lighthouse_adjust_confidence(SurviveContext *ctx, uint8_t bsd_idx, FLT v) {
+	survive_get_bsd_lock(ctx);
 	ctx->bsd[bsd_idx].confidence += v;
 
 	if (ctx->bsd[bsd_idx].confidence < 0) {
 		ctx->bsd[bsd_idx].PositionSet = 0;
 		SV_WARN("Position for LH%d seems bad; queuing for recal", bsd_idx);
 	} else if (ctx->bsd[bsd_idx].confidence > 1.) {
-		return ctx->bsd[bsd_idx].confidence = 1;
+		ctx->bsd[bsd_idx].confidence = 1;
 	}
 
-	return ctx->bsd[bsd_idx].confidence;
+	FLT rtn = ctx->bsd[bsd_idx].confidence;
+	survive_release_bsd_lock(ctx);
+	return rtn;
 }
 
 SURVIVE_EXPORT FLT survive_adjust_confidence(SurviveObject *so, FLT delta) {
@@ -284,79 +304,274 @@ void survive_poser_invoke(SurviveObject *so, PoserData *poserData, size_t poserD
 	}
 }
 
-struct survive_threaded_poser {
-	og_thread_t thread;
+// Threaded posers only ever hold their object's lock; everything else invokes posers with the ctx lock held.
+static OG_THREAD_LOCAL bool on_threaded_poser = false;
 
-	union PoserDataAll PoserData;
-	bool active, has_new_data;
-	og_cv_t data_available;
-	og_mutex_t data_available_lock;
+uint32_t survive_poser_release_locks(SurviveObject *so) {
+	uint32_t depth = survive_held_so_lock_depth(so);
+	for (uint32_t i = 0; i < depth; i++) {
+		survive_release_so_lock(so);
+	}
+	if (!on_threaded_poser) {
+		survive_release_ctx_lock(so->ctx);
+	}
+	return depth;
+}
 
+void survive_poser_get_locks(SurviveObject *so, uint32_t so_lock_depth) {
+	if (!on_threaded_poser) {
+		survive_get_ctx_lock(so->ctx);
+	}
+	for (uint32_t i = 0; i < so_lock_depth; i++) {
+		survive_get_so_lock(so);
+	}
+}
+
+STATIC_CONFIG_ITEM(POSER_THREADS, "poser-threads", 'i',
+				   "Number of worker threads shared by threaded posers; 0 uses one per core", 0)
+
+static int survive_processor_count() {
+#ifdef _WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return info.dwNumberOfProcessors;
+#else
+	long cnt = sysconf(_SC_NPROCESSORS_ONLN);
+	return cnt > 0 ? (int)cnt : 1;
+#endif
+}
+
+/*
+ * Threaded posers share a fixed set of workers. Each object has a single slot holding its newest sync; a sync that
+ * lands before the previous one ran replaces it. An object with a pending sync sits in exactly one worker queue --
+ * first its home worker's, and afterwards the queue of whichever worker last ran it. Workers run their own queue
+ * oldest first and, when it is empty, steal the newest entry from another worker. An object is never run by two
+ * workers at once.
+ */
+struct survive_threaded_poser {
+	struct survive_threaded_poser_pool *pool;
 	SurviveObject *so;
 	PoserCB innerPoser;
 	void *innerPoserData;
+	int home_worker;
 
-	uint32_t run_count, new_data_count;
+	// Guarded by the pool lock
+	union PoserDataAll PoserData;
+	bool active, has_new_data, queued, running;
+	survive_threaded_poser_stats stats;
 };
 
-void *survive_threaded_poser_thread_fn(void *_poser) {
-	struct survive_threaded_poser *self = (struct survive_threaded_poser *)_poser;
-	OGLockMutex(self->data_available_lock);
-	while (self->active) {
-		OGWaitCond(self->data_available, self->data_available_lock);
+typedef struct survive_threaded_poser_worker {
+	struct survive_threaded_poser_pool *pool;
+	og_thread_t thread;
+	size_t idx;
+
+	// The sync being run is copied out of the object's slot so a newer one can land meanwhile
+	union PoserDataAll PoserData;
+
+	struct survive_threaded_poser **queue;
+	size_t queue_cnt, queue_size;
+} survive_threaded_poser_worker;
+
+struct survive_threaded_poser_pool {
+	SurviveContext *ctx;
+	og_mutex_t lock;
+	og_cv_t work_available;
+	og_cv_t run_finished;
+	bool active;
+
+	size_t next_home_worker;
+	size_t worker_cnt;
+	survive_threaded_poser_worker *workers;
+};
+
+static void poser_pool_enqueue(survive_threaded_poser_worker *worker, struct survive_threaded_poser *poser) {
+	if (worker->queue_cnt == worker->queue_size) {
+		worker->queue_size = worker->queue_size ? worker->queue_size * 2 : 8;
+		worker->queue = SV_REALLOC(worker->queue, sizeof(struct survive_threaded_poser *) * worker->queue_size);
+	}
+	worker->queue[worker->queue_cnt++] = poser;
+	poser->queued = true;
+}
+
+static bool poser_pool_remove(survive_threaded_poser_worker *worker, struct survive_threaded_poser *poser) {
+	for (size_t i = 0; i < worker->queue_cnt; i++) {
+		if (worker->queue[i] == poser) {
+			memmove(worker->queue + i, worker->queue + i + 1, sizeof(worker->queue[0]) * (worker->queue_cnt - i - 1));
+			worker->queue_cnt--;
+			poser->queued = false;
+			return true;
+		}
+	}
+	return false;
+}
+
+static struct survive_threaded_poser *poser_pool_next(survive_threaded_poser_worker *worker, bool *stolen) {
+	struct survive_threaded_poser_pool *pool = worker->pool;
+	if (worker->queue_cnt > 0) {
+		struct survive_threaded_poser *rtn = worker->queue[0];
+		poser_pool_remove(worker, rtn);
+		return rtn;
+	}
 
-		while (self->has_new_data) {
-			SurviveObject *so = self->so;
-			self->has_new_data = false;
-			OGUnlockMutex(self->data_available_lock);
+	for (size_t i = 1; i < pool->worker_cnt; i++) {
+		survive_threaded_poser_worker *victim = &pool->workers[(worker->idx + i) % pool->worker_cnt];
+		if (victim->queue_cnt > 0) {
+			struct survive_threaded_poser *rtn = victim->queue[--victim->queue_cnt];
+			rtn->queued = false;
+			*stolen = true;
+			return rtn;
+		}
+	}
+	return 0;
+}
 
-			survive_get_ctx_lock(self->so->ctx);
-			self->innerPoser(so, &self->innerPoserData, &self->PoserData.pd);
-			survive_release_ctx_lock(self->so->ctx);
-			self->run_count++;
+static void *survive_threaded_poser_thread_fn(void *_worker) {
+	survive_threaded_poser_worker *worker = _worker;
+	struct survive_threaded_poser_pool *pool = worker->pool;
+	on_threaded_poser = true;
+
+	OGLockMutex(pool->lock);
+	while (pool->active) {
+		bool stolen = false;
+		struct survive_threaded_poser *poser = poser_pool_next(worker, &stolen);
+		if (poser == 0) {
+			OGWaitCond(pool->work_available, pool->lock);
+			continue;
+		}
 
-			OGLockMutex(self->data_available_lock);
+		poser->running = true;
+		poser->has_new_data = false;
+		memcpy(&worker->PoserData, &poser->PoserData, PoserData_size(&poser->PoserData.pd));
+		if (stolen) {
+			poser->stats.steal_cnt++;
 		}
+		OGUnlockMutex(pool->lock);
+
+		SurviveObject *so = poser->so;
+		survive_get_so_lock(so);
+		poser->innerPoser(so, &poser->innerPoserData, &worker->PoserData.pd);
+		survive_release_so_lock(so);
+
+		OGLockMutex(pool->lock);
+		poser->running = false;
+		poser->stats.run_cnt++;
+		if (poser->active && poser->has_new_data) {
+			poser_pool_enqueue(worker, poser);
+		}
+		OGBroadcastCond(pool->run_finished);
 	}
-	OGUnlockMutex(self->data_available_lock);
+	OGUnlockMutex(pool->lock);
 	return 0;
 }
 
+struct survive_threaded_poser_pool *survive_threaded_poser_pool_create(SurviveContext *ctx) {
+	struct survive_threaded_poser_pool *pool = SV_CALLOC(sizeof(struct survive_threaded_poser_pool));
+	pool->ctx = ctx;
+	pool->lock = OGCreateMutex();
+	pool->work_available = OGCreateConditionVariable();
+	pool->run_finished = OGCreateConditionVariable();
+	pool->active = true;
+
+	int threads = survive_configi(ctx, POSER_THREADS_TAG, SC_GET, 0);
+	pool->worker_cnt = threads > 0 ? threads : survive_processor_count();
+	pool->workers = SV_CALLOC(sizeof(survive_threaded_poser_worker) * pool->worker_cnt);
+
+	SV_VERBOSE(10, "Creating %d threaded poser workers", (int)pool->worker_cnt);
+	for (size_t i = 0; i < pool->worker_cnt; i++) {
+		pool->workers[i].pool = pool;
+		pool->workers[i].idx = i;
+		pool->workers[i].thread = OGCreateThread(survive_threaded_poser_thread_fn, "threaded poser", &pool->workers[i]);
+	}
+	return pool;
+}
+
+void survive_threaded_poser_pool_free(struct survive_threaded_poser_pool *pool) {
+	if (pool == 0) {
+		return;
+	}
+
+	OGLockMutex(pool->lock);
+	pool->active = false;
+	OGBroadcastCond(pool->work_available);
+	OGUnlockMutex(pool->lock);
+
+	for (size_t i = 0; i < pool->worker_cnt; i++) {
+		OGJoinThread(pool->workers[i].thread);
+		assert(pool->workers[i].queue_cnt == 0);
+		free(pool->workers[i].queue);
+	}
+
+	OGDeleteConditionVariable(pool->work_available);
+	OGDeleteConditionVariable(pool->run_finished);
+	OGDeleteMutex(pool->lock);
+	free(pool->workers);
+	free(pool);
+}
+
 struct survive_threaded_poser *survive_create_threaded_poser(SurviveObject *so, PoserCB innerPoser) {
+	struct survive_threaded_poser_pool *pool = survive_get_threaded_poser_pool(so->ctx);
+	// Bare contexts that never went through survive_init have nowhere to keep a pool
+	if (pool == 0) {
+		return 0;
+	}
+
 	struct survive_threaded_poser *poser = SV_CALLOC(sizeof(struct survive_threaded_poser));
+	poser->pool = pool;
 	poser->so = so;
 	poser->innerPoser = innerPoser;
-	poser->data_available = OGCreateConditionVariable();
-	poser->data_available_lock = OGCreateMutex();
 	poser->active = 1;
+
+	OGLockMutex(pool->lock);
+	poser->home_worker = pool->next_home_worker++ % pool->worker_cnt;
+	OGUnlockMutex(pool->lock);
+
 	SurviveContext *ctx = so->ctx;
-	SV_VERBOSE(10, "Creating threaded poser for %s", survive_colorize(so->codename));
-	poser->thread = OGCreateThread(survive_threaded_poser_thread_fn, "threaded poser", poser);
+	SV_VERBOSE(10, "Creating threaded poser for %s on worker %d", survive_colorize(so->codename), poser->home_worker);
 	return poser;
 }
+
+bool survive_threaded_poser_get_stats(const SurviveObject *so, survive_threaded_poser_stats *stats) {
+	if (so->ctx->PoserFn != survive_threaded_poser_fn || so->PoserFnData == 0) {
+		return false;
+	}
+
+	struct survive_threaded_poser *self = so->PoserFnData;
+	OGLockMutex(self->pool->lock);
+	*stats = self->stats;
+	OGUnlockMutex(self->pool->lock);
+	return true;
+}
+
 int survive_threaded_poser_fn(SurviveObject *so, void **user, PoserData *pd) {
 	struct survive_threaded_poser *self = (struct survive_threaded_poser *)*user;
 	assert(self);
+	struct survive_threaded_poser_pool *pool = self->pool;
 
 	switch (pd->pt) {
 	case POSERDATA_DISASSOCIATE: {
-		OGLockMutex(self->data_available_lock);
-		self->active = 0;
-		OGSignalCond(self->data_available);
-		OGUnlockMutex(self->data_available_lock);
-		survive_release_ctx_lock(self->so->ctx);
-		OGJoinThread(self->thread);
-		survive_get_ctx_lock(self->so->ctx);
+		// The running solve needs the object lock to finish
+		uint32_t so_lock_depth = survive_poser_release_locks(so);
+		OGLockMutex(pool->lock);
+		self->active = false;
+		for (size_t i = 0; i < pool->worker_cnt && self->queued; i++) {
+			poser_pool_remove(&pool->workers[i], self);
+		}
+		while (self->running) {
+			OGWaitCond(pool->run_finished, pool->lock);
+		}
+		OGUnlockMutex(pool->lock);
+		survive_poser_get_locks(so, so_lock_depth);
 
 		self->innerPoser(so, &self->innerPoserData, pd);
 
 		SurviveContext *ctx = so->ctx;
-		SV_VERBOSE(5, "Threaded stats:");
-		SV_VERBOSE(5, "\tRan       %d", self->run_count);
-		SV_VERBOSE(5, "\tNew data  %d", self->new_data_count);
+		SV_VERBOSE(5, "Threaded stats for %s:", so->codename);
+		SV_VERBOSE(5, "\tRan       %u", self->stats.run_cnt);
+		SV_VERBOSE(5, "\tNew data  %u", self->stats.new_data_cnt);
+		SV_VERBOSE(5, "\tDropped   %u", self->stats.drop_cnt);
+		SV_VERBOSE(5, "\tStolen    %u", self->stats.steal_cnt);
 
-		OGDeleteMutex(self->data_available_lock);
-		OGDeleteConditionVariable(self->data_available);
 		if (so->PoserFnData == self)
 			so->PoserFnData = 0;
 		free(self);
@@ -365,12 +580,18 @@ int survive_threaded_poser_fn(SurviveObject *so, void **user, PoserData *pd) {
 	}
 	case POSERDATA_SYNC_GEN2:
 	case POSERDATA_SYNC: {
-		OGLockMutex(self->data_available_lock);
+		OGLockMutex(pool->lock);
+		if (self->has_new_data) {
+			self->stats.drop_cnt++;
+		}
 		memcpy(&self->PoserData.pd, pd, PoserData_size(pd));
 		self->has_new_data = true;
-		self->new_data_count++;
-		OGSignalCond(self->data_available);
-		OGUnlockMutex(self->data_available_lock);
+		self->stats.new_data_cnt++;
+		if (!self->queued && !self->running) {
+			poser_pool_enqueue(&pool->workers[self->home_worker], self);
+			OGSignalCond(pool->work_available);
+		}
+		OGUnlockMutex(pool->lock);
 		return 0;
 	}
 	default: {
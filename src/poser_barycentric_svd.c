@@ -166,14 +166,19 @@ static void add_correspondences(SurviveObject *so, bc_svd *bc, uint32_t timecode
 	survive_timecode sensor_time_window =
 		isStationary ? (so->timebase_hz) : SurviveSensorActivations_default_tolerance * 2;
 
-	for (size_t sensor_idx = 0; sensor_idx < so->sensor_ct; sensor_idx++) {
+	uint32_t valid[2] = {SurviveSensorActivations_valid_sensors(scene, sensor_time_window, lh, 0),
+						 SurviveSensorActivations_valid_sensors(scene, sensor_time_window, lh, 1)};
+	uint32_t any_valid = valid[0] | valid[1];
+
+	// Sensors without a valid reading on either axis would only add NANs, which bc_svd ignores anyway
+	for (size_t sensor_idx = 0; sensor_idx < so->sensor_ct && (any_valid >> sensor_idx); sensor_idx++) {
+		if (((any_valid >> sensor_idx) & 1) == 0)
+			continue;
+
 		FLT angles[2] = {NAN, NAN};
 		for (uint8_t axis = 0; axis < 2; axis++) {
-			bool isReadingValid =
-				SurviveSensorActivations_is_reading_valid(scene, sensor_time_window, sensor_idx, lh, axis);
-
-			if (isReadingValid) {
-				angles[axis] = scene->angles[sensor_idx][lh][axis];
+			if ((valid[axis] >> sensor_idx) & 1) {
+				angles[axis] = SurviveSensorActivations_angle(scene, sensor_idx, lh, axis);
 			}
 		}
 
@@ -204,7 +209,9 @@ void solve_global_scene(struct SurviveObject *so, PoserDataSVD *dd, PoserDataGlo
 		bc_svd *bc = &dd->bc;
 		bc_svd_reset_correspondences(bc);
 
-		const BaseStationCal *cal = ctx->bsd[lh].fcal;
+		BaseStationData bsd;
+		survive_get_bsd_snapshot(ctx, lh, 1, &bsd);
+		const BaseStationCal *cal = bsd.fcal;
 		for (size_t m = 0; m < scene->meas_cnt; m++) {
 			if (scene->meas[m].lh == lh)
 				bc_svd_add_single_correspondence(bc, scene->meas[m].sensor_idx, scene->meas[m].axis,
@@ -270,18 +277,20 @@ int PoserBaryCentricSVD(SurviveObject *so, void **user, PoserData *pd) {
 			bool hasLighthousePoses = false;
 			bool hasUnsolvedLighthousePoses = false;
 			for (int lh = 0; lh < so->ctx->activeLighthouses; lh++) {
-				if (so->ctx->bsd[lh].PositionSet) {
+				BaseStationData bsd;
+				survive_get_bsd_snapshot(ctx, lh, 1, &bsd);
+				if (bsd.PositionSet) {
 					hasLighthousePoses = true;
 					add_correspondences(so, &dd->bc, lightData->hdr.timecode, lh);
 
 					if (dd->bc.meas_cnt >= dd->required_meas) {
 
-						survive_release_ctx_lock(so->ctx);
+						uint32_t so_lock_depth = survive_poser_release_locks(so);
 						SurvivePose obj2Lh = solve_correspondence(dd, false);
-						survive_get_ctx_lock(so->ctx);
+						survive_poser_get_locks(so, so_lock_depth);
 
 						if (quatmagnitude(obj2Lh.Rot) != 0) {
-							SurvivePose *lh2world = &so->ctx->bsd[lh].Pose;
+							SurvivePose *lh2world = &bsd.Pose;
 
 							ApplyPoseToPose(&objs2world[lh], lh2world, &obj2Lh);
 							meas[lh] = dd->bc.meas_cnt;
@@ -321,13 +330,15 @@ int PoserBaryCentricSVD(SurviveObject *so, void **user, PoserData *pd) {
 			SurvivePose lh2world[NUM_GEN2_LIGHTHOUSES] = { 0 };
 			int solved = 0;
 			for (int lh = 0; lh < ctx->activeLighthouses; lh++) {
-				if (!so->ctx->bsd[lh].PositionSet && so->ctx->bsd[lh].OOTXSet) {
+				BaseStationData bsd;
+				survive_get_bsd_snapshot(ctx, lh, 1, &bsd);
+				if (!bsd.PositionSet && bsd.OOTXSet) {
 					add_correspondences(so, &dd->bc, lightData->hdr.timecode, lh);
 
 					if (dd->bc.meas_cnt >= dd->required_meas) {
 						SurvivePose lh2obj = solve_correspondence(dd, true);
 						if (quatmagnitude(lh2obj.Rot) != 0) {
-							LinmathPoint3d up = {ctx->bsd[lh].accel[0], ctx->bsd[lh].accel[1], ctx->bsd[lh].accel[2]};
+							LinmathPoint3d up = {bsd.accel[0], bsd.accel[1], bsd.accel[2]};
 							FLT err = 0;
 
 							// Some older replays don't have the accel
@@ -108,7 +108,8 @@ static void add_correspondences(SurviveObject *so, epnp *pnp, SurviveSensorActiv
 	for (size_t sensor_idx = 0; sensor_idx < so->sensor_ct; sensor_idx++) {
 		if (SurviveSensorActivations_isPairValid(scene, SurviveSensorActivations_default_tolerance * 4, timecode,
 												 sensor_idx, lh)) {
-			FLT *_angles = scene->angles[sensor_idx][lh];
+			FLT _angles[2] = {SurviveSensorActivations_angle(scene, sensor_idx, lh, 0),
+							  SurviveSensorActivations_angle(scene, sensor_idx, lh, 1)};
 			FLT angles[2];
 			survive_apply_bsd_calibration(so->ctx, lh, _angles, angles);
 
@@ -135,7 +136,9 @@ int PoserEPNP(SurviveObject *so, PoserData *pd) {
 		SurvivePose posers[NUM_GEN2_LIGHTHOUSES] = {0};
 		int meas[2] = {0, 0};
 		for (int lh = 0; lh < so->ctx->activeLighthouses; lh++) {
-			if (so->ctx->bsd[lh].PositionSet) {
+			BaseStationData bsd;
+			survive_get_bsd_snapshot(ctx, lh, 1, &bsd);
+			if (bsd.PositionSet) {
 				epnp pnp = {.fu = 1, .fv = 1};
 				epnp_set_maximum_number_of_correspondences(&pnp, so->sensor_ct);
 
@@ -148,7 +151,7 @@ int PoserEPNP(SurviveObject *so, PoserData *pd) {
 
 					SurvivePose objInLh = solve_correspondence(so, &pnp, false);
 					if (quatmagnitude(objInLh.Rot) != 0) {
-						SurvivePose *lh2world = &so->ctx->bsd[lh].Pose;
+						SurvivePose *lh2world = &bsd.Pose;
 
 						SurvivePose txPose = {.Rot = {1}};
 						ApplyPoseToPose(&txPose, lh2world, &objInLh);
@@ -36,10 +36,15 @@ STATIC_CONFIG_ITEM(SENSOR_VARIANCE, "sensor-variance", 'f', "Base variance for e
 STATIC_CONFIG_ITEM(DISABLE_LIGHTHOUSE, "disable-lighthouse", 'i', "Disable given lighthouse from tracking", -1)
 STATIC_CONFIG_ITEM(RUN_EVERY_N_SYNCS, "syncs-per-run", 'i', "Number of sync pulses before running optimizer", 1)
 STATIC_CONFIG_ITEM(RUN_POSER_ASYNC, "poser-async", 'i', "Run the poser in it's own thread", 0)
+STATIC_CONFIG_ITEM(POSER_ASYNC_THREADS, "poser-async-threads", 'i', "Number of threads an async poser solves on", 1)
+STATIC_CONFIG_ITEM(POSER_ASYNC_BUFFERS, "poser-async-buffers", 'i',
+				   "Number of solves an async poser can have queued or running; 0 uses one more than the thread count", 0)
 
 STATIC_CONFIG_ITEM(PRECISE_POSE, "precise", 'i', "Always calculate precise pose", 0)
 STATIC_CONFIG_ITEM(USE_STATIONARY_SENSOR_WINDOW, "use-stationary-sensor-window", 'i',
 				   "Use larger time window when stationary", 1)
+STATIC_CONFIG_ITEM(OPTIMIZER_SPARSE, "optimizer-sparse", 'i',
+				   "Use the sparse (Schur complement) LM solver instead of MPFIT for global scene solves", 1)
 
 typedef struct MPFITStats {
 	int meas_failures;
@@ -109,6 +114,9 @@ struct async_optimizer_user {
 	bool worldEstablished;
 	size_t meas_for_lhs_axis[NUM_GEN2_LIGHTHOUSES * 2];
 
+	// Lighthouse state as of setup_optimizer; posers don't hold the ctx lock, so ctx->bsd is only read under the bsd lock
+	BaseStationData bsd[NUM_GEN2_LIGHTHOUSES];
+
 	struct {
 		survive_long_timecode old_measurements_age;
 		uint32_t time_window;
@@ -117,8 +125,9 @@ struct async_optimizer_user {
 };
 
 static size_t construct_input_from_scene(const MPFITData *d, survive_long_timecode timecode,
-										 const SurviveSensorActivations *scene, size_t *meas_for_lhs_axis,
-										 survive_optimizer_measurement *meas, struct async_optimizer_user *user) {
+										 const SurviveSensorActivations *scene, const BaseStationData *bsd,
+										 size_t *meas_for_lhs_axis, survive_optimizer_measurement *meas,
+										 struct async_optimizer_user *user) {
 	size_t rtn = 0;
 	SurviveObject *so = d->opt.so;
 	SurviveContext *ctx = so->ctx;
@@ -137,35 +146,36 @@ static size_t construct_input_from_scene(const MPFITData *d, survive_long_timeco
 			continue;
 		}
 
-		if (!ctx->bsd[lh].PositionSet && (!isStationary || !ctx->bsd[lh].OOTXSet)) {
+		if (!bsd[lh].PositionSet && (!isStationary || !bsd[lh].OOTXSet)) {
 			continue;
 		}
 
-		if (!ctx->bsd[lh].PositionSet) {
+		if (!bsd[lh].PositionSet) {
 			SV_VERBOSE(500, "Allowing data from %d", lh);
 		}
 
-		bool isCandidate = !ctx->bsd[lh].PositionSet;
+		bool isCandidate = !bsd[lh].PositionSet;
 		size_t candidate_meas = 10;
 
+		// The window is exclusive; valid_sensors' tolerance isn't
+		uint32_t valid[2] = {SurviveSensorActivations_valid_sensors(scene, sensor_time_window - 1, lh, 0),
+							 SurviveSensorActivations_valid_sensors(scene, sensor_time_window - 1, lh, 1)};
+		uint32_t any_valid = valid[0] | valid[1];
+
 		size_t meas_for_lh = 0;
-		for (uint8_t sensor = 0; sensor < so->sensor_ct; sensor++) {
+		for (uint8_t sensor = 0; sensor < so->sensor_ct && (any_valid >> sensor); sensor++) {
 			for (uint8_t axis = 0; axis < 2; axis++) {
-				survive_timecode last_reading =
-					SurviveSensorActivations_time_since_last_reading(scene, sensor, lh, axis);
-				bool isReadingValue = last_reading < sensor_time_window;
-
-				if (isReadingValue) {
-					const FLT *a = scene->angles[sensor][lh];
+				if ((valid[axis] >> sensor) & 1) {
+					survive_long_timecode reading_time = SurviveSensorActivations_timecode(scene, sensor, lh, axis);
 					meas->object = 0;
 					meas->axis = axis;
-					meas->value = a[axis];
+					meas->value = SurviveSensorActivations_angle(scene, sensor, lh, axis);
 					meas->sensor_idx = sensor;
 					meas->lh = lh;
-					survive_timecode diff = survive_timecode_difference(timecode, scene->timecode[sensor][lh][axis]);
+					survive_timecode diff = survive_timecode_difference(timecode, reading_time);
 					meas->variance = d->sensor_variance + diff * d->sensor_variance_per_second / (FLT)so->timebase_hz;
-					if (most_recent_time && scene->timecode[sensor][lh][axis] > *most_recent_time) {
-						*most_recent_time = scene->timecode[sensor][lh][axis];
+					if (most_recent_time && reading_time > *most_recent_time) {
+						*most_recent_time = reading_time;
 					}
 					// SV_INFO("Adding meas %d %d %d %f", lh, sensor, axis, meas->value);
 					meas++;
@@ -174,9 +184,23 @@ static size_t construct_input_from_scene(const MPFITData *d, survive_long_timeco
 					if (meas_for_lhs_axis) {
 						meas_for_lhs_axis[lh * 2 + axis]++;
 					}
-				} else if (last_reading != UINT32_MAX && user) {
-					user->stats.old_measurements_age += last_reading;
-					user->stats.old_measurements++;
+				}
+			}
+		}
+
+		// Stale readings only show up in the verbose success log, so only go looking for them when that's on
+		if (user && ctx->log_level >= 110) {
+			for (uint8_t axis = 0; axis < 2; axis++) {
+				uint32_t stale = scene->seen_sensors[lh][axis] & ~valid[axis];
+				for (uint8_t sensor = 0; sensor < so->sensor_ct && (stale >> sensor); sensor++) {
+					if ((stale >> sensor) & 1) {
+						survive_timecode last_reading =
+							SurviveSensorActivations_time_since_last_reading(scene, sensor, lh, axis);
+						if (last_reading != UINT32_MAX) {
+							user->stats.old_measurements_age += last_reading;
+							user->stats.old_measurements++;
+						}
+					}
 				}
 			}
 		}
@@ -188,7 +212,8 @@ static size_t construct_input_from_scene(const MPFITData *d, survive_long_timeco
 	return rtn;
 }
 
-static bool invalid_starting_condition(MPFITData *d, size_t meas_size, const size_t *meas_for_lhs_axis) {
+static bool invalid_starting_condition(MPFITData *d, const BaseStationData *bsd, size_t meas_size,
+									   const size_t *meas_for_lhs_axis) {
 	static int failure_count = 500;
 	struct SurviveObject *so = d->opt.so;
 
@@ -196,7 +221,7 @@ static bool invalid_starting_condition(MPFITData *d, size_t meas_size, const siz
 	size_t axis_known_lh = 0;
 	if (meas_for_lhs_axis) {
 		for (uint8_t lh = 0; lh < so->ctx->activeLighthouses; lh++) {
-			if (so->ctx->bsd[lh].PositionSet) {
+			if (bsd[lh].PositionSet) {
 				meas_size_known_lh += meas_for_lhs_axis[2 * lh] + meas_for_lhs_axis[2 * lh + 1];
 				for (int axis = 0; axis < 2; axis++)
 					axis_known_lh += meas_for_lhs_axis[2 * lh + axis] > 0;
@@ -257,6 +282,8 @@ static int setup_optimizer(struct async_optimizer_user *user, survive_optimizer
 
 	SurviveObject *so = d->opt.so;
 	struct SurviveContext *ctx = so->ctx;
+	const BaseStationData *bsd = user->bsd;
+	survive_get_bsd_snapshot(ctx, 0, ctx->activeLighthouses, user->bsd);
 
 	SurvivePose *soLocation = survive_optimizer_get_pose(mpfitctx);
 	survive_optimizer_setup_cameras(mpfitctx, so->ctx, true, d->use_jacobian_function_lh);
@@ -264,7 +291,7 @@ static int setup_optimizer(struct async_optimizer_user *user, survive_optimizer
 
 	bool worldEstablished = false;
 	for (int lh = 0; lh < ctx->activeLighthouses && !worldEstablished; lh++)
-		worldEstablished |= ctx->bsd[lh].PositionSet;
+		worldEstablished |= bsd[lh].PositionSet;
 
 	survive_optimizer_setup_pose(mpfitctx, 0, !worldEstablished, d->use_jacobian_function_obj);
 
@@ -276,13 +303,13 @@ static int setup_optimizer(struct async_optimizer_user *user, survive_optimizer
 		soLocation->Rot[0] = 1;
 
 	size_t meas_size =
-		construct_input_from_scene(d, pdl->hdr.timecode, scene, meas_for_lhs_axis, mpfitctx->measurements, user);
+		construct_input_from_scene(d, pdl->hdr.timecode, scene, bsd, meas_for_lhs_axis, mpfitctx->measurements, user);
 
 	if (mpfitctx->current_bias > 0) {
 		meas_size += 7;
 	}
 
-	if (worldEstablished && invalid_starting_condition(d, meas_size, meas_for_lhs_axis)) {
+	if (worldEstablished && invalid_starting_condition(d, bsd, meas_size, meas_for_lhs_axis)) {
 		return -1;
 	}
 
@@ -301,7 +328,7 @@ static int setup_optimizer(struct async_optimizer_user *user, survive_optimizer
 
 	if (bestObjForCal || (d->syncs_seen > syncs_required && objectStationary)) {
 		for (int lh = 0; lh < so->ctx->activeLighthouses; lh++) {
-			if (!so->ctx->bsd[lh].OOTXSet) {
+			if (!bsd[lh].OOTXSet) {
 				// Wait til this thing gets OOTX, and then solve for as much as we can. Avoids doing
 				// two solves in a row because of OOTX timing.
 				canPossiblySolveLHS = false;
@@ -309,11 +336,11 @@ static int setup_optimizer(struct async_optimizer_user *user, survive_optimizer
 			}
 
 			bool needsSolve =
-				!so->ctx->bsd[lh].PositionSet || (canPossiblySolveLHS == false && (so->ctx->bsd[lh].confidence) < 0);
+				!bsd[lh].PositionSet || (canPossiblySolveLHS == false && (bsd[lh].confidence) < 0);
 
 			if (needsSolve && has_data_for_lh(meas_for_lhs_axis, lh)) {
 				canPossiblySolveLHS = !d->globalDataAvailable;
-				needsInitialEstimate = !so->ctx->bsd[lh].PositionSet;
+				needsInitialEstimate = !bsd[lh].PositionSet;
 			}
 		}
 	}
@@ -322,10 +349,10 @@ static int setup_optimizer(struct async_optimizer_user *user, survive_optimizer
 	if (canPossiblySolveLHS) {
 		if (!needsInitialEstimate || general_optimizer_data_record_current_lhs(&d->opt, pdl, lhs)) {
 			for (int lh = 0; lh < so->ctx->activeLighthouses; lh++) {
-				bool needsSolve = !so->ctx->bsd[lh].PositionSet;
+				bool needsSolve = !bsd[lh].PositionSet;
 				if (needsSolve) {
-					if (so->ctx->bsd[lh].PositionSet) {
-						memcpy(&lhs[lh], &so->ctx->bsd[lh].Pose, sizeof(SurvivePose));
+					if (bsd[lh].PositionSet) {
+						memcpy(&lhs[lh], &bsd[lh].Pose, sizeof(SurvivePose));
 					}
 					assert(!isnan(lhs[lh].Rot[0]));
 					if (quatiszero(lhs[lh].Rot) && has_data_for_lh(meas_for_lhs_axis, lh)) {
@@ -342,7 +369,7 @@ static int setup_optimizer(struct async_optimizer_user *user, survive_optimizer
 
 	size_t skipped_lh_cnt = 0;
 	for (int lh = 0; lh < so->ctx->activeLighthouses; lh++) {
-		if (!so->ctx->bsd[lh].PositionSet) {
+		if (!bsd[lh].PositionSet) {
 			if (canPossiblySolveLHS) {
 				if (has_data_for_lh(meas_for_lhs_axis, lh)) {
 					SV_INFO("Attempting to solve for %d with %lu/%lu meas from device %s", lh,
@@ -445,7 +472,8 @@ static FLT handle_optimizer_results(survive_optimizer *mpfitctx, int res, const
 				if (has_data_for_lh(meas_for_lhs_axis, i) > 0 && !quatiszero(opt_cameras[i].Rot)) {
 					cameras[i] = InvertPoseRtn(&opt_cameras[i]);
 
-					LinmathPoint3d up = {ctx->bsd[i].accel[0], ctx->bsd[i].accel[1], ctx->bsd[i].accel[2]};
+					const int8_t *accel = user_data->bsd[i].accel;
+					LinmathPoint3d up = {accel[0], accel[1], accel[2]};
 					normalize3d(up, up);
 					LinmathPoint3d err;
 					quatrotatevector(err, cameras[i].Rot, up);
@@ -519,10 +547,10 @@ static void async_optimizer_cb(struct survive_async_optimizer_buffer *buffer, in
 	SurvivePose out = {0};
 	struct async_optimizer_user *user = buffer->user;
 
-	survive_get_ctx_lock(user->d->opt.so->ctx);
+	survive_get_so_lock(user->d->opt.so);
 	FLT error = handle_optimizer_results(&buffer->optimizer, res, result, user, &out);
 	handle_results(user->d, &user->pdl, error, &out);
-	survive_release_ctx_lock(user->d->opt.so->ctx);
+	survive_release_so_lock(user->d->opt.so);
 }
 
 typedef void (*handle_results_fn)(MPFITData *d, PoserDataLight *lightData, FLT error, SurvivePose *estimate);
@@ -542,7 +570,7 @@ static void run_mpfit_find_3d_structure_async(MPFITData *d, PoserDataLight *pdl,
 
 	struct async_optimizer_user *user_data = opt_buff->user;
 	if (user_data == 0) {
-		user_data = opt_buff->user = SV_CALLOC(sizeof(struct survive_async_optimizer));
+		user_data = opt_buff->user = SV_CALLOC(sizeof(struct async_optimizer_user));
 	}
 
 	user_data->d = d;
@@ -550,6 +578,7 @@ static void run_mpfit_find_3d_structure_async(MPFITData *d, PoserDataLight *pdl,
 
 	int setup_results = setup_optimizer(opt_buff->user, &opt_buff->optimizer, scene);
 	if (setup_results < 0) {
+		survive_async_optimizer_release(d->async_optimizer, opt_buff);
 		handle_results(d, pdl, -1, out);
 		return;
 	}
@@ -579,9 +608,9 @@ static FLT run_mpfit_find_3d_structure(MPFITData *d, PoserDataLight *pdl, Surviv
 
 	mp_result result = {0};
 
-	survive_release_ctx_lock(ctx);
+	uint32_t so_lock_depth = survive_poser_release_locks(so);
 	int res = survive_optimizer_run(&mpfitctx, &result);
-	survive_get_ctx_lock(ctx);
+	survive_poser_get_locks(so, so_lock_depth);
 
 	return handle_optimizer_results(&mpfitctx, res, &result, &user_data, out);
 }
@@ -663,10 +692,14 @@ void global_lh_pose(SurviveObject *so, uint8_t lighthouse, SurvivePose *lighthou
 	SV_VERBOSE(10, "Initial LH pose (%d) " SurvivePose_format, lighthouse, SURVIVE_POSE_EXPAND(*lighthouse_pose));
 }
 
-bool solve_global_scene(struct SurviveContext *ctx, PoserDataGlobalScenes *gss) {
+bool solve_global_scene(struct SurviveObject *so, MPFITData *d, PoserDataGlobalScenes *gss) {
+	struct SurviveContext *ctx = so->ctx;
 	if (gss->scenes_cnt == 0 || gss->scenes == 0)
 		return false;
 
+	BaseStationData bsd[NUM_GEN2_LIGHTHOUSES] = {0};
+	survive_get_bsd_snapshot(ctx, 0, ctx->activeLighthouses, bsd);
+
 	size_t meas_cnt = 0;
 	size_t scenes_cnt = gss->scenes_cnt;
 	for (int i = 0; i < scenes_cnt; i++) {
@@ -678,7 +711,10 @@ bool solve_global_scene(struct SurviveContext *ctx, PoserDataGlobalScenes *gss)
 								  .poseLength = scenes_cnt,
 								  .cameraLength = ctx->activeLighthouses,
 								  .measurementsCnt = meas_cnt,
-								  .nofilter = false};
+								  .nofilter = false,
+								  .backend = survive_configi(ctx, OPTIMIZER_SPARSE_TAG, SC_GET, 1)
+												 ? SURVIVE_OPTIMIZER_BACKEND_SPARSE_LM
+												 : SURVIVE_OPTIMIZER_BACKEND_MPFIT};
 
 	SURVIVE_OPTIMIZER_SETUP_STACK_BUFFERS(mpfitctx, 0);
 
@@ -718,14 +754,14 @@ bool solve_global_scene(struct SurviveContext *ctx, PoserDataGlobalScenes *gss)
 			survive_optimizer_fix_camera(&mpfitctx, i);
 		}
 
-		if (!ctx->bsd[i].PositionSet) {
+		if (!bsd[i].PositionSet) {
 			memset(survive_optimizer_get_camera(&mpfitctx)[i].Rot, 0, sizeof(FLT) * 4);
 		}
 	}
 
 	int worldEstablishedLh = -1;
 	for (int lh = 0; lh < ctx->activeLighthouses && worldEstablishedLh == -1; lh++)
-		if (ctx->bsd[lh].PositionSet)
+		if (bsd[lh].PositionSet)
 			worldEstablishedLh = lh;
 
 	int bestObjForCal = -1;
@@ -798,9 +834,10 @@ bool solve_global_scene(struct SurviveContext *ctx, PoserDataGlobalScenes *gss)
 	mp_result result = {0};
 	mpfitctx.cfg = survive_optimizer_precise_config();
 
-	survive_release_ctx_lock(ctx);
+	uint32_t so_lock_depth = survive_poser_release_locks(so);
 	int res = survive_optimizer_run(&mpfitctx, &result);
-	survive_get_ctx_lock(ctx);
+	survive_poser_get_locks(so, so_lock_depth);
+
 	bool status_failure = res <= 0;
 	if (status_failure || result.bestnorm > 1e-2) {
 		SV_WARN("MPFIT status failure %f/%f (%d measurements, %d, %s)", result.orignorm, result.bestnorm,
@@ -817,7 +854,7 @@ bool solve_global_scene(struct SurviveContext *ctx, PoserDataGlobalScenes *gss)
 			if (!quatiszero(opt_cameras[i].Rot) && lh_meas[i] > 0) {
 				cameras[i] = InvertPoseRtn(&opt_cameras[i]);
 
-				LinmathPoint3d up = {ctx->bsd[i].accel[0], ctx->bsd[i].accel[1], ctx->bsd[i].accel[2]};
+				LinmathPoint3d up = {bsd[i].accel[0], bsd[i].accel[1], bsd[i].accel[2]};
 				normalize3d(up, up);
 				LinmathPoint3d err;
 				quatrotatevector(err, cameras[i].Rot, up);
@@ -893,7 +930,9 @@ int PoserMPFIT(SurviveObject *so, void **user, PoserData *pd) {
 		d->syncs_per_run = survive_configi(ctx, "syncs-per-run", SC_GET, 1);
 		d->run_async = survive_configi(ctx, RUN_POSER_ASYNC_TAG, SC_GET, 0);
 		if (d->run_async) {
-			d->async_optimizer = SV_NEW(survive_async_optimizer, async_optimizer_cb);
+			d->async_optimizer = SV_NEW(survive_async_optimizer, async_optimizer_cb,
+										survive_configi(ctx, POSER_ASYNC_BUFFERS_TAG, SC_GET, 0),
+										survive_configi(ctx, POSER_ASYNC_THREADS_TAG, SC_GET, 1));
 		}
 		d->sensor_time_window = survive_configi(ctx, "time-window", SC_GET, SurviveSensorActivations_default_tolerance);
 		d->use_jacobian_function_obj = survive_configi(ctx, "use-jacobian-function", SC_GET, 1);
@@ -925,7 +964,7 @@ int PoserMPFIT(SurviveObject *so, void **user, PoserData *pd) {
 	case POSERDATA_GLOBAL_SCENES: {
 		d->globalDataAvailable = true;
 		PoserDataGlobalScenes *gs = (PoserDataGlobalScenes *)pd;
-		return solve_global_scene(ctx, gs) ? 0 : -1;
+		return solve_global_scene(so, d, gs) ? 0 : -1;
 	}
 	case POSERDATA_SYNC_GEN2:
 	case POSERDATA_SYNC: {
@@ -958,8 +997,22 @@ int PoserMPFIT(SurviveObject *so, void **user, PoserData *pd) {
 			print_stats(ctx, &d->stats);
 
 			if (d->async_optimizer) {
-				SV_INFO("\tjobs submitted     %lu", d->async_optimizer->submitted);
-				SV_INFO("\tjobs completed     %lu", d->async_optimizer->completed);
+				struct survive_async_optimizer *async = d->async_optimizer;
+				SV_INFO("\tjobs submitted     %lu", (unsigned long)async->submitted);
+				SV_INFO("\tjobs completed     %lu", (unsigned long)async->completed);
+				SV_INFO("\tjobs dropped       %lu", (unsigned long)async->dropped);
+				SV_INFO("\tjobs cancelled     %lu", (unsigned long)async->cancelled);
+				SV_INFO("\tjob latency:");
+				for (int i = 0; i < SURVIVE_ASYNC_OPTIMIZER_LATENCY_BUCKETS; i++) {
+					if (async->latency_histogram[i] == 0) {
+						continue;
+					}
+					if (i + 1 < SURVIVE_ASYNC_OPTIMIZER_LATENCY_BUCKETS) {
+						SV_INFO("\t\t< %5dms     %lu", 1 << i, (unsigned long)async->latency_histogram[i]);
+					} else {
+						SV_INFO("\t\t>= %4dms     %lu", 1 << (i - 1), (unsigned long)async->latency_histogram[i]);
+					}
+				}
 			}
 		}
 
@@ -213,10 +213,18 @@ SURVIVE_EXPORT int8_t survive_get_bsd_idx(SurviveContext *ctx, survive_channel c
 
 	if (ctx->lh_version == 0) {
 		if (ctx->bsd[channel].mode == 0xFF) {
-			ctx->bsd[channel] = (BaseStationData){0};
-			ctx->bsd[channel].mode = channel;
-			ctx->activeLighthouses++;
-			SV_INFO("Adding lighthouse ch %d (cnt: %d)", channel, ctx->activeLighthouses);
+			survive_get_bsd_lock(ctx);
+			// Another thread may have added this channel while we waited on the lock
+			bool added = ctx->bsd[channel].mode == 0xFF;
+			if (added) {
+				ctx->bsd[channel] = (BaseStationData){0};
+				ctx->bsd[channel].mode = channel;
+				ctx->activeLighthouses++;
+			}
+			int cnt = ctx->activeLighthouses;
+			survive_release_bsd_lock(ctx);
+			if (added)
+				SV_INFO("Adding lighthouse ch %d (cnt: %d)", channel, cnt);
 		}
 		return channel;
 	}
@@ -225,6 +233,13 @@ SURVIVE_EXPORT int8_t survive_get_bsd_idx(SurviveContext *ctx, survive_channel c
 	if (i != -1)
 		return i;
 
+	survive_get_bsd_lock(ctx);
+	// Another thread may have mapped this channel while we waited on the lock
+	if ((i = ctx->bsd_map[channel]) != -1) {
+		survive_release_bsd_lock(ctx);
+		return i;
+	}
+
 	for (i = 0; i < NUM_GEN2_LIGHTHOUSES; i++) {
 		if (ctx->bsd[i].mode == 0xFF) {
 			ctx->bsd[i] = (BaseStationData){0};
@@ -233,35 +248,141 @@ SURVIVE_EXPORT int8_t survive_get_bsd_idx(SurviveContext *ctx, survive_channel c
 				ctx->activeLighthouses = i + 1;
 			}
 			SV_INFO("Adding lighthouse ch %d (idx: %d, cnt: %d)", channel, i, ctx->activeLighthouses);
-			return ctx->bsd_map[channel] = i;
+			ctx->bsd_map[channel] = i;
+			survive_release_bsd_lock(ctx);
+			return i;
 		}
 	}
+	survive_release_bsd_lock(ctx);
 
 	return -1;
 }
 
 struct SurviveContext_private {
 	og_sema_t poll_sema;
+	// &ctx_lock_owner_tag of the thread holding poll_sema
+	const char *ctx_lock_owner;
+	og_mutex_t bsd_lock;
+	uint32_t ctx_lock_contentions, bsd_lock_contentions;
 	survive_run_time_fn runTimeFn;
 	void *runTimeFnUser;
 	double lastRunTime;
 
 	double callbackStatsTimeBetween;
 	double lastCallbackStats;
+
+	// Guards creating poser_pool; devices can be added from driver threads
+	og_mutex_t poser_pool_lock;
+	struct survive_threaded_poser_pool *poser_pool;
+
+	// Guards config_writer; held by whoever uses the writer so survive_close can't free it underneath them
+	og_mutex_t config_writer_lock;
+	struct survive_config_writer *config_writer;
+	// Set by survive_close so late saves are written right away instead of starting another writer
+	bool config_writer_closed;
 };
 
+// Only its address is used; it identifies the calling thread as the owner of the ctx lock
+static OG_THREAD_LOCAL char ctx_lock_owner_tag;
+
 void survive_get_ctx_lock(SurviveContext *ctx) {
 	struct SurviveContext_private *pctx = ctx->private_members;
 	// SV_VERBOSE(100, "Trying to get lock on %lx", pthread_self());
-	OGLockSema(pctx->poll_sema);
+	if (!OGTryLockSema(pctx->poll_sema)) {
+		OGLockSema(pctx->poll_sema);
+		pctx->ctx_lock_contentions++;
+	}
+	pctx->ctx_lock_owner = &ctx_lock_owner_tag;
 	// SV_VERBOSE(100, "Got lock on %lx", pthread_self());
 }
 void survive_release_ctx_lock(SurviveContext *ctx) {
 	struct SurviveContext_private *pctx = ctx->private_members;
 	// SV_VERBOSE(100, "Releasing lock on %lx", pthread_self());
+	pctx->ctx_lock_owner = 0;
 	OGUnlockSema(pctx->poll_sema);
 	// SV_VERBOSE(100, "Signaled on %lx", pthread_self());
 }
+static bool survive_holds_ctx_lock(SurviveContext *ctx) {
+	struct SurviveContext_private *pctx = ctx->private_members;
+	return pctx->ctx_lock_owner == &ctx_lock_owner_tag;
+}
+
+// Only its address is used; it identifies the calling thread as the owner of an object lock
+static OG_THREAD_LOCAL char so_lock_owner_tag;
+
+void survive_get_so_lock(SurviveObject *so) {
+	if (!OGTryLockMutex(so->object_lock)) {
+		OGLockMutex(so->object_lock);
+		so->stats.lock_contentions++;
+	}
+	so->object_lock_owner = &so_lock_owner_tag;
+	so->object_lock_depth++;
+}
+void survive_release_so_lock(SurviveObject *so) {
+	assert(so->object_lock_depth > 0);
+	assert(so->object_lock_owner == &so_lock_owner_tag);
+	if (--so->object_lock_depth == 0) {
+		so->object_lock_owner = 0;
+	}
+	OGUnlockMutex(so->object_lock);
+}
+uint32_t survive_held_so_lock_depth(const SurviveObject *so) {
+	return so->object_lock_owner == &so_lock_owner_tag ? so->object_lock_depth : 0;
+}
+
+void survive_get_bsd_lock(SurviveContext *ctx) {
+	struct SurviveContext_private *pctx = ctx->private_members;
+	if (!OGTryLockMutex(pctx->bsd_lock)) {
+		OGLockMutex(pctx->bsd_lock);
+		pctx->bsd_lock_contentions++;
+	}
+}
+void survive_release_bsd_lock(SurviveContext *ctx) {
+	struct SurviveContext_private *pctx = ctx->private_members;
+	OGUnlockMutex(pctx->bsd_lock);
+}
+void survive_get_bsd_snapshot(SurviveContext *ctx, uint8_t lh, uint8_t cnt, BaseStationData *bsd) {
+	assert(lh + cnt <= NUM_GEN2_LIGHTHOUSES);
+	survive_get_bsd_lock(ctx);
+	memcpy(bsd, ctx->bsd + lh, sizeof(BaseStationData) * cnt);
+	survive_release_bsd_lock(ctx);
+}
+
+struct survive_threaded_poser_pool *survive_get_threaded_poser_pool(SurviveContext *ctx) {
+	struct SurviveContext_private *pctx = ctx->private_members;
+	if (pctx == 0) {
+		return 0;
+	}
+
+	OGLockMutex(pctx->poser_pool_lock);
+	if (pctx->poser_pool == 0) {
+		pctx->poser_pool = survive_threaded_poser_pool_create(ctx);
+	}
+	struct survive_threaded_poser_pool *poser_pool = pctx->poser_pool;
+	OGUnlockMutex(pctx->poser_pool_lock);
+	return poser_pool;
+}
+
+struct survive_config_writer *survive_get_config_writer(SurviveContext *ctx, bool create) {
+	struct SurviveContext_private *pctx = ctx->private_members;
+	if (pctx == 0) {
+		return 0;
+	}
+
+	OGLockMutex(pctx->config_writer_lock);
+	if (create && pctx->config_writer == 0 && !pctx->config_writer_closed) {
+		pctx->config_writer = survive_config_writer_create(ctx);
+		// A zero interval means saving synchronously; don't look for a writer again
+		pctx->config_writer_closed = pctx->config_writer == 0;
+	}
+	return pctx->config_writer;
+}
+
+void survive_release_config_writer(SurviveContext *ctx) {
+	struct SurviveContext_private *pctx = ctx->private_members;
+	if (pctx)
+		OGUnlockMutex(pctx->config_writer_lock);
+}
 
 static inline bool find_correct_config_file(struct SurviveContext *ctx, const char **config_prefix_fields) {
 	for (const char **name = config_prefix_fields; *name; name++) {
@@ -311,6 +432,9 @@ SurviveContext *survive_init_internal(int argc, char *const *argv, void *userDat
 	struct SurviveContext_private *pctx = ctx->private_members = SV_CALLOC(sizeof(struct SurviveContext_private));
 
 	pctx->poll_sema = OGCreateSema();
+	pctx->bsd_lock = OGCreateMutex();
+	pctx->config_writer_lock = OGCreateMutex();
+	pctx->poser_pool_lock = OGCreateMutex();
 
 	for (int i = 0; i < NUM_GEN2_LIGHTHOUSES; i++) {
 		ctx->bsd[i].mode = -1;
@@ -629,7 +753,10 @@ int survive_startup(SurviveContext *ctx) {
 	bool use_async_posers = survive_configi(ctx, THREADED_POSERS_TAG, SC_GET, 0);
 	if (use_async_posers) {
 		for (int i = 0; i < ctx->objs_ct; i++) {
-			ctx->objs[i]->PoserFnData = survive_create_threaded_poser(ctx->objs[i], PreferredPoserCB);
+			// Default devices already set theirs up when they were created
+			if (ctx->objs[i]->PoserFnData == 0) {
+				ctx->objs[i]->PoserFnData = survive_create_threaded_poser(ctx->objs[i], PreferredPoserCB);
+			}
 		}
 		ctx->PoserFn = survive_threaded_poser_fn;
 	} else {
@@ -710,6 +837,9 @@ void survive_default_disconnect_process(struct SurviveObject *so) {
 void survive_default_new_object_process(SurviveObject *so) {}
 int survive_add_object(SurviveContext *ctx, SurviveObject *obj) {
 	SV_INFO("Adding tracked object %s from %s", survive_colorize(obj->codename), survive_colorize(obj->drivername));
+	if (obj->object_lock == 0) {
+		obj->object_lock = OGCreateMutex();
+	}
 	int oldct = ctx->objs_ct;
 	ctx->objs = SV_REALLOC(ctx->objs, sizeof(SurviveObject *) * (oldct + 1));
 	ctx->objs[oldct] = obj;
@@ -744,6 +874,7 @@ void survive_remove_object(SurviveContext *ctx, SurviveObject *obj) {
 	ctx->objs[ctx->objs_ct] = 0;
 
 	SV_INFO("Removing tracked object %s from %s", obj->codename, obj->drivername);
+	OGDeleteMutex(obj->object_lock);
 	free(obj);
 }
 
@@ -764,15 +895,23 @@ const void *survive_get_driver_by_closefn(const SurviveContext *ctx, DeviceDrive
 }
 
 void survive_reset_lighthouse_positions(SurviveContext *ctx) {
-	// survive_get_ctx_lock(ctx);
 	SV_VERBOSE(100, "survive_reset_lighthouse_positions called");
+	// Hooks like button already run under the ctx lock, and it isn't recursive
+	bool take_ctx_lock = !survive_holds_ctx_lock(ctx);
+	if (take_ctx_lock)
+		survive_get_ctx_lock(ctx);
+	survive_get_bsd_lock(ctx);
 	for (int i = 0; i < ctx->activeLighthouses; i++) {
 		ctx->bsd[i].PositionSet = false;
 	}
+	survive_release_bsd_lock(ctx);
 	for (int i = 0; i < ctx->objs_ct; i++) {
+		survive_get_so_lock(ctx->objs[i]);
 		survive_kalman_tracker_lost_tracking(ctx->objs[i]->tracker, false);
+		survive_release_so_lock(ctx->objs[i]);
 	}
-	// survive_release_ctx_lock(ctx);
+	if (take_ctx_lock)
+		survive_release_ctx_lock(ctx);
 }
 
 void survive_add_driver(SurviveContext *ctx, void *payload, DeviceDriverCb poll, DeviceDriverCb close) {
@@ -834,6 +973,10 @@ int survive_haptic(SurviveObject *so, FLT freq, FLT amp, FLT duration) {
 }
 
 void survive_output_callback_stats(SurviveContext *ctx) {
+	struct SurviveContext_private *pctx = ctx->private_members;
+	SV_VERBOSE(10, "Lock contention: ctx %u bsd %u", pctx->ctx_lock_contentions, pctx->bsd_lock_contentions);
+	pctx->ctx_lock_contentions = pctx->bsd_lock_contentions = 0;
+
 	SV_VERBOSE(10, "Callback statistics:");
 #define SURVIVE_HOOK_PROCESS_DEF(hook)                                                                                 \
 	SV_VERBOSE(10, "\t%-20s cnt: %5d avg time: %.7fms max time: %.7fms cnt over 1ms: %d(%.7f%%)", #hook,               \
@@ -852,11 +995,13 @@ void survive_close(SurviveContext *ctx) {
 
 	ctx->state = SURVIVE_CLOSING;
 
-	// unlock/ post to button service semaphore so the thread can kill itself
-	OGUnlockSema(ctx->buttonQueue.buttonservicesem);
-	OGJoinThread(ctx->buttonservicethread);
-	OGDeleteSema(ctx->buttonQueue.buttonservicesem);
-	ctx->buttonQueue.buttonservicesem = 0;
+	// unlock/ post to button service semaphore so the thread can kill itself. It only exists after survive_startup.
+	if (ctx->buttonservicethread) {
+		OGUnlockSema(ctx->buttonQueue.buttonservicesem);
+		OGJoinThread(ctx->buttonservicethread);
+		OGDeleteSema(ctx->buttonQueue.buttonservicesem);
+		ctx->buttonQueue.buttonservicesem = 0;
+	}
 
 	SV_VERBOSE(10, "Button events processed: %d", (int)ctx->buttonQueue.processed_events);
 
@@ -885,6 +1030,20 @@ void survive_close(SurviveContext *ctx) {
 	}
 	ctx->PoserFn = 0;
 
+	struct SurviveContext_private *pctx = ctx->private_members;
+	OGLockMutex(pctx->poser_pool_lock);
+	struct survive_threaded_poser_pool *poser_pool = pctx->poser_pool;
+	pctx->poser_pool = 0;
+	OGUnlockMutex(pctx->poser_pool_lock);
+	survive_threaded_poser_pool_free(poser_pool);
+
+	OGLockMutex(pctx->config_writer_lock);
+	struct survive_config_writer *config_writer = pctx->config_writer;
+	pctx->config_writer = 0;
+	pctx->config_writer_closed = true;
+	OGUnlockMutex(pctx->config_writer_lock);
+	survive_config_writer_free(config_writer);
+
 	config_save(ctx);
 
 	while (ctx->objs_ct) {
@@ -903,6 +1062,7 @@ void survive_close(SurviveContext *ctx) {
 		
 	destroy_config_group(ctx->global_config_values);
 	destroy_config_group(ctx->temporary_config_values);
+	survive_optimizer_forget_context(ctx);
 
 	for (int lh = 0; lh < NUM_GEN2_LIGHTHOUSES; lh++) {
 		ootx_decoder_context *decoderContext = ctx->bsd[lh].ootx_data;
@@ -913,8 +1073,10 @@ void survive_close(SurviveContext *ctx) {
 		destroy_config_group(ctx->lh_config + lh);
 	}
 
-	struct SurviveContext_private *pctx = ctx->private_members;
 	OGDeleteSema(pctx->poll_sema);
+	OGDeleteMutex(pctx->bsd_lock);
+	OGDeleteMutex(pctx->config_writer_lock);
+	OGDeleteMutex(pctx->poser_pool_lock);
 	free(pctx);
 
 	free(ctx->objs);
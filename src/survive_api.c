@@ -428,8 +428,11 @@ FLT survive_simple_object_get_latest_pose(const SurviveSimpleObject *sao, Surviv
 
 	switch (sao->type) {
 	case SurviveSimpleObject_LIGHTHOUSE: {
+		// poll_mutex -> bsd is the same order lh_fn takes them in
+		BaseStationData bsd;
+		survive_get_bsd_snapshot(sao->actx->ctx, sao->data.lh.lighthouse, 1, &bsd);
 		if (pose)
-			*pose = sao->actx->ctx->bsd[sao->data.lh.lighthouse].Pose;
+			*pose = bsd.Pose;
 		timecode = OGStartTimeS();
 		break;
 	}
@@ -1,68 +1,205 @@
 #include "survive_async_optimizer.h"
 
-static void run_buffer(survive_async_optimizer *self, uint8_t idx) {
-	struct mp_result_struct results = {0};
-	self->active_buffer = idx;
-	OGUnlockMutex(self->active_buffer_lock);
-	self->completed++;
-	int status = survive_optimizer_run(&self->buffers[idx].optimizer, &results);
-	if (self->cb) {
-		self->cb(&self->buffers[idx], status, &results);
-	}
-	OGLockMutex(self->active_buffer_lock);
-	self->buffer_ready[idx] = false;
-	self->active_buffer = -1;
+static void record_latency(struct survive_async_optimizer *self, double latency) {
+	double ms = latency * 1000.;
+	size_t bucket = 0;
+	while (bucket + 1 < SURVIVE_ASYNC_OPTIMIZER_LATENCY_BUCKETS && ms >= (double)(1u << bucket)) {
+		bucket++;
+	}
+	self->latency_histogram[bucket]++;
+}
+
+// Called with the lock held. Picks the newest queued job and drops everything queued before it.
+static survive_async_optimizer_buffer *next_job(struct survive_async_optimizer *self) {
+	survive_async_optimizer_buffer *rtn = 0;
+	for (size_t i = 0; i < self->buffer_cnt; i++) {
+		survive_async_optimizer_buffer *buffer = &self->buffers[i];
+		if (buffer->state == SURVIVE_ASYNC_OPTIMIZER_BUFFER_QUEUED && (rtn == 0 || buffer->sequence > rtn->sequence)) {
+			rtn = buffer;
+		}
+	}
+
+	if (rtn == 0) {
+		return 0;
+	}
+
+	bool freed_buffers = false;
+	for (size_t i = 0; i < self->buffer_cnt; i++) {
+		survive_async_optimizer_buffer *buffer = &self->buffers[i];
+		if (buffer->state == SURVIVE_ASYNC_OPTIMIZER_BUFFER_QUEUED && buffer->sequence < rtn->sequence) {
+			buffer->state = SURVIVE_ASYNC_OPTIMIZER_BUFFER_FREE;
+			self->dropped++;
+			freed_buffers = true;
+		}
+	}
+	if (freed_buffers) {
+		OGBroadcastCond(self->buffer_available);
+	}
+
+	rtn->state = SURVIVE_ASYNC_OPTIMIZER_BUFFER_RUNNING;
+	return rtn;
+}
+
+static bool deliver(struct survive_async_optimizer *self, survive_async_optimizer_buffer *buffer, int status,
+					struct mp_result_struct *results) {
+	if (status == SURVIVE_OPTIMIZER_CANCELLED) {
+		return false;
+	}
+
+	bool rtn = false;
+	OGLockMutex(self->callback_lock);
+	// A newer job beat this one to the callback; its result is stale now
+	if (buffer->sequence > self->last_delivered_sequence) {
+		self->last_delivered_sequence = buffer->sequence;
+		if (self->cb) {
+			self->cb(buffer, status, results);
+		}
+		rtn = true;
+	}
+	OGUnlockMutex(self->callback_lock);
+	return rtn;
 }
 
 static void *async_thread(void *param) {
 	survive_async_optimizer *self = param;
-	OGLockMutex(self->active_buffer_lock);
-	while (self->cb) {
-		for (uint8_t i = 0; i < 2; i++) {
-			if (self->buffer_ready[i]) {
-				run_buffer(self, i);
+	OGLockMutex(self->lock);
+	while (self->running) {
+		survive_async_optimizer_buffer *buffer = next_job(self);
+		if (buffer == 0) {
+			OGWaitCond(self->job_available, self->lock);
+			continue;
+		}
+		OGUnlockMutex(self->lock);
+
+		struct mp_result_struct results = {0};
+		int status = survive_optimizer_run(&buffer->optimizer, &results);
+		bool delivered = deliver(self, buffer, status, &results);
+
+		OGLockMutex(self->lock);
+		if (delivered) {
+			self->completed++;
+			record_latency(self, OGGetAbsoluteTime() - buffer->submit_time);
+
+			// Anything older that is still running can't be delivered anymore
+			for (size_t i = 0; i < self->buffer_cnt; i++) {
+				survive_async_optimizer_buffer *other = &self->buffers[i];
+				if (other->state == SURVIVE_ASYNC_OPTIMIZER_BUFFER_RUNNING && other->sequence < buffer->sequence) {
+					other->optimizer.cancelled = true;
+				}
 			}
+		} else {
+			self->cancelled++;
 		}
 
-		OGWaitCond(self->job_available, self->active_buffer_lock);
+		buffer->state = SURVIVE_ASYNC_OPTIMIZER_BUFFER_FREE;
+		OGBroadcastCond(self->buffer_available);
 	}
 
-	OGUnlockMutex(self->active_buffer_lock);
+	OGUnlockMutex(self->lock);
 	return 0;
 }
 
 struct survive_async_optimizer *survive_async_optimizer_init(struct survive_async_optimizer *self,
-															 survive_async_optimizer_cb cb) {
+															 survive_async_optimizer_cb cb, size_t buffer_cnt,
+															 size_t thread_cnt) {
+	if (thread_cnt < 1) {
+		thread_cnt = 1;
+	}
+	if (buffer_cnt < thread_cnt + 1) {
+		buffer_cnt = thread_cnt + 1;
+	}
+
 	self->cb = cb;
-	self->active_buffer = -1;
-	self->active_buffer_lock = OGCreateMutex();
+	self->running = true;
+	self->lock = OGCreateMutex();
+	self->callback_lock = OGCreateMutex();
 	self->job_available = OGCreateConditionVariable();
+	self->buffer_available = OGCreateConditionVariable();
+
+	self->buffer_cnt = buffer_cnt;
+	self->buffers = SV_CALLOC_N(buffer_cnt, sizeof(survive_async_optimizer_buffer));
 
-	self->async_thread = OGCreateThread(async_thread, "async optimizer", self);
+	self->thread_cnt = thread_cnt;
+	self->threads = SV_CALLOC_N(thread_cnt, sizeof(og_thread_t));
+	for (size_t i = 0; i < thread_cnt; i++) {
+		self->threads[i] = OGCreateThread(async_thread, "async optimizer", self);
+	}
 	return self;
 }
 
 survive_async_optimizer_buffer *survive_async_optimizer_alloc_optimizer(struct survive_async_optimizer *self) {
-	OGLockMutex(self->active_buffer_lock);
+	OGLockMutex(self->lock);
 	survive_async_optimizer_buffer *rtn = 0;
-	if (self->active_buffer == 0) {
-		rtn = &self->buffers[1];
-		self->buffer_ready[1] = false;
-	} else {
-		rtn = &self->buffers[0];
-		self->buffer_ready[0] = false;
+	while (rtn == 0) {
+		for (size_t i = 0; i < self->buffer_cnt && rtn == 0; i++) {
+			if (self->buffers[i].state == SURVIVE_ASYNC_OPTIMIZER_BUFFER_FREE) {
+				rtn = &self->buffers[i];
+			}
+		}
+
+		// Nothing free; take over the oldest job that hasn't started yet
+		if (rtn == 0) {
+			for (size_t i = 0; i < self->buffer_cnt; i++) {
+				survive_async_optimizer_buffer *buffer = &self->buffers[i];
+				if (buffer->state == SURVIVE_ASYNC_OPTIMIZER_BUFFER_QUEUED &&
+					(rtn == 0 || buffer->sequence < rtn->sequence)) {
+					rtn = buffer;
+				}
+			}
+			if (rtn) {
+				self->dropped++;
+			}
+		}
+
+		// Only reachable when several callers are filling buffers at once
+		if (rtn == 0) {
+			OGWaitCond(self->buffer_available, self->lock);
+		}
 	}
-	self->submitted++;
-	OGUnlockMutex(self->active_buffer_lock);
+
+	rtn->state = SURVIVE_ASYNC_OPTIMIZER_BUFFER_FILLING;
+	rtn->optimizer.cancelled = false;
+	OGUnlockMutex(self->lock);
 	return rtn;
 }
 
 void survive_async_optimizer_run(struct survive_async_optimizer *self, survive_async_optimizer_buffer *opt) {
-	OGLockMutex(self->active_buffer_lock);
-	uint8_t idx = opt == &self->buffers[0] ? 0 : 1;
-	self->buffer_ready[idx] = true;
+	OGLockMutex(self->lock);
+	opt->state = SURVIVE_ASYNC_OPTIMIZER_BUFFER_QUEUED;
+	opt->sequence = ++self->next_sequence;
+	opt->submit_time = OGGetAbsoluteTime();
+	self->submitted++;
+
+	// With every worker busy, the oldest running job is superseded by the newer ones already in flight. Cancel it so
+	// its worker can pick this one up; the newest running job is never cancelled here so something always finishes.
+	survive_async_optimizer_buffer *oldest = 0, *newest = 0;
+	size_t running_cnt = 0;
+	for (size_t i = 0; i < self->buffer_cnt; i++) {
+		survive_async_optimizer_buffer *buffer = &self->buffers[i];
+		if (buffer->state != SURVIVE_ASYNC_OPTIMIZER_BUFFER_RUNNING) {
+			continue;
+		}
+		running_cnt++;
+		if (newest == 0 || buffer->sequence > newest->sequence) {
+			newest = buffer;
+		}
+		if (!buffer->optimizer.cancelled && (oldest == 0 || buffer->sequence < oldest->sequence)) {
+			oldest = buffer;
+		}
+	}
+	if (running_cnt >= self->thread_cnt && oldest && oldest != newest) {
+		oldest->optimizer.cancelled = true;
+	}
+
 	OGSignalCond(self->job_available);
-	OGUnlockMutex(self->active_buffer_lock);
+	OGUnlockMutex(self->lock);
+}
+
+void survive_async_optimizer_release(struct survive_async_optimizer *self, survive_async_optimizer_buffer *opt) {
+	OGLockMutex(self->lock);
+	opt->state = SURVIVE_ASYNC_OPTIMIZER_BUFFER_FREE;
+	OGBroadcastCond(self->buffer_available);
+	OGUnlockMutex(self->lock);
 }
 
 void survive_async_free(struct survive_async_optimizer *self) {
@@ -70,20 +207,31 @@ void survive_async_free(struct survive_async_optimizer *self) {
 		return;
 	}
 
-	OGLockMutex(self->active_buffer_lock);
-	self->cb = 0;
-	OGSignalCond(self->job_available);
-	OGUnlockMutex(self->active_buffer_lock);
+	OGLockMutex(self->lock);
+	self->running = false;
+	for (size_t i = 0; i < self->buffer_cnt; i++) {
+		if (self->buffers[i].state == SURVIVE_ASYNC_OPTIMIZER_BUFFER_RUNNING) {
+			self->buffers[i].optimizer.cancelled = true;
+		}
+	}
+	OGBroadcastCond(self->job_available);
+	OGUnlockMutex(self->lock);
 
-	OGJoinThread(self->async_thread);
+	for (size_t i = 0; i < self->thread_cnt; i++) {
+		OGJoinThread(self->threads[i]);
+	}
 
 	OGDeleteConditionVariable(self->job_available);
-	OGDeleteMutex(self->active_buffer_lock);
+	OGDeleteConditionVariable(self->buffer_available);
+	OGDeleteMutex(self->lock);
+	OGDeleteMutex(self->callback_lock);
 
-	for (int i = 0; i < 2; i++) {
+	for (size_t i = 0; i < self->buffer_cnt; i++) {
 		SURVIVE_OPTIMIZER_CLEANUP_HEAP_BUFFERS(self->buffers[i].optimizer);
 		free(self->buffers[i].user);
 	}
 
+	free(self->threads);
+	free(self->buffers);
 	free(self);
 }
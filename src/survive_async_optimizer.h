@@ -3,36 +3,74 @@
 #include <survive_optimizer.h>
 #include <survive_types.h>
 
+typedef enum {
+	SURVIVE_ASYNC_OPTIMIZER_BUFFER_FREE = 0,
+	// Handed out by survive_async_optimizer_alloc_optimizer and being filled in by the caller
+	SURVIVE_ASYNC_OPTIMIZER_BUFFER_FILLING,
+	SURVIVE_ASYNC_OPTIMIZER_BUFFER_QUEUED,
+	SURVIVE_ASYNC_OPTIMIZER_BUFFER_RUNNING,
+} survive_async_optimizer_buffer_state;
+
 typedef struct survive_async_optimizer_buffer {
 	survive_optimizer optimizer;
 	void *user;
+
+	survive_async_optimizer_buffer_state state;
+	uint64_t sequence;
+	double submit_time;
 } survive_async_optimizer_buffer;
 
 typedef void (*survive_async_optimizer_cb)(struct survive_async_optimizer_buffer *buffer, int return_code,
 										   struct mp_result_struct *result);
 
+// Bucket i counts jobs whose submit to callback latency was under 2^i ms; the last bucket takes everything else
+#define SURVIVE_ASYNC_OPTIMIZER_LATENCY_BUCKETS 12
+
+/**
+ * Runs optimizers on a set of worker threads. Newer jobs always win: workers take the most recently submitted job,
+ * queued jobs older than one that was started are dropped, and a running job is cancelled once a newer job has
+ * delivered its result or, when every worker is busy, once a newer job is already running. Results are handed to
+ * the callback strictly in submission order.
+ */
 typedef struct survive_async_optimizer {
 	survive_async_optimizer_cb cb;
 	void *user;
 
-	og_thread_t async_thread;
-
-	int8_t active_buffer;
-	bool buffer_ready[2];
-	struct survive_async_optimizer_buffer buffers[2];
-	og_mutex_t active_buffer_lock;
+	size_t thread_cnt;
+	og_thread_t *threads;
 
+	size_t buffer_cnt;
+	struct survive_async_optimizer_buffer *buffers;
+	og_mutex_t lock;
 	og_cv_t job_available;
+	og_cv_t buffer_available;
+	bool running;
+
+	// Serializes callbacks so that the ordering check and the callback itself happen atomically
+	og_mutex_t callback_lock;
+	uint64_t next_sequence;
+	uint64_t last_delivered_sequence;
 
 	size_t submitted;
 	size_t completed;
+	size_t dropped;
+	size_t cancelled;
+	size_t latency_histogram[SURVIVE_ASYNC_OPTIMIZER_LATENCY_BUCKETS];
 } survive_async_optimizer;
 
+/**
+ * Creates an async optimizer with `thread_cnt` workers and `buffer_cnt` job buffers. There is always at least one
+ * worker and at least one more buffer than there are workers.
+ */
 SURVIVE_EXPORT struct survive_async_optimizer *survive_async_optimizer_init(struct survive_async_optimizer *self,
-																			survive_async_optimizer_cb cb);
+																			survive_async_optimizer_cb cb,
+																			size_t buffer_cnt, size_t thread_cnt);
 SURVIVE_EXPORT void survive_async_free(struct survive_async_optimizer *optimizer);
 
 SURVIVE_EXPORT survive_async_optimizer_buffer *
 survive_async_optimizer_alloc_optimizer(struct survive_async_optimizer *optimizer);
 SURVIVE_EXPORT void survive_async_optimizer_run(struct survive_async_optimizer *optimizer,
 												survive_async_optimizer_buffer *);
+// Hands back a buffer from survive_async_optimizer_alloc_optimizer that isn't going to be run after all
+SURVIVE_EXPORT void survive_async_optimizer_release(struct survive_async_optimizer *optimizer,
+													survive_async_optimizer_buffer *);
@@ -30,17 +30,31 @@ struct static_conf_t
 	char type;
 
 	struct static_conf_t *next;
+	struct static_conf_t *bucket_next;
 };
 
 static struct static_conf_t *head = 0;
 static struct static_conf_t *tail = 0;
 
+// Tags are looked up by name on every survive_config* call, so both the static registry and the config groups keep a
+// hash index next to their lists
+static inline uint32_t config_tag_hash(const char *tag) {
+	uint32_t hash = 2166136261u;
+	for (const unsigned char *c = (const unsigned char *)tag; *c; c++) {
+		hash = (hash ^ *c) * 16777619u;
+	}
+	return hash;
+}
+
+#define STATIC_CONF_BUCKETS 256
+static struct static_conf_t *static_conf_buckets[STATIC_CONF_BUCKETS];
+
 static struct static_conf_t *find_static_conf_t(const char *name) {
-	struct static_conf_t *curr = head;
+	struct static_conf_t *curr = static_conf_buckets[config_tag_hash(name) % STATIC_CONF_BUCKETS];
 	while (curr) {
 		if (strcmp(curr->name, name) == 0)
 			break;
-		curr = curr->next;
+		curr = curr->bucket_next;
 	}
 
 	return curr;
@@ -60,6 +74,10 @@ static struct static_conf_t *find_or_create_conf_t(const char *name) {
 		head = curr;
 
 	tail = curr;
+
+	struct static_conf_t **bucket = &static_conf_buckets[config_tag_hash(name) % STATIC_CONF_BUCKETS];
+	curr->bucket_next = *bucket;
+	*bucket = curr;
 	return curr;
 }
 
@@ -133,7 +151,7 @@ static void PrintConfigGroup(config_group * grp, const char ** chkval, int * cvs
 	int i, j;
 	for( i = 0; i < grp->used_entries; i++ )
 	{
-		config_entry * ce = &grp->config_entries[i];
+		config_entry * ce = grp->config_entries[i];
 		for( j = 0; j < *cvs; j++ )
 		{
 			if( strcmp( chkval[j], ce->tag ) == 0 ) break;
@@ -267,16 +285,13 @@ void init_config_group(config_group *cg, uint8_t count, SurviveContext * ctx) {
 	cg->used_entries = 0;
 	cg->max_entries = count;
 	cg->config_entries = NULL;
+	cg->index = NULL;
 	cg->ctx = ctx;
 
 	if (count == 0)
 		return;
 
-	cg->config_entries = SV_MALLOC(count * sizeof(config_entry));
-
-	for (i = 0; i < count; ++i) {
-		init_config_entry(cg->config_entries + i);
-	}
+	cg->config_entries = SV_CALLOC_N(count, sizeof(config_entry *));
 }
 
 void destroy_config_group(config_group *cg) {
@@ -284,27 +299,27 @@ void destroy_config_group(config_group *cg) {
 	if (cg->config_entries == NULL)
 		return;
 
-	cg->used_entries = 0;
-	for (i = 0; i < cg->max_entries; ++i) {
-		destroy_config_entry(cg->config_entries + i);
+	for (i = 0; i < cg->used_entries; ++i) {
+		destroy_config_entry(cg->config_entries[i]);
+		free(cg->config_entries[i]);
 	}
+	cg->used_entries = 0;
 	OGDeleteMutex(cg->write_lock);
 	free(cg->config_entries);
+	for (config_index *index = cg->index; index;) {
+		config_index *retired = index->retired;
+		free(index);
+		index = retired;
+	}
+	cg->index = NULL;
 }
 
 void resize_config_group(config_group *cg, uint16_t count) {
-	uint16_t i = 0;
-
 	if (count > cg->max_entries) {
-		config_entry *ptr = SV_REALLOC(cg->config_entries, sizeof(config_entry) * count);
+		config_entry **ptr = SV_REALLOC(cg->config_entries, sizeof(config_entry *) * count);
 		assert(ptr != NULL);
 
 		cg->config_entries = ptr;
-
-		for (i = cg->max_entries; i < count; ++i) {
-			init_config_entry(cg->config_entries + i);
-		}
-
 		cg->max_entries = count;
 	}
 }
@@ -439,21 +454,56 @@ static void config_group_unlock(config_group *cg) {
 	OGUnlockMutex(cg->write_lock);
 }
 
+// The release store publishes the entry's tag along with the slot
+static void config_index_insert(config_index *index, config_entry *entry) {
+	uint16_t mask = index->size - 1;
+	for (uint16_t i = config_tag_hash(entry->tag) & mask;; i = (i + 1) & mask) {
+		if (index->slots[i] == 0) {
+			OGAtomicStoreReleasePtr((void *volatile *)&index->slots[i], entry);
+			return;
+		}
+	}
+}
+
+// Keeps the index at most half full so probe chains stay short; returns whether it published a new one. Called with
+// the group lock held.
+static bool config_group_reindex(config_group *cg, uint16_t entry_cnt) {
+	config_index *old = cg->index;
+	if (old != 0 && entry_cnt * 2 <= old->size)
+		return false;
+
+	uint16_t size = old ? old->size : 32;
+	while (entry_cnt * 2 > size)
+		size *= 2;
+
+	config_index *index = SV_CALLOC(sizeof(config_index) + size * sizeof(config_entry *));
+	index->size = size;
+	index->retired = old;
+	for (uint16_t i = 0; i < cg->used_entries; i++) {
+		config_index_insert(index, cg->config_entries[i]);
+	}
+	OGAtomicStoreReleasePtr((void *volatile *)&cg->index, index);
+	return true;
+}
+
+// Lock free; see config_index. Entries are found once their index slot is published and are never removed.
 config_entry *find_config_entry(config_group *cg, const char *tag) {
 	if (cg == NULL || tag == NULL) {
 		return NULL;
 	}
 
-	OGLockMutex(cg->write_lock);
-	uint16_t i = 0;
-	for (i = 0; i < cg->used_entries; ++i) {
-		if (strcmp(cg->config_entries[i].tag, tag) == 0) {
-			config_group_unlock(cg);
-			return cg->config_entries + i;
-		}
+	config_index *index = OGAtomicLoadAcquirePtr((void *volatile *)&cg->index);
+	if (index == 0)
+		return NULL;
+
+	uint16_t mask = index->size - 1;
+	for (uint16_t i = config_tag_hash(tag) & mask;; i = (i + 1) & mask) {
+		config_entry *entry = OGAtomicLoadAcquirePtr((void *volatile *)&index->slots[i]);
+		if (entry == 0)
+			return NULL;
+		if (strcmp(entry->tag, tag) == 0)
+			return entry;
 	}
-	config_group_unlock(cg);
-	return NULL;
 }
 
 const char *config_read_str(config_group *cg, const char *tag, const char *def) {
@@ -506,20 +556,28 @@ uint16_t config_read_float_array(config_group *cg, const char *tag, FLT *values,
 	return count;
 }
 
+// Allocates an entry for tag. It only becomes part of the group through config_group_add_entry, which the setters call
+// once its value and type are set, since find_config_entry doesn't take the lock.
 config_entry *next_unused_entry(config_group *cg, const char * tag) {
 	config_entry *cv = NULL;
-	//	assert(cg->used_entries < cg->max_entries);
 	if (cg == NULL)
 		return NULL;
 
+	cv = SV_MALLOC(sizeof(config_entry));
+	init_config_entry(cv);
+	sstrcpy(&(cv->tag), tag);
+	return cv;
+}
+
+static void config_group_add_entry(config_group *cg, config_entry *cv) {
 	if (cg->used_entries >= cg->max_entries)
 		resize_config_group(cg, cg->max_entries + 10);
 
-	cv = cg->config_entries + cg->used_entries;
-
-	cg->used_entries++;
+	cg->config_entries[cg->used_entries++] = cv;
 
-	return cv;
+	// The tag is never rewritten after this, since readers compare against it without the lock
+	if (!config_group_reindex(cg, cg->used_entries))
+		config_index_insert(cg->index, cv);
 }
 
 const char *config_set_str(config_group *cg, const char *tag, const char *value) {
@@ -529,17 +587,18 @@ const char *config_set_str(config_group *cg, const char *tag, const char *value)
 	OGLockMutex(cg->write_lock);
 
 	config_entry *cv = find_config_entry(cg, tag);
-	if (cv == NULL)
+	bool added = cv == NULL;
+	if (added)
 		cv = next_unused_entry(cg,tag);
 
-	sstrcpy(&(cv->tag), tag);
-
 	if (NULL != value) {
 		sstrcpy(&(cv->data), value);
 	} else {
 		sstrcpy(&(cv->data), "");
 	}
 	cv->type = CONFIG_STRING;
+	if (added)
+		config_group_add_entry(cg, cv);
 
 	update_list_t * t = cv->update_list;
 	while( t ) { *((const char **)t->value) = value; t = t->next; }
@@ -551,7 +610,8 @@ const char *config_set_str(config_group *cg, const char *tag, const char *value)
 uint32_t config_set_uint32(config_group *cg, const char *tag, const uint32_t value) {
 	config_group_lock(cg);
 	config_entry *cv = find_config_entry(cg, tag);
-	if (cv == NULL)
+	bool added = cv == NULL;
+	if (added)
 		cv = next_unused_entry(cg,tag);
 
 	if (cv == NULL) {
@@ -559,9 +619,10 @@ uint32_t config_set_uint32(config_group *cg, const char *tag, const uint32_t val
 		return value;
 	}
 
-	sstrcpy(&(cv->tag), tag);
 	cv->numeric.i = value;
 	cv->type = CONFIG_UINT32;
+	if (added)
+		config_group_add_entry(cg, cv);
 
 	update_list_t * t = cv->update_list;
 	while( t ) { *((uint32_t*)t->value) = value; t = t->next; }
@@ -576,14 +637,15 @@ FLT config_set_float(config_group *cg, const char *tag, const FLT value) {
 
 	config_group_lock(cg);
 	config_entry *cv = find_config_entry(cg, tag);
-	if (cv == NULL)
+	bool added = cv == NULL;
+	if (added)
 		cv = next_unused_entry(cg,tag);
 
-	sstrcpy(&(cv->tag), tag);
 	cv->numeric.f = value;
 	cv->type = CONFIG_FLOAT;
+	if (added)
+		config_group_add_entry(cg, cv);
 
-	
 	update_list_t * t = cv->update_list;
 	while( t ) { *((FLT*)t->value) = value; t = t->next; }
 	config_group_unlock(cg);
@@ -594,11 +656,10 @@ FLT config_set_float(config_group *cg, const char *tag, const FLT value) {
 const FLT *config_set_float_a(config_group *cg, const char *tag, const FLT *values, uint8_t count) {
 	config_group_lock(cg);
 	config_entry *cv = find_config_entry(cg, tag);
-	if (cv == NULL)
+	bool added = cv == NULL;
+	if (added)
 		cv = next_unused_entry(cg,tag);
 
-	sstrcpy(&(cv->tag), tag);
-
 	char *ptr = (char *)SV_REALLOC(cv->data, sizeof(FLT) * count);
 	assert(ptr != NULL);
 	cv->data = ptr;
@@ -606,6 +667,8 @@ const FLT *config_set_float_a(config_group *cg, const char *tag, const FLT *valu
 	memcpy(cv->data, values, sizeof(FLT) * count);
 	cv->type = CONFIG_FLOAT_ARRAY;
 	cv->elements = count;
+	if (added)
+		config_group_add_entry(cg, cv);
 
 	config_group_unlock(cg);
 	return values;
@@ -627,15 +690,15 @@ void write_config_group(FILE *f, config_group *cg, char *tag) {
 	}
 
 	for (i = 0; i < cg->used_entries; ++i) {
-		if (cg->config_entries[i].type == CONFIG_FLOAT) {
-			json_write_float(f, cg->config_entries[i].tag, (float)cg->config_entries[i].numeric.f);
-		} else if (cg->config_entries[i].type == CONFIG_UINT32) {
-			json_write_uint32(f, cg->config_entries[i].tag, cg->config_entries[i].numeric.i);
-		} else if (cg->config_entries[i].type == CONFIG_STRING) {
-			json_write_str(f, cg->config_entries[i].tag, cg->config_entries[i].data);
-		} else if (cg->config_entries[i].type == CONFIG_FLOAT_ARRAY) {
-			_json_write_float_array(f, cg->config_entries[i].tag, (FLT *)cg->config_entries[i].data,
-									cg->config_entries[i].elements);
+		if (cg->config_entries[i]->type == CONFIG_FLOAT) {
+			json_write_float(f, cg->config_entries[i]->tag, (float)cg->config_entries[i]->numeric.f);
+		} else if (cg->config_entries[i]->type == CONFIG_UINT32) {
+			json_write_uint32(f, cg->config_entries[i]->tag, cg->config_entries[i]->numeric.i);
+		} else if (cg->config_entries[i]->type == CONFIG_STRING) {
+			json_write_str(f, cg->config_entries[i]->tag, cg->config_entries[i]->data);
+		} else if (cg->config_entries[i]->type == CONFIG_FLOAT_ARRAY) {
+			_json_write_float_array(f, cg->config_entries[i]->tag, (FLT *)cg->config_entries[i]->data,
+									cg->config_entries[i]->elements);
 		}
 		if ((i + 1) < cg->used_entries)
 			fprintf(f, ",");
@@ -681,11 +744,84 @@ const char *survive_config_file_path(struct SurviveContext *ctx, char *path) {
 
 // struct SurviveContext
 SurviveContext *survive_context;
-void config_save(SurviveContext *ctx) {
+
+STATIC_CONFIG_ITEM(CONFIG_SAVE_INTERVAL, "config-save-interval", 'f',
+				   "Minimum seconds between writes of the config file; changes made in between are written together. 0 "
+				   "writes from the calling thread instead",
+				   1.)
+
+/*
+ * Saving rewrites the whole config file, and lighthouse poses and OOTX data get saved from the tracking path with the
+ * bsd lock held. config_save_async only wakes the writer thread, which then waits until config-save-interval seconds
+ * have passed since its last write, so a burst of changes during calibration becomes one write.
+ */
+struct survive_config_writer {
+	SurviveContext *ctx;
+	og_thread_t thread;
+	// Held while the file is written so synchronous saves and the writer thread don't interleave
+	og_mutex_t file_lock;
+	// Posted for every save request and once more to stop the thread
+	og_sema_t wakeup;
+	volatile bool keep_running;
+	FLT interval;
+	uint32_t requests, writes;
+};
+
+// Copies what write_config_group needs, so the file is written without holding the group lock
+static void config_group_snapshot(config_group *dst, config_group *src) {
+	config_group_lock(src);
+	dst->used_entries = dst->max_entries = src->used_entries;
+	dst->config_entries = SV_CALLOC_N(src->used_entries + 1, sizeof(config_entry *));
+	for (uint16_t i = 0; i < src->used_entries; i++) {
+		const config_entry *from = src->config_entries[i];
+		config_entry *to = dst->config_entries[i] = SV_CALLOC(sizeof(config_entry));
+		sstrcpy(&to->tag, from->tag);
+		to->type = from->type;
+		to->numeric = from->numeric;
+		to->elements = from->elements;
+		if (from->type == CONFIG_FLOAT_ARRAY) {
+			to->data = SV_MALLOC(sizeof(FLT) * from->elements + 1);
+			memcpy(to->data, from->data, sizeof(FLT) * from->elements);
+		} else if (from->data) {
+			sstrcpy(&to->data, from->data);
+		}
+	}
+	config_group_unlock(src);
+}
+
+static void config_group_snapshot_free(config_group *cg) {
+	for (uint16_t i = 0; i < cg->used_entries; i++) {
+		destroy_config_entry(cg->config_entries[i]);
+		free(cg->config_entries[i]);
+	}
+	free(cg->config_entries);
+}
+
+static void config_write_file(SurviveContext *ctx) {
 	char path[FILENAME_MAX] = "";
 	survive_config_file_path(ctx, path);
 
-	FILE *f = fopen(path, "w");
+	config_group global_snapshot;
+	config_group_snapshot(&global_snapshot, ctx->global_config_values);
+	BaseStationData bsd[NUM_GEN2_LIGHTHOUSES];
+	survive_get_bsd_snapshot(ctx, 0, NUM_GEN2_LIGHTHOUSES, bsd);
+	config_group lh_snapshots[NUM_GEN2_LIGHTHOUSES];
+	bool lh_written[NUM_GEN2_LIGHTHOUSES] = {0};
+	for (int i = 0; i < NUM_GEN2_LIGHTHOUSES; i++) {
+		if (bsd[i].OOTXSet) {
+			config_group_snapshot(&lh_snapshots[i], ctx->lh_config + i);
+			lh_written[i] = true;
+		}
+	}
+
+	// Write next to the config and move it into place, so a crash mid-write never leaves a truncated file. Paths
+	// that aren't regular files, like /dev/null, are written in place.
+	char tmp_path[FILENAME_MAX + 8] = "";
+	struct stat st;
+	bool in_place = stat(path, &st) == 0 && (st.st_mode & S_IFMT) != S_IFREG;
+	snprintf(tmp_path, sizeof(tmp_path), in_place ? "%s" : "%s.tmp", path);
+
+	FILE *f = fopen(tmp_path, "w");
 
 	if (f == 0) {
 		static bool warnedOnce = false;
@@ -695,20 +831,122 @@ void config_save(SurviveContext *ctx) {
 					path);
 			warnedOnce = true;
 		}
-		return;
-	}
+	} else {
+		write_config_group(f, &global_snapshot, NULL);
 
-	write_config_group(f, ctx->global_config_values, NULL);
+		for (int i = 0; i < NUM_GEN2_LIGHTHOUSES; i++) {
+			if (lh_written[i]) {
+				char name[128] = {0};
+				snprintf(name, 128, "lighthouse%d", i);
+				write_config_group(f, &lh_snapshots[i], name);
+			}
+		}
 
+		bool write_failed = ferror(f) != 0;
+		if (fclose(f) != 0 || write_failed) {
+			SV_WARN("Failed writing config to '%.512s'", tmp_path);
+			if (!in_place)
+				remove(tmp_path);
+		} else if (!in_place) {
+#ifdef _WIN32
+			// rename doesn't replace existing files here
+			remove(path);
+#endif
+			if (rename(tmp_path, path) != 0) {
+				SV_WARN("Could not replace '%.512s': %s", path, strerror(errno));
+				remove(tmp_path);
+			}
+		}
+	}
+
+	config_group_snapshot_free(&global_snapshot);
 	for (int i = 0; i < NUM_GEN2_LIGHTHOUSES; i++) {
-		if (ctx->bsd[i].OOTXSet) {
-			char name[128] = { 0 };
-			snprintf(name, 128, "lighthouse%d", i);
-			write_config_group(f, ctx->lh_config + i, name);
+		if (lh_written[i])
+			config_group_snapshot_free(&lh_snapshots[i]);
+	}
+}
+
+static void *config_writer_thread(void *user) {
+	struct survive_config_writer *writer = user;
+	double last_write = 0;
+
+	// Anything still pending at shutdown is written by the config_save in survive_close
+	for (;;) {
+		OGLockSema(writer->wakeup);
+
+		// Requests that come in while waiting out the interval end up in the same write
+		double wait;
+		while (writer->keep_running && (wait = last_write + writer->interval - OGGetAbsoluteTime()) > 0) {
+			OGLockSemaTimeout(writer->wakeup, (int)ceil(wait * 1000.));
 		}
+		if (!writer->keep_running)
+			break;
+
+		// Taken before the write, so that changes made while the file is written get picked up next time
+		while (OGTryLockSema(writer->wakeup))
+			;
+		last_write = OGGetAbsoluteTime();
+		OGLockMutex(writer->file_lock);
+		config_write_file(writer->ctx);
+		OGUnlockMutex(writer->file_lock);
+		writer->writes++;
 	}
+	return 0;
+}
+
+struct survive_config_writer *survive_config_writer_create(SurviveContext *ctx) {
+	FLT interval = survive_configf(ctx, CONFIG_SAVE_INTERVAL_TAG, SC_GET, 1.);
+	if (interval <= 0)
+		return 0;
+
+	struct survive_config_writer *writer = SV_CALLOC(sizeof(struct survive_config_writer));
+	writer->ctx = ctx;
+	writer->interval = interval;
+	writer->file_lock = OGCreateMutex();
+	writer->wakeup = OGCreateSema();
+	writer->keep_running = true;
+	writer->thread = OGCreateThread(config_writer_thread, "config writer", writer);
+	return writer;
+}
+
+void survive_config_writer_free(struct survive_config_writer *writer) {
+	if (writer == 0)
+		return;
+
+	writer->keep_running = false;
+	OGUnlockSema(writer->wakeup);
+	OGJoinThread(writer->thread);
+
+	SurviveContext *ctx = writer->ctx;
+	SV_VERBOSE(10, "Config writer wrote %u times for %u saves", writer->writes, writer->requests);
+
+	OGDeleteMutex(writer->file_lock);
+	OGDeleteSema(writer->wakeup);
+	free(writer);
+}
+
+void config_save(SurviveContext *ctx) {
+	struct survive_config_writer *writer = survive_get_config_writer(ctx, false);
+	if (writer)
+		OGLockMutex(writer->file_lock);
+
+	config_write_file(ctx);
 
-	fclose(f);
+	if (writer)
+		OGUnlockMutex(writer->file_lock);
+	survive_release_config_writer(ctx);
+}
+
+void config_save_async(SurviveContext *ctx) {
+	struct survive_config_writer *writer = survive_get_config_writer(ctx, true);
+	if (writer) {
+		writer->requests++;
+		OGUnlockSema(writer->wakeup);
+	}
+	survive_release_config_writer(ctx);
+
+	if (writer == 0)
+		config_save(ctx);
 }
 
 void print_json_value(char *tag, char **values, uint16_t count) {
@@ -949,13 +1187,11 @@ FLT survive_configf(SurviveContext *ctx, const char *tag, char flags, FLT def) {
 	}
 
 
-	int i;
 	if( !(flags & SC_OVERRIDE) )
 	{
-		for (struct static_conf_t *config = head; config; config = config->next) {
-			if (strcmp(tag, config->name) == 0) {
-				def = config->data_default.f;
-			}
+		struct static_conf_t *config = find_static_conf_t(tag);
+		if (config) {
+			def = config->data_default.f;
 		}
 	}
 
@@ -981,13 +1217,11 @@ uint32_t survive_configi(SurviveContext *ctx, const char *tag, char flags, uint3
 	}
 
 	uint32_t statictimedef = def;
-	int i;
 	if( !(flags & SC_OVERRIDE) )
 	{
-		for (struct static_conf_t *config = head; config; config = config->next) {
-			if (strcmp(tag, config->name) == 0) {
-				def = config->data_default.i;
-			}
+		struct static_conf_t *config = find_static_conf_t(tag);
+		if (config) {
+			def = config->data_default.i;
 		}
 	}
 
@@ -1011,19 +1245,15 @@ const char *survive_configs(SurviveContext *ctx, const char *tag, char flags, co
 			return cv->data;
 	}
 
-	int i;
 	char foundtype = 0;
 	const char * founddata = def;
-	for (struct static_conf_t *config = head; config; config = config->next) {
-		if (!config)
-			break;
-		if (strcmp(tag, config->name) == 0) {
-			founddata = config->data_default.s;
-			foundtype = config->type;
-			if( !(flags & SC_OVERRIDE) )
-			{
-				def = founddata;
-			}
+	struct static_conf_t *config = find_static_conf_t(tag);
+	if (config) {
+		founddata = config->data_default.s;
+		foundtype = config->type;
+		if( !(flags & SC_OVERRIDE) )
+		{
+			def = founddata;
 		}
 	}
 
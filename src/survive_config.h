@@ -38,10 +38,21 @@ typedef struct {
 	update_list_t * update_list;
 } config_entry;
 
+// Open addressed hash of tag -> entry; size is a power of two. Slots only ever go from empty to an entry, so readers
+// probe it without the group lock. Growing publishes a new index and keeps the old one on the retired list until the
+// group is destroyed, since a reader may still be probing it.
+typedef struct config_index {
+	uint16_t size;
+	struct config_index *retired;
+	config_entry *slots[];
+} config_index;
+
 typedef struct config_group {
-	config_entry *config_entries;
+	// Entries are allocated one by one and never move, so pointers handed out by find_config_entry stay valid
+	config_entry **config_entries;
 	uint16_t	used_entries;
 	uint16_t	max_entries;
+	config_index *volatile index;
 	og_mutex_t write_lock;
 	SurviveContext * ctx;
 } config_group;
@@ -61,6 +72,10 @@ bool config_read_lighthouse(config_group *lh_config, BaseStationData *bsd, uint8
 
 void config_read(SurviveContext* sctx, const char* path);
 void config_save(SurviveContext *ctx);
+// Same as config_save, except the file is written later from the config writer thread, see config-save-interval
+void config_save_async(SurviveContext *ctx);
+struct survive_config_writer *survive_config_writer_create(SurviveContext *ctx);
+void survive_config_writer_free(struct survive_config_writer *writer);
 
 FLT config_set_float(config_group *cg, const char *tag, FLT value);
 uint32_t config_set_uint32(config_group *cg, const char *tag, uint32_t value);
@@ -42,6 +42,7 @@ SurviveObject *survive_create_device(SurviveContext *ctx, const char *driver_nam
 	}
 
 	SurviveSensorActivations_ctor(device, &device->activations);
+	device->object_lock = OGCreateMutex();
 
 	bool use_async_posers = survive_configi(ctx, "threaded-posers", SC_GET, 0);
 	if (use_async_posers) {
@@ -498,6 +499,7 @@ void survive_destroy_device(SurviveObject *so) {
 	SV_VERBOSE(5, "\tExtent misses             %6u", so->stats.extent_misses);
 	SV_VERBOSE(5, "\tExtent min                %6.4f", so->stats.min_extent);
 	SV_VERBOSE(5, "\tExtent max                %6.4f", so->stats.max_extent);
+	SV_VERBOSE(5, "\tLock contentions          %6u", so->stats.lock_contentions);
 
 	for (int i = 0; i < NUM_GEN2_LIGHTHOUSES; i++) {
 		if (so->stats.hit_from_lhs[i]) {
@@ -514,9 +516,11 @@ void survive_destroy_device(SurviveObject *so) {
 
 	survive_kalman_tracker_free(so->tracker);
 	free(so->tracker);
+	SurviveSensorActivations_dtor(&so->activations);
 	free(so->sensor_locations);
 	free(so->sensor_normals);
 	free(so->conf);
 	free(so->channel_map);
+	OGDeleteMutex(so->object_lock);
 	free(so);
 }
@@ -1,3 +1,5 @@
+#pragma once
+
 
 #ifdef NOZLIB
 #define gzFile FILE *
@@ -10,6 +12,11 @@
 #define gzeof feof
 #define gzseek fseek
 #define gzgetc fgetc
+#define gzread(file, buf, len) fread(buf, 1, len, file)
+#define gzgets(file, buf, len) fgets(buf, len, file)
+#define gztell ftell
+#define gzdopen fdopen
+#define gzdirect(file) 1
 #else
 #include <zlib.h>
 static inline int gzerror_dropin(gzFile f) {
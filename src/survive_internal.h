@@ -26,6 +26,18 @@ void survive_load_plugins(const char *additional_plugin_dir);
 typedef double (*survive_run_time_fn)(const SurviveContext *ctx, void *user);
 SURVIVE_EXPORT void survive_install_run_time_fn(SurviveContext *ctx, survive_run_time_fn fn, void *user);
 
+// Worker pool shared by all threaded posers of the context; created on first use and freed by survive_close
+struct survive_threaded_poser_pool *survive_get_threaded_poser_pool(SurviveContext *ctx);
+
+// Background writer for config_save_async; created on first use when create is set, and freed by survive_close.
+// Locks the writer in place, so every call must be paired with survive_release_config_writer, even when it returns 0
+struct survive_config_writer *survive_get_config_writer(SurviveContext *ctx, bool create);
+void survive_release_config_writer(SurviveContext *ctx);
+
+// Drops the optimizer settings cached for ctx, so a later context at the same address reads its own; called by
+// survive_close
+void survive_optimizer_forget_context(SurviveContext *ctx);
+
 #endif
 
 
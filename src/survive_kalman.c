@@ -9,6 +9,12 @@
 
 typedef struct SvMat survive_kalman_gain_matrix;
 
+// The state columns a measurement jacobian can be non-zero in, in increasing order
+struct survive_kalman_H_cols {
+	const int *idx;
+	int cnt;
+};
+
 #define KALMAN_LOG_LEVEL 1000
 
 #define SV_KALMAN_VERBOSE(lvl, fmt, ...)                                                                               \
@@ -66,6 +72,9 @@ void user_is_q(void *user, FLT t, const struct SvMat *x, SvMat *Q_out) {
 SURVIVE_EXPORT void survive_kalman_state_reset(survive_kalman_state_t *k) {
 	k->t = 0;
 	sv_set_zero(&k->P);
+	if (k->UD) {
+		memset(k->UD, 0, sizeof(FLT) * k->state_cnt * k->state_cnt);
+	}
 }
 
 void survive_kalman_state_init(survive_kalman_state_t *k, size_t state_cnt, kalman_transition_fn_t F,
@@ -96,6 +105,388 @@ void survive_kalman_state_free(survive_kalman_state_t *k) {
 	if (k->State_is_heap)
 		free(SV_FLT_PTR(&k->state));
 	k->state.data = 0;
+
+	free(k->UD);
+	k->UD = 0;
+}
+
+#define KN SURVIVE_KALMAN_FIXED_STATE_CNT
+
+static inline bool survive_kalman_use_fixed(const survive_kalman_state_t *k, int meas_cnt) {
+	return !k->Force_generic && k->state_cnt == KN && meas_cnt <= SURVIVE_KALMAN_FIXED_MAX_MEAS;
+}
+
+// P and Q are symmetric so their storage order doesn't matter; everything else is loaded in row major.
+static inline void fixed_load_row_major(FLT *dst, const SvMat *m) {
+	for (int i = 0; i < m->rows; i++) {
+		for (int j = 0; j < m->cols; j++) {
+			dst[i * m->cols + j] = svMatrixGet(m, i, j);
+		}
+	}
+}
+
+// P = F * P * F^T + Q
+static void survive_kalman_predict_covariance_fixed(FLT *P, const SvMat *F, const FLT *Q) {
+	FLT f[KN * KN];
+	fixed_load_row_major(f, F);
+
+	FLT FP[KN * KN];
+	for (int i = 0; i < KN; i++) {
+		FLT row[KN] = {0};
+		for (int k = 0; k < KN; k++) {
+			FLT fik = f[i * KN + k];
+			if (fik == 0)
+				continue;
+			for (int j = 0; j < KN; j++) {
+				row[j] += fik * P[k * KN + j];
+			}
+		}
+		memcpy(FP + i * KN, row, sizeof(row));
+	}
+
+	for (int i = 0; i < KN; i++) {
+		for (int j = i; j < KN; j++) {
+			FLT v = Q[i * KN + j];
+			for (int k = 0; k < KN; k++) {
+				v += FP[i * KN + k] * f[j * KN + k];
+			}
+			P[i * KN + j] = P[j * KN + i] = v;
+		}
+	}
+}
+
+/*
+ * K = P * H^T * (H * P * H^T + R)^-1
+ * P = P - K * (P * H^T)^T
+ *
+ * The second line is (I - K * H) * P with the symmetry of P folded in, so only the upper triangle is computed and
+ * neither the identity nor (I - K * H) is ever formed.
+ */
+static void survive_kalman_update_covariance_fixed(FLT *P, SvMat *K_out, const SvMat *H, const SvMat *R,
+												  const struct survive_kalman_H_cols *cols) {
+	const int m = H->rows;
+	FLT h[SURVIVE_KALMAN_FIXED_MAX_MEAS * KN];
+	fixed_load_row_major(h, H);
+
+	FLT PHt[KN * SURVIVE_KALMAN_FIXED_MAX_MEAS];
+	for (int i = 0; i < KN; i++) {
+		for (int r = 0; r < m; r++) {
+			FLT v = 0;
+			for (int c = 0; c < cols->cnt; c++) {
+				int k = cols->idx[c];
+				v += P[i * KN + k] * h[r * KN + k];
+			}
+			PHt[i * m + r] = v;
+		}
+	}
+
+	FLT _S[SURVIVE_KALMAN_FIXED_MAX_MEAS * SURVIVE_KALMAN_FIXED_MAX_MEAS];
+	FLT _iS[SURVIVE_KALMAN_FIXED_MAX_MEAS * SURVIVE_KALMAN_FIXED_MAX_MEAS] = {0};
+	FLT diag = 0, non_diag = 0;
+	for (int r = 0; r < m; r++) {
+		for (int c = r; c < m; c++) {
+			FLT v = svMatrixGet(R, r, c);
+			for (int ci = 0; ci < cols->cnt; ci++) {
+				int k = cols->idx[ci];
+				v += h[r * KN + k] * PHt[k * m + c];
+			}
+			_S[r * m + c] = _S[c * m + r] = v;
+			if (r == c) {
+				diag += fabs(v);
+			} else {
+				non_diag += 2 * fabs(v);
+			}
+		}
+	}
+
+	if (diag == 0 || non_diag / diag > 1e-5) {
+		SvMat S = svMat(m, m, _S);
+		SvMat iS = svMat(m, m, _iS);
+		svInvert(&S, &iS, SV_INVERT_METHOD_LU);
+	} else {
+		for (int r = 0; r < m; r++) {
+			_iS[r * m + r] = 1. / _S[r * m + r];
+		}
+	}
+
+	FLT K[KN * SURVIVE_KALMAN_FIXED_MAX_MEAS];
+	for (int i = 0; i < KN; i++) {
+		for (int c = 0; c < m; c++) {
+			FLT v = 0;
+			for (int r = 0; r < m; r++) {
+				v += PHt[i * m + r] * _iS[r * m + c];
+			}
+			K[i * m + c] = v;
+			svMatrixSet(K_out, i, c, v);
+		}
+	}
+
+	for (int i = 0; i < KN; i++) {
+		for (int j = i; j < KN; j++) {
+			FLT v = 0;
+			for (int r = 0; r < m; r++) {
+				v += K[i * m + r] * PHt[j * m + r];
+			}
+			P[i * KN + j] -= v;
+			P[j * KN + i] = P[i * KN + j];
+		}
+	}
+}
+
+/*
+ * UD factorized covariance. ud is a row major n x n array; ud[i * n + i] holds D_i and ud[i * n + j], j > i, holds U_ij.
+ * The strictly lower triangle is unused and left at zero.
+ */
+
+// Factorizes the symmetric positive semi-definite P. Directions with no variance get a zero D and U column.
+static void ud_factorize(FLT *ud, const SvMat *P, int n) {
+	memset(ud, 0, sizeof(FLT) * n * n);
+	for (int j = n - 1; j >= 0; j--) {
+		FLT d = svMatrixGet(P, j, j);
+		for (int k = j + 1; k < n; k++) {
+			d -= ud[k * n + k] * ud[j * n + k] * ud[j * n + k];
+		}
+		if (!(d > 0)) {
+			d = 0;
+		}
+		ud[j * n + j] = d;
+
+		for (int i = 0; i < j && d > 0; i++) {
+			FLT v = svMatrixGet(P, i, j);
+			for (int k = j + 1; k < n; k++) {
+				v -= ud[k * n + k] * ud[i * n + k] * ud[j * n + k];
+			}
+			ud[i * n + j] = v / d;
+		}
+	}
+}
+
+// P = U * D * U^T
+static void ud_to_P(SvMat *P, const FLT *ud, int n) {
+	for (int i = 0; i < n; i++) {
+		for (int j = i; j < n; j++) {
+			FLT v = ud[j * n + j] * (i == j ? 1 : ud[i * n + j]);
+			for (int k = j + 1; k < n; k++) {
+				v += ud[i * n + k] * ud[k * n + k] * ud[j * n + k];
+			}
+			svMatrixSet(P, i, j, v);
+			svMatrixSet(P, j, i, v);
+		}
+	}
+}
+
+/*
+ * Thornton's modified weighted Gram-Schmidt time update. With Q = Uq * Dq * Uq^T, the rows of W = [F * U | Uq] are
+ * orthogonalized against diag(D, Dq) from the last row up; the weights that come out are the new D and the projection
+ * coefficients are the new U.
+ */
+static void survive_kalman_predict_covariance_ud(survive_kalman_state_t *k, const SvMat *F, const SvMat *Q) {
+	const int n = k->state_cnt, w = 2 * n;
+	FLT *ud = k->UD;
+
+	FLT *qud = alloca(sizeof(FLT) * n * n);
+	ud_factorize(qud, Q, n);
+
+	FLT *f = alloca(sizeof(FLT) * n * n);
+	fixed_load_row_major(f, F);
+
+	FLT *W = alloca(sizeof(FLT) * n * w);
+	FLT *Dw = alloca(sizeof(FLT) * w);
+	for (int i = 0; i < n; i++) {
+		for (int j = 0; j < n; j++) {
+			FLT v = f[i * n + j];
+			for (int c = 0; c < j; c++) {
+				v += f[i * n + c] * ud[c * n + j];
+			}
+			W[i * w + j] = v;
+			W[i * w + n + j] = i == j ? 1 : (i < j ? qud[i * n + j] : 0);
+		}
+		Dw[i] = ud[i * n + i];
+		Dw[n + i] = qud[i * n + i];
+	}
+
+	for (int j = n - 1; j >= 0; j--) {
+		FLT sigma = 0;
+		for (int c = 0; c < w; c++) {
+			sigma += W[j * w + c] * W[j * w + c] * Dw[c];
+		}
+		ud[j * n + j] = sigma;
+
+		for (int i = 0; i < j; i++) {
+			FLT u = 0;
+			if (sigma > 0) {
+				for (int c = 0; c < w; c++) {
+					u += W[i * w + c] * Dw[c] * W[j * w + c];
+				}
+				u /= sigma;
+				for (int c = 0; c < w; c++) {
+					W[i * w + c] -= u * W[j * w + c];
+				}
+			}
+			ud[i * n + j] = u;
+		}
+	}
+}
+
+/*
+ * Bierman's scalar measurement update for one row h with variance r. Updates ud in place and writes the gain for that
+ * row into gain.
+ */
+static void ud_update_scalar(FLT *ud, int n, const FLT *h, FLT r, FLT *gain, const struct survive_kalman_H_cols *cols) {
+	FLT *f = alloca(sizeof(FLT) * n);
+	FLT *v = alloca(sizeof(FLT) * n);
+
+	// f = U^T * h, v = D * f. cols is sorted, so only its entries up to j contribute to f[j].
+	for (int j = 0; j < n; j++) {
+		f[j] = 0;
+		for (int c = 0; c < cols->cnt && cols->idx[c] <= j; c++) {
+			int i = cols->idx[c];
+			f[j] += (i == j ? 1 : ud[i * n + j]) * h[i];
+		}
+		v[j] = ud[j * n + j] * f[j];
+	}
+
+	FLT alpha = r;
+	for (int j = 0; j < n; j++) {
+		FLT alpha_prev = alpha;
+		alpha += f[j] * v[j];
+		if (alpha <= 0) {
+			alpha = alpha_prev;
+			gain[j] = 0;
+			continue;
+		}
+
+		FLT lambda = -f[j] / alpha_prev;
+		ud[j * n + j] *= alpha_prev / alpha;
+
+		gain[j] = v[j];
+		for (int i = 0; i < j; i++) {
+			FLT beta = ud[i * n + j];
+			ud[i * n + j] = beta + gain[i] * lambda;
+			gain[i] += beta * v[j];
+		}
+	}
+
+	for (int j = 0; j < n; j++) {
+		gain[j] /= alpha;
+	}
+}
+
+// Lower cholesky factor of the m x m row major r, in place. Returns false if r isn't positive definite.
+static bool cholesky_in_place(FLT *r, int m) {
+	for (int j = 0; j < m; j++) {
+		FLT d = r[j * m + j];
+		for (int c = 0; c < j; c++) {
+			d -= r[j * m + c] * r[j * m + c];
+		}
+		if (!(d > 0)) {
+			return false;
+		}
+		d = FLT_SQRT(d);
+		r[j * m + j] = d;
+
+		for (int i = j + 1; i < m; i++) {
+			FLT v = r[i * m + j];
+			for (int c = 0; c < j; c++) {
+				v -= r[i * m + c] * r[j * m + c];
+			}
+			r[i * m + j] = v / d;
+		}
+	}
+	return true;
+}
+
+/*
+ * Runs every row of H through ud_update_scalar. The state correction of the rows is x += M * y, where
+ * M_i = M_i-1 + gain_i * (e_i^T - h_i * M_i-1); M is handed back as K so the caller applies it like any other gain.
+ * A correlated R = L * L^T is whitened first by solving with L, and K = M * L^-1 maps back to the original residual.
+ */
+static void survive_kalman_update_covariance_ud(survive_kalman_state_t *k, SvMat *K, const SvMat *H, const SvMat *R,
+												const struct survive_kalman_H_cols *cols) {
+	const int n = k->state_cnt, m = H->rows;
+
+	FLT *h = alloca(sizeof(FLT) * m * n);
+	fixed_load_row_major(h, H);
+	FLT *L = alloca(sizeof(FLT) * m * m);
+	fixed_load_row_major(L, R);
+
+	bool whiten = false;
+	for (int i = 0; i < m && !whiten; i++) {
+		for (int j = 0; j < m; j++) {
+			if (i != j && L[i * m + j] != 0) {
+				whiten = true;
+				break;
+			}
+		}
+	}
+
+	FLT *r = alloca(sizeof(FLT) * m);
+	for (int i = 0; i < m; i++) {
+		r[i] = L[i * m + i];
+	}
+
+	if (whiten && !cholesky_in_place(L, m)) {
+		// Fall back to the variances alone if R isn't usable
+		whiten = false;
+	}
+
+	if (whiten) {
+		for (int ci = 0; ci < cols->cnt; ci++) {
+			int c = cols->idx[ci];
+			for (int i = 0; i < m; i++) {
+				FLT v = h[i * n + c];
+				for (int l = 0; l < i; l++) {
+					v -= L[i * m + l] * h[l * n + c];
+				}
+				h[i * n + c] = v / L[i * m + i];
+			}
+		}
+		for (int i = 0; i < m; i++) {
+			r[i] = 1;
+		}
+	}
+
+	FLT *M = alloca(sizeof(FLT) * n * m);
+	memset(M, 0, sizeof(FLT) * n * m);
+	FLT *gain = alloca(sizeof(FLT) * n);
+	FLT *hM = alloca(sizeof(FLT) * m);
+
+	for (int i = 0; i < m; i++) {
+		const FLT *hi = h + i * n;
+		ud_update_scalar(k->UD, n, hi, r[i], gain, cols);
+
+		for (int c = 0; c < m; c++) {
+			hM[c] = 0;
+			for (int ji = 0; ji < cols->cnt; ji++) {
+				int j = cols->idx[ji];
+				hM[c] += hi[j] * M[j * m + c];
+			}
+		}
+		for (int j = 0; j < n; j++) {
+			for (int c = 0; c < m; c++) {
+				M[j * m + c] += gain[j] * ((c == i ? 1 : 0) - hM[c]);
+			}
+		}
+	}
+
+	for (int j = 0; j < n; j++) {
+		FLT *row = M + j * m;
+		if (whiten) {
+			// row = row * L^-1
+			for (int c = m - 1; c >= 0; c--) {
+				FLT v = row[c];
+				for (int l = c + 1; l < m; l++) {
+					v -= row[l] * L[l * m + c];
+				}
+				row[c] = v / L[c * m + c];
+			}
+		}
+		for (int c = 0; c < m; c++) {
+			svMatrixSet(K, j, c, row[c]);
+		}
+	}
+
+	ud_to_P(&k->P, k->UD, n);
 }
 
 void survive_kalman_predict_covariance(FLT t, const SvMat *F, const SvMat *x, survive_kalman_state_t *k) {
@@ -106,8 +497,14 @@ void survive_kalman_predict_covariance(FLT t, const SvMat *F, const SvMat *x, su
 	SV_CREATE_STACK_MAT(Q, dims, dims);
 	k->Q_fn(k->user, t, x, &Q);
 
-	// k->P = F * k->P * F^T + Q
-	matrix_ABAt_add(Pk1_k1, F, Pk1_k1, &Q);
+	// k->P = F * k->P * F^T + Q. In UD mode P is only rebuilt after the update that always follows.
+	if (k->UD) {
+		survive_kalman_predict_covariance_ud(k, F, &Q);
+	} else if (survive_kalman_use_fixed(k, 0)) {
+		survive_kalman_predict_covariance_fixed(SV_FLT_PTR(Pk1_k1), F, _Q);
+	} else {
+		matrix_ABAt_add(Pk1_k1, F, Pk1_k1, &Q);
+	}
 
 	if (log_level >= KALMAN_LOG_LEVEL) {
 		SV_KALMAN_VERBOSE(110, "T: %f", t);
@@ -119,22 +516,64 @@ void survive_kalman_predict_covariance(FLT t, const SvMat *F, const SvMat *x, su
 }
 
 static void survive_kalman_update_covariance(survive_kalman_state_t *k, survive_kalman_gain_matrix *K,
-											 const struct SvMat *H, const SvMat *R) {
+											 const struct SvMat *H, const SvMat *R,
+											 const struct survive_kalman_H_cols *cols) {
 	int dims = k->state_cnt;
 
 	SvMat *Pk_k = &k->P;
 
+	if (k->UD) {
+		survive_kalman_update_covariance_ud(k, K, H, R, cols);
+		if (log_level >= KALMAN_LOG_LEVEL) {
+			sv_print_mat("K", K, true);
+			sv_print_mat("Pk_k", Pk_k, true);
+		}
+		return;
+	}
+
+	if (survive_kalman_use_fixed(k, H->rows)) {
+		survive_kalman_update_covariance_fixed(SV_FLT_PTR(Pk_k), K, H, R, cols);
+		if (log_level >= KALMAN_LOG_LEVEL) {
+			sv_print_mat("K", K, true);
+			sv_print_mat("Pk_k", Pk_k, true);
+		}
+		return;
+	}
+
 	SV_CREATE_STACK_MAT(Pk_k1Ht, dims, H->rows);
 
-	// Pk_k1Ht = P_k|k-1 * H^T
-	svGEMM(Pk_k, H, 1, 0, 0, &Pk_k1Ht, SV_GEMM_FLAG_B_T);
 	SV_CREATE_STACK_MAT(S, H->rows, H->rows);
 
 	sv_print_mat("H", H, 1);
 	sv_print_mat("R", R, 1);
 
-	// S = H * P_k|k-1 * H^T
-	svGEMM(H, &Pk_k1Ht, 1, R, 1, &S, 0);
+	if (cols->cnt == dims) {
+		// Pk_k1Ht = P_k|k-1 * H^T
+		svGEMM(Pk_k, H, 1, 0, 0, &Pk_k1Ht, SV_GEMM_FLAG_B_T);
+
+		// S = H * P_k|k-1 * H^T
+		svGEMM(H, &Pk_k1Ht, 1, R, 1, &S, 0);
+	} else {
+		// Same as above, but only summing over the columns H can be non-zero in
+		for (int i = 0; i < dims; i++) {
+			for (int r = 0; r < H->rows; r++) {
+				FLT v = 0;
+				for (int c = 0; c < cols->cnt; c++) {
+					v += svMatrixGet(Pk_k, i, cols->idx[c]) * svMatrixGet(H, r, cols->idx[c]);
+				}
+				svMatrixSet(&Pk_k1Ht, i, r, v);
+			}
+		}
+		for (int r = 0; r < H->rows; r++) {
+			for (int j = 0; j < H->rows; j++) {
+				FLT v = svMatrixGet(R, r, j);
+				for (int c = 0; c < cols->cnt; c++) {
+					v += svMatrixGet(H, r, cols->idx[c]) * svMatrixGet(&Pk_k1Ht, cols->idx[c], j);
+				}
+				svMatrixSet(&S, r, j, v);
+			}
+		}
+	}
 
 	sv_print_mat("Pk_k1Ht", &Pk_k1Ht, 1);
 	sv_print_mat("S", &S, 1);
@@ -231,6 +670,22 @@ static void linear_update(FLT dt, survive_kalman_state_t *k, const SvMat *y, con
 	svGEMM(K, y, 1, x_t0, 1, x_t1, 0);
 }
 
+static inline bool survive_kalman_H_within_cols(const SvMat *H, const struct survive_kalman_H_cols *cols) {
+	for (int j = 0, c = 0; j < H->cols; j++) {
+		if (c < cols->cnt && cols->idx[c] == j) {
+			assert(c == 0 || cols->idx[c - 1] < j);
+			c++;
+			continue;
+		}
+		for (int i = 0; i < H->rows; i++) {
+			if (svMatrixGet(H, i, j) != 0) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
 static SvMat *survive_kalman_find_residual(FLT dt, survive_kalman_state_t *k, kalman_measurement_model_fn_t Hfn,
 										   void *user, const struct SvMat *Z, const struct SvMat *x, SvMat *y,
 										   SvMat *H) {
@@ -258,7 +713,8 @@ static SvMat *survive_kalman_find_residual(FLT dt, survive_kalman_state_t *k, ka
 static FLT survive_kalman_predict_update_state_extended_adaptive_internal(FLT t, survive_kalman_state_t *k,
 																		  const struct SvMat *Z, FLT *Rv,
 																		  kalman_measurement_model_fn_t Hfn, void *user,
-																		  bool adaptive) {
+																		  bool adaptive, const int *H_cols,
+																		  size_t H_col_cnt) {
 	int state_cnt = k->state_cnt;
 	struct SvMat *H = 0;
 	FLT dt = t - k->t;
@@ -298,6 +754,17 @@ static FLT survive_kalman_predict_update_state_extended_adaptive_internal(FLT t,
 		return -1;
 	}
 
+	// Columns past state_cnt are dropped so one list can be shared between model sizes
+	int *col_idx = alloca(sizeof(int) * state_cnt);
+	struct survive_kalman_H_cols cols = {.idx = col_idx};
+	for (int i = 0; i < (H_cols ? (int)H_col_cnt : state_cnt); i++) {
+		int c = H_cols ? H_cols[i] : i;
+		if (c < state_cnt) {
+			col_idx[cols.cnt++] = c;
+		}
+	}
+	assert(survive_kalman_H_within_cols(H, &cols));
+
 	if (dt > 0) {
 		SV_CREATE_STACK_MAT(F, state_cnt, state_cnt);
 		for (int i = 0; i < state_cnt * state_cnt; i++)
@@ -319,7 +786,7 @@ static FLT survive_kalman_predict_update_state_extended_adaptive_internal(FLT t,
 		sv_set_diag(&R, Rv);
 	}
 
-	survive_kalman_update_covariance(k, &K, H, &R);
+	survive_kalman_update_covariance(k, &K, H, &R, &cols);
 
 	linear_update(dt, k, &y, &K, &x2, x1);
 
@@ -383,7 +850,14 @@ static FLT survive_kalman_predict_update_state_extended_adaptive_internal(FLT t,
 
 FLT survive_kalman_predict_update_state_extended(FLT t, survive_kalman_state_t *k, const struct SvMat *Z, const FLT *R,
 												 kalman_measurement_model_fn_t Hfn, void *user, bool adaptive) {
-	return survive_kalman_predict_update_state_extended_adaptive_internal(t, k, Z, (FLT *)R, Hfn, user, adaptive);
+	return survive_kalman_predict_update_state_extended_adaptive_internal(t, k, Z, (FLT *)R, Hfn, user, adaptive, 0, 0);
+}
+
+FLT survive_kalman_predict_update_state_extended_sparse(FLT t, survive_kalman_state_t *k, const struct SvMat *Z,
+														const FLT *R, kalman_measurement_model_fn_t Hfn, void *user,
+														bool adaptive, const int *H_cols, size_t H_col_cnt) {
+	return survive_kalman_predict_update_state_extended_adaptive_internal(t, k, Z, (FLT *)R, Hfn, user, adaptive,
+																		  H_cols, H_col_cnt);
 }
 
 FLT survive_kalman_predict_update_state(FLT t, survive_kalman_state_t *k, const struct SvMat *Z, const struct SvMat *H,
@@ -405,4 +879,20 @@ void survive_kalman_predict_state(FLT t, const survive_kalman_state_t *k, size_t
 	memcpy(_out, copyFrom + start_index, (end_index - start_index) * sizeof(FLT));
 	SV_FREE_STACK_MAT(tmpOut);
 }
-void survive_kalman_set_P(survive_kalman_state_t *k, const FLT *p) { sv_set_diag(&k->P, p); }
+void survive_kalman_set_P(survive_kalman_state_t *k, const FLT *p) {
+	sv_set_diag(&k->P, p);
+	if (k->UD) {
+		ud_factorize(k->UD, &k->P, k->state_cnt);
+	}
+}
+
+void survive_kalman_set_ud(survive_kalman_state_t *k, bool enable) {
+	if (enable && !k->UD) {
+		k->UD = SV_CALLOC(sizeof(FLT) * k->state_cnt * k->state_cnt);
+		ud_factorize(k->UD, &k->P, k->state_cnt);
+	} else if (!enable && k->UD) {
+		ud_to_P(&k->P, k->UD, k->state_cnt);
+		free(k->UD);
+		k->UD = 0;
+	}
+}
@@ -25,11 +25,28 @@
  * R_k = a * R_k-1 + (1 - a) * (e*e^t + H * P_k-1 * H^t)
  *
  * a is set to .3 for this implementation.
+ *
+ * UD mode:
+ *
+ * survive_kalman_set_ud switches the filter to carry the covariance as P = U * D * U^T, with U unit upper triangular
+ * and D diagonal. The predict step runs Thornton's modified weighted Gram-Schmidt and every measurement row is folded
+ * in with Bierman's scalar update, so S is never inverted and P stays symmetric positive semi-definite even in single
+ * precision. A non-diagonal R is whitened through its cholesky factor first. P is still rebuilt after every update so
+ * it can be read as usual; changes to it must go through survive_kalman_set_P or survive_kalman_state_reset.
 
  */
 
 struct survive_kalman_state_s;
 
+/**
+ * Filters with exactly this many states (the layout of SurviveKalmanModel) and at most
+ * SURVIVE_KALMAN_FIXED_MAX_MEAS rows per measurement run the covariance predict and update through compile-time sized
+ * kernels on plain stack arrays. P is kept symmetric by only computing its upper triangle. Every other size goes
+ * through the generic SvMat path.
+ */
+#define SURVIVE_KALMAN_FIXED_STATE_CNT 19
+#define SURVIVE_KALMAN_FIXED_MAX_MEAS 32
+
 // Generates the transition matrix F
 typedef void (*kalman_transition_fn_t)(FLT dt, struct SvMat *f_out, const struct SvMat *x0);
 
@@ -65,6 +82,13 @@ typedef struct survive_kalman_state_s {
 
 	// Current time
 	FLT t;
+
+	// Always use the generic kernels, even when state_cnt is SURVIVE_KALMAN_FIXED_STATE_CNT
+	bool Force_generic;
+
+	// When non-null, the authoritative UD factorization of P (state_cnt x state_cnt, row major). D is stored on the
+	// diagonal and the strictly upper triangle holds U.
+	FLT *UD;
 } survive_kalman_state_t;
 
 /**
@@ -108,6 +132,17 @@ SURVIVE_EXPORT FLT survive_kalman_predict_update_state_extended(FLT t, survive_k
 																const FLT *R, kalman_measurement_model_fn_t Hfn,
 																void *user, bool adapative);
 
+/**
+ * Same as survive_kalman_predict_update_state_extended, but Hfn declares that its jacobian is only ever non-zero in
+ * the state columns listed in H_cols. The list must be in increasing order; entries past state_cnt are ignored. P * H^T
+ * and H * P * H^T are then only evaluated over those columns.
+ */
+SURVIVE_EXPORT FLT survive_kalman_predict_update_state_extended_sparse(FLT t, survive_kalman_state_t *k,
+																	   const struct SvMat *Z, const FLT *R,
+																	   kalman_measurement_model_fn_t Hfn, void *user,
+																	   bool adaptive, const int *H_cols,
+																	   size_t H_col_cnt);
+
 /**
  * Initialize a kalman state object
  * @param k object to initialize
@@ -126,5 +161,10 @@ SURVIVE_EXPORT void survive_kalman_state_reset(survive_kalman_state_t *k);
 
 SURVIVE_EXPORT void survive_kalman_state_free(survive_kalman_state_t *k);
 SURVIVE_EXPORT void survive_kalman_set_P(survive_kalman_state_t *k, const FLT *d);
+
+/**
+ * Turn the UD factorized covariance mode on or off. Turning it on factorizes the current P.
+ */
+SURVIVE_EXPORT void survive_kalman_set_ud(survive_kalman_state_t *k, bool enable);
 SURVIVE_EXPORT void survive_kalman_set_logging_level(int verbosity);
 #endif
@@ -58,7 +58,10 @@ static inline void arr_eye_diag(FLT *m, int rows, int cols, const FLT *v) {
 }
 
 struct map_light_data_ctx {
-	PoserDataLight *pdl;
+	int lh;
+	// Copy of the lighthouse's state, taken under the bsd lock
+	const BaseStationData *bsd;
+	const SurviveKalmanLightMeasurement *meas;
 	SurviveKalmanTracker *tracker;
 };
 
@@ -80,11 +83,12 @@ static inline int get_axis(const struct PoserDataLight *pdl) {
  * This function reuses the reproject functions to estimate what it thinks the lightcap angle should be based on x_t,
  * and uses that measurement to compare from the actual observed angle. These functions have jacobian functions that
  * correspond to them; see @survive_reproject.c and @survive_reproject_gen2.c
+ *
+ * Each row of Z is one angle from the batch; all of them are from the same lighthouse.
  */
 static bool map_light_data(void *user, const struct SvMat *Z, const struct SvMat *x_t, struct SvMat *y,
 						   struct SvMat *H_k) {
 	struct map_light_data_ctx *cbctx = (struct map_light_data_ctx *)user;
-	const struct PoserDataLight *pdl = cbctx->pdl;
 	const SurviveKalmanTracker *tracker = cbctx->tracker;
 
 	SurviveObject *so = tracker->so;
@@ -92,28 +96,136 @@ static bool map_light_data(void *user, const struct SvMat *Z, const struct SvMat
 	const survive_reproject_model_t *mdl =
 		tracker->so->ctx->lh_version == 0 ? &survive_reproject_model : &survive_reproject_gen2_model;
 
-	int axis = get_axis(pdl);
-
-	survive_reproject_full_xy_fn_t project_fn = mdl->reprojectAxisFullFn[axis];
-	survive_reproject_axis_jacob_fn_t project_jacob_fn = mdl->reprojectAxisJacobFn[axis];
-	assert(ctx->bsd[pdl->lh].PositionSet);
+	assert(cbctx->bsd->PositionSet);
 
-	const SurvivePose world2lh = InvertPoseRtn(&ctx->bsd[pdl->lh].Pose);
+	const SurvivePose world2lh = InvertPoseRtn(&cbctx->bsd->Pose);
 	const SurvivePose obj2world = *(SurvivePose *)sv_as_const_vector(x_t);
 
-	const FLT *ptInObj = &so->sensor_locations[pdl->sensor_id * 3];
-	FLT h_x = project_fn(&obj2world, ptInObj, &world2lh, &ctx->bsd[pdl->lh].fcal[axis]);
-	sv_as_vector(y)[0] = sv_as_const_vector(Z)[0] - h_x;
-
 	sv_set_zero(H_k);
 
-	project_jacob_fn(sv_as_vector(H_k), &obj2world, ptInObj, &world2lh, &ctx->bsd[pdl->lh].fcal[axis]);
+	for (int i = 0; i < Z->rows; i++) {
+		const SurviveKalmanLightMeasurement *meas = &cbctx->meas[i];
+		const BaseStationCal *cal = &cbctx->bsd->fcal[meas->axis];
+		const FLT *ptInObj = &so->sensor_locations[meas->sensor_id * 3];
+
+		FLT h_x = mdl->reprojectAxisFullFn[meas->axis](&obj2world, ptInObj, &world2lh, cal);
+		sv_as_vector(y)[i] = sv_as_const_vector(Z)[i] - h_x;
+
+		FLT jac[7];
+		mdl->reprojectAxisJacobFn[meas->axis](jac, &obj2world, ptInObj, &world2lh, cal);
+		for (int j = 0; j < 7; j++) {
+			svMatrixSet(H_k, i, j, jac[j]);
+		}
+	}
+
 	if (!sv_is_finite(H_k))
 		return false;
 
 	return true;
 }
 
+// Light angles only depend on the pose part of the state
+static const int map_light_data_cols[] = {0, 1, 2, 3, 4, 5, 6};
+
+static void survive_kalman_tracker_flush_light(SurviveKalmanTracker *tracker) {
+	size_t cnt = tracker->light_batch_cnt;
+	if (cnt == 0) {
+		return;
+	}
+	tracker->light_batch_cnt = 0;
+
+	SurviveObject *so = tracker->so;
+	SurviveContext *ctx = so->ctx;
+	int lh = tracker->light_batch_lh;
+
+	// The lighthouse could have been invalidated while the batch was filling up
+	BaseStationData bsd;
+	survive_get_bsd_snapshot(ctx, lh, 1, &bsd);
+	if (!bsd.PositionSet) {
+		return;
+	}
+
+	FLT time = tracker->light_batch_hdr.timecode / (FLT)so->timebase_hz;
+	FLT delta = time - tracker->model.t;
+	tracker->last_light_time = time;
+
+	SV_CREATE_STACK_MAT(Z, cnt, 1);
+	for (size_t i = 0; i < cnt; i++) {
+		_Z[i] = tracker->light_batch[i].angle;
+	}
+	struct map_light_data_ctx cbctx = {
+		.lh = lh,
+		.bsd = &bsd,
+		.meas = tracker->light_batch,
+		.tracker = tracker,
+	};
+
+	bool ramp_in = tracker->stats.lightcap_count < tracker->light_rampin_length;
+	FLT light_var = tracker->light_var;
+	if (ramp_in) {
+		light_var += tracker->obs_pos_var / ((FLT)tracker->stats.lightcap_count + 1.);
+	}
+	SV_DATA_LOG("light_var", &light_var, 1);
+
+	// Adaptive mode wants the full R matrix; otherwise just its diagonal
+	bool adaptive = tracker->adaptive_lightcap;
+	SV_CREATE_STACK_MAT(R, cnt, adaptive ? cnt : 1);
+	if (adaptive) {
+		sv_set_diag_val(&R, light_var);
+	} else {
+		sv_set_constant(&R, light_var);
+	}
+
+	FLT rtn = survive_kalman_predict_update_state_extended_sparse(
+		time, &tracker->model, &Z, _R, map_light_data, &cbctx, adaptive, map_light_data_cols,
+		sizeof(map_light_data_cols) / sizeof(map_light_data_cols[0]));
+	if (!ramp_in && adaptive) {
+		FLT adapted_var = 0;
+		for (size_t i = 0; i < cnt; i++) {
+			adapted_var += svMatrixGet(&R, i, i);
+		}
+		tracker->light_var = adapted_var / cnt;
+	}
+
+	// rtn is the norm of the whole residual vector; track the per-angle error so stats don't depend on batch size
+	FLT err = cnt == 1 ? rtn : rtn / FLT_SQRT(cnt);
+	FLT decay = cnt == 1 ? .9 : FLT_POW(.9, cnt);
+
+	tracker->stats.lightcap_total_error += err * cnt;
+
+	tracker->light_residuals_all *= decay;
+	tracker->light_residuals_all += (1. - decay) * err;
+
+	tracker->light_residuals[lh] *= decay;
+	tracker->light_residuals[lh] += (1. - decay) * err;
+
+	tracker->stats.lightcap_error_by_lh[lh] += err * cnt;
+	tracker->stats.lightcap_count_by_lh[lh] += cnt;
+
+	SV_DATA_LOG("res_error_light_", &err, 1);
+	SV_DATA_LOG("res_error_light_avg", &tracker->light_residuals_all, 1);
+	for (size_t i = 0; i < cnt; i++) {
+		SV_DATA_LOG("res_error_light[%d, %d, %d]", &tracker->light_residuals[lh], 1, lh,
+					tracker->light_batch[i].sensor_id, tracker->light_batch[i].axis);
+	}
+
+	if (tracker->light_residuals[lh] > .1 && tracker->use_error_for_lh_pos) {
+		// SV_WARN("Light residual for lh%d is too high -- %f", lh, tracker->light_residuals[lh]);
+		survive_lighthouse_adjust_confidence(ctx, lh, -.1);
+	}
+	tracker->stats.lightcap_count += cnt;
+
+	normalize_model(tracker);
+	survive_kalman_tracker_report_state(&tracker->light_batch_hdr, tracker);
+
+	SV_VERBOSE(600, "Resultant state %f (%f) (lightcap %2d x %2d) (error %e, %e)  " Point16_format, time, delta, lh,
+			   (int)cnt, tracker->light_residuals[lh], tracker->light_residuals_all,
+			   LINMATH_VEC16_EXPAND(sv_as_const_vector(&tracker->model.state)));
+
+	SV_FREE_STACK_MAT(R);
+	SV_FREE_STACK_MAT(Z);
+}
+
 void survive_kalman_tracker_integrate_light(SurviveKalmanTracker *tracker, PoserDataLight *data) {
 	SurviveContext *ctx = tracker->so->ctx;
 
@@ -132,66 +244,41 @@ void survive_kalman_tracker_integrate_light(SurviveKalmanTracker *tracker, Poser
 		return;
 	}
 
-	if (!ctx->bsd[data->lh].PositionSet) {
+	BaseStationData bsd;
+	survive_get_bsd_snapshot(ctx, data->lh, 1, &bsd);
+	if (!bsd.PositionSet) {
 		return;
 	}
 
 	FLT time = data->hdr.timecode / (FLT)tracker->so->timebase_hz;
-	FLT delta = time - tracker->model.t;
-	tracker->last_light_time = time;
-
-	if (tracker->light_var >= 0) {
-		SvMat Z = svMat(1, 1, &data->angle);
-		struct map_light_data_ctx cbctx = {
-			.tracker = tracker,
-			.pdl = data,
-		};
-
-		SurviveObject *so = tracker->so;
-		bool ramp_in = tracker->stats.lightcap_count < tracker->light_rampin_length;
-		FLT light_var = tracker->light_var;
-		if (ramp_in) {
-			light_var += tracker->obs_pos_var / ((FLT)tracker->stats.lightcap_count + 1.);
-		}
-		SV_DATA_LOG("light_var", &light_var, 1);
-
-		FLT rtn = survive_kalman_predict_update_state_extended(time, &tracker->model, &Z, &light_var, map_light_data,
-															   &cbctx, tracker->adaptive_lightcap);
-		if (!ramp_in && tracker->adaptive_lightcap) {
-			tracker->light_var = light_var;
-		}
-
-		tracker->stats.lightcap_total_error += rtn;
-
-		tracker->light_residuals_all *= .9;
-		tracker->light_residuals_all += .1 * rtn;
-
-		tracker->light_residuals[data->lh] *= .9;
-		tracker->light_residuals[data->lh] += .1 * rtn;
+	if (tracker->light_var < 0) {
+		tracker->last_light_time = time;
+		return;
+	}
 
-		tracker->stats.lightcap_error_by_lh[data->lh] += rtn;
-		tracker->stats.lightcap_count_by_lh[data->lh]++;
+	assert(data->lh >= 0);
+	assert(data->sensor_id >= 0);
 
-		assert(data->lh >= 0);
-		assert(data->sensor_id >= 0);
+	if (tracker->light_batch_cnt > 0 &&
+		(tracker->light_batch_lh != data->lh || time - tracker->light_batch_start_time > tracker->light_batch_window)) {
+		survive_kalman_tracker_flush_light(tracker);
+	}
 
-		SV_DATA_LOG("res_error_light_", &rtn, 1);
-		SV_DATA_LOG("res_error_light_avg", &tracker->light_residuals_all, 1);
-		SV_DATA_LOG("res_error_light[%d, %d, %d]", &tracker->light_residuals[data->lh], 1, data->lh, data->sensor_id,
-					get_axis(data));
+	if (tracker->light_batch_cnt == 0) {
+		tracker->light_batch_lh = data->lh;
+		tracker->light_batch_start_time = time;
+	}
 
-		if (tracker->light_residuals[data->lh] > .1 && tracker->use_error_for_lh_pos) {
-			// SV_WARN("Light residual for lh%d is too high -- %f", data->lh, tracker->light_residuals[data->lh]);
-			survive_lighthouse_adjust_confidence(ctx, data->lh, -.1);
-		}
-		tracker->stats.lightcap_count++;
+	tracker->light_batch[tracker->light_batch_cnt++] = (SurviveKalmanLightMeasurement){
+		.angle = data->angle,
+		.sensor_id = data->sensor_id,
+		.axis = get_axis(data),
+	};
+	tracker->light_batch_hdr = data->hdr;
 
-		normalize_model(tracker);
-		survive_kalman_tracker_report_state(&data->hdr, tracker);
+	if (tracker->light_batch_cnt >= tracker->light_batch_size) {
+		survive_kalman_tracker_flush_light(tracker);
 	}
-	SV_VERBOSE(600, "Resultant state %f (%f) (lightcap %2d) (error %e, %e)  " Point16_format, time, delta, data->lh,
-			   tracker->light_residuals[data->lh], tracker->light_residuals_all,
-			   LINMATH_VEC16_EXPAND(sv_as_const_vector(&tracker->model.state)));
 }
 
 struct map_imu_data_ctx {
@@ -236,6 +323,9 @@ static bool map_imu_data(void *user, const struct SvMat *Z, const struct SvMat *
 	return true;
 }
 
+// Accelerometer and gyro readings depend on rotation, angular velocity, acceleration and gyro bias
+static const int map_imu_data_cols[] = {3, 4, 5, 6, 10, 11, 12, 13, 14, 15, 16, 17, 18};
+
 STATIC_CONFIG_ITEM(KALMAN_STATIONARY_ACC_SCALE_ALPHA, "kalman-stationary-acc-scale-alpha", 'f',
 				   "Incorporate scale coefficient while not moving", 0.005)
 STATIC_CONFIG_ITEM(KALMAN_MOVING_ACC_SCALE_ALPHA, "kalman-moving-acc-scale-alpha", 'f',
@@ -257,6 +347,8 @@ void survive_kalman_tracker_integrate_imu(SurviveKalmanTracker *tracker, PoserDa
 		return;
 	}
 
+	survive_kalman_tracker_flush_light(tracker);
+
 	// Wait til observation is in before reading IMU; gets rid of bad IMU data at the start
 	if (tracker->model.t == 0) {
 		return;
@@ -328,8 +420,9 @@ void survive_kalman_tracker_integrate_imu(SurviveKalmanTracker *tracker, PoserDa
 		SV_VERBOSE(600, "Integrating IMU " Point6_format " with cov " Point6_format,
 				   LINMATH_VEC6_EXPAND((FLT *)&accelgyro[0]), LINMATH_VEC6_EXPAND(R));
 
-		FLT err = survive_kalman_predict_update_state_extended(time, &tracker->model, &Z, R, map_imu_data, &fn_ctx,
-															   tracker->adaptive_imu);
+		FLT err = survive_kalman_predict_update_state_extended_sparse(
+			time, &tracker->model, &Z, R, map_imu_data, &fn_ctx, tracker->adaptive_imu, map_imu_data_cols,
+			sizeof(map_imu_data_cols) / sizeof(map_imu_data_cols[0]));
 
 		SV_DATA_LOG("res_err_imu", &err, 1);
 		tracker->stats.imu_total_error += err;
@@ -516,6 +609,8 @@ void survive_kalman_tracker_integrate_observation(PoserData *pd, SurviveKalmanTr
 		return;
 	}
 
+	survive_kalman_tracker_flush_light(tracker);
+
 	survive_long_timecode timecode = pd->timecode;
 
 	struct SurviveContext *ctx = tracker->so->ctx;
@@ -574,6 +669,14 @@ STATIC_CONFIG_ITEM(KALMAN_USE_ADAPTIVE_IMU, "use-adaptive-imu", 'i', "Use adapti
 STATIC_CONFIG_ITEM(KALMAN_USE_ADAPTIVE_LIGHTCAP, "use-adaptive-lightcap", 'i', "Use adaptive kalman for Lightcap", 0)
 STATIC_CONFIG_ITEM(KALMAN_USE_ADAPTIVE_OBS, "use-adaptive-obs", 'i', "Use adaptive kalman for observations", 0)
 
+#ifdef USE_FLOAT
+#define KALMAN_USE_UD_DEFAULT 1
+#else
+#define KALMAN_USE_UD_DEFAULT 0
+#endif
+STATIC_CONFIG_ITEM(KALMAN_USE_UD, "kalman-ud", 'i',
+				   "Keep the kalman covariance UD factorized instead of as a full matrix", KALMAN_USE_UD_DEFAULT)
+
 STATIC_CONFIG_ITEM(PROCESS_WEIGHT_ACC, "process-weight-acc", 'f', "Acc variance per second", 10.)
 
 STATIC_CONFIG_ITEM(PROCESS_WEIGHT_ANGULAR_VELOCITY, "process-weight-ang-vel", 'f', "Angular velocity variance per second", 1.)
@@ -594,6 +697,11 @@ STATIC_CONFIG_ITEM(KALMAN_LIGHTCAP_IGNORE_THRESHOLD, "light-ignore-threshold", '
 STATIC_CONFIG_ITEM(KALMAN_LIGHTCAP_REQUIRED_OBS, "light-required-obs", 'i',
 				   "Minimum observations to allow light data into the kalman filter", 16)
 
+STATIC_CONFIG_ITEM(KALMAN_LIGHT_BATCH_SIZE, "light-batch-size", 'i',
+				   "Maximum number of light angles from one lighthouse integrated as a single kalman update", 16)
+STATIC_CONFIG_ITEM(KALMAN_LIGHT_BATCH_WINDOW, "light-batch-window", 'f',
+				   "Maximum time in seconds spanned by one batched light update", .001)
+
 STATIC_CONFIG_ITEM(LIGHT_VARIANCE, "light-variance", 'f', "Variance of light sensor readings", 1e-6)
 STATIC_CONFIG_ITEM(OBS_POS_VARIANCE, "obs-pos-variance", 'f', "Variance of position integration from light capture",
 				   .02)
@@ -637,6 +745,7 @@ void survive_kalman_tracker_reinit(SurviveKalmanTracker *tracker) {
 
 	tracker->report_ignore_start_cnt = 0;
 	tracker->last_light_time = 0;
+	tracker->light_batch_cnt = 0;
 	tracker->light_residuals_all = 0;
 	survive_kalman_state_reset(&tracker->model);
 
@@ -644,14 +753,11 @@ void survive_kalman_tracker_reinit(SurviveKalmanTracker *tracker) {
 	tracker->state.Pose.Rot[0] = 1;
 
 	size_t state_cnt = tracker->model.state_cnt;
-	sv_set_zero(&tracker->model.P);
-
+	FLT P_init[SURVIVE_MODEL_MAX_STATE_CNT];
 	for (int i = 0; i < state_cnt; i++) {
-		svMatrixSet(&tracker->model.P, i, i, 1e3);
-	}
-	for (int i = 16; i < state_cnt; i++) {
-		svMatrixSet(&tracker->model.P, i, i, 1);
+		P_init[i] = i < 16 ? 1e3 : 1;
 	}
+	survive_kalman_set_P(&tracker->model, P_init);
 
 	FLT Rrs = tracker->obs_rot_var;
 	FLT Rps = tracker->obs_pos_var;
@@ -688,6 +794,13 @@ void survive_kalman_tracker_init(SurviveKalmanTracker *tracker, SurviveObject *s
 	tracker->use_error_for_lh_pos = survive_configi(ctx, KALMAN_USE_ERROR_FOR_LH_CONFIDENCE_TAG, SC_GET, 1);
 	tracker->light_rampin_length = survive_configi(ctx, KALMAN_LIGHTCAP_RAMPIN_LENGTH_TAG, SC_GET, 5000);
 
+	tracker->light_batch_size = survive_configi(ctx, KALMAN_LIGHT_BATCH_SIZE_TAG, SC_GET, 16);
+	if (tracker->light_batch_size < 1) {
+		tracker->light_batch_size = 1;
+	}
+	tracker->light_batch_window = survive_configf(ctx, KALMAN_LIGHT_BATCH_WINDOW_TAG, SC_GET, .001);
+	tracker->light_batch = SV_CALLOC(tracker->light_batch_size * sizeof(SurviveKalmanLightMeasurement));
+
 	survive_kalman_tracker_config(tracker, survive_attach_configf);
 
 	bool use_imu = (bool)survive_configi(ctx, "use-imu", SC_GET, 1);
@@ -719,6 +832,7 @@ void survive_kalman_tracker_init(SurviveKalmanTracker *tracker, SurviveObject *s
 	survive_kalman_state_init(&tracker->model, state_cnt, model_predict_jac, model_q_fn, tracker,
 							  (FLT *)&tracker->state);
 	tracker->model.Predict_fn = model_predict;
+	survive_kalman_set_ud(&tracker->model, survive_configi(ctx, KALMAN_USE_UD_TAG, SC_GET, KALMAN_USE_UD_DEFAULT));
 
 	survive_kalman_tracker_reinit(tracker);
 
@@ -787,9 +901,9 @@ void survive_kalman_tracker_stats(SurviveKalmanTracker *tracker) {
 
 		for (int j = 0; j < SENSORS_PER_OBJECT; j++) {
 			for (int z = 0; z < 2; z++) {
-				if (tracker->so->activations.hits[j][i][z]) {
-					SV_VERBOSE(5, "\t\t %02d.%d %5d %f", j, z, (int)tracker->so->activations.hits[j][i][z],
-							   tracker->so->activations.hits[j][i][z] / report_runtime);
+				survive_long_timecode hits = SurviveSensorActivations_hits(&tracker->so->activations, j, i, z);
+				if (hits) {
+					SV_VERBOSE(5, "\t\t %02d.%d %5d %f", j, z, (int)hits, hits / report_runtime);
 				}
 			}
 		}
@@ -805,6 +919,8 @@ void survive_kalman_tracker_free(SurviveKalmanTracker *tracker) {
 	survive_kalman_tracker_stats(tracker);
 
 	survive_kalman_state_free(&tracker->model);
+	free(tracker->light_batch);
+	tracker->light_batch = 0;
 
 	survive_detach_config(tracker->so->ctx, KALMAN_REPORT_IGNORE_START_TAG, &tracker->report_ignore_start);
 	survive_detach_config(tracker->so->ctx, KALMAN_USE_ADAPTIVE_IMU_TAG, &tracker->adaptive_imu);
@@ -838,8 +954,12 @@ void survive_kalman_tracker_lost_tracking(SurviveKalmanTracker *tracker, bool al
 	}
 
 	if (!objectsAreValid) {
+		survive_get_bsd_lock(ctx);
 		for (int lh = 0; lh < ctx->activeLighthouses; lh++) {
 			ctx->bsd[lh].PositionSet = 0;
+		}
+		survive_release_bsd_lock(ctx);
+		for (int lh = 0; lh < ctx->activeLighthouses; lh++) {
 			SV_WARN("LH%d %f", lh, tracker->light_residuals[lh]);
 		}
 	}
@@ -12,6 +12,12 @@
 extern "C" {
 #endif
 
+typedef struct SurviveKalmanLightMeasurement {
+	FLT angle;
+	int sensor_id;
+	int axis;
+} SurviveKalmanLightMeasurement;
+
 /**
  * The kalman model as it pertains to LH tracking has a state space like so:
  *
@@ -27,6 +33,9 @@ extern "C" {
  *
  * IMU data and raw light data can drift over time; but the poser data input is
  * assumed to be noisy but not drift in time.
+ *
+ * Light data from a single lighthouse is gathered into a batch of up to light-batch-size angles spanning at most
+ * light-batch-window seconds, and then integrated as one stacked measurement with a single predict and update step.
  */
 typedef struct SurviveKalmanTracker {
 	SurviveObject *so;
@@ -92,6 +101,14 @@ typedef struct SurviveKalmanTracker {
 
 	size_t light_rampin_length;
 	bool use_error_for_lh_pos;
+
+	int32_t light_batch_size;
+	FLT light_batch_window;
+	size_t light_batch_cnt;
+	int light_batch_lh;
+	PoserData light_batch_hdr;
+	FLT light_batch_start_time;
+	SurviveKalmanLightMeasurement *light_batch;
 } SurviveKalmanTracker;
 
 SURVIVE_EXPORT SurviveVelocity survive_kalman_tracker_velocity(const SurviveKalmanTracker *tracker);
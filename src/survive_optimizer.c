@@ -11,7 +11,9 @@
 #include "survive_optimizer.h"
 
 #include "mpfit/mpfit.h"
+#include "sv_matrix.h"
 #include "survive_default_devices.h"
+#include "survive_internal.h"
 #if !defined(__FreeBSD__) && !defined(__APPLE__)
 #include <malloc.h>
 #endif
@@ -27,6 +29,8 @@ STATIC_CONFIG_ITEM(OPTIMIZER_MAXITER, "optimizer-maxiter", 'i', "Maximum iterati
 STATIC_CONFIG_ITEM(OPTIMIZER_MAXFEV, "optimizer-maxfev", 'i', "Maximum function evals", 0)
 STATIC_CONFIG_ITEM(OPTIMIZER_NORMTOL, "optimizer-normtol", 'f', "Convergence for norm", 0.00005)
 STATIC_CONFIG_ITEM(OPTIMIZER_NPRINT, "optimizer-nprint", 'i', "", 0)
+STATIC_CONFIG_ITEM(OPTIMIZER_FLOAT_RESIDUALS, "optimizer-float-residuals", 'i',
+				   "Evaluate residuals in single precision; jacobians stay in double", 0)
 
 static char *object_parameter_names[] = {"Pose x",	 "Pose y",	 "Pose z",	"Pose Rot w",
 										 "Pose Rot x", "Pose Rot y", "Pose Rot z"};
@@ -123,6 +127,7 @@ void survive_optimizer_setup_camera(survive_optimizer *mpfit_ctx, int8_t lh, con
 
 void survive_optimizer_setup_cameras(survive_optimizer *mpfit_ctx, SurviveContext *ctx, bool isFixed,
 									 int use_jacobian_function) {
+	survive_get_bsd_lock(ctx);
 	for (int lh = 0; lh < mpfit_ctx->cameraLength; lh++) {
 		if (!quatiszero(ctx->bsd[lh].Pose.Rot))
 			survive_optimizer_setup_camera(mpfit_ctx, lh, &ctx->bsd[lh].Pose, isFixed, use_jacobian_function);
@@ -137,6 +142,7 @@ void survive_optimizer_setup_cameras(survive_optimizer *mpfit_ctx, SurviveContex
 		for (int axis = 0; axis < 2; axis++)
 			fcal[axis] = ctx->bsd[lh].fcal[axis];
 	}
+	survive_release_bsd_lock(ctx);
 
 	size_t start = survive_optimizer_get_calibration_index(mpfit_ctx);
 	for (int i = start; i < start + 2 * sizeof(BaseStationCal) / sizeof(FLT) * mpfit_ctx->cameraLength; i++) {
@@ -185,21 +191,72 @@ SurvivePose *survive_optimizer_get_pose(survive_optimizer *ctx) {
 		return (SurvivePose *)ctx->parameters;
 	return &ctx->initialPose;
 }
+// Poses only change between LM iterations, so everything that depends on just the poses and calibration is worked out
+// once per (object, lighthouse) pair and measurement kind -- an axis, or both axes for kind 2 -- and reused for every
+// sensor measured against that pair. Jacobian and value-only functions get separate slots since float residuals use
+// both in the same pass. At around 100KB it is allocated once per optimizer run rather than per evaluation.
+typedef struct prepared_reprojection {
+	const survive_reproject_prepared_fn_t *fn[2][NUM_GEN2_LIGHTHOUSES][3];
+	FLT state[2][NUM_GEN2_LIGHTHOUSES][3][SURVIVE_REPROJECT_PREPARED_MAX];
+} prepared_reprojection;
+
+// The prepared function for a measurement kind: the value followed by its jacobian wrt the object pose and, if with_lh
+// is set, wrt the lighthouse pose; or just the value when jacobians aren't wanted
+static inline const survive_reproject_prepared_fn_t *prepared_fn(const survive_reproject_model_t *reprojectModel,
+																  int kind, bool jac, bool with_lh) {
+	if (!jac) {
+		return kind == 2 ? &reprojectModel->reprojectAxisAngleFullPrepared
+						 : &reprojectModel->reprojectAxisAnglePrepared[kind];
+	}
+	return kind == 2 ? (with_lh ? &reprojectModel->reprojectAxisAngleFullValJacPoses
+								: &reprojectModel->reprojectAxisAngleFullValJacObjPose)
+					 : (with_lh ? &reprojectModel->reprojectAxisAngleAxisValJacPoses[kind]
+								: &reprojectModel->reprojectAxisAngleAxisValJacObjPose[kind]);
+}
+
+// Runs eval -- fn's own, or a single precision one over the same prepared state -- preparing fn's state first if it
+// isn't already
+static inline void eval_prepared(prepared_reprojection *prepared, const survive_reproject_prepared_fn_t *fn,
+								 survive_reproject_prepared_eval_fn_t eval, bool jac, int lh, int kind,
+								 const LinmathAxisAnglePose *pose, const LinmathAxisAnglePose *world2lh,
+								 const BaseStationCal *cal, const FLT *pt, FLT *out) {
+	FLT *state = prepared->state[jac][lh][kind];
+	if (prepared->fn[jac][lh][kind] != fn) {
+		assert(fn->prepared_size <= SURVIVE_REPROJECT_PREPARED_MAX);
+		fn->prepare(state, pose, world2lh, kind == 2 ? cal : cal + kind);
+		prepared->fn[jac][lh][kind] = fn;
+	}
+	eval(out, state, pt);
+}
+
 static inline void run_pair_measurement(survive_optimizer *mpfunc_ctx, size_t meas_idx,
 										const survive_reproject_model_t *reprojectModel,
 										const survive_optimizer_measurement *meas, const LinmathAxisAnglePose *pose,
 										const LinmathAxisAnglePose *obj2lh, const LinmathAxisAnglePose *world2lh,
-										FLT *deviates, FLT **derivs) {
+										prepared_reprojection *prepared, FLT *deviates, FLT **derivs) {
 	const int lh = meas->lh;
 	const FLT *sensor_points = survive_optimizer_get_sensors(mpfunc_ctx, meas->object);
 	const struct BaseStationCal *cal = survive_optimizer_get_calibration(mpfunc_ctx, lh);
 	const FLT *pt = &sensor_points[meas->sensor_idx * 3];
 
-	LinmathPoint3d sensorPtInLH;
-	ApplyAxisAnglePoseToPoint(sensorPtInLH, obj2lh, pt);
+	int jac_offset_lh = (lh + mpfunc_ctx->poseLength) * 7;
+	int jac_offset_obj = meas->object * 7;
 
-	FLT out[2];
-	reprojectModel->reprojectXY(cal, sensorPtInLH, out);
+	// Value, then the 2x6 jacobian wrt the object pose, then the 2x6 jacobian wrt the lighthouse pose
+	FLT out[2 + 12 * 2];
+	if (derivs) {
+		const survive_reproject_prepared_fn_t *fn = prepared_fn(reprojectModel, 2, true, derivs[jac_offset_lh] != 0);
+		eval_prepared(prepared, fn, fn->eval, true, lh, 2, pose, world2lh, cal, pt, out);
+	}
+	if (mpfunc_ctx->floatResiduals) {
+		// Also for jacobian passes, so the LM only ever compares residuals of the same precision
+		eval_prepared(prepared, prepared_fn(reprojectModel, 2, false, false),
+					  reprojectModel->reprojectAxisAngleFullEvalFloat, false, lh, 2, pose, world2lh, cal, pt, out);
+	} else if (!derivs) {
+		LinmathPoint3d sensorPtInLH;
+		ApplyAxisAnglePoseToPoint(sensorPtInLH, obj2lh, pt);
+		reprojectModel->reprojectXY(cal, sensorPtInLH, out);
+	}
 
 	deviates[0] = (out[meas[0].axis] - meas[0].value) / meas[0].variance;
 	deviates[1] = (out[meas[1].axis] - meas[1].value) / meas[1].variance;
@@ -210,19 +267,8 @@ static inline void run_pair_measurement(survive_optimizer *mpfunc_ctx, size_t me
 			deviates[i] = MAX_DEVIATE;
 
 	if (derivs) {
-		int jac_offset_lh = (lh + mpfunc_ctx->poseLength) * 7;
-		int jac_offset_obj = meas->object * 7;
-
-		LinmathAxisAnglePose safe_pose = *pose, safe_world2lh = *world2lh;
-		if (magnitude3d(safe_pose.AxisAngleRot) == 0)
-			safe_pose.AxisAngleRot[0] = 1e-10;
-		if (magnitude3d(safe_world2lh.AxisAngleRot) == 0)
-			safe_world2lh.AxisAngleRot[0] = 1e-10;
-
 		if (derivs[jac_offset_obj]) {
-			FLT jout[7 * 2] = {0};
-			// reprojectModel->reprojectFullJacObjPose(out, pose, pt, world2lh, cal);
-			reprojectModel->reprojectAxisAngleFullJacObjPose(jout, pose, pt, world2lh, cal);
+			FLT *jout = out + 2;
 			// SV_INFO("Double obj %3d %3d %f", jac_offset_obj, meas_idx, out[0]);
 			for (int j = 0; j < 6; j++) {
 				assert(derivs[jac_offset_obj + j] && "all 7 parameters should be the same for jacobian calculation");
@@ -239,14 +285,13 @@ static inline void run_pair_measurement(survive_optimizer *mpfunc_ctx, size_t me
 		}
 
 		if (derivs[jac_offset_lh]) {
-			FLT out[7 * 2] = {0};
-			reprojectModel->reprojectAxisAngleFullJacLhPose(out, pose, pt, world2lh, cal);
+			const FLT *jout = out + 2 + 12;
 			for (int j = 0; j < 6; j++) {
 				assert(derivs[jac_offset_lh + j] && "all 7 parameters should be the same for jacobian calculation");
-				derivs[jac_offset_lh + j][meas_idx] = out[j];
-				derivs[jac_offset_lh + j][meas_idx + 1] = out[j + 6];
-				assert(isfinite(out[j]));
-				assert(isfinite(out[j + 6]));
+				derivs[jac_offset_lh + j][meas_idx] = jout[j];
+				derivs[jac_offset_lh + j][meas_idx + 1] = jout[j + 6];
+				assert(isfinite(jout[j]));
+				assert(isfinite(jout[j + 6]));
 			}
 		}
 	}
@@ -255,40 +300,48 @@ static void run_single_measurement(survive_optimizer *mpfunc_ctx, size_t meas_id
 								   const survive_reproject_model_t *reprojectModel,
 								   const survive_optimizer_measurement *meas, const LinmathAxisAnglePose *pose,
 								   const LinmathAxisAnglePose *obj2lh, const LinmathAxisAnglePose *world2lh,
-								   FLT *deviates, FLT **derivs) {
-	SurviveContext *ctx = mpfunc_ctx->sos[0]->ctx;
+								   prepared_reprojection *prepared, FLT *deviates, FLT **derivs) {
 	const int lh = meas->lh;
 	const FLT *sensor_points = survive_optimizer_get_sensors(mpfunc_ctx, meas->object);
 	const struct BaseStationCal *cal = survive_optimizer_get_calibration(mpfunc_ctx, lh);
 	const FLT *pt = &sensor_points[meas->sensor_idx * 3];
 
-	LinmathPoint3d sensorPtInLH;
-	ApplyAxisAnglePoseToPoint(sensorPtInLH, obj2lh, pt);
-
-	FLT out = reprojectModel->reprojectAxisFn[meas->axis](cal, sensorPtInLH);
-	deviates[0] = (out - meas->value) / meas->variance;
-	assert(isfinite(deviates[0]));
+	int jac_offset_lh = (lh + mpfunc_ctx->poseLength) * 7;
+	int jac_offset_obj = meas->object * 7;
 
+	// Value, then the jacobian wrt the object pose, then the jacobian wrt the lighthouse pose
+	FLT out[1 + 6 * 2];
 	if (derivs) {
-		int jac_offset_lh = (lh + mpfunc_ctx->poseLength) * 7;
-		int jac_offset_obj = meas->object * 7;
+		const survive_reproject_prepared_fn_t *fn =
+			prepared_fn(reprojectModel, meas->axis, true, derivs[jac_offset_lh] != 0);
+		eval_prepared(prepared, fn, fn->eval, true, lh, meas->axis, pose, world2lh, cal, pt, out);
+	}
+	if (mpfunc_ctx->floatResiduals) {
+		eval_prepared(prepared, prepared_fn(reprojectModel, meas->axis, false, false),
+					  reprojectModel->reprojectAxisAngleAxisEvalFloat[meas->axis], false, lh, meas->axis, pose,
+					  world2lh, cal, pt, out);
+	} else if (!derivs) {
+		LinmathPoint3d sensorPtInLH;
+		ApplyAxisAnglePoseToPoint(sensorPtInLH, obj2lh, pt);
+		out[0] = reprojectModel->reprojectAxisFn[meas->axis](cal, sensorPtInLH);
+	}
 
-		FLT out[7] = {0};
+	deviates[0] = (out[0] - meas->value) / meas->variance;
+	assert(isfinite(deviates[0]));
 
+	if (derivs) {
 		if (derivs[jac_offset_obj]) {
-			reprojectModel->reprojectAxisAngleAxisJacobFn[meas->axis](out, pose, pt, world2lh, cal);
 			for (int j = 0; j < 6; j++) {
 				assert(derivs[jac_offset_obj + j]);
-				derivs[jac_offset_obj + j][meas_idx] = isfinite(out[j]) ? out[j] : 0;
+				derivs[jac_offset_obj + j][meas_idx] = isfinite(out[1 + j]) ? out[1 + j] : 0;
 				//assert(isfinite(out[j]));
 			}
 		}
 
 		if (derivs[jac_offset_lh]) {
-			reprojectModel->reprojectAxisAngleAxisJacobLhPoseFn[meas->axis](out, pose, pt, world2lh, cal);
 			for (int j = 0; j < 6; j++) {
 				assert(derivs[jac_offset_lh + j]);
-				derivs[jac_offset_lh + j][meas_idx] = isfinite(out[j]) ? out[j] : 0;
+				derivs[jac_offset_lh + j][meas_idx] = isfinite(out[7 + j]) ? out[7 + j] : 0;
 				//assert(isfinite(out[j]));
 			}
 		}
@@ -401,43 +454,27 @@ static void filter_measurements(survive_optimizer *optimizer, FLT *deviates) {
 
 	optimizer->needsFiltering = false;
 }
-static int mpfunc(int m, int n, FLT *p, FLT *deviates, FLT **derivs, void *private) {
-	survive_optimizer *mpfunc_ctx = private;
-
+// Evaluates the first meas_count measurements
+static void mpfunc_eval(survive_optimizer *mpfunc_ctx, int meas_count, FLT *deviates, FLT **derivs,
+						prepared_reprojection *prepared) {
 	const survive_reproject_model_t *reprojectModel = mpfunc_ctx->reprojectModel;
-	mpfunc_ctx->parameters = p;
-
 	SurvivePose *cameras = survive_optimizer_get_camera(mpfunc_ctx);
 
-	int start = survive_optimizer_get_camera_index(mpfunc_ctx);
-	for (int i = 0; i < mpfunc_ctx->cameraLength; i++) {
-		if (!mpfunc_ctx->parameters_info[start + 7 * i].fixed) {
-			// quatnormalize(cameras[i].Rot, cameras[i].Rot);
-		}
-	}
-
 	int pose_idx = -1;
 	// SurvivePose *pose = 0;
 	// SurvivePose obj2lh[NUM_GEN2_LIGHTHOUSES] = {0};
 	LinmathAxisAnglePose *pose = 0;
 	LinmathAxisAnglePose obj2lh[NUM_GEN2_LIGHTHOUSES] = {0};
-
-	int meas_count = m;
-	if (mpfunc_ctx->current_bias > 0) {
-		meas_count -= 7;
-		FLT *pp = (FLT *)mpfunc_ctx->initialPose.Pos;
-		for (int i = 0; i < 7; i++) {
-			deviates[i + meas_count] = (p[i] - pp[i]) * mpfunc_ctx->current_bias;
-			if (derivs) {
-				derivs[i][i + meas_count] = mpfunc_ctx->current_bias;
-			}
-		}
+	if (derivs || mpfunc_ctx->floatResiduals) {
+		// The poses have changed since the last evaluation, so nothing prepared then is valid anymore
+		memset(prepared->fn, 0, sizeof(prepared->fn));
+	} else {
+		prepared = 0;
 	}
 
 	for (int i = 0; i < meas_count; i++) {
 		const survive_optimizer_measurement *meas = &mpfunc_ctx->measurements[i];
 		const int lh = meas->lh;
-		const FLT *sensor_points = survive_optimizer_get_sensors(mpfunc_ctx, meas->object);
 
 		if (meas->invalid) {
 			deviates[i] = 0;
@@ -456,7 +493,6 @@ static int mpfunc(int m, int n, FLT *p, FLT *deviates, FLT **derivs, void *priva
 		}
 
 		LinmathAxisAnglePose *world2lh = (LinmathAxisAnglePose *)&cameras[lh];
-		const FLT *pt = &sensor_points[meas->sensor_idx * 3];
 
 		if (pose_idx != meas->object) {
 			pose_idx = meas->object;
@@ -468,25 +504,58 @@ static int mpfunc(int m, int n, FLT *p, FLT *deviates, FLT **derivs, void *priva
 			for (int lh = 0; lh < lh_count; lh++) {
 				ApplyAxisAnglePoseToPose(&obj2lh[lh], (const LinmathAxisAnglePose *)&cameras[lh], pose);
 			}
+			if (prepared) {
+				memset(prepared->fn, 0, sizeof(prepared->fn));
+			}
 		}
 
 		// If the next two measurements are joined; handle the full pair. This lets us just calculate
 		// sensorPtInLH once
-		const bool nextIsPair = i + 1 < m && meas[0].axis == 0 && meas[1].axis == 1 &&
+		const bool nextIsPair = i + 1 < meas_count && meas[0].axis == 0 && meas[1].axis == 1 &&
 								meas[0].sensor_idx == meas[1].sensor_idx && !meas[1].invalid;
 
-		LinmathPoint3d sensorPtInLH;
-		ApplyAxisAnglePoseToPoint(sensorPtInLH, &obj2lh[lh], pt);
-
 		if (nextIsPair) {
-			run_pair_measurement(mpfunc_ctx, i, reprojectModel, meas, pose, &obj2lh[lh], world2lh, deviates + i,
-								 derivs);
+			run_pair_measurement(mpfunc_ctx, i, reprojectModel, meas, pose, &obj2lh[lh], world2lh, prepared,
+								 deviates + i, derivs);
 			i++;
 		} else {
-			run_single_measurement(mpfunc_ctx, i, reprojectModel, meas, pose, &obj2lh[lh], world2lh, deviates + i,
-								   derivs);
+			run_single_measurement(mpfunc_ctx, i, reprojectModel, meas, pose, &obj2lh[lh], world2lh, prepared,
+								   deviates + i, derivs);
 		}
 	}
+}
+
+static int mpfunc(int m, int n, FLT *p, FLT *deviates, FLT **derivs, void *private) {
+	survive_optimizer *mpfunc_ctx = private;
+	if (mpfunc_ctx->cancelled) {
+		return SURVIVE_OPTIMIZER_CANCELLED;
+	}
+
+	mpfunc_ctx->parameters = p;
+
+	int meas_count = m;
+	if (mpfunc_ctx->current_bias > 0) {
+		meas_count -= 7;
+		FLT *pp = (FLT *)mpfunc_ctx->initialPose.Pos;
+		for (int i = 0; i < 7; i++) {
+			deviates[i + meas_count] = (p[i] - pp[i]) * mpfunc_ctx->current_bias;
+			if (derivs) {
+				derivs[i][i + meas_count] = mpfunc_ctx->current_bias;
+			}
+		}
+	}
+
+	// Only evaluations from outside survive_optimizer_run, like survive_optimizer_current_norm, lack a buffer
+	prepared_reprojection *prepared = mpfunc_ctx->prepared;
+	if (prepared == 0 && (derivs || mpfunc_ctx->floatResiduals)) {
+		prepared = SV_MALLOC(sizeof(prepared_reprojection));
+	}
+
+	mpfunc_eval(mpfunc_ctx, meas_count, deviates, derivs, prepared);
+
+	if (prepared != mpfunc_ctx->prepared) {
+		free(prepared);
+	}
 
 	if (mpfunc_ctx->needsFiltering) {
 		assert(derivs == 0);
@@ -496,7 +565,567 @@ static int mpfunc(int m, int n, FLT *p, FLT *deviates, FLT **derivs, void *priva
 	if (mpfunc_ctx->iteration_cb) {
 		mpfunc_ctx->iteration_cb(mpfunc_ctx, m, n, p, deviates, derivs);
 	}
-	return 0;
+	return mpfunc_ctx->cancelled ? SURVIVE_OPTIMIZER_CANCELLED : 0;
+}
+
+/*
+ * Sparse Levenberg-Marquardt backend.
+ *
+ * Every measurement depends on exactly one object pose and one lighthouse pose, so J^T * J is made up of a block
+ * diagonal over the objects (U), a block diagonal over the lighthouses (V) and a coupling block for every object /
+ * lighthouse pair (W):
+ *
+ *  | U   W | | dObj |     | gObj |
+ *  | W^T V | | dLh  | = - | gLh  |
+ *
+ * The object blocks are eliminated, leaving the Schur complement S = V - W^T * U^-1 * W on the lighthouse block. S is
+ * only 6 * cameraLength wide regardless of how many objects or scenes take part, and each object step is then
+ * recovered from its own 6x6 block.
+ *
+ * The jacobian is never formed densely. mpfunc writes derivs[param][meas]; since a measurement only touches one
+ * object and one lighthouse, all object parameters share one set of 6 columns and all lighthouse parameters share
+ * another.
+ */
+#define SPARSE_BLOCK 6
+#define SPARSE_BLOCK2 (SPARSE_BLOCK * SPARSE_BLOCK)
+
+SURVIVE_EXPORT bool survive_optimizer_sparse_supported(const survive_optimizer *optimizer) {
+	if (optimizer->poseLength <= 0 || optimizer->cameraLength <= 0 || optimizer->current_bias > 0) {
+		return false;
+	}
+
+	int pose_params = (optimizer->poseLength + optimizer->cameraLength) * 7;
+	for (int i = 0; i < survive_optimizer_get_parameters_count(optimizer); i++) {
+		const struct mp_par_struct *info = &optimizer->parameters_info[i];
+		if (info->fixed) {
+			continue;
+		}
+		if (i >= pose_params || (i % 7 != 6 && info->side != 3)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+typedef struct sparse_lm_system {
+	int P, C;
+	// Lighthouses with no free parameters are left out of the reduced system entirely; lhIdx maps each lighthouse to
+	// its block in V / W / gLh or -1.
+	int *lhIdx;
+	int Cf;
+
+	FLT *U, *L, *V, *W;
+	FLT *gObj, *gLh;
+	bool *Wused;
+	bool *objFree, *lhFree;
+} sparse_lm_system;
+
+static void sparse_lm_accumulate(const survive_optimizer *opt, sparse_lm_system *sys, int m, const FLT *deviates,
+								 const FLT *Jo, const FLT *Jl) {
+	const int P = sys->P, Cf = sys->Cf;
+	memset(sys->U, 0, sizeof(FLT) * SPARSE_BLOCK2 * P);
+	memset(sys->V, 0, sizeof(FLT) * SPARSE_BLOCK2 * Cf);
+	memset(sys->W, 0, sizeof(FLT) * SPARSE_BLOCK2 * P * Cf);
+	memset(sys->Wused, 0, sizeof(bool) * P * Cf);
+	memset(sys->gObj, 0, sizeof(FLT) * SPARSE_BLOCK * P);
+	memset(sys->gLh, 0, sizeof(FLT) * SPARSE_BLOCK * Cf);
+
+	for (int i = 0; i < m; i++) {
+		const survive_optimizer_measurement *meas = &opt->measurements[i];
+		if (meas->invalid) {
+			continue;
+		}
+
+		const bool *objFree = sys->objFree + meas->object * SPARSE_BLOCK;
+		FLT jo[SPARSE_BLOCK];
+		for (int j = 0; j < SPARSE_BLOCK; j++) {
+			jo[j] = objFree[j] ? Jo[j * m + i] : 0;
+		}
+
+		FLT *U = sys->U + meas->object * SPARSE_BLOCK2;
+		FLT *gObj = sys->gObj + meas->object * SPARSE_BLOCK;
+		for (int r = 0; r < SPARSE_BLOCK; r++) {
+			for (int c = r; c < SPARSE_BLOCK; c++) {
+				U[r * SPARSE_BLOCK + c] += jo[r] * jo[c];
+			}
+			gObj[r] += jo[r] * deviates[i];
+		}
+
+		int li = sys->lhIdx[meas->lh];
+		if (li < 0) {
+			continue;
+		}
+
+		const bool *lhFree = sys->lhFree + meas->lh * SPARSE_BLOCK;
+		FLT jl[SPARSE_BLOCK];
+		for (int j = 0; j < SPARSE_BLOCK; j++) {
+			jl[j] = lhFree[j] ? Jl[j * m + i] : 0;
+		}
+
+		FLT *V = sys->V + li * SPARSE_BLOCK2;
+		FLT *W = sys->W + (meas->object * Cf + li) * SPARSE_BLOCK2;
+		FLT *gLh = sys->gLh + li * SPARSE_BLOCK;
+		sys->Wused[meas->object * Cf + li] = true;
+		for (int r = 0; r < SPARSE_BLOCK; r++) {
+			for (int c = 0; c < SPARSE_BLOCK; c++) {
+				W[r * SPARSE_BLOCK + c] += jo[r] * jl[c];
+			}
+			for (int c = r; c < SPARSE_BLOCK; c++) {
+				V[r * SPARSE_BLOCK + c] += jl[r] * jl[c];
+			}
+			gLh[r] += jl[r] * deviates[i];
+		}
+	}
+
+	// Only the upper triangles were accumulated above
+	for (int b = 0; b < P + Cf; b++) {
+		FLT *A = b < P ? sys->U + b * SPARSE_BLOCK2 : sys->V + (b - P) * SPARSE_BLOCK2;
+		for (int r = 1; r < SPARSE_BLOCK; r++) {
+			for (int c = 0; c < r; c++) {
+				A[r * SPARSE_BLOCK + c] = A[c * SPARSE_BLOCK + r];
+			}
+		}
+	}
+}
+
+// Marquardt damping; fixed parameters get an identity row so they come out with a zero step
+static void sparse_lm_damp(FLT *dst, const FLT *src, const bool *is_free, FLT lambda) {
+	for (int r = 0; r < SPARSE_BLOCK; r++) {
+		for (int c = 0; c < SPARSE_BLOCK; c++) {
+			FLT v = is_free[r] && is_free[c] ? src[r * SPARSE_BLOCK + c] : 0;
+			if (r == c) {
+				v = is_free[r] ? v + lambda * linmath_max(v, 1e-9) : 1;
+			}
+			dst[r * SPARSE_BLOCK + c] = v;
+		}
+	}
+}
+
+// In place cholesky factorization of a 6x6 SPD block; the lower triangle is overwritten with L
+static bool sparse_lm_cholesky(FLT *A) {
+	for (int j = 0; j < SPARSE_BLOCK; j++) {
+		FLT d = A[j * SPARSE_BLOCK + j];
+		for (int k = 0; k < j; k++) {
+			d -= A[j * SPARSE_BLOCK + k] * A[j * SPARSE_BLOCK + k];
+		}
+		if (!(d > 0)) {
+			return false;
+		}
+		d = FLT_SQRT(d);
+		A[j * SPARSE_BLOCK + j] = d;
+
+		for (int i = j + 1; i < SPARSE_BLOCK; i++) {
+			FLT v = A[i * SPARSE_BLOCK + j];
+			for (int k = 0; k < j; k++) {
+				v -= A[i * SPARSE_BLOCK + k] * A[j * SPARSE_BLOCK + k];
+			}
+			A[i * SPARSE_BLOCK + j] = v / d;
+		}
+	}
+	return true;
+}
+
+// Solves L L^T x = b in place; b is read with the given stride so matrix columns can be solved directly
+static void sparse_lm_cholesky_solve(const FLT *L, FLT *b, int stride) {
+	for (int i = 0; i < SPARSE_BLOCK; i++) {
+		FLT v = b[i * stride];
+		for (int k = 0; k < i; k++) {
+			v -= L[i * SPARSE_BLOCK + k] * b[k * stride];
+		}
+		b[i * stride] = v / L[i * SPARSE_BLOCK + i];
+	}
+	for (int i = SPARSE_BLOCK - 1; i >= 0; i--) {
+		FLT v = b[i * stride];
+		for (int k = i + 1; k < SPARSE_BLOCK; k++) {
+			v -= L[k * SPARSE_BLOCK + i] * b[k * stride];
+		}
+		b[i * stride] = v / L[i * SPARSE_BLOCK + i];
+	}
+}
+
+// Solves the damped system for the step; returns false if it wasn't positive definite or gave a non-finite step.
+static bool sparse_lm_solve(sparse_lm_system *sys, FLT lambda, FLT *dObj, FLT *dLh) {
+	const int P = sys->P, Cf = sys->Cf, N = Cf * SPARSE_BLOCK;
+
+	for (int o = 0; o < P; o++) {
+		FLT *L = sys->L + o * SPARSE_BLOCK2;
+		sparse_lm_damp(L, sys->U + o * SPARSE_BLOCK2, sys->objFree + o * SPARSE_BLOCK, lambda);
+		if (!sparse_lm_cholesky(L)) {
+			return false;
+		}
+
+		// dObj starts out as U^-1 gObj
+		memcpy(dObj + o * SPARSE_BLOCK, sys->gObj + o * SPARSE_BLOCK, sizeof(FLT) * SPARSE_BLOCK);
+		sparse_lm_cholesky_solve(L, dObj + o * SPARSE_BLOCK, 1);
+	}
+
+	if (N > 0) {
+		// S = V - sum W^T U^-1 W, b = -gLh + sum W^T U^-1 gObj
+		FLT *S = alloca(sizeof(FLT) * N * N);
+		FLT *b = alloca(sizeof(FLT) * N);
+		memset(S, 0, sizeof(FLT) * N * N);
+		for (int l = 0; l < sys->C; l++) {
+			int li = sys->lhIdx[l];
+			if (li < 0) {
+				continue;
+			}
+			FLT damped[SPARSE_BLOCK2];
+			sparse_lm_damp(damped, sys->V + li * SPARSE_BLOCK2, sys->lhFree + l * SPARSE_BLOCK, lambda);
+			for (int r = 0; r < SPARSE_BLOCK; r++) {
+				for (int c = 0; c < SPARSE_BLOCK; c++) {
+					S[(li * SPARSE_BLOCK + r) * N + li * SPARSE_BLOCK + c] = damped[r * SPARSE_BLOCK + c];
+				}
+				b[li * SPARSE_BLOCK + r] = -sys->gLh[li * SPARSE_BLOCK + r];
+			}
+		}
+
+		FLT *iUW = alloca(sizeof(FLT) * SPARSE_BLOCK2 * Cf);
+		for (int o = 0; o < P; o++) {
+			const FLT *L = sys->L + o * SPARSE_BLOCK2;
+			const FLT *iUg = dObj + o * SPARSE_BLOCK;
+			const bool *used = sys->Wused + o * Cf;
+
+			for (int l = 0; l < Cf; l++) {
+				if (!used[l])
+					continue;
+
+				const FLT *W = sys->W + (o * Cf + l) * SPARSE_BLOCK2;
+				FLT *iUWl = iUW + l * SPARSE_BLOCK2;
+				memcpy(iUWl, W, sizeof(FLT) * SPARSE_BLOCK2);
+				for (int c = 0; c < SPARSE_BLOCK; c++) {
+					sparse_lm_cholesky_solve(L, iUWl + c, SPARSE_BLOCK);
+				}
+
+				for (int c = 0; c < SPARSE_BLOCK; c++) {
+					FLT v = 0;
+					for (int k = 0; k < SPARSE_BLOCK; k++) {
+						v += W[k * SPARSE_BLOCK + c] * iUg[k];
+					}
+					b[l * SPARSE_BLOCK + c] += v;
+				}
+			}
+
+			for (int l1 = 0; l1 < Cf; l1++) {
+				if (!used[l1])
+					continue;
+				const FLT *W1 = sys->W + (o * Cf + l1) * SPARSE_BLOCK2;
+				for (int l2 = 0; l2 < Cf; l2++) {
+					if (!used[l2])
+						continue;
+					const FLT *iUW2 = iUW + l2 * SPARSE_BLOCK2;
+					for (int r = 0; r < SPARSE_BLOCK; r++) {
+						for (int c = 0; c < SPARSE_BLOCK; c++) {
+							FLT v = 0;
+							for (int k = 0; k < SPARSE_BLOCK; k++) {
+								v += W1[k * SPARSE_BLOCK + r] * iUW2[k * SPARSE_BLOCK + c];
+							}
+							S[(l1 * SPARSE_BLOCK + r) * N + l2 * SPARSE_BLOCK + c] -= v;
+						}
+					}
+				}
+			}
+		}
+
+		// Fixed lighthouse parameters have no coupling terms, so their rows are still identity here
+		SvMat Sm = svMat(N, N, S), bm = svMat(N, 1, b), xm = svMat(N, 1, dLh);
+		svSolve(&Sm, &bm, &xm, SV_INVERT_METHOD_LU);
+	}
+
+	// dObj = U^-1 (-gObj - W dLh) = -U^-1 gObj - U^-1 W dLh
+	for (int o = 0; o < P; o++) {
+		FLT rhs[SPARSE_BLOCK] = {0};
+		for (int l = 0; l < Cf; l++) {
+			if (!sys->Wused[o * Cf + l])
+				continue;
+			const FLT *W = sys->W + (o * Cf + l) * SPARSE_BLOCK2;
+			for (int r = 0; r < SPARSE_BLOCK; r++) {
+				for (int c = 0; c < SPARSE_BLOCK; c++) {
+					rhs[r] += W[r * SPARSE_BLOCK + c] * dLh[l * SPARSE_BLOCK + c];
+				}
+			}
+		}
+		sparse_lm_cholesky_solve(sys->L + o * SPARSE_BLOCK2, rhs, 1);
+		for (int r = 0; r < SPARSE_BLOCK; r++) {
+			dObj[o * SPARSE_BLOCK + r] = -dObj[o * SPARSE_BLOCK + r] - rhs[r];
+		}
+	}
+
+	for (int i = 0; i < N; i++) {
+		if (!isfinite(dLh[i]))
+			return false;
+	}
+	for (int i = 0; i < P * SPARSE_BLOCK; i++) {
+		if (!isfinite(dObj[i]))
+			return false;
+	}
+	return true;
+}
+
+static FLT sparse_lm_norm(const FLT *v, int n) {
+	FLT rtn = 0;
+	for (int i = 0; i < n; i++) {
+		rtn += v[i] * v[i];
+	}
+	return rtn;
+}
+
+#define SPARSE_LM_SWAP(type, a, b)                                                                                     \
+	{                                                                                                                  \
+		type tmp = a;                                                                                                  \
+		a = b;                                                                                                         \
+		b = tmp;                                                                                                       \
+	}
+
+static int sparse_lm_run(survive_optimizer *optimizer, mp_config *cfg, struct mp_result_struct *result) {
+	const int m = optimizer->measurementsCnt;
+	const int n = survive_optimizer_get_parameters_count(optimizer);
+	const int P = optimizer->poseLength, C = optimizer->cameraLength;
+	// mpfunc points optimizer->parameters at whichever buffer it was last evaluated with
+	FLT *params = optimizer->parameters;
+
+	FLT ftol = cfg && cfg->ftol > 0 ? cfg->ftol : 1e-10;
+	FLT xtol = cfg && cfg->xtol > 0 ? cfg->xtol : 1e-10;
+	FLT gtol = cfg && cfg->gtol > 0 ? cfg->gtol : 1e-10;
+	FLT normtol = cfg && cfg->normtol > 0 ? cfg->normtol : 0;
+	int maxiter = cfg && cfg->maxiter > 0 ? cfg->maxiter : 200;
+	int maxfev = cfg ? cfg->maxfev : 0;
+	if (cfg && cfg->maxiter == MP_NO_ITER) {
+		maxiter = 0;
+	}
+
+	if (m <= 0) {
+		return MP_ERR_NPOINTS;
+	}
+
+	sparse_lm_system sys = {.P = P, .C = C};
+	sys.lhIdx = SV_MALLOC(sizeof(int) * C);
+	sys.objFree = SV_CALLOC(sizeof(bool) * SPARSE_BLOCK * P);
+	sys.lhFree = SV_CALLOC(sizeof(bool) * SPARSE_BLOCK * C);
+
+	FLT *x = SV_MALLOC(sizeof(FLT) * n);
+	FLT *x_new = SV_MALLOC(sizeof(FLT) * n);
+	FLT *deviates = SV_MALLOC(sizeof(FLT) * m);
+	FLT *deviates_new = SV_MALLOC(sizeof(FLT) * m);
+	FLT *J = SV_MALLOC(sizeof(FLT) * SPARSE_BLOCK * m * 4);
+	FLT *Jo = J, *Jl = J + SPARSE_BLOCK * m, *Jo_new = J + 2 * SPARSE_BLOCK * m, *Jl_new = J + 3 * SPARSE_BLOCK * m;
+	FLT **derivs = SV_CALLOC(sizeof(FLT *) * n);
+	FLT **derivs_new = SV_CALLOC(sizeof(FLT *) * n);
+	memcpy(x, params, sizeof(FLT) * n);
+
+	int nfree = 0;
+	for (int blk = 0; blk < P + C; blk++) {
+		bool *is_free = blk < P ? sys.objFree + blk * SPARSE_BLOCK : sys.lhFree + (blk - P) * SPARSE_BLOCK;
+		bool any_free = false;
+		for (int j = 0; j < SPARSE_BLOCK; j++) {
+			is_free[j] = !optimizer->parameters_info[blk * 7 + j].fixed;
+			any_free |= is_free[j];
+			nfree += is_free[j];
+		}
+		if (blk >= P) {
+			sys.lhIdx[blk - P] = any_free ? sys.Cf++ : -1;
+		}
+		if (any_free) {
+			for (int j = 0; j < SPARSE_BLOCK; j++) {
+				derivs[blk * 7 + j] = (blk < P ? Jo : Jl) + j * m;
+				derivs_new[blk * 7 + j] = (blk < P ? Jo_new : Jl_new) + j * m;
+			}
+		}
+	}
+
+	sys.U = SV_MALLOC(sizeof(FLT) * SPARSE_BLOCK2 * P);
+	sys.L = SV_MALLOC(sizeof(FLT) * SPARSE_BLOCK2 * P);
+	sys.V = SV_MALLOC(sizeof(FLT) * SPARSE_BLOCK2 * sys.Cf);
+	sys.W = SV_MALLOC(sizeof(FLT) * SPARSE_BLOCK2 * P * sys.Cf);
+	sys.Wused = SV_MALLOC(sizeof(bool) * P * sys.Cf);
+	sys.gObj = SV_MALLOC(sizeof(FLT) * SPARSE_BLOCK * P);
+	sys.gLh = SV_MALLOC(sizeof(FLT) * SPARSE_BLOCK * sys.Cf);
+	FLT *dObj = SV_MALLOC(sizeof(FLT) * SPARSE_BLOCK * P);
+	FLT *dLh = SV_MALLOC(sizeof(FLT) * SPARSE_BLOCK * sys.Cf);
+
+	int status = 0, iter = 0, nfev = 0;
+	FLT lambda = 1e-3;
+
+	// The first evaluation is what runs the measurement filter, which has to happen without jacobians
+	int rc = mpfunc(m, n, x, deviates, 0, optimizer);
+	nfev++;
+	FLT cost = sparse_lm_norm(deviates, m);
+	FLT orig_cost = cost;
+	bool have_jacobian = false;
+
+	if (rc < 0) {
+		status = rc;
+	} else if (nfree == 0) {
+		status = MP_ERR_NFREE;
+	} else if (!isfinite(cost)) {
+		status = MP_ERR_NAN;
+	} else if (normtol > 0 && cost < normtol) {
+		status = MP_OK_NORM;
+	}
+
+	while (status == 0) {
+		if (iter >= maxiter || (maxfev > 0 && nfev >= maxfev)) {
+			status = MP_MAXITER;
+			break;
+		}
+
+		if (!have_jacobian) {
+			memset(Jo, 0, sizeof(FLT) * SPARSE_BLOCK * m);
+			memset(Jl, 0, sizeof(FLT) * SPARSE_BLOCK * m);
+			rc = mpfunc(m, n, x, deviates, derivs, optimizer);
+			nfev++;
+			if (rc < 0) {
+				status = rc;
+				break;
+			}
+			have_jacobian = true;
+		}
+		sparse_lm_accumulate(optimizer, &sys, m, deviates, Jo, Jl);
+
+		// Cosine of the angle between the residual and any jacobian column
+		FLT gmax = 0;
+		for (int blk = 0; blk < P + C; blk++) {
+			int bi = blk < P ? blk : sys.lhIdx[blk - P];
+			if (bi < 0)
+				continue;
+			const FLT *J2 = blk < P ? sys.U + bi * SPARSE_BLOCK2 : sys.V + bi * SPARSE_BLOCK2;
+			const FLT *g = blk < P ? sys.gObj + bi * SPARSE_BLOCK : sys.gLh + bi * SPARSE_BLOCK;
+			for (int j = 0; j < SPARSE_BLOCK; j++) {
+				FLT d = J2[j * SPARSE_BLOCK + j];
+				if (d > 0)
+					gmax = linmath_max(gmax, fabs(g[j]) / FLT_SQRT(d * cost));
+			}
+		}
+		if (gmax <= gtol) {
+			status = MP_OK_DIR;
+			break;
+		}
+
+		while (status == 0) {
+			if (sparse_lm_solve(&sys, lambda, dObj, dLh)) {
+				memcpy(x_new, x, sizeof(FLT) * n);
+				FLT step_norm = 0, x_norm = 0;
+				for (int blk = 0; blk < P + C; blk++) {
+					int bi = blk < P ? blk : sys.lhIdx[blk - P];
+					if (bi < 0)
+						continue;
+					const FLT *d = blk < P ? dObj + bi * SPARSE_BLOCK : dLh + bi * SPARSE_BLOCK;
+					const bool *is_free =
+						blk < P ? sys.objFree + blk * SPARSE_BLOCK : sys.lhFree + (blk - P) * SPARSE_BLOCK;
+					for (int j = 0; j < SPARSE_BLOCK; j++) {
+						if (!is_free[j])
+							continue;
+						int idx = blk * 7 + j;
+						const struct mp_par_struct *info = &optimizer->parameters_info[idx];
+						x_new[idx] = x[idx] + d[j];
+						if (info->limited[0] && x_new[idx] < info->limits[0])
+							x_new[idx] = info->limits[0];
+						if (info->limited[1] && x_new[idx] > info->limits[1])
+							x_new[idx] = info->limits[1];
+						step_norm += (x_new[idx] - x[idx]) * (x_new[idx] - x[idx]);
+						x_norm += x[idx] * x[idx];
+					}
+				}
+
+				// The trial point is evaluated with jacobians; if the step is accepted they are what the next
+				// iteration needs.
+				memset(Jo_new, 0, sizeof(FLT) * SPARSE_BLOCK * m);
+				memset(Jl_new, 0, sizeof(FLT) * SPARSE_BLOCK * m);
+				rc = mpfunc(m, n, x_new, deviates_new, derivs_new, optimizer);
+				nfev++;
+				if (rc < 0) {
+					status = rc;
+					break;
+				}
+				FLT new_cost = sparse_lm_norm(deviates_new, m);
+
+				bool small_step = FLT_SQRT(step_norm) <= xtol * FLT_SQRT(x_norm);
+				if (isfinite(new_cost) && new_cost < cost) {
+					iter++;
+
+					FLT reduction = (cost - new_cost) / cost;
+					SPARSE_LM_SWAP(FLT *, x, x_new);
+					SPARSE_LM_SWAP(FLT *, deviates, deviates_new);
+					SPARSE_LM_SWAP(FLT *, Jo, Jo_new);
+					SPARSE_LM_SWAP(FLT *, Jl, Jl_new);
+					SPARSE_LM_SWAP(FLT **, derivs, derivs_new);
+					cost = new_cost;
+					lambda = linmath_max(lambda / 10., 1e-12);
+
+					if (normtol > 0 && cost < normtol) {
+						status = MP_OK_NORM;
+					} else if (small_step) {
+						status = reduction <= ftol ? MP_OK_BOTH : MP_OK_PAR;
+					} else if (reduction <= ftol) {
+						status = MP_OK_CHI;
+					}
+					break;
+				}
+
+				// A step this small that still doesn't improve things means we are at the minimum
+				if (small_step) {
+					status = MP_OK_PAR;
+					break;
+				}
+			}
+
+			lambda *= 10.;
+			if (lambda > 1e16) {
+				status = MP_XTOL;
+			} else if (maxfev > 0 && nfev >= maxfev) {
+				status = MP_MAXITER;
+			}
+		}
+	}
+
+	if (status > 0) {
+		memcpy(params, x, sizeof(FLT) * n);
+	}
+	optimizer->parameters = params;
+
+	if (result) {
+		int npegged = 0;
+		for (int i = 0; i < n; i++) {
+			const struct mp_par_struct *info = &optimizer->parameters_info[i];
+			if (!info->fixed && ((info->limited[0] && x[i] == info->limits[0]) ||
+								 (info->limited[1] && x[i] == info->limits[1])))
+				npegged++;
+		}
+		result->bestnorm = cost;
+		result->orignorm = orig_cost;
+		result->niter = iter;
+		result->nfev = nfev;
+		result->status = status;
+		result->npar = n;
+		result->nfree = nfree;
+		result->npegged = npegged;
+		result->nfunc = m;
+		if (result->resid) {
+			memcpy(result->resid, deviates, sizeof(FLT) * m);
+		}
+		strncpy(result->version, MPFIT_VERSION, sizeof(result->version) - 1);
+	}
+
+	free(sys.lhIdx);
+	free(sys.objFree);
+	free(sys.lhFree);
+	free(sys.U);
+	free(sys.L);
+	free(sys.V);
+	free(sys.W);
+	free(sys.Wused);
+	free(sys.gObj);
+	free(sys.gLh);
+	free(x);
+	free(x_new);
+	free(deviates);
+	free(deviates_new);
+	free(J);
+	free(derivs);
+	free(derivs_new);
+	free(dObj);
+	free(dLh);
+
+	return status;
 }
 
 const char *survive_optimizer_error(int status) {
@@ -515,6 +1144,7 @@ const char *survive_optimizer_error(int status) {
 		CASE(MP_ERR_BOUNDS);
 		CASE(MP_ERR_PARAM);
 		CASE(MP_ERR_DOF);
+		CASE(SURVIVE_OPTIMIZER_CANCELLED);
 
 		/* Potential success status codes */
 		CASE(MP_OK_CHI);
@@ -534,9 +1164,13 @@ const char *survive_optimizer_error(int status) {
 
 static SurviveContext *cachedCtx = 0;
 static mp_config cachedCfg = {0};
+static bool cachedFloatResiduals = false;
+static bool cacheValid = false;
 
+// Config lookups aren't free, so they are only redone when the context changes
 static mp_config *survive_optimizer_get_cfg(SurviveContext *ctx) {
-	if (ctx != cachedCtx) {
+	if (!cacheValid || ctx != cachedCtx) {
+		cachedFloatResiduals = survive_configi(ctx, OPTIMIZER_FLOAT_RESIDUALS_TAG, SC_GET, 0);
 		cachedCfg = (mp_config){0};
 		cachedCfg.maxiter = survive_configf(ctx, OPTIMIZER_MAXITER_TAG, SC_GET, 0);
 		cachedCfg.maxfev = survive_configf(ctx, OPTIMIZER_MAXFEV_TAG, SC_GET, 0);
@@ -549,11 +1183,19 @@ static mp_config *survive_optimizer_get_cfg(SurviveContext *ctx) {
 		cachedCfg.stepfactor = survive_configf(ctx, OPTIMIZER_STEPFACTOR_TAG, SC_GET, 0);
 		cachedCfg.douserscale = survive_configi(ctx, OPTIMIZER_DOUSERSCALE_TAG, SC_GET, 0);
 		cachedCfg.nprint = survive_configi(ctx, OPTIMIZER_NPRINT_TAG, SC_GET, 0);
+		cachedCtx = ctx;
+		cacheValid = true;
 	}
 	cachedCfg.iterproc = 0;
 	return &cachedCfg;
 }
 
+void survive_optimizer_forget_context(SurviveContext *ctx) {
+	if (cachedCtx == ctx) {
+		cacheValid = false;
+	}
+}
+
 mp_config precise_cfg = {0};
 SURVIVE_EXPORT mp_config *survive_optimizer_precise_config() { return &precise_cfg; }
 
@@ -561,8 +1203,10 @@ int survive_optimizer_run(survive_optimizer *optimizer, struct mp_result_struct
 	SurviveContext *ctx = optimizer->sos[0] ? optimizer->sos[0]->ctx : 0;
 
 	mp_config *cfg = optimizer->cfg;
+	mp_config *ctx_cfg = survive_optimizer_get_cfg(ctx);
 	if (cfg == 0)
-		cfg = survive_optimizer_get_cfg(ctx);
+		cfg = ctx_cfg;
+	optimizer->floatResiduals = cachedFloatResiduals;
 
 	SurvivePose *poses = survive_optimizer_get_pose(optimizer);
 	for (int i = 0; i < optimizer->poseLength + optimizer->cameraLength; i++) {
@@ -590,9 +1234,17 @@ int survive_optimizer_run(survive_optimizer *optimizer, struct mp_result_struct
 	// MPFit runs on temporary storage; so parameters is manipulated in mpfunc. Save it and restore it here.
 	FLT *params = optimizer->parameters;
 	optimizer->needsFiltering = !optimizer->nofilter;
-	int rtn = mpfit(mpfunc, optimizer->measurementsCnt, survive_optimizer_get_parameters_count(optimizer),
+	optimizer->prepared = SV_MALLOC(sizeof(prepared_reprojection));
+	int rtn;
+	if (optimizer->backend == SURVIVE_OPTIMIZER_BACKEND_SPARSE_LM && survive_optimizer_sparse_supported(optimizer)) {
+		rtn = sparse_lm_run(optimizer, cfg, result);
+	} else {
+		rtn = mpfit(mpfunc, optimizer->measurementsCnt, survive_optimizer_get_parameters_count(optimizer),
 					optimizer->parameters, optimizer->parameters_info, cfg, optimizer, result);
+	}
 	optimizer->parameters = params;
+	free(optimizer->prepared);
+	optimizer->prepared = 0;
 
 	for (int i = 0; i < optimizer->poseLength + optimizer->cameraLength; i++) {
 		quatfromaxisangle(poses[i].Rot, poses[i].Rot, norm3d(poses[i].Rot));
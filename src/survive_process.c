@@ -56,12 +56,17 @@ void survive_default_external_pose_process(SurviveContext *ctx, const char *name
 }
 
 void survive_default_ootx_received_process(struct SurviveContext *ctx, uint8_t bsd_idx) {
+	survive_get_bsd_lock(ctx);
 	config_set_lighthouse(ctx->lh_config, &ctx->bsd[bsd_idx], bsd_idx);
-	config_save(ctx);
+	survive_release_bsd_lock(ctx);
+
+	// Not under the bsd lock; saving holds the config writer lock while it takes the bsd lock
+	config_save_async(ctx);
 }
 
 void survive_default_lighthouse_pose_process(SurviveContext *ctx, uint8_t lighthouse,
 											 const SurvivePose *lighthouse_pose) {
+	survive_get_bsd_lock(ctx);
 	if (lighthouse_pose) {
 		ctx->bsd[lighthouse].Pose = *lighthouse_pose;
 		ctx->bsd[lighthouse].PositionSet = 1;
@@ -70,11 +75,15 @@ void survive_default_lighthouse_pose_process(SurviveContext *ctx, uint8_t lighth
 	}
 
 	config_set_lighthouse(ctx->lh_config, &ctx->bsd[lighthouse], lighthouse);
-	config_save(ctx);
+	uint32_t id = ctx->bsd[lighthouse].BaseStationID;
+	uint8_t mode = ctx->bsd[lighthouse].mode;
+	survive_release_bsd_lock(ctx);
+
+	config_save_async(ctx);
 
 	survive_recording_lighthouse_process(ctx, lighthouse, lighthouse_pose);
-	SV_VERBOSE(10, "Position found for LH %d(ID: %08x, mode: %2d) " SurvivePose_format, lighthouse,
-		   (unsigned)ctx->bsd[lighthouse].BaseStationID, ctx->bsd[lighthouse].mode, SURVIVE_POSE_EXPAND(*lighthouse_pose));
+	SV_VERBOSE(10, "Position found for LH %d(ID: %08x, mode: %2d) " SurvivePose_format, lighthouse, (unsigned)id, mode,
+			   SURVIVE_POSE_EXPAND(*lighthouse_pose));
 }
 
 STATIC_CONFIG_ITEM(SURVIVE_SERIALIZE_DEV_CONFIG, "serialize-device-config", 'i', "Serialize device config files", 0)
@@ -176,6 +185,7 @@ void survive_default_raw_imu_process(SurviveObject *so, int mask, const FLT *acc
 }
 
 void survive_default_imu_process(SurviveObject *so, int mask, const FLT *accelgyromag, uint32_t timecode, int id) {
+	survive_get_so_lock(so);
 	survive_long_timecode longTimecode = SurviveSensorActivations_long_timecode_imu(&so->activations, timecode);
 	PoserDataIMU imu = {
 		.hdr = {.pt = POSERDATA_IMU, .timecode = longTimecode},
@@ -193,6 +203,7 @@ void survive_default_imu_process(SurviveObject *so, int mask, const FLT *accelgy
 			   timecode, longTimecode / 48000000., LINMATH_VEC3_EXPAND(imu.accel), LINMATH_VEC3_EXPAND(imu.gyro))
 	survive_kalman_tracker_integrate_imu(so->tracker, &imu);
 	SURVIVE_POSER_INVOKE(so, &imu);
+	survive_release_so_lock(so);
 
 	survive_recording_imu_process(so, mask, accelgyromag, timecode, id);
 }
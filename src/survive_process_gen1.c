@@ -44,7 +44,9 @@ void survive_default_light_process(SurviveObject *so, int sensor_id, int acode,
 			.length = length,
 		};
 
+		survive_get_so_lock(so);
 		SURVIVE_POSER_INVOKE(so, &l);
+		survive_release_so_lock(so);
 		SURVIVE_INVOKE_HOOK_SO(light_pulse, so, sensor_id, acode, timecode, length_sec, lh);
 
 		return;
@@ -96,10 +98,12 @@ void survive_default_angle_process(SurviveObject *so, int sensor_id, int acode,
 
 	// Simulate the use of only one lighthouse in playback mode.
 	if (lh < ctx->activeLighthouses) {
+		survive_get_so_lock(so);
 		if (SurviveSensorActivations_add(&so->activations, &l)) {
 			survive_kalman_tracker_integrate_light(so->tracker, &l.common);
 			SURVIVE_POSER_INVOKE(so, &l);
 		}
+		survive_release_so_lock(so);
 	}
 
 	survive_recording_angle_process(so, sensor_id, acode, timecode, length, angle, lh);
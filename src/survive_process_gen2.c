@@ -134,6 +134,7 @@ void survive_ootx_free_decoder_context(struct SurviveContext *ctx, int bsd_idx)
 void survive_ootx_behavior(SurviveObject *so, int8_t bsd_idx, int8_t lh_version, int ootx) {
 	struct SurviveContext *ctx = so->ctx;
 	if (ctx->bsd[bsd_idx].OOTXSet == false) {
+		survive_get_bsd_lock(ctx);
 		ootx_decoder_context *decoderContext = ctx->bsd[bsd_idx].ootx_data;
 
 		if (decoderContext == 0) {
@@ -159,11 +160,12 @@ void survive_ootx_behavior(SurviveObject *so, int8_t bsd_idx, int8_t lh_version,
 				survive_ootx_free_decoder_context(ctx, bsd_idx);
 			}
 		}
+		survive_release_bsd_lock(ctx);
 	}
 }
 
-SURVIVE_EXPORT void survive_default_sync_process(SurviveObject *so, survive_channel channel, survive_timecode timecode,
-												 bool ootx, bool gen) {
+static void survive_default_sync_process_locked(SurviveObject *so, survive_channel channel, survive_timecode timecode,
+												bool ootx, bool gen) {
 	struct SurviveContext *ctx = so->ctx;
 	int8_t bsd_idx = survive_get_bsd_idx(ctx, channel);
 	if (bsd_idx == -1) {
@@ -242,6 +244,13 @@ SURVIVE_EXPORT void survive_default_sync_process(SurviveObject *so, survive_chan
 	}
 }
 
+SURVIVE_EXPORT void survive_default_sync_process(SurviveObject *so, survive_channel channel, survive_timecode timecode,
+												 bool ootx, bool gen) {
+	survive_get_so_lock(so);
+	survive_default_sync_process_locked(so, channel, timecode, ootx, gen);
+	survive_release_so_lock(so);
+}
+
 static inline int8_t determine_plane(SurviveObject *so, int8_t bsd_idx, FLT angle) {
 	static int naive_plane_only = -1;
 	if (naive_plane_only == -1)
@@ -375,6 +384,7 @@ SURVIVE_EXPORT void survive_default_sweep_angle_process(SurviveObject *so, survi
 	SV_VERBOSE(500, "%s %7.3f Sensor ch%2d.%02d.%d %+8.3fdeg", survive_colorize(so->codename), survive_run_time(ctx),
 			   channel, sensor_id, plane, angle / LINMATHPI * 180.);
 
+	survive_get_so_lock(so);
 	// Simulate the use of only one lighthouse in playback mode.
 	if (bsd_idx < ctx->activeLighthouses) {
 		if (SurviveSensorActivations_add_gen2(&so->activations, &l) == false) {
@@ -386,6 +396,7 @@ SURVIVE_EXPORT void survive_default_sweep_angle_process(SurviveObject *so, survi
 
 	survive_recording_sweep_angle_process(so, channel, sensor_id, timecode, plane, angle);
 	SURVIVE_POSER_INVOKE(so, &l);
+	survive_release_so_lock(so);
 }
 
 SURVIVE_EXPORT void survive_default_gen_detected_process(SurviveObject *so, int lh_version) {
@@ -414,10 +425,12 @@ SURVIVE_EXPORT void survive_default_gen_detected_process(SurviveObject *so, int
 
 	for (int i = 0; i < ctx->objs_ct; i++) {
 		// When the USB devices transition; they reset their clock or something -- so clear out old data.
+		survive_get_so_lock(ctx->objs[i]);
 		SurviveSensorActivations_reset(&ctx->objs[i]->activations);
+		survive_release_so_lock(ctx->objs[i]);
 	}
 
 	ctx->lh_version = lh_version;
 	survive_configi(ctx, "configed-lighthouse-gen", SC_OVERRIDE | SC_SETCONFIG, lh_version + 1);
-	config_save(ctx);
+	config_save_async(ctx);
 }
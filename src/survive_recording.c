@@ -17,6 +17,8 @@
 #include <inttypes.h>
 
 #include "survive_recording.h"
+#include "survive_recording_binary.h"
+#include "survive_recording_index.h"
 
 #include "survive_config.h"
 #include "survive_default_devices.h"
@@ -27,6 +29,8 @@
 
 #include "survive_gz.h"
 
+#include <sys/stat.h>
+
 STATIC_CONFIG_ITEM(PLAYBACK_RECORD_RAWLIGHT, "record-rawlight", 'i', "Whether or not to output raw light data", 1)
 STATIC_CONFIG_ITEM(PLAYBACK_RECORD_IMU, "record-imu", 'i', "Whether or not to output imu data", 1)
 STATIC_CONFIG_ITEM(PLAYBACK_RECORD_CAL_IMU, "record-cal-imu", 'i', "Whether or not to output calibrated imu data", 0)
@@ -35,7 +39,35 @@ STATIC_CONFIG_ITEM(PLAYBACK_RECORD_ANGLE, "record-angle", 'i', "Whether or not t
 
 STATIC_CONFIG_ITEM(RECORD, "record", 's', "File to record to if you wish to make a recording.", "")
 STATIC_CONFIG_ITEM(RECORD_STDOUT, "record-stdout", 'i', "Whether or not to dump recording data to stdout", 0)
-  
+STATIC_CONFIG_ITEM(RECORD_INDEX_INTERVAL, "record-index-interval", 'f',
+				   "Seconds between the seek points written to the recording's .idx file; 0 disables the index", 10.)
+STATIC_CONFIG_ITEM(RECORD_QUEUE_SIZE, "record-queue-size", 'i',
+				   "Bytes of memory for records waiting on the writer thread; records are dropped when it is full. 0 "
+				   "writes from the calling thread instead",
+				   16 * 1024 * 1024)
+
+/*
+ * Events are serialized on the thread that produced them into a batch of frames, and the batch is handed to a writer
+ * thread through a ring buffer; compression and file io only ever happen on the writer thread. DATA frames hold the
+ * bytes of the recording itself, INDEX frames an entry for the .idx file, and STDOUT frames the text lines mirrored to
+ * stdout for binary recordings.
+ *
+ * Whoever holds output_lock is the single producer of the ring and the writer thread its single consumer. When the
+ * ring is full the batch is dropped and counted; only CONFIG and LH_POSE events wait for room since a recording
+ * without them can't be played back. One of those too large for the ring at all is written from the producer's thread
+ * once the writer has caught up.
+ */
+typedef enum {
+	RECORDING_FRAME_DATA,
+	RECORDING_FRAME_INDEX,
+	RECORDING_FRAME_STDOUT,
+} recording_frame_kind;
+
+typedef struct recording_frame_header {
+	uint32_t kind;
+	uint32_t len;
+} recording_frame_header;
+
 typedef struct SurviveRecordingData {
 	SurviveContext *ctx;
 	bool alwaysWriteStdOut;
@@ -44,6 +76,47 @@ typedef struct SurviveRecordingData {
 		bool writeCalIMU;
 		bool writeAngle;
 		gzFile output_file;
+
+		// Set when recording to a .bin(.gz) file
+		bool binary;
+		survive_binary_writer binary_writer;
+		// Set after a dropped batch; the binary stream is restarted so that it doesn't refer to what was dropped
+		bool binary_resync;
+
+		// Lines come in from driver and poser threads which no longer share a single lock
+		og_mutex_t output_lock;
+
+		// Frames being built by the producer, and how many recording bytes they hold
+		cstring batch;
+		size_t batch_data_offset;
+		uint64_t batch_data_len;
+		// Recording bytes queued so far, ie the uncompressed offset of the next batch
+		uint64_t stream_offset;
+		// Text form of binary records for stdout
+		cstring stdout_line;
+
+		// 0 when writing from the calling thread
+		char *queue;
+		uint32_t queue_size;
+		volatile uint32_t queue_head, queue_tail;
+		og_thread_t writer_thread;
+		volatile bool keep_running;
+		// Posted by the producer after queueing a batch, and by the writer after freeing up room. Counts can be
+		// stale, so both sides check the queue again after waking.
+		og_sema_t queue_ready, queue_space;
+		// Used by the writer thread when the pending frames wrap around the end of the queue
+		cstring unwrapped;
+
+		size_t dropped_records;
+		// Warnings are logged once output_lock is released, since logging records the message too
+		bool warn_dropped;
+		volatile bool warn_reopen_failed;
+
+		// Seek points for playback; see survive_recording_index.h
+		char *output_fn;
+		FILE *index_file;
+		bool indexing;
+		double index_interval, next_checkpoint;
 } SurviveRecordingData;
 
 static void write_to_output_raw(SurviveRecordingData *recordingData, const char *string, int len) {
@@ -51,41 +124,332 @@ static void write_to_output_raw(SurviveRecordingData *recordingData, const char
 		gzwrite(recordingData->output_file, string, len);
 	}
 
-	if (recordingData->alwaysWriteStdOut) {
+	if (recordingData->alwaysWriteStdOut && !recordingData->binary) {
 		fwrite(string, 1, len, stdout);
 	}
 }
 
-#ifdef SURVIVE_HEX_FLOATS
-#define FLT_PRINTF "%0.6a "
-#else
-#define FLT_PRINTF "%0.6f "
-#endif
+// Runs on the writer thread; compressed recordings start a new gzip member at each checkpoint
+static void write_index_entry(SurviveRecordingData *recordingData, survive_recording_index_entry *entry) {
+	if (recordingData->index_file == 0) {
+		return;
+	}
 
-void survive_recording_write_to_output(struct SurviveRecordingData *recordingData, const char *format, ...) {
-	if (!recordingData) {
+	if (entry->type == SURVIVE_RECORDING_INDEX_CHECKPOINT && gzdirect(recordingData->output_file)) {
+		entry->compressed_offset = -1;
+	} else if (entry->type == SURVIVE_RECORDING_INDEX_CHECKPOINT) {
+		// Decompression can start at a new gzip member without any of the data before it
+		struct stat st;
+		gzclose(recordingData->output_file);
+		recordingData->output_file = 0;
+		if (stat(recordingData->output_fn, &st) == 0) {
+			recordingData->output_file = gzopen(recordingData->output_fn, "a6F");
+		}
+		if (recordingData->output_file == 0) {
+			recordingData->warn_reopen_failed = true;
+			fclose(recordingData->index_file);
+			recordingData->index_file = 0;
+			return;
+		}
+		entry->compressed_offset = st.st_size;
+	}
+
+	survive_recording_index_write_entry(recordingData->index_file, entry);
+}
+
+static void write_frames(SurviveRecordingData *recordingData, const char *data, size_t len) {
+	while (len >= sizeof(recording_frame_header)) {
+		recording_frame_header header;
+		memcpy(&header, data, sizeof(header));
+		data += sizeof(header);
+		len -= sizeof(header);
+		assert(header.len <= len);
+
+		switch (header.kind) {
+		case RECORDING_FRAME_DATA:
+			write_to_output_raw(recordingData, data, header.len);
+			break;
+		case RECORDING_FRAME_INDEX: {
+			survive_recording_index_entry entry;
+			memcpy(&entry, data, sizeof(entry));
+			write_index_entry(recordingData, &entry);
+			break;
+		}
+		case RECORDING_FRAME_STDOUT:
+			fwrite(data, 1, header.len, stdout);
+			break;
+		}
+
+		data += header.len;
+		len -= header.len;
+	}
+}
+
+static void *recording_writer_thread(void *user) {
+	SurviveRecordingData *recordingData = user;
+	uint32_t mask = recordingData->queue_size - 1;
+
+	for (;;) {
+		// Read before the head so that everything queued before shutdown still gets written
+		bool keep_running = recordingData->keep_running;
+		uint32_t head = OGAtomicLoadAcquire32(&recordingData->queue_head);
+		uint32_t tail = recordingData->queue_tail;
+		if (head == tail) {
+			if (!keep_running) {
+				break;
+			}
+			OGLockSema(recordingData->queue_ready);
+			continue;
+		}
+
+		uint32_t len = head - tail, start = tail & mask;
+		if (start + len <= recordingData->queue_size) {
+			write_frames(recordingData, recordingData->queue + start, len);
+		} else {
+			uint32_t first = recordingData->queue_size - start;
+			str_clear(&recordingData->unwrapped);
+			str_append_n(&recordingData->unwrapped, recordingData->queue + start, first);
+			str_append_n(&recordingData->unwrapped, recordingData->queue, len - first);
+			write_frames(recordingData, recordingData->unwrapped.d, len);
+		}
+		OGAtomicStoreRelease32(&recordingData->queue_tail, head);
+		OGUnlockSema(recordingData->queue_space);
+	}
+	return 0;
+}
+
+// The batch functions below are all called with output_lock held
+static void batch_begin_frame(SurviveRecordingData *recordingData, recording_frame_kind kind) {
+	recording_frame_header header = {.kind = kind};
+	str_append_n(&recordingData->batch, (const char *)&header, sizeof(header));
+	recordingData->batch_data_offset = recordingData->batch.length;
+}
+
+static void batch_end_frame(SurviveRecordingData *recordingData, recording_frame_kind kind) {
+	recording_frame_header header = {.kind = kind,
+									 .len = recordingData->batch.length - recordingData->batch_data_offset};
+	memcpy(recordingData->batch.d + recordingData->batch_data_offset - sizeof(header), &header, sizeof(header));
+	if (kind == RECORDING_FRAME_DATA) {
+		recordingData->batch_data_len += header.len;
+	}
+}
+
+static void batch_append_vprintf(SurviveRecordingData *recordingData, const char *format, va_list args) {
+	char buffer[256];
+	va_list args_copy;
+	va_copy(args_copy, args);
+	int len = vsnprintf(buffer, sizeof(buffer), format, args_copy);
+	va_end(args_copy);
+	if (len < 0) {
 		return;
 	}
 
-	double ts = survive_run_time(recordingData->ctx);
+	if (len < (int)sizeof(buffer)) {
+		str_append_n(&recordingData->batch, buffer, len);
+	} else {
+		char *dest = str_increase_by(&recordingData->batch, len + 1);
+		vsnprintf(dest, len + 1, format, args);
+		recordingData->batch.length--;
+	}
+}
 
-	if (recordingData->output_file) {
-		va_list args;
-		va_start(args, format);
-		gzprintf(recordingData->output_file, FLT_PRINTF, ts);
-		gzvprintf(recordingData->output_file, format, args);
+static void batch_append_printf(SurviveRecordingData *recordingData, const char *format, ...) {
+	va_list args;
+	va_start(args, format);
+	batch_append_vprintf(recordingData, format, args);
+	va_end(args);
+}
 
-		va_end(args);
+static void batch_index(SurviveRecordingData *recordingData, survive_recording_index_entry_type type, double time,
+						int lh) {
+	survive_recording_index_entry entry = {
+		.type = type, .time = time, .offset = recordingData->stream_offset + recordingData->batch_data_len, .lh = lh};
+	batch_begin_frame(recordingData, RECORDING_FRAME_INDEX);
+	str_append_n(&recordingData->batch, (const char *)&entry, sizeof(entry));
+	batch_end_frame(recordingData, RECORDING_FRAME_INDEX);
+}
+
+/*
+ * Starts the batch for an event at the given time. Adds a checkpoint first once the interval is up, and an index
+ * entry for CONFIG and LH_POSE events; index_type is 0 for everything else. Returns whether there was a checkpoint.
+ */
+static bool batch_begin(SurviveRecordingData *recordingData, double time, survive_recording_index_entry_type index_type,
+						int lh) {
+	str_clear(&recordingData->batch);
+	recordingData->batch_data_len = 0;
+
+	bool checkpoint = recordingData->indexing && time >= recordingData->next_checkpoint;
+	if (checkpoint) {
+		recordingData->next_checkpoint = time + recordingData->index_interval;
+		batch_index(recordingData, SURVIVE_RECORDING_INDEX_CHECKPOINT, time, -1);
+
+		// The RESTART record has to be right at the checkpoint, ahead of any other index entry
+		if (recordingData->binary) {
+			batch_begin_frame(recordingData, RECORDING_FRAME_DATA);
+			survive_binary_writer_restart(&recordingData->binary_writer, 0);
+			batch_end_frame(recordingData, RECORDING_FRAME_DATA);
+			recordingData->binary_resync = false;
+		}
+	}
+
+	if (recordingData->indexing && index_type) {
+		batch_index(recordingData, index_type, time, lh);
+	}
+	return checkpoint;
+}
+
+// Hands the batch to the writer thread, or writes it right away when there is none
+static void batch_commit(SurviveRecordingData *recordingData, bool essential, bool checkpoint) {
+	uint32_t len = recordingData->batch.length;
+
+	if (recordingData->queue == 0) {
+		write_frames(recordingData, recordingData->batch.d, len);
+		recordingData->stream_offset += recordingData->batch_data_len;
+		return;
+	}
+
+	uint32_t head = recordingData->queue_head;
+	if (essential && len > recordingData->queue_size) {
+		// The writer thread is idle once it has caught up, and nothing else can be queued while output_lock is held
+		while (OGAtomicLoadAcquire32(&recordingData->queue_tail) != head) {
+			OGLockSema(recordingData->queue_space);
+		}
+		write_frames(recordingData, recordingData->batch.d, len);
+		recordingData->stream_offset += recordingData->batch_data_len;
+		return;
 	}
 
+	bool fits = len <= recordingData->queue_size;
+	while (fits && head - OGAtomicLoadAcquire32(&recordingData->queue_tail) + len > recordingData->queue_size) {
+		if (!essential) {
+			fits = false;
+			break;
+		}
+		OGLockSema(recordingData->queue_space);
+	}
+
+	if (!fits) {
+		recordingData->warn_dropped |= recordingData->dropped_records++ == 0;
+		if (checkpoint) {
+			recordingData->next_checkpoint = 0;
+		}
+		recordingData->binary_resync = recordingData->binary;
+		return;
+	}
+
+	uint32_t mask = recordingData->queue_size - 1;
+	uint32_t start = head & mask;
+	uint32_t first = len < recordingData->queue_size - start ? len : recordingData->queue_size - start;
+	memcpy(recordingData->queue + start, recordingData->batch.d, first);
+	memcpy(recordingData->queue, recordingData->batch.d + first, len - first);
+	OGAtomicStoreRelease32(&recordingData->queue_head, head + len);
+	OGUnlockSema(recordingData->queue_ready);
+
+	recordingData->stream_offset += recordingData->batch_data_len;
+}
+
+static void report_warnings(SurviveRecordingData *recordingData) {
+	SurviveContext *ctx = recordingData->ctx;
+	if (recordingData->warn_dropped) {
+		recordingData->warn_dropped = false;
+		SV_WARN("Recording can't keep up; dropping records. Consider a larger --record-queue-size.");
+	}
+	if (recordingData->warn_reopen_failed) {
+		recordingData->warn_reopen_failed = false;
+		SV_WARN("Could not reopen %s for writing; recording stopped", recordingData->output_fn);
+	}
+}
+
+static void write_binary_to_output(SurviveRecordingData *recordingData, survive_binary_record *record) {
+	record->time = survive_run_time(recordingData->ctx);
+
+	survive_recording_index_entry_type index_type = 0;
+	int lh = -1;
+	if (record->type == SURVIVE_BINARY_RECORD_CONFIG) {
+		index_type = SURVIVE_RECORDING_INDEX_CONFIG;
+	} else if (record->type == SURVIVE_BINARY_RECORD_LH_POSE) {
+		index_type = SURVIVE_RECORDING_INDEX_LH_POSE;
+		lh = record->lh_pose.lh;
+	}
+
+	OGLockMutex(recordingData->output_lock);
+	bool checkpoint = batch_begin(recordingData, record->time, index_type, lh);
+
+	batch_begin_frame(recordingData, RECORDING_FRAME_DATA);
+	if (recordingData->binary_resync) {
+		survive_binary_writer_restart(&recordingData->binary_writer, 0);
+		recordingData->binary_resync = false;
+	}
+	survive_binary_writer_write(&recordingData->binary_writer, record);
+	batch_end_frame(recordingData, RECORDING_FRAME_DATA);
+
 	if (recordingData->alwaysWriteStdOut) {
+		str_clear(&recordingData->stdout_line);
+		survive_binary_record_append_text(&recordingData->stdout_line, record);
+		batch_begin_frame(recordingData, RECORDING_FRAME_STDOUT);
+		str_append_n(&recordingData->batch, recordingData->stdout_line.d, recordingData->stdout_line.length);
+		batch_end_frame(recordingData, RECORDING_FRAME_STDOUT);
+	}
+
+	batch_commit(recordingData, index_type != 0, checkpoint);
+	OGUnlockMutex(recordingData->output_lock);
+	report_warnings(recordingData);
+}
+
+static void write_text_to_output(SurviveRecordingData *recordingData, survive_recording_index_entry_type index_type,
+								 int lh, const char *format, va_list args) {
+	double ts = survive_run_time(recordingData->ctx);
+
+	OGLockMutex(recordingData->output_lock);
+	bool checkpoint = batch_begin(recordingData, ts, index_type, lh);
+	batch_begin_frame(recordingData, RECORDING_FRAME_DATA);
+	batch_append_printf(recordingData, FLT_PRINTF, ts);
+	batch_append_vprintf(recordingData, format, args);
+	batch_end_frame(recordingData, RECORDING_FRAME_DATA);
+	batch_commit(recordingData, index_type != 0, checkpoint);
+	OGUnlockMutex(recordingData->output_lock);
+	report_warnings(recordingData);
+}
+
+static void write_indexed_text_to_output(SurviveRecordingData *recordingData,
+										 survive_recording_index_entry_type index_type, int lh, const char *format,
+										 ...) {
+	va_list args;
+	va_start(args, format);
+	write_text_to_output(recordingData, index_type, lh, format, args);
+	va_end(args);
+}
+
+void survive_recording_write_to_output(struct SurviveRecordingData *recordingData, const char *format, ...) {
+	if (!recordingData) {
+		return;
+	}
+
+	if (recordingData->binary) {
+		char buffer[256];
 		va_list args;
 		va_start(args, format);
-		fprintf(stdout, FLT_PRINTF, ts);
-		vfprintf(stdout, format, args);
+		int len = vsnprintf(buffer, sizeof(buffer), format, args);
 		va_end(args);
+		if (len >= (int)sizeof(buffer))
+			len = sizeof(buffer) - 1;
+		while (len > 0 && (buffer[len - 1] == '\n' || buffer[len - 1] == '\r'))
+			len--;
+		survive_binary_record record = {.type = SURVIVE_BINARY_RECORD_TEXT, .text = buffer, .text_len = len};
+		write_binary_to_output(recordingData, &record);
+		return;
 	}
+
+	va_list args;
+	va_start(args, format);
+	write_text_to_output(recordingData, 0, -1, format, args);
+	va_end(args);
+}
+
+size_t survive_recording_dropped_records(const SurviveContext *ctx) {
+	return ctx->recptr ? ctx->recptr->dropped_records : 0;
 }
+
 void survive_recording_config_process(SurviveObject *so, char *ct0conf, int len) {
 	SurviveRecordingData *recordingData = so->ctx ? so->ctx->recptr : 0;
 	if (recordingData == 0 || len < 0)
@@ -97,10 +461,16 @@ void survive_recording_config_process(SurviveObject *so, char *ct0conf, int len)
 		if (buffer[i] == '\n' || buffer[i] == '\r')
 			buffer[i] = ' ';
 
-	survive_recording_write_to_output(recordingData, "%s CONFIG ", so->codename);
-	write_to_output_raw(recordingData, buffer, len);
+	if (recordingData->binary) {
+		survive_binary_record record = {
+			.type = SURVIVE_BINARY_RECORD_CONFIG, .name = so->codename, .text = buffer, .text_len = len};
+		write_binary_to_output(recordingData, &record);
+		free(buffer);
+		return;
+	}
 
-	write_to_output_raw(recordingData, "\r\n", 2);
+	write_indexed_text_to_output(recordingData, SURVIVE_RECORDING_INDEX_CONFIG, -1, "%s CONFIG %.*s\r\n",
+								 so->codename, len, buffer);
 
 	free(buffer);
 }
@@ -110,8 +480,14 @@ void survive_recording_lighthouse_process(SurviveContext *ctx, uint8_t lighthous
 	if (recordingData == 0)
 		return;
 
-	survive_recording_write_to_output(
-		recordingData,
+	if (recordingData->binary) {
+		survive_binary_record record = {.type = SURVIVE_BINARY_RECORD_LH_POSE, .lh_pose = {lighthouse, *lh_pose}};
+		write_binary_to_output(recordingData, &record);
+		return;
+	}
+
+	write_indexed_text_to_output(
+		recordingData, SURVIVE_RECORDING_INDEX_LH_POSE, lighthouse,
 		"%d LH_POSE " FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF "\r\n", lighthouse,
 		lh_pose->Pos[0], lh_pose->Pos[1], lh_pose->Pos[2], lh_pose->Rot[0], lh_pose->Rot[1], lh_pose->Rot[2],
 		lh_pose->Rot[3]);
@@ -121,6 +497,13 @@ void survive_recording_velocity_process(SurviveObject *so, uint8_t lighthouse, c
 	if (recordingData == 0)
 		return;
 
+	if (recordingData->binary) {
+		survive_binary_record record = {
+			.type = SURVIVE_BINARY_RECORD_VELOCITY, .name = so->codename, .velocity = *pose};
+		write_binary_to_output(recordingData, &record);
+		return;
+	}
+
 	survive_recording_write_to_output(
 		recordingData, "%s VELOCITY " FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF "\r\n",
 		so->codename, pose->Pos[0], pose->Pos[1], pose->Pos[2], pose->AxisAngleRot[0], pose->AxisAngleRot[1],
@@ -131,6 +514,12 @@ void survive_recording_raw_pose_process(SurviveObject *so, uint8_t lighthouse, c
 	if (recordingData == 0)
 		return;
 
+	if (recordingData->binary) {
+		survive_binary_record record = {.type = SURVIVE_BINARY_RECORD_POSE, .name = so->codename, .pose = *pose};
+		write_binary_to_output(recordingData, &record);
+		return;
+	}
+
 	survive_recording_write_to_output(
 		recordingData, "%s POSE " FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF "\r\n",
 		so->codename, pose->Pos[0], pose->Pos[1], pose->Pos[2], pose->Rot[0], pose->Rot[1], pose->Rot[2], pose->Rot[3]);
@@ -141,6 +530,13 @@ void survive_recording_external_velocity_process(SurviveContext *ctx, const char
 	if (recordingData == 0)
 		return;
 
+	if (recordingData->binary) {
+		survive_binary_record record = {
+			.type = SURVIVE_BINARY_RECORD_EXTERNAL_VELOCITY, .name = name, .velocity = *pose};
+		write_binary_to_output(recordingData, &record);
+		return;
+	}
+
 	survive_recording_write_to_output(
 		recordingData, "%s EXTERNAL_VELOCITY " FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF "\r\n",
 		name, pose->Pos[0], pose->Pos[1], pose->Pos[2], pose->AxisAngleRot[0], pose->AxisAngleRot[1],
@@ -152,6 +548,12 @@ void survive_recording_external_pose_process(SurviveContext *ctx, const char *na
 	if (recordingData == 0)
 		return;
 
+	if (recordingData->binary) {
+		survive_binary_record record = {.type = SURVIVE_BINARY_RECORD_EXTERNAL_POSE, .name = name, .pose = *pose};
+		write_binary_to_output(recordingData, &record);
+		return;
+	}
+
 	survive_recording_write_to_output(
 		recordingData,
 		"%s EXTERNAL_POSE " FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF "\n", name,
@@ -163,6 +565,12 @@ void survive_recording_info_process(SurviveContext *ctx, const char *fault) {
 	if (recordingData == 0)
 		return;
 
+	if (recordingData->binary) {
+		survive_binary_record record = {.type = SURVIVE_BINARY_RECORD_INFO, .text = fault, .text_len = strlen(fault)};
+		write_binary_to_output(recordingData, &record);
+		return;
+	}
+
 	survive_recording_write_to_output(recordingData, "INFO LOG %s\r\n", fault);
 }
 
@@ -175,6 +583,13 @@ void survive_recording_sync_process(SurviveObject *so, survive_channel channel,
 		return;
 	}
 
+	if (recordingData->binary) {
+		survive_binary_record record = {
+			.type = SURVIVE_BINARY_RECORD_SYNC, .name = dev, .sync = {channel, timecode, ootx, gen}};
+		write_binary_to_output(recordingData, &record);
+		return;
+	}
+
 	survive_recording_write_to_output(recordingData, SYNC_PRINTF, SYNC_PRINTF_ARGS);
 }
 
@@ -186,6 +601,14 @@ void survive_recording_sweep_angle_process(SurviveObject *so, survive_channel ch
 	}
 
 	const char *dev = so->codename;
+	if (recordingData->binary) {
+		survive_binary_record record = {.type = SURVIVE_BINARY_RECORD_SWEEP_ANGLE,
+										.name = dev,
+										.sweep_angle = {channel, sensor_id, timecode, plane, angle}};
+		write_binary_to_output(recordingData, &record);
+		return;
+	}
+
 	survive_recording_write_to_output(recordingData, SWEEP_ANGLE_PRINTF, SWEEP_ANGLE_PRINTF_ARGS);
 }
 
@@ -201,6 +624,13 @@ void survive_recording_sweep_process(SurviveObject *so, survive_channel channel,
 		return;
 
 	const char *dev = so->codename;
+	if (recordingData->binary) {
+		survive_binary_record record = {
+			.type = SURVIVE_BINARY_RECORD_SWEEP, .name = dev, .sweep = {channel, sensor_id, timecode, flag}};
+		write_binary_to_output(recordingData, &record);
+		return;
+	}
+
 	survive_recording_write_to_output(recordingData, SWEEP_PRINTF, SWEEP_PRINTF_ARGS);
 }
 
@@ -213,6 +643,13 @@ void survive_recording_button_process(SurviveObject *so, enum SurviveInputEvent
 	}
 
 	const char *dev = so->codename;
+	if (recordingData->binary) {
+		survive_binary_record record = {
+			.type = SURVIVE_BINARY_RECORD_BUTTON, .name = dev, .button = {eventType, buttonId}};
+		write_binary_to_output(recordingData, &record);
+		return;
+	}
+
 	survive_recording_write_to_output(recordingData, "%s BUTTON %u %u\r\n", dev, eventType, buttonId);
 }
 void survive_recording_angle_process(struct SurviveObject *so, int sensor_id, int acode, uint32_t timecode, FLT length,
@@ -222,6 +659,14 @@ void survive_recording_angle_process(struct SurviveObject *so, int sensor_id, in
 		return;
 	}
 
+	if (recordingData->binary) {
+		survive_binary_record record = {.type = SURVIVE_BINARY_RECORD_ANGLE,
+										.name = so->codename,
+										.angle = {sensor_id, acode, timecode, length, angle, lh}};
+		write_binary_to_output(recordingData, &record);
+		return;
+	}
+
 	survive_recording_write_to_output(recordingData, "%s A %d %d %u " FLT_PRINTF FLT_PRINTF "%u\r\n", so->codename,
 									  sensor_id, acode, timecode, length, angle, lh);
 }
@@ -231,7 +676,10 @@ void survive_recording_lightcap(SurviveObject *so, LightcapElement *le) {
 	if (recordingData == 0)
 		return;
 
-	if (recordingData->writeRawLight) {
+	if (recordingData->writeRawLight && recordingData->binary) {
+		survive_binary_record record = {.type = SURVIVE_BINARY_RECORD_LIGHTCAP, .name = so->codename, .lightcap = *le};
+		write_binary_to_output(recordingData, &record);
+	} else if (recordingData->writeRawLight) {
 		survive_recording_write_to_output(recordingData, "%s C %d %u %u\r\n", so->codename, le->sensor_id,
 										  le->timestamp, le->length);
 	}
@@ -246,7 +694,15 @@ void survive_recording_light_process(struct SurviveObject *so, int sensor_id, in
 	if (!recordingData->writeAngle) {
 	  return;
 	}
-	
+
+	if (recordingData->binary) {
+		survive_binary_record record = {.type = SURVIVE_BINARY_RECORD_LIGHT,
+										.name = so->codename,
+										.light = {sensor_id, acode, timeinsweep, timecode, length, lh}};
+		write_binary_to_output(recordingData, &record);
+		return;
+	}
+
 	if (acode == -1) {
 		survive_recording_write_to_output(recordingData, "%s S %d %d %d %u %u %u\r\n", so->codename, sensor_id, acode,
 										  timeinsweep, timecode, length, lh);
@@ -293,6 +749,14 @@ void survive_recording_imu_process(struct SurviveObject *so, int mask, const FLT
 		return;
 	}
 
+	if (recordingData->binary) {
+		survive_binary_record record = {
+			.type = SURVIVE_BINARY_RECORD_IMU, .name = so->codename, .imu = {.mask = mask, .timecode = timecode, .id = id}};
+		memcpy(record.imu.accelgyro, accelgyro, sizeof(record.imu.accelgyro));
+		write_binary_to_output(recordingData, &record);
+		return;
+	}
+
 	survive_recording_write_to_output(recordingData,
 									  "%s I %d %u " FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF
 									  " " FLT_PRINTF FLT_PRINTF FLT_PRINTF "%d\r\n",
@@ -311,6 +775,15 @@ void survive_recording_raw_imu_process(struct SurviveObject *so, int mask, const
 		return;
 	}
 
+	if (recordingData->binary) {
+		survive_binary_record record = {.type = SURVIVE_BINARY_RECORD_RAW_IMU,
+										.name = so->codename,
+										.imu = {.mask = mask, .timecode = timecode, .id = id}};
+		memcpy(record.imu.accelgyro, accelgyro, sizeof(record.imu.accelgyro));
+		write_binary_to_output(recordingData, &record);
+		return;
+	}
+
 	survive_recording_write_to_output(recordingData,
 									  "%s i %d %u " FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF
 									  " " FLT_PRINTF FLT_PRINTF FLT_PRINTF "%d\r\n",
@@ -320,9 +793,33 @@ void survive_recording_raw_imu_process(struct SurviveObject *so, int mask, const
 }
 
 void survive_destroy_recording(SurviveContext *ctx) {
-	if (ctx->recptr) {
-		gzclose(ctx->recptr->output_file);
-		free(ctx->recptr);
+	SurviveRecordingData *recordingData = ctx->recptr;
+	if (recordingData) {
+		if (recordingData->dropped_records) {
+			SV_WARN("Recording dropped %zu records because the writer fell behind", recordingData->dropped_records);
+		}
+		if (recordingData->writer_thread) {
+			recordingData->keep_running = false;
+			OGUnlockSema(recordingData->queue_ready);
+			OGJoinThread(recordingData->writer_thread);
+			OGDeleteSema(recordingData->queue_ready);
+			OGDeleteSema(recordingData->queue_space);
+		}
+
+		survive_binary_writer_free(&recordingData->binary_writer);
+		if (recordingData->output_file) {
+			gzclose(recordingData->output_file);
+		}
+		if (recordingData->index_file) {
+			fclose(recordingData->index_file);
+		}
+		free(recordingData->output_fn);
+		free(recordingData->queue);
+		str_free(&recordingData->batch);
+		str_free(&recordingData->stdout_line);
+		str_free(&recordingData->unwrapped);
+		OGDeleteMutex(recordingData->output_lock);
+		free(recordingData);
 		ctx->recptr = 0;
 	}
 }
@@ -330,6 +827,13 @@ void survive_destroy_recording(SurviveContext *ctx) {
 void survive_record_config(SurviveContext *ctx, const char *tag, uint8_t type, void *user) {
 	char buf[128];
 	survive_config_as_str(ctx, buf, sizeof(buf), tag, "");
+	if (ctx->recptr && ctx->recptr->binary) {
+		char option[192];
+		snprintf(option, sizeof(option), "%s %c %s", tag, type, buf);
+		survive_binary_record record = {.type = SURVIVE_BINARY_RECORD_OPTION, .text = option, .text_len = strlen(option)};
+		write_binary_to_output(ctx->recptr, &record);
+		return;
+	}
 	survive_recording_write_to_output(ctx->recptr, "OPTION %s %c %s\n", tag, type, buf);
 }
 
@@ -340,6 +844,7 @@ void survive_install_recording(SurviveContext *ctx) {
 	if (strlen(dataout_file) > 0 || record_to_stdout) {
 		ctx->recptr = SV_CALLOC(sizeof(struct SurviveRecordingData));
 		ctx->recptr->ctx = ctx;
+		ctx->recptr->output_lock = OGCreateMutex();
 		if (strlen(dataout_file) > 0) {
 			if (strstr(dataout_file, ".pcap")) {
 				int (*usb_driver)(SurviveContext *) = (int (*)(SurviveContext *))GetDriver("DriverRegUSBMon_Record");
@@ -357,11 +862,25 @@ void survive_install_recording(SurviveContext *ctx) {
 				ctx->recptr->output_file = gzopen(dataout_file, useCompression ? "w6F" : "wT");
 				if (ctx->recptr->output_file == 0) {
 					SV_INFO("Could not open %s for writing", dataout_file);
+					OGDeleteMutex(ctx->recptr->output_lock);
 					free(ctx->recptr);
 					ctx->recptr = 0;
 					return;
 				}
-				SV_INFO("Recording to '%s' Compression: %d", dataout_file, useCompression);
+				ctx->recptr->binary = survive_recording_is_binary_filename(dataout_file);
+				SV_INFO("Recording to '%s' Compression: %d Binary: %d", dataout_file, useCompression,
+						ctx->recptr->binary);
+
+				ctx->recptr->index_interval = survive_configf(ctx, "record-index-interval", SC_GET, 10.);
+				if (ctx->recptr->index_interval > 0) {
+					ctx->recptr->output_fn = strdup(dataout_file);
+					ctx->recptr->next_checkpoint = ctx->recptr->index_interval;
+					ctx->recptr->index_file = survive_recording_index_create(dataout_file);
+					ctx->recptr->indexing = ctx->recptr->index_file != 0;
+					if (ctx->recptr->index_file == 0) {
+						SV_WARN("Could not create the index for %s; it will only play back from the start", dataout_file);
+					}
+				}
 			}
 		}
 
@@ -370,6 +889,29 @@ void survive_install_recording(SurviveContext *ctx) {
 			SV_INFO("Recording to stdout");
 		}
 
+		int queue_size = survive_configi(ctx, "record-queue-size", SC_GET, 16 * 1024 * 1024);
+		if (queue_size > 0) {
+			// Rounded up to a power of two so positions in the queue are just masked counters
+			uint32_t size = 1 << 16;
+			while (size < (uint32_t)queue_size && size < (1u << 30)) {
+				size <<= 1;
+			}
+			ctx->recptr->queue_size = size;
+			ctx->recptr->queue = SV_MALLOC(size);
+			ctx->recptr->keep_running = true;
+			ctx->recptr->queue_ready = OGCreateSema();
+			ctx->recptr->queue_space = OGCreateSema();
+			ctx->recptr->writer_thread = OGCreateThread(recording_writer_thread, "recording", ctx->recptr);
+		}
+
+		if (ctx->recptr->binary) {
+			batch_begin(ctx->recptr, 0, 0, -1);
+			batch_begin_frame(ctx->recptr, RECORDING_FRAME_DATA);
+			survive_binary_writer_init_buffer(&ctx->recptr->binary_writer, &ctx->recptr->batch);
+			batch_end_frame(ctx->recptr, RECORDING_FRAME_DATA);
+			batch_commit(ctx->recptr, true, false);
+		}
+
 		ctx->recptr->writeRawLight = survive_configi(ctx, "record-rawlight", SC_GET, 1);
 		ctx->recptr->writeIMU = survive_configi(ctx, "record-imu", SC_GET, 1);
 		ctx->recptr->writeCalIMU = survive_configi(ctx, "record-cal-imu", SC_GET, 0);
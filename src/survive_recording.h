@@ -9,6 +9,12 @@
 #define SCN_FLAG SCNu8
 #define SCN_GEN SCNu8
 
+#ifdef SURVIVE_HEX_FLOATS
+#define FLT_PRINTF "%0.6a "
+#else
+#define FLT_PRINTF "%0.6f "
+#endif
+
 // survive_channel channel, int sensor_id, survive_timecode timecode, int8_t plane, FLT angle
 #define SWEEP_ANGLE_SCANF  "%s B %"SCN_CHANNEL" %d %u %" SCN_PLANE " " FLT_sformat "\n"
 #define SWEEP_ANGLE_PRINTF "%s B %"PRI_CHANNEL" %u %u %" PRI_PLANE " " FLT_format "\n"
@@ -31,9 +37,11 @@
 struct SurviveRecordingData;
 SURVIVE_EXPORT void survive_recording_write_to_output(struct SurviveRecordingData *recordingData, const char *format,
 													  ...);
+// Number of records dropped because the recording's writer thread couldn't keep up
+SURVIVE_EXPORT size_t survive_recording_dropped_records(const SurviveContext *ctx);
 void survive_destroy_recording(SurviveContext *ctx);
-void survive_install_recording(SurviveContext *ctx);
-void survive_recording_config_process(SurviveObject *so, char *ct0conf, int len);
+SURVIVE_EXPORT void survive_install_recording(SurviveContext *ctx);
+SURVIVE_EXPORT void survive_recording_config_process(SurviveObject *so, char *ct0conf, int len);
 
 void survive_recording_lighthouse_process(SurviveContext *ctx, uint8_t lighthouse, const SurvivePose *lh_pose);
 void survive_recording_lightcap(SurviveObject *so, LightcapElement *le);
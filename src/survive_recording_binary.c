@@ -0,0 +1,1057 @@
+#include "survive_recording_binary.h"
+
+#include <assert.h>
+#include <inttypes.h>
+#include <math.h>
+#include <string.h>
+
+#include "survive_recording.h"
+
+#define VARIABLE_PAYLOAD -1
+
+static const int record_payload_size[SURVIVE_BINARY_RECORD_TYPE_CNT] = {
+	[SURVIVE_BINARY_RECORD_STRING] = VARIABLE_PAYLOAD,
+	[SURVIVE_BINARY_RECORD_TIME] = 8,
+	[SURVIVE_BINARY_RECORD_CONFIG] = VARIABLE_PAYLOAD,
+	[SURVIVE_BINARY_RECORD_INFO] = VARIABLE_PAYLOAD,
+	[SURVIVE_BINARY_RECORD_OPTION] = VARIABLE_PAYLOAD,
+	[SURVIVE_BINARY_RECORD_LH_POSE] = 1 + 7 * 8,
+	[SURVIVE_BINARY_RECORD_POSE] = 7 * 8,
+	[SURVIVE_BINARY_RECORD_VELOCITY] = 6 * 8,
+	[SURVIVE_BINARY_RECORD_EXTERNAL_POSE] = 7 * 8,
+	[SURVIVE_BINARY_RECORD_EXTERNAL_VELOCITY] = 6 * 8,
+	[SURVIVE_BINARY_RECORD_SYNC] = 1 + 4 + 1 + 1,
+	[SURVIVE_BINARY_RECORD_SWEEP] = 1 + 2 + 4 + 1,
+	[SURVIVE_BINARY_RECORD_SWEEP_ANGLE] = 1 + 2 + 4 + 1 + 4,
+	[SURVIVE_BINARY_RECORD_BUTTON] = 2,
+	[SURVIVE_BINARY_RECORD_ANGLE] = 2 + 2 + 4 + 4 + 4 + 1,
+	[SURVIVE_BINARY_RECORD_LIGHTCAP] = 1 + 4 + 2,
+	[SURVIVE_BINARY_RECORD_LIGHT] = 2 + 2 + 4 + 4 + 4 + 1,
+	[SURVIVE_BINARY_RECORD_IMU] = 1 + 4 + 9 * 4 + 4,
+	[SURVIVE_BINARY_RECORD_RAW_IMU] = 1 + 4 + 9 * 4 + 4,
+	[SURVIVE_BINARY_RECORD_TEXT] = VARIABLE_PAYLOAD,
+	[SURVIVE_BINARY_RECORD_RESTART] = 8,
+};
+
+// Records that mean nothing without the device or object they belong to
+static const bool record_needs_name[SURVIVE_BINARY_RECORD_TYPE_CNT] = {
+	[SURVIVE_BINARY_RECORD_CONFIG] = true,
+	[SURVIVE_BINARY_RECORD_POSE] = true,
+	[SURVIVE_BINARY_RECORD_VELOCITY] = true,
+	[SURVIVE_BINARY_RECORD_EXTERNAL_POSE] = true,
+	[SURVIVE_BINARY_RECORD_EXTERNAL_VELOCITY] = true,
+	[SURVIVE_BINARY_RECORD_SYNC] = true,
+	[SURVIVE_BINARY_RECORD_SWEEP] = true,
+	[SURVIVE_BINARY_RECORD_SWEEP_ANGLE] = true,
+	[SURVIVE_BINARY_RECORD_BUTTON] = true,
+	[SURVIVE_BINARY_RECORD_ANGLE] = true,
+	[SURVIVE_BINARY_RECORD_LIGHTCAP] = true,
+	[SURVIVE_BINARY_RECORD_LIGHT] = true,
+	[SURVIVE_BINARY_RECORD_IMU] = true,
+	[SURVIVE_BINARY_RECORD_RAW_IMU] = true,
+};
+
+// Largest fixed payload plus the record header
+#define MAX_FIXED_RECORD_SIZE (SURVIVE_BINARY_RECORD_HEADER_SIZE + 1 + 7 * 8)
+
+static uint8_t *put_u8(uint8_t *p, uint8_t v) {
+	*p = v;
+	return p + 1;
+}
+static uint8_t *put_u16(uint8_t *p, uint16_t v) {
+	p[0] = v & 0xff;
+	p[1] = v >> 8;
+	return p + 2;
+}
+static uint8_t *put_u32(uint8_t *p, uint32_t v) {
+	for (int i = 0; i < 4; i++) {
+		p[i] = (v >> (8 * i)) & 0xff;
+	}
+	return p + 4;
+}
+static uint8_t *put_u64(uint8_t *p, uint64_t v) {
+	for (int i = 0; i < 8; i++) {
+		p[i] = (v >> (8 * i)) & 0xff;
+	}
+	return p + 8;
+}
+static uint8_t *put_f32(uint8_t *p, FLT v) {
+	float f = (float)v;
+	uint32_t u;
+	memcpy(&u, &f, sizeof(u));
+	return put_u32(p, u);
+}
+static uint8_t *put_f64(uint8_t *p, FLT v) {
+	double d = v;
+	uint64_t u;
+	memcpy(&u, &d, sizeof(u));
+	return put_u64(p, u);
+}
+
+static uint8_t get_u8(const uint8_t **p) { return *(*p)++; }
+static uint16_t get_u16(const uint8_t **p) {
+	uint16_t v = (*p)[0] | ((uint16_t)(*p)[1] << 8);
+	*p += 2;
+	return v;
+}
+static uint32_t get_u32(const uint8_t **p) {
+	uint32_t v = 0;
+	for (int i = 0; i < 4; i++) {
+		v |= (uint32_t)(*p)[i] << (8 * i);
+	}
+	*p += 4;
+	return v;
+}
+static uint64_t get_u64(const uint8_t **p) {
+	uint64_t v = 0;
+	for (int i = 0; i < 8; i++) {
+		v |= (uint64_t)(*p)[i] << (8 * i);
+	}
+	*p += 8;
+	return v;
+}
+static FLT get_f32(const uint8_t **p) {
+	uint32_t u = get_u32(p);
+	float f;
+	memcpy(&f, &u, sizeof(f));
+	return f;
+}
+static FLT get_f64(const uint8_t **p) {
+	uint64_t u = get_u64(p);
+	double d;
+	memcpy(&d, &u, sizeof(d));
+	return d;
+}
+
+static uint8_t *put_pose(uint8_t *p, const SurvivePose *pose) {
+	for (int i = 0; i < 3; i++)
+		p = put_f64(p, pose->Pos[i]);
+	for (int i = 0; i < 4; i++)
+		p = put_f64(p, pose->Rot[i]);
+	return p;
+}
+static void get_pose(const uint8_t **p, SurvivePose *pose) {
+	for (int i = 0; i < 3; i++)
+		pose->Pos[i] = get_f64(p);
+	for (int i = 0; i < 4; i++)
+		pose->Rot[i] = get_f64(p);
+}
+static uint8_t *put_velocity(uint8_t *p, const SurviveVelocity *velocity) {
+	for (int i = 0; i < 3; i++)
+		p = put_f64(p, velocity->Pos[i]);
+	for (int i = 0; i < 3; i++)
+		p = put_f64(p, velocity->AxisAngleRot[i]);
+	return p;
+}
+static void get_velocity(const uint8_t **p, SurviveVelocity *velocity) {
+	for (int i = 0; i < 3; i++)
+		velocity->Pos[i] = get_f64(p);
+	for (int i = 0; i < 3; i++)
+		velocity->AxisAngleRot[i] = get_f64(p);
+}
+
+static bool ends_with(const char *s, const char *suffix) {
+	size_t len = strlen(s), suffix_len = strlen(suffix);
+	return len >= suffix_len && strcmp(s + len - suffix_len, suffix) == 0;
+}
+
+bool survive_recording_is_binary_filename(const char *fn) {
+	return fn && (ends_with(fn, ".bin") || ends_with(fn, ".bin.gz"));
+}
+
+static uint8_t *put_record_header(uint8_t *p, survive_binary_record_type type, uint8_t name, int32_t time_delta) {
+	p = put_u8(p, type);
+	p = put_u8(p, name);
+	return put_u32(p, (uint32_t)time_delta);
+}
+
+static bool writer_put(survive_binary_writer *writer, const void *data, size_t len) {
+	if (writer->output_buffer) {
+		str_append_n(writer->output_buffer, data, len);
+		return true;
+	}
+	return gzwrite(writer->output_file, data, len) == (int)len;
+}
+
+static int write_variable_record(survive_binary_writer *writer, survive_binary_record_type type, uint8_t name,
+								 int32_t time_delta, const char *payload, uint32_t len) {
+	uint8_t header[SURVIVE_BINARY_RECORD_HEADER_SIZE + 4];
+	uint8_t *p = put_record_header(header, type, name, time_delta);
+	put_u32(p, len);
+	if (!writer_put(writer, header, sizeof(header))) {
+		return -1;
+	}
+	if (len && !writer_put(writer, payload, len)) {
+		return -1;
+	}
+	return sizeof(header) + len;
+}
+
+static uint8_t name_index(survive_binary_writer *writer, const char *name) {
+	if (name == 0) {
+		return SURVIVE_BINARY_RECORD_NO_NAME;
+	}
+
+	// Almost always the exact same codename pointer; only fall back to comparing contents on a miss
+	for (size_t i = 0; i < writer->name_cnt; i++) {
+		if (writer->names[i] == name) {
+			return i;
+		}
+	}
+	for (size_t i = 0; i < writer->name_cnt; i++) {
+		if (strcmp(writer->names[i], name) == 0) {
+			return i;
+		}
+	}
+
+	// Out of indices; start the string table over the same way a checkpoint does rather than losing the name
+	if (writer->name_cnt >= SURVIVE_BINARY_RECORD_NO_NAME &&
+		survive_binary_writer_restart(writer, writer->output_file) < 0) {
+		return SURVIVE_BINARY_RECORD_NO_NAME;
+	}
+
+	uint8_t idx = writer->name_cnt++;
+	size_t len = strlen(name);
+	writer->names[idx] = SV_MALLOC(len + 1);
+	memcpy(writer->names[idx], name, len + 1);
+	write_variable_record(writer, SURVIVE_BINARY_RECORD_STRING, idx, 0, name, len);
+	return idx;
+}
+
+static uint32_t timecode_delta(survive_timecode *last, uint8_t name, survive_timecode timecode) {
+	uint32_t rtn = (uint32_t)(timecode - last[name]);
+	last[name] = timecode;
+	return rtn;
+}
+
+static int write_file_header(survive_binary_writer *writer) {
+	uint8_t header[SURVIVE_BINARY_RECORDING_HEADER_SIZE];
+	memcpy(header, SURVIVE_BINARY_RECORDING_MAGIC, 4);
+	uint8_t *p = put_u16(header + 4, SURVIVE_BINARY_RECORDING_VERSION);
+	put_u16(p, 0);
+	return writer_put(writer, header, sizeof(header)) ? 0 : -1;
+}
+
+int survive_binary_writer_init(survive_binary_writer *writer, gzFile output_file) {
+	*writer = (survive_binary_writer){.output_file = output_file};
+	return write_file_header(writer);
+}
+
+int survive_binary_writer_init_buffer(survive_binary_writer *writer, cstring *output_buffer) {
+	*writer = (survive_binary_writer){.output_buffer = output_buffer};
+	return write_file_header(writer);
+}
+
+int survive_binary_writer_write(survive_binary_writer *writer, const survive_binary_record *record) {
+	if (record->type <= SURVIVE_BINARY_RECORD_TIME || record->type >= SURVIVE_BINARY_RECORD_RESTART) {
+		return -1;
+	}
+
+	uint8_t name = name_index(writer, record->name);
+
+	int rtn = 0;
+	int64_t time_us = (int64_t)llround(record->time * 1e6);
+	int64_t time_delta = time_us - writer->time_us;
+	if (time_delta > INT32_MAX || time_delta < INT32_MIN) {
+		uint8_t buffer[SURVIVE_BINARY_RECORD_HEADER_SIZE + 8];
+		uint8_t *p = put_record_header(buffer, SURVIVE_BINARY_RECORD_TIME, SURVIVE_BINARY_RECORD_NO_NAME, 0);
+		put_u64(p, (uint64_t)time_us);
+		if (!writer_put(writer, buffer, sizeof(buffer))) {
+			return -1;
+		}
+		rtn += sizeof(buffer);
+		time_delta = 0;
+	}
+	writer->time_us = time_us;
+
+	if (record_payload_size[record->type] == VARIABLE_PAYLOAD) {
+		int written = write_variable_record(writer, record->type, name, (int32_t)time_delta, record->text,
+											(uint32_t)record->text_len);
+		return written < 0 ? -1 : rtn + written;
+	}
+
+	uint8_t buffer[MAX_FIXED_RECORD_SIZE];
+	uint8_t *p = put_record_header(buffer, record->type, name, (int32_t)time_delta);
+	survive_timecode *last = writer->last_timecode;
+
+	switch (record->type) {
+	case SURVIVE_BINARY_RECORD_LH_POSE:
+		p = put_u8(p, record->lh_pose.lh);
+		p = put_pose(p, &record->lh_pose.pose);
+		break;
+	case SURVIVE_BINARY_RECORD_POSE:
+	case SURVIVE_BINARY_RECORD_EXTERNAL_POSE:
+		p = put_pose(p, &record->pose);
+		break;
+	case SURVIVE_BINARY_RECORD_VELOCITY:
+	case SURVIVE_BINARY_RECORD_EXTERNAL_VELOCITY:
+		p = put_velocity(p, &record->velocity);
+		break;
+	case SURVIVE_BINARY_RECORD_SYNC:
+		p = put_u8(p, record->sync.channel);
+		p = put_u32(p, timecode_delta(last, name, record->sync.timecode));
+		p = put_u8(p, record->sync.ootx);
+		p = put_u8(p, record->sync.gen);
+		break;
+	case SURVIVE_BINARY_RECORD_SWEEP:
+		p = put_u8(p, record->sweep.channel);
+		p = put_u16(p, (uint16_t)record->sweep.sensor_id);
+		p = put_u32(p, timecode_delta(last, name, record->sweep.timecode));
+		p = put_u8(p, record->sweep.flag);
+		break;
+	case SURVIVE_BINARY_RECORD_SWEEP_ANGLE:
+		p = put_u8(p, record->sweep_angle.channel);
+		p = put_u16(p, (uint16_t)record->sweep_angle.sensor_id);
+		p = put_u32(p, timecode_delta(last, name, record->sweep_angle.timecode));
+		p = put_u8(p, (uint8_t)record->sweep_angle.plane);
+		p = put_f32(p, record->sweep_angle.angle);
+		break;
+	case SURVIVE_BINARY_RECORD_BUTTON:
+		p = put_u8(p, record->button.event_type);
+		p = put_u8(p, record->button.button_id);
+		break;
+	case SURVIVE_BINARY_RECORD_ANGLE:
+		p = put_u16(p, (uint16_t)record->angle.sensor_id);
+		p = put_u16(p, (uint16_t)record->angle.acode);
+		p = put_u32(p, timecode_delta(last, name, record->angle.timecode));
+		p = put_f32(p, record->angle.length);
+		p = put_f32(p, record->angle.angle);
+		p = put_u8(p, record->angle.lh);
+		break;
+	case SURVIVE_BINARY_RECORD_LIGHTCAP:
+		p = put_u8(p, record->lightcap.sensor_id);
+		p = put_u32(p, timecode_delta(last, name, record->lightcap.timestamp));
+		p = put_u16(p, record->lightcap.length);
+		break;
+	case SURVIVE_BINARY_RECORD_LIGHT:
+		p = put_u16(p, (uint16_t)record->light.sensor_id);
+		p = put_u16(p, (uint16_t)record->light.acode);
+		p = put_u32(p, (uint32_t)record->light.timeinsweep);
+		p = put_u32(p, timecode_delta(last, name, record->light.timecode));
+		p = put_u32(p, record->light.length);
+		p = put_u8(p, record->light.lh);
+		break;
+	case SURVIVE_BINARY_RECORD_IMU:
+	case SURVIVE_BINARY_RECORD_RAW_IMU:
+		p = put_u8(p, record->imu.mask);
+		p = put_u32(p, timecode_delta(last, name, record->imu.timecode));
+		for (int i = 0; i < 9; i++) {
+			p = put_f32(p, record->imu.accelgyro[i]);
+		}
+		p = put_u32(p, (uint32_t)record->imu.id);
+		break;
+	default:
+		return -1;
+	}
+
+	int len = p - buffer;
+	assert(len == SURVIVE_BINARY_RECORD_HEADER_SIZE + record_payload_size[record->type]);
+	if (!writer_put(writer, buffer, len)) {
+		return -1;
+	}
+	return rtn + len;
+}
+
+void survive_binary_writer_free(survive_binary_writer *writer) {
+	for (size_t i = 0; i < writer->name_cnt; i++) {
+		free(writer->names[i]);
+	}
+	writer->name_cnt = 0;
+}
+
+int survive_binary_writer_restart(survive_binary_writer *writer, gzFile output_file) {
+	survive_binary_writer_free(writer);
+	memset(writer->last_timecode, 0, sizeof(writer->last_timecode));
+	writer->output_file = output_file;
+
+	uint8_t buffer[SURVIVE_BINARY_RECORD_HEADER_SIZE + 8];
+	uint8_t *p = put_record_header(buffer, SURVIVE_BINARY_RECORD_RESTART, SURVIVE_BINARY_RECORD_NO_NAME, 0);
+	put_u64(p, (uint64_t)writer->time_us);
+	return writer_put(writer, buffer, sizeof(buffer)) ? 0 : -1;
+}
+
+// Gets the next len bytes of input. Memory readers hand out a pointer straight into their buffer; file readers copy
+// into scratch. Returns the number of bytes available, which is only less than len at the end of the input.
+static size_t reader_take(survive_binary_reader *reader, const uint8_t **out, uint8_t *scratch, size_t len) {
+	if (reader->input_file == 0) {
+		size_t available = reader->data_size - reader->data_offset;
+		if (len > available) {
+			len = available;
+		}
+		*out = reader->data + reader->data_offset;
+		reader->data_offset += len;
+		return len;
+	}
+
+	int r = gzread(reader->input_file, scratch, len);
+	*out = scratch;
+	return r < 0 ? 0 : (size_t)r;
+}
+
+static void reader_forget_names(survive_binary_reader *reader) {
+	for (int i = 0; i <= SURVIVE_BINARY_RECORD_NO_NAME; i++) {
+		free(reader->names[i]);
+		reader->names[i] = 0;
+	}
+}
+
+static int check_header(const uint8_t *header) {
+	if (memcmp(header, SURVIVE_BINARY_RECORDING_MAGIC, 4) != 0) {
+		return -1;
+	}
+
+	const uint8_t *p = header + 4;
+	if (get_u16(&p) > SURVIVE_BINARY_RECORDING_VERSION) {
+		return -1;
+	}
+	return 0;
+}
+
+int survive_binary_reader_init(survive_binary_reader *reader, gzFile input_file) {
+	*reader = (survive_binary_reader){.input_file = input_file};
+
+	uint8_t header[SURVIVE_BINARY_RECORDING_HEADER_SIZE];
+	if (gzread(input_file, header, sizeof(header)) != sizeof(header)) {
+		return -1;
+	}
+	return check_header(header);
+}
+
+int survive_binary_reader_init_buffer(survive_binary_reader *reader, const void *data, size_t size) {
+	*reader = (survive_binary_reader){.data = data, .data_size = size};
+
+	if (size < SURVIVE_BINARY_RECORDING_HEADER_SIZE) {
+		return -1;
+	}
+	reader->data_offset = SURVIVE_BINARY_RECORDING_HEADER_SIZE;
+	return check_header(reader->data);
+}
+
+static int read_variable_payload(survive_binary_reader *reader, const char **text) {
+	uint8_t len_buffer[4];
+	const uint8_t *p;
+	if (reader_take(reader, &p, len_buffer, sizeof(len_buffer)) != sizeof(len_buffer)) {
+		return -1;
+	}
+	uint32_t len = get_u32(&p);
+
+	if (reader->input_file == 0) {
+		if (reader_take(reader, &p, 0, len) != len) {
+			return -1;
+		}
+		*text = (const char *)p;
+		return len;
+	}
+
+	if (len + 1 > reader->text_size) {
+		reader->text = SV_REALLOC(reader->text, len + 1);
+		reader->text_size = len + 1;
+	}
+	if (len && gzread(reader->input_file, reader->text, len) != (int)len) {
+		return -1;
+	}
+	reader->text[len] = 0;
+	*text = reader->text;
+	return len;
+}
+
+int survive_binary_reader_next(survive_binary_reader *reader, survive_binary_record *record) {
+	for (;;) {
+		uint8_t scratch[MAX_FIXED_RECORD_SIZE];
+		const uint8_t *p;
+		size_t r = reader_take(reader, &p, scratch, SURVIVE_BINARY_RECORD_HEADER_SIZE);
+		if (r == 0) {
+			return 0;
+		}
+		if (r != SURVIVE_BINARY_RECORD_HEADER_SIZE) {
+			return -1;
+		}
+
+		survive_binary_record_type type = get_u8(&p);
+		uint8_t name = get_u8(&p);
+		reader->time_us += (int32_t)get_u32(&p);
+
+		if (type < SURVIVE_BINARY_RECORD_STRING || type >= SURVIVE_BINARY_RECORD_TYPE_CNT) {
+			return -1;
+		}
+
+		if (type == SURVIVE_BINARY_RECORD_STRING) {
+			const char *text = 0;
+			int len = read_variable_payload(reader, &text);
+			if (len < 0 || name == SURVIVE_BINARY_RECORD_NO_NAME) {
+				return -1;
+			}
+			free(reader->names[name]);
+			reader->names[name] = SV_MALLOC(len + 1);
+			memcpy(reader->names[name], text, len);
+			reader->names[name][len] = 0;
+			continue;
+		}
+
+		*record = (survive_binary_record){.type = type, .name = reader->names[name]};
+
+		if (record_payload_size[type] == VARIABLE_PAYLOAD) {
+			int len = read_variable_payload(reader, &record->text);
+			if (len < 0) {
+				return -1;
+			}
+			if (record_needs_name[type] && record->name == 0) {
+				continue;
+			}
+			record->time = reader->time_us / 1e6;
+			record->text_len = len;
+			return 1;
+		}
+
+		size_t payload_size = record_payload_size[type];
+		if (reader_take(reader, &p, scratch, payload_size) != payload_size) {
+			return -1;
+		}
+
+		survive_timecode *last = reader->last_timecode;
+		switch (type) {
+		case SURVIVE_BINARY_RECORD_TIME:
+			reader->time_us = (int64_t)get_u64(&p);
+			continue;
+		case SURVIVE_BINARY_RECORD_RESTART:
+			reader_forget_names(reader);
+			memset(reader->last_timecode, 0, sizeof(reader->last_timecode));
+			reader->time_us = (int64_t)get_u64(&p);
+			continue;
+		case SURVIVE_BINARY_RECORD_LH_POSE:
+			record->lh_pose.lh = get_u8(&p);
+			get_pose(&p, &record->lh_pose.pose);
+			break;
+		case SURVIVE_BINARY_RECORD_POSE:
+		case SURVIVE_BINARY_RECORD_EXTERNAL_POSE:
+			get_pose(&p, &record->pose);
+			break;
+		case SURVIVE_BINARY_RECORD_VELOCITY:
+		case SURVIVE_BINARY_RECORD_EXTERNAL_VELOCITY:
+			get_velocity(&p, &record->velocity);
+			break;
+		case SURVIVE_BINARY_RECORD_SYNC:
+			record->sync.channel = get_u8(&p);
+			record->sync.timecode = last[name] += get_u32(&p);
+			record->sync.ootx = get_u8(&p);
+			record->sync.gen = get_u8(&p);
+			break;
+		case SURVIVE_BINARY_RECORD_SWEEP:
+			record->sweep.channel = get_u8(&p);
+			record->sweep.sensor_id = (int16_t)get_u16(&p);
+			record->sweep.timecode = last[name] += get_u32(&p);
+			record->sweep.flag = get_u8(&p);
+			break;
+		case SURVIVE_BINARY_RECORD_SWEEP_ANGLE:
+			record->sweep_angle.channel = get_u8(&p);
+			record->sweep_angle.sensor_id = (int16_t)get_u16(&p);
+			record->sweep_angle.timecode = last[name] += get_u32(&p);
+			record->sweep_angle.plane = (int8_t)get_u8(&p);
+			record->sweep_angle.angle = get_f32(&p);
+			break;
+		case SURVIVE_BINARY_RECORD_BUTTON:
+			record->button.event_type = get_u8(&p);
+			record->button.button_id = get_u8(&p);
+			break;
+		case SURVIVE_BINARY_RECORD_ANGLE:
+			record->angle.sensor_id = (int16_t)get_u16(&p);
+			record->angle.acode = (int16_t)get_u16(&p);
+			record->angle.timecode = last[name] += get_u32(&p);
+			record->angle.length = get_f32(&p);
+			record->angle.angle = get_f32(&p);
+			record->angle.lh = get_u8(&p);
+			break;
+		case SURVIVE_BINARY_RECORD_LIGHTCAP:
+			record->lightcap.sensor_id = get_u8(&p);
+			record->lightcap.timestamp = last[name] += get_u32(&p);
+			record->lightcap.length = get_u16(&p);
+			break;
+		case SURVIVE_BINARY_RECORD_LIGHT:
+			record->light.sensor_id = (int16_t)get_u16(&p);
+			record->light.acode = (int16_t)get_u16(&p);
+			record->light.timeinsweep = (int32_t)get_u32(&p);
+			record->light.timecode = last[name] += get_u32(&p);
+			record->light.length = get_u32(&p);
+			record->light.lh = get_u8(&p);
+			break;
+		case SURVIVE_BINARY_RECORD_IMU:
+		case SURVIVE_BINARY_RECORD_RAW_IMU:
+			record->imu.mask = get_u8(&p);
+			record->imu.timecode = last[name] += get_u32(&p);
+			for (int i = 0; i < 9; i++) {
+				record->imu.accelgyro[i] = get_f32(&p);
+			}
+			record->imu.id = (int32_t)get_u32(&p);
+			break;
+		default:
+			return -1;
+		}
+
+		// Written without a name (or one this reader never saw); there is nobody to hand it to
+		if (record_needs_name[type] && record->name == 0) {
+			continue;
+		}
+
+		record->time = reader->time_us / 1e6;
+		return 1;
+	}
+}
+
+void survive_binary_reader_restart(survive_binary_reader *reader, gzFile input_file, size_t data_offset) {
+	reader_forget_names(reader);
+	memset(reader->last_timecode, 0, sizeof(reader->last_timecode));
+	reader->time_us = 0;
+
+	if (reader->input_file) {
+		reader->input_file = input_file;
+	} else {
+		reader->data_offset = data_offset;
+	}
+}
+
+void survive_binary_reader_free(survive_binary_reader *reader) {
+	reader_forget_names(reader);
+	free(reader->text);
+	reader->text = 0;
+	reader->text_size = 0;
+}
+
+// Splits off the next space delimited token and returns the remainder of the line
+static char *next_token(char *line, char **token) {
+	while (*line == ' ')
+		line++;
+	*token = line;
+	while (*line && *line != ' ')
+		line++;
+	if (*line) {
+		*line++ = 0;
+	}
+	return line;
+}
+
+static bool is_digit(char c) { return c >= '0' && c <= '9'; }
+
+static void skip_space(const char **p) {
+	while (**p == ' ' || **p == '\t')
+		(*p)++;
+}
+
+static bool next_int(const char **p, int64_t *v) {
+	skip_space(p);
+	const char *s = *p;
+	bool neg = *s == '-';
+	if (*s == '-' || *s == '+')
+		s++;
+	if (!is_digit(*s))
+		return false;
+
+	uint64_t rtn = 0;
+	while (is_digit(*s))
+		rtn = rtn * 10 + (*s++ - '0');
+	*v = neg ? -(int64_t)rtn : (int64_t)rtn;
+	*p = s;
+	return true;
+}
+
+static const double exact_pow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+									 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+/*
+ * Parses numbers the way strtod does. The ones recordings are full of -- a handful of decimal digits with an optional
+ * exponent -- have a mantissa that fits in a double and a scale that is an exact power of ten, so a single multiply or
+ * divide gives the correctly rounded result. Anything else, eg hex floats, nan and inf, goes through strtod.
+ */
+static bool next_double(const char **p, double *v) {
+	skip_space(p);
+	const char *s = *p;
+	bool neg = *s == '-';
+	if (*s == '-' || *s == '+')
+		s++;
+
+	uint64_t mantissa = 0;
+	int digits = 0, scale = 0;
+	bool any_digits = false;
+	for (; is_digit(*s); s++, any_digits = true) {
+		if (mantissa || *s != '0')
+			digits++;
+		mantissa = mantissa * 10 + (*s - '0');
+	}
+	if (*s == '.') {
+		for (s++; is_digit(*s); s++, any_digits = true) {
+			if (mantissa || *s != '0')
+				digits++;
+			mantissa = mantissa * 10 + (*s - '0');
+			scale--;
+		}
+	}
+	if (*s == 'e' || *s == 'E') {
+		int64_t exponent;
+		const char *e = s + 1;
+		if (*e == '+' || *e == '-' || is_digit(*e)) {
+			if (!next_int(&e, &exponent) || exponent > 1000 || exponent < -1000)
+				goto slow;
+			scale += (int)exponent;
+			s = e;
+		}
+	}
+
+	if (!any_digits || digits > 19 || mantissa > (1ull << 53) || scale < -22 || scale > 22 || *s == 'x' || *s == 'X')
+		goto slow;
+
+	double rtn = (double)mantissa;
+	rtn = scale < 0 ? rtn / exact_pow10[-scale] : rtn * exact_pow10[scale];
+	*v = neg ? -rtn : rtn;
+	*p = s;
+	return true;
+
+slow : {
+	char *end;
+	*v = strtod(*p, &end);
+	if (end == *p)
+		return false;
+	*p = end;
+	return true;
+}
+}
+
+static bool next_ints(const char **p, int64_t *v, int cnt) {
+	for (int i = 0; i < cnt; i++) {
+		if (!next_int(p, &v[i]))
+			return false;
+	}
+	return true;
+}
+
+// Returns how many values were read before the first one that couldn't be
+static int next_flts(const char **p, FLT *v, int cnt) {
+	for (int i = 0; i < cnt; i++) {
+		double d;
+		if (!next_double(p, &d))
+			return i;
+		v[i] = d;
+	}
+	return cnt;
+}
+
+static bool next_pose(const char **p, SurvivePose *pose) {
+	FLT v[7];
+	if (next_flts(p, v, 7) != 7)
+		return false;
+	memcpy(pose->Pos, v, sizeof(pose->Pos));
+	memcpy(pose->Rot, v + 3, sizeof(pose->Rot));
+	return true;
+}
+
+static bool next_velocity(const char **p, SurviveVelocity *vel) {
+	FLT v[6];
+	if (next_flts(p, v, 6) != 6)
+		return false;
+	memcpy(vel->Pos, v, sizeof(vel->Pos));
+	memcpy(vel->AxisAngleRot, v + 3, sizeof(vel->AxisAngleRot));
+	return true;
+}
+
+static bool parse_imu(survive_binary_record *record, const char *args) {
+	int64_t v[2];
+	if (!next_ints(&args, v, 2)) {
+		return false;
+	}
+	record->imu.mask = v[0];
+	record->imu.timecode = v[1];
+
+	int rr = next_flts(&args, record->imu.accelgyro, 9);
+	if (rr == 7) {
+		// Older formats might not have mag data
+		record->imu.id = record->imu.accelgyro[6];
+		record->imu.accelgyro[6] = 0;
+		return true;
+	}
+	int64_t id;
+	if (rr != 9 || !next_int(&args, &id)) {
+		return false;
+	}
+	record->imu.id = id;
+	return true;
+}
+
+bool survive_binary_record_parse_text(survive_binary_record *record, char *line) {
+	*record = (survive_binary_record){0};
+
+	size_t len = strlen(line);
+	while (len && (line[len - 1] == '\n' || line[len - 1] == '\r')) {
+		line[--len] = 0;
+	}
+
+	const char *args = line;
+	double time;
+	if (!next_double(&args, &time) || (*args != ' ' && *args != 0)) {
+		return false;
+	}
+
+	if (!survive_binary_record_parse_event(record, (char *)args)) {
+		return false;
+	}
+	record->time = time;
+	return true;
+}
+
+bool survive_binary_record_parse_event(survive_binary_record *record, char *line) {
+	*record = (survive_binary_record){0};
+
+	char *name, *op;
+	char *rest = line;
+	while (*rest == ' ')
+		rest++;
+	size_t rest_len = strlen(rest);
+	char *args = next_token(rest, &name);
+
+	if (strcmp(name, "OPTION") == 0) {
+		record->type = SURVIVE_BINARY_RECORD_OPTION;
+		record->text = args;
+		record->text_len = strlen(args);
+		return true;
+	}
+
+	args = next_token(args, &op);
+	if (*op == 0) {
+		return false;
+	}
+
+	bool has_single_op = op[1] == 0 && strchr("YWBACSLRIi", op[0]);
+	if (!has_single_op && strcmp(op, "CONFIG") != 0 && strcmp(op, "LH_POSE") != 0 && strcmp(op, "POSE") != 0 &&
+		strcmp(op, "EXTERNAL_POSE") != 0 && strcmp(op, "VELOCITY") != 0 && strcmp(op, "EXTERNAL_VELOCITY") != 0 &&
+		strcmp(op, "BUTTON") != 0 && !(strcmp(name, "INFO") == 0 && strcmp(op, "LOG") == 0)) {
+		// Put the line back together and keep it as is
+		for (size_t i = 0; i < rest_len; i++) {
+			if (rest[i] == 0)
+				rest[i] = ' ';
+		}
+		record->type = SURVIVE_BINARY_RECORD_TEXT;
+		record->text = rest;
+		record->text_len = rest_len;
+		return true;
+	}
+
+	if (strcmp(name, "INFO") == 0 && strcmp(op, "LOG") == 0) {
+		record->type = SURVIVE_BINARY_RECORD_INFO;
+		record->text = args;
+		record->text_len = strlen(args);
+		return true;
+	}
+
+	record->name = name;
+	const char *p = args;
+	int64_t v[6];
+
+	if (strcmp(op, "CONFIG") == 0) {
+		record->type = SURVIVE_BINARY_RECORD_CONFIG;
+		record->text = args;
+		record->text_len = strlen(args);
+		return true;
+	} else if (strcmp(op, "LH_POSE") == 0) {
+		record->type = SURVIVE_BINARY_RECORD_LH_POSE;
+		record->name = 0;
+		record->lh_pose.lh = atoi(name);
+		return next_pose(&p, &record->lh_pose.pose);
+	} else if (strcmp(op, "POSE") == 0 || strcmp(op, "EXTERNAL_POSE") == 0) {
+		record->type = op[0] == 'P' ? SURVIVE_BINARY_RECORD_POSE : SURVIVE_BINARY_RECORD_EXTERNAL_POSE;
+		return next_pose(&p, &record->pose);
+	} else if (strcmp(op, "VELOCITY") == 0 || strcmp(op, "EXTERNAL_VELOCITY") == 0) {
+		record->type = op[0] == 'V' ? SURVIVE_BINARY_RECORD_VELOCITY : SURVIVE_BINARY_RECORD_EXTERNAL_VELOCITY;
+		return next_velocity(&p, &record->velocity);
+	} else if (strcmp(op, "BUTTON") == 0) {
+		record->type = SURVIVE_BINARY_RECORD_BUTTON;
+		if (!next_ints(&p, v, 2))
+			return false;
+		record->button.event_type = v[0];
+		record->button.button_id = v[1];
+		return true;
+	}
+
+	if (op[1] != 0) {
+		return false;
+	}
+
+	switch (op[0]) {
+	case 'Y':
+		record->type = SURVIVE_BINARY_RECORD_SYNC;
+		if (!next_ints(&p, v, 4))
+			return false;
+		record->sync.channel = v[0];
+		record->sync.timecode = v[1];
+		record->sync.ootx = v[2];
+		record->sync.gen = v[3];
+		return true;
+	case 'W':
+		record->type = SURVIVE_BINARY_RECORD_SWEEP;
+		if (!next_ints(&p, v, 4))
+			return false;
+		record->sweep.channel = v[0];
+		record->sweep.sensor_id = v[1];
+		record->sweep.timecode = v[2];
+		record->sweep.flag = v[3];
+		return true;
+	case 'B':
+		record->type = SURVIVE_BINARY_RECORD_SWEEP_ANGLE;
+		if (!next_ints(&p, v, 4) || next_flts(&p, &record->sweep_angle.angle, 1) != 1)
+			return false;
+		record->sweep_angle.channel = v[0];
+		record->sweep_angle.sensor_id = v[1];
+		record->sweep_angle.timecode = v[2];
+		record->sweep_angle.plane = v[3];
+		return true;
+	case 'A':
+		record->type = SURVIVE_BINARY_RECORD_ANGLE;
+		if (!next_ints(&p, v, 3) || next_flts(&p, &record->angle.length, 1) != 1 ||
+			next_flts(&p, &record->angle.angle, 1) != 1 || !next_int(&p, &v[3]))
+			return false;
+		record->angle.sensor_id = v[0];
+		record->angle.acode = v[1];
+		record->angle.timecode = v[2];
+		record->angle.lh = v[3];
+		return true;
+	case 'C':
+		record->type = SURVIVE_BINARY_RECORD_LIGHTCAP;
+		if (!next_ints(&p, v, 3))
+			return false;
+		record->lightcap.sensor_id = v[0];
+		record->lightcap.timestamp = v[1];
+		record->lightcap.length = v[2];
+		return true;
+	case 'S':
+	case 'L':
+	case 'R':
+		record->type = SURVIVE_BINARY_RECORD_LIGHT;
+		if (op[0] != 'S') {
+			// The axis is implied by the acode
+			char *axis;
+			p = next_token(args, &axis);
+		}
+		if (!next_ints(&p, v, 6))
+			return false;
+		record->light.sensor_id = v[0];
+		record->light.acode = v[1];
+		record->light.timeinsweep = v[2];
+		record->light.timecode = v[3];
+		record->light.length = v[4];
+		record->light.lh = v[5];
+		return true;
+	case 'I':
+	case 'i':
+		record->type = op[0] == 'I' ? SURVIVE_BINARY_RECORD_IMU : SURVIVE_BINARY_RECORD_RAW_IMU;
+		return parse_imu(record, p);
+	}
+
+	return false;
+}
+
+static void append_pose(cstring *out, const SurvivePose *pose) {
+	str_append_printf(out, FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF, pose->Pos[0],
+					  pose->Pos[1], pose->Pos[2], pose->Rot[0], pose->Rot[1], pose->Rot[2], pose->Rot[3]);
+}
+
+static void append_velocity(cstring *out, const SurviveVelocity *vel) {
+	str_append_printf(out, FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF, vel->Pos[0], vel->Pos[1],
+					  vel->Pos[2], vel->AxisAngleRot[0], vel->AxisAngleRot[1], vel->AxisAngleRot[2]);
+}
+
+static void append_light(cstring *out, const survive_binary_record *record) {
+	const char *dev = record->name;
+	int acode = record->light.acode;
+	if (acode == -1) {
+		str_append_printf(out, "%s S %d %d %d %u %u %u\r\n", dev, record->light.sensor_id, acode,
+						  record->light.timeinsweep, record->light.timecode, record->light.length, record->light.lh);
+		return;
+	}
+
+	const char *LH_ID = (acode & 4) ? "R" : "L";
+	const char *LH_Axis = (acode & 1) ? "Y" : "X";
+	str_append_printf(out, "%s %s %s %d %d %d %u %u %u\r\n", dev, LH_ID, LH_Axis, record->light.sensor_id, acode,
+					  record->light.timeinsweep, record->light.timecode, record->light.length, record->light.lh);
+}
+
+void survive_binary_record_append_text(cstring *out, const survive_binary_record *record) {
+	const char *dev = record->name ? record->name : "";
+	str_append_printf(out, FLT_PRINTF, record->time);
+
+	switch (record->type) {
+	case SURVIVE_BINARY_RECORD_CONFIG:
+		str_append_printf(out, "%s CONFIG %.*s\r\n", dev, (int)record->text_len, record->text);
+		break;
+	case SURVIVE_BINARY_RECORD_INFO:
+		str_append_printf(out, "INFO LOG %.*s\r\n", (int)record->text_len, record->text);
+		break;
+	case SURVIVE_BINARY_RECORD_OPTION:
+		str_append_printf(out, "OPTION %.*s\n", (int)record->text_len, record->text);
+		break;
+	case SURVIVE_BINARY_RECORD_TEXT:
+		str_append_printf(out, "%.*s\n", (int)record->text_len, record->text);
+		break;
+	case SURVIVE_BINARY_RECORD_LH_POSE:
+		str_append_printf(out, "%d LH_POSE ", record->lh_pose.lh);
+		append_pose(out, &record->lh_pose.pose);
+		str_append_printf(out, "\r\n");
+		break;
+	case SURVIVE_BINARY_RECORD_POSE:
+		str_append_printf(out, "%s POSE ", dev);
+		append_pose(out, &record->pose);
+		str_append_printf(out, "\r\n");
+		break;
+	case SURVIVE_BINARY_RECORD_EXTERNAL_POSE:
+		str_append_printf(out, "%s EXTERNAL_POSE ", dev);
+		append_pose(out, &record->pose);
+		str_append_printf(out, "\n");
+		break;
+	case SURVIVE_BINARY_RECORD_VELOCITY:
+		str_append_printf(out, "%s VELOCITY ", dev);
+		append_velocity(out, &record->velocity);
+		str_append_printf(out, "\r\n");
+		break;
+	case SURVIVE_BINARY_RECORD_EXTERNAL_VELOCITY:
+		str_append_printf(out, "%s EXTERNAL_VELOCITY ", dev);
+		append_velocity(out, &record->velocity);
+		str_append_printf(out, "\r\n");
+		break;
+	case SURVIVE_BINARY_RECORD_SYNC:
+		str_append_printf(out, SYNC_PRINTF, dev, record->sync.channel, record->sync.timecode, record->sync.ootx,
+						  record->sync.gen);
+		break;
+	case SURVIVE_BINARY_RECORD_SWEEP:
+		str_append_printf(out, SWEEP_PRINTF, dev, record->sweep.channel, record->sweep.sensor_id,
+						  record->sweep.timecode, record->sweep.flag);
+		break;
+	case SURVIVE_BINARY_RECORD_SWEEP_ANGLE:
+		str_append_printf(out, SWEEP_ANGLE_PRINTF, dev, record->sweep_angle.channel, record->sweep_angle.sensor_id,
+						  record->sweep_angle.timecode, record->sweep_angle.plane, record->sweep_angle.angle);
+		break;
+	case SURVIVE_BINARY_RECORD_BUTTON:
+		str_append_printf(out, "%s BUTTON %u %u\r\n", dev, record->button.event_type, record->button.button_id);
+		break;
+	case SURVIVE_BINARY_RECORD_ANGLE:
+		str_append_printf(out, "%s A %d %d %u " FLT_PRINTF FLT_PRINTF "%u\r\n", dev, record->angle.sensor_id,
+						  record->angle.acode, record->angle.timecode, record->angle.length, record->angle.angle,
+						  record->angle.lh);
+		break;
+	case SURVIVE_BINARY_RECORD_LIGHTCAP:
+		str_append_printf(out, "%s C %d %u %u\r\n", dev, record->lightcap.sensor_id, record->lightcap.timestamp,
+						  record->lightcap.length);
+		break;
+	case SURVIVE_BINARY_RECORD_LIGHT:
+		append_light(out, record);
+		break;
+	case SURVIVE_BINARY_RECORD_IMU:
+	case SURVIVE_BINARY_RECORD_RAW_IMU: {
+		const FLT *ag = record->imu.accelgyro;
+		str_append_printf(out,
+						  "%s %c %d %u " FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF FLT_PRINTF
+						  " " FLT_PRINTF FLT_PRINTF FLT_PRINTF "%d\r\n",
+						  dev, record->type == SURVIVE_BINARY_RECORD_IMU ? 'I' : 'i', record->imu.mask,
+						  record->imu.timecode, ag[0], ag[1], ag[2], ag[3], ag[4], ag[5], ag[6], ag[7], ag[8],
+						  record->imu.id);
+		break;
+	}
+	default:
+		str_append_printf(out, "\n");
+		break;
+	}
+}
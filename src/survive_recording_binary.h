@@ -0,0 +1,221 @@
+#pragma once
+
+#include "survive.h"
+#include "survive_gz.h"
+#include "survive_str.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Binary recording format.
+ *
+ * The file starts with an 8 byte header; the magic "SVBR", a little-endian uint16 version and a reserved uint16.
+ * Every record after that is a 6 byte header -- uint8 type, uint8 name index and an int32 delta of the run time in
+ * microseconds from the previous record -- followed by a payload whose size is fixed per type. CONFIG, INFO, OPTION,
+ * TEXT and STRING payloads are a uint32 length followed by that many bytes.
+ *
+ * Device and external object names are sent once as STRING records and referred to by index afterwards. Device
+ * timecodes are stored as the (wrapping) difference from the last timecode seen for that name, which keeps the
+ * stream very compressible when written through gz.
+ *
+ * A RESTART record carries the absolute time and clears the string table and timecodes, so reading can begin right at
+ * it; the recorder writes one at every checkpoint of the recording's index, and the writer writes one whenever the
+ * string table runs out of indices. Version 1 files never contain one. Readers drop device and object records whose
+ * name they do not know.
+ *
+ * All values are little-endian. Angles, lengths and IMU values are stored as 32 bit floats; poses and velocities as
+ * 64 bit floats.
+ */
+
+#define SURVIVE_BINARY_RECORDING_MAGIC "SVBR"
+#define SURVIVE_BINARY_RECORDING_VERSION 2
+#define SURVIVE_BINARY_RECORDING_HEADER_SIZE 8
+#define SURVIVE_BINARY_RECORD_HEADER_SIZE 6
+#define SURVIVE_BINARY_RECORD_NO_NAME 0xff
+
+typedef enum {
+	SURVIVE_BINARY_RECORD_STRING = 1,
+	SURVIVE_BINARY_RECORD_TIME,
+	SURVIVE_BINARY_RECORD_CONFIG,
+	SURVIVE_BINARY_RECORD_INFO,
+	SURVIVE_BINARY_RECORD_OPTION,
+	SURVIVE_BINARY_RECORD_LH_POSE,
+	SURVIVE_BINARY_RECORD_POSE,
+	SURVIVE_BINARY_RECORD_VELOCITY,
+	SURVIVE_BINARY_RECORD_EXTERNAL_POSE,
+	SURVIVE_BINARY_RECORD_EXTERNAL_VELOCITY,
+	SURVIVE_BINARY_RECORD_SYNC,
+	SURVIVE_BINARY_RECORD_SWEEP,
+	SURVIVE_BINARY_RECORD_SWEEP_ANGLE,
+	SURVIVE_BINARY_RECORD_BUTTON,
+	SURVIVE_BINARY_RECORD_ANGLE,
+	SURVIVE_BINARY_RECORD_LIGHTCAP,
+	SURVIVE_BINARY_RECORD_LIGHT,
+	SURVIVE_BINARY_RECORD_IMU,
+	SURVIVE_BINARY_RECORD_RAW_IMU,
+	// Free form lines, eg from survive_recording_write_to_output
+	SURVIVE_BINARY_RECORD_TEXT,
+	SURVIVE_BINARY_RECORD_RESTART,
+	SURVIVE_BINARY_RECORD_TYPE_CNT
+} survive_binary_record_type;
+
+typedef struct survive_binary_record {
+	survive_binary_record_type type;
+	double time;
+
+	// Device codename or external object name. Owned by whoever filled in the record; for the reader it stays valid
+	// until the reader is freed.
+	const char *name;
+
+	// CONFIG, INFO, OPTION and TEXT payloads. The reader's copy is only valid until the next record is read, and
+	// isn't NUL terminated when reading from a buffer.
+	const char *text;
+	size_t text_len;
+
+	union {
+		struct {
+			uint8_t lh;
+			SurvivePose pose;
+		} lh_pose;
+		SurvivePose pose;
+		SurviveVelocity velocity;
+		struct {
+			survive_channel channel;
+			survive_timecode timecode;
+			bool ootx;
+			bool gen;
+		} sync;
+		struct {
+			survive_channel channel;
+			int sensor_id;
+			survive_timecode timecode;
+			bool flag;
+		} sweep;
+		struct {
+			survive_channel channel;
+			int sensor_id;
+			survive_timecode timecode;
+			int8_t plane;
+			FLT angle;
+		} sweep_angle;
+		struct {
+			uint8_t event_type;
+			uint8_t button_id;
+		} button;
+		struct {
+			int sensor_id;
+			int acode;
+			survive_timecode timecode;
+			FLT length;
+			FLT angle;
+			uint32_t lh;
+		} angle;
+		LightcapElement lightcap;
+		struct {
+			int sensor_id;
+			int acode;
+			int timeinsweep;
+			survive_timecode timecode;
+			uint32_t length;
+			uint32_t lh;
+		} light;
+		struct {
+			int mask;
+			survive_timecode timecode;
+			FLT accelgyro[9];
+			int id;
+		} imu;
+	};
+} survive_binary_record;
+
+typedef struct survive_binary_writer {
+	// Exactly one of these is the output
+	gzFile output_file;
+	cstring *output_buffer;
+	int64_t time_us;
+
+	size_t name_cnt;
+	char *names[SURVIVE_BINARY_RECORD_NO_NAME];
+	survive_timecode last_timecode[SURVIVE_BINARY_RECORD_NO_NAME + 1];
+} survive_binary_writer;
+
+typedef struct survive_binary_reader {
+	// Exactly one of these is the input
+	gzFile input_file;
+	const uint8_t *data;
+	size_t data_size, data_offset;
+
+	int64_t time_us;
+
+	char *names[SURVIVE_BINARY_RECORD_NO_NAME + 1];
+	survive_timecode last_timecode[SURVIVE_BINARY_RECORD_NO_NAME + 1];
+
+	char *text;
+	size_t text_size;
+} survive_binary_reader;
+
+// Whether the given filename should be recorded in the binary format; ie it ends in .bin or .bin.gz
+SURVIVE_EXPORT bool survive_recording_is_binary_filename(const char *fn);
+
+/**
+ * Writes the file header. Returns -1 if that fails.
+ */
+SURVIVE_EXPORT int survive_binary_writer_init(survive_binary_writer *writer, gzFile output_file);
+/**
+ * Same as survive_binary_writer_init, but appends the encoded stream to output_buffer instead of writing a file.
+ */
+SURVIVE_EXPORT int survive_binary_writer_init_buffer(survive_binary_writer *writer, cstring *output_buffer);
+/**
+ * Returns the number of bytes written, or -1 on error.
+ */
+SURVIVE_EXPORT int survive_binary_writer_write(survive_binary_writer *writer, const survive_binary_record *record);
+// Frees the string table; the file itself belongs to the caller
+SURVIVE_EXPORT void survive_binary_writer_free(survive_binary_writer *writer);
+/**
+ * Forgets the string table and timecodes and writes a RESTART record, so that a reader can start at the current
+ * position of output_file without having seen anything before it. output_file replaces the writer's file, eg when the
+ * caller starts a new gzip member; it is ignored by writers that write to a buffer. Returns -1 on error.
+ */
+SURVIVE_EXPORT int survive_binary_writer_restart(survive_binary_writer *writer, gzFile output_file);
+
+/**
+ * Reads and checks the file header. Returns -1 if input_file isn't a binary recording or is a version this build
+ * doesn't understand; the read position is then undefined.
+ */
+SURVIVE_EXPORT int survive_binary_reader_init(survive_binary_reader *reader, gzFile input_file);
+/**
+ * Same as survive_binary_reader_init, but reads from a recording already in memory, eg a mapped file. Records point
+ * into data wherever they can, so it has to outlive the reader.
+ */
+SURVIVE_EXPORT int survive_binary_reader_init_buffer(survive_binary_reader *reader, const void *data, size_t size);
+/**
+ * Returns 1 when a record was read, 0 at the end of the file and -1 on a malformed file.
+ */
+SURVIVE_EXPORT int survive_binary_reader_next(survive_binary_reader *reader, survive_binary_record *record);
+/**
+ * Continues reading at a RESTART record. File readers switch to input_file at its current
+ * position; buffer readers move to data_offset.
+ */
+SURVIVE_EXPORT void survive_binary_reader_restart(survive_binary_reader *reader, gzFile input_file, size_t data_offset);
+SURVIVE_EXPORT void survive_binary_reader_free(survive_binary_reader *reader);
+
+/**
+ * Parses one line of a text recording. The line is modified in place and record's name and text point into it.
+ * Lines with an unknown op become TEXT records. Returns false for lines that can't be parsed.
+ */
+SURVIVE_EXPORT bool survive_binary_record_parse_text(survive_binary_record *record, char *line);
+/**
+ * Same as survive_binary_record_parse_text, for a line that has had its leading time stripped off already. record's
+ * time is left at 0.
+ */
+SURVIVE_EXPORT bool survive_binary_record_parse_event(survive_binary_record *record, char *line);
+/**
+ * Appends the text recording form of record, line ending included, to out.
+ */
+SURVIVE_EXPORT void survive_binary_record_append_text(cstring *out, const survive_binary_record *record);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,138 @@
+#include "survive_recording_index.h"
+
+#include <inttypes.h>
+#include <string.h>
+
+#define INDEX_SUFFIX ".idx"
+
+char *survive_recording_index_filename(const char *recording_fn) {
+	size_t len = strlen(recording_fn);
+	char *rtn = SV_MALLOC(len + sizeof(INDEX_SUFFIX));
+	memcpy(rtn, recording_fn, len);
+	memcpy(rtn + len, INDEX_SUFFIX, sizeof(INDEX_SUFFIX));
+	return rtn;
+}
+
+FILE *survive_recording_index_create(const char *recording_fn) {
+	char *fn = survive_recording_index_filename(recording_fn);
+	FILE *f = fopen(fn, "w");
+	free(fn);
+	if (f) {
+		fprintf(f, "SVIDX %d\n", SURVIVE_RECORDING_INDEX_VERSION);
+	}
+	return f;
+}
+
+int survive_recording_index_write_entry(FILE *f, const survive_recording_index_entry *entry) {
+	int r = 0;
+	switch (entry->type) {
+	case SURVIVE_RECORDING_INDEX_CHECKPOINT:
+		r = fprintf(f, "K %0.6f %" PRIu64 " %" PRId64 "\n", entry->time, entry->offset, entry->compressed_offset);
+		break;
+	case SURVIVE_RECORDING_INDEX_CONFIG:
+		r = fprintf(f, "C %0.6f %" PRIu64 "\n", entry->time, entry->offset);
+		break;
+	case SURVIVE_RECORDING_INDEX_LH_POSE:
+		r = fprintf(f, "L %0.6f %" PRIu64 " %d\n", entry->time, entry->offset, entry->lh);
+		break;
+	default:
+		return -1;
+	}
+
+	// Written as the recording goes, so that the index is usable even if the recorder never shuts down cleanly
+	fflush(f);
+	return r < 0 ? -1 : 0;
+}
+
+void survive_recording_index_add(survive_recording_index *index, const survive_recording_index_entry *entry) {
+	if (index->entry_cnt >= index->entry_size) {
+		index->entry_size = index->entry_size ? 2 * index->entry_size : 64;
+		index->entries = SV_REALLOC(index->entries, index->entry_size * sizeof(survive_recording_index_entry));
+	}
+	index->entries[index->entry_cnt++] = *entry;
+}
+
+int survive_recording_index_load(survive_recording_index *index, const char *recording_fn) {
+	*index = (survive_recording_index){0};
+
+	char *fn = survive_recording_index_filename(recording_fn);
+	FILE *f = fopen(fn, "r");
+	free(fn);
+	if (f == 0) {
+		return -1;
+	}
+
+	int version = 0;
+	if (fscanf(f, "SVIDX %d\n", &version) != 1 || version > SURVIVE_RECORDING_INDEX_VERSION) {
+		fclose(f);
+		return -1;
+	}
+
+	char line[128];
+	while (fgets(line, sizeof(line), f)) {
+		survive_recording_index_entry entry = {.type = line[0], .compressed_offset = -1, .lh = -1};
+		int expected = 0, r = 0;
+		switch (entry.type) {
+		case SURVIVE_RECORDING_INDEX_CHECKPOINT:
+			expected = 3;
+			r = sscanf(line + 1, "%lf %" SCNu64 " %" SCNd64, &entry.time, &entry.offset, &entry.compressed_offset);
+			break;
+		case SURVIVE_RECORDING_INDEX_CONFIG:
+			expected = 2;
+			r = sscanf(line + 1, "%lf %" SCNu64, &entry.time, &entry.offset);
+			break;
+		case SURVIVE_RECORDING_INDEX_LH_POSE:
+			expected = 3;
+			r = sscanf(line + 1, "%lf %" SCNu64 " %d", &entry.time, &entry.offset, &entry.lh);
+			break;
+		default:
+			break;
+		}
+
+		// The last line can be cut short if the recorder died mid write; everything before it is still good
+		if (r != expected || expected == 0) {
+			break;
+		}
+		survive_recording_index_add(index, &entry);
+	}
+
+	fclose(f);
+	return 0;
+}
+
+void survive_recording_index_free(survive_recording_index *index) {
+	free(index->entries);
+	*index = (survive_recording_index){0};
+}
+
+const survive_recording_index_entry *survive_recording_index_checkpoint_before(const survive_recording_index *index,
+																			   double time) {
+	const survive_recording_index_entry *rtn = 0;
+	for (size_t i = 0; i < index->entry_cnt; i++) {
+		const survive_recording_index_entry *entry = &index->entries[i];
+		if (entry->type != SURVIVE_RECORDING_INDEX_CHECKPOINT) {
+			continue;
+		}
+		if (entry->time > time) {
+			break;
+		}
+		rtn = entry;
+	}
+	return rtn;
+}
+
+const survive_recording_index_entry *
+survive_recording_index_checkpoint_of(const survive_recording_index *index, const survive_recording_index_entry *entry) {
+	const survive_recording_index_entry *rtn = 0;
+	for (size_t i = 0; i < index->entry_cnt; i++) {
+		const survive_recording_index_entry *checkpoint = &index->entries[i];
+		if (checkpoint->type != SURVIVE_RECORDING_INDEX_CHECKPOINT) {
+			continue;
+		}
+		if (checkpoint->offset > entry->offset) {
+			break;
+		}
+		rtn = checkpoint;
+	}
+	return rtn;
+}
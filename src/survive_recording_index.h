@@ -0,0 +1,83 @@
+#pragma once
+
+#include "survive.h"
+
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Sidecar index for recordings, kept next to the recording as "<recording>.idx".
+ *
+ * The recorder writes a checkpoint every record-index-interval seconds. At a checkpoint the event stream can be
+ * picked up again without anything that came before it: compressed recordings start a new gzip member there, and
+ * binary recordings resend their string table and absolute time. CONFIG and LH_POSE events are indexed as well so that
+ * playback starting at a checkpoint can rerun them first.
+ *
+ * The index is a text file; the first line is "SVIDX <version>" and every line after that is one entry:
+ *
+ *   K <time> <offset> <compressed offset>
+ *   C <time> <offset>
+ *   L <time> <offset> <lighthouse>
+ *
+ * Offsets are into the uncompressed stream. The compressed offset is the file offset of the gzip member starting at the
+ * checkpoint, or -1 when the recording isn't compressed.
+ */
+
+#define SURVIVE_RECORDING_INDEX_VERSION 1
+
+typedef enum {
+	SURVIVE_RECORDING_INDEX_CHECKPOINT = 'K',
+	SURVIVE_RECORDING_INDEX_CONFIG = 'C',
+	SURVIVE_RECORDING_INDEX_LH_POSE = 'L',
+} survive_recording_index_entry_type;
+
+typedef struct survive_recording_index_entry {
+	survive_recording_index_entry_type type;
+	double time;
+	uint64_t offset;
+	// Checkpoints only
+	int64_t compressed_offset;
+	// LH_POSE only
+	int lh;
+} survive_recording_index_entry;
+
+typedef struct survive_recording_index {
+	size_t entry_cnt, entry_size;
+	// In file order
+	survive_recording_index_entry *entries;
+} survive_recording_index;
+
+// Returns the malloc'ed name of the index file for the given recording
+SURVIVE_EXPORT char *survive_recording_index_filename(const char *recording_fn);
+
+/**
+ * Opens the index file for the given recording and writes its header. Returns 0 if it can't be created.
+ */
+SURVIVE_EXPORT FILE *survive_recording_index_create(const char *recording_fn);
+SURVIVE_EXPORT int survive_recording_index_write_entry(FILE *f, const survive_recording_index_entry *entry);
+
+/**
+ * Loads the index for the given recording. Returns -1 if there is none or it can't be read; index is left empty then.
+ */
+SURVIVE_EXPORT int survive_recording_index_load(survive_recording_index *index, const char *recording_fn);
+SURVIVE_EXPORT void survive_recording_index_add(survive_recording_index *index,
+												const survive_recording_index_entry *entry);
+SURVIVE_EXPORT void survive_recording_index_free(survive_recording_index *index);
+
+/**
+ * Returns the last checkpoint at or before the given time, or 0 if the recording has to be read from the start.
+ */
+SURVIVE_EXPORT const survive_recording_index_entry *
+survive_recording_index_checkpoint_before(const survive_recording_index *index, double time);
+/**
+ * Returns the checkpoint the given entry has to be read from, or 0 if that is the start of the recording.
+ */
+SURVIVE_EXPORT const survive_recording_index_entry *
+survive_recording_index_checkpoint_of(const survive_recording_index *index, const survive_recording_index_entry *entry);
+
+#ifdef __cplusplus
+}
+#endif
@@ -8,7 +8,10 @@
 #include "force_O3.h"
 
 #ifdef BUILD_LH1_SUPPORT
+#include "generated/survive_reproject.batch.generated.h"
+#include "generated/survive_reproject.float.generated.h"
 #include "generated/survive_reproject.generated.h"
+#include "generated/survive_reproject.prepared.generated.h"
 #endif
 static inline FLT survive_reproject_axis(const BaseStationCal *bcal, FLT axis_value, FLT other_axis_value, FLT Z,
 										 bool invert_axis_value) {
@@ -83,11 +86,19 @@ void survive_reproject(const SurviveContext *ctx, int lighthouse, LinmathVec3d c
 
 void survive_apply_bsd_calibration(const SurviveContext *ctx, int lh, const SurviveAngleReading in,
 								   SurviveAngleReading out) {
-	const BaseStationCal *cal = ctx->bsd[lh].fcal;
-	out[0] = in[0] + cal[0].phase;
-	out[1] = in[1] + cal[1].phase;
+	// Posers call this without the ctx lock; the calibration comes in with OOTX under the bsd lock
+	SurviveContext *mctx = (SurviveContext *)ctx;
+	survive_get_bsd_lock(mctx);
+	FLT phase[2] = {ctx->bsd[lh].fcal[0].phase, ctx->bsd[lh].fcal[1].phase};
+	survive_release_bsd_lock(mctx);
+
+	out[0] = in[0] + phase[0];
+	out[1] = in[1] + phase[1];
 }
 
+// Fills in a survive_reproject_prepared_fn_t from the generated prepare / eval functions for name
+#define PREPARED_FN(name) {gen_##name##_prepare, gen_##name##_eval, gen_##name##_prepared_size}
+
 const survive_reproject_model_t SURVIVE_EXPORT survive_reproject_model = {
 #ifdef BUILD_LH1_SUPPORT
 	.reprojectAxisFn = {survive_reproject_axis_x, survive_reproject_axis_y},
@@ -106,6 +117,28 @@ const survive_reproject_model_t SURVIVE_EXPORT survive_reproject_model = {
 	.reprojectAxisAngleFullJacLhPose = gen_reproject_jac_lh_p_axis_angle,
 	.reprojectAxisAngleAxisJacobLhPoseFn = {gen_reproject_axis_x_jac_lh_p_axis_angle,
 											gen_reproject_axis_y_jac_lh_p_axis_angle},
+
+	.reprojectFullBatch = gen_reproject_batch,
+	.reprojectAxisFullBatchFn = {gen_reproject_axis_x_batch, gen_reproject_axis_y_batch},
+	.reprojectFullJacObjPoseBatch = gen_reproject_jac_obj_p_batch,
+	.reprojectAxisJacobBatchFn = {gen_reproject_axis_x_jac_obj_p_batch, gen_reproject_axis_y_jac_obj_p_batch},
+	.reprojectAxisAngleFullJacObjPoseBatch = gen_reproject_jac_obj_p_axis_angle_batch,
+	.reprojectAxisAngleAxisJacobBatchFn = {gen_reproject_axis_x_jac_obj_p_axis_angle_batch,
+										   gen_reproject_axis_y_jac_obj_p_axis_angle_batch},
+
+	.reprojectAxisAngleFullPrepared = PREPARED_FN(reproject_axis_angle),
+	.reprojectAxisAnglePrepared = {PREPARED_FN(reproject_axis_x_axis_angle),
+								   PREPARED_FN(reproject_axis_y_axis_angle)},
+	.reprojectAxisAngleFullValJacObjPose = PREPARED_FN(reproject_val_jac_obj_p_axis_angle),
+	.reprojectAxisAngleAxisValJacObjPose = {PREPARED_FN(reproject_axis_x_val_jac_obj_p_axis_angle),
+											PREPARED_FN(reproject_axis_y_val_jac_obj_p_axis_angle)},
+	.reprojectAxisAngleFullValJacPoses = PREPARED_FN(reproject_val_jac_obj_p_lh_p_axis_angle),
+	.reprojectAxisAngleAxisValJacPoses = {PREPARED_FN(reproject_axis_x_val_jac_obj_p_lh_p_axis_angle),
+										  PREPARED_FN(reproject_axis_y_val_jac_obj_p_lh_p_axis_angle)},
+
+	.reprojectAxisAngleFullEvalFloat = gen_reproject_axis_angle_eval_float,
+	.reprojectAxisAngleAxisEvalFloat = {gen_reproject_axis_x_axis_angle_eval_float,
+										gen_reproject_axis_y_axis_angle_eval_float},
 #else
 	0
 #endif
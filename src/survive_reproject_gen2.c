@@ -6,7 +6,10 @@
 
 #include "force_O3.h"
 
+#include "generated/survive_reproject.batch.generated.h"
+#include "generated/survive_reproject.float.generated.h"
 #include "generated/survive_reproject.generated.h"
+#include "generated/survive_reproject.prepared.generated.h"
 
 /***
 	 Using plane equation:
@@ -153,6 +156,9 @@ void survive_reproject_full_gen2(const BaseStationCal *bcal, const SurvivePose *
 	survive_reproject_xy_gen2(bcal, t_pt, out);
 }
 
+// Fills in a survive_reproject_prepared_fn_t from the generated prepare / eval functions for name
+#define PREPARED_FN(name) {gen_##name##_prepare, gen_##name##_eval, gen_##name##_prepared_size}
+
 const survive_reproject_model_t survive_reproject_gen2_model = {
 	.reprojectAxisFn = {survive_reproject_axis_x_gen2, survive_reproject_axis_y_gen2},
 	.reprojectXY = survive_reproject_xy_gen2,
@@ -171,4 +177,26 @@ const survive_reproject_model_t survive_reproject_gen2_model = {
 	.reprojectAxisAngleAxisJacobLhPoseFn = {gen_reproject_axis_x_gen2_jac_lh_p_axis_angle,
 											gen_reproject_axis_y_gen2_jac_lh_p_axis_angle},
 
+	.reprojectFullBatch = gen_reproject_gen2_batch,
+	.reprojectAxisFullBatchFn = {gen_reproject_axis_x_gen2_batch, gen_reproject_axis_y_gen2_batch},
+	.reprojectFullJacObjPoseBatch = gen_reproject_gen2_jac_obj_p_batch,
+	.reprojectAxisJacobBatchFn = {gen_reproject_axis_x_gen2_jac_obj_p_batch, gen_reproject_axis_y_gen2_jac_obj_p_batch},
+	.reprojectAxisAngleFullJacObjPoseBatch = gen_reproject_gen2_jac_obj_p_axis_angle_batch,
+	.reprojectAxisAngleAxisJacobBatchFn = {gen_reproject_axis_x_gen2_jac_obj_p_axis_angle_batch,
+										   gen_reproject_axis_y_gen2_jac_obj_p_axis_angle_batch},
+
+	.reprojectAxisAngleFullPrepared = PREPARED_FN(reproject_gen2_axis_angle),
+	.reprojectAxisAnglePrepared = {PREPARED_FN(reproject_axis_x_gen2_axis_angle),
+								   PREPARED_FN(reproject_axis_y_gen2_axis_angle)},
+	.reprojectAxisAngleFullValJacObjPose = PREPARED_FN(reproject_gen2_val_jac_obj_p_axis_angle),
+	.reprojectAxisAngleAxisValJacObjPose = {PREPARED_FN(reproject_axis_x_gen2_val_jac_obj_p_axis_angle),
+											PREPARED_FN(reproject_axis_y_gen2_val_jac_obj_p_axis_angle)},
+	.reprojectAxisAngleFullValJacPoses = PREPARED_FN(reproject_gen2_val_jac_obj_p_lh_p_axis_angle),
+	.reprojectAxisAngleAxisValJacPoses = {PREPARED_FN(reproject_axis_x_gen2_val_jac_obj_p_lh_p_axis_angle),
+										  PREPARED_FN(reproject_axis_y_gen2_val_jac_obj_p_lh_p_axis_angle)},
+
+	.reprojectAxisAngleFullEvalFloat = gen_reproject_gen2_axis_angle_eval_float,
+	.reprojectAxisAngleAxisEvalFloat = {gen_reproject_axis_x_gen2_axis_angle_eval_float,
+										gen_reproject_axis_y_gen2_axis_angle_eval_float},
+
 };
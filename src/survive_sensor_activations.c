@@ -15,21 +15,118 @@ static FLT moveThresholdAcc = 0;
 static FLT moveThresholdAng = 0;
 static FLT filterLightChange = 0;
 
+#if SENSORS_PER_OBJECT > 32
+#error "seen_sensors needs a bit per sensor"
+#endif
+
+#ifdef SURVIVE_COMPACT_SENSOR_ACTIVATIONS
+// When a reading's timecode is too far past timecode_base to fit in 32 bits, the base moves up to put it this far in.
+// Readings that then fall before the base are clamped to it; they are tens of seconds old by then, well past any
+// tolerance they get checked against.
+#define READING_REBASE_OFFSET 0x80000000u
+
+static void SurviveSensorActivations_fill_readings(SurviveSensorReading *readings, size_t cnt) {
+	for (size_t i = 0; i < cnt; i++) {
+		readings[i] = (SurviveSensorReading){.angle = NAN};
+	}
+}
+
+static void SurviveSensorActivations_reserve_lh(SurviveSensorActivations *self, int lh_cnt) {
+	if (lh_cnt <= self->readings_lh_cnt)
+		return;
+
+	size_t per_lh = SENSORS_PER_OBJECT * 2;
+	self->readings = SV_REALLOC(self->readings, sizeof(SurviveSensorReading) * per_lh * lh_cnt);
+	SurviveSensorActivations_fill_readings(self->readings + per_lh * self->readings_lh_cnt,
+										   per_lh * (lh_cnt - self->readings_lh_cnt));
+	self->readings_lh_cnt = lh_cnt;
+}
+
+static void SurviveSensorActivations_rebase(SurviveSensorActivations *self, survive_long_timecode timecode_base) {
+	survive_long_timecode shift = timecode_base - self->timecode_base;
+	for (size_t i = 0; i < (size_t)self->readings_lh_cnt * SENSORS_PER_OBJECT * 2; i++) {
+		uint32_t *timecode = &self->readings[i].timecode;
+		if (*timecode != 0) {
+			*timecode = *timecode > shift ? (uint32_t)(*timecode - shift) : 1;
+		}
+	}
+	self->timecode_base = timecode_base;
+}
+
+static inline SurviveSensorReading *SurviveSensorActivations_writable_reading(SurviveSensorActivations *self,
+																			  uint32_t sensor_idx, int lh, int axis) {
+	if (lh >= self->readings_lh_cnt) {
+		SurviveSensorActivations_reserve_lh(self, lh + 1);
+	}
+	return &self->readings[((size_t)lh * SENSORS_PER_OBJECT + sensor_idx) * 2 + axis];
+}
+
+static inline void SurviveSensorActivations_store(SurviveSensorActivations *self, uint32_t sensor_idx, int lh,
+												  int axis, FLT angle, survive_long_timecode timecode) {
+	SurviveSensorReading *reading = SurviveSensorActivations_writable_reading(self, sensor_idx, lh, axis);
+	if (timecode > self->timecode_base && timecode - self->timecode_base > UINT32_MAX) {
+		SurviveSensorActivations_rebase(self, timecode - READING_REBASE_OFFSET);
+	}
+
+	reading->angle = angle;
+	reading->timecode = timecode > self->timecode_base ? (uint32_t)(timecode - self->timecode_base) : 1;
+}
+
+static inline void SurviveSensorActivations_count_hit(SurviveSensorActivations *self, uint32_t sensor_idx, int lh,
+													  int axis) {
+	SurviveSensorActivations_writable_reading(self, sensor_idx, lh, axis)->hits++;
+}
+#else
+static inline void SurviveSensorActivations_store(SurviveSensorActivations *self, uint32_t sensor_idx, int lh,
+												  int axis, FLT angle, survive_long_timecode timecode) {
+	self->angles[sensor_idx][lh][axis] = angle;
+	self->timecode[sensor_idx][lh][axis] = timecode;
+}
+
+static inline void SurviveSensorActivations_count_hit(SurviveSensorActivations *self, uint32_t sensor_idx, int lh,
+													  int axis) {
+	self->hits[sensor_idx][lh][axis]++;
+}
+#endif
+
 bool SurviveSensorActivations_is_reading_valid(const SurviveSensorActivations *self, survive_long_timecode tolerance,
 											   uint32_t sensor_idx, int lh, int axis) {
 	return SurviveSensorActivations_time_since_last_reading(self, sensor_idx, lh, axis) <= tolerance;
 }
 
+uint32_t SurviveSensorActivations_valid_sensors(const SurviveSensorActivations *self, survive_long_timecode tolerance,
+												int lh, int axis) {
+	// Every reading from this lighthouse is older than its newest one, so if that is stale they all are
+	if (self->lh_last_reading[lh] + tolerance < self->last_light)
+		return 0;
+
+	uint32_t seen = self->seen_sensors[lh][axis];
+	uint32_t rtn = 0;
+	for (uint32_t sensor_idx = 0; sensor_idx < SENSORS_PER_OBJECT && (seen >> sensor_idx); sensor_idx++) {
+		if (((seen >> sensor_idx) & 1) &&
+			SurviveSensorActivations_is_reading_valid(self, tolerance, sensor_idx, lh, axis)) {
+			rtn |= 1u << sensor_idx;
+		}
+	}
+	return rtn;
+}
+
+static inline void SurviveSensorActivations_mark_seen(SurviveSensorActivations *self, int sensor_id, int lh, int axis,
+													  survive_long_timecode timecode) {
+	self->seen_sensors[lh][axis] |= 1u << sensor_id;
+	if (timecode > self->lh_last_reading[lh])
+		self->lh_last_reading[lh] = timecode;
+}
+
 survive_long_timecode SurviveSensorActivations_last_reading(const SurviveSensorActivations *self, uint32_t sensor_idx,
 															int lh, int axis) {
-	const survive_long_timecode *data_timecode = self->timecode[sensor_idx][lh];
 	if (self->lh_gen != 1 && lh < 2 && self->lengths[sensor_idx][lh][axis] == 0)
 		return UINT64_MAX;
 
-	if (isnan(self->angles[sensor_idx][lh][axis]))
+	if (isnan(SurviveSensorActivations_angle(self, sensor_idx, lh, axis)))
 		return UINT64_MAX;
 
-	return data_timecode[axis];
+	return SurviveSensorActivations_timecode(self, sensor_idx, lh, axis);
 }
 
 survive_timecode SurviveSensorActivations_time_since_last_reading(const SurviveSensorActivations *self,
@@ -45,14 +142,15 @@ survive_timecode SurviveSensorActivations_time_since_last_reading(const SurviveS
 
 bool SurviveSensorActivations_isPairValid(const SurviveSensorActivations *self, uint32_t tolerance,
 										  uint32_t timecode_now, uint32_t idx, int lh) {
-	const survive_long_timecode *data_timecode = self->timecode[idx][lh];
 	if (self->lh_gen != 1 && (self->lengths[idx][lh][0] == 0 || self->lengths[idx][lh][1] == 0))
 		return false;
 
-	if (isnan(self->angles[idx][lh][0]) || isnan(self->angles[idx][lh][1]))
+	if (isnan(SurviveSensorActivations_angle(self, idx, lh, 0)) ||
+		isnan(SurviveSensorActivations_angle(self, idx, lh, 1)))
 		return false;
 
-	return !(timecode_now - data_timecode[0] > tolerance || timecode_now - data_timecode[1] > tolerance);
+	return !(timecode_now - SurviveSensorActivations_timecode(self, idx, lh, 0) > tolerance ||
+			 timecode_now - SurviveSensorActivations_timecode(self, idx, lh, 1) > tolerance);
 }
 
 survive_long_timecode SurviveSensorActivations_last_time(const SurviveSensorActivations *self) {
@@ -148,14 +246,14 @@ static inline void SurviveSensorActivations_update_center(SurviveSensorActivatio
 }
 static inline bool SurviveSensorActivations_check_outlier(SurviveSensorActivations *self, int sensor_id, int lh,
 														  int axis, survive_long_timecode timecode, FLT angle) {
-	FLT *oldangle = &self->angles[sensor_id][lh][axis];
+	FLT oldangle = SurviveSensorActivations_angle(self, sensor_id, lh, axis);
 	if (self->angles_center_dev[lh][axis] == 0) {
 		goto accept_data;
 	}
 
-	const survive_long_timecode *data_timecode = &self->timecode[sensor_id][lh][axis];
-	FLT change_rate = fabs(*oldangle - angle) / (FLT)(timecode - *data_timecode) * 48000000.;
-	if (*data_timecode != 0 && change_rate > filterLightChange) {
+	survive_long_timecode data_timecode = SurviveSensorActivations_timecode(self, sensor_id, lh, axis);
+	FLT change_rate = fabs(oldangle - angle) / (FLT)(timecode - data_timecode) * 48000000.;
+	if (data_timecode != 0 && change_rate > filterLightChange) {
 		goto reject_data;
 	}
 
@@ -174,16 +272,16 @@ static inline bool SurviveSensorActivations_check_outlier(SurviveSensorActivatio
 	}
 
 accept_data:
-	SurviveSensorActivations_update_center(self, .1, lh, axis, *oldangle, angle);
+	SurviveSensorActivations_update_center(self, .1, lh, axis, oldangle, angle);
 	return false;
 reject_data:
 	if (self->so && self->so->ctx) {
 		SurviveContext *ctx = self->so->ctx;
 
-		SV_VERBOSE(105, "Rejecting outlier %f(%f) for %2d.%2d.%d (P %7.7f, %7.7f)", angle, *oldangle, lh, sensor_id,
+		SV_VERBOSE(105, "Rejecting outlier %f(%f) for %2d.%2d.%d (P %7.7f, %7.7f)", angle, oldangle, lh, sensor_id,
 				   axis, P, chauvenet_criterion);
 	}
-	SurviveSensorActivations_update_center(self, .05, lh, axis, *oldangle, angle);
+	SurviveSensorActivations_update_center(self, .05, lh, axis, oldangle, angle);
 	return true;
 }
 
@@ -196,22 +294,21 @@ bool SurviveSensorActivations_add_gen2(SurviveSensorActivations *self, struct Po
 		if (l->sensor_id >= SENSORS_PER_OBJECT)
 			return false;
 
-		survive_long_timecode *data_timecode = &self->timecode[l->sensor_id][l->lh][axis];
-		FLT *angle = &self->angles[l->sensor_id][l->lh][axis];
+		FLT angle = SurviveSensorActivations_angle(self, l->sensor_id, l->lh, axis);
 
 		if (!SurviveSensorActivations_check_outlier(self, l->sensor_id, l->lh, axis, l->hdr.timecode, l->angle)) {
 			survive_long_timecode long_timecode = l->hdr.timecode;
 
-			if (!isnan(*angle) && fabs(*angle - l->angle) > moveThresholdAng) {
+			if (!isnan(angle) && fabs(angle - l->angle) > moveThresholdAng) {
 				self->last_light_change = self->last_movement = long_timecode;
 			}
 
-			if (isnan(*angle))
+			if (isnan(angle))
 				self->last_light_change = long_timecode;
 
 			// fprintf(stderr, "Time %f\n", l->hdr.timecode / 48000000.);
-			*data_timecode = l->hdr.timecode;
-			*angle = l->angle;
+			SurviveSensorActivations_store(self, l->sensor_id, l->lh, axis, l->angle, long_timecode);
+			SurviveSensorActivations_mark_seen(self, l->sensor_id, l->lh, axis, long_timecode);
 		} else {
 			return false;
 		}
@@ -225,17 +322,32 @@ bool SurviveSensorActivations_add_gen2(SurviveSensorActivations *self, struct Po
 
 SURVIVE_EXPORT void SurviveSensorActivations_reset(SurviveSensorActivations *self) {
 	struct SurviveObject *so = self->so;
+#ifdef SURVIVE_COMPACT_SENSOR_ACTIVATIONS
+	SurviveSensorReading *readings = self->readings;
+	int readings_lh_cnt = self->readings_lh_cnt;
+#endif
 	memset(self, 0, sizeof(SurviveSensorActivations));
 	self->so = so;
 
+#ifdef SURVIVE_COMPACT_SENSOR_ACTIVATIONS
+	self->readings = readings;
+	self->readings_lh_cnt = readings_lh_cnt;
+	SurviveSensorActivations_fill_readings(readings, (size_t)readings_lh_cnt * SENSORS_PER_OBJECT * 2);
+#else
 	for (int i = 0; i < SENSORS_PER_OBJECT; i++) {
 		for (int j = 0; j < NUM_GEN2_LIGHTHOUSES; j++) {
 			for (int h = 0; h < 2; h++) {
 				self->angles[i][j][h] = NAN;
-				self->angles_center_x[j][h] = NAN;
 			}
 		}
 	}
+#endif
+
+	for (int j = 0; j < NUM_GEN2_LIGHTHOUSES; j++) {
+		for (int h = 0; h < 2; h++) {
+			self->angles_center_x[j][h] = NAN;
+		}
+	}
 
 	for (int i = 0; i < 3; i++) {
 		self->accel[i] = NAN;
@@ -251,9 +363,45 @@ SURVIVE_EXPORT void SurviveSensorActivations_ctor(SurviveObject *so, SurviveSens
 		filterLightChange = survive_configf(so->ctx, FILTER_THRESHOLD_ANG_TAG, SC_GET, 0);
 	}
 
+#ifdef SURVIVE_COMPACT_SENSOR_ACTIVATIONS
+	self->readings = 0;
+	self->readings_lh_cnt = 0;
+#endif
 	SurviveSensorActivations_reset(self);
 	self->so = so;
 	self->lh_gen = -1;
+
+#ifdef SURVIVE_COMPACT_SENSOR_ACTIVATIONS
+	if (so && so->ctx) {
+		SurviveSensorActivations_reserve_lh(self, so->ctx->activeLighthouses);
+	}
+#endif
+}
+
+SURVIVE_EXPORT void SurviveSensorActivations_dtor(SurviveSensorActivations *self) {
+#ifdef SURVIVE_COMPACT_SENSOR_ACTIVATIONS
+	free(self->readings);
+	self->readings = 0;
+	self->readings_lh_cnt = 0;
+#endif
+}
+
+SURVIVE_EXPORT void SurviveSensorActivations_copy(SurviveSensorActivations *dst, const SurviveSensorActivations *src) {
+#ifdef SURVIVE_COMPACT_SENSOR_ACTIVATIONS
+	SurviveSensorReading *readings = dst->readings;
+	*dst = *src;
+
+	size_t size = sizeof(SurviveSensorReading) * src->readings_lh_cnt * SENSORS_PER_OBJECT * 2;
+	if (size == 0) {
+		free(readings);
+		dst->readings = 0;
+		return;
+	}
+	dst->readings = SV_REALLOC(readings, size);
+	memcpy(dst->readings, src->readings, size);
+#else
+	*dst = *src;
+#endif
 }
 
 bool SurviveSensorActivations_add(SurviveSensorActivations *self, struct PoserDataLightGen1 *_lightData) {
@@ -261,9 +409,7 @@ bool SurviveSensorActivations_add(SurviveSensorActivations *self, struct PoserDa
 
 	int axis = (_lightData->acode & 1);
 	PoserDataLight *lightData = &_lightData->common;
-	survive_long_timecode *data_timecode = &self->timecode[lightData->sensor_id][lightData->lh][axis];
-
-	FLT *angle = &self->angles[lightData->sensor_id][lightData->lh][axis];
+	FLT angle = SurviveSensorActivations_angle(self, lightData->sensor_id, lightData->lh, axis);
 
 	if (SurviveSensorActivations_check_outlier(self, lightData->sensor_id, lightData->lh, axis, lightData->hdr.timecode,
 											   lightData->angle)) {
@@ -272,8 +418,8 @@ bool SurviveSensorActivations_add(SurviveSensorActivations *self, struct PoserDa
 
 	uint32_t *length = &self->lengths[lightData->sensor_id][lightData->lh][axis];
 
-	self->hits[lightData->sensor_id][lightData->lh][axis]++;
-	if (*length == 0 || fabs(*angle - lightData->angle) > moveThresholdAng) {
+	SurviveSensorActivations_count_hit(self, lightData->sensor_id, lightData->lh, axis);
+	if (*length == 0 || fabs(angle - lightData->angle) > moveThresholdAng) {
 		survive_long_timecode long_timecode = lightData->hdr.timecode;
 		// assert(long_timecode > self->last_movement);
 		self->last_light_change = self->last_movement = long_timecode;
@@ -281,9 +427,10 @@ bool SurviveSensorActivations_add(SurviveSensorActivations *self, struct PoserDa
 
 	SurviveContext *ctx = self->so->ctx;
 
-	*angle = lightData->angle;
-	*data_timecode = lightData->hdr.timecode;
+	SurviveSensorActivations_store(self, lightData->sensor_id, lightData->lh, axis, lightData->angle,
+								   lightData->hdr.timecode);
 	*length = (uint32_t)(_lightData->length * 48000000);
+	SurviveSensorActivations_mark_seen(self, lightData->sensor_id, lightData->lh, axis, lightData->hdr.timecode);
 	if (lightData->hdr.timecode > self->last_light) {
 		if (self->last_light != 0 && lightData->hdr.timecode - self->last_light > 480000000) {
 			SV_ERROR(4, "Bad update");
@@ -331,7 +478,8 @@ FLT SurviveSensorActivations_difference(const SurviveSensorActivations *rhs, con
 		for (size_t lh = 0; lh < NUM_GEN1_LIGHTHOUSES; lh++) {
 			for(size_t axis = 0;axis < 2;axis++) {
 				if(rhs->lengths[i][lh][axis] > 0 && lhs->lengths[i][lh][axis] > 0) {
-					FLT diff = rhs->angles[i][lh][axis] - lhs->angles[i][lh][axis];
+					FLT diff = SurviveSensorActivations_angle(rhs, i, lh, axis) -
+							   SurviveSensorActivations_angle(lhs, i, lh, axis);
 					rtn += diff * diff;
 					cnt++;
 				}
@@ -635,4 +635,212 @@ gen_function_def reproject_axis_x_gen2_def = {
 		{.suffix = "obj", .jacobian = general_gen_reproject_x_gen2_jac_obj, .jacobian_length = 7},
 	}};
 
-TEST(Generated, reproject_axis_x) { return test_gen_function_def(&reproject_axis_x_gen2_def); }
\ No newline at end of file
+TEST(Generated, reproject_axis_x) { return test_gen_function_def(&reproject_axis_x_gen2_def); }
+static int check_batch_matches(const char *name, size_t outputs, const FLT *batch, size_t n, size_t i,
+							   const FLT *expected) {
+	for (size_t k = 0; k < outputs; k++) {
+		if (fabs(batch[k * n + i] - expected[k]) > 1e-9) {
+			TEST_PRINTF("%s: point %d output %d is %f, expected %f\n", name, (int)i, (int)k, batch[k * n + i],
+						expected[k]);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static int check_reproject_batch(const survive_reproject_model_t *model) {
+	enum { n = 17 };
+	SurvivePose obj2world = random_pose(), world2lh = random_pose();
+	LinmathAxisAnglePose obj2world_aa = random_pose_axisangle(), world2lh_aa = random_pose_axisangle();
+	BaseStationCal fcal[2];
+	random_fcal(fcal);
+	random_fcal(fcal + 1);
+
+	LinmathPoint3d pts[n];
+	FLT soa[3 * n];
+	for (size_t i = 0; i < n; i++) {
+		random_point(pts[i]);
+		for (int k = 0; k < 3; k++) {
+			soa[k * n + i] = pts[i][k];
+		}
+	}
+
+	FLT xy[2 * n], axis[2][n], jac[14 * n], axis_jac[2][7 * n], jac_aa[12 * n], axis_jac_aa[2][6 * n];
+	model->reprojectFullBatch(xy, n, &obj2world, soa, &world2lh, fcal);
+	model->reprojectFullJacObjPoseBatch(jac, n, &obj2world, soa, &world2lh, fcal);
+	model->reprojectAxisAngleFullJacObjPoseBatch(jac_aa, n, &obj2world_aa, soa, &world2lh_aa, fcal);
+	for (int axis_idx = 0; axis_idx < 2; axis_idx++) {
+		model->reprojectAxisFullBatchFn[axis_idx](axis[axis_idx], n, &obj2world, soa, &world2lh, fcal + axis_idx);
+		model->reprojectAxisJacobBatchFn[axis_idx](axis_jac[axis_idx], n, &obj2world, soa, &world2lh, fcal + axis_idx);
+		model->reprojectAxisAngleAxisJacobBatchFn[axis_idx](axis_jac_aa[axis_idx], n, &obj2world_aa, soa, &world2lh_aa,
+															fcal + axis_idx);
+	}
+
+	for (size_t i = 0; i < n; i++) {
+		FLT expected[14];
+		for (int axis_idx = 0; axis_idx < 2; axis_idx++) {
+			expected[axis_idx] = model->reprojectAxisFullFn[axis_idx](&obj2world, pts[i], &world2lh, fcal + axis_idx);
+		}
+		ASSERT_SUCCESS(check_batch_matches("xy", 2, xy, n, i, expected));
+		ASSERT_SUCCESS(check_batch_matches("x", 1, axis[0], n, i, expected));
+		ASSERT_SUCCESS(check_batch_matches("y", 1, axis[1], n, i, expected + 1));
+
+		model->reprojectFullJacObjPose(expected, &obj2world, pts[i], &world2lh, fcal);
+		ASSERT_SUCCESS(check_batch_matches("jac", 14, jac, n, i, expected));
+		model->reprojectAxisAngleFullJacObjPose(expected, &obj2world_aa, pts[i], &world2lh_aa, fcal);
+		ASSERT_SUCCESS(check_batch_matches("jac_aa", 12, jac_aa, n, i, expected));
+
+		for (int axis_idx = 0; axis_idx < 2; axis_idx++) {
+			model->reprojectAxisJacobFn[axis_idx](expected, &obj2world, pts[i], &world2lh, fcal + axis_idx);
+			ASSERT_SUCCESS(check_batch_matches("axis_jac", 7, axis_jac[axis_idx], n, i, expected));
+			model->reprojectAxisAngleAxisJacobFn[axis_idx](expected, &obj2world_aa, pts[i], &world2lh_aa,
+														   fcal + axis_idx);
+			ASSERT_SUCCESS(check_batch_matches("axis_jac_aa", 6, axis_jac_aa[axis_idx], n, i, expected));
+		}
+	}
+	return 0;
+}
+
+TEST(Generated, reproject_batch) {
+	for (int i = 0; i < 10; i++) {
+		ASSERT_SUCCESS(check_reproject_batch(&survive_reproject_gen2_model));
+#ifdef BUILD_LH1_SUPPORT
+		ASSERT_SUCCESS(check_reproject_batch(&survive_reproject_model));
+#endif
+	}
+	return 0;
+}
+
+
+static SurvivePose axisangle_to_pose(const LinmathAxisAnglePose *p) {
+	SurvivePose rtn;
+	copy3d(rtn.Pos, p->Pos);
+	quatfromaxisanglemag(rtn.Rot, p->AxisAngleRot);
+	return rtn;
+}
+
+// Checks prepared value + jacobian functions for one kind -- an axis, or both for kind 2 -- against the separate
+// value and jacobian functions
+static int check_reproject_prepared(const survive_reproject_model_t *model, int kind, bool with_lh) {
+	const survive_reproject_prepared_fn_t *fn =
+		kind == 2 ? (with_lh ? &model->reprojectAxisAngleFullValJacPoses : &model->reprojectAxisAngleFullValJacObjPose)
+				  : (with_lh ? &model->reprojectAxisAngleAxisValJacPoses[kind]
+							 : &model->reprojectAxisAngleAxisValJacObjPose[kind]);
+	ASSERT_EQ((fn->prepared_size <= SURVIVE_REPROJECT_PREPARED_MAX), true);
+
+	LinmathAxisAnglePose obj2world = random_pose_axisangle(), world2lh = random_pose_axisangle();
+	SurvivePose obj2world_q = axisangle_to_pose(&obj2world), world2lh_q = axisangle_to_pose(&world2lh);
+	BaseStationCal fcal[2];
+	random_fcal(fcal);
+	random_fcal(fcal + 1);
+
+	FLT prepared[SURVIVE_REPROJECT_PREPARED_MAX];
+	fn->prepare(prepared, &obj2world, &world2lh, kind == 2 ? fcal : fcal + kind);
+
+	const size_t values = kind == 2 ? 2 : 1;
+	for (int i = 0; i < 8; i++) {
+		LinmathPoint3d pt;
+		random_point(pt);
+
+		FLT out[2 + 12 * 2], expected[2 + 12 * 2];
+		fn->eval(out, prepared, pt);
+
+		FLT *jac_obj = expected + values, *jac_lh = expected + values * 7;
+		if (kind == 2) {
+			for (int axis = 0; axis < 2; axis++) {
+				expected[axis] = model->reprojectAxisFullFn[axis](&obj2world_q, pt, &world2lh_q, fcal + axis);
+			}
+			model->reprojectAxisAngleFullJacObjPose(jac_obj, &obj2world, pt, &world2lh, fcal);
+			model->reprojectAxisAngleFullJacLhPose(jac_lh, &obj2world, pt, &world2lh, fcal);
+		} else {
+			expected[0] = model->reprojectAxisFullFn[kind](&obj2world_q, pt, &world2lh_q, fcal + kind);
+			model->reprojectAxisAngleAxisJacobFn[kind](jac_obj, &obj2world, pt, &world2lh, fcal + kind);
+			model->reprojectAxisAngleAxisJacobLhPoseFn[kind](jac_lh, &obj2world, pt, &world2lh, fcal + kind);
+		}
+
+		for (size_t k = 0; k < values * (with_lh ? 13 : 7); k++) {
+			if (fabs(out[k] - expected[k]) > 1e-6 * (1 + fabs(expected[k]))) {
+				TEST_PRINTF("Kind %d%s: output %d is %f, expected %f\n", kind, with_lh ? " with lh" : "", (int)k,
+							out[k], expected[k]);
+				return -1;
+			}
+		}
+	}
+	return 0;
+}
+
+TEST(Generated, reproject_prepared) {
+	for (int i = 0; i < 10; i++) {
+		for (int kind = 0; kind < 3; kind++) {
+			for (int with_lh = 0; with_lh < 2; with_lh++) {
+				ASSERT_SUCCESS(check_reproject_prepared(&survive_reproject_gen2_model, kind, with_lh));
+#ifdef BUILD_LH1_SUPPORT
+				ASSERT_SUCCESS(check_reproject_prepared(&survive_reproject_model, kind, with_lh));
+#endif
+			}
+		}
+	}
+	return 0;
+}
+
+// Worst case absolute error of eval_float against fn's double precision eval
+static FLT reproject_float_error(const survive_reproject_prepared_fn_t *fn,
+								 survive_reproject_prepared_eval_fn_t eval_float, int kind) {
+	const size_t values = kind == 2 ? 2 : 1;
+	FLT value_err = 0;
+	for (int i = 0; i < 2000; i++) {
+		LinmathAxisAnglePose obj2world = random_pose_axisangle(), world2lh = random_pose_axisangle();
+		BaseStationCal fcal[2];
+		random_fcal(fcal);
+		random_fcal(fcal + 1);
+
+		FLT prepared[SURVIVE_REPROJECT_PREPARED_MAX];
+		fn->prepare(prepared, &obj2world, &world2lh, kind == 2 ? fcal : fcal + kind);
+
+		for (int j = 0; j < 50; j++) {
+			LinmathPoint3d pt;
+			random_point(pt);
+
+			FLT out[2], expected[2];
+			fn->eval(expected, prepared, pt);
+			eval_float(out, prepared, pt);
+			for (size_t k = 0; k < values; k++) {
+				// Some random setups are degenerate for the double version too
+				if (!isfinite(expected[k])) {
+					continue;
+				}
+
+				value_err = linmath_max(value_err, isfinite(out[k]) ? fabs(out[k] - expected[k]) : INFINITY);
+			}
+		}
+	}
+	return value_err;
+}
+
+static int check_reproject_float(const survive_reproject_model_t *model) {
+	// Measured worst case over a million random setups is about 6e-5 radians, where the sensor ends up much closer to
+	// the lighthouse than the poses are to the origin; typical errors are below 1e-6. Either is well under the light
+	// measurement noise.
+	const FLT max_value_err = 1e-4;
+	for (int kind = 0; kind < 3; kind++) {
+		const survive_reproject_prepared_fn_t *fn =
+			kind == 2 ? &model->reprojectAxisAngleFullPrepared : &model->reprojectAxisAnglePrepared[kind];
+		survive_reproject_prepared_eval_fn_t eval_float =
+			kind == 2 ? model->reprojectAxisAngleFullEvalFloat : model->reprojectAxisAngleAxisEvalFloat[kind];
+
+		FLT value_err = reproject_float_error(fn, eval_float, kind);
+		if (value_err > max_value_err) {
+			TEST_PRINTF("Kind %d: value error %e\n", kind, value_err);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+TEST(Generated, reproject_float) {
+	ASSERT_SUCCESS(check_reproject_float(&survive_reproject_gen2_model));
+#ifdef BUILD_LH1_SUPPORT
+	ASSERT_SUCCESS(check_reproject_float(&survive_reproject_model));
+#endif
+	return 0;
+}
@@ -0,0 +1,84 @@
+#include "os_generic.h"
+#include "test_case.h"
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#define CONFIG_WRITER_TEST_PATH "./config_writer_test.json"
+
+static unsigned config_writer_writes, config_writer_saves;
+static void config_writer_log(SurviveContext *ctx, SurviveLogLevel logLevel, const char *fault) {
+	sscanf(fault, "Config writer wrote %u times for %u saves", &config_writer_writes, &config_writer_saves);
+}
+
+// True if the config file holds a lighthouse 0 pose with an x of exactly x
+static bool config_file_has_x(int x) {
+	char buffer[1 << 16] = {0};
+	FILE *f = fopen(CONFIG_WRITER_TEST_PATH, "r");
+	if (f == 0)
+		return false;
+	fread(buffer, 1, sizeof(buffer) - 1, f);
+	fclose(f);
+
+	char needle[32];
+	snprintf(needle, sizeof(needle), "\"pose\":[\"%d.000", x);
+	return strstr(buffer, needle) != 0;
+}
+
+static bool wait_for_x(int x, double timeout) {
+	double start = OGGetAbsoluteTime();
+	while (!config_file_has_x(x)) {
+		if (OGGetAbsoluteTime() - start > timeout)
+			return false;
+		OGUSleep(10000);
+	}
+	return true;
+}
+
+static void set_lighthouse_x(SurviveContext *ctx, int x) {
+	SurvivePose pose = {.Pos = {x, 0, 0}, .Rot = {1, 0, 0, 0}};
+	survive_default_lighthouse_pose_process(ctx, 0, &pose);
+}
+
+TEST(Config, WriterCoalescesSaves) {
+	remove(CONFIG_WRITER_TEST_PATH);
+	char *args[] = {"test", "--configfile", CONFIG_WRITER_TEST_PATH, "--config-save-interval", "1", "--v", "10"};
+	SurviveContext *ctx = survive_init_with_logger(sizeof(args) / sizeof(args[0]), args, 0, config_writer_log);
+	ctx->bsd[0].OOTXSet = 1;
+
+	// The first save is written right away; the burst after it lands inside the interval and becomes one write
+	set_lighthouse_x(ctx, 100);
+	ASSERT_EQ(wait_for_x(100, 2.), true);
+	for (int x = 101; x <= 150; x++) {
+		set_lighthouse_x(ctx, x);
+	}
+
+	OGUSleep(200000);
+	ASSERT_EQ(config_file_has_x(100), true);
+	ASSERT_EQ(wait_for_x(150, 3.), true);
+
+	// Nothing is left behind from writing through the temp file
+	FILE *tmp = fopen(CONFIG_WRITER_TEST_PATH ".tmp", "r");
+	ASSERT_EQ(tmp == 0, true);
+
+	struct stat before, after;
+	ASSERT_EQ(stat(CONFIG_WRITER_TEST_PATH, &before), 0);
+
+	// survive_close saves synchronously; the file is replaced by a rename rather than rewritten in place
+	set_lighthouse_x(ctx, 151);
+	survive_close(ctx);
+
+	ASSERT_EQ(config_file_has_x(151), true);
+	ASSERT_EQ(stat(CONFIG_WRITER_TEST_PATH, &after), 0);
+#ifndef _WIN32
+	ASSERT_EQ(before.st_ino != after.st_ino, true);
+#endif
+	tmp = fopen(CONFIG_WRITER_TEST_PATH ".tmp", "r");
+	ASSERT_EQ(tmp == 0, true);
+
+	ASSERT_EQ(config_writer_saves, 52);
+	ASSERT_EQ(config_writer_writes, 2);
+
+	remove(CONFIG_WRITER_TEST_PATH);
+	return 0;
+}
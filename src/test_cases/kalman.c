@@ -1,4 +1,5 @@
 #include "../survive_kalman_tracker.h"
+#include "os_generic.h"
 #include "test_case.h"
 #include <math.h>
 #include <stdio.h>
@@ -355,3 +356,210 @@ TEST(Kalman, AngleQuat) {
 
 	return 0;
 }
+
+static void fixed_size_f(FLT t, SvMat *F, const struct SvMat *x) {
+	(void)x;
+	sv_set_zero(F);
+	sv_set_diag_val(F, 1);
+	for (int i = 0; i < 9; i++) {
+		svMatrixSet(F, i, i + 10, t);
+	}
+}
+
+static FLT run_sparse_kalman(survive_kalman_state_t *k, int iterations, int meas_cnt, const FLT *Hs, FLT *R,
+							 bool adaptive, const int *H_cols, size_t H_col_cnt) {
+	SvMat H = svMat_from_row_major(meas_cnt, SURVIVE_KALMAN_FIXED_STATE_CNT, (FLT *)Hs);
+	SV_CREATE_STACK_MAT(Z, meas_cnt, 1);
+
+	double start = OGGetAbsoluteTime();
+	for (int i = 1; i <= iterations; i++) {
+		for (int j = 0; j < meas_cnt; j++) {
+			_Z[j] = sin(i * .01 + j);
+		}
+		survive_kalman_predict_update_state_extended_sparse(i * .001, k, &Z, R, 0, &H, adaptive, H_cols, H_col_cnt);
+	}
+	double elapsed = OGGetAbsoluteTime() - start;
+
+	SV_FREE_STACK_MAT(Z);
+	return iterations / (elapsed > 0 ? elapsed : 1e-9);
+}
+
+static FLT run_fixed_size_kalman(survive_kalman_state_t *k, int iterations, int meas_cnt, const FLT *Hs, FLT *R,
+								 bool adaptive) {
+	return run_sparse_kalman(k, iterations, meas_cnt, Hs, R, adaptive, 0, 0);
+}
+
+#ifdef USE_FLOAT
+#define KALMAN_MATCH_TOLERANCE 1e-2
+#else
+#define KALMAN_MATCH_TOLERANCE 1e-6
+#endif
+
+static FLT kalman_max_difference(const survive_kalman_state_t *a, const survive_kalman_state_t *b) {
+	FLT max_err = 0;
+	for (int i = 0; i < a->state_cnt; i++) {
+		FLT s0 = SV_FLT_PTR(&a->state)[i], s1 = SV_FLT_PTR(&b->state)[i];
+		max_err = linmath_max(max_err, fabs(s0 - s1) / (1 + fabs(s1)));
+		for (int j = 0; j < a->state_cnt; j++) {
+			FLT p0 = svMatrixGet(&a->P, i, j), p1 = svMatrixGet(&b->P, i, j);
+			max_err = linmath_max(max_err, fabs(p0 - p1) / (1 + fabs(p1)));
+		}
+	}
+	return max_err;
+}
+
+static void init_fixed_size_kalman(survive_kalman_state_t *k, SvMat *Q) {
+	FLT P_init[SURVIVE_KALMAN_FIXED_STATE_CNT];
+	for (int i = 0; i < SURVIVE_KALMAN_FIXED_STATE_CNT; i++)
+		P_init[i] = 10 + i;
+
+	survive_kalman_state_init(k, SURVIVE_KALMAN_FIXED_STATE_CNT, fixed_size_f, 0, Q, 0);
+	survive_kalman_set_P(k, P_init);
+}
+
+static void random_sparse_H(FLT *Hs, int meas_cnt) {
+	srand(42);
+	for (int j = 0; j < meas_cnt * SURVIVE_KALMAN_FIXED_STATE_CNT; j++) {
+		Hs[j] = (rand() % 3) ? 0 : generateGaussianNoise(0, 1);
+	}
+}
+
+TEST(Kalman, FixedSizeMatchesGeneric) {
+	const int N = SURVIVE_KALMAN_FIXED_STATE_CNT;
+	FLT _Q[SURVIVE_KALMAN_FIXED_STATE_CNT * SURVIVE_KALMAN_FIXED_STATE_CNT] = {0};
+	for (int i = 0; i < N; i++)
+		_Q[i * N + i] = 1 + i * .1;
+	SvMat Q = svMat(N, N, _Q);
+
+	FLT R[7] = {1e-3, 1e-3, 1e-3, 1e-3, 1e-3, 1e-3, 1e-3};
+	int meas_cnts[] = {1, 7};
+	for (int m = 0; m < sizeof(meas_cnts) / sizeof(meas_cnts[0]); m++) {
+		int meas_cnt = meas_cnts[m];
+		FLT Hs[7 * SURVIVE_KALMAN_FIXED_STATE_CNT];
+		random_sparse_H(Hs, meas_cnt);
+
+		survive_kalman_state_t fixed, generic;
+		init_fixed_size_kalman(&fixed, &Q);
+		init_fixed_size_kalman(&generic, &Q);
+		generic.Force_generic = true;
+
+		int iterations = 5000;
+		FLT fixed_rate = run_fixed_size_kalman(&fixed, iterations, meas_cnt, Hs, R, false);
+		FLT generic_rate = run_fixed_size_kalman(&generic, iterations, meas_cnt, Hs, R, false);
+
+		printf("%d x %d measurement: fixed %10.1f updates/sec, generic %10.1f updates/sec (%5.2fx)\n", meas_cnt, N,
+			   fixed_rate, generic_rate, fixed_rate / generic_rate);
+
+		for (int i = 0; i < N; i++) {
+			for (int j = 0; j < N; j++) {
+				ASSERT_DOUBLE_EQ(svMatrixGet(&fixed.P, i, j), svMatrixGet(&fixed.P, j, i));
+			}
+		}
+		FLT max_err = kalman_max_difference(&fixed, &generic);
+		ASSERT_GT(KALMAN_MATCH_TOLERANCE, max_err);
+
+		survive_kalman_state_free(&fixed);
+		survive_kalman_state_free(&generic);
+	}
+
+	return 0;
+}
+
+TEST(Kalman, UDMatchesGeneric) {
+	const int N = SURVIVE_KALMAN_FIXED_STATE_CNT;
+	FLT _Q[SURVIVE_KALMAN_FIXED_STATE_CNT * SURVIVE_KALMAN_FIXED_STATE_CNT] = {0};
+	for (int i = 0; i < N; i++) {
+		_Q[i * N + i] = 1 + i * .1;
+	}
+	// Correlated process noise between position and velocity, and a state with no process noise at all
+	for (int i = 0; i < 9; i++) {
+		_Q[i * N + i + 10] = _Q[(i + 10) * N + i] = .5;
+	}
+	_Q[9 * N + 9] = 0;
+	SvMat Q = svMat(N, N, _Q);
+
+	int meas_cnts[] = {1, 7};
+	for (int m = 0; m < sizeof(meas_cnts) / sizeof(meas_cnts[0]); m++) {
+		int meas_cnt = meas_cnts[m];
+		FLT Hs[7 * SURVIVE_KALMAN_FIXED_STATE_CNT];
+		random_sparse_H(Hs, meas_cnt);
+
+		for (int adaptive = 0; adaptive < 2; adaptive++) {
+			// Adaptive R is a full matrix that the filters update in place, so each gets its own copy.
+			FLT R_ud[7 * 7] = {0}, R_generic[7 * 7] = {0};
+			for (int j = 0; j < meas_cnt; j++) {
+				R_ud[adaptive ? j * meas_cnt + j : j] = R_generic[adaptive ? j * meas_cnt + j : j] = 1e-3 * (j + 1);
+			}
+
+			survive_kalman_state_t ud, generic;
+			init_fixed_size_kalman(&ud, &Q);
+			init_fixed_size_kalman(&generic, &Q);
+			generic.Force_generic = true;
+			survive_kalman_set_ud(&ud, true);
+
+			int iterations = 1000;
+			FLT ud_rate = run_fixed_size_kalman(&ud, iterations, meas_cnt, Hs, R_ud, adaptive);
+			FLT generic_rate = run_fixed_size_kalman(&generic, iterations, meas_cnt, Hs, R_generic, adaptive);
+
+			FLT max_err = kalman_max_difference(&ud, &generic);
+			printf("%d x %d measurement%s: UD %10.1f updates/sec, generic %10.1f updates/sec, max difference %e\n",
+				   meas_cnt, N, adaptive ? " (adaptive)" : "", ud_rate, generic_rate, max_err);
+			ASSERT_GT(KALMAN_MATCH_TOLERANCE, max_err);
+
+			survive_kalman_state_free(&ud);
+			survive_kalman_state_free(&generic);
+		}
+	}
+
+	return 0;
+}
+
+TEST(Kalman, SparseColumnsMatchDense) {
+	const int N = SURVIVE_KALMAN_FIXED_STATE_CNT;
+	FLT _Q[SURVIVE_KALMAN_FIXED_STATE_CNT * SURVIVE_KALMAN_FIXED_STATE_CNT] = {0};
+	for (int i = 0; i < N; i++) {
+		_Q[i * N + i] = 1 + i * .1;
+	}
+	SvMat Q = svMat(N, N, _Q);
+
+	// Same shape as the light jacobian; only the pose columns are touched
+	const int meas_cnt = 7;
+	const int cols[] = {0, 1, 2, 3, 4, 5, 6};
+	FLT Hs[7 * SURVIVE_KALMAN_FIXED_STATE_CNT];
+	random_sparse_H(Hs, meas_cnt);
+	for (int i = 0; i < meas_cnt; i++) {
+		for (int j = 7; j < N; j++) {
+			Hs[i * N + j] = 0;
+		}
+		Hs[i * N + i] = 1;
+	}
+
+	const char *modes[] = {"fixed", "generic", "UD"};
+	for (int mode = 0; mode < 3; mode++) {
+		FLT R_sparse[7] = {1e-3, 1e-3, 1e-3, 1e-3, 1e-3, 1e-3, 1e-3};
+		FLT R_dense[7] = {1e-3, 1e-3, 1e-3, 1e-3, 1e-3, 1e-3, 1e-3};
+
+		survive_kalman_state_t sparse, dense;
+		init_fixed_size_kalman(&sparse, &Q);
+		init_fixed_size_kalman(&dense, &Q);
+		sparse.Force_generic = dense.Force_generic = mode == 1;
+		survive_kalman_set_ud(&sparse, mode == 2);
+		survive_kalman_set_ud(&dense, mode == 2);
+
+		int iterations = 5000;
+		FLT sparse_rate = run_sparse_kalman(&sparse, iterations, meas_cnt, Hs, R_sparse, false, cols,
+											sizeof(cols) / sizeof(cols[0]));
+		FLT dense_rate = run_sparse_kalman(&dense, iterations, meas_cnt, Hs, R_dense, false, 0, 0);
+
+		FLT max_err = kalman_max_difference(&sparse, &dense);
+		printf("%-8s %d x %d measurement: sparse %10.1f updates/sec, dense %10.1f updates/sec (%5.2fx) max "
+			   "difference %e\n",
+			   modes[mode], meas_cnt, N, sparse_rate, dense_rate, sparse_rate / dense_rate, max_err);
+		ASSERT_GT(KALMAN_MATCH_TOLERANCE, max_err);
+
+		survive_kalman_state_free(&sparse);
+		survive_kalman_state_free(&dense);
+	}
+
+	return 0;
+}
@@ -24,7 +24,7 @@ int main(int argc, char **argv) {
 			fprintf(stderr, "Test %s reports status %d\n", DriverName, r);
 		}
 		str_clear(&logs);
-		failed &= r == 0;
+		failed |= r != 0;
 	}
 
 	str_free(&logs);
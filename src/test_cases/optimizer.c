@@ -0,0 +1,319 @@
+#include "../survive_async_optimizer.h"
+#include "test_case.h"
+
+#include <mpfit/mpfit.h>
+#include <os_generic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <survive_optimizer.h>
+#include <survive_reproject_gen2.h>
+
+#define OPTIMIZER_TEST_LH_CNT 4
+#define OPTIMIZER_TEST_SENSOR_CNT 24
+
+static FLT rand_range(FLT lo, FLT hi) { return lo + (hi - lo) * (rand() / (FLT)RAND_MAX); }
+
+static void random_pose(SurvivePose *pose, FLT pos_range) {
+	for (int i = 0; i < 3; i++) {
+		pose->Pos[i] = rand_range(-pos_range, pos_range);
+	}
+	LinmathAxisAngle aa = {rand_range(-1, 1), rand_range(-1, 1), rand_range(-1, 1)};
+	quatfromaxisanglemag(pose->Rot, aa);
+}
+
+static void perturb_pose(SurvivePose *pose, FLT pos_noise, FLT rot_noise) {
+	for (int i = 0; i < 3; i++) {
+		pose->Pos[i] += rand_range(-pos_noise, pos_noise);
+	}
+	LinmathQuat q;
+	LinmathAxisAngle aa = {rand_range(-rot_noise, rot_noise), rand_range(-rot_noise, rot_noise),
+						   rand_range(-rot_noise, rot_noise)};
+	quatfromaxisanglemag(q, aa);
+	quatrotateabout(pose->Rot, q, pose->Rot);
+}
+
+typedef struct optimizer_test_scene {
+	FLT sensors[OPTIMIZER_TEST_SENSOR_CNT * 3];
+	SurviveObject so;
+	SurvivePose lh2world[OPTIMIZER_TEST_LH_CNT];
+	SurvivePose *obj2world;
+	int scene_cnt;
+} optimizer_test_scene;
+
+static void optimizer_test_scene_init(optimizer_test_scene *scene, int scene_cnt) {
+	*scene = (optimizer_test_scene){.scene_cnt = scene_cnt};
+	for (int i = 0; i < OPTIMIZER_TEST_SENSOR_CNT; i++) {
+		LinmathVec3d dir = {rand_range(-1, 1), rand_range(-1, 1), rand_range(-1, 1)};
+		normalize3d(dir, dir);
+		scale3d(scene->sensors + i * 3, dir, .1);
+	}
+	scene->so.sensor_ct = OPTIMIZER_TEST_SENSOR_CNT;
+	scene->so.sensor_locations = scene->sensors;
+
+	// Lighthouses sit on a ring looking in at the origin
+	for (int lh = 0; lh < OPTIMIZER_TEST_LH_CNT; lh++) {
+		FLT theta = lh * 2. * M_PI / OPTIMIZER_TEST_LH_CNT + .3;
+		SurvivePose *p = &scene->lh2world[lh];
+		p->Pos[0] = 3 * cos(theta);
+		p->Pos[1] = 3 * sin(theta);
+		p->Pos[2] = 1.5 + .2 * lh;
+
+		// The lighthouse looks down its -z axis
+		LinmathVec3d fwd = {-p->Pos[0], -p->Pos[1], -p->Pos[2]}, neg_z = {0, 0, -1};
+		normalize3d(fwd, fwd);
+		quatfrom2vectors(p->Rot, neg_z, fwd);
+	}
+
+	scene->obj2world = SV_CALLOC(sizeof(SurvivePose) * scene_cnt);
+	for (int i = 0; i < scene_cnt; i++) {
+		random_pose(&scene->obj2world[i], .75);
+	}
+}
+
+static void optimizer_test_scene_setup(const optimizer_test_scene *scene, survive_optimizer *opt, bool solve_lhs) {
+	BaseStationCal cal[2] = {0};
+
+	survive_optimizer_measurement *meas = opt->measurements;
+	for (int i = 0; i < scene->scene_cnt; i++) {
+		opt->sos[i] = (SurviveObject *)&scene->so;
+
+		SurvivePose obj = scene->obj2world[i];
+		if (solve_lhs) {
+			perturb_pose(&obj, .05, .05);
+		} else {
+			perturb_pose(&obj, .1, .2);
+		}
+		survive_optimizer_setup_pose_n(opt, &obj, i, false, 1);
+
+		for (int lh = 0; lh < OPTIMIZER_TEST_LH_CNT; lh++) {
+			SurvivePose world2lh = InvertPoseRtn(&scene->lh2world[lh]);
+			for (int sensor = 0; sensor < OPTIMIZER_TEST_SENSOR_CNT; sensor++) {
+				SurviveAngleReading ang;
+				survive_reproject_full_gen2(cal, &world2lh, &scene->obj2world[i], scene->sensors + sensor * 3, ang);
+				for (int axis = 0; axis < 2; axis++) {
+					*meas++ = (survive_optimizer_measurement){
+						.value = ang[axis], .variance = 1, .lh = lh, .sensor_idx = sensor, .axis = axis, .object = i};
+				}
+			}
+		}
+	}
+	opt->measurementsCnt = meas - opt->measurements;
+
+	for (int lh = 0; lh < OPTIMIZER_TEST_LH_CNT; lh++) {
+		SurvivePose lh2world = scene->lh2world[lh];
+		if (solve_lhs && lh > 0) {
+			perturb_pose(&lh2world, .05, .02);
+		}
+		// The first lighthouse anchors the solution
+		survive_optimizer_setup_camera(opt, lh, &lh2world, !solve_lhs || lh == 0, 1);
+	}
+	size_t start = survive_optimizer_get_calibration_index(opt);
+	for (int i = start; i < survive_optimizer_get_sensors_index(opt); i++) {
+		opt->parameters[i] = 0;
+		opt->parameters_info[i].fixed = true;
+	}
+}
+
+static FLT pose_distance(const SurvivePose *a, const SurvivePose *b) { return dist3d(a->Pos, b->Pos); }
+
+static int run_backend(const optimizer_test_scene *scene, survive_optimizer_backend backend, bool solve_lhs,
+					   FLT *max_err, double *elapsed, mp_result *result) {
+	survive_optimizer opt = {
+		.reprojectModel = &survive_reproject_gen2_model,
+		.poseLength = scene->scene_cnt,
+		.cameraLength = OPTIMIZER_TEST_LH_CNT,
+		.nofilter = true,
+		.backend = backend,
+	};
+	SURVIVE_OPTIMIZER_SETUP_HEAP_BUFFERS(opt, 0);
+
+	// Seed identically for both backends
+	srand(42);
+	optimizer_test_scene_setup(scene, &opt, solve_lhs);
+
+	mp_config cfg = {.ftol = 1e-12, .xtol = 1e-12, .gtol = 1e-12, .maxiter = 100};
+	opt.cfg = &cfg;
+
+	if (backend == SURVIVE_OPTIMIZER_BACKEND_SPARSE_LM && !survive_optimizer_sparse_supported(&opt)) {
+		fprintf(stderr, "Sparse backend unexpectedly unsupported\n");
+		return -1;
+	}
+
+	double start = OGGetAbsoluteTime();
+	*result = (mp_result){0};
+	int status = survive_optimizer_run(&opt, result);
+	*elapsed = OGGetAbsoluteTime() - start;
+
+	*max_err = 0;
+	for (int i = 0; i < scene->scene_cnt; i++) {
+		*max_err = linmath_max(*max_err, pose_distance(&survive_optimizer_get_pose(&opt)[i], &scene->obj2world[i]));
+	}
+	for (int lh = 0; lh < OPTIMIZER_TEST_LH_CNT; lh++) {
+		SurvivePose lh2world = InvertPoseRtn(&survive_optimizer_get_camera(&opt)[lh]);
+		*max_err = linmath_max(*max_err, pose_distance(&lh2world, &scene->lh2world[lh]));
+	}
+
+	SURVIVE_OPTIMIZER_CLEANUP_HEAP_BUFFERS(opt);
+	free(opt.sos);
+	return status;
+}
+
+// mpfit keeps its dense jacobian on the stack, so large problems are only run through the sparse backend
+static int compare_backends(int scene_cnt, bool solve_lhs, bool run_mpfit) {
+	optimizer_test_scene scene;
+	srand(5);
+	optimizer_test_scene_init(&scene, scene_cnt);
+
+	FLT err[2] = {0};
+	double elapsed[2] = {0};
+	mp_result result[2] = {0};
+	survive_optimizer_backend backends[2] = {SURVIVE_OPTIMIZER_BACKEND_MPFIT, SURVIVE_OPTIMIZER_BACKEND_SPARSE_LM};
+	for (int i = run_mpfit ? 0 : 1; i < 2; i++) {
+		int status = run_backend(&scene, backends[i], solve_lhs, &err[i], &elapsed[i], &result[i]);
+		ASSERT_GT((FLT)status, 0.);
+	}
+	free(scene.obj2world);
+
+	printf("%3d scenes (%s): sparse %8.3fms %3d iters %.3e", scene_cnt, solve_lhs ? "lhs free" : "lhs fixed",
+		   elapsed[1] * 1000., result[1].niter, result[1].bestnorm);
+	if (run_mpfit) {
+		printf(" | mpfit %8.3fms %3d iters %.3e", elapsed[0] * 1000., result[0].niter, result[0].bestnorm);
+	}
+	printf("\n");
+
+	ASSERT_GT(1e-8, result[1].bestnorm);
+	ASSERT_GT(1e-4, err[1]);
+	if (run_mpfit) {
+		ASSERT_GT(1e-4, err[0]);
+	}
+	return 0;
+}
+
+TEST(Optimizer, SparseMatchesMpfitPose) { return compare_backends(1, false, true); }
+
+TEST(Optimizer, SparseMatchesMpfitGlobalScene) {
+	int scene_cnts[] = {4, 16};
+	for (int i = 0; i < sizeof(scene_cnts) / sizeof(scene_cnts[0]); i++) {
+		int rtn = compare_backends(scene_cnts[i], true, true);
+		if (rtn < 0)
+			return rtn;
+	}
+	return 0;
+}
+
+TEST(Optimizer, SparseLargeGlobalScene) { return compare_backends(256, true, false); }
+
+static void cancel_after_three(struct survive_optimizer *opt_ctx, int m, int n, FLT *p, FLT *deviates, FLT **derivs) {
+	int *calls = opt_ctx->user;
+	if (++*calls >= 3) {
+		opt_ctx->cancelled = true;
+	}
+}
+
+TEST(Optimizer, CancelFromIterationCallback) {
+	optimizer_test_scene scene;
+	srand(5);
+	optimizer_test_scene_init(&scene, 4);
+
+	survive_optimizer_backend backends[2] = {SURVIVE_OPTIMIZER_BACKEND_MPFIT, SURVIVE_OPTIMIZER_BACKEND_SPARSE_LM};
+	for (int i = 0; i < 2; i++) {
+		int calls = 0;
+		survive_optimizer opt = {
+			.reprojectModel = &survive_reproject_gen2_model,
+			.poseLength = scene.scene_cnt,
+			.cameraLength = OPTIMIZER_TEST_LH_CNT,
+			.nofilter = true,
+			.backend = backends[i],
+			.user = &calls,
+			.iteration_cb = cancel_after_three,
+		};
+		SURVIVE_OPTIMIZER_SETUP_HEAP_BUFFERS(opt, 0);
+		optimizer_test_scene_setup(&scene, &opt, true);
+
+		mp_config cfg = {.ftol = 1e-12, .xtol = 1e-12, .gtol = 1e-12, .maxiter = 100};
+		opt.cfg = &cfg;
+
+		mp_result result = {0};
+		int status = survive_optimizer_run(&opt, &result);
+		SURVIVE_OPTIMIZER_CLEANUP_HEAP_BUFFERS(opt);
+		free(opt.sos);
+
+		ASSERT_EQ(status, SURVIVE_OPTIMIZER_CANCELLED);
+		ASSERT_EQ(calls, 3);
+	}
+
+	free(scene.obj2world);
+	return 0;
+}
+
+struct async_test_state {
+	uint64_t last_sequence;
+	bool out_of_order;
+	int failures;
+};
+
+static void async_test_cb(struct survive_async_optimizer_buffer *buffer, int return_code,
+						  struct mp_result_struct *result) {
+	struct async_test_state *state = buffer->user;
+	if (buffer->sequence <= state->last_sequence) {
+		state->out_of_order = true;
+	}
+	state->last_sequence = buffer->sequence;
+	if (return_code <= 0) {
+		state->failures++;
+	}
+}
+
+TEST(Optimizer, AsyncKeepsNewestJobs) {
+	const int job_cnt = 32;
+	optimizer_test_scene scene;
+	srand(5);
+	optimizer_test_scene_init(&scene, 4);
+
+	struct async_test_state state = {0};
+	mp_config cfg = {.ftol = 1e-12, .xtol = 1e-12, .gtol = 1e-12, .maxiter = 100};
+	survive_async_optimizer *async = SV_NEW(survive_async_optimizer, async_test_cb, 4, 2);
+
+	for (int i = 0; i < job_cnt; i++) {
+		survive_async_optimizer_buffer *buffer = survive_async_optimizer_alloc_optimizer(async);
+		buffer->optimizer.reprojectModel = &survive_reproject_gen2_model;
+		buffer->optimizer.poseLength = scene.scene_cnt;
+		buffer->optimizer.cameraLength = OPTIMIZER_TEST_LH_CNT;
+		buffer->optimizer.nofilter = true;
+		buffer->optimizer.backend = SURVIVE_OPTIMIZER_BACKEND_SPARSE_LM;
+		buffer->optimizer.cfg = &cfg;
+		SURVIVE_OPTIMIZER_SETUP_HEAP_BUFFERS(buffer->optimizer, 0);
+		optimizer_test_scene_setup(&scene, &buffer->optimizer, true);
+		buffer->user = &state;
+		survive_async_optimizer_run(async, buffer);
+	}
+
+	bool idle = false;
+	while (!idle) {
+		OGUSleep(1000);
+		OGLockMutex(async->lock);
+		idle = async->completed + async->dropped + async->cancelled == async->submitted;
+		OGUnlockMutex(async->lock);
+	}
+
+	printf("%d jobs: %d completed, %d dropped, %d cancelled\n", job_cnt, (int)async->completed, (int)async->dropped,
+		   (int)async->cancelled);
+	size_t latency_cnt = 0;
+	for (int i = 0; i < SURVIVE_ASYNC_OPTIMIZER_LATENCY_BUCKETS; i++) {
+		latency_cnt += async->latency_histogram[i];
+	}
+
+	ASSERT_EQ(async->submitted, job_cnt);
+	ASSERT_EQ(latency_cnt, async->completed);
+	ASSERT_EQ(state.last_sequence, job_cnt);
+	ASSERT_EQ(state.out_of_order, false);
+	ASSERT_EQ(state.failures, 0);
+
+	for (size_t i = 0; i < async->buffer_cnt; i++) {
+		free(async->buffers[i].optimizer.sos);
+		async->buffers[i].user = 0;
+	}
+	survive_async_free(async);
+	free(scene.obj2world);
+	return 0;
+}
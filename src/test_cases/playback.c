@@ -0,0 +1,85 @@
+#include "test_case.h"
+#include <stdio.h>
+#include <string.h>
+
+#define PLAYBACK_TEST_MAX_POSES 20000
+
+typedef struct playback_test_pose {
+	survive_long_timecode timecode;
+	SurvivePose pose;
+} playback_test_pose;
+
+typedef struct playback_test_run {
+	playback_test_pose poses[PLAYBACK_TEST_MAX_POSES];
+	size_t cnt;
+} playback_test_run;
+
+static void test_pose(SurviveObject *so, survive_long_timecode timecode, const SurvivePose *pose) {
+	playback_test_run *run = so->ctx->user_ptr;
+	if (run && run->cnt < PLAYBACK_TEST_MAX_POSES)
+		run->poses[run->cnt++] = (playback_test_pose){.timecode = timecode, .pose = *pose};
+	survive_default_pose_process(so, timecode, pose);
+}
+static void test_log(SurviveContext *ctx, SurviveLogLevel logLevel, const char *fault) {}
+
+static int run_to_completion(int argc, char **args, playback_test_run *run) {
+	SurviveContext *ctx = survive_init_with_logger(argc, args, run, test_log);
+	ASSERT_EQ(ctx == 0, false);
+	survive_install_pose_fn(ctx, test_pose);
+	while (survive_poll(ctx) == 0)
+		;
+	survive_close(ctx);
+	return 0;
+}
+
+static const char *recording = "./playback_test.rec.bin";
+static const char *recorded_config = "./playback_test_sim.json";
+static const char *playback_config = "./playback_test.json";
+
+static int replay(playback_test_run *run) {
+	remove(playback_config);
+	char *args[] = {"test",
+					"--configfile",
+					(char *)playback_config,
+					"--init-configfile",
+					(char *)recorded_config,
+					"--playback",
+					(char *)recording,
+					"--playback-deterministic",
+					"1"};
+	ASSERT_EQ(run_to_completion(sizeof(args) / sizeof(args[0]), args, run), 0);
+	remove(playback_config);
+	return 0;
+}
+
+// Deterministic playback has to produce the very same poses every time
+TEST(Playback, Deterministic) {
+	remove(recorded_config);
+	remove(recording);
+	// The recorded config carries the simulated lighthouses; the simulator doesn't send OOTX data to decode
+	char *args[] = {"test",
+					"--configfile",
+					(char *)recorded_config,
+					"--simulator",
+					"--simulator-time",
+					"2",
+					"--simulator-realtime",
+					"0",
+					"--record",
+					(char *)recording};
+	ASSERT_EQ(run_to_completion(sizeof(args) / sizeof(args[0]), args, 0), 0);
+
+	static playback_test_run runs[2];
+	memset(runs, 0, sizeof(runs));
+	for (int i = 0; i < 2; i++)
+		ASSERT_EQ(replay(&runs[i]), 0);
+
+	remove(recorded_config);
+	remove(recording);
+
+	ASSERT_GT((double)runs[0].cnt, 100.);
+	ASSERT_GT((double)PLAYBACK_TEST_MAX_POSES, (double)runs[0].cnt);
+	ASSERT_EQ(runs[1].cnt, runs[0].cnt);
+	ASSERT_EQ(memcmp(runs[1].poses, runs[0].poses, runs[0].cnt * sizeof(playback_test_pose)), 0);
+	return 0;
+}
@@ -0,0 +1,362 @@
+#include <string.h>
+
+#include "../survive_recording_binary.h"
+#include "../survive_recording_index.h"
+#include "test_case.h"
+
+#include "../survive_default_devices.h"
+#include "../survive_recording.h"
+
+static const char *recording_lines[] = {
+	"0.001000 INFO LOG Recording to 'test.rec' Compression: 1\r\n",
+	"0.001096 OPTION center-on-lh0 i 0\n",
+	"0.001200 SM0 CONFIG {\"lighthouse_config\": {}}\r\n",
+	"0.010000 0 LH_POSE -3.000000 0.000000 1.000000 -0.707107 0.000000 0.707107 0.000000 \r\n",
+	"0.020000 SM0 Y 3 100 1 0\n",
+	"0.020001 SM0 W 3 1 22002859 0\n",
+	"0.020002 SM0 B 3 1 22002859 0 +2.263406e-01\n",
+	"0.020003 SM0 W 3 0 21999000 1\n",
+	"0.020004 SM0 i 3 22003080 1.000000 0.000000 0.000000 0.000000 0.000000 0.000000  0.000000 0.000000 0.000000 "
+	"0\r\n",
+	"0.030000 Sim_GT EXTERNAL_POSE 0.083005 -0.054118 -0.036821 0.681391 0.704673 0.196859 -0.019733 \n",
+	"5000.000000 SM0 Y 3 4294967000 0 1\n",
+	"5000.000001 SPHERE attractor_0 0.050000 65280 +1.000000e+00   +1.000000e+00   +1.000000e+00\n",
+};
+
+static const size_t recording_line_cnt = sizeof(recording_lines) / sizeof(recording_lines[0]);
+
+static int write_binary_recording(const char *fn) {
+	gzFile f = gzopen(fn, "wT");
+	survive_binary_writer writer;
+	ASSERT_EQ(survive_binary_writer_init(&writer, f), 0);
+	for (size_t i = 0; i < recording_line_cnt; i++) {
+		char line[512];
+		strcpy(line, recording_lines[i]);
+
+		survive_binary_record record = {0};
+		ASSERT_EQ(survive_binary_record_parse_text(&record, line), true);
+		ASSERT_GT((FLT)survive_binary_writer_write(&writer, &record), 0.);
+	}
+	survive_binary_writer_free(&writer);
+	gzclose(f);
+	return 0;
+}
+
+static int check_binary_recording(survive_binary_reader *reader) {
+	cstring text = {0};
+	survive_binary_record record;
+	for (size_t i = 0; i < recording_line_cnt; i++) {
+		ASSERT_EQ(survive_binary_reader_next(reader, &record), 1);
+
+		str_clear(&text);
+		survive_binary_record_append_text(&text, &record);
+		if (strcmp(text.d, recording_lines[i]) != 0) {
+			fprintf(stderr, "Expected '%s', got '%s'\n", recording_lines[i], text.d);
+		}
+		ASSERT_EQ(strcmp(text.d, recording_lines[i]), 0);
+	}
+	ASSERT_EQ(survive_binary_reader_next(reader, &record), 0);
+
+	str_free(&text);
+	return 0;
+}
+
+TEST(Recording, BinaryRoundTrip) {
+	const char *fn = "test_recording.bin";
+	ASSERT_EQ(write_binary_recording(fn), 0);
+
+	gzFile f = gzopen(fn, "r");
+	survive_binary_reader reader;
+	ASSERT_EQ(survive_binary_reader_init(&reader, f), 0);
+	ASSERT_EQ(check_binary_recording(&reader), 0);
+
+	survive_binary_reader_free(&reader);
+	gzclose(f);
+	remove(fn);
+	return 0;
+}
+
+TEST(Recording, BinaryBufferRoundTrip) {
+	const char *fn = "test_recording_buffer.bin";
+	ASSERT_EQ(write_binary_recording(fn), 0);
+
+	FILE *f = fopen(fn, "rb");
+	char buffer[4096];
+	size_t size = fread(buffer, 1, sizeof(buffer), f);
+	fclose(f);
+	remove(fn);
+
+	survive_binary_reader reader;
+	ASSERT_EQ(survive_binary_reader_init_buffer(&reader, buffer, size), 0);
+	ASSERT_EQ(check_binary_recording(&reader), 0);
+	survive_binary_reader_free(&reader);
+
+	// A truncated record is an error rather than the end of the recording
+	ASSERT_EQ(survive_binary_reader_init_buffer(&reader, buffer, size - 1), 0);
+	survive_binary_record record;
+	int r;
+	while ((r = survive_binary_reader_next(&reader, &record)) > 0)
+		;
+	ASSERT_EQ(r, -1);
+	survive_binary_reader_free(&reader);
+	return 0;
+}
+
+TEST(Recording, BinaryWriterBuffer) {
+	cstring buffer = {0};
+	survive_binary_writer writer;
+	ASSERT_EQ(survive_binary_writer_init_buffer(&writer, &buffer), 0);
+	for (size_t i = 0; i < recording_line_cnt; i++) {
+		char line[512];
+		strcpy(line, recording_lines[i]);
+
+		survive_binary_record record = {0};
+		ASSERT_EQ(survive_binary_record_parse_text(&record, line), true);
+		ASSERT_GT((FLT)survive_binary_writer_write(&writer, &record), 0.);
+	}
+	survive_binary_writer_free(&writer);
+
+	survive_binary_reader reader;
+	ASSERT_EQ(survive_binary_reader_init_buffer(&reader, buffer.d, buffer.length), 0);
+	ASSERT_EQ(check_binary_recording(&reader), 0);
+	survive_binary_reader_free(&reader);
+	str_free(&buffer);
+	return 0;
+}
+
+TEST(Recording, ParseEvent) {
+	// Values have to come out as strtod would read them
+	const char *values[] = {"0.083005", "-0.054118", "+2.263406e-01", "1e-30", "0x1.8p+1", "12345678901234567890.5",
+							"-0.000000"};
+	for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+		char line[256];
+		snprintf(line, sizeof(line), "SM0 B 3 1 22002859 0 %s", values[i]);
+
+		survive_binary_record record;
+		ASSERT_EQ(survive_binary_record_parse_event(&record, line), true);
+		ASSERT_EQ(record.type, SURVIVE_BINARY_RECORD_SWEEP_ANGLE);
+		ASSERT_EQ(strcmp(record.name, "SM0"), 0);
+		ASSERT_EQ(record.sweep_angle.timecode, 22002859);
+		ASSERT_DOUBLE_EQ(record.sweep_angle.angle, (FLT)strtod(values[i], 0));
+	}
+
+	char imu[] = "SM0 i 3 22003080 1.0 2.0 3.0 4.0 5.0 6.0 7";
+	survive_binary_record record;
+	ASSERT_EQ(survive_binary_record_parse_event(&record, imu), true);
+	ASSERT_EQ(record.type, SURVIVE_BINARY_RECORD_RAW_IMU);
+	ASSERT_EQ(record.imu.id, 7);
+	ASSERT_EQ(record.imu.accelgyro[6], 0);
+
+	char short_line[] = "SM0 W 3 1";
+	ASSERT_EQ(survive_binary_record_parse_event(&record, short_line), false);
+	return 0;
+}
+
+TEST(Recording, BinaryRejectsText) {
+	const char *fn = "test_recording.rec";
+	gzFile f = gzopen(fn, "wT");
+	gzprintf(f, "%s", recording_lines[0]);
+	gzclose(f);
+
+	f = gzopen(fn, "r");
+	survive_binary_reader reader;
+	ASSERT_EQ(survive_binary_reader_init(&reader, f), -1);
+	survive_binary_reader_free(&reader);
+	gzclose(f);
+	remove(fn);
+
+	ASSERT_EQ(survive_recording_is_binary_filename("a.rec.bin.gz"), true);
+	ASSERT_EQ(survive_recording_is_binary_filename("a.bin"), true);
+	ASSERT_EQ(survive_recording_is_binary_filename("a.rec.gz"), false);
+	return 0;
+}
+
+TEST(Recording, BinaryRestart) {
+	const char *fn = "test_recording_restart.bin";
+	gzFile f = gzopen(fn, "wT");
+	survive_binary_writer writer;
+	ASSERT_EQ(survive_binary_writer_init(&writer, f), 0);
+
+	size_t restart_line = recording_line_cnt / 2;
+	z_off_t restart_offset = 0;
+	for (size_t i = 0; i < recording_line_cnt; i++) {
+		if (i == restart_line) {
+			restart_offset = gztell(f);
+			ASSERT_EQ(survive_binary_writer_restart(&writer, f), 0);
+		}
+
+		char line[512];
+		strcpy(line, recording_lines[i]);
+		survive_binary_record record = {0};
+		ASSERT_EQ(survive_binary_record_parse_text(&record, line), true);
+		ASSERT_GT((FLT)survive_binary_writer_write(&writer, &record), 0.);
+	}
+	survive_binary_writer_free(&writer);
+	gzclose(f);
+
+	FILE *rf = fopen(fn, "rb");
+	char buffer[4096];
+	size_t size = fread(buffer, 1, sizeof(buffer), rf);
+	fclose(rf);
+	remove(fn);
+
+	// Reading from the start goes straight through the restart
+	survive_binary_reader reader;
+	ASSERT_EQ(survive_binary_reader_init_buffer(&reader, buffer, size), 0);
+	ASSERT_EQ(check_binary_recording(&reader), 0);
+
+	// A reader that has seen nothing before the restart point still gets names, times and timecodes right
+	survive_binary_reader_free(&reader);
+	survive_binary_reader_restart(&reader, 0, restart_offset);
+	cstring text = {0};
+	survive_binary_record record;
+	for (size_t i = restart_line; i < recording_line_cnt; i++) {
+		ASSERT_EQ(survive_binary_reader_next(&reader, &record), 1);
+		str_clear(&text);
+		survive_binary_record_append_text(&text, &record);
+		ASSERT_EQ(strcmp(text.d, recording_lines[i]), 0);
+	}
+	ASSERT_EQ(survive_binary_reader_next(&reader, &record), 0);
+	str_free(&text);
+	survive_binary_reader_free(&reader);
+	return 0;
+}
+
+TEST(Recording, BinaryManyNames) {
+	cstring buffer = {0};
+	survive_binary_writer writer;
+	ASSERT_EQ(survive_binary_writer_init_buffer(&writer, &buffer), 0);
+
+	// More names than the string table holds, then the first one again after it has been dropped; a record without a
+	// name goes in the middle
+	size_t name_cnt = 300;
+	char name[32];
+	for (size_t i = 0; i <= name_cnt; i++) {
+		snprintf(name, sizeof(name), "obj%d", (int)(i % name_cnt));
+		survive_binary_record record = {
+			.type = SURVIVE_BINARY_RECORD_EXTERNAL_POSE, .time = i * .001, .name = name, .pose = {.Pos = {i}}};
+		ASSERT_GT((FLT)survive_binary_writer_write(&writer, &record), 0.);
+		if (i == 10) {
+			record.name = 0;
+			ASSERT_GT((FLT)survive_binary_writer_write(&writer, &record), 0.);
+		}
+	}
+	survive_binary_writer_free(&writer);
+
+	survive_binary_reader reader;
+	ASSERT_EQ(survive_binary_reader_init_buffer(&reader, buffer.d, buffer.length), 0);
+	survive_binary_record record;
+	for (size_t i = 0; i <= name_cnt; i++) {
+		ASSERT_EQ(survive_binary_reader_next(&reader, &record), 1);
+		snprintf(name, sizeof(name), "obj%d", (int)(i % name_cnt));
+		ASSERT_EQ(record.name == 0, false);
+		ASSERT_EQ(strcmp(record.name, name), 0);
+		ASSERT_EQ(record.pose.Pos[0], i);
+		ASSERT_DOUBLE_EQ(record.time, i * .001);
+	}
+	ASSERT_EQ(survive_binary_reader_next(&reader, &record), 0);
+	survive_binary_reader_free(&reader);
+	str_free(&buffer);
+	return 0;
+}
+
+static int entry_index(const survive_recording_index *index, const survive_recording_index_entry *entry) {
+	return entry ? entry - index->entries : -1;
+}
+
+TEST(Recording, Index) {
+	const char *fn = "test_recording_index.rec";
+	FILE *f = survive_recording_index_create(fn);
+	ASSERT_EQ(f == 0, false);
+
+	survive_recording_index_entry entries[] = {
+		{.type = SURVIVE_RECORDING_INDEX_CONFIG, .time = .001, .offset = 100},
+		{.type = SURVIVE_RECORDING_INDEX_LH_POSE, .time = .002, .offset = 200, .lh = 1},
+		{.type = SURVIVE_RECORDING_INDEX_CHECKPOINT, .time = 10, .offset = 1000, .compressed_offset = 300},
+		{.type = SURVIVE_RECORDING_INDEX_LH_POSE, .time = 15, .offset = 1500, .lh = 0},
+		{.type = SURVIVE_RECORDING_INDEX_CHECKPOINT, .time = 20, .offset = 2000, .compressed_offset = -1},
+	};
+	for (size_t i = 0; i < sizeof(entries) / sizeof(entries[0]); i++) {
+		ASSERT_EQ(survive_recording_index_write_entry(f, &entries[i]), 0);
+	}
+	// Half written line from a recorder that didn't shut down cleanly
+	fprintf(f, "K 30.0");
+	fclose(f);
+
+	survive_recording_index index;
+	ASSERT_EQ(survive_recording_index_load(&index, fn), 0);
+	char *index_fn = survive_recording_index_filename(fn);
+	remove(index_fn);
+	free(index_fn);
+
+	ASSERT_EQ(index.entry_cnt, 5);
+	ASSERT_EQ(index.entries[1].lh, 1);
+	ASSERT_EQ(index.entries[2].compressed_offset, 300);
+	ASSERT_EQ(index.entries[3].offset, 1500);
+
+	ASSERT_EQ(entry_index(&index, survive_recording_index_checkpoint_before(&index, 5)), -1);
+	ASSERT_EQ(entry_index(&index, survive_recording_index_checkpoint_before(&index, 19.5)), 2);
+	ASSERT_EQ(entry_index(&index, survive_recording_index_checkpoint_before(&index, 100)), 4);
+
+	ASSERT_EQ(entry_index(&index, survive_recording_index_checkpoint_of(&index, &index.entries[1])), -1);
+	ASSERT_EQ(entry_index(&index, survive_recording_index_checkpoint_of(&index, &index.entries[3])), 2);
+
+	survive_recording_index_free(&index);
+	ASSERT_EQ(survive_recording_index_load(&index, fn), -1);
+	return 0;
+}
+
+// A CONFIG too big for the writer queue is written synchronously rather than dropped, and stays in order
+TEST(Recording, OversizedConfig) {
+	const char *fn = "test_recording_oversized.rec";
+	char *args[] = {"test", "--record", (char *)fn, "--record-queue-size", "1", "--configfile",
+					"./test_recording_oversized.json"};
+	SurviveContext *ctx = survive_init(sizeof(args) / sizeof(args[0]), args);
+	survive_install_recording(ctx);
+	SurviveObject *so = survive_create_device(ctx, "TST", 0, "TS0", 0);
+
+	// The queue is rounded up to 64KB
+	size_t big_len = 256 * 1024;
+	char *big = SV_MALLOC(big_len);
+	memset(big, 'x', big_len);
+	memcpy(big, "{\"big\": \"", 9);
+	memcpy(big + big_len - 2, "\"}", 2);
+	char small[] = "{\"small\": 1}";
+
+	survive_recording_config_process(so, small, strlen(small));
+	survive_recording_config_process(so, big, big_len);
+	survive_recording_config_process(so, small, strlen(small));
+	ASSERT_EQ(survive_recording_dropped_records(ctx), 0);
+
+	survive_destroy_device(so);
+	survive_close(ctx);
+	remove("./test_recording_oversized.json");
+
+	FILE *f = fopen(fn, "r");
+	ASSERT_EQ(f == 0, false);
+	size_t line_size = big_len + 256;
+	char *line = SV_MALLOC(line_size);
+	int configs = 0, big_at = -1;
+	while (fgets(line, line_size, f)) {
+		if (strstr(line, " TS0 CONFIG ") == 0)
+			continue;
+		if (strstr(line, "\"big\"")) {
+			// All of it, on one line
+			ASSERT_GT((double)strlen(line), (double)big_len);
+			ASSERT_EQ(strstr(line, "\"}") != 0, true);
+			big_at = configs;
+		}
+		configs++;
+	}
+	free(line);
+	fclose(f);
+	free(big);
+	remove(fn);
+	char *index_fn = survive_recording_index_filename(fn);
+	remove(index_fn);
+	free(index_fn);
+
+	ASSERT_EQ(configs, 3);
+	ASSERT_EQ(big_at, 1);
+	return 0;
+}
@@ -0,0 +1,152 @@
+#include "../survive_default_devices.h"
+#include "os_generic.h"
+#include "test_case.h"
+
+#define SENSOR_ACTIVATIONS_TEST_LH_CNT 4
+#define SENSOR_ACTIVATIONS_TEST_SENSOR_CNT 24
+#define SENSOR_ACTIVATIONS_TEST_OBJECT_CNT 8
+
+static SurviveObject *create_test_device() {
+	SurviveContext *ctx = SV_CALLOC(sizeof(SurviveContext));
+#define SURVIVE_HOOK_PROCESS_DEF(hook) survive_install_##hook##_fn(ctx, 0);
+#define SURVIVE_HOOK_FEEDBACK_DEF(hook) survive_install_##hook##_fn(ctx, 0);
+#include "survive_hooks.h"
+
+	ctx->log_target = stderr;
+	ctx->activeLighthouses = SENSOR_ACTIVATIONS_TEST_LH_CNT;
+
+	SurviveObject *so = survive_create_device(ctx, "TST", 0, "TS0", 0);
+	so->sensor_ct = SENSOR_ACTIVATIONS_TEST_SENSOR_CNT;
+	return so;
+}
+
+static void destroy_test_device(SurviveObject *so) {
+	SurviveContext *ctx = so->ctx;
+	survive_destroy_device(so);
+	free(ctx);
+}
+
+static bool add_reading(SurviveSensorActivations *activations, int sensor, int lh, int axis,
+						survive_long_timecode timecode, FLT angle) {
+	PoserDataLightGen2 l = {.common = {.hdr = {.pt = POSERDATA_LIGHT_GEN2, .timecode = timecode},
+									   .sensor_id = sensor,
+									   .lh = lh,
+									   .angle = angle},
+							.plane = axis};
+	return SurviveSensorActivations_add_gen2(activations, &l);
+}
+
+// Readings trickle in for every lighthouse but the last, which only ever sees a few sensors early on
+static void fill_activations(SurviveSensorActivations *activations, survive_long_timecode start) {
+	for (int i = 0; i < 2000; i++) {
+		int lh = i % (SENSOR_ACTIVATIONS_TEST_LH_CNT - 1);
+		int sensor = (i * 7) % SENSOR_ACTIVATIONS_TEST_SENSOR_CNT;
+		add_reading(activations, sensor, lh, (i / 3) & 1, start + i * 20000, .1 + sensor * .01);
+		if (i < 10) {
+			add_reading(activations, sensor, SENSOR_ACTIVATIONS_TEST_LH_CNT - 1, 0, start + i * 20000, .2);
+		}
+	}
+}
+
+TEST(SensorActivations, ValidSensors) {
+	SurviveObject *so = create_test_device();
+	SurviveSensorActivations *activations = &so->activations;
+	fill_activations(activations, 48000000);
+
+	survive_long_timecode tolerances[] = {0, 20000, 500000, 4800000, 480000000};
+	for (size_t t = 0; t < sizeof(tolerances) / sizeof(tolerances[0]); t++) {
+		for (int lh = 0; lh < NUM_GEN2_LIGHTHOUSES; lh++) {
+			for (int axis = 0; axis < 2; axis++) {
+				uint32_t valid = SurviveSensorActivations_valid_sensors(activations, tolerances[t], lh, axis);
+				for (uint32_t sensor = 0; sensor < SENSORS_PER_OBJECT; sensor++) {
+					bool expected =
+						SurviveSensorActivations_is_reading_valid(activations, tolerances[t], sensor, lh, axis);
+					ASSERT_EQ(((valid >> sensor) & 1), expected);
+				}
+			}
+		}
+	}
+
+	// The last lighthouse went quiet long ago
+	int quiet_lh = SENSOR_ACTIVATIONS_TEST_LH_CNT - 1;
+	ASSERT_EQ(SurviveSensorActivations_valid_sensors(activations, 4800000, quiet_lh, 0), 0);
+	ASSERT_EQ((SurviveSensorActivations_valid_sensors(activations, 480000000, quiet_lh, 0) != 0), true);
+
+	destroy_test_device(so);
+	return 0;
+}
+
+TEST(SensorActivations, LongTimecodes) {
+	SurviveObject *so = create_test_device();
+	SurviveSensorActivations *activations = &so->activations;
+
+	// Well past what fits in 32 bits, and then far enough along that the compact layout has to move its base
+	survive_long_timecode start = 0x300000000ull + 12345;
+	survive_long_timecode later = start + 0x180000000ull;
+	add_reading(activations, 3, 1, 0, start, .5);
+	add_reading(activations, 4, 1, 1, later, .25);
+	add_reading(activations, 5, 6, 0, later + 1, -.25);
+
+	ASSERT_EQ((SurviveSensorActivations_timecode(activations, 4, 1, 1) == later), true);
+	ASSERT_EQ((SurviveSensorActivations_timecode(activations, 5, 6, 0) == later + 1), true);
+	ASSERT_EQ((SurviveSensorActivations_angle(activations, 5, 6, 0) == -.25), true);
+	ASSERT_EQ(isnan(SurviveSensorActivations_angle(activations, 5, 6, 1)), true);
+	ASSERT_EQ(SurviveSensorActivations_timecode(activations, 5, 6, 1), 0);
+
+	// The first reading is older than anything gets checked against; it may be clamped but must stay old
+	ASSERT_EQ((SurviveSensorActivations_timecode(activations, 3, 1, 0) < later - 0x40000000ull), true);
+	ASSERT_EQ(SurviveSensorActivations_is_reading_valid(activations, 48000000, 3, 1, 0), false);
+	ASSERT_EQ(SurviveSensorActivations_is_reading_valid(activations, 48000000, 4, 1, 1), true);
+
+	SurviveSensorActivations copy = {0};
+	SurviveSensorActivations_copy(&copy, activations);
+	SurviveSensorActivations_reset(activations);
+	ASSERT_EQ(isnan(SurviveSensorActivations_angle(activations, 4, 1, 1)), true);
+	ASSERT_EQ((SurviveSensorActivations_timecode(&copy, 4, 1, 1) == later), true);
+	ASSERT_EQ((SurviveSensorActivations_angle(&copy, 4, 1, 1) == .25), true);
+	SurviveSensorActivations_dtor(&copy);
+
+	destroy_test_device(so);
+	return 0;
+}
+
+TEST(SensorActivations, IngestSpeed) {
+	// Several tracked objects, so the activations of all of them don't just sit in L1
+	SurviveObject *so[SENSOR_ACTIVATIONS_TEST_OBJECT_CNT];
+	for (int i = 0; i < SENSOR_ACTIVATIONS_TEST_OBJECT_CNT; i++) {
+		so[i] = create_test_device();
+	}
+
+	size_t events = 0;
+	survive_long_timecode timecode = 48000000;
+	double start = OGGetAbsoluteTime(), stop = 0;
+	do {
+		for (int i = 0; i < 10000; i++, events++) {
+			// Sweeps come one lighthouse axis at a time and hit most sensors of one object
+			int sweep = (int)(events / SENSOR_ACTIVATIONS_TEST_SENSOR_CNT);
+			int sensor = (int)(events % SENSOR_ACTIVATIONS_TEST_SENSOR_CNT);
+			int lh = (sweep / 2) % SENSOR_ACTIVATIONS_TEST_LH_CNT;
+			SurviveSensorActivations *activations = &so[sweep % SENSOR_ACTIVATIONS_TEST_OBJECT_CNT]->activations;
+			timecode += 2000;
+			add_reading(activations, sensor, lh, sweep & 1, timecode, .1 + sensor * .01 + (events % 7) * 1e-4);
+		}
+		stop = OGGetAbsoluteTime();
+	} while (stop - start < .5);
+
+	const char *layout =
+#ifdef SURVIVE_COMPACT_SENSOR_ACTIVATIONS
+		"compact";
+#else
+		"default";
+#endif
+	double ns_per_event = (stop - start) / events * 1e9;
+	printf("Sensor activations ingest (%s layout, %d bytes): %6.2fns per light event\n", layout,
+		   (int)sizeof(SurviveSensorActivations), ns_per_event);
+	TEST_PRINTF("Sensor activations ingest (%s layout, %d bytes): %6.2fns per light event\n", layout,
+				(int)sizeof(SurviveSensorActivations), ns_per_event);
+
+	for (int i = 0; i < SENSOR_ACTIVATIONS_TEST_OBJECT_CNT; i++) {
+		destroy_test_device(so[i]);
+	}
+	return 0;
+}
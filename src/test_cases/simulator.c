@@ -0,0 +1,85 @@
+#include "test_case.h"
+#include <stdio.h>
+#include <string.h>
+
+#define SIMULATOR_TEST_MAX_EVENTS 200000
+
+typedef struct simulator_test_run {
+	SurviveContext *ctx;
+	// Light and IMU timecodes in the order the hooks saw them
+	survive_timecode timecodes[SIMULATOR_TEST_MAX_EVENTS];
+	size_t cnt, hits;
+	bool finished;
+} simulator_test_run;
+
+static void record_timecode(SurviveObject *so, survive_timecode timecode) {
+	simulator_test_run *run = so->ctx->user_ptr;
+	if (run->cnt < SIMULATOR_TEST_MAX_EVENTS)
+		run->timecodes[run->cnt++] = timecode;
+}
+
+static void test_sync(SurviveObject *so, survive_channel channel, survive_timecode timeofsync, bool ootx, bool gen) {
+	record_timecode(so, timeofsync);
+}
+static void test_sweep(SurviveObject *so, survive_channel channel, int sensor_id, survive_timecode timecode,
+					   bool flag) {
+	simulator_test_run *run = so->ctx->user_ptr;
+	run->hits++;
+	record_timecode(so, timecode);
+}
+static void test_imu(SurviveObject *so, int mask, const FLT *accelgyro, survive_timecode timecode, int id) {
+	record_timecode(so, timecode);
+}
+static void test_log(SurviveContext *ctx, SurviveLogLevel logLevel, const char *fault) {}
+
+static SurviveContext *start_simulator(simulator_test_run *run, const char *configfile) {
+	remove(configfile);
+	char *args[] = {"test",
+					"--configfile",
+					(char *)configfile,
+					"--simulator",
+					"--simulator-time",
+					"1",
+					"--simulator-realtime",
+					"0",
+					"--simulator-init-time",
+					"0"};
+	run->ctx = survive_init_with_logger(sizeof(args) / sizeof(args[0]), args, run, test_log);
+	// Only the simulator's output is looked at, so nothing gets passed on to the posers
+	survive_install_sync_fn(run->ctx, test_sync);
+	survive_install_sweep_fn(run->ctx, test_sweep);
+	survive_install_imu_fn(run->ctx, test_imu);
+	return run->ctx;
+}
+
+// Two simulators are polled in lockstep; each should put out its events in time order, and with the same seed both
+// should put out the same ones no matter how their polls interleave
+TEST(Simulator, EventQueueAndInstances) {
+	static simulator_test_run runs[2];
+	memset(runs, 0, sizeof(runs));
+	const char *configfiles[2] = {"./simulator_test_a.json", "./simulator_test_b.json"};
+	for (int i = 0; i < 2; i++)
+		start_simulator(&runs[i], configfiles[i]);
+
+	while (!runs[0].finished || !runs[1].finished) {
+		for (int i = 0; i < 2; i++) {
+			if (!runs[i].finished)
+				runs[i].finished = survive_poll(runs[i].ctx) != 0;
+		}
+	}
+
+	for (int i = 0; i < 2; i++) {
+		survive_close(runs[i].ctx);
+		remove(configfiles[i]);
+
+		ASSERT_GT((double)runs[i].hits, 1000.);
+		ASSERT_GT((double)SIMULATOR_TEST_MAX_EVENTS, (double)runs[i].cnt);
+		for (size_t j = 1; j < runs[i].cnt; j++) {
+			ASSERT_GE((double)runs[i].timecodes[j], (double)runs[i].timecodes[j - 1]);
+		}
+	}
+
+	ASSERT_EQ(runs[0].cnt, runs[1].cnt);
+	ASSERT_EQ(memcmp(runs[0].timecodes, runs[1].timecodes, runs[0].cnt * sizeof(survive_timecode)), 0);
+	return 0;
+}
@@ -34,7 +34,8 @@ struct PlaybackDataInput {
 	std::vector<double> meas, cov;
 	SurviveSensorActivations activations;
 	PlaybackDataInput(SurviveObject *so, const SurvivePose &position)
-		: so(so), position(position), activations(so->activations) {
+		: so(so), position(position), activations() {
+		SurviveSensorActivations_copy(&activations, &so->activations);
 		int32_t sensor_count = so->sensor_ct;
 		vmask.resize(sensor_count * NUM_LIGHTHOUSES);
 		cov.resize(4 * sensor_count * NUM_LIGHTHOUSES);
@@ -44,7 +45,13 @@ struct PlaybackDataInput {
 		cov.resize(4 * new_size);
 		meas.resize(2 * new_size);
 	}
-	~PlaybackDataInput() {}
+	PlaybackDataInput(const PlaybackDataInput &other)
+		: so(other.so), position(other.position), timestamp(other.timestamp), vmask(other.vmask), meas(other.meas),
+		  cov(other.cov), activations() {
+		SurviveSensorActivations_copy(&activations, &other.activations);
+	}
+	PlaybackDataInput &operator=(const PlaybackDataInput &) = delete;
+	~PlaybackDataInput() { SurviveSensorActivations_dtor(&activations); }
 };
 
 struct PlaybackData {
@@ -61,17 +68,18 @@ static size_t construct_input_from_scene(SurviveObject *so, uint32_t timestamp,
 	for (size_t sensor = 0; sensor < so->sensor_ct; sensor++) {
 		for (size_t lh = 0; lh < 2; lh++) {
 			if (SurviveSensorActivations_isPairValid(scene, settings.sensor_time_window, timestamp, sensor, lh)) {
-				double *a = scene->angles[sensor][lh];
+				double a[2] = {SurviveSensorActivations_angle(scene, sensor, lh, 0),
+							   SurviveSensorActivations_angle(scene, sensor, lh, 1)};
 				vmask[sensor * NUM_LIGHTHOUSES + lh] = 1;
 
 				if (cov) {
 					*(cov++) = settings.sensor_variance +
-							   std::abs((double)timestamp - scene->timecode[sensor][lh][0]) *
+							   std::abs((double)timestamp - SurviveSensorActivations_timecode(scene, sensor, lh, 0)) *
 								   settings.sensor_variance_per_second / (double)so->timebase_hz;
 					*(cov++) = 0;
 					*(cov++) = 0;
 					*(cov++) = settings.sensor_variance +
-							   std::abs((double)timestamp - scene->timecode[sensor][lh][1]) *
+							   std::abs((double)timestamp - SurviveSensorActivations_timecode(scene, sensor, lh, 1)) *
 								   settings.sensor_variance_per_second / (double)so->timebase_hz;
 				}
 				meas[rtn++] = a[0];
@@ -232,7 +240,8 @@ double find_optimal_cal(SurviveContext *ctx, PlaybackData &data) {
 				auto scene = &in.activations;
 				if (SurviveSensorActivations_isPairValid(scene, settings.sensor_time_window, in.timestamp, sensor,
 														 lh)) {
-					double *a = scene->angles[sensor][lh];
+					double a[2] = {SurviveSensorActivations_angle(scene, sensor, lh, 0),
+								   SurviveSensorActivations_angle(scene, sensor, lh, 1)};
 					vmask.emplace_back(1); //[sensor * NUM_LIGHTHOUSES + lh] = 1;
 
 					meas.emplace_back(a[0]);
@@ -31,15 +31,14 @@ static size_t construct_input_from_scene(SurviveObject *so, size_t timecode, sur
 						SurviveSensorActivations_isPairValid(scene, sensor_time_window, timecode, sensor, lh);
 				}
 				if (isReadingValue) {
-					const double *a = scene->angles[sensor][lh];
 					measurements.push_back({});
 					auto meas = &measurements.back();
 					meas->axis = axis;
-					meas->value = a[axis];
+					meas->value = SurviveSensorActivations_angle(scene, sensor, lh, axis);
 					meas->sensor_idx = sensor;
 					meas->lh = lh;
 					meas->object = poses.size();
-					survive_timecode diff = survive_timecode_difference(timecode, scene->timecode[sensor][lh][axis]);
+					survive_timecode diff = survive_timecode_difference(timecode, SurviveSensorActivations_timecode(scene, sensor, lh, axis));
 					meas->variance = sensor_variance + diff * sensor_variance_per_second / (double)so->timebase_hz;
 					rtn++;
 				}
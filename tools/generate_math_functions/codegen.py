@@ -1,4 +1,5 @@
 import inspect
+import re
 import sys
 import types
 from collections.abc import Iterable
@@ -134,6 +135,18 @@ def get_name(a):
         return a.__name__
     return str(a)
 
+def get_type(a):
+    if callable(a):
+        return get_type(a())
+    if hasattr(a, "__iter__"):
+        ty = get_type(a[0])
+        if ty[-1] != "*":
+            ty += "*"
+        return ty
+    if isinstance(a, SurviveType):
+        return a.__class__.__name__ + "*"
+    return "FLT"
+
 def generate_ccode(func, name=None, args=None, suffix = None):
     if callable(func):
         name = func.__name__
@@ -154,18 +167,6 @@ def generate_ccode(func, name=None, args=None, suffix = None):
 
     cse_output = cse(sp.Matrix(flatten))
 
-    def get_type(a):
-        if callable(a):
-            return get_type(a())
-        if hasattr(a, "__iter__"):
-            ty = get_type(a[0])
-            if ty[-1] != "*":
-                ty += "*"
-            return ty
-        if isinstance(a, SurviveType):
-            return a.__class__.__name__ + "*"
-        return "FLT"
-
     def arg_str(arg):
         a = arg[1]
         return "const %s %s" % (get_type(a), get_name(a))
@@ -202,6 +203,187 @@ def generate_ccode(func, name=None, args=None, suffix = None):
     print("")
 
 
+c_token = re.compile(r'(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?|[A-Za-z_]\w*\(?|\S')
+
+def c_variables(txt):
+    """Names read by an emitted C expression; function names and literals don't count"""
+    return set(t for t in c_token.findall(txt) if (t[0].isalpha() or t[0] == '_') and t[-1] != '(')
+
+def matching_paren(txt, start):
+    depth = 0
+    for i in range(start, len(txt)):
+        if txt[i] == '(':
+            depth += 1
+        elif txt[i] == ')':
+            depth -= 1
+            if depth == 0:
+                return i
+    raise Exception("Unbalanced expression " + txt)
+
+def hoist_invariants(txt, varying, hoisted):
+    """Replaces the outermost parenthesized terms and calls of txt that read nothing in varying with names from
+    hoisted, which maps each such term to the name it is computed into ahead of the loop"""
+    rtn = ''
+    i = 0
+    while i < len(txt):
+        m = c_token.match(txt, i)
+        if m is None:
+            rtn += txt[i]
+            i += 1
+            continue
+
+        token = m.group(0)
+        if token[-1] == '(':
+            end = matching_paren(txt, m.end() - 1)
+            term = txt[i:end + 1]
+            names = c_variables(term)
+            if names and not (names & varying):
+                if term not in hoisted:
+                    hoisted[term] = "c%d" % len(hoisted)
+                rtn += hoisted[term]
+                i = end + 1
+                continue
+        rtn += txt[i:m.end()]
+        i = m.end()
+    return rtn
+
+def soa_index(k):
+    return ["i", "n + i"][k] if k < 2 else "%d * n + i" % k
+
+def split_invariants(batched, temps, outputs):
+    """Sorts CSE output by whether it reads a batched value. Returns the statements that don't, the terms hoisted out
+    of the ones that do (term -> name), the ones that do and the outputs, the latter two with hoisted terms replaced"""
+    varying = set(v for v, _ in batched)
+    invariant_lines, point_lines, hoisted = [], [], {}
+    for v, expr in temps:
+        if c_variables(expr) & varying:
+            point_lines.append((v, hoist_invariants(expr, varying, hoisted)))
+            varying.add(v)
+        else:
+            invariant_lines.append((v, expr))
+    outputs = [hoist_invariants(expr, varying, hoisted) for expr in outputs]
+    hoisted_lines = [(v, clean_parens(term)) for term, v in hoisted.items()]
+    return invariant_lines, hoisted_lines, point_lines, outputs
+
+def emit_batched(name, params, unrolled, batched, temps, outputs):
+    """Lays out a function over n points: everything that doesn't read a batched value is computed once ahead of the
+    loop, and the loop itself is straight line code over arrays, which is what the vectorizer wants to see"""
+    invariant_lines, hoisted_lines, point_lines, outputs = split_invariants(batched, temps, outputs)
+
+    lines = ["static inline void gen_%s(%s) {" % (name, ", ".join(params))]
+    lines += ["\tconst GEN_FLT %s = %s;" % item for item in unrolled + invariant_lines + hoisted_lines]
+    lines.append("\tfor (size_t i = 0; i < n; i++) {")
+    lines += ["\t\tconst GEN_FLT %s = %s;" % item for item in batched + point_lines]
+    lines += ["\t\tout[%s] = %s;" % (soa_index(k), expr) for k, expr in enumerate(outputs)]
+    lines += ["\t}", "}", ""]
+    return "\n".join(lines)
+
+def emit_prepared(name, params, batch_param, unrolled, batched, temps, outputs):
+    """Splits a function in two: gen_<name>_prepare computes everything that doesn't read the batched argument into
+    prepared[gen_<name>_prepared_size], and gen_<name>_eval finishes the job for one value of that argument"""
+    invariant_lines, hoisted_lines, point_lines, outputs = split_invariants(batched, temps, outputs)
+
+    point_names = set(v for v, _ in batched + point_lines)
+    reads = set().union(*[c_variables(expr) for _, expr in point_lines], *[c_variables(expr) for expr in outputs])
+    stored = [v for v, _ in unrolled + invariant_lines + hoisted_lines if v in reads and v not in point_names]
+
+    lines = ["enum { gen_%s_prepared_size = %d };" % (name, len(stored)), ""]
+    lines.append("static inline void gen_%s_prepare(%s) {" % (name, ", ".join(["FLT *prepared"] + params)))
+    lines += ["\tconst GEN_FLT %s = %s;" % item for item in unrolled + invariant_lines + hoisted_lines]
+    lines += ["\tprepared[%d] = %s;" % (k, v) for k, v in enumerate(stored)]
+    lines += ["}", ""]
+
+    lines.append("static inline void gen_%s_eval(FLT *out, const FLT *prepared, %s) {" % (name, batch_param))
+    lines += ["\tconst GEN_FLT %s = prepared[%d];" % (v, k) for k, v in enumerate(stored)]
+    lines += ["\tconst GEN_FLT %s = %s;" % item for item in batched + point_lines]
+    lines += ["\tout[%d] = %s;" % (k, expr) for k, expr in enumerate(outputs)]
+    lines += ["}", ""]
+    return "\n".join(lines)
+
+def split_ccode(func, args, batch_over, index):
+    """CSE of func, broken into the pieces the emit_ functions take; batch_over's components are read as
+    batch_over[index(k)]"""
+    cse_output = cse(sp.Matrix(make_sympy(func)))
+
+    params = []
+    batch_param, unrolled, batched = None, [], []
+    for a in args:
+        a_name = get_name(a)
+        if a is batch_over:
+            batch_param = "const FLT *GEN_RESTRICT %s" % a_name
+            params.append(batch_param)
+            batched += [(str(v), "%s[%s]" % (a_name, index(k))) for k, (_, v) in enumerate(flatten_args(a()))]
+            continue
+
+        params.append("const %s %s" % (get_type(a), a_name))
+        if callable(a):
+            prefix = "(*" + a_name + ")" if isinstance(a(), SurviveType) else a_name
+            unrolled += [(str(v), prefix + k) for k, v in flatten_args(a())]
+
+    def clean(item):
+        return ccode(item).replace("\n", " ").replace("\t", " ")
+
+    temps = [(sp.ccode(item[0]), clean(item[1])) for item in cse_output[0]]
+    outputs = []
+    for item in cse_output[1]:
+        outputs += [clean(item1) for item1 in sum(item.tolist(), [])] if hasattr(item, "tolist") else [clean(item)]
+    return params, batch_param, unrolled, batched, temps, outputs
+
+def generate_batched_ccode(func, name=None, args=None, suffix=None, batch_over=sensor_pt):
+    """Same as generate_ccode, but emits gen_<name>_batch which evaluates func for n values of batch_over. Those come
+    in as a structure of arrays -- batch_over[k * n + i] is the k'th component of point i -- and output j of point i
+    is written to out[j * n + i]."""
+    if callable(func):
+        name = func.__name__
+        args = [get_argument(n) for n in inspect.getfullargspec(func).args]
+
+    if suffix is not None:
+        name = name + "_" + suffix
+    name = name + "_batch"
+
+    sys.stderr.write("Writing out %s\n" % name)
+
+    if isinstance(func, types.FunctionType):
+        func = func(*map_arg(args))
+
+    params, batch_param, unrolled, batched, temps, outputs = split_ccode(func, args, batch_over, soa_index)
+    params = ["FLT *GEN_RESTRICT out", "size_t n"] + params
+    print(emit_batched(name, params, unrolled, batched, temps, outputs))
+
+def generate_prepared_ccode(func, name=None, args=None, suffix=None, batch_over=sensor_pt):
+    """Emits func as a gen_<name>_prepare / gen_<name>_eval pair; see emit_prepared"""
+    if callable(func):
+        name = func.__name__
+        args = [get_argument(n) for n in inspect.getfullargspec(func).args]
+
+    if suffix is not None:
+        name = name + "_" + suffix
+
+    sys.stderr.write("Writing out %s\n" % name)
+
+    if isinstance(func, types.FunctionType):
+        func = func(*map_arg(args))
+
+    params, batch_param, unrolled, batched, temps, outputs = split_ccode(func, args, batch_over, str)
+    params.remove(batch_param)
+    print(emit_prepared(name, params, batch_param.replace("GEN_RESTRICT ", ""), unrolled, batched, temps, outputs))
+
+def generate_fused_ccode(func, jac_over, suffix=None):
+    """Emits func's value followed by its jacobian wrt each of jac_over in turn, row by row, as one prepared function.
+    Sharing a CSE pass lets the value and the jacobians reuse each other's terms."""
+    func_args = [get_argument(n) for n in inspect.getfullargspec(func).args]
+    feval = func(*map_arg(func_args))
+    if type(feval) == list:
+        feval = sp.MutableDenseMatrix(feval)
+
+    fused = sum(feval.tolist(), []) if hasattr(feval, "tolist") else [feval]
+    for over in jac_over:
+        fused += sum(jacobian(feval, flat_values(map_arg(over))).tolist(), [])
+
+    name = func.__name__ + "_val_jac_" + "_".join(map(get_name, jac_over))
+    print("// Value of", func.__name__, "then its jacobian wrt", ", ".join(map(get_name, jac_over)))
+    generate_prepared_ccode(fused, name, func_args, suffix=suffix)
+
 def jacobian(v, of):
     if hasattr(v, 'jacobian'):
         return v.jacobian(sp.Matrix(of))
@@ -223,7 +405,7 @@ def flat_values(a):
         return flat_values(a.__dict__.values())
     return [a]
 
-def generate_jacobians(func, suffix=None,transpose=False,jac_all=False, jac_over=None):
+def generate_jacobians(func, suffix=None,transpose=False,jac_all=False, jac_over=None, batched=False):
     rtn = {}
 
     func_args = [get_argument(n) for n in inspect.getfullargspec(func).args]
@@ -246,7 +428,7 @@ def generate_jacobians(func, suffix=None,transpose=False,jac_all=False, jac_over
         if transpose:
             this_jac = this_jac.transpose()
         print("// Jacobian of", func.__name__, "wrt", jac_value)
-        generate_ccode(this_jac, fname, func_args, suffix=suffix)
+        (generate_batched_ccode if batched else generate_ccode)(this_jac, fname, func_args, suffix=suffix)
         rtn[fname] = this_jac
     return rtn
 
@@ -0,0 +1,43 @@
+# -*- python -*-
+# Derives single precision versions of already generated functions. The math is the same, only the working type and
+# the libm calls change -- to GEN_FLTF and the polynomial approximations in common_float.h -- so this works on the
+# generated C instead of going through sympy again. Parameters and outputs stay FLT; only the internals are float.
+
+import re
+import sys
+
+float_functions = {"sin": "__fast_sinf", "cos": "__fast_cosf", "tan": "__fast_tanf", "asin": "__fast_asinf",
+                   "atan2": "__fast_atan2f", "sqrt": "__fast_sqrtf"}
+
+float_literal = re.compile(r'(?<![\w.])(\d+\.\d*(?:e[-+]?\d+)?|\d+e[-+]?\d+)(?![\w.])')
+math_call = re.compile(r'\b(' + '|'.join(float_functions) + r')\(')
+
+
+def read_functions(fn):
+    txt = open(fn).read()
+    rtn = {}
+    for m in re.finditer(r'^static inline [^\n]*?\b(gen_\w+)\(.*?^}\n', txt, re.M | re.S):
+        rtn[m.group(1)] = m.group(0)
+    return rtn
+
+
+def to_float(name, txt):
+    txt = txt.replace(name + "(", name + "_float(", 1)
+    txt = re.sub(r'\bGEN_FLT\b', 'GEN_FLTF', txt)
+    txt = math_call.sub(lambda m: float_functions[m.group(1)] + "(", txt)
+    return float_literal.sub(lambda m: m.group(1) + "f", txt)
+
+
+if __name__ == "__main__":
+    functions = {}
+    for fn in sys.argv[1:]:
+        functions.update(read_functions(fn))
+
+    print("#pragma once")
+    print("#include \"common_float.h\"")
+    for g in ["_gen2", ""]:
+        # Only the value evals; jacobians in single precision lose too much to cancellation to be worth it
+        names = ["gen_reproject%s_axis_angle_eval" % g]
+        names += ["gen_reproject_axis_%s%s_axis_angle_eval" % (axis, g) for axis in "xy"]
+        for name in names:
+            print(to_float(name, functions[name]))
@@ -11,6 +11,24 @@ if __name__ == "__main__":
 
         for f in common_math.generate:
             generate_ccode(f)
+    elif len(sys.argv) > 1 and sys.argv[1] == "--batch":
+        print("#pragma once")
+        print("#include \"common.h\"")
+        for mode in [True, False]:
+            common_math.axis_angle_mode = mode
+            suffix = "axis_angle" if common_math.axis_angle_mode else None
+            for f in gen2.generate + gen1.generate:
+                generate_batched_ccode(f, suffix=suffix)
+                generate_jacobians(f, suffix=suffix, jac_over=obj_p, batched=True)
+    elif len(sys.argv) > 1 and sys.argv[1] == "--prepared":
+        print("#pragma once")
+        print("#include \"common.h\"")
+        # Only the axis angle forms; those are what the optimizer works in
+        common_math.axis_angle_mode = True
+        for f in gen2.generate + gen1.generate:
+            generate_prepared_ccode(f, suffix="axis_angle")
+            generate_fused_ccode(f, [obj_p], suffix="axis_angle")
+            generate_fused_ccode(f, [obj_p, lh_p], suffix="axis_angle")
     else:
         print("#pragma once")
         print("#include \"common.h\"")
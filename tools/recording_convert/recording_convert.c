@@ -0,0 +1,123 @@
+// Converts recordings between the text and binary formats. The input format is detected from the file contents; the
+// output format is picked from the output filename the same way --record does it.
+#include <stdio.h>
+#include <string.h>
+
+#include <survive_gz.h>
+#include <survive_recording_binary.h>
+#include <survive_str.h>
+
+static bool ends_with(const char *s, const char *suffix) {
+	size_t s_len = strlen(s), suffix_len = strlen(suffix);
+	return s_len >= suffix_len && strcmp(s + s_len - suffix_len, suffix) == 0;
+}
+
+// Reads a full line regardless of length; returns 0 at the end of the file
+static char *read_line(gzFile f, char **buffer, size_t *size) {
+	size_t len = 0;
+	for (;;) {
+		if (*size - len < 2) {
+			*size = *size ? *size * 2 : 4096;
+			*buffer = realloc(*buffer, *size);
+		}
+		if (gzgets(f, *buffer + len, (int)(*size - len)) == 0) {
+			return len ? *buffer : 0;
+		}
+		len += strlen(*buffer + len);
+		if (len > 0 && (*buffer)[len - 1] == '\n') {
+			return *buffer;
+		}
+	}
+}
+
+static int text_to_binary(gzFile input, gzFile output) {
+	survive_binary_writer writer;
+	if (survive_binary_writer_init(&writer, output) != 0) {
+		return -1;
+	}
+
+	char *line = 0;
+	size_t line_size = 0;
+	int lineno = 0, rtn = 0;
+	while (read_line(input, &line, &line_size)) {
+		lineno++;
+
+		survive_binary_record record = {0};
+		if (!survive_binary_record_parse_text(&record, line)) {
+			fprintf(stderr, "Skipping unparsable line %d\n", lineno);
+			continue;
+		}
+		if (survive_binary_writer_write(&writer, &record) < 0) {
+			fprintf(stderr, "Could not write record from line %d\n", lineno);
+			rtn = -1;
+			break;
+		}
+	}
+
+	free(line);
+	survive_binary_writer_free(&writer);
+	return rtn;
+}
+
+static int binary_to_text(survive_binary_reader *reader, gzFile output) {
+	cstring out = {0};
+	survive_binary_record record;
+	int r, rtn = 0;
+	while ((r = survive_binary_reader_next(reader, &record)) > 0) {
+		str_clear(&out);
+		survive_binary_record_append_text(&out, &record);
+		if (out.length && gzwrite(output, out.d, (unsigned)out.length) != (int)out.length) {
+			fprintf(stderr, "Could not write output\n");
+			rtn = -1;
+			break;
+		}
+	}
+	if (r < 0) {
+		fprintf(stderr, "Input ends with a malformed record\n");
+		rtn = -1;
+	}
+
+	str_free(&out);
+	return rtn;
+}
+
+int main(int argc, char **argv) {
+	if (argc != 3) {
+		fprintf(stderr, "Usage: %s <input recording> <output recording>\n", argv[0]);
+		fprintf(stderr, "Output ending in .bin or .bin.gz is written in the binary format; .gz is compressed.\n");
+		return -1;
+	}
+
+	gzFile input = gzopen(argv[1], "r");
+	if (input == 0) {
+		fprintf(stderr, "Could not open %s\n", argv[1]);
+		return -1;
+	}
+
+	gzFile output = gzopen(argv[2], ends_with(argv[2], ".gz") ? "w6F" : "wT");
+	if (output == 0) {
+		fprintf(stderr, "Could not open %s for writing\n", argv[2]);
+		gzclose(input);
+		return -1;
+	}
+
+	survive_binary_reader reader;
+	bool input_binary = survive_binary_reader_init(&reader, input) == 0;
+	bool output_binary = survive_recording_is_binary_filename(argv[2]);
+
+	int rtn = 0;
+	if (input_binary == output_binary) {
+		fprintf(stderr, "%s is already in the requested format\n", argv[1]);
+		rtn = -1;
+	} else if (input_binary) {
+		rtn = binary_to_text(&reader, output);
+	} else {
+		gzseek(input, 0, SEEK_SET);
+		rtn = text_to_binary(input, output);
+	}
+
+	survive_binary_reader_free(&reader);
+	gzclose(input);
+	gzclose(output);
+	return rtn;
+}
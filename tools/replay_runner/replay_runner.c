@@ -0,0 +1,343 @@
+// Replays a set of recordings in parallel, one SurviveContext per worker, and writes accuracy and timing metrics for
+// each of them as JSON. Poses are compared against the replay_ poses recorded alongside the original run, and text
+// recordings are played back deterministically so that two runs of the same build report the same accuracy.
+#include <dirent.h>
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/resource.h>
+
+#include <os_generic.h>
+#include <survive.h>
+#include <survive_kalman_tracker.h>
+
+typedef struct replay_error_stats {
+	size_t count;
+	FLT pos_sum, pos_sq_sum, pos_max;
+	FLT rot_sum, rot_sq_sum, rot_max;
+} replay_error_stats;
+
+typedef struct replay_run {
+	const char *filename;
+	int status;
+
+	double wall_time_s, recording_time_s;
+	replay_error_stats error;
+
+	size_t syncs;
+	double sync_solve_time_s;
+	PoserCB poser_fn;
+
+	uint64_t kalman_updates;
+
+	external_pose_process_func external_pose_fn;
+} replay_run;
+
+typedef struct replay_runner {
+	replay_run *runs;
+	size_t run_cnt, next_run;
+	og_mutex_t lock;
+
+	int extra_argc;
+	char **extra_argv;
+} replay_runner;
+
+static void add_error(replay_error_stats *stats, FLT pos_err, FLT rot_err) {
+	stats->count++;
+	stats->pos_sum += pos_err;
+	stats->pos_sq_sum += pos_err * pos_err;
+	stats->rot_sum += rot_err;
+	stats->rot_sq_sum += rot_err * rot_err;
+	if (pos_err > stats->pos_max)
+		stats->pos_max = pos_err;
+	if (rot_err > stats->rot_max)
+		stats->rot_max = rot_err;
+}
+
+static void merge_error(replay_error_stats *stats, const replay_error_stats *other) {
+	stats->count += other->count;
+	stats->pos_sum += other->pos_sum;
+	stats->pos_sq_sum += other->pos_sq_sum;
+	stats->rot_sum += other->rot_sum;
+	stats->rot_sq_sum += other->rot_sq_sum;
+	if (other->pos_max > stats->pos_max)
+		stats->pos_max = other->pos_max;
+	if (other->rot_max > stats->rot_max)
+		stats->rot_max = other->rot_max;
+}
+
+// Compares the tracked pose of an object with its ground truth each time the recording replays one
+static void external_pose_fn(SurviveContext *ctx, const char *name, const SurvivePose *pose) {
+	replay_run *run = ctx->user_ptr;
+	run->external_pose_fn(ctx, name, pose);
+
+	if (strncmp(name, "replay_", strlen("replay_")) != 0) {
+		return;
+	}
+
+	SurviveObject *so = survive_get_so_by_name(ctx, name + strlen("replay_"));
+	if (so == 0 || quatiszero(so->OutPose.Rot) || quatiszero(pose->Rot)) {
+		return;
+	}
+
+	SurvivePose inv_truth = InvertPoseRtn(pose);
+	SurvivePose delta;
+	ApplyPoseToPose(&delta, &so->OutPose, &inv_truth);
+	FLT w = fabs(delta.Rot[0]);
+	add_error(&run->error, norm3d(delta.Pos), 2. * acos(w > 1. ? 1. : w));
+}
+
+// stdout is where the JSON goes when there is no -o
+static void log_fn(SurviveContext *ctx, SurviveLogLevel logLevel, const char *fault) { fprintf(stderr, "%s\n", fault); }
+
+// Times the poser for sync events; posers run inline since playback doesn't thread them here
+static int timed_poser_fn(SurviveObject *so, void **user, PoserData *pd) {
+	replay_run *run = so->ctx->user_ptr;
+	if (pd->pt != POSERDATA_SYNC && pd->pt != POSERDATA_SYNC_GEN2) {
+		return run->poser_fn(so, user, pd);
+	}
+
+	double start = OGGetAbsoluteTime();
+	int rtn = run->poser_fn(so, user, pd);
+	run->sync_solve_time_s += OGGetAbsoluteTime() - start;
+	run->syncs++;
+	return rtn;
+}
+
+static void replay(replay_runner *runner, replay_run *run) {
+	char config_path[FILENAME_MAX];
+	snprintf(config_path, sizeof(config_path), "%s.json", run->filename);
+
+	char *args[] = {"",
+					"--init-configfile",
+					config_path,
+					"--playback",
+					(char *)run->filename,
+					"--playback-replay-pose",
+					"--playback-factor",
+					"0",
+					"--playback-deterministic",
+					"1",
+					"--no-threaded-posers"};
+	int args_cnt = sizeof(args) / sizeof(args[0]);
+
+	int argc = args_cnt + runner->extra_argc;
+	char **argv = calloc(argc, sizeof(char *));
+	memcpy(argv, args, sizeof(args));
+	memcpy(argv + args_cnt, runner->extra_argv, runner->extra_argc * sizeof(char *));
+
+	double start = OGGetAbsoluteTime();
+	SurviveContext *ctx = survive_init_internal(argc, argv, run, log_fn);
+	free(argv);
+	if (ctx == 0 || survive_startup(ctx) != 0) {
+		run->status = -1;
+		if (ctx)
+			survive_close(ctx);
+		return;
+	}
+
+	run->poser_fn = ctx->PoserFn;
+	if (run->poser_fn) {
+		ctx->PoserFn = timed_poser_fn;
+	}
+	run->external_pose_fn = survive_install_external_pose_fn(ctx, external_pose_fn);
+
+	while (survive_poll(ctx) == 0) {
+	}
+
+	run->wall_time_s = OGGetAbsoluteTime() - start;
+	run->recording_time_s = survive_run_time(ctx);
+	run->status = ctx->currentError;
+
+	for (int i = 0; i < ctx->objs_ct; i++) {
+		const SurviveKalmanTracker *tracker = ctx->objs[i]->tracker;
+		if (tracker) {
+			run->kalman_updates += tracker->stats.obs_count + tracker->stats.lightcap_count + tracker->stats.imu_count;
+		}
+	}
+
+	survive_close(ctx);
+}
+
+static void *replay_worker(void *_runner) {
+	replay_runner *runner = _runner;
+	for (;;) {
+		OGLockMutex(runner->lock);
+		replay_run *run = runner->next_run < runner->run_cnt ? &runner->runs[runner->next_run++] : 0;
+		OGUnlockMutex(runner->lock);
+
+		if (run == 0) {
+			return 0;
+		}
+		replay(runner, run);
+		fprintf(stderr, "Finished %s in %.2fs\n", run->filename, run->wall_time_s);
+	}
+}
+
+static bool is_recording(const char *fn) {
+	return strstr(fn, ".rec") || strstr(fn, ".pcap.gz") || strstr(fn, ".bin");
+}
+
+static void add_run(replay_runner *runner, const char *fn) {
+	runner->runs = realloc(runner->runs, (runner->run_cnt + 1) * sizeof(replay_run));
+	runner->runs[runner->run_cnt++] = (replay_run){.filename = strdup(fn)};
+}
+
+// Adds the recordings in a directory, or the path itself if it isn't one
+static void add_path(replay_runner *runner, const char *path) {
+	DIR *dir = opendir(path);
+	if (dir == 0) {
+		add_run(runner, path);
+		return;
+	}
+
+	struct dirent *entry;
+	while ((entry = readdir(dir))) {
+		size_t len = strlen(entry->d_name);
+		bool is_index_or_config = (len > 4 && strcmp(entry->d_name + len - 4, ".idx") == 0) ||
+								  (len > 5 && strcmp(entry->d_name + len - 5, ".json") == 0);
+		if (entry->d_name[0] == '.' || is_index_or_config || !is_recording(entry->d_name)) {
+			continue;
+		}
+
+		char fn[FILENAME_MAX];
+		snprintf(fn, sizeof(fn), "%s/%s", path, entry->d_name);
+		add_run(runner, fn);
+	}
+	closedir(dir);
+}
+
+static void write_json_string(FILE *f, const char *s) {
+	fputc('"', f);
+	for (; *s; s++) {
+		if (*s == '"' || *s == '\\') {
+			fputc('\\', f);
+		}
+		fputc(*s, f);
+	}
+	fputc('"', f);
+}
+
+static void write_error_json(FILE *f, const replay_error_stats *stats) {
+	FLT n = stats->count ? stats->count : 1;
+	fprintf(f,
+			"{\"count\": %zu, \"pos_mean\": %g, \"pos_rms\": %g, \"pos_max\": %g, \"rot_mean\": %g, \"rot_rms\": %g, "
+			"\"rot_max\": %g}",
+			stats->count, stats->pos_sum / n, sqrt(stats->pos_sq_sum / n), stats->pos_max, stats->rot_sum / n,
+			sqrt(stats->rot_sq_sum / n), stats->rot_max);
+}
+
+// time_key names wall_time_s, which is the time spent replaying; for the aggregate that is the sum over all files
+static void write_run_json(FILE *f, const char *indent, const char *time_key, size_t syncs, double sync_solve_time_s,
+						   uint64_t kalman_updates, double wall_time_s, double recording_time_s,
+						   const replay_error_stats *error) {
+	fprintf(f, "%s\"%s\": %g,\n", indent, time_key, wall_time_s);
+	fprintf(f, "%s\"recording_time_s\": %g,\n", indent, recording_time_s);
+	fprintf(f, "%s\"pose_error\": ", indent);
+	write_error_json(f, error);
+	fprintf(f, ",\n%s\"syncs\": %zu,\n", indent, syncs);
+	fprintf(f, "%s\"solver_time_per_sync_ms\": %g,\n", indent, syncs ? 1000. * sync_solve_time_s / syncs : 0.);
+	fprintf(f, "%s\"kalman_updates\": %" PRIu64 ",\n", indent, kalman_updates);
+	fprintf(f, "%s\"kalman_updates_per_s\": %g", indent, wall_time_s > 0 ? kalman_updates / wall_time_s : 0.);
+}
+
+static void write_json(FILE *f, const replay_runner *runner, int threads, double wall_time_s) {
+	replay_error_stats error = {0};
+	size_t syncs = 0, failures = 0;
+	double sync_solve_time_s = 0, cpu_time_s = 0, recording_time_s = 0;
+	uint64_t kalman_updates = 0;
+
+	fprintf(f, "{\n  \"files\": [\n");
+	for (size_t i = 0; i < runner->run_cnt; i++) {
+		const replay_run *run = &runner->runs[i];
+		fprintf(f, "    {\n      \"file\": ");
+		write_json_string(f, run->filename);
+		fprintf(f, ",\n      \"status\": %d,\n", run->status);
+		write_run_json(f, "      ", "wall_time_s", run->syncs, run->sync_solve_time_s, run->kalman_updates,
+					   run->wall_time_s, run->recording_time_s, &run->error);
+		fprintf(f, "\n    }%s\n", i + 1 < runner->run_cnt ? "," : "");
+
+		merge_error(&error, &run->error);
+		syncs += run->syncs;
+		sync_solve_time_s += run->sync_solve_time_s;
+		kalman_updates += run->kalman_updates;
+		cpu_time_s += run->wall_time_s;
+		recording_time_s += run->recording_time_s;
+		failures += run->status != 0;
+	}
+
+	// Peak RSS is only known for the process as a whole, so it is reported with the aggregate
+	struct rusage usage = {0};
+	getrusage(RUSAGE_SELF, &usage);
+
+	fprintf(f, "  ],\n  \"aggregate\": {\n");
+	fprintf(f, "    \"files\": %zu,\n    \"failures\": %zu,\n    \"threads\": %d,\n", runner->run_cnt, failures,
+			threads);
+	// Kalman updates per second are per worker; the elapsed time of the whole run is reported on its own
+	write_run_json(f, "    ", "total_replay_time_s", syncs, sync_solve_time_s, kalman_updates, cpu_time_s,
+				   recording_time_s, &error);
+	fprintf(f, ",\n    \"elapsed_time_s\": %g,\n    \"peak_rss_kb\": %ld\n  }\n}\n", wall_time_s, usage.ru_maxrss);
+}
+
+int main(int argc, char **argv) {
+	replay_runner runner = {0};
+	int threads = 4;
+	const char *output = 0;
+
+	int i = 1;
+	for (; i < argc && strcmp(argv[i], "--") != 0; i++) {
+		if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+			threads = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+			output = argv[++i];
+		} else {
+			add_path(&runner, argv[i]);
+		}
+	}
+	if (i < argc) {
+		runner.extra_argc = argc - i - 1;
+		runner.extra_argv = argv + i + 1;
+	}
+
+	if (runner.run_cnt == 0) {
+		fprintf(stderr, "Usage: %s [-j threads] [-o output.json] <recording or directory>... [-- <survive args>]\n",
+				argv[0]);
+		return -1;
+	}
+	if (threads < 1) {
+		threads = 1;
+	}
+
+	runner.lock = OGCreateMutex();
+	og_thread_t *workers = calloc(threads, sizeof(og_thread_t));
+
+	double start = OGGetAbsoluteTime();
+	for (int t = 0; t < threads; t++) {
+		workers[t] = OGCreateThread(replay_worker, "replay", &runner);
+	}
+	for (int t = 0; t < threads; t++) {
+		OGJoinThread(workers[t]);
+	}
+	double wall_time_s = OGGetAbsoluteTime() - start;
+
+	FILE *f = output ? fopen(output, "w") : stdout;
+	if (f == 0) {
+		fprintf(stderr, "Could not open %s for writing\n", output);
+		return -1;
+	}
+	write_json(f, &runner, threads, wall_time_s);
+	if (output) {
+		fclose(f);
+	}
+
+	int failures = 0;
+	for (size_t r = 0; r < runner.run_cnt; r++) {
+		failures += runner.runs[r].status != 0;
+		free((char *)runner.runs[r].filename);
+	}
+	free(runner.runs);
+	free(workers);
+	OGDeleteMutex(runner.lock);
+	return failures ? -1 : 0;
+}
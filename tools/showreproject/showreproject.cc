@@ -82,7 +82,8 @@ static void redraw(SurviveContext *ctx) {
 
 				if (SurviveSensorActivations_isPairValid(scene, SurviveSensorActivations_default_tolerance, timestamp,
 														 sensor, lh)) {
-					const double *a = scene->angles[sensor][lh];
+					const double a[2] = {SurviveSensorActivations_angle(scene, sensor, lh, 0),
+										 SurviveSensorActivations_angle(scene, sensor, lh, 1)};
 					// FLT a[2];
 					// survive_apply_bsd_calibration(so->ctx, lh, _a, a);
 